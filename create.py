@@ -43,9 +43,15 @@ parser.add_argument("-l", type=int, required=True, help="Maximum AM")
 parser.add_argument("-p", type=int, required=True, help="Start permuting the slow way when AM of a center reaches this value")
 parser.add_argument("-ve", required=False, type=int, default=0, help="External VRR for this L value and above")
 parser.add_argument("-vg", required=False, type=int, default=0, help="General VRR for this L value and above")
+parser.add_argument("-vc", required=False, type=int, default=0, help="Search VRR center order by cost (0 = no search, 1 = FLOPs, 2 = workspace)")
 parser.add_argument("-he", required=False, type=int, default=0, help="External HRR for this L value and above")
 parser.add_argument("-hg", required=False, type=int, default=0, help="General HRR for this L value and above")
+parser.add_argument("-ho", required=False, type=int, default=-1, help="Search for the optimal HRR path for quartets with total AM of this value and above (implies inline HRR for those quartets; -1 = never)")
 parser.add_argument("-d", required=False, type=int, default=0, help="Maximum derivative to generate code for")
+parser.add_argument("-c", required=False, action='store_true', help="Compact unscreened primitives into dense vectors")
+parser.add_argument("-f32", required=False, action='store_true', help="Also generate single precision (Boys function and VRR) kernels")
+parser.add_argument("-jk", required=False, action='store_true', help="Also generate kernels that digest the integrals into Coulomb and exchange matrices")
+parser.add_argument("-rb", required=False, action='store_true', help="Lower accuracy Boys function for vectors of integrals too small for its error to matter")
 parser.add_argument("outdir", type=str, help="Output directory")
 
 args = parser.parse_args()
@@ -162,6 +168,13 @@ worksize_bcont = [[0]*(maxam+1) for _ in range(derorder+1)]
 worksize_cont  = [[0]*(maxam+1) for _ in range(derorder+1)]
 worksize_prim  = [[0]*(maxam+1) for _ in range(derorder+1)]
 
+# Batch of final integrals for the fused J/K kernels
+worksize_jk = [0]*(maxam+1)
+
+# Cost of each (plain) kernel: flops per primitive quartet,
+# flops per contracted quartet, and its work sizes (bcont, prim, cont)
+ostei_cost = {}
+
 # Required external HRR and VRR
 reqext_hrr = []
 reqext_vrr = []
@@ -193,8 +206,26 @@ with open(headerfile, 'w') as hfile:
   hfile.write("\n")
 
 
-for q in valid:
-  filebase = "ostei_{}_{}_{}_{}".format(amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
+# Single precision and fused J/K kernels are generated
+# in addition to the plain (double precision) ones
+variants = [None]
+if args.f32:
+  variants.append("f32")
+if args.jk:
+  variants.append("jk")
+
+# Diagonal (ab|ab) kernels for Schwarz screening. These are always
+# generated, but only for ( a b | a b ) with a >= b
+variants.append("schwarz")
+
+def VariantQuartet(variant, q):
+  if variant == "schwarz":
+    return q[0] == q[2] and q[1] == q[3] and q[0] >= q[1]
+  return True
+
+for variant, q in [ (v, q) for v in variants for q in valid if VariantQuartet(v, q) ]:
+  prefix = "ostei_" + variant if variant else "ostei"
+  filebase = "{}_{}_{}_{}_{}".format(prefix, amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
   outfile = os.path.join(outdir_osteigen, filebase + ".c")
   logfile = os.path.join(outdir_osteigen, filebase + ".log")
   filelists[0][max(q)].append(filebase + ".c")
@@ -209,12 +240,25 @@ for q in valid:
     cmdline.extend(["-oh", headerfile])
     cmdline.extend(["-ve", str(args.ve)]) 
     cmdline.extend(["-vg", str(args.vg)]) 
+    cmdline.extend(["-vc", str(args.vc)]) 
     cmdline.extend(["-he", str(args.he)]) 
     cmdline.extend(["-hg", str(args.hg)]) 
 
-    if max(q) >= args.p:
+    if max(q) >= args.p and variant != "schwarz":
         cmdline.append("-p")
 
+    if args.ho >= 0 and sum(q) >= args.ho:
+        cmdline.append("-ho")
+
+    if args.c:
+        cmdline.append("-c")
+
+    if args.rb:
+        cmdline.append("-rb")
+
+    if variant:
+        cmdline.append("-" + variant)
+
     print()
     print("Command line:")
     print(' '.join(cmdline))
@@ -239,6 +283,13 @@ for q in valid:
       worksize_bcont[0][mq] = max(worksize_bcont[0][mq], int(line.split()[2]))
       worksize_prim[0][mq] = max(worksize_prim[0][mq], int(line.split()[3]))
       worksize_cont[0][mq] = max(worksize_cont[0][mq], int(line.split()[4]))
+      if not variant:
+        ostei_cost.setdefault(q, [0]*5)[2:5] = [ int(x) for x in line.split()[2:5] ]
+    elif line.startswith("FLOP COUNT"):
+      if not variant:
+        ostei_cost.setdefault(q, [0]*5)[0:2] = [ int(x) for x in line.split()[2:4] ]
+    elif line.startswith("JK WORK SIZE"):
+      worksize_jk[mq] = max(worksize_jk[mq], int(line.split()[3]))
     elif line.startswith("SIMINT EXTERNAL HRR"):
       reqam = tuple(line.split()[3:])
       reqext_hrr.append(reqam)
@@ -349,6 +400,7 @@ for q in valid:
     cmdline.extend(["-oh", headerfile])
     cmdline.extend(["-ve", str(args.ve)]) 
     cmdline.extend(["-vg", str(args.vg)]) 
+    cmdline.extend(["-vc", str(args.vc)]) 
     cmdline.extend(["-he", str(args.he)]) 
     cmdline.extend(["-hg", str(args.hg)]) 
 
@@ -420,6 +472,8 @@ with open(headerfile, 'w') as hfile:
   hfile.write("#define SIMINT_OSTEI_MAXAM @SIMINT_MAXAM@\n")
   hfile.write("#define SIMINT_OSTEI_MAXDER @SIMINT_MAXDER@\n")
   hfile.write("#define SIMINT_OSTEI_DERIV1_MAXAM (SIMINT_OSTEI_MAXDER > 0 ? @SIMINT_MAXAM@ : -1)\n")
+  hfile.write("#define SIMINT_OSTEI_F32 {}\n".format(1 if args.f32 else 0))
+  hfile.write("#define SIMINT_OSTEI_JK {}\n".format(1 if args.jk else 0))
   hfile.write("\n\n")
 
   # A function for determining the max work size
@@ -433,7 +487,13 @@ with open(headerfile, 'w') as hfile:
       max_bcont = max(worksize_bcont[d][:l+1])
       max_cont = max(worksize_cont[d][:l+1])
       max_prim = max(worksize_prim[d][:l+1])
-      hfile.write("        (SIMINT_SIMD_ROUND(SIMINT_NSHELL_SIMD*{}) + SIMINT_SIMD_ROUND({}) + SIMINT_SIMD_LEN*{}),\n".format(max_bcont, max_cont, max_prim))
+      # The HRR intermediates share space with the primitive arrays
+      hfile.write("        (SIMINT_SIMD_ROUND(SIMINT_NSHELL_SIMD*{0}) + (SIMINT_LAYOUT_LEN*{2} > SIMINT_SIMD_ROUND({1}) ? SIMINT_LAYOUT_LEN*{2} : SIMINT_SIMD_ROUND({1}))".format(max_bcont, max_cont, max_prim))
+      # The fused J/K kernels keep one batch of final integrals after that
+      max_jk = max(worksize_jk[:l+1]) if d == 0 else 0
+      if max_jk > 0:
+        hfile.write(" + SIMINT_NSHELL_SIMD*{}".format(max_jk))
+      hfile.write("),\n")
     hfile.write("      },\n")  
 
   hfile.write("    };\n") # close static array 
@@ -447,6 +507,50 @@ with open(headerfile, 'w') as hfile:
   hfile.write("}\n\n")
   hfile.write("\n")
 
+  # Predicted cost of each kernel. Quartets that are computed
+  # by permuting another use the cost of that one
+  hfile.write("/*! \\brief Predicted cost of computing a shell quartet\n")
+  hfile.write(" *\n")
+  hfile.write(" * The FLOPs are counted from the recurrence relations used by the\n")
+  hfile.write(" * generated kernels (FMA counted as 2, the Boys function estimated).\n")
+  hfile.write(" * They do not include the padding of vectors with unused lanes.\n")
+  hfile.write(" */\n")
+  hfile.write("struct simint_ostei_cost_info\n")
+  hfile.write("{\n")
+  hfile.write("    double prim_flops;  // primitive part (Boys function, VRR, accumulation)\n")
+  hfile.write("    double cont_flops;  // contracted part (HRR)\n")
+  hfile.write("    double flops;       // total\n")
+  hfile.write("    size_t workmem;     // workspace used by the kernel (bytes)\n")
+  hfile.write("};\n\n")
+
+  hfile.write("static inline struct simint_ostei_cost_info\n")
+  hfile.write("simint_ostei_cost(int am1, int am2, int am3, int am4, int nprim_bra, int nprim_ket)\n")
+  hfile.write("{\n")
+  hfile.write("    // flops per primitive quartet, flops per contracted quartet,\n")
+  hfile.write("    // and the work sizes (contracted, primitive, HRR)\n")
+  hfile.write("    static const size_t cost[{}][5] = {{\n".format((maxam+1)**4))
+  for i in range(0, maxam + 1):
+    for j in range(0, maxam + 1):
+      for k in range(0, maxam + 1):
+        for l in range(0, maxam + 1):
+          q = (i,j,k,l)
+          if not q in ostei_cost:
+            q = (max(i,j), min(i,j), max(k,l), min(k,l))
+          hfile.write("      {{ {} }}, // {}\n".format(", ".join(str(x) for x in ostei_cost[q]), QStr((i,j,k,l))))
+  hfile.write("    };\n\n")
+  hfile.write("    struct simint_ostei_cost_info info = { 0.0, 0.0, 0.0, 0 };\n")
+  hfile.write("    if(am1 < 0 || am2 < 0 || am3 < 0 || am4 < 0 ||\n")
+  hfile.write("       am1 > SIMINT_OSTEI_MAXAM || am2 > SIMINT_OSTEI_MAXAM ||\n")
+  hfile.write("       am3 > SIMINT_OSTEI_MAXAM || am4 > SIMINT_OSTEI_MAXAM)\n")
+  hfile.write("        return info;\n\n")
+  hfile.write("    const size_t * c = cost[((am1*{0} + am2)*{0} + am3)*{0} + am4];\n".format(maxam+1))
+  hfile.write("    info.prim_flops = (double)c[0] * nprim_bra * nprim_ket;\n")
+  hfile.write("    info.cont_flops = (double)c[1];\n")
+  hfile.write("    info.flops = info.prim_flops + info.cont_flops;\n")
+  hfile.write("    info.workmem = (SIMINT_SIMD_ROUND(SIMINT_NSHELL_SIMD*c[2]) + (SIMINT_LAYOUT_LEN*c[3] > SIMINT_SIMD_ROUND(c[4]) ? SIMINT_LAYOUT_LEN*c[3] : SIMINT_SIMD_ROUND(c[4])))*sizeof(double);\n")
+  hfile.write("    return info;\n")
+  hfile.write("}\n\n")
+
 
 
 ####################################################
@@ -481,6 +585,7 @@ with open(headerfile, 'w') as hfile:
   hfile.write("#endif\n")
   hfile.write("\n\n")
   hfile.write("#include \"simint/vectorization/vectorization.h\"\n")
+  hfile.write("#include \"simint/ostei/ostei_isa.h\"\n")
   hfile.write("\n")
 
 
@@ -587,6 +692,7 @@ with open(headerfile, 'w') as hfile:
   hfile.write("#endif\n")
   hfile.write("\n\n")
   hfile.write("#include \"simint/vectorization/vectorization.h\"\n")
+  hfile.write("#include \"simint/ostei/ostei_isa.h\"\n")
   hfile.write("\n")
 
 
@@ -662,6 +768,26 @@ for d in range(0, derorder+1):
           f.write("ostei/gen/" + line + "\n")
 
 
+####################################################
+# Names of everything compiled separately for each
+# instruction set (see simint/ostei/ostei_isa.h)
+####################################################
+isa_names = []
+for headerbase in [ "ostei_generated.h", "ostei_deriv1_generated.h", "vrr_generated.h", "hrr_generated.h" ]:
+  headerfile = os.path.join(outdir_osteigen, headerbase)
+  if os.path.isfile(headerfile):
+    for line in open(headerfile, 'r').readlines():
+      m = re.match(r"^(?:int|void) (\w+)\(", line)
+      if m:
+        isa_names.append(m.group(1))
+
+with open(os.path.join(outdir_osteigen, "ostei_isa_names.h"), 'w') as hfile:
+  hfile.write("#pragma once\n\n")
+  for name in isa_names:
+    hfile.write("#define {0} SIMINT_ISA_NAME({0})\n".format(name))
+  hfile.write("\n")
+
+
 # Make the default AM, highest derivative the same as the max
 with open(os.path.join(outdir_cmake, "MaxAvailable.cmake"), 'w') as f:
     f.write("set(SIMINT_MAXDER_AVAILABLE {})\n".format(derorder))
@@ -70,12 +70,26 @@ std::vector<std::string> ParseCommonOptions(OptionMap & options, int argc, char
             options[Option::ExternalVRR] = GetIArg(i, argc, argv);
         else if(argstr == "-vg")
             options[Option::GeneralVRR] = GetIArg(i, argc, argv);
+        else if(argstr == "-vc")
+            options[Option::VRRCost] = GetIArg(i, argc, argv);
         else if(argstr == "-he")
             options[Option::ExternalHRR] = GetIArg(i, argc, argv);
         else if(argstr == "-hg")
             options[Option::GeneralHRR] = GetIArg(i, argc, argv);
+        else if(argstr == "-ho")
+            options[Option::OptimalHRR] = 1;
         else if(argstr == "-p")
             options[Option::FinalPermute] = 1;
+        else if(argstr == "-c")
+            options[Option::PrimCompact] = 1;
+        else if(argstr == "-f32")
+            options[Option::Float32] = 1;
+        else if(argstr == "-jk")
+            options[Option::FusedJK] = 1;
+        else if(argstr == "-schwarz")
+            options[Option::SchwarzDiag] = 1;
+        else if(argstr == "-rb")
+            options[Option::ReducedBoys] = 1;
         else
             ret.push_back(argstr);
     }
@@ -8,7 +8,9 @@
 #ifndef SIMINT_GUARD_GENERATOR__COMMANDLINE_HPP_
 #define SIMINT_GUARD_GENERATOR__COMMANDLINE_HPP_
 
+#include <string>
 #include <vector>
+#include <stdexcept>
 #include "generator/Options.hpp"
 
 
@@ -87,6 +87,48 @@ public:
         return GetOption(Option::FinalPermute);
     }
 
+    /*! \brief Generate code that compacts unscreened primitives into dense vectors
+     *
+     * Always for single precision, whose vectors have twice the lanes
+     * of the double precision ones (and so don't match the padding of
+     * the shell pairs)
+     */   
+    bool PrimCompact(void) const
+    {
+        return GetOption(Option::PrimCompact) || Float32();
+    }
+
+    /*! \brief Generate code that computes the primitive integrals in single precision
+     */   
+    bool Float32(void) const
+    {
+        return GetOption(Option::Float32);
+    }
+
+    /*! \brief Generate code that contracts the final integrals into J and K
+     */   
+    bool FusedJK(void) const
+    {
+        return GetOption(Option::FusedJK);
+    }
+
+    /*! \brief Generate code that only computes the diagonal (ab|ab) integrals
+     */   
+    bool SchwarzDiag(void) const
+    {
+        return GetOption(Option::SchwarzDiag);
+    }
+
+    /*! \brief Generate code that uses a lower accuracy Boys function for
+     *         vectors whose integrals are too small for its error to matter
+     *
+     * Not for single precision or (ab|ab) kernels
+     */   
+    bool ReducedBoys(void) const
+    {
+        return GetOption(Option::ReducedBoys) && !Float32() && !SchwarzDiag();
+    }
+
 
 private:
     //! The requested AM quartet
@@ -19,6 +19,23 @@ enum class Option
     ExternalHRR,  //!< Write external HRR at this L value and above
     GeneralHRR,   //!< Write general HRR at this L value and above
     FinalPermute, //!< Generate code for permuting final integrals
+    PrimCompact,  //!< Compact unscreened ket primitives into dense vectors
+    VRRCost,      //!< Search VRR center orders with this metric (see VRRCostMetric)
+    OptimalHRR,   //!< Search for the HRR path with the fewest steps
+    Float32,      //!< Compute the Boys function and VRR in single precision
+    FusedJK,      //!< Contract the final integrals with a density into J and K
+    SchwarzDiag,  //!< Compute only the diagonal (ab|ab) integrals (for Schwarz screening)
+    ReducedBoys,  //!< Lower accuracy Boys function for vectors of small integrals
+};
+
+
+/*! \brief Metric used to pick the order of centers in the VRR
+ */
+enum class VRRCostMetric
+{
+    None = 0,      //!< Do not search; use the default (lowest AM first) order
+    FLOPs = 1,     //!< Minimize floating point operations (ties broken by workspace)
+    Workspace = 2  //!< Minimize primitive workspace (ties broken by FLOPs)
 };
 
 
@@ -37,6 +54,13 @@ inline OptionMap DefaultOptions(void)
                       {Option::ExternalHRR, 0},
                       {Option::GeneralHRR, 0},
                       {Option::FinalPermute, 0},
+                      {Option::PrimCompact, 0},
+                      {Option::VRRCost, 0},
+                      {Option::OptimalHRR, 0},
+                      {Option::Float32, 0},
+                      {Option::FusedJK, 0},
+                      {Option::SchwarzDiag, 0},
+                      {Option::ReducedBoys, 0},
                     };
 }
 
@@ -8,4 +8,5 @@
 #pragma once
 
 #include "generator/ostei/Makowski.hpp"
+#include "generator/ostei/Optimal_HRR.hpp"
 
@@ -25,60 +25,10 @@ class Makowski_HRR : public OSTEI_HRR_Algorithm_Base
     private:
         virtual HRRDoubletStep DoubletStep_(const Doublet & target, RRStepType steptype)
         {
-            const std::string tag = target.tag;
-
             if(target.am() == 0)
                 throw std::runtime_error("Cannot HRR step to an s doublet!");
 
-            const Gaussian * t;
-            const Gaussian * t2;
-
-            if(steptype == RRStepType::I || steptype == RRStepType::K)  // Going J->I or L->K
-            {
-                t = &target.left;
-                t2 = &target.right;
-            }
-            else // Going I->J or K->L
-            {
-                t = &target.right;
-                t2 = &target.left;
-            }
-                
-
-            // idx is the xyz index
-            ExpList ijk = t->ijk;
-            std::sort(ijk.begin(), ijk.end());
-            auto v = std::find_if(ijk.begin(), ijk.end(), [](int i) { return i != 0; });
-            auto it = std::find(t->ijk.rbegin(), t->ijk.rend(), *v); 
-            int idx = 2 - std::distance(t->ijk.rbegin(), it);  // remember we are working with reverse iterators
-
-            // gaussian common to both src1 and src2
-            Gaussian common(t->StepDown(idx, 1));
-
-            // for src1
-            Gaussian src1g(t2->StepUp(idx, 1));
-
-            // create new doublets
-            Doublet src1d, src2d;
-            if(steptype == RRStepType::I || steptype == RRStepType::K)
-            {
-                src1d = Doublet{target.type, common, src1g, tag};
-                src2d = Doublet{target.type, common, target.right, tag};
-            }
-            else
-            {
-                src1d = Doublet{target.type, src1g, common, tag};
-                src2d = Doublet{target.type, target.left, common, tag};
-            }
-           
-            XYZStep xyzstep = IdxToXYZStep(idx);
-
-            // Create the HRR doublet step
-            HRRDoubletStep hrr{steptype,
-                               target, 
-                               src1d, src2d,
-                               xyzstep};
-            return hrr;
+            return MakeStep_(target, steptype, MakowskiIdx_(MovingGaussian_(target, steptype)));
         }
 };
 
@@ -293,15 +293,15 @@ void OSTEIDeriv1_Writer::PartitionWorkspace(void) const
     else
     {
         os_ << indent1 << "SIMINT_DBLTYPE * const primwork = (SIMINT_DBLTYPE *)(work + SIMINT_NSHELL_SIMD*" << ptidx << ");\n";
-        ptidx = 0;
+
+        // arrays that are not needed at the same time share space
+        std::map<QAM, size_t> offsets;
+        PackPrimWorkspace(offsets);
 
         for(const auto & am : vrr_writer_.Algo().GetAllAM())
         {
-            // add +1 fromm required m values to account for 0
             os_ << indent1 << "SIMINT_DBLTYPE * const restrict " << PrimVarName(am)
-                << " = primwork + " << ptidx << ";\n";
-
-            ptidx += (vrr_writer_.Algo().GetMReq(am)+1) * NCART(am);
+                << " = primwork + " << offsets.at(am) << ";\n";
         }
     }
 
@@ -317,13 +317,15 @@ void OSTEIDeriv1_Writer::PartitionWorkspace(void) const
     }
     else
     {
-        os_ << indent1 << "double * const hrrwork = (double *)(primwork + " << ptidx << ");\n";
-        ptidx = 0;
+        // The HRR is done after all primitives have been contracted, so
+        // the HRR intermediates can use the space of the primitive arrays
+        os_ << indent1 << "double * const hrrwork = (double *)primwork;\n";
+
+        std::map<QAM, size_t> offsets;
+        PackHRRWorkspace(offsets, DerivInputs_());
+
         for(auto am : hrr_writer_.Algo().GetIntermediates())
-        {
-            os_ << indent1 << "double * const " << HRRVarName(am) << " = hrrwork + " << ptidx << ";\n";
-            ptidx += NCART(am);
-        }
+            os_ << indent1 << "double * const " << HRRVarName(am) << " = hrrwork + " << offsets.at(am) << ";\n";
     }
 
     os_ << "\n\n";
@@ -331,6 +333,21 @@ void OSTEIDeriv1_Writer::PartitionWorkspace(void) const
 
 
 
+QAMSet OSTEIDeriv1_Writer::DerivInputs_(void) const
+{
+    // HRR intermediates that are read by WriteFormDeriv
+    QAM am = info_.FinalAM();
+    return QAMSet{QAM({am[0]+1, am[1]  , am[2]  , am[3]  }, "2a"),
+                  QAM({am[0],   am[1]+1, am[2]  , am[3]  }, "2b"),
+                  QAM({am[0],   am[1]  , am[2]+1, am[3]  }, "2c"),
+                  QAM({am[0],   am[1]  , am[2]  , am[3]+1}, "2d"),
+                  QAM{am[0]-1, am[1]  , am[2]  , am[3]  },
+                  QAM{am[0],   am[1]-1, am[2]  , am[3]  },
+                  QAM{am[0],   am[1]  , am[2]-1, am[3]  },
+                  QAM{am[0],   am[1]  , am[2]  , am[3]-1}};
+}
+
+
 void OSTEIDeriv1_Writer::WriteFormDeriv(void) const
 {
     QAM am = info_.FinalAM();
@@ -569,25 +586,20 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
     for(const auto & it : batchcontq)
         bcont_nelements += NCART(it);
 
-    // these are the non-batched quartets we need
-    QAMSet contam = hrr_writer_.Algo().GetIntermediates();
+    // the non-batched quartets we need (HRR intermediates)
+    // and how many elements is that (after packing)
+    std::map<QAM, size_t> contoffsets;
+    size_t cont_nelements = PackHRRWorkspace(contoffsets, DerivInputs_());
 
-    // how many elements is that
-    size_t cont_nelements = 0;
-    for(const auto & it : contam)
-        cont_nelements += NCART(it);
-
-    // these are the primitives we need
-    QAMSet primam = vrr_writer_.Algo().GetAllAM();
-
-    // how many elements is that
-    size_t prim_nelements = 0;
-    for(const auto & it : primam)
-        prim_nelements += NCART(it) * (vrr_writer_.Algo().GetMReq(it)+1);
+    // the primitives we need
+    // and how many elements is that (after packing)
+    std::map<QAM, size_t> primoffsets;
+    size_t prim_nelements = PackPrimWorkspace(primoffsets);
 
 
     // add includes
     IncludeSet includes{"<string.h>",
+                        "<float.h>",
                         "<math.h>",
                         "\"simint/ostei/gen/ostei_deriv1_generated.h\"",
                         "\"simint/vectorization/vectorization.h\"",
@@ -645,6 +657,8 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
     os_ << indent1 << "int istart, jstart;\n";
     os_ << indent1 << "int iprimcd, nprim_icd, icd;\n";
     os_ << indent1 << "const int check_screen = (screen_tol > 0.0);\n";
+    os_ << indent1 << "const int check_density = (check_screen && P.density_max != NULL && Q.density_max != NULL);\n";
+    os_ << indent1 << "const int check_qqr = (check_screen && P.extent != NULL && Q.extent != NULL);\n";
     os_ << indent1 << "int i, j;\n";
     os_ << indent1 << "int n;\n";
     os_ << indent1 << "int not_screened;\n";
@@ -669,6 +683,10 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
     for(const auto & it : cm)
         os_ << indent1 << "const SIMINT_DBLTYPE " << it.first << " = SIMINT_DBLSET1(" << it.second << ");\n";
 
+    os_ << "\n";
+    os_ << indent1 << "// Screening statistics (see simint_stats_get)\n";
+    os_ << indent1 << "long calc_nprim = 0, skip_nprim = 0, calc_nvec = 0, skip_nvec = 0, boys_mixed = 0;\n";
+
     os_ << "\n\n";
     os_ << indent1 << "////////////////////////////////////////\n";
     os_ << indent1 << "// Loop over shells and primitives\n";
@@ -700,6 +718,8 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
     os_ << indent4 << "jend += Q.nprim12[cd+i];\n";
     os_ << "\n";
 
+    WriteBatchScreenTol();
+
 
     if(hashrr)
     {
@@ -712,15 +732,22 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
     os_ << "\n";
     os_ << indent3 << "for(i = istart; i < iend; ++i)\n";
     os_ << indent3 << "{\n";
-    os_ << indent4 << "SIMINT_DBLTYPE bra_screen_max;  // only used if check_screen\n\n";
+    os_ << indent4 << "SIMINT_DBLTYPE bra_screen_max;  // only used if check_screen\n";
+    os_ << indent4 << "SIMINT_DBLTYPE bra_extent = SIMINT_DBLSET1(0.0);  // only used if check_qqr\n\n";
 
     os_ << indent4 << "if(check_screen)\n";
     os_ << indent4 << "{\n";
     os_ << indent5 << "// Skip this whole thing if always insignificant\n";
-    os_ << indent5 << "if((P.screen[i] * Q.screen_max) < screen_tol)\n";
+    os_ << indent5 << "if((P.screen[i] * Q.screen_max) < batch_screen_tol)\n";
+    os_ << indent5 << "{\n";
+    os_ << indent6 << "skip_nprim += jend - jstart;\n";
+    os_ << indent6 << "skip_nvec += (jend - jstart + SIMINT_SIMD_LEN - 1) / SIMINT_SIMD_LEN;\n";
     os_ << indent6 << "continue;\n";
+    os_ << indent5 << "}\n";
 
     os_ << indent5 << "bra_screen_max = SIMINT_DBLSET1(P.screen[i]);\n";
+    os_ << indent5 << "if(check_qqr)\n";
+    os_ << indent6 << "bra_extent = SIMINT_DBLSET1(P.extent[i]);\n";
     os_ << indent4 << "}\n\n";
 
     os_ << indent4 << "icd = 0;\n";
@@ -759,16 +786,23 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
 
     os_ << indent5 << "// Do we have to compute this vector (or has it been screened out)?\n";
     os_ << indent5 << "// (not_screened != 0 means we have to do this vector)\n";
+    os_ << indent5 << "int calc_nprim_in_vec = SIMINT_SIMD_LEN;\n";
     os_ << indent5 << "if(check_screen)\n";
     os_ << indent5 << "{\n";
-    os_ << indent6 << "const double vmax = vector_max(SIMINT_MUL(bra_screen_max, SIMINT_DBLLOAD(Q.screen, j)));\n";
-    os_ << indent6 << "if(vmax < screen_tol)\n";
+    WriteVectorScreenEstimate();
+    os_ << indent6 << "if(vmax < batch_screen_tol)\n";
     os_ << indent6 << "{\n";
+    os_ << indent7 << "skip_nvec++;\n";
+    os_ << indent7 << "skip_nprim += SIMINT_SIMD_LEN;\n";
     for(const auto it : batchcontq)
         os_ << indent7 << PrimPtrName(it) << " += lastoffset*" << NCART(it) << ";\n";
     os_ << indent7 << "continue;\n";
     os_ << indent6 << "}\n";
-    os_ << indent5 << "}\n\n";
+    os_ << indent6 << "calc_nprim_in_vec = count_prim_screen_survival(screen_est, batch_screen_tol);\n";
+    os_ << indent5 << "}\n";
+    os_ << indent5 << "calc_nvec++;\n";
+    os_ << indent5 << "calc_nprim += calc_nprim_in_vec;\n";
+    os_ << indent5 << "skip_nprim += SIMINT_SIMD_LEN - calc_nprim_in_vec;\n\n";
 
 
     os_ << indent5 << "const SIMINT_DBLTYPE Q_alpha = SIMINT_DBLLOAD(Q.alpha, j);\n";
@@ -854,7 +888,7 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
     // we need to zero out any that are beyond the end of the batch (that's been clipped)
     os_ << indent5 << "const SIMINT_DBLTYPE Q_prefac = mask_load(nlane, Q.prefac + j);\n";
     os_ << "\n\n";
-    os_ << indent5 << "boys_F_split(" << PrimVarName({0,0,0,0})
+    os_ << indent5 << "boys_mixed += boys_F_split(" << PrimVarName({0,0,0,0})
                    << ", F_x, " << (info_.L()+1) << ");\n";
 
 
@@ -900,6 +934,9 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
 
     os_ << indent1 << "}  // close loop over ab\n";
     os_ << "\n";
+    os_ << indent1 << "simint_stats_add_kernel(P.nshell12_clip * Q.nshell12_clip, calc_nprim, skip_nprim,\n";
+    os_ << indent1 << "                        calc_nvec, skip_nvec, boys_mixed);\n";
+    os_ << "\n";
     os_ << indent1 << "return P.nshell12_clip * Q.nshell12_clip;\n";
     os_ << "}\n";
     os_ << "\n";
@@ -907,6 +944,7 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
 
     // Write out memory requirement to the log file
     std::cout << "\nWORK SIZE: " << bcont_nelements << "  " << prim_nelements << " " << cont_nelements << "\n";
+    std::cout << "FLOP COUNT: " << PrimitiveFlops(bcont_nelements) << " " << ContractedFlops() << "\n";
 }
 
 
@@ -41,6 +41,65 @@ void OSTEI_HRR_Algorithm_Base::PruneDoublets_(DoubletSet & d, DoubletSet & prune
     d = dnew; 
 }
 
+const Gaussian & OSTEI_HRR_Algorithm_Base::MovingGaussian_(const Doublet & d, RRStepType steptype)
+{
+    if(steptype == RRStepType::I || steptype == RRStepType::K)  // Going J->I or L->K
+        return d.left;
+    else // Going I->J or K->L
+        return d.right;
+}
+
+
+int OSTEI_HRR_Algorithm_Base::MakowskiIdx_(const Gaussian & g)
+{
+    // lowest exponent, favoring the far right if equal
+    ExpList ijk = g.ijk;
+    std::sort(ijk.begin(), ijk.end());
+    auto v = std::find_if(ijk.begin(), ijk.end(), [](int i) { return i != 0; });
+    auto it = std::find(g.ijk.rbegin(), g.ijk.rend(), *v);
+    return 2 - std::distance(g.ijk.rbegin(), it);  // remember we are working with reverse iterators
+}
+
+
+HRRDoubletStep OSTEI_HRR_Algorithm_Base::MakeStep_(const Doublet & target, RRStepType steptype, int idx)
+{
+    const Gaussian * t;
+    const Gaussian * t2;
+
+    if(steptype == RRStepType::I || steptype == RRStepType::K)  // Going J->I or L->K
+    {
+        t = &target.left;
+        t2 = &target.right;
+    }
+    else // Going I->J or K->L
+    {
+        t = &target.right;
+        t2 = &target.left;
+    }
+
+    // gaussian common to both src1 and src2
+    Gaussian common(t->StepDown(idx, 1));
+
+    // for src1
+    Gaussian src1g(t2->StepUp(idx, 1));
+
+    // create new doublets
+    Doublet src1d, src2d;
+    if(steptype == RRStepType::I || steptype == RRStepType::K)
+    {
+        src1d = Doublet{target.type, common, src1g, target.tag};
+        src2d = Doublet{target.type, common, target.right, target.tag};
+    }
+    else
+    {
+        src1d = Doublet{target.type, src1g, common, target.tag};
+        src2d = Doublet{target.type, target.left, common, target.tag};
+    }
+
+    return HRRDoubletStep{steptype, target, {{src1d, src2d}}, IdxToXYZStep(idx)};
+}
+
+
 void OSTEI_HRR_Algorithm_Base::AMOrder_AddWithDependencies_(QAMList & order,
                                                             QAMSet & topqam,
                                                             std::map<QAM, DoubletType> & smap,
@@ -157,20 +216,34 @@ void OSTEI_HRR_Algorithm_Base::Create(QAM am,
 }
 
 
-void OSTEI_HRR_Algorithm_Base::Create(std::set<QAM> am)
+void OSTEI_HRR_Algorithm_Base::ChooseSteps_(const std::set<QAM> & am,
+                                            RRStepType & brasteptype,
+                                            RRStepType & ketsteptype)
 {
     QAM highest_am = *(am.rbegin());
 	
     // What direction are we going for the bra?
-	RRStepType brasteptype = RRStepType::J;  // Moving I->J
+	brasteptype = RRStepType::J;  // Moving I->J
 	if(highest_am[0] < highest_am[1])
 	    brasteptype = RRStepType::I; // Moving J->I
 
 	// What direction are we going for the ket?
-	RRStepType ketsteptype = RRStepType::L;  // Moving K->L
+	ketsteptype = RRStepType::L;  // Moving K->L
 	if(highest_am[2] < highest_am[3])
 	    ketsteptype = RRStepType::K; // Moving L->K
+}
+
+
+void OSTEI_HRR_Algorithm_Base::PlanDoubletSteps_(const DoubletSet & targets, RRStepType steptype)
+{
+    // By default, each step is chosen independently by DoubletStep_
+}
+
 
+void OSTEI_HRR_Algorithm_Base::Create(std::set<QAM> am)
+{
+    RRStepType brasteptype, ketsteptype;
+    ChooseSteps_(am, brasteptype, ketsteptype);
     Create(am, brasteptype, ketsteptype);
 }
 
@@ -196,6 +269,7 @@ void OSTEI_HRR_Algorithm_Base::Create(std::set<QAM> am,
     //PrintDoubletSet(targets, "Initial ket targets");
 
     // Solve the ket part
+    PlanDoubletSteps_(targets, ketsteptype);
     HRRDoubletStepList ketsteps;
     HRRDoubletLoop_(ketsteps, targets, solvedkets, prunedket, ketsteptype);
     std::reverse(ketsteps.begin(), ketsteps.end());
@@ -239,6 +313,7 @@ void OSTEI_HRR_Algorithm_Base::Create(std::set<QAM> am,
     //PrintDoubletSet(targets, "Initial bra targets");
 
     // Solve the bra part
+    PlanDoubletSteps_(targets, brasteptype);
     HRRDoubletStepList brasteps;
     HRRDoubletLoop_(brasteps, targets, solvedbras, prunedbra, brasteptype);
     std::reverse(brasteps.begin(), brasteps.end());
@@ -328,6 +403,24 @@ HRRDoubletStepList OSTEI_HRR_Algorithm_Base::GetKetSteps(DAM am) const
         return HRRDoubletStepList();
 }
 
+size_t OSTEI_HRR_Algorithm_Base::GetFlops(void) const
+{
+    // Mirrors what is written by OSTEI_HRR_Writer. Each step
+    // (target = src0 + hAB * src1) is an FMA, done for all
+    // cartesian components of the other doublet
+    size_t flops = 0;
+
+    for(const auto & am : amorder_)
+    {
+        if(stepmap_.at(am) == DoubletType::BRA)
+            flops += 2 * GetBraSteps(DAM{am[0], am[1]}).size() * NCART(am[2], am[3]);
+        else
+            flops += 2 * GetKetSteps(DAM{am[2], am[3]}).size() * NCART(am[0], am[1]);
+    }
+
+    return flops;
+}
+
 bool OSTEI_HRR_Algorithm_Base::HasHRR(void) const
 {
     return HasBraHRR() || HasKetHRR();
@@ -36,6 +36,12 @@ class OSTEI_HRR_Algorithm_Base
         HRRDoubletStepList GetBraSteps(DAM am) const;
         HRRDoubletStepList GetKetSteps(DAM am) const;
 
+        /*! \brief Floating point operations of the HRR (per contracted quartet)
+         *
+         * FMA are counted as 2
+         */
+        size_t GetFlops(void) const;
+
         bool HasHRR(void) const;
         bool HasBraHRR(void) const;
         bool HasKetHRR(void) const;
@@ -46,6 +52,23 @@ class OSTEI_HRR_Algorithm_Base
     protected:
         OSTEI_GeneratorInfo info_;
 
+        virtual void ChooseSteps_(const std::set<QAM> & am,
+                                  RRStepType & brasteptype,
+                                  RRStepType & ketsteptype);
+
+        virtual void PlanDoubletSteps_(const DoubletSet & targets, RRStepType steptype);
+
+        static void PruneDoublets_(DoubletSet & d, DoubletSet & pruned, RRStepType steptype);
+
+        //! Gaussian of \p d that is stepped down (left for I and K steps, right for J and L)
+        static const Gaussian & MovingGaussian_(const Doublet & d, RRStepType steptype);
+
+        //! Xyz index of the lowest nonzero exponent of \p g, favoring the far right if equal
+        static int MakowskiIdx_(const Gaussian & g);
+
+        //! HRR step of \p target along the xyz index \p idx
+        static HRRDoubletStep MakeStep_(const Doublet & target, RRStepType steptype, int idx);
+
     private:
 
         DAMSet allbraam_, allketam_;
@@ -67,8 +90,6 @@ class OSTEI_HRR_Algorithm_Base
                              DoubletSet & pruned,
                              RRStepType steptype);
 
-        static void PruneDoublets_(DoubletSet & d, DoubletSet & pruned, RRStepType steptype);
-
         void AMOrder_AddWithDependencies_(QAMList & order,
                                           QAMSet & topqam,
                                           std::map<QAM, DoubletType> & smap,
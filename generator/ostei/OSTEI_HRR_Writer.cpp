@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+
 #include "generator/ostei/OSTEI_GeneratorInfo.hpp"
 #include "generator/ostei/OSTEI_HRR_Writer.hpp"
 #include "generator/Printing.hpp"
@@ -129,7 +133,12 @@ void OSTEI_HRR_Writer::WriteHRR(std::ostream & os) const
         os << indent3 << "const double hAB[3] = { P.AB_x[ab], P.AB_y[ab], P.AB_z[ab] };\n"; 
     os << "\n\n";
 
-    os << indent3 << "for(abcd = 0; abcd < nshellbatch; ++abcd, ++real_abcd)\n";
+    // With fused J/K digestion, the final integrals only go to a buffer
+    // for the current batch. The diagonal integrals go straight to the output
+    if(info_.FusedJK() || info_.SchwarzDiag())
+        os << indent3 << "for(abcd = 0; abcd < nshellbatch; ++abcd)\n";
+    else
+        os << indent3 << "for(abcd = 0; abcd < nshellbatch; ++abcd, ++real_abcd)\n";
     os << indent3 << "{\n";
 
     if(hrr_algo_.HasKetHRR())
@@ -140,7 +149,14 @@ void OSTEI_HRR_Writer::WriteHRR(std::ostream & os) const
         os << indent4 << "double const * restrict " << HRRVarName(it) << " = " << ArrVarName(it) << " + abcd * " << NCART(it) << ";\n";
 
     // and also for the final integral
-    if(info_.Deriv() == 0)
+    if(info_.SchwarzDiag())
+    {
+        WriteHRR_Diagonal_(os);
+        return;
+    }
+    else if(info_.FusedJK())
+        os << indent4 << "double * restrict " << HRRVarName(finalam) << " = " << ArrVarName(finalam) << " + abcd * " << NCART(finalam) << ";\n";
+    else if(info_.Deriv() == 0)
         os << indent4 << "double * restrict " << HRRVarName(finalam) << " = " << ArrVarName(finalam) << " + real_abcd * " << NCART(finalam) << ";\n";
     else if(info_.Deriv() == 1)
         os << indent4 << "double * restrict " << HRRVarName(finalam) << " = " << ArrVarName(finalam) << " + real_abcd * " << NCART(finalam) << " * 12;\n";
@@ -180,6 +196,131 @@ void OSTEI_HRR_Writer::WriteHRR(std::ostream & os) const
 
 }
 
+void OSTEI_HRR_Writer::WriteHRR_Diagonal_(std::ostream & os) const
+{
+    // One element of an HRR array (array name and index)
+    typedef std::pair<std::string, int> HRRElement;
+
+    struct HRRElementStep
+    {
+        HRRElement target;
+        HRRElement src[2];
+        const char * sign;
+        const char * h;
+        int xyz;
+    };
+
+    // All the steps, element by element, in the order they would
+    // be done by the inline HRR
+    std::vector<HRRElementStep> steps;
+
+    for(auto am : hrr_algo_.GetAMOrder())
+    {
+        if(hrr_algo_.GetDoubletStep(am) == DoubletType::BRA)
+        {
+            const int ncart_ket = NCART(am[2], am[3]);
+            const std::string ketstr = StringBuilder(amchar[am[2]], "_", amchar[am[3]]);
+
+            for(int iket = 0; iket < ncart_ket; iket++)
+            for(const auto & it : hrr_algo_.GetBraSteps(DAM{am[0], am[1]}))
+            {
+                Doublet target(it.target);
+                Doublet src0(it.src[0]);
+                Doublet src1(it.src[1]);
+                target.tag = src0.tag = src1.tag = am.tag;
+
+                auto element = [&](const Doublet & d) -> HRRElement
+                {
+                    return { StringBuilder("HRR_", ArrVarName(d, ketstr)), d.index() * ncart_ket + iket };
+                };
+
+                steps.push_back({ element(target), { element(src0), element(src1) },
+                                  (it.type == RRStepType::I ? " - " : " + "), "hAB",
+                                  static_cast<int>(it.xyz) });
+            }
+        }
+        else
+        {
+            const int ncart_bra = NCART(DAM{am[0], am[1]});
+            const std::string brastr = StringBuilder(amchar[am[0]], "_", amchar[am[1]]);
+
+            for(int ibra = 0; ibra < ncart_bra; ibra++)
+            for(const auto & it : hrr_algo_.GetKetSteps(DAM{am[2], am[3]}))
+            {
+                Doublet target(it.target);
+                Doublet src0(it.src[0]);
+                Doublet src1(it.src[1]);
+                target.tag = src0.tag = src1.tag = am.tag;
+
+                auto element = [&](const Doublet & d) -> HRRElement
+                {
+                    return { StringBuilder("HRR_", ArrVarName(brastr, d)), ibra * d.ncart() + d.index() };
+                };
+
+                steps.push_back({ element(target), { element(src0), element(src1) },
+                                  (it.type == RRStepType::K ? " - " : " + "), "hCD",
+                                  static_cast<int>(it.xyz) });
+            }
+        }
+    }
+
+    // Work backwards from the diagonal of the final integrals,
+    // keeping only the steps they depend on
+    const QAM finalam = info_.FinalAM();
+    const int ncart12 = NCART(finalam[0], finalam[1]);
+    const std::string finalname = HRRVarName(finalam);
+
+    std::set<HRRElement> needed;
+    for(int i = 0; i < ncart12; i++)
+        needed.insert({finalname, i * ncart12 + i});
+
+    std::vector<bool> keep(steps.size(), false);
+    size_t nfinal = 0;
+
+    for(size_t i = steps.size(); i-- > 0; )
+    {
+        const HRRElementStep & s = steps[i];
+        if(needed.count(s.target) == 0)
+            continue;
+
+        // Each element is only formed once, so it is not needed
+        // before this step
+        needed.erase(s.target);
+        needed.insert(s.src[0]);
+        needed.insert(s.src[1]);
+        keep[i] = true;
+
+        if(s.target.first == finalname)
+            nfinal++;
+    }
+
+    if(nfinal != static_cast<size_t>(ncart12))
+        throw std::runtime_error("Cannot find the HRR steps for the diagonal integrals");
+
+    auto var = [&](const HRRElement & e) -> std::string
+    {
+        // diagonal elements of the final integrals go to the output
+        if(e.first == finalname)
+            return StringBuilder("diag[abcd * ", ncart12, " + ", e.second / ncart12, "]");
+        else
+            return StringBuilder(e.first, "[", e.second, "]");
+    };
+
+    os << indent4 << "// only the steps needed for the diagonal ("
+       << std::count(keep.begin(), keep.end(), true) << " of " << steps.size() << ")\n";
+
+    for(size_t i = 0; i < steps.size(); i++)
+    {
+        if(!keep[i])
+            continue;
+
+        const HRRElementStep & s = steps[i];
+        os << indent4 << var(s.target) << " = " << var(s.src[0]) << s.sign
+           << "( " << s.h << "[" << s.xyz << "] * " << var(s.src[1]) << " );\n";
+    }
+}
+
+
 void OSTEI_HRR_Writer::WriteHRR_Bra_Inline_(std::ostream & os, QAM am) const
 {
     // ncart_ket in string form
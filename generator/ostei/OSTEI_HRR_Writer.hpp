@@ -39,6 +39,7 @@ class OSTEI_HRR_Writer
         void WriteHRR_Ket_External_(std::ostream & os, QAM am) const;
         void WriteHRR_Bra_General_(std::ostream & os, QAM am) const;
         void WriteHRR_Ket_General_(std::ostream & os, QAM am) const;
+        void WriteHRR_Diagonal_(std::ostream & os) const;
 
         std::string HRRBraStepVar_(const Doublet & d, const std::string & ncart_ket, const std::string & ketstr) const;
         std::string HRRKetStepVar_(const Doublet & d, const std::string & brastr) const;
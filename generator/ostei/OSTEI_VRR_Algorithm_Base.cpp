@@ -6,6 +6,7 @@
 
 #include <iostream>
 #include <algorithm>
+#include <tuple>
 #include "generator/Printing.hpp"
 #include "generator/Ncart.hpp"
 #include "generator/ostei/OSTEI_VRR_Algorithm_Base.hpp"
@@ -121,6 +122,71 @@ int OSTEI_VRR_Algorithm_Base::GetMaxInt(void) const
     return maxint_;
 }
 
+VRR_Cost OSTEI_VRR_Algorithm_Base::GetCost(void) const
+{
+    // Mirrors what is written by OSTEI_VRR_Writer. Each step is
+    // done for all required m values
+    VRR_Cost cost{0, 0, 0};
+
+    for(const auto & am : allam_)
+    {
+        const size_t nm = vrrmreq_max_.at(am)+1;
+        cost.workspace += nm * NCART(am);
+
+        if(vrrmap_.count(am) == 0)
+            continue;
+
+        for(const auto & it : vrrmap_.at(am))
+        {
+            size_t flops = 1; // initial multiplication
+            size_t loads = 1;
+
+            if(it.src[1])
+            {
+                flops += 2;
+                loads += 1;
+            }
+            if(it.src[2] && it.src[3])
+            {
+                flops += 4;
+                loads += 2;
+            }
+            if(it.src[4] && it.src[5])
+            {
+                flops += 4;
+                loads += 2;
+            }
+            if(it.src[6])
+            {
+                flops += 2;
+                loads += 1;
+            }
+            if(it.src[7])
+            {
+                flops += 2;
+                loads += 1;
+            }
+
+            cost.flops += nm * flops;
+            cost.loads += nm * loads;
+        }
+    }
+
+    return cost;
+}
+
+void OSTEI_VRR_Algorithm_Base::Reset_(void)
+{
+    vrrmap_.clear();
+    vrrmreq_max_.clear();
+    amorder_.clear();
+    qamint_2p_.clear();
+    qamint_2q_.clear();
+    qamint_2pq_.clear();
+    maxint_ = 0;
+    allam_.clear();
+}
+
 void OSTEI_VRR_Algorithm_Base::PruneQuartets_(QuartetSet & q) const
 {
     QuartetSet qnew;
@@ -465,7 +531,71 @@ void OSTEI_VRR_Algorithm_Base::Create(const QuartetSet & q)
     std::stable_sort(idx_order.begin(), idx_order.end(),
                      [ & qam_max ] ( int i, int j ) { return qam_max[i] < qam_max[j]; });
 
+    const VRRCostMetric metric = static_cast<VRRCostMetric>(info_.GetOption(Option::VRRCost));
+
+    if(metric == VRRCostMetric::None)
+    {
+        Create_WithOrder(q, idx_order);
+        return;
+    }
+
+
+    // Try all orders of the centers, starting with the default.
+    // Orders that change which centers have VRR steps are skipped, since
+    // the writers only load P_PA or P_PB (and Q_PA or Q_PB), not both
     Create_WithOrder(q, idx_order);
+    const std::array<bool, 4> hasvrr{HasVRR_I(), HasVRR_J(), HasVRR_K(), HasVRR_L()};
+
+    IdxOrder best_order = idx_order;
+    VRR_Cost best_cost = GetCost();
+    VRR_Cost default_cost = best_cost;
+
+    auto Better = [metric] ( const VRR_Cost & a, const VRR_Cost & b )
+    {
+        if(metric == VRRCostMetric::Workspace)
+            return std::make_tuple(a.workspace, a.flops, a.loads) < std::make_tuple(b.workspace, b.flops, b.loads);
+        else
+            return std::make_tuple(a.flops, a.workspace, a.loads) < std::make_tuple(b.flops, b.workspace, b.loads);
+    };
+
+    // Centers with no AM never have steps, so only the relative order
+    // of the remaining centers matters. Don't repeat equivalent orders
+    std::set<std::vector<int>> tried;
+
+    IdxOrder trial{0, 1, 2, 3};
+    do {
+        std::vector<int> effective;
+        for(int i : trial)
+        {
+            if(qam_max[i] > 0)
+                effective.push_back(i);
+        }
+
+        if(!tried.insert(effective).second)
+            continue;
+
+        Reset_();
+        Create_WithOrder(q, trial);
+
+        const std::array<bool, 4> trial_hasvrr{HasVRR_I(), HasVRR_J(), HasVRR_K(), HasVRR_L()};
+        if(trial_hasvrr != hasvrr)
+            continue;
+
+        VRR_Cost cost = GetCost();
+        if(Better(cost, best_cost))
+        {
+            best_cost = cost;
+            best_order = trial;
+        }
+    } while(std::next_permutation(trial.begin(), trial.end()));
+
+    std::cout << "VRR ORDER: " << best_order[0] << " " << best_order[1] << " "
+                               << best_order[2] << " " << best_order[3] << "\n";
+    std::cout << "VRR COST: " << best_cost.flops << " " << best_cost.loads << " " << best_cost.workspace
+              << "  (default: " << default_cost.flops << " " << default_cost.loads << " " << default_cost.workspace << ")\n";
+
+    Reset_();
+    Create_WithOrder(q, best_order);
 }
 
 
@@ -24,6 +24,14 @@ typedef std::map<QAM, StringSet> VRR_VarReqMap;
 // Order we are doing the centers
 typedef std::array<int, 4> IdxOrder;
 
+// Estimated cost of the VRR (per primitive quartet)
+struct VRR_Cost
+{
+    size_t flops;      // floating point operations (FMA counted as 2)
+    size_t loads;      // source integrals read
+    size_t workspace;  // primitive integrals stored (including all m values)
+};
+
 class OSTEI_VRR_Algorithm_Base
 {
     public:
@@ -70,6 +78,8 @@ class OSTEI_VRR_Algorithm_Base
 
         int GetMaxInt(void) const;
 
+        VRR_Cost GetCost(void) const;
+
         virtual ~OSTEI_VRR_Algorithm_Base() = default; 
 
     protected:
@@ -99,6 +109,7 @@ class OSTEI_VRR_Algorithm_Base
 
         QAMSet allam_;
 
+        void Reset_(void);
         void PruneQuartets_(QuartetSet & q) const;
         QuartetSet PruneQuartets_(QuartetSet & q, RRStepType rrstep) const;
         void AMOrder_AddWithDependencies_(QAMList & order, QAM am) const;
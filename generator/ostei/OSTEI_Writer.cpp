@@ -64,10 +64,114 @@ void OSTEI_Writer::WriteShellOffsets(void) const
 }
 
 
+void OSTEI_Writer::WriteCompactLanes(void) const
+{
+    // ket primitive data that is gathered into the dense vectors
+    std::vector<std::string> fields{"alpha", "x", "y", "z", "prefac"};
+
+    if(vrr_writer_.Algo().HasKetVRR())
+    {
+        if(vrr_writer_.Algo().HasVRR_K())
+            fields.insert(fields.end(), {"PA_x", "PA_y", "PA_z"});
+        else
+            fields.insert(fields.end(), {"PB_x", "PB_y", "PB_z"});
+    }
+
+    os_ << indent5 << "// Gather the ket primitives that survive screening into\n";
+    os_ << indent5 << "// dense vectors. shelloffsets are relative to shell (cd + shellbase)\n";
+    for(const auto & f : fields)
+        os_ << indent5 << "double Qc_" << f << "[SIMINT_SIMD_LEN] SIMINT_ALIGN_ARRAY_DBL;\n";
+    os_ << indent5 << "int shelloffsets[SIMINT_SIMD_LEN] = {0};\n";
+    os_ << indent5 << "int shellbase = 0;\n";
+    os_ << indent5 << "int lastoffset = 0;\n";
+    os_ << indent5 << "int nlane = 0;\n";
+    if(info_.ReducedBoys())
+        os_ << indent5 << "double vmax = 0.0;\n";
+    os_ << "\n";
+    os_ << indent5 << "for(; j < jend && nlane < SIMINT_SIMD_LEN; ++j, ++iprimcd)\n";
+    os_ << indent5 << "{\n";
+    os_ << indent6 << "while(iprimcd >= nprim_icd && ((icd+1) < nshellbatch))\n";
+    os_ << indent7 << "nprim_icd += Q.nprim12[cd + (++icd)];\n";
+    os_ << "\n";
+    os_ << indent6 << "if(check_screen)\n";
+    os_ << indent6 << "{\n";
+    os_ << indent7 << "double screen_est = P.screen[i] * Q.screen[j];\n";
+    os_ << indent7 << "if(check_qqr)\n";
+    os_ << indent7 << "{\n";
+    os_ << indent8 << "// distance between the charge distributions (QQR)\n";
+    os_ << indent8 << "const double dx = P.x[i] - Q.x[j];\n";
+    os_ << indent8 << "const double dy = P.y[i] - Q.y[j];\n";
+    os_ << indent8 << "const double dz = P.z[i] - Q.z[j];\n";
+    os_ << indent8 << "const double R = sqrt(dx*dx + dy*dy + dz*dz) - P.extent[i] - Q.extent[j];\n";
+    os_ << indent8 << "if(R > 1.0)\n";
+    os_ << indent9 << "screen_est /= (R*R);\n";
+    os_ << indent7 << "}\n";
+    os_ << "\n";
+    os_ << indent7 << "if(screen_est < batch_screen_tol)\n";
+    os_ << indent7 << "{\n";
+    os_ << indent8 << "skip_nprim++;\n";
+    os_ << indent8 << "continue;\n";
+    os_ << indent7 << "}\n";
+    if(info_.ReducedBoys())
+        os_ << indent7 << "vmax = (screen_est > vmax ? screen_est : vmax);\n";
+    os_ << indent6 << "}\n";
+    os_ << "\n";
+    os_ << indent6 << "if(nlane == 0)\n";
+    os_ << indent7 << "shellbase = icd;\n";
+    os_ << indent6 << "shelloffsets[nlane] = icd - shellbase;\n";
+    for(const auto & f : fields)
+        os_ << indent6 << "Qc_" << f << "[nlane] = Q." << f << "[j];\n";
+    os_ << indent6 << "nlane++;\n";
+    os_ << indent5 << "}\n";
+    os_ << "\n";
+    os_ << indent5 << "// Everything left in this batch was screened out\n";
+    os_ << indent5 << "if(nlane == 0)\n";
+    os_ << indent6 << "break;\n";
+    os_ << "\n";
+    os_ << indent5 << "// Pad the unused lanes. These contribute exactly zero (prefac = 0)\n";
+    os_ << indent5 << "lastoffset = shelloffsets[nlane-1];\n";
+    os_ << indent5 << "for(n = nlane; n < SIMINT_SIMD_LEN; ++n)\n";
+    os_ << indent5 << "{\n";
+    for(const auto & f : fields)
+        os_ << indent6 << "Qc_" << f << "[n] = " << (f == "alpha" ? "1.0" : "0.0") << ";\n";
+    os_ << indent6 << "shelloffsets[n] = lastoffset;\n";
+    os_ << indent5 << "}\n";
+    os_ << "\n";
+    os_ << indent5 << "calc_nvec++;\n";
+    os_ << indent5 << "calc_nprim += nlane;\n\n";
+
+    if(info_.ReducedBoys())
+    {
+        os_ << indent5 << "// Lower accuracy Boys function if its error can't matter for these integrals\n";
+        os_ << indent5 << "const int boys_reduced = check_screen && (vmax * BOYS_REDUCED_SCREENFAC < batch_screen_tol);\n\n";
+    }
+}
+
+
+std::string OSTEI_Writer::KetLoad_(const std::string & field) const
+{
+    if(info_.PrimCompact())
+        return StringBuilder("SIMINT_DBLLOAD(Qc_", field, ", 0)");
+    else
+        return StringBuilder("SIMINT_DBLLOAD(Q.", field, ", j)");
+}
+
+
 void OSTEI_Writer::WriteAccumulation(void) const
 {
     const auto topq = hrr_writer_.Algo().TopAM();
 
+    // with compacted lanes, the pointers are not advanced. Instead, the offsets
+    // are relative to the first shell in the vector
+    const bool compact = info_.PrimCompact();
+    auto dest = [compact](QAM it) -> std::string
+    {
+        if(compact)
+            return StringBuilder(PrimPtrName(it), " + shellbase*", NCART(it));
+        else
+            return PrimPtrName(it);
+    };
+
     os_ << "\n\n";
     os_ << indent5 << "////////////////////////////////////\n";
     os_ << indent5 << "// Accumulate contracted integrals\n";
@@ -79,7 +183,7 @@ void OSTEI_Writer::WriteAccumulation(void) const
     for(const auto it : topq)
     {
         int ncart = NCART(it);
-        os_ << indent6 << "contract_all(" << ncart << ", " << PrimVarName(it) << ", " << PrimPtrName(it) << ");\n";
+        os_ << indent6 << "contract_all(" << ncart << ", " << PrimVarName(it) << ", " << dest(it) << ");\n";
     }
 
     os_ << indent5 << "}\n";
@@ -89,18 +193,29 @@ void OSTEI_Writer::WriteAccumulation(void) const
     for(const auto it : topq)
     {
         int ncart = NCART(it);
-        os_ << indent6 << "contract(" << ncart << ", shelloffsets, " << PrimVarName(it) << ", " << PrimPtrName(it) << ");\n";
+        os_ << indent6 << "contract(" << ncart << ", shelloffsets, " << PrimVarName(it) << ", " << dest(it) << ");\n";
     }
 
-    for(const auto it : topq)
-        os_ << indent6 << PrimPtrName(it) << " += lastoffset*" << NCART(it) << ";\n";
+    if(!compact)
+    {
+        for(const auto it : topq)
+            os_ << indent6 << PrimPtrName(it) << " += lastoffset*" << NCART(it) << ";\n";
+    }
 
     os_ << indent5 << "}\n";
 }
 
 std::string OSTEI_Writer::FunctionName_(QAM am) const
 {
-    return StringBuilder("ostei_",
+    std::string prefix = "ostei_";
+    if(info_.Float32())
+        prefix = "ostei_f32_";
+    else if(info_.FusedJK())
+        prefix = "ostei_jk_";
+    else if(info_.SchwarzDiag())
+        prefix = "ostei_schwarz_";
+
+    return StringBuilder(prefix,
                          amchar[am[0]], "_",
                          amchar[am[1]], "_" ,
                          amchar[am[2]], "_",
@@ -115,10 +230,38 @@ std::string OSTEI_Writer::FunctionPrototype_(QAM am) const
     std::stringstream ss;
     ss << "int " << fname << "(";
     ss << "struct simint_multi_shellpair const P,\n";
+
+    // (ab|ab) for the shell pair in P, so there is no Q (or screening)
+    if(info_.SchwarzDiag())
+    {
+        ss << indent << "double * const restrict work,\n";
+        ss << indent << "double * const restrict diag)";
+        return ss.str();
+    }
+
     ss << indent << "struct simint_multi_shellpair const Q,\n";
     ss << indent << "double screen_tol,\n";
     ss << indent << "double * const restrict work,\n";
-    ss << indent << "double * const restrict " << ArrVarName(am) << ")";
+    if(info_.FusedJK())
+        ss << indent << "struct simint_jk const * const restrict jk)";
+    else
+        ss << indent << "double * const restrict " << ArrVarName(am) << ")";
+    return ss.str();
+}
+
+std::string OSTEI_Writer::JKImplPrototype_(QAM am) const
+{
+    std::string fname = FunctionName_(am) + "_impl";
+    std::string indent(fname.length()+1+11, ' '); // +11 for static int
+
+    std::stringstream ss;
+    ss << "static int " << fname << "(";
+    ss << "struct simint_multi_shellpair const P,\n";
+    ss << indent << "struct simint_multi_shellpair const Q,\n";
+    ss << indent << "double screen_tol,\n";
+    ss << indent << "double * const restrict work,\n";
+    ss << indent << "struct simint_jk const * const restrict jk,\n";
+    ss << indent << "int swap12, int swap34)";
     return ss.str();
 }
 
@@ -184,12 +327,20 @@ void OSTEI_Writer::Write_Permute_(QAM am, bool swap12, bool swap34) const
     }
 
     std::string fname = FunctionName_(am);
-    os_ << indent1 << "int ret = " << fname
-        << "(" << P_var << ", " << Q_var << ", screen_tol, "
-        << "work, " << ArrVarName(permuted) << ");\n";
+
+    // The digestion is told which shells were swapped, so the
+    // integrals themselves never need to be permuted
+    if(info_.FusedJK())
+        os_ << indent1 << "int ret = " << fname << "_impl"
+            << "(" << P_var << ", " << Q_var << ", screen_tol, "
+            << "work, jk, " << (swap12 ? 1 : 0) << ", " << (swap34 ? 1 : 0) << ");\n";
+    else
+        os_ << indent1 << "int ret = " << fname
+            << "(" << P_var << ", " << Q_var << ", screen_tol, "
+            << "work, " << ArrVarName(permuted) << ");\n";
 
 
-    if(!IsSpecialPermutation_(permuted))
+    if(!info_.FusedJK() && !IsSpecialPermutation_(permuted))
     {
         size_t ncart_abcd = NCART(am);
         //size_t ncart_a  = NCART(am[0]);
@@ -253,9 +404,11 @@ void OSTEI_Writer::PartitionWorkspace(void) const
     ////////////////////////////////////////
     // For HRR batched quartets
     ////////////////////////////////////////
+    // (the diagonal integrals are taken from the final integrals
+    // of the batch if they come straight from the VRR)
     for(const auto & it : hrr_writer_.Algo().TopAM())
     {
-        if(!info_.IsFinalAM(it))
+        if(!info_.IsFinalAM(it) || info_.SchwarzDiag())
         {
             os_ << indent1 << "double * const " << ArrVarName(it) << " = work + (SIMINT_NSHELL_SIMD * " << ptidx << ");\n";
             ptidx += NCART(it);
@@ -281,15 +434,15 @@ void OSTEI_Writer::PartitionWorkspace(void) const
     else
     {
         os_ << indent1 << "SIMINT_DBLTYPE * const primwork = (SIMINT_DBLTYPE *)(work + SIMINT_NSHELL_SIMD*" << ptidx << ");\n";
-        ptidx = 0;
+
+        // arrays that are not needed at the same time share space
+        std::map<QAM, size_t> offsets;
+        PackPrimWorkspace(offsets);
 
         for(const auto & am : vrr_writer_.Algo().GetAllAM())
         {
-            // add +1 fromm required m values to account for 0
             os_ << indent1 << "SIMINT_DBLTYPE * const restrict " << PrimVarName(am)
-                << " = primwork + " << ptidx << ";\n";
-
-            ptidx += (vrr_writer_.Algo().GetMReq(am)+1) * NCART(am);
+                << " = primwork + " << offsets.at(am) << ";\n";
         }
     }
 
@@ -305,13 +458,37 @@ void OSTEI_Writer::PartitionWorkspace(void) const
     }
     else
     {
-        os_ << indent1 << "double * const hrrwork = (double *)(primwork + " << ptidx << ");\n";
-        ptidx = 0;
+        // The HRR is done after all primitives have been contracted, so
+        // the HRR intermediates can use the space of the primitive arrays
+        os_ << indent1 << "double * const hrrwork = (double *)primwork;\n";
+
+        std::map<QAM, size_t> offsets;
+        PackHRRWorkspace(offsets, QAMSet());
+
         for(auto am : hrr_writer_.Algo().GetIntermediates())
+            os_ << indent1 << "double * const " << HRRVarName(am) << " = hrrwork + " << offsets.at(am) << ";\n";
+    }
+
+    ////////////////////////////////////////
+    // Final integrals of one batch, which
+    // are digested into J and K
+    ////////////////////////////////////////
+    if(info_.FusedJK())
+    {
+        std::stringstream ss;
+        ss << "SIMINT_NSHELL_SIMD*" << ptidx;
+
+        if(!info_.UseStack())
         {
-            os_ << indent1 << "double * const " << HRRVarName(am) << " = hrrwork + " << ptidx << ";\n";
-            ptidx += NCART(am);
+            std::map<QAM, size_t> primoffsets, contoffsets;
+            size_t prim_nelements = PackPrimWorkspace(primoffsets);
+            size_t cont_nelements = PackHRRWorkspace(contoffsets, QAMSet());
+            ss << " + (SIMINT_SIMD_LEN*" << prim_nelements << " > SIMINT_SIMD_ROUND(" << cont_nelements << ")"
+               << " ? SIMINT_SIMD_LEN*" << prim_nelements << " : SIMINT_SIMD_ROUND(" << cont_nelements << "))";
         }
+
+        const QAM am = info_.FinalAM();
+        os_ << indent1 << "double * const restrict " << ArrVarName(am) << " = work + " << ss.str() << ";\n";
     }
 
     os_ << "\n\n";
@@ -351,30 +528,28 @@ void OSTEI_Writer::Write_Full_(void) const
     for(const auto & it : batchcontq)
         bcont_nelements += NCART(it);
 
-    // these are the non-batched quartets we need
-    QAMSet contam = hrr_writer_.Algo().GetIntermediates();
-
-    // how many elements is that
-    size_t cont_nelements = 0;
-    for(const auto & it : contam)
-        cont_nelements += NCART(it);
-
-    // these are the primitives we need
-    QAMSet primam = vrr_writer_.Algo().GetAllAM();
+    // the non-batched quartets we need (HRR intermediates)
+    // and how many elements is that (after packing)
+    std::map<QAM, size_t> contoffsets;
+    size_t cont_nelements = PackHRRWorkspace(contoffsets, QAMSet());
 
-    // how many elements is that
-    size_t prim_nelements = 0;
-    for(const auto & it : primam)
-        prim_nelements += NCART(it) * (vrr_writer_.Algo().GetMReq(it)+1);
+    // the primitives we need
+    // and how many elements is that (after packing)
+    std::map<QAM, size_t> primoffsets;
+    size_t prim_nelements = PackPrimWorkspace(primoffsets);
 
 
     // add includes
     IncludeSet includes{"<string.h>",
+                        "<float.h>",
                         "<math.h>",
                         "\"simint/ostei/gen/ostei_generated.h\"",
                         "\"simint/vectorization/vectorization.h\"",
                         "\"simint/boys/boys.h\""};
 
+    if(info_.FusedJK())
+        includes.insert("\"simint/ostei/ostei_jk.h\"");
+
     // Constants
     ConstantMap cm;
     cm.emplace("const_1", "1");  // for 1/x
@@ -397,17 +572,34 @@ void OSTEI_Writer::Write_Full_(void) const
     // Write out all the includes
     for(const auto & it : includes)
         os_ << "#include " << it << "\n";
+
+    // This redefines the vector types, so it must come last
+    if(info_.Float32())
+        os_ << "#include \"simint/ostei/ostei_f32.h\"\n";
     os_ << "\n\n";
 
     //////////////////////////////
     // Function name & signature
     //////////////////////////////
-    os_ << FunctionPrototype_(am) << "\n";
+    // With fused J/K digestion, the body also takes the permutation
+    // of the shells, and the public function is a wrapper
+    if(info_.FusedJK())
+        os_ << JKImplPrototype_(am) << "\n";
+    else
+        os_ << FunctionPrototype_(am) << "\n";
     os_ << "{\n";
     os_ << "\n";
 
     os_ << indent1 << "SIMINT_ASSUME_ALIGN_DBL(work);\n";
-    os_ << indent1 << "SIMINT_ASSUME_ALIGN_DBL(" << ArrVarName(am) << ");\n";
+    if(info_.SchwarzDiag())
+    {
+        os_ << "\n";
+        os_ << indent1 << "// (ab|ab), with the shell pair as both bra and ket\n";
+        os_ << indent1 << "struct simint_multi_shellpair const Q = P;\n";
+        os_ << indent1 << "const double screen_tol = 0.0;\n";
+    }
+    else if(!info_.FusedJK())
+        os_ << indent1 << "SIMINT_ASSUME_ALIGN_DBL(" << ArrVarName(am) << ");\n";
 
     ///////////////////////////////////
     // NOW IN THE ACTUAL OSTEI FUNCTION
@@ -415,7 +607,8 @@ void OSTEI_Writer::Write_Full_(void) const
 
     // If there is no HRR, integrals are accumulated from inside the primitive loop
     // directly into the final integral array that was passed into this function, so it must be zeroed first
-    if(!hashrr)
+    // (or the batch buffer, for fused J/K digestion)
+    if(!hashrr && !info_.FusedJK() && !info_.SchwarzDiag())
         os_ << indent1 << "memset(" << ArrVarName(am)
                        << ", 0, P.nshell12_clip * Q.nshell12_clip * "
                        << ncart << " * sizeof(double));\n\n";
@@ -426,20 +619,24 @@ void OSTEI_Writer::Write_Full_(void) const
     os_ << indent1 << "int istart, jstart;\n";
     os_ << indent1 << "int iprimcd, nprim_icd, icd;\n";
     os_ << indent1 << "const int check_screen = (screen_tol > 0.0);\n";
+    os_ << indent1 << "const int check_density = (check_screen && P.density_max != NULL && Q.density_max != NULL);\n";
+    os_ << indent1 << "const int check_qqr = (check_screen && P.extent != NULL && Q.extent != NULL);\n";
     os_ << indent1 << "int i, j;\n";
     os_ << indent1 << "int n;\n";
     os_ << indent1 << "int not_screened;\n";
 
 
     // real_abcd is the absolute actual abcd in terms of all the shells that we are doing
-    // (only needed if we do HRR)
-    if(hashrr)
+    // (only needed if we do HRR into the final integral array)
+    const bool hasrealabcd = (hashrr && !info_.FusedJK() && !info_.SchwarzDiag());
+    if(hasrealabcd)
         os_ << indent1 << "int real_abcd;\n";
 
 
-    if(hasbrahrr)
+    // (the diagonal HRR is written element by element)
+    if(hasbrahrr && !info_.SchwarzDiag())
         os_ << indent1 << "int iket;\n";
-    if(haskethrr)
+    if(haskethrr && !info_.SchwarzDiag())
         os_ << indent1 << "int ibra;\n";
 
     os_ << "\n";
@@ -451,9 +648,8 @@ void OSTEI_Writer::Write_Full_(void) const
         os_ << indent1 << "const SIMINT_DBLTYPE " << it.first << " = SIMINT_DBLSET1(" << it.second << ");\n";
 
     os_ << "\n";
-    os_ << indent1 << "#ifdef SIMINT_PRIM_SCREEN_STAT  // Statistic info for primitive screening \n";
-    os_ << indent1 << "int calc_nprim = 0, skip_nprim = 0, calc_nvec = 0, skip_nvec = 0;\n";
-    os_ << indent1 << "#endif\n";
+    os_ << indent1 << "// Screening statistics (see simint_stats_get)\n";
+    os_ << indent1 << "long calc_nprim = 0, skip_nprim = 0, calc_nvec = 0, skip_nvec = 0, boys_mixed = 0;\n";
     
     os_ << "\n\n";
     os_ << indent1 << "////////////////////////////////////////\n";
@@ -461,7 +657,7 @@ void OSTEI_Writer::Write_Full_(void) const
     os_ << indent1 << "////////////////////////////////////////\n";
     os_ << "\n";
 
-    if(hashrr)
+    if(hasrealabcd)
         os_ << indent1 << "real_abcd = 0;\n";
     else
         os_ << indent1 << "abcd = 0;\n";
@@ -486,34 +682,50 @@ void OSTEI_Writer::Write_Full_(void) const
     os_ << indent4 << "jend += Q.nprim12[cd+i];\n";
     os_ << "\n";
 
+    WriteBatchScreenTol();
 
-    if(hashrr)
+
+    if(hashrr || info_.SchwarzDiag())
     {
         os_ << indent3 << "// Clear the beginning of the workspace (where we are accumulating integrals)\n";
         os_ << indent3 << "memset(work, 0, SIMINT_NSHELL_SIMD * " << bcont_nelements << " * sizeof(double));\n";
         os_ << indent3 << "abcd = 0;\n";
         os_ << "\n";
     }
+    else if(info_.FusedJK())
+    {
+        os_ << indent3 << "// Clear the buffer for this batch (where we are accumulating integrals)\n";
+        os_ << indent3 << "memset(" << ArrVarName(am) << ", 0, nshellbatch * " << ncart << " * sizeof(double));\n";
+        os_ << indent3 << "abcd = 0;\n";
+        os_ << "\n";
+    }
 
     os_ << "\n";
     os_ << indent3 << "for(i = istart; i < iend; ++i)\n";
     os_ << indent3 << "{\n";
-    os_ << indent4 << "SIMINT_DBLTYPE bra_screen_max;  // only used if check_screen\n\n";
+    // compacted lanes are screened individually while gathering
+    if(!info_.PrimCompact())
+    {
+        os_ << indent4 << "SIMINT_DBLTYPE bra_screen_max;  // only used if check_screen\n";
+        os_ << indent4 << "SIMINT_DBLTYPE bra_extent = SIMINT_DBLSET1(0.0);  // only used if check_qqr\n\n";
+    }
 
     os_ << indent4 << "if(check_screen)\n";
     os_ << indent4 << "{\n";
     os_ << indent5 << "// Skip this whole thing if always insignificant\n";
-    os_ << indent5 << "if((P.screen[i] * Q.screen_max) < screen_tol)\n";
+    os_ << indent5 << "if((P.screen[i] * Q.screen_max) < batch_screen_tol)\n";
     os_ << indent5 << "{\n";
-    os_ << indent6 << "#ifdef SIMINT_PRIM_SCREEN_STAT \n";
-    os_ << indent6 << "int j_len = jend - jstart; \n";
-    os_ << indent6 << "skip_nprim += j_len; \n";
-    os_ << indent6 << "skip_nvec  += (j_len + SIMINT_SIMD_LEN - 1) / SIMINT_SIMD_LEN; \n";
-    os_ << indent6 << "#endif \n";
+    os_ << indent6 << "skip_nprim += jend - jstart;\n";
+    os_ << indent6 << "skip_nvec += (jend - jstart + SIMINT_SIMD_LEN - 1) / SIMINT_SIMD_LEN;\n";
     os_ << indent6 << "continue;\n";
     os_ << indent5 << "}\n";
 
-    os_ << indent5 << "bra_screen_max = SIMINT_DBLSET1(P.screen[i]);\n";
+    if(!info_.PrimCompact())
+    {
+        os_ << indent5 << "bra_screen_max = SIMINT_DBLSET1(P.screen[i]);\n";
+        os_ << indent5 << "if(check_qqr)\n";
+        os_ << indent6 << "bra_extent = SIMINT_DBLSET1(P.extent[i]);\n";
+    }
     os_ << indent4 << "}\n\n";
 
     os_ << indent4 << "icd = 0;\n";
@@ -541,37 +753,52 @@ void OSTEI_Writer::Write_Full_(void) const
     os_ << "\n";
 
 
-    os_ << indent4 << "for(j = jstart; j < jend; j += SIMINT_SIMD_LEN)\n";
-    os_ << indent4 << "{\n";
-
-    WriteShellOffsets();
+    if(info_.PrimCompact())
+    {
+        os_ << indent4 << "j = jstart;\n";
+        os_ << indent4 << "while(j < jend)\n";
+        os_ << indent4 << "{\n";
 
+        WriteCompactLanes();
+    }
+    else
+    {
+        os_ << indent4 << "for(j = jstart; j < jend; j += SIMINT_SIMD_LEN)\n";
+        os_ << indent4 << "{\n";
+
+        WriteShellOffsets();
+
+        os_ << indent5 << "// Do we have to compute this vector (or has it been screened out)?\n";
+        os_ << indent5 << "// (not_screened != 0 means we have to do this vector)\n";
+        os_ << indent5 << "// (Q.screen is NULL if the shell pair was created without screening)\n";
+        os_ << indent5 << "int calc_nprim_in_vec = SIMINT_SIMD_LEN;\n";
+        if(info_.ReducedBoys())
+            os_ << indent5 << "int boys_reduced = 0;\n";
+        os_ << indent5 << "if(check_screen)\n";
+        os_ << indent5 << "{\n";
+        WriteVectorScreenEstimate();
+        os_ << indent6 << "if(vmax < batch_screen_tol)\n";
+        os_ << indent6 << "{\n";
+        os_ << indent7 << "skip_nvec++;\n";
+        os_ << indent7 << "skip_nprim += SIMINT_SIMD_LEN;\n";
+        for(const auto it : batchcontq)
+            os_ << indent7 << PrimPtrName(it) << " += lastoffset*" << NCART(it) << ";\n";
+        os_ << indent7 << "continue;\n";
+        os_ << indent6 << "}\n";
+        os_ << indent6 << "calc_nprim_in_vec = count_prim_screen_survival(screen_est, batch_screen_tol);\n";
+        if(info_.ReducedBoys())
+        {
+            os_ << indent6 << "\n";
+            os_ << indent6 << "// Lower accuracy Boys function if its error can't matter for these integrals\n";
+            os_ << indent6 << "boys_reduced = (vmax * BOYS_REDUCED_SCREENFAC < batch_screen_tol);\n";
+        }
+        os_ << indent5 << "}\n";
+        os_ << indent5 << "calc_nvec++;\n";
+        os_ << indent5 << "calc_nprim += calc_nprim_in_vec;\n";
+        os_ << indent5 << "skip_nprim += SIMINT_SIMD_LEN - calc_nprim_in_vec;\n\n";
+    }
 
-    os_ << indent5 << "// Do we have to compute this vector (or has it been screened out)?\n";
-    os_ << indent5 << "// (not_screened != 0 means we have to do this vector)\n";
-    os_ << indent5 << "SIMINT_DBLTYPE prim_screen_res = SIMINT_MUL(bra_screen_max, SIMINT_DBLLOAD(Q.screen, j));\n";
-    os_ << indent5 << "if(check_screen)\n";
-    os_ << indent5 << "{\n";
-    os_ << indent6 << "const double vmax = vector_max(prim_screen_res);\n";
-    os_ << indent6 << "if(vmax < screen_tol)\n";
-    os_ << indent6 << "{\n";
-    os_ << indent7 << "#ifdef SIMINT_PRIM_SCREEN_STAT \n";
-    os_ << indent7 << "skip_nvec++; \n";
-    os_ << indent7 << "skip_nprim += SIMINT_SIMD_LEN; \n";
-    os_ << indent7 << "#endif \n";
-    for(const auto it : batchcontq)
-        os_ << indent7 << PrimPtrName(it) << " += lastoffset*" << NCART(it) << ";\n";
-    os_ << indent7 << "continue;\n";
-    os_ << indent6 << "}\n";
-    os_ << indent5 << "}\n";
-    os_ << indent5 << "#ifdef SIMINT_PRIM_SCREEN_STAT \n";
-    os_ << indent5 << "calc_nvec++; \n";
-    os_ << indent5 << "int calc_nprim_in_vec = count_prim_screen_survival(prim_screen_res, screen_tol); \n";
-    os_ << indent5 << "calc_nprim += calc_nprim_in_vec; \n";
-    os_ << indent5 << "skip_nprim += (SIMINT_SIMD_LEN - calc_nprim_in_vec); \n";
-    os_ << indent5 << "#endif \n\n";
-
-    os_ << indent5 << "const SIMINT_DBLTYPE Q_alpha = SIMINT_DBLLOAD(Q.alpha, j);\n";
+    os_ << indent5 << "const SIMINT_DBLTYPE Q_alpha = " << KetLoad_("alpha") << ";\n";
     os_ << indent5 << "const SIMINT_DBLTYPE PQalpha_mul = SIMINT_MUL(P_alpha, Q_alpha);\n";
     os_ << indent5 << "const SIMINT_DBLTYPE PQalpha_sum = SIMINT_ADD(P_alpha, Q_alpha);\n";
     os_ << indent5 << "const SIMINT_DBLTYPE one_over_PQalpha_sum = SIMINT_DIV(const_1, PQalpha_sum);\n";
@@ -579,9 +806,9 @@ void OSTEI_Writer::Write_Full_(void) const
     os_ << "\n";
     os_ << indent5 << "/* construct R2 = (Px - Qx)**2 + (Py - Qy)**2 + (Pz -Qz)**2 */\n";
     os_ << indent5 << "SIMINT_DBLTYPE PQ[3];\n";
-    os_ << indent5 << "PQ[0] = SIMINT_SUB(Pxyz[0], SIMINT_DBLLOAD(Q.x, j));\n";
-    os_ << indent5 << "PQ[1] = SIMINT_SUB(Pxyz[1], SIMINT_DBLLOAD(Q.y, j));\n";
-    os_ << indent5 << "PQ[2] = SIMINT_SUB(Pxyz[2], SIMINT_DBLLOAD(Q.z, j));\n";
+    os_ << indent5 << "PQ[0] = SIMINT_SUB(Pxyz[0], " << KetLoad_("x") << ");\n";
+    os_ << indent5 << "PQ[1] = SIMINT_SUB(Pxyz[1], " << KetLoad_("y") << ");\n";
+    os_ << indent5 << "PQ[2] = SIMINT_SUB(Pxyz[2], " << KetLoad_("z") << ");\n";
 
 
     os_ << indent5 << "SIMINT_DBLTYPE R2 = SIMINT_MUL(PQ[0], PQ[0]);\n";
@@ -608,9 +835,9 @@ void OSTEI_Writer::Write_Full_(void) const
     if(hasketvrr)
     {
         if(vrr_writer_.Algo().HasVRR_K())
-            os_ << indent5 << "const SIMINT_DBLTYPE Q_PA[3] = { SIMINT_DBLLOAD(Q.PA_x, j), SIMINT_DBLLOAD(Q.PA_y, j), SIMINT_DBLLOAD(Q.PA_z, j) };\n";
+            os_ << indent5 << "const SIMINT_DBLTYPE Q_PA[3] = { " << KetLoad_("PA_x") << ", " << KetLoad_("PA_y") << ", " << KetLoad_("PA_z") << " };\n";
         else
-            os_ << indent5 << "const SIMINT_DBLTYPE Q_PB[3] = { SIMINT_DBLLOAD(Q.PB_x, j), SIMINT_DBLLOAD(Q.PB_y, j), SIMINT_DBLLOAD(Q.PB_z, j) };\n";
+            os_ << indent5 << "const SIMINT_DBLTYPE Q_PB[3] = { " << KetLoad_("PB_x") << ", " << KetLoad_("PB_y") << ", " << KetLoad_("PB_z") << " };\n";
     }
 
     if(hasbravrr)
@@ -649,10 +876,24 @@ void OSTEI_Writer::Write_Full_(void) const
     os_ << "\n";
 
     // we need to zero out any that are beyond the end of the batch (that's been clipped)
-    os_ << indent5 << "const SIMINT_DBLTYPE Q_prefac = mask_load(nlane, Q.prefac + j);\n";
+    // (compacted lanes are already padded with zero)
+    if(info_.PrimCompact())
+        os_ << indent5 << "const SIMINT_DBLTYPE Q_prefac = " << KetLoad_("prefac") << ";\n";
+    else
+        os_ << indent5 << "const SIMINT_DBLTYPE Q_prefac = mask_load(nlane, Q.prefac + j);\n";
     os_ << "\n\n";
-    os_ << indent5 << "boys_F_split(" << PrimVarName({0,0,0,0})
-                   << ", F_x, " << info_.L() << ");\n";
+    if(info_.ReducedBoys())
+    {
+        os_ << indent5 << "if(boys_reduced)\n";
+        os_ << indent6 << "boys_mixed += boys_F_split_reduced(" << PrimVarName({0,0,0,0})
+                       << ", F_x, " << info_.L() << ");\n";
+        os_ << indent5 << "else\n";
+        os_ << indent6 << "boys_mixed += boys_F_split(" << PrimVarName({0,0,0,0})
+                       << ", F_x, " << info_.L() << ");\n";
+    }
+    else
+        os_ << indent5 << "boys_mixed += boys_F_split(" << PrimVarName({0,0,0,0})
+                       << ", F_x, " << info_.L() << ");\n";
 
 
     // prefac = sqrt(1/PQalpha_sum) * P_prefac * Q_prefac
@@ -679,7 +920,7 @@ void OSTEI_Writer::Write_Full_(void) const
     os_ << indent3 << "\n";
     os_ << indent3 << "//Advance to the next batch\n";
     os_ << indent3 << "jstart = SIMINT_SIMD_ROUND(jend);\n";
-    if(!hashrr)
+    if(!hashrr && !info_.FusedJK() && !info_.SchwarzDiag())
         os_ << indent3 << "abcd += nshellbatch;\n";
     os_ << indent3 << "\n";
 
@@ -691,6 +932,25 @@ void OSTEI_Writer::Write_Full_(void) const
         os_ << "\n\n";
     }
 
+    if(info_.SchwarzDiag() && !hashrr)
+    {
+        const int ncart12 = NCART(am[0], am[1]);
+        os_ << indent3 << "// Pick out the diagonal\n";
+        os_ << indent3 << "for(abcd = 0; abcd < nshellbatch; ++abcd)\n";
+        os_ << indent3 << "for(n = 0; n < " << ncart12 << "; ++n)\n";
+        os_ << indent4 << "diag[abcd * " << ncart12 << " + n] = " << ArrVarName(am)
+                       << "[abcd * " << ncart << " + n * " << (ncart12+1) << "];\n";
+        os_ << "\n";
+    }
+
+    if(info_.FusedJK())
+    {
+        os_ << indent3 << "// Contract this batch with the density while it is still in cache\n";
+        os_ << indent3 << "simint_ostei_jk_digest(" << NCART(am[0]) << ", " << NCART(am[1]) << ", "
+                       << NCART(am[2]) << ", " << NCART(am[3]) << ", ab, cd, nshellbatch, swap12, swap34, "
+                       << ArrVarName(am) << ", jk);\n";
+        os_ << "\n";
+    }
 
     os_ << indent2 << "}   // close loop cdbatch\n";
 
@@ -700,21 +960,38 @@ void OSTEI_Writer::Write_Full_(void) const
     os_ << indent1 << "}  // close loop over ab\n";
     os_ << "\n";
     
-    os_ << indent1 << "#ifdef SIMINT_PRIM_SCREEN_STAT \n";
-    os_ << indent1 << "double *eri_res_end_pos = " << ArrVarName(am) << " + " << ncart << " * P.nshell12_clip * Q.nshell12_clip; \n";
-    os_ << indent1 << "eri_res_end_pos[0] = (double) calc_nprim; \n";
-    os_ << indent1 << "eri_res_end_pos[1] = (double) skip_nprim; \n";
-    os_ << indent1 << "eri_res_end_pos[2] = (double) calc_nvec; \n";
-    os_ << indent1 << "eri_res_end_pos[3] = (double) skip_nvec; \n";
-    os_ << indent1 << "#endif \n";
+    // The diagonal integrals are only used for the screening
+    // information itself, so they are not counted
+    if(!info_.SchwarzDiag())
+    {
+        os_ << indent1 << "simint_stats_add_kernel(P.nshell12_clip * Q.nshell12_clip, calc_nprim, skip_nprim,\n";
+        os_ << indent1 << "                        calc_nvec, skip_nvec, boys_mixed);\n";
+        os_ << "\n";
+    }
     
-    os_ << indent1 << "return P.nshell12_clip * Q.nshell12_clip;\n";
+    if(info_.SchwarzDiag())
+        os_ << indent1 << "return P.nshell12_clip;\n";
+    else
+        os_ << indent1 << "return P.nshell12_clip * Q.nshell12_clip;\n";
     os_ << "}\n";
     os_ << "\n";
 
+    if(info_.FusedJK())
+    {
+        os_ << "\n";
+        os_ << FunctionPrototype_(am) << "\n";
+        os_ << "{\n";
+        os_ << indent1 << "return " << FunctionName_(am) << "_impl(P, Q, screen_tol, work, jk, 0, 0);\n";
+        os_ << "}\n";
+        os_ << "\n";
+    }
+
 
     // Write out memory requirement to the log file
     std::cout << "\nWORK SIZE: " << bcont_nelements << "  " << prim_nelements << " " << cont_nelements << "\n";
+    std::cout << "FLOP COUNT: " << PrimitiveFlops(bcont_nelements) << " " << ContractedFlops() << "\n";
+    if(info_.FusedJK())
+        std::cout << "JK WORK SIZE: " << ncart << "\n";
 }
 
 
@@ -748,7 +1025,8 @@ void OSTEI_Writer::WriteFile(void) const
     osh_ << FunctionPrototype_(am) << ";\n\n";
 
     // Write out the code for permuting final integrals, if necessary
-    if(info_.FinalPermute())
+    // (the diagonal integrals are only generated for the unique ordering)
+    if(info_.FinalPermute() && !info_.SchwarzDiag())
         Write_Permutations_();
 }
 
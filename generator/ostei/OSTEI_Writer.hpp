@@ -2,6 +2,7 @@
 
 
 #include <ostream>
+#include <map>
 
 
 class OSTEI_VRR_Writer;
@@ -28,6 +29,22 @@ public:
 
     void DeclarePrimPointers(void) const;
 
+    /*! \brief Write the screening tolerance of a batch of ket shell pairs
+     *
+     * Declares batch_screen_tol, which is screen_tol scaled by the
+     * density bounds of the shell pairs (if they were given)
+     */
+    void WriteBatchScreenTol(void) const;
+
+    /*! \brief Write the screening estimate for a vector of ket primitives
+     *
+     * Declares vmax, the largest estimate of the (squared) integrals of
+     * bra primitive i with the ket primitives starting at j. This is the
+     * Schwarz bound, divided by the square of the distance between the
+     * primitive pairs with SIMINT_SCREEN_QQR.
+     */
+    void WriteVectorScreenEstimate(void) const;
+
     virtual void WriteFile(void) const = 0;
 
 
@@ -37,6 +54,38 @@ protected:
     const OSTEI_GeneratorInfo & info_;
     const OSTEI_VRR_Writer & vrr_writer_;
     const OSTEI_HRR_Writer & hrr_writer_;
+
+    /*! \brief Pack the primitive (VRR) arrays into the workspace
+     *
+     * Arrays whose live ranges do not overlap share space.
+     *
+     * \param [out] offsets Offset of each array (in units of SIMINT_DBLTYPE)
+     * \return Total number of SIMINT_DBLTYPE elements required
+     */
+    size_t PackPrimWorkspace(std::map<QAM, size_t> & offsets) const;
+
+    /*! \brief Floating point operations for each primitive quartet
+     *
+     * Setup, Boys function (estimated), VRR, and accumulation into
+     * the contracted integrals. FMA are counted as 2.
+     *
+     * \param [in] bcont_nelements Number of contracted integrals accumulated
+     */
+    size_t PrimitiveFlops(size_t bcont_nelements) const;
+
+    /*! \brief Floating point operations for each contracted quartet (the HRR)
+     */
+    size_t ContractedFlops(void) const;
+
+    /*! \brief Pack the HRR intermediates into the workspace
+     *
+     * Arrays whose live ranges do not overlap share space.
+     *
+     * \param [out] offsets Offset of each array (in units of double)
+     * \param [in] liveout Intermediates that are still needed after the HRR
+     * \return Total number of double elements required
+     */
+    size_t PackHRRWorkspace(std::map<QAM, size_t> & offsets, const QAMSet & liveout) const;
 };
 
 
@@ -53,10 +102,13 @@ public:
 private:
     void PartitionWorkspace(void) const;
     void WriteShellOffsets(void) const;
+    void WriteCompactLanes(void) const;
     void WriteAccumulation(void) const;
 
     std::string FunctionName_(QAM am) const;
     std::string FunctionPrototype_(QAM am) const;
+    std::string JKImplPrototype_(QAM am) const;
+    std::string KetLoad_(const std::string & field) const;
 
     bool IsSpecialPermutation_(QAM am) const;
     void Write_Full_(void) const;
@@ -79,6 +131,7 @@ private:
     void WriteShellOffsets(void) const;
     void WriteAccumulation(void) const;
     void WriteFormDeriv(void) const;
+    QAMSet DerivInputs_(void) const;
 
     std::string FunctionName_(QAM am) const;
     std::string FunctionPrototype_(QAM am) const;
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <vector>
+
 #include "generator/ostei/OSTEI_GeneratorInfo.hpp"
 #include "generator/ostei/OSTEI_VRR_Writer.hpp"
 #include "generator/ostei/OSTEI_HRR_Writer.hpp"
@@ -6,6 +9,68 @@
 #include "generator/Naming.hpp"
 
 
+namespace {
+
+// Range of steps (inclusive) over which an array is needed,
+// and how big the array is
+struct LiveRange
+{
+    size_t start;
+    size_t end;
+    size_t size;
+};
+
+
+// Assigns offsets so that arrays that are live at the same time
+// do not overlap. Largest arrays are placed first, each at the
+// lowest offset that does not conflict with those already placed.
+size_t PackLiveRanges(const std::map<QAM, LiveRange> & ranges,
+                      std::map<QAM, size_t> & offsets)
+{
+    std::vector<QAM> order;
+    for(const auto & it : ranges)
+        order.push_back(it.first);
+
+    std::stable_sort(order.begin(), order.end(),
+                     [&ranges](const QAM & a, const QAM & b)
+                     { return ranges.at(a).size > ranges.at(b).size; });
+
+    offsets.clear();
+    size_t total = 0;
+
+    for(const auto & am : order)
+    {
+        const LiveRange & r = ranges.at(am);
+
+        // space used by already-placed arrays that are live at the same time
+        std::vector<std::pair<size_t, size_t>> busy;
+        for(const auto & it : offsets)
+        {
+            const LiveRange & r2 = ranges.at(it.first);
+            if(r2.start <= r.end && r.start <= r2.end)
+                busy.push_back({it.second, it.second + r2.size});
+        }
+
+        std::sort(busy.begin(), busy.end());
+
+        size_t offset = 0;
+        for(const auto & b : busy)
+        {
+            if(offset + r.size <= b.first)
+                break;
+            offset = std::max(offset, b.second);
+        }
+
+        offsets[am] = offset;
+        total = std::max(total, offset + r.size);
+    }
+
+    return total;
+}
+
+} // close anonymous namespace
+
+
 ///////////////////////////
 // OSTEI_Writer Base Class //
 ///////////////////////////
@@ -32,3 +97,172 @@ void OSTEI_Writer_Base::DeclarePrimPointers(void) const
 }
 
 
+void OSTEI_Writer_Base::WriteBatchScreenTol(void) const
+{
+    // The screening values bound the square of the integrals, so the
+    // tolerance (already squared) is divided by the square of the density bound
+    os_ << indent3 << "// With density bounds, integrals only need to be computed if they\n";
+    os_ << indent3 << "// times the largest bound of the bra and this batch of kets are significant\n";
+    os_ << indent3 << "double batch_screen_tol = screen_tol;\n";
+    os_ << indent3 << "if(check_density)\n";
+    os_ << indent3 << "{\n";
+    os_ << indent4 << "double dmax = P.density_max[ab];\n";
+    os_ << indent4 << "for(i = 0; i < nshellbatch; i++)\n";
+    os_ << indent5 << "dmax = (Q.density_max[cd+i] > dmax ? Q.density_max[cd+i] : dmax);\n";
+    os_ << indent4 << "batch_screen_tol = (dmax > 0.0 ? screen_tol / (dmax*dmax) : DBL_MAX);\n";
+    os_ << indent3 << "}\n";
+    os_ << "\n";
+}
+
+
+void OSTEI_Writer_Base::WriteVectorScreenEstimate(void) const
+{
+    os_ << indent6 << "SIMINT_DBLTYPE screen_est = SIMINT_MUL(bra_screen_max, SIMINT_DBLLOAD(Q.screen, j));\n";
+    os_ << indent6 << "if(check_qqr)\n";
+    os_ << indent6 << "{\n";
+    os_ << indent7 << "// Far apart charge distributions interact like point charges (QQR).\n";
+    os_ << indent7 << "// R is the distance between them, minus their extents, and at least 1\n";
+    os_ << indent7 << "const SIMINT_DBLTYPE dx = SIMINT_SUB(Pxyz[0], SIMINT_DBLLOAD(Q.x, j));\n";
+    os_ << indent7 << "const SIMINT_DBLTYPE dy = SIMINT_SUB(Pxyz[1], SIMINT_DBLLOAD(Q.y, j));\n";
+    os_ << indent7 << "const SIMINT_DBLTYPE dz = SIMINT_SUB(Pxyz[2], SIMINT_DBLLOAD(Q.z, j));\n";
+    os_ << indent7 << "SIMINT_DBLTYPE R = SIMINT_SQRT(SIMINT_ADD(SIMINT_ADD(SIMINT_MUL(dx, dx), SIMINT_MUL(dy, dy)), SIMINT_MUL(dz, dz)));\n";
+    os_ << indent7 << "R = SIMINT_SUB(SIMINT_SUB(R, bra_extent), SIMINT_DBLLOAD(Q.extent, j));\n";
+    os_ << indent7 << "R = SIMINT_MAX(R, const_1);\n";
+    os_ << indent7 << "screen_est = SIMINT_DIV(screen_est, SIMINT_MUL(R, R));\n";
+    os_ << indent6 << "}\n";
+    os_ << indent6 << "const double vmax = vector_max(screen_est);\n";
+}
+
+
+
+
+size_t OSTEI_Writer_Base::PrimitiveFlops(size_t bcont_nelements) const
+{
+    // Setup of a primitive quartet (exponents, distances, prefactors)
+    // and the constants of the VRR
+    size_t flops = 30 + vrr_writer_.Algo().GetMaxInt();
+
+    // Boys function (boys_F_split), estimated. For small orders, each value
+    // is a Taylor expansion on the grid (about 16 flops). Otherwise only
+    // the highest is, and the others come from the downward recursion
+    // (which also needs an exponential, about 20 flops)
+    const size_t maxm = info_.L() + info_.Deriv();
+    if(maxm < 4)
+        flops += 16 * (maxm+1);
+    else
+        flops += 16 + 20 + 3 * maxm;
+
+    // multiplication of F by the prefactor
+    flops += maxm+1;
+
+    flops += vrr_writer_.Algo().GetCost().flops;
+
+    // accumulation into the contracted integrals
+    flops += bcont_nelements;
+
+    return flops;
+}
+
+
+size_t OSTEI_Writer_Base::ContractedFlops(void) const
+{
+    return hrr_writer_.Algo().GetFlops();
+}
+
+
+size_t OSTEI_Writer_Base::PackPrimWorkspace(std::map<QAM, size_t> & offsets) const
+{
+    const auto & vrr_algo = vrr_writer_.Algo();
+    const QAMList order = vrr_algo.GetAMOrder();
+
+    // Step 0 is the Boys function. Step i+1 forms the i-th
+    // AM in the order, and the last step is the accumulation
+    const size_t laststep = order.size() + 1;
+
+    std::map<QAM, LiveRange> ranges;
+    for(const auto & am : vrr_algo.GetAllAM())
+        ranges[am] = LiveRange{0, 0, static_cast<size_t>((vrr_algo.GetMReq(am)+1) * NCART(am))};
+
+    for(size_t i = 0; i < order.size(); i++)
+    {
+        const QAM & am = order[i];
+        if(am == QAM{0,0,0,0})
+            continue;
+
+        ranges.at(am).start = ranges.at(am).end = i+1;
+    }
+
+    for(size_t i = 0; i < order.size(); i++)
+    {
+        const QAM & am = order[i];
+        if(am == QAM{0,0,0,0})
+            continue;
+
+        for(const auto & src : vrr_algo.GetAMReq(am))
+        {
+            if(ranges.count(src))
+                ranges.at(src).end = std::max(ranges.at(src).end, i+1);
+        }
+    }
+
+    // these are contracted after the VRR
+    for(const auto & it : hrr_writer_.Algo().TopAM())
+    {
+        if(ranges.count(it.notag()))
+            ranges.at(it.notag()).end = laststep;
+    }
+
+    return PackLiveRanges(ranges, offsets);
+}
+
+
+size_t OSTEI_Writer_Base::PackHRRWorkspace(std::map<QAM, size_t> & offsets, const QAMSet & liveout) const
+{
+    const auto & hrr_algo = hrr_writer_.Algo();
+    const QAMList order = hrr_algo.GetAMOrder();
+    const QAMSet intermediates = hrr_algo.GetIntermediates();
+
+    const size_t laststep = order.size();
+
+    std::map<QAM, LiveRange> ranges;
+    for(size_t i = 0; i < order.size(); i++)
+    {
+        if(intermediates.count(order[i]))
+            ranges[order[i]] = LiveRange{i, i, static_cast<size_t>(NCART(order[i]))};
+    }
+
+    for(size_t i = 0; i < order.size(); i++)
+    {
+        const QAM & am = order[i];
+
+        // sources, as passed to the inline, external, and general HRR
+        QAMList req;
+        if(hrr_algo.GetDoubletStep(am) == DoubletType::BRA)
+        {
+            req = hrr_algo.GenerateAMReq(am, hrr_algo.GetBraRRStep({am[0], am[1]}));
+            for(const auto & it : hrr_algo.GetBraAMReq({am[0], am[1]}))
+                req.push_back({it[0], it[1], am[2], am[3], am.tag});
+        }
+        else
+        {
+            req = hrr_algo.GenerateAMReq(am, hrr_algo.GetKetRRStep({am[2], am[3]}));
+            for(const auto & it : hrr_algo.GetKetAMReq({am[2], am[3]}))
+                req.push_back({am[0], am[1], it[0], it[1], am.tag});
+        }
+
+        for(const auto & src : req)
+        {
+            if(ranges.count(src))
+                ranges.at(src).end = std::max(ranges.at(src).end, i);
+        }
+    }
+
+    // Anything not used by a later step is used after the HRR
+    for(auto & it : ranges)
+    {
+        if(it.second.end == it.second.start || liveout.count(it.first))
+            it.second.end = laststep;
+    }
+
+    return PackLiveRanges(ranges, offsets);
+}
@@ -0,0 +1,311 @@
+/*! \file
+ *
+ * \brief HRR algorithm that searches for the path with the fewest steps (source)
+ */
+
+
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+#include "generator/ostei/Optimal_HRR.hpp"
+
+
+namespace {
+
+// Largest number of combinations that are enumerated exhaustively for a level.
+// Above this, a local search is used instead
+const size_t max_enumerate = 1024;
+
+// Number of candidate source sets that are followed from each level
+const size_t beam_width = 3;
+
+// Maximum number of passes of the local search
+const int max_passes = 16;
+
+} // close anonymous namespace
+
+
+DoubletSet Optimal_HRR::Sources_(const DoubletSet & targets, const IdxList & choice,
+                                 RRStepType steptype)
+{
+    DoubletSet sources, pruned;
+
+    size_t i = 0;
+    for(const auto & it : targets)
+    {
+        HRRDoubletStep hrr = MakeStep_(it, steptype, choice[i++]);
+        sources.insert(hrr.src[0]);
+        sources.insert(hrr.src[1]);
+    }
+
+    PruneDoublets_(sources, pruned, steptype);
+    return sources;
+}
+
+
+size_t Optimal_HRR::Search_(const DoubletSet & targets, RRStepType steptype)
+{
+    if(targets.size() == 0)
+        return 0;
+
+    auto key = std::make_pair(steptype, targets);
+    auto memoit = memo_.find(key);
+    if(memoit != memo_.end())
+        return memoit->second.cost;
+
+    const size_t ntargets = targets.size();
+    const std::vector<Doublet> tvec(targets.begin(), targets.end());
+
+    // possible xyz indices for each target, and the Makowski choice
+    std::vector<IdxList> options(ntargets);
+    IdxList makowski(ntargets);
+    size_t ncombo = 1;
+
+    for(size_t i = 0; i < ntargets; i++)
+    {
+        const Gaussian & g = MovingGaussian_(tvec[i], steptype);
+        for(int idx = 0; idx < 3; idx++)
+        {
+            if(g.ijk[idx] > 0)
+                options[i].push_back(idx);
+        }
+
+        makowski[i] = MakowskiIdx_(g);
+
+        if(ncombo <= max_enumerate)
+            ncombo *= options[i].size();
+    }
+
+
+    // Candidate choices. The Makowski choice is always first
+    std::vector<IdxList> candidates{makowski};
+
+    if(ncombo <= max_enumerate)
+    {
+        // Enumerate all combinations
+        std::vector<size_t> pos(ntargets, 0);
+        while(true)
+        {
+            IdxList choice(ntargets);
+            for(size_t i = 0; i < ntargets; i++)
+                choice[i] = options[i][pos[i]];
+            candidates.push_back(choice);
+
+            size_t i = 0;
+            for(; i < ntargets; i++)
+            {
+                if(++pos[i] < options[i].size())
+                    break;
+                pos[i] = 0;
+            }
+
+            if(i == ntargets)
+                break;
+        }
+    }
+    else
+    {
+        // Local search. Start from the Makowski choice and from
+        // choices that favor each of x, y, and z
+        std::vector<IdxList> starts{makowski};
+        for(int pref = 0; pref < 3; pref++)
+        {
+            IdxList choice(makowski);
+            for(size_t i = 0; i < ntargets; i++)
+            {
+                if(std::count(options[i].begin(), options[i].end(), pref))
+                    choice[i] = pref;
+            }
+            starts.push_back(choice);
+        }
+
+        for(auto & choice : starts)
+        {
+            // how many times each (unpruned) source is used
+            std::map<Doublet, int> usage;
+
+            auto step_sources = [&](size_t i, int idx)
+            {
+                HRRDoubletStep hrr = MakeStep_(tvec[i], steptype, idx);
+                std::vector<Doublet> src;
+                for(const auto & s : hrr.src)
+                {
+                    if(MovingGaussian_(s, steptype).am() != 0)
+                        src.push_back(s);
+                }
+                return src;
+            };
+
+            for(size_t i = 0; i < ntargets; i++)
+            {
+                for(const auto & s : step_sources(i, choice[i]))
+                    usage[s]++;
+            }
+
+            bool improved = true;
+            for(int pass = 0; pass < max_passes && improved; pass++)
+            {
+                improved = false;
+
+                for(size_t i = 0; i < ntargets; i++)
+                {
+                    for(const auto & s : step_sources(i, choice[i]))
+                        usage[s]--;
+
+                    // number of sources not already required by other targets
+                    auto nnew = [&](int idx)
+                    {
+                        int n = 0;
+                        for(const auto & s : step_sources(i, idx))
+                        {
+                            auto uit = usage.find(s);
+                            if(uit == usage.end() || uit->second == 0)
+                                n++;
+                        }
+                        return n;
+                    };
+
+                    int best = nnew(choice[i]);
+                    for(int idx : options[i])
+                    {
+                        int n = nnew(idx);
+                        if(n < best)
+                        {
+                            best = n;
+                            choice[i] = idx;
+                            improved = true;
+                        }
+                    }
+
+                    for(const auto & s : step_sources(i, choice[i]))
+                        usage[s]++;
+                }
+            }
+
+            candidates.push_back(choice);
+        }
+    }
+
+
+    // Unique source sets, keeping the first choice that leads to each
+    std::vector<std::pair<DoubletSet, IdxList>> nextsets;
+    for(const auto & choice : candidates)
+    {
+        DoubletSet next = Sources_(targets, choice, steptype);
+        auto same = [&next](const std::pair<DoubletSet, IdxList> & p) { return p.first == next; };
+        if(std::find_if(nextsets.begin(), nextsets.end(), same) == nextsets.end())
+            nextsets.push_back(std::make_pair(next, choice));
+    }
+
+    // Follow the smallest sets, plus the Makowski set (which is first)
+    std::stable_sort(nextsets.begin() + 1, nextsets.end(),
+                     [](const std::pair<DoubletSet, IdxList> & a, const std::pair<DoubletSet, IdxList> & b)
+                     { return a.first.size() < b.first.size(); });
+
+    if(nextsets.size() > beam_width + 1)
+        nextsets.resize(beam_width + 1);
+
+    PlanNode node{0, IdxList(), DoubletSet()};
+    bool found = false;
+
+    for(const auto & it : nextsets)
+    {
+        size_t cost = ntargets + Search_(it.first, steptype);
+        if(!found || cost < node.cost)
+        {
+            node = PlanNode{cost, it.second, it.first};
+            found = true;
+        }
+    }
+
+    memo_[key] = node;
+    return node.cost;
+}
+
+
+void Optimal_HRR::PlanDoubletSteps_(const DoubletSet & targets, RRStepType steptype)
+{
+    if(targets.size() == 0)
+        return;
+
+    // The search assumes that all sources at one level are
+    // generated from targets at the same level. If that is
+    // not the case, use the Makowski choices instead
+    int am = MovingGaussian_(*targets.begin(), steptype).am();
+    for(const auto & it : targets)
+    {
+        if(MovingGaussian_(it, steptype).am() != am)
+            return;
+    }
+
+    size_t cost = Search_(targets, steptype);
+
+    // Walk the chosen path and store the choices
+    DoubletSet cur = targets;
+    while(cur.size())
+    {
+        const PlanNode & node = memo_.at(std::make_pair(steptype, cur));
+
+        size_t i = 0;
+        for(const auto & it : cur)
+            plan_[it] = node.choice[i++];
+
+        cur = node.next;
+    }
+
+    std::cout << "OPTIMAL HRR " << RRStepTypeToStr(steptype) << ": " << cost << " steps\n";
+}
+
+
+size_t Optimal_HRR::PlannedSteps_(const std::set<QAM> & am, DoubletType type, RRStepType steptype)
+{
+    DoubletSet targets, pruned;
+
+    for(auto & iam : am)
+    {
+        DAM dam = (type == DoubletType::BRA ? DAM{iam[0], iam[1]} : DAM{iam[2], iam[3]});
+        auto add_targets = GenerateDoubletTargets(dam, type);
+        targets.insert(add_targets.begin(), add_targets.end());
+    }
+
+    PruneDoublets_(targets, pruned, steptype);
+    return Search_(targets, steptype);
+}
+
+
+void Optimal_HRR::ChooseSteps_(const std::set<QAM> & am,
+                               RRStepType & brasteptype,
+                               RRStepType & ketsteptype)
+{
+    OSTEI_HRR_Algorithm_Base::ChooseSteps_(am, brasteptype, ketsteptype);
+
+    // Only switch directions when the search is valid for
+    // both (see PlanDoubletSteps_)
+    if(am.size() != 1)
+        return;
+
+    // Bra and ket are independent. Only change from the
+    // default if the other direction is strictly better
+    RRStepType otherbra = (brasteptype == RRStepType::J ? RRStepType::I : RRStepType::J);
+    if(PlannedSteps_(am, DoubletType::BRA, otherbra) < PlannedSteps_(am, DoubletType::BRA, brasteptype))
+        brasteptype = otherbra;
+
+    RRStepType otherket = (ketsteptype == RRStepType::L ? RRStepType::K : RRStepType::L);
+    if(PlannedSteps_(am, DoubletType::KET, otherket) < PlannedSteps_(am, DoubletType::KET, ketsteptype))
+        ketsteptype = otherket;
+}
+
+
+HRRDoubletStep Optimal_HRR::DoubletStep_(const Doublet & target, RRStepType steptype)
+{
+    if(target.am() == 0)
+        throw std::runtime_error("Cannot HRR step to an s doublet!");
+
+    auto it = plan_.find(target);
+    if(it != plan_.end())
+        return MakeStep_(target, steptype, it->second);
+    else
+        return MakeStep_(target, steptype, MakowskiIdx_(MovingGaussian_(target, steptype)));
+}
+
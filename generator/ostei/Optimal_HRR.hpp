@@ -0,0 +1,71 @@
+/*! \file
+ *
+ * \brief HRR algorithm that searches for the path with the fewest steps (header)
+ */
+
+
+#pragma once
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "generator/ostei/OSTEI_HRR_Algorithm_Base.hpp"
+
+
+/*! \brief HRR algorithm that chooses the xyz index of each step globally
+ *
+ * Makowski chooses the index of each step from the target alone. Here, all
+ * targets of a given AM on the moving center are considered at once, and
+ * the indices are chosen so that the total number of steps (down to the s
+ * function on the moving center) is minimized. This is a dynamic program
+ * over the sets of doublets at each level. Candidate source sets at each level
+ * are found by exhaustive enumeration (small sets) or by a local search
+ * (large sets) and a small beam of them is searched further.
+ *
+ * The Makowski choice is always one of the candidates, so the result
+ * is never worse than Makowski.
+ *
+ * The direction (I vs. J and K vs. L) is also chosen by the number of steps.
+ */
+class Optimal_HRR : public OSTEI_HRR_Algorithm_Base
+{
+    public:
+        Optimal_HRR(const OSTEI_GeneratorInfo & info)
+            : OSTEI_HRR_Algorithm_Base(info)
+        { }
+
+
+    private:
+        typedef std::vector<int> IdxList;
+
+        /*! \brief Result of searching from a set of doublets */
+        struct PlanNode
+        {
+            size_t cost;            //!< Total steps from this set downwards
+            IdxList choice;         //!< Chosen xyz index for each doublet in the set
+            DoubletSet next;        //!< Set of source doublets (after pruning)
+        };
+
+        //! Chosen xyz index for each doublet to be stepped
+        std::map<Doublet, int> plan_;
+
+        //! Memoized results of the search, by set of doublets
+        std::map<std::pair<RRStepType, DoubletSet>, PlanNode> memo_;
+
+        virtual void ChooseSteps_(const std::set<QAM> & am,
+                                  RRStepType & brasteptype,
+                                  RRStepType & ketsteptype);
+
+        virtual void PlanDoubletSteps_(const DoubletSet & targets, RRStepType steptype);
+
+        virtual HRRDoubletStep DoubletStep_(const Doublet & target, RRStepType steptype);
+
+        size_t Search_(const DoubletSet & targets, RRStepType steptype);
+
+        size_t PlannedSteps_(const std::set<QAM> & am, DoubletType type, RRStepType steptype);
+
+        static DoubletSet Sources_(const DoubletSet & targets, const IdxList & choice,
+                                   RRStepType steptype);
+};
+
@@ -59,6 +59,9 @@ int main(int argc, char ** argv)
     CMDLINE_ASSERT( fpath != "", "output source file path (-o) required" )
     CMDLINE_ASSERT( hpath != "", "output header file path (-oh) required" )
     CMDLINE_ASSERT( finalamset == true, "AM quartet (-q) required" )
+    CMDLINE_ASSERT( options[Option::Float32] == 0, "Single precision (-f32) is not available for derivatives" )
+    CMDLINE_ASSERT( options[Option::FusedJK] == 0, "Fused J/K digestion (-jk) is not available for derivatives" )
+    CMDLINE_ASSERT( options[Option::SchwarzDiag] == 0, "Diagonal integrals (-schwarz) are not available for derivatives" )
 
 
     // open the output file
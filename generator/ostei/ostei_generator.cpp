@@ -1,5 +1,7 @@
 #include <stdexcept>
 #include <fstream>
+#include <memory>
+#include <limits>
 
 #include "generator/CommandLine.hpp"
 #include "generator/StringBuilder.hpp"
@@ -59,6 +61,12 @@ int main(int argc, char ** argv)
     CMDLINE_ASSERT( fpath != "", "output source file path (-o) required" )
     CMDLINE_ASSERT( hpath != "", "output header file path (-oh) required" )
     CMDLINE_ASSERT( finalamset == true, "AM quartet (-q) required" )
+    CMDLINE_ASSERT( options[Option::Float32] == 0 || options[Option::FusedJK] == 0,
+                    "Single precision (-f32) and fused J/K digestion (-jk) are exclusive" )
+    CMDLINE_ASSERT( options[Option::SchwarzDiag] == 0 || (options[Option::Float32] == 0 && options[Option::FusedJK] == 0),
+                    "Diagonal integrals (-schwarz) cannot be combined with -f32 or -jk" )
+    CMDLINE_ASSERT( options[Option::SchwarzDiag] == 0 || (finalam[0] == finalam[2] && finalam[1] == finalam[3]),
+                    "Diagonal integrals (-schwarz) require a quartet of the form ( a b | a b )" )
 
 
     // open the output file
@@ -85,23 +93,49 @@ int main(int argc, char ** argv)
     //////////////////////////////////////////////////////////////
     
     // algorithms used
-    Makowski_HRR hrralgo(info);
+    std::unique_ptr<OSTEI_HRR_Algorithm_Base> hrralgo;
+    if(options[Option::OptimalHRR])
+        hrralgo.reset(new Optimal_HRR(info));
+    else
+        hrralgo.reset(new Makowski_HRR(info));
+
     Makowski_VRR vrralgo(info);
 
+    // The external and general HRR functions are shared between
+    // quartets and follow the Makowski path, so the HRR is
+    // always written inline when the path is optimized
+    int hrr_external = options[Option::ExternalHRR];
+    int hrr_general = options[Option::GeneralHRR];
+    if(options[Option::OptimalHRR])
+        hrr_external = hrr_general = std::numeric_limits<int>::max();
+
+    // Only the diagonal is formed, element by element, so the
+    // HRR is always written inline
+    if(options[Option::SchwarzDiag])
+        hrr_external = hrr_general = std::numeric_limits<int>::max();
+
     // Working backwards, I need:
     // 1.) HRR Steps
-    hrralgo.Create(finalam);
-    OSTEI_HRR_Writer hrr_writer(hrralgo, info,
-                                options[Option::ExternalHRR],
-                                options[Option::GeneralHRR]);
+    hrralgo->Create(finalam);
+    OSTEI_HRR_Writer hrr_writer(*hrralgo, info,
+                                hrr_external,
+                                hrr_general);
 
-    QuartetSet topquartets = hrralgo.TopQuartets();
+    QuartetSet topquartets = hrralgo->TopQuartets();
 
     // 2.) VRR Steps
     vrralgo.Create(topquartets);
+    // The external and general VRR functions take double
+    // precision vectors, so the VRR is always written inline
+    // for single precision
+    int vrr_external = options[Option::ExternalVRR];
+    int vrr_general = options[Option::GeneralVRR];
+    if(options[Option::Float32])
+        vrr_external = vrr_general = std::numeric_limits<int>::max();
+
     OSTEI_VRR_Writer vrr_writer(vrralgo, info,
-                                options[Option::ExternalVRR],
-                                options[Option::GeneralVRR]);
+                                vrr_external,
+                                vrr_general);
 
 
     // Create the OSTEI_Writer and write the file
@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+
+#######################################
+# Generates piecewise polynomial fits
+# of the boys function (an alternative
+# to the Taylor series grid)
+#
+# [0, max-x) is split into segments of equal
+# width. On each segment, Fn(x) is expanded in
+# Chebyshev polynomials, truncated to the lowest
+# order that meets the accuracy target for all
+# segments and all n, and converted to a plain
+# polynomial in t = (x - middle)/(half width),
+# so it can be evaluated by Horner's rule (only FMAs)
+#######################################
+
+import argparse
+import sys
+from boys_common.boys import *
+from mpmath import mp # arbitrary-precision math
+
+# Note that types are being stored as a string. This is so mpmath
+# can parse it without turning it into a (possibly) lesser-precision float
+parser = argparse.ArgumentParser()
+parser.add_argument("--filename",  type=str, required=True,                help="Output file name base (no extension)")
+parser.add_argument("--max-n",     type=int, required=True,                help="Maximum n value to go to")
+parser.add_argument("--max-x",     type=str, required=True,                help="Cutoff for the x value")
+parser.add_argument("--width",     type=str, required=True,                help="Width of each segment")
+parser.add_argument("--tol",       type=str, required=False, default="1e-14", help="Maximum relative error of the fits")
+parser.add_argument("--fit-order", type=int, required=False, default=30,   help="Order of the Chebyshev expansion before truncation")
+parser.add_argument("--dps",       type=int, required=False, default=64,   help="Decimal precision/sig figs to use/calculate")
+args = parser.parse_args()
+
+# Set the dps option
+mp.dps = args.dps
+
+# Convert stuff to mpmath
+maxn = args.max_n
+maxx = mp.mpf(args.max_x)
+width = mp.mpf(args.width)
+tol = mp.mpf(args.tol)
+fitorder = args.fit_order
+nseg = int(mp.ceil(maxx / width))
+hw = width / 2
+
+
+# All Fn(x) for n <= maxn. Only the highest via the
+# incomplete gamma function, then recursion down
+def BoysAll(x):
+    F = [None] * (maxn+1)
+    F[maxn] = BoysValue(maxn, x)[maxn] if x == 0 else \
+              mp.gammainc(maxn+mp.mpf("0.5"), 0, x) / (2 * mp.power(x, maxn+mp.mpf("0.5")))
+    ex = mp.exp(-x)
+    for n in range(maxn-1, -1, -1):
+        F[n] = (2*x*F[n+1] + ex) / (2*n+1)
+    return F
+
+
+# Chebyshev expansion of all n on each segment
+# cheb[seg][n][k]
+nnode = fitorder + 1
+cheb = []
+fmin = []   # smallest value of each n on each segment (at the right end)
+for s in range(nseg):
+    mid = width*s + hw
+    nodes = [ mp.cos(mp.pi * (j + mp.mpf("0.5")) / nnode) for j in range(nnode) ]
+    vals = [ BoysAll(mid + hw*y) for y in nodes ]
+
+    segcheb = []
+    for n in range(maxn+1):
+        c = []
+        for k in range(nnode):
+            ck = mp.fsum(vals[j][n] * mp.cos(mp.pi * k * (j + mp.mpf("0.5")) / nnode) for j in range(nnode))
+            c.append(ck * 2 / nnode)
+        c[0] /= 2
+        segcheb.append(c)
+
+    cheb.append(segcheb)
+    fmin.append(BoysAll(width*(s+1)))
+
+
+# Lowest order where the neglected terms are below the tolerance everywhere
+order = None
+for m in range(1, fitorder):
+    ok = True
+    for s in range(nseg):
+        for n in range(maxn+1):
+            tail = mp.fsum(abs(cheb[s][n][k]) for k in range(m+1, nnode))
+            if tail > tol * fmin[s][n]:
+                ok = False
+                break
+        if not ok:
+            break
+    if ok:
+        order = m
+        break
+
+if order is None:
+    print("Tolerance can't be met with a fit order of {}".format(fitorder))
+    quit(1)
+
+
+# Chebyshev polynomials as plain polynomials in t
+T = [ [mp.mpf(1)], [mp.mpf(0), mp.mpf(1)] ]
+for k in range(2, order+1):
+    t = [mp.mpf(0)] * (k+1)
+    for i,v in enumerate(T[k-1]):
+        t[i+1] += 2*v
+    for i,v in enumerate(T[k-2]):
+        t[i] -= v
+    T.append(t)
+
+# poly[n][seg][k] - coefficient of t**k
+poly = [ [ [mp.mpf(0)] * (order+1) for s in range(nseg) ] for n in range(maxn+1) ]
+for s in range(nseg):
+    for n in range(maxn+1):
+        for k in range(order+1):
+            for i,v in enumerate(T[k]):
+                poly[n][s][i] += cheb[s][n][k] * v
+
+
+# Check (with the coefficients rounded to double precision)
+maxerr = mp.mpf(0)
+ncheck = 16
+for s in range(nseg):
+    mid = width*s + hw
+    for j in range(ncheck+1):
+        t = mp.mpf(-1) + mp.mpf(2*j)/ncheck
+        ref = BoysAll(mid + hw*t)
+        for n in range(maxn+1):
+            p = mp.mpf(0)
+            for k in range(order, -1, -1):
+                p = p*t + mp.mpf(float(poly[n][s][k]))
+            maxerr = max(maxerr, abs(p - ref[n]) / ref[n])
+
+
+# Output to file
+with open(args.filename + ".c", 'w') as f:
+  f.write("/*\n")
+  f.write(" Generated with:\n")
+  f.write("   " + " ".join(sys.argv[:]))
+  f.write("\n")
+  f.write("------------------------------------\n")
+  f.write("Options for Boys function Fn(x):\n")
+  f.write("      Max n: {}\n".format(maxn))
+  f.write("      Max x: {}\n".format(maxx))
+  f.write("      Width: {}\n".format(width))
+  f.write("   Segments: {}\n".format(nseg))
+  f.write("  Tolerance: {}\n".format(mp.nstr(tol, 4)))
+  f.write("      Order: {}\n".format(order))
+  f.write("  Max error: {} (relative)\n".format(mp.nstr(maxerr, 4)))
+  f.write("        DPS: {}\n".format(args.dps))
+  f.write("------------------------------------\n")
+  f.write("*/\n\n")
+
+  f.write("const double boys_cheby[{}][{}][{}] = \n".format(maxn+1, nseg, order+1))
+  f.write("{\n")
+
+  for n in range(maxn+1):
+    f.write("/* n = {} */\n".format(n))
+    f.write("{\n")
+    for s in range(nseg):
+      f.write("/* x = {:12}*/  {{".format(mp.nstr(width*s, 4)))
+      for v in poly[n][s]:
+        f.write("{:32}, ".format(mp.nstr(v, 18)))
+      f.write("},\n")
+    f.write("},\n")
+  f.write("};\n")
+
+with open(args.filename + ".h", 'w') as f:
+  f.write("#pragma once\n")
+  f.write("\n")
+  f.write("#define BOYS_CHEBY_MAXN {}\n".format(maxn))
+  f.write("#define BOYS_CHEBY_MAXX {}\n".format(maxx))
+  f.write("#define BOYS_CHEBY_WIDTH {}\n".format(width))
+  f.write("#define BOYS_CHEBY_NSEG {}\n".format(nseg))
+  f.write("#define BOYS_CHEBY_ORDER {}\n".format(order))
+  f.write("#define BOYS_CHEBY_LOOKUPFAC {}\n".format(1/width))
+  f.write("#define BOYS_CHEBY_MAXERR {}\n".format(mp.nstr(maxerr, 4)))
+  f.write("\n")
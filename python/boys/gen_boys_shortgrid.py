@@ -3,6 +3,19 @@
 #######################################
 # Generates grid for the
 # boys function to arbitrary precision
+#
+# --layout row (the default) stores all n
+# for each point (boys_shortgrid). --layout
+# blocked stores, for every k-th order m only,
+# the 8 Taylor coefficients of F[m] at each
+# point (already divided by j!) in one
+# 64-byte block. Only F[m] is computed
+# from the table and lower orders are recurred
+# down, so a given n only touches one block per
+# point (boys_shortgrid_blocked). --layout single
+# is the row layout in single precision, for the
+# single precision kernels (boys_shortgrid_f32,
+# which uses the constants of boys_shortgrid.h)
 #######################################
 
 import argparse
@@ -18,6 +31,9 @@ parser.add_argument("--max-n",    type=int, required=True,               help="M
 parser.add_argument("--max-x",    type=str, required=True,               help="Cutoff for the x value")
 parser.add_argument("--spacing",  type=str, required=True,               help="Space between pre-computed points")
 parser.add_argument("--dps",      type=int, required=False, default=256, help="Decimal precision/sig figs to use/calculate")
+parser.add_argument("--layout",   type=str, required=False, default="row", choices=["row", "blocked", "single"],
+                                                                         help="Layout of the table")
+parser.add_argument("--block-k",  type=int, required=False, default=4,   help="Store every k-th order (blocked layout)")
 args = parser.parse_args()
 
 # Set the dps option
@@ -40,8 +56,15 @@ while x < maxx:
   pts.append(x)
   x += inc
 
-# Output to file
-with open(args.filename + ".c", 'w') as f:
+# Number of terms of the Taylor series
+nterm = 8
+
+# Orders stored in the blocked layout
+blockk = args.block_k
+blockn = list(range(0, maxn-nterm+2, blockk))
+
+
+def WriteHeaderComment(f):
   f.write("/*\n")
   f.write(" Generated with:\n")
   f.write("   " + " ".join(sys.argv[:]))
@@ -53,9 +76,69 @@ with open(args.filename + ".c", 'w') as f:
   f.write("  Spacing: {}\n".format(inc))
   f.write("  npoints: {}\n".format(npoints))
   f.write("      DPS: {}\n".format(args.dps))
+  if args.layout == "blocked":
+    f.write("  Every k: {}\n".format(blockk))
   f.write("------------------------------------\n")
   f.write("*/\n\n")
 
+
+if args.layout == "blocked":
+  with open(args.filename + ".c", 'w') as f:
+    WriteHeaderComment(f)
+
+    f.write("#include \"simint/vectorization/vectorization.h\"\n\n")
+    f.write("const double boys_shortgrid_blocked[{}][{}][{}] SIMINT_ALIGN_ARRAY_DBL = \n".format(len(blockn), npoints, nterm))
+    f.write("{\n")
+
+    for m in blockn:
+      f.write("/* n = {} */\n".format(m))
+      f.write("{\n")
+      for p,x in zip(F,pts):
+        f.write("/* x = {:12}*/  {{".format(mp.nstr(x, 4)))
+        for j in range(nterm):
+          f.write("{:32}, ".format(mp.nstr(p[m+j] / mp.factorial(j), 18)))
+        f.write("},\n")
+      f.write("},\n")
+    f.write("};\n")
+
+  with open(args.filename + ".h", 'w') as f:
+    f.write("#pragma once\n")
+    f.write("\n")
+    f.write("#define BOYS_BLOCKED_K {}\n".format(blockk))
+    f.write("#define BOYS_BLOCKED_NBLOCK {}\n".format(len(blockn)))
+    f.write("#define BOYS_BLOCKED_MAXN {}\n".format(blockn[-1]))
+    f.write("#define BOYS_BLOCKED_NTERM {}\n".format(nterm))
+    f.write("#define BOYS_BLOCKED_MAXX {}\n".format(maxx))
+    f.write("#define BOYS_BLOCKED_SPACE {}\n".format(inc))
+    f.write("#define BOYS_BLOCKED_NPOINT {}\n".format(npoints))
+    f.write("#define BOYS_BLOCKED_LOOKUPFAC {}\n".format(1.0/inc))
+    f.write("#define BOYS_BLOCKED_LOOKUPFAC2 {}\n".format(0.5*inc))
+    f.write("\n")
+
+  quit()
+
+
+if args.layout == "single":
+  with open(args.filename + ".c", 'w') as f:
+    WriteHeaderComment(f)
+
+    f.write("const float boys_shortgrid_f32[{}][{}] = \n".format(npoints, maxn+1))
+    f.write("{\n")
+
+    for p,x in zip(F,pts):
+      f.write("/* x = {:12}*/  {{".format(mp.nstr(x, 4)))
+      for n in p:
+        f.write("{:18}, ".format(mp.nstr(n, 9) + "f"))
+      f.write("},\n")
+    f.write("};\n")
+
+  quit()
+
+
+# Output to file
+with open(args.filename + ".c", 'w') as f:
+  WriteHeaderComment(f)
+
   f.write("const double boys_shortgrid[{}][{}] = \n".format(npoints, maxn+1))
   f.write("{\n")
 
@@ -31,6 +31,9 @@ amchar = "spdfghijklmnoqrtuvwxyzabceSPDFGHIJKLMNOQRTUVWXYZABCE0123456789"
 parser = argparse.ArgumentParser()
 parser.add_argument("-l", type=int, required=True, help="Maximum AM")
 parser.add_argument("-d", type=int, default=0, help="Derivative level")
+parser.add_argument("-f32", action='store_true', help="Fill the single precision kernels")
+parser.add_argument("-jk", action='store_true', help="Fill the fused J/K kernels")
+parser.add_argument("-schwarz", action='store_true', help="Fill the diagonal (Schwarz) kernels")
 parser.add_argument("outfile", type=str, help="Output file")
 
 args = parser.parse_args()
@@ -38,6 +41,21 @@ args = parser.parse_args()
 
 maxam = args.l
 der = args.d
+f32 = args.f32
+jk = args.jk
+schwarz = args.schwarz
+
+if f32 and der > 0:
+  print("Single precision kernels are not available for derivatives")
+  quit(1)
+
+if jk and (der > 0 or f32):
+  print("Fused J/K kernels are not available for derivatives or single precision")
+  quit(1)
+
+if schwarz and (der > 0 or f32 or jk):
+  print("Diagonal (Schwarz) kernels are only available on their own")
+  quit(1)
 
 print("-------------------------------")
 print("Generating Array Filling")
@@ -55,6 +73,8 @@ for i in range(0, maxam + 1):
       for l in range(0, maxam + 1):
         q = (i,j,k,l)
         maxL = max(q)
+        if schwarz and not (i == k and j == l and i >= j):
+          continue
         valid[maxL].add(q)
 
 # Start the source file
@@ -77,13 +97,26 @@ with open(sourcefile, 'w') as f:
 
   f.write("// Stores pointers to the ostei functions\n")
   f.write("#define AMSIZE   SIMINT_OSTEI_MAXAM+1\n")
-  f.write("#define DERSIZE  SIMINT_OSTEI_MAXDER+1\n")
-  f.write("extern simint_osteifunc simint_osteifunc_array[DERSIZE][AMSIZE][AMSIZE][AMSIZE][AMSIZE];\n")
+  if f32:
+    f.write("extern simint_osteifunc simint_osteifunc_f32_array[AMSIZE][AMSIZE][AMSIZE][AMSIZE];\n")
+  elif jk:
+    f.write("extern simint_osteifunc_jk simint_osteifunc_jk_array[AMSIZE][AMSIZE][AMSIZE][AMSIZE];\n")
+  elif schwarz:
+    f.write("extern simint_osteifunc_schwarz simint_osteifunc_schwarz_array[AMSIZE][AMSIZE];\n")
+  else:
+    f.write("#define DERSIZE  SIMINT_OSTEI_MAXDER+1\n")
+    f.write("extern simint_osteifunc simint_osteifunc_array[DERSIZE][AMSIZE][AMSIZE][AMSIZE][AMSIZE];\n")
   f.write("\n\n\n")
 
   # write the finalize functions
   if der > 0:
     f.write("void simint_ostei_deriv{}_finalize(void)\n".format(der))
+  elif f32:
+    f.write("void simint_ostei_f32_finalize(void)\n")
+  elif jk:
+    f.write("void simint_ostei_jk_finalize(void)\n")
+  elif schwarz:
+    f.write("void simint_ostei_schwarz_finalize(void)\n")
   else:
     f.write("void simint_ostei_finalize(void)\n")
   f.write("{\n")
@@ -93,10 +126,22 @@ with open(sourcefile, 'w') as f:
   # Now write the filling function
   if der > 0:
     f.write("void simint_ostei_deriv{}_init(void)\n".format(der))
+  elif f32:
+    f.write("void simint_ostei_f32_init(void)\n")
+  elif jk:
+    f.write("void simint_ostei_jk_init(void)\n")
+  elif schwarz:
+    f.write("void simint_ostei_schwarz_init(void)\n")
   else:
     f.write("void simint_ostei_init(void)\n")
   f.write("{\n")
 
+  # the single precision and J/K kernels are only generated on request
+  if f32:
+    f.write("    #if SIMINT_OSTEI_F32\n\n")
+  elif jk:
+    f.write("    #if SIMINT_OSTEI_JK\n\n")
+
   for L,qset in valid.items():
     if der > 0:
       f.write("    #if SIMINT_OSTEI_DERIV{}_MAXAM >= {}\n".format(der, L))
@@ -106,11 +151,29 @@ with open(sourcefile, 'w') as f:
     for q in sorted(list(qset)):
       if der > 0:
         fname = "ostei_deriv{}_{}_{}_{}_{}".format(der, amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
+      elif f32:
+        fname = "ostei_f32_{}_{}_{}_{}".format(amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
+      elif jk:
+        fname = "ostei_jk_{}_{}_{}_{}".format(amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
+      elif schwarz:
+        fname = "ostei_schwarz_{}_{}_{}_{}".format(amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
       else:
         fname = "ostei_{}_{}_{}_{}".format(amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
   
-      f.write("    simint_osteifunc_array[{}][{}][{}][{}][{}] = {};\n".format(der, q[0], q[1], q[2], q[3], fname))
+      if f32:
+        f.write("    simint_osteifunc_f32_array[{}][{}][{}][{}] = {};\n".format(q[0], q[1], q[2], q[3], fname))
+      elif jk:
+        f.write("    simint_osteifunc_jk_array[{}][{}][{}][{}] = {};\n".format(q[0], q[1], q[2], q[3], fname))
+      elif schwarz:
+        f.write("    simint_osteifunc_schwarz_array[{}][{}] = {};\n".format(q[0], q[1], fname))
+      else:
+        f.write("    simint_osteifunc_array[{}][{}][{}][{}][{}] = {};\n".format(der, q[0], q[1], q[2], q[3], fname))
   
     f.write("    #endif\n\n")
 
+  if f32:
+    f.write("    #endif // SIMINT_OSTEI_F32\n")
+  elif jk:
+    f.write("    #endif // SIMINT_OSTEI_JK\n")
+
   f.write("}\n\n")
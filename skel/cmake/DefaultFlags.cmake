@@ -70,7 +70,9 @@ set(SIMINT_VALID_VECTOR
      sse
      avx
      avx2
+     avx512
      micavx512
+     multi
 )
 
 if("${SIMINT_VECTOR}" STREQUAL "")
@@ -91,6 +93,38 @@ endif()
 if(SIMINT_VECTOR_LOWER STREQUAL "scalar")
   list(APPEND SIMINT_CONFIG_DEFINES "SIMINT_SCALAR")
   include(cmake/DefaultFlags_scalar.cmake)
+elseif(SIMINT_VECTOR_LOWER STREQUAL "multi")
+  # Kernels for each of SIMINT_MULTI_VECTOR are compiled into the
+  # library (see simint/CMakeLists.txt). Everything else is scalar,
+  # and the kernels are chosen at runtime in simint_init()
+  list(APPEND SIMINT_CONFIG_DEFINES "SIMINT_MULTI_ISA")
+  set(SIMINT_LAYOUT_LEN 1)
+
+  foreach(isa ${SIMINT_MULTI_VECTOR})
+    string(TOLOWER "${isa}" isa_lower)
+    string(TOUPPER "${isa}" isa_upper)
+
+    if(isa_lower STREQUAL "scalar")
+      set(isa_len 1)
+    elseif(isa_lower STREQUAL "sse")
+      set(isa_len 2)
+    elseif(isa_lower STREQUAL "avx" OR isa_lower STREQUAL "avx2")
+      set(isa_len 4)
+    elseif(isa_lower STREQUAL "avx512")
+      set(isa_len 8)
+    else()
+      message(FATAL_ERROR "Invalid vectorization type ${isa} in SIMINT_MULTI_VECTOR")
+    endif()
+
+    if(${isa_len} GREATER ${SIMINT_LAYOUT_LEN})
+      set(SIMINT_LAYOUT_LEN ${isa_len})
+    endif()
+
+    list(APPEND SIMINT_CONFIG_DEFINES "SIMINT_MULTI_ISA_${isa_upper}")
+  endforeach()
+
+  list(APPEND SIMINT_CONFIG_DEFINES "SIMINT_LAYOUT_LEN ${SIMINT_LAYOUT_LEN}")
+  include(cmake/DefaultFlags_scalar.cmake)
 else()
     if(SIMINT_VECTOR_LOWER MATCHES "scalar-")
         # scalar code, but with other compile flags
@@ -104,4 +138,15 @@ else()
     endif()
 endif()
 
+
+# Boys function below BOYS_SHORTGRID_MAXX
+string(TOLOWER "${SIMINT_BOYS}" SIMINT_BOYS_LOWER)
+if(SIMINT_BOYS_LOWER STREQUAL "chebyshev")
+  list(APPEND SIMINT_CONFIG_DEFINES "SIMINT_BOYS_CHEBY")
+elseif(SIMINT_BOYS_LOWER STREQUAL "blocked")
+  list(APPEND SIMINT_CONFIG_DEFINES "SIMINT_BOYS_BLOCKED")
+elseif(NOT SIMINT_BOYS_LOWER STREQUAL "taylor")
+  message(FATAL_ERROR "Invalid Boys function ${SIMINT_BOYS} specified (taylor, blocked or chebyshev)")
+endif()
+
 list(APPEND SIMINT_Fortran_FLAGS "-I${CMAKE_CURRENT_BINARY_DIR}/simint")
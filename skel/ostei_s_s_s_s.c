@@ -1,6 +1,7 @@
 #include "simint/boys/boys.h"
 #include "simint/ostei/gen/ostei_generated.h"
 #include "simint/vectorization/vectorization.h"
+#include <float.h>
 #include <math.h>
 #include <string.h>
 #include <stdlib.h>
@@ -22,6 +23,8 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
     int istart, jstart;
     int iprimcd, nprim_icd, icd;
     const int check_screen = (screen_tol > 0.0);
+    const int check_density = (check_screen && P.density_max != NULL && Q.density_max != NULL);
+    const int check_qqr = (check_screen && P.extent != NULL && Q.extent != NULL);
     int i, j;
     int n;
     int not_screened;
@@ -51,9 +54,9 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
     int *offset_info  = (int*) malloc(sizeof(int) * (SIMINT_SIMD_LEN + 1 + TopAM_size) * n_info_vector);
     assert(offset_info != NULL);
 
-    #ifdef SIMINT_PRIM_SCREEN_STAT
-    int calc_nprim = 0, skip_nprim = 0, calc_nvec = 0, skip_nvec = 0;
-    #endif
+    // Screening statistics (see simint_stats_get)
+    long calc_nprim = 0, skip_nprim = 0, calc_nvec = 0, skip_nvec = 0, boys_mixed = 0;
+
     ////////////////////////////////////////
     // Loop over shells and primitives
     ////////////////////////////////////////
@@ -73,13 +76,24 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
             int jend = jstart;
             for(i = 0; i < nshellbatch; i++)
                 jend += Q.nprim12[cd+i];
+
+            // With density bounds, integrals only need to be computed if they
+            // times the largest bound of the bra and this batch of kets are significant
+            double batch_screen_tol = screen_tol;
+            if(check_density)
+            {
+                double dmax = P.density_max[ab];
+                for(i = 0; i < nshellbatch; i++)
+                    dmax = (Q.density_max[cd+i] > dmax ? Q.density_max[cd+i] : dmax);
+                batch_screen_tol = (dmax > 0.0 ? screen_tol / (dmax*dmax) : DBL_MAX);
+            }
             
             // Check if the offset buffer is large enough
             int j_vec = (jend - jstart + SIMINT_SIMD_LEN - 1) / SIMINT_SIMD_LEN;
             if (j_vec > n_info_vector)
             {
                 n_info_vector = j_vec;
-                if (!offset_info) free(offset_info);
+                free(offset_info);
                 offset_info  = (int*) malloc(sizeof(int) * (SIMINT_SIMD_LEN + 1 + TopAM_size) * n_info_vector);
             }
             // Calculate all the shell offsets in the j-loop
@@ -125,20 +139,20 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
             for(i = istart; i < iend; ++i)
             {
                 SIMINT_DBLTYPE bra_screen_max;  // only used if check_screen
+                SIMINT_DBLTYPE bra_extent = SIMINT_DBLSET1(0.0);  // only used if check_qqr
 
                 if(check_screen)
                 {
                     // Skip this whole thing if always insignificant
-                    if((P.screen[i] * Q.screen_max) < screen_tol)
+                    if((P.screen[i] * Q.screen_max) < batch_screen_tol)
                     {
-                        #ifdef SIMINT_PRIM_SCREEN_STAT
-                        int j_len = jend - jstart;
-                        skip_nprim += j_len;
-                        skip_nvec  += (j_len + SIMINT_SIMD_LEN - 1) / SIMINT_SIMD_LEN;
-                        #endif
+                        skip_nprim += jend - jstart;
+                        skip_nvec += (jend - jstart + SIMINT_SIMD_LEN - 1) / SIMINT_SIMD_LEN;
                         continue;
                     }
                     bra_screen_max = SIMINT_DBLSET1(P.screen[i]);
+                    if(check_qqr)
+                        bra_extent = SIMINT_DBLSET1(P.extent[i]);
                 }
 
                 icd = 0;
@@ -196,26 +210,36 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
 
                     // Do we have to compute this vector (or has it been screened out)?
                     // (not_screened != 0 means we have to do this vector)
-                    SIMINT_DBLTYPE prim_screen_res = SIMINT_MUL(bra_screen_max, SIMINT_DBLLOAD(Q.screen, j));
+                    // (Q.screen is NULL if the shell pair was created without screening)
+                    int calc_nprim_in_vec = SIMINT_SIMD_LEN;
                     if(check_screen)
                     {
-                        const double vmax = vector_max(prim_screen_res);
-                        if(vmax < screen_tol)
+                        SIMINT_DBLTYPE screen_est = SIMINT_MUL(bra_screen_max, SIMINT_DBLLOAD(Q.screen, j));
+                        if(check_qqr)
+                        {
+                            // Far apart charge distributions interact like point charges (QQR).
+                            // R is the distance between them, minus their extents, and at least 1
+                            const SIMINT_DBLTYPE dx = SIMINT_SUB(Pxyz[0], SIMINT_DBLLOAD(Q.x, j));
+                            const SIMINT_DBLTYPE dy = SIMINT_SUB(Pxyz[1], SIMINT_DBLLOAD(Q.y, j));
+                            const SIMINT_DBLTYPE dz = SIMINT_SUB(Pxyz[2], SIMINT_DBLLOAD(Q.z, j));
+                            SIMINT_DBLTYPE R = SIMINT_SQRT(SIMINT_ADD(SIMINT_ADD(SIMINT_MUL(dx, dx), SIMINT_MUL(dy, dy)), SIMINT_MUL(dz, dz)));
+                            R = SIMINT_SUB(SIMINT_SUB(R, bra_extent), SIMINT_DBLLOAD(Q.extent, j));
+                            R = SIMINT_MAX(R, const_1);
+                            screen_est = SIMINT_DIV(screen_est, SIMINT_MUL(R, R));
+                        }
+                        const double vmax = vector_max(screen_est);
+                        if(vmax < batch_screen_tol)
                         {
-                            #ifdef SIMINT_PRIM_SCREEN_STAT
                             skip_nvec++;
                             skip_nprim += SIMINT_SIMD_LEN;
-                            #endif
                             PRIM_PTR_INT__s_s_s_s += lastoffset*1;    
                             continue;
                         }
+                        calc_nprim_in_vec = count_prim_screen_survival(screen_est, batch_screen_tol);
                     }
-                    #ifdef SIMINT_PRIM_SCREEN_STAT
                     calc_nvec++;
-                    int calc_nprim_in_vec = count_prim_screen_survival(prim_screen_res, screen_tol);
                     calc_nprim += calc_nprim_in_vec;
-                    skip_nprim += (SIMINT_SIMD_LEN - calc_nprim_in_vec);
-                    #endif
+                    skip_nprim += SIMINT_SIMD_LEN - calc_nprim_in_vec;
 
                     const SIMINT_DBLTYPE Q_alpha = SIMINT_DBLLOAD(Q.alpha, j);
                     const SIMINT_DBLTYPE PQalpha_mul = SIMINT_MUL(P_alpha, Q_alpha);
@@ -251,7 +275,7 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
                     const SIMINT_DBLTYPE Q_prefac = mask_load(nlane, Q.prefac + j);
 
 
-                    boys_F_split(PRIM_INT__s_s_s_s, F_x, 0);
+                    boys_mixed += boys_F_split(PRIM_INT__s_s_s_s, F_x, 0);
                     SIMINT_DBLTYPE prefac = SIMINT_SQRT(one_over_PQalpha_sum);
                     prefac = SIMINT_MUL(SIMINT_MUL(P_prefac, Q_prefac), prefac);
                     for(n = 0; n <= 0; n++)
@@ -313,13 +337,8 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
     
     if (offset_info != NULL) free(offset_info);
     
-    #ifdef SIMINT_PRIM_SCREEN_STAT
-    double *eri_res_end_pos = INT__s_s_s_s + 1 * P.nshell12_clip * Q.nshell12_clip;
-    eri_res_end_pos[0] = (double) calc_nprim;
-    eri_res_end_pos[1] = (double) skip_nprim;
-    eri_res_end_pos[2] = (double) calc_nvec;
-    eri_res_end_pos[3] = (double) skip_nvec;
-    #endif
+    simint_stats_add_kernel(P.nshell12_clip * Q.nshell12_clip, calc_nprim, skip_nprim,
+                            calc_nvec, skip_nvec, boys_mixed);
 
     return P.nshell12_clip * Q.nshell12_clip;
 }
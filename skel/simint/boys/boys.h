@@ -6,15 +6,192 @@
 #include "simint/boys/boys_shortgrid.h"
 #include "simint/boys/boys_long.h"
 
+#ifdef SIMINT_BOYS_CHEBY
+#include "simint/boys/boys_chebyshev.h"
+#endif
+
+#ifdef SIMINT_BOYS_BLOCKED
+#include "simint/boys/boys_taylor_blocked.h"
+#endif
+
 #ifdef __cplusplus
 #include "simint/cpp_restrict.hpp"
 extern "C" {
 #endif
 
+
+// Below BOYS_SHORTGRID_MAXX, the Boys function comes from the grid of
+// Taylor series, or from the Chebyshev fits (SIMINT_BOYS=chebyshev). With
+// SIMINT_BOYS=blocked, boys_F_split_large_n reads the Taylor series of F[n]
+// from a table blocked by n (only every BOYS_BLOCKED_K-th order, then
+// recurring down to n)
+#ifdef SIMINT_BOYS_CHEBY
+  #define BOYS_F_SHORT(F,x,n)           boys_F_cheby((F), (x), (n))
+  #define BOYS_F_SHORT_SINGLE(x,n)      boys_F_cheby_single((x), (n))
+  #define BOYS_F_SHORT_VEC(F,x,n)       boys_F_cheby_vec((F), (x), (n))
+  #define BOYS_F_SHORT_SINGLE_VEC(x,n)  boys_F_cheby_single_vec((x), (n))
+#else
+  #define BOYS_F_SHORT(F,x,n)           boys_F_taylor((F), (x), (n))
+  #define BOYS_F_SHORT_SINGLE(x,n)      boys_F_taylor_single((x), (n))
+  #define BOYS_F_SHORT_VEC(F,x,n)       boys_F_taylor_vec((F), (x), (n))
+  #define BOYS_F_SHORT_SINGLE_VEC(x,n)  boys_F_taylor_single_vec((x), (n))
+#endif
+
+
+// Lanes that are not all in the same regime (some below and some above
+// BOYS_SHORTGRID_MAXX). Both the short-range and the long-range formula
+// are evaluated for every lane, each with x moved to where it is valid,
+// and the right one is selected with 0/1 masks (multiplying both, since
+// their difference loses precision). There are no branches on the lanes,
+// and the grid points are gathered.
+struct boys_blend
+{
+    SIMINT_DBLTYPE islong, isshort;  // 1.0 or 0.0
+    SIMINT_DBLTYPE idx;              // start of the grid point (or segment)
+    SIMINT_DBLTYPE dx;               // -delta x from the grid point (or t)
+    SIMINT_DBLTYPE x1;               // 1/x (long range)
+};
+
+
+static inline
+void boys_F_blend_prepare(SIMINT_DBLTYPE x, struct boys_blend * b)
+{
+    b->islong = vector_ge(x, SIMINT_DBLSET1(BOYS_SHORTGRID_MAXX));
+    b->isshort = SIMINT_SUB(SIMINT_DBLSET1(1.0), b->islong);
+
+    // zero for the long range lanes, and MAXX for the short ones
+    const SIMINT_DBLTYPE xs = SIMINT_MUL(x, b->isshort);
+    const SIMINT_DBLTYPE xl = SIMINT_FMADD(x, b->islong, SIMINT_MUL(b->isshort, SIMINT_DBLSET1(BOYS_SHORTGRID_MAXX)));
+
+    #ifdef SIMINT_BOYS_CHEBY
+    const SIMINT_DBLTYPE seg = vector_floor(SIMINT_MUL(xs, SIMINT_DBLSET1(BOYS_CHEBY_LOOKUPFAC)));
+    b->idx = SIMINT_MUL(seg, SIMINT_DBLSET1(BOYS_CHEBY_ORDER+1));
+    b->dx = SIMINT_SUB(SIMINT_MUL(xs, SIMINT_DBLSET1(2.0*BOYS_CHEBY_LOOKUPFAC)),
+                       SIMINT_FMADD(seg, SIMINT_DBLSET1(2.0), SIMINT_DBLSET1(1.0)));
+    #else
+    const SIMINT_DBLTYPE lookup_idx = vector_floor(SIMINT_MUL(SIMINT_DBLSET1(BOYS_SHORTGRID_LOOKUPFAC),
+                                                              SIMINT_ADD(xs, SIMINT_DBLSET1(BOYS_SHORTGRID_LOOKUPFAC2))));
+    b->idx = SIMINT_MUL(lookup_idx, SIMINT_DBLSET1(BOYS_SHORTGRID_MAXN+1));
+    b->dx = SIMINT_FMSUB(lookup_idx, SIMINT_DBLSET1(BOYS_SHORTGRID_SPACE), xs);
+    #endif
+    b->x1 = SIMINT_DIV(SIMINT_DBLSET1(1.0), xl);
+}
+
+
+// F[n] for x < BOYS_SHORTGRID_MAXX, for the lanes set up by boys_F_blend_prepare
+static inline
+SIMINT_DBLTYPE boys_F_blend_short(struct boys_blend const * b, int n)
+{
+    #ifdef SIMINT_BOYS_CHEBY
+    double const * coef = &(boys_cheby[n][0][0]);
+
+    SIMINT_DBLTYPE F = vector_gather(coef + BOYS_CHEBY_ORDER, b->idx);
+    for(int k = BOYS_CHEBY_ORDER-1; k >= 0; k--)
+        F = SIMINT_FMADD(F, b->dx, vector_gather(coef + k, b->idx));
+    return F;
+    #else
+    double const * gridpts = &(boys_shortgrid[0][0]) + n;
+    const SIMINT_DBLTYPE dx = b->dx;
+
+    SIMINT_DBLTYPE F = SIMINT_MUL(SIMINT_DBLSET1(1.0/5040.0), vector_gather(gridpts+7, b->idx));
+    F = SIMINT_FMADD(dx, F, SIMINT_MUL(SIMINT_DBLSET1(1.0/720.0), vector_gather(gridpts+6, b->idx)));
+    F = SIMINT_FMADD(dx, F, SIMINT_MUL(SIMINT_DBLSET1(1.0/120.0), vector_gather(gridpts+5, b->idx)));
+    F = SIMINT_FMADD(dx, F, SIMINT_MUL(SIMINT_DBLSET1(1.0/24.0), vector_gather(gridpts+4, b->idx)));
+    F = SIMINT_FMADD(dx, F, SIMINT_MUL(SIMINT_DBLSET1(1.0/6.0), vector_gather(gridpts+3, b->idx)));
+    F = SIMINT_FMADD(dx, F, SIMINT_MUL(SIMINT_DBLSET1(1.0/2.0), vector_gather(gridpts+2, b->idx)));
+    F = SIMINT_FMADD(dx, F, vector_gather(gridpts+1, b->idx));
+    return SIMINT_FMADD(dx, F, vector_gather(gridpts, b->idx));
+    #endif
+}
+
+
+static inline
+void boys_F_blend_vec(SIMINT_DBLTYPE * restrict F,
+                      SIMINT_DBLTYPE x,
+                      int n)
+{
+    struct boys_blend b;
+    boys_F_blend_prepare(x, &b);
+
+    SIMINT_DBLTYPE x2 = SIMINT_SQRT(b.x1);
+
+    for(int i = 0; i <= n; i++)
+    {
+        const SIMINT_DBLTYPE Fshort = boys_F_blend_short(&b, i);
+        const SIMINT_DBLTYPE Flong = SIMINT_MUL(SIMINT_DBLSET1(boys_longfac[i]), x2);
+        x2 = SIMINT_MUL(x2, b.x1);
+
+        F[i] = SIMINT_FMADD(b.islong, Flong, SIMINT_MUL(b.isshort, Fshort));
+    }
+}
+
+
+// Only F[n] of boys_F_blend_vec
+static inline
+SIMINT_DBLTYPE boys_F_blend_single_vec(SIMINT_DBLTYPE x, int n)
+{
+    struct boys_blend b;
+    boys_F_blend_prepare(x, &b);
+
+    const SIMINT_DBLTYPE Fshort = boys_F_blend_short(&b, n);
+
+    // x^-(n+1/2), without pow
+    SIMINT_DBLTYPE Flong = SIMINT_MUL(SIMINT_DBLSET1(boys_longfac[n]), SIMINT_SQRT(b.x1));
+    SIMINT_DBLTYPE xp = b.x1;
+    for(int m = n; m > 0; m >>= 1)
+    {
+        if(m & 1)
+            Flong = SIMINT_MUL(Flong, xp);
+        xp = SIMINT_MUL(xp, xp);
+    }
+
+    return SIMINT_FMADD(b.islong, Flong, SIMINT_MUL(b.isshort, Fshort));
+}
+
+
+// One lane at a time
+static inline
+void boys_F_lanes(SIMINT_DBLTYPE * restrict F,
+                  SIMINT_DBLTYPE x,
+                  int n)
+{
+    double * restrict Fd = (double *)F;
+    double const * restrict xd = (double *)(&x);
+
+    for(int i = 0; i < SIMINT_SIMD_LEN; i++)
+    {
+        if(xd[i] < BOYS_SHORTGRID_MAXX)
+            BOYS_F_SHORT(Fd + i, xd[i], n);
+        else
+            boys_F_long(Fd + i, xd[i], n);
+    }
+}
+
+
+// Only F[n], one lane at a time
 static inline
-void boys_F_split_small_n(SIMINT_DBLTYPE * restrict F,
-                          SIMINT_DBLTYPE x,
-                          int n)
+SIMINT_DBLTYPE boys_F_lanes_single(SIMINT_DBLTYPE x, int n)
+{
+    SIMINT_DBLTYPE ret;
+    double * restrict retd = (double *)(&ret);
+    double const * restrict xd = (double *)(&x);
+
+    for(int i = 0; i < SIMINT_SIMD_LEN; i++)
+    {
+        if(xd[i] < BOYS_SHORTGRID_MAXX)
+            retd[i] = BOYS_F_SHORT_SINGLE(xd[i], n);
+        else
+            retd[i] = boys_F_long_single(xd[i], n);
+    }
+
+    return ret;
+}
+
+
+static inline
+int boys_F_split_small_n(SIMINT_DBLTYPE * restrict F,
+                         SIMINT_DBLTYPE x,
+                         int n)
 {
     // n is small - just do it all of them via
     // lookup or longfac (no recursion)
@@ -22,73 +199,125 @@ void boys_F_split_small_n(SIMINT_DBLTYPE * restrict F,
     if(vector_min(x) > BOYS_SHORTGRID_MAXX)
         boys_F_long_vec(F, x, n);
     else if(vector_max(x) < BOYS_SHORTGRID_MAXX)
-        boys_F_taylor_vec(F, x, n);
+        BOYS_F_SHORT_VEC(F, x, n);
     else
+    {
+        boys_F_lanes(F, x, n);  // faster than boys_F_blend_vec for so few F[i] (see benchmark_boys)
+        return 1;
+    }
+    #else
+    boys_F_lanes(F, x, n);
     #endif
+
+    return 0;
+}
+
+
+// F[n-1] down to F[0] from F[n], with x2 = 2x and ex = exp(-x)
+static inline
+void boys_F_recur_down(SIMINT_DBLTYPE * restrict F,
+                       SIMINT_DBLTYPE x2,
+                       SIMINT_DBLTYPE ex,
+                       int n)
+{
+    for(int n2 = n-1; n2 >= 0; n2--)
     {
-        double * restrict Fd = (double *)F;
-        double const * restrict xd = (double *)(&x);
+        const SIMINT_DBLTYPE den = SIMINT_DBLSET1(1.0 / (2.0 * n2 + 1));
 
-        for(int i = 0; i < SIMINT_SIMD_LEN; i++)
-        {
-            if(xd[i] < BOYS_SHORTGRID_MAXX)
-                boys_F_taylor(Fd + i, xd[i], n);
-            else
-                boys_F_long(Fd + i, xd[i], n);
-        }
+        //F[n2] = den * (x2 * F[(n2+1)] + ex);
+        F[n2] = SIMINT_MUL(den, ( SIMINT_FMADD(x2, F[(n2+1)], ex)));
     }
 }
 
 
 static inline
-void boys_F_split_large_n(SIMINT_DBLTYPE * restrict F,
-                          SIMINT_DBLTYPE x,
-                          int n)
+int boys_F_split_large_n(SIMINT_DBLTYPE * restrict F,
+                         SIMINT_DBLTYPE x,
+                         int n)
 {
     // n is large - do only the highest, then recur down
+    int mixed = 0;
+
+    // factors for the recursion
+    const SIMINT_DBLTYPE x2 = SIMINT_MUL(SIMINT_DBLSET1(2.0), (x));
+    const SIMINT_DBLTYPE ex = SIMINT_EXP(SIMINT_NEG(x));
 
     #ifndef SIMINT_BOYS_NOVECTOR
     if(vector_min(x) > BOYS_SHORTGRID_MAXX)
         F[n] = boys_F_long_single_vec(x, n);
     else if(vector_max(x) < BOYS_SHORTGRID_MAXX)
-        F[n] = boys_F_taylor_single_vec(x, n);
-    else
-    #endif
     {
-        double * restrict Fd = (double *)F;
-        double const * restrict xd = (double *)(&x);
-        for(int i = 0; i < SIMINT_SIMD_LEN; i++)
+        #ifdef SIMINT_BOYS_BLOCKED
+        if(n <= BOYS_BLOCKED_MAXN)
         {
-            if(xd[i] < BOYS_SHORTGRID_MAXX)
-                Fd[n*SIMINT_SIMD_LEN+i] = boys_F_taylor_single(xd[i], n);
-            else
-                Fd[n*SIMINT_SIMD_LEN+i] = boys_F_long_single(xd[i], n);
+            // from the next order in the blocked table
+            const int m = BOYS_BLOCKED_ORDER(n);
+            F[n] = boys_F_taylor_blocked_single_vec(x, m);
+            for(int n2 = m-1; n2 >= n; n2--)
+                F[n] = SIMINT_MUL(SIMINT_DBLSET1(1.0 / (2.0 * n2 + 1)), SIMINT_FMADD(x2, F[n], ex));
         }
+        else
+        #endif
+        F[n] = BOYS_F_SHORT_SINGLE_VEC(x, n);
     }
-
-    // factors for the recursion
-    const SIMINT_DBLTYPE x2 = SIMINT_MUL(SIMINT_DBLSET1(2.0), (x));
-    const SIMINT_DBLTYPE ex = SIMINT_EXP(SIMINT_NEG(x));
+    else
+    {
+        F[n] = boys_F_blend_single_vec(x, n);
+        mixed = 1;
+    }
+    #else
+    F[n] = boys_F_lanes_single(x, n);
+    #endif
 
     // now recur down
-    for(int n2 = n-1; n2 >= 0; n2--)
-    {
-        const SIMINT_DBLTYPE den = SIMINT_DBLSET1(1.0 / (2.0 * n2 + 1));
+    boys_F_recur_down(F, x2, ex, n);
 
-        //F[n2] = den * (x2 * F[(n2+1)] + ex);
-        F[n2] = SIMINT_MUL(den, ( SIMINT_FMADD(x2, F[(n2+1)], ex)));
-    }
+    return mixed;
 }
 
+// Returns 1 if x had lanes in both the short and the long range (so it
+// was not evaluated as one vector), otherwise 0. The kernels add these up
+// for the boys_mixed member of simint_screen_stats
 static inline
-void boys_F_split(SIMINT_DBLTYPE * restrict F,
-                  SIMINT_DBLTYPE x,
-                  int n)
+int boys_F_split(SIMINT_DBLTYPE * restrict F,
+                 SIMINT_DBLTYPE x,
+                 int n)
 {
     if(n < 4)
-        boys_F_split_small_n(F, x, n);
+        return boys_F_split_small_n(F, x, n);
+    else
+        return boys_F_split_large_n(F, x, n);
+}
+
+
+// Kernels generated with create.py -rb use boys_F_split_reduced for a vector
+// when its largest screening estimate (a bound on the square of the
+// integrals) times this is below the (squared) screening tolerance. The
+// margin covers the growth of the error through the VRR
+#define BOYS_REDUCED_MARGIN 10.0
+#define BOYS_REDUCED_SCREENFAC ((BOYS_REDUCED_MARGIN*BOYS_REDUCED_RELERR) * (BOYS_REDUCED_MARGIN*BOYS_REDUCED_RELERR))
+
+
+// As boys_F_split, but with a relative error of up to BOYS_REDUCED_RELERR
+// (fewer terms of the Taylor series) when all lanes are in the short range.
+// For the primitives whose integrals are so small that this error is below
+// the screening tolerance
+static inline
+int boys_F_split_reduced(SIMINT_DBLTYPE * restrict F,
+                         SIMINT_DBLTYPE x,
+                         int n)
+{
+    if(vector_max(x) >= BOYS_SHORTGRID_MAXX)
+        return boys_F_split(F, x, n);
+    else if(n < 4)
+        boys_F_taylor_reduced_vec(F, x, n);
     else
-        boys_F_split_large_n(F, x, n);
+    {
+        F[n] = boys_F_taylor_reduced_single_vec(x, n);
+        boys_F_recur_down(F, SIMINT_MUL(SIMINT_DBLSET1(2.0), x), SIMINT_EXP(SIMINT_NEG(x)), n);
+    }
+
+    return 0;
 }
 
 
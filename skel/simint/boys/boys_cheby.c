@@ -0,0 +1,723 @@
+/*
+ Generated with:
+   ../../../python/boys/gen_boys_cheby.py --filename boys_cheby --max-n 31 --max-x 36.5 --width 2 --tol 1e-14
+------------------------------------
+Options for Boys function Fn(x):
+      Max n: 31
+      Max x: 36.5
+      Width: 2.0
+   Segments: 19
+  Tolerance: 1.0e-14
+      Order: 13
+  Max error: 2.705e-15 (relative)
+        DPS: 64
+------------------------------------
+*/
+
+const double boys_cheby[32][19][14] = 
+{
+/* n = 0 */
+{
+/* x = 0.0         */  {0.746824132812427045            , -0.189472345820492361           , 0.0501343990725067983           , -0.0111220457961367085          , 0.00206763504724501708          , -0.000328040537615977047        , 0.0000452319918170114788        , -5.50515910269351751e-6         , 5.99090152782281873e-7          , -5.89183611007001809e-8         , 5.28279103172412658e-9          , -4.35253289332168213e-10        , 3.37123459828767451e-11         , -2.3858186941956863e-12         , },
+/* x = 2.0         */  {0.50434356023143881             , -0.0757594153105958121          , 0.0147909314636599957           , -0.00272561795190936388         , 0.000449228372312576116         , -0.000065619805626438938        , 8.52571179075445752e-6          , -9.92513034984929261e-7         , 1.04360684612280226e-7          , -9.98763506702355028e-9         , 8.75967153022186608e-10         , -7.08674645747443526e-11        , 5.40356603433236941e-12         , -3.77499241865073225e-13        , },
+/* x = 4.0         */  {0.395712309610513543            , -0.0388974362611428077          , 0.00549771808921710067          , -0.000803987231551425339        , 0.000112622986359398021         , -0.0000146571817120730479       , 1.75132400391797969e-6          , -1.9155646227594665e-7          , 1.92056715794848118e-8          , -1.77093899084134719e-9         , 1.50779564703905104e-10         , -1.19074774163132053e-11        , 8.89564458721560179e-13         , -6.11213296704197388e-14        , },
+/* x = 6.0         */  {0.334901058176559283            , -0.0238563697293574834          , 0.00252347240080420421          , -0.000289557643362946338        , 0.0000334807709991985527        , -3.76188367277953925e-6         , 4.02163142365297336e-7          , -4.04246747325752783e-8         , 3.79858390207291418e-9          , -3.33014215067194736e-10        , 2.72423695623924757e-11         , -2.08331942462388237e-12        , 1.51510122782116504e-13         , -1.01874399364087643e-14        , },
+/* x = 8.0         */  {0.295402449419840411            , -0.0164043910897640962          , 0.00136360454070015451          , -0.000125116996323285694        , 0.00001187848157754705          , -1.13071398919632909e-6         , 1.05642952162861911e-7          , -9.53933232264116247e-9         , 8.23638639715050127e-10         , -6.75376309766165234e-11        , 5.23908943567392075e-12         , -3.83920841330076163e-13        , 2.69500064429066606e-14         , -1.76156721165965437e-15        , },
+/* x = 10.0        */  {0.267206743351862277            , -0.0121450018932305469          , 0.000827688726793213293         , -0.0000625771633874385199       , 4.94609689675020084e-6          , -3.98354253374269746e-7         , 3.21417874567928372e-8          , -2.56263915762881325e-9         , 1.99578232390956653e-10         , -1.50434400189017409e-11        , 1.08990755916496464e-12         , -7.55618242056637615e-14        , 5.06529765570259949e-15         , -3.19112181467477967e-16        , },
+/* x = 12.0        */  {0.245795040805641159            , -0.0094535684798551607          , 0.000545354713656894209         , -0.0000349441461997561565       , 2.34838751760128125e-6          , -1.61856209741979056e-7         , 1.12921937701101307e-8          , -7.89336113203745909e-10        , 5.47671444878123126e-11         , -3.73923802821624064e-12        , 2.49277831223146885e-13         , -1.61258419262439459e-14        , 1.01965708656070936e-15         , -6.12765798299726853e-17        , },
+/* x = 14.0        */  {0.228822798329737351            , -0.00762741641424722832         , 0.000381365722340353044         , -0.000021185285117127936        , 1.23538343416523203e-6          , -7.4038033183113479e-8          , 4.51038432703715774e-9          , -2.77191104353437522e-10        , 1.70715508613547091e-11         , -1.04677594647845312e-12        , 6.34825213898560523e-14         , -3.78435219693244059e-15        , 2.22920339741264098e-16         , -1.26347903211428346e-17        , },
+/* x = 16.0        */  {0.21494160010412462             , -0.00632181055013963037         , 0.000278902797809436811         , -0.0000136715028368489227       , 7.03629558542266887e-7          , -3.72408297225359967e-8         , 2.00639280442978599e-9          , -1.09351291267648416e-10        , 6.00020344717521863e-12         , -3.29989182605617621e-13        , 1.81043209647327507e-14         , -9.86046635686362102e-16        , 5.35569425981028785e-17         , -2.83241666532183176e-18        , },
+/* x = 18.0        */  {0.203314400334762091            , -0.00535037880873593826         , 0.000211199089781728648         , -9.26309339921424969e-6         , 4.26583684178253097e-7          , -2.0205366882909305e-8          , 9.74615551459988242e-10         , -4.76023327331434511e-11        , 2.34514262700403911e-12         , -1.16165107852516741e-13        , 5.76746234489206516e-15         , -2.86058305673563466e-16        , 1.42383911682596235e-17         , -6.96922314427408724e-19        , },
+/* x = 20.0        */  {0.193390569924979533            , -0.00460453736111246404         , 0.000164447753870016063         , -6.52570150969888032e-6         , 2.71903477332650612e-7          , -1.16528557237718433e-8         , 5.08631326026516766e-10         , -2.24869187240955841e-11        , 1.00343256718151837e-12         , -4.50781688540373772e-14        , 2.03423460843363376e-15         , -9.2012663863391901e-17         , 4.19095149333084696e-18         , -1.89046693971810214e-19        , },
+/* x = 22.0        */  {0.184791088080199504            , -0.00401719756473001537         , 0.000130995571647513585         , -4.74621599223311424e-6         , 1.80562471970104145e-7          , -7.0654694432511374e-9          , 2.81591698255016257e-10         , -1.13681663080417529e-11        , 4.63321023302237317e-13         , -1.90191119045722775e-14        , 7.8494598606865623e-16          , -3.25208461514803691e-17        , 1.35857224350634683e-18         , -5.64582322388524966e-20        , },
+/* x = 24.0        */  {0.177245385090279095            , -0.00354490770152782302         , 0.000106347230906955252         , -3.54490765060536219e-6         , 1.24071756197901258e-7          , -4.46658090846713961e-9         , 1.63774247533429643e-10         , -6.08298836890718543e-12        , 2.28105177297761979e-13         , -8.6165412978879377e-15         , 3.27348616709111387e-16         , -1.24917842066563329e-17        , 4.80751680122666439e-19         , -1.84524010003402338e-20        , },
+/* x = 26.0        */  {0.170554451324380554            , -0.00315841576523150046         , 0.0000877337712390275237        , -2.70783243984798278e-6         , 8.77538276188939183e-8          , -2.92512729724572224e-9         , 9.93098290335678938e-11         , -3.41541049464985005e-12        , 1.18589779694596511e-13         , -4.1481062631365589e-15         , 1.45941172653988201e-16         , -5.15865729936517993e-18        , 1.83844381614076624e-19         , -6.54371843405390617e-21        , },
+/* x = 28.0        */  {0.164568208623554517            , -0.00283738290729827846         , 0.0000733805924279350759        , -2.10863771271547182e-6         , 6.36226894250598232e-8          , -1.97449722147217827e-9         , 6.24122624035616502e-11         , -1.99842132502136379e-12        , 6.46040291637677389e-14         , -2.10395055298133089e-15        , 6.89209105676049051e-17         , -2.2684443543698246e-18         , 7.52439757400841416e-20         , -2.49485222375640168e-21        , },
+/* x = 30.0        */  {0.159171054610202181            , -0.00256727507435754446         , 0.0000621114937341791016        , -1.66966380996603829e-6         , 4.71276075162290633e-8          , -1.36822085874740699e-9         , 4.04581429014379425e-11         , -1.21187974632772377e-12        , 3.66495754353183146e-14         , -1.11656259714898299e-15        , 3.42169361373420459e-17         , -1.05358590700091584e-18        , 3.26797251661242892e-20         , -1.01381246227233615e-21        , },
+/* x = 32.0        */  {0.154272305827641016            , -0.00233745917920661146         , 0.0000531240722546604205        , -1.34151697611602353e-6         , 3.55705258789230468e-8          , -9.70105250655112692e-10        , 2.69473679756979741e-11         , -7.58259258037414881e-13        , 2.15414544853005836e-14         , -6.16506079030268707e-16        , 1.77478215457973998e-17         , -5.13364645196654922e-19        , 1.49527343247463437e-20         , -4.35774386006378164e-22        , },
+/* x = 34.0        */  {0.149799691340274055            , -0.00213999559057533463         , 0.0000458570483694669527        , -1.09183448498580718e-6         , 2.7295862124269876e-8           , -7.01893597406164497e-10        , 1.83829275385974514e-11         , -4.87710320665322766e-13        , 1.30636690979352713e-14         , -3.52511681159000936e-16        , 9.56814562076857371e-18         , -2.60949069639487989e-19        , 7.16399702495555194e-21         , -1.96851869024892359e-22        , },
+/* x = 36.0        */  {0.145694809067173784            , -0.00196884877117802295         , 0.0000399090967130674563        , -8.98853529573399172e-7         , 2.12566713074309885e-8          , -5.17054166927901255e-10        , 1.28099005303932239e-11         , -3.21483989916169688e-13        , 8.1457091833057692e-15          , -2.0792350457335825e-16         , 5.33856449417877552e-18         , -1.37727009701188686e-19        , 3.57572891640896415e-21         , -9.29411584078352981e-23        , },
+},
+/* n = 1 */
+{
+/* x = 0.0         */  {0.18947234582049237             , -0.100268798145017375           , 0.0333661373884093718           , -0.00827054018885914344         , 0.00164020268808993483          , -0.00027139195199039267         , 0.0000385361136706165464        , -4.7927170762628353e-6          , 5.30265353273607795e-7          , -5.28355113088440263e-8         , 4.78768511239893146e-9          , -3.97914559123020872e-10        , 3.10523958445144253e-11         , -2.21119755716668987e-12        , },
+/* x = 2.0         */  {0.0757594153105958135           , -0.0295818629273205828          , 0.00817685385572797483          , -0.00179691348923138291         , 0.00032809902813375207          , -0.0000511542709148207445       , 6.94759123741907967e-6          , -8.34884828159196523e-7         , 8.98887316219801385e-8          , -8.76086088513822053e-9         , 7.79526447526628257e-10         , -6.38048099395336391e-11        , 4.91318570626763273e-12         , -3.45994157484931285e-13        , },
+/* x = 4.0         */  {0.0388974362611428079           , -0.0109954361784342957          , 0.0024119616946542576           , -0.000450491945434571501        , 0.0000732859085606108591        , -0.0000105079440506931128       , 1.34089523475265145e-6          , -1.53645269073079911e-7         , 1.59384534439473502e-8          , -1.5079855121697864e-9          , 1.30979781345891388e-10         , -1.05090730269260489e-11        , 7.95475552462318725e-13         , -5.52334925775577481e-14        , },
+/* x = 6.0         */  {0.0238563697293574834           , -0.00504694480160842388         , 0.000868672930088836045         , -0.000133923083996299822        , 0.0000188094183639372833        , -2.41297885864128413e-6         , 2.82972722938009056e-7          , -3.0388654266106686e-8          , 2.99712834278594901e-9          , -2.72454771497741621e-10        , 2.29161155381373538e-11         , -1.79100071078158906e-12        , 1.32581494709805687e-13         , -9.04025420126966248e-15        , },
+/* x = 8.0         */  {0.0164043910897640962           , -0.00272720908140031162         , 0.000375350988969856591         , -0.0000475139263101047016       , 5.65356994598820064e-6          , -6.3385771372865724e-7          , 6.67753262270231476e-8          , -6.58910625491745578e-9         , 6.07838746214526742e-10         , -5.23961428288054693e-11        , 4.22306332798565118e-12         , -3.18819592602505925e-13        , 2.29243470770979125e-14         , -1.52682823745800058e-15        , },
+/* x = 10.0        */  {0.0121450018932305469           , -0.00165537745358642704         , 0.000187731490162315475         , -0.0000197843875869861321       , 1.9917712668724716e-6           , -1.92850724872798065e-7         , 1.79384740980119218e-8          , -1.59662535611416204e-9         , 1.35390971719624912e-10         , -1.08999977830501571e-11        , 8.31168773408818561e-13         , -5.99787502825309798e-14        , 4.15256485125278309e-15         , -2.68273861966738015e-16        , },
+/* x = 12.0        */  {0.0094535684798551607           , -0.0010907094273137885          , 0.000104832438599268454         , -9.39355007040241612e-6         , 8.09281048710095948e-7          , -6.77531626450407175e-8         , 5.52535279146301505e-9          , -4.38137063026563157e-10        , 3.36531443179596977e-11         , -2.49294858477959856e-12        , 1.77382243042118828e-13         , -1.20872835421789459e-14        , 7.97329409267672604e-16         , -4.95338321831888159e-17        , },
+/* x = 14.0        */  {0.00762741641424722832          , -0.000762731444680706105        , 0.000063555855351383805         , -4.9415337366603964e-6          , 3.7019016591560519e-7           , -2.70623059670083651e-8         , 1.94033773029264583e-9          , -1.36572388660671429e-10        , 9.42098390705642802e-12         , -6.34858635870008017e-13        , 4.16274940548035949e-14         , -2.6458758109046293e-15         , 1.6439049652149378e-16          , -9.72275533017995938e-18        , },
+/* x = 16.0        */  {0.00632181055013963037          , -0.000557805595618873625        , 0.0000410145085105467674        , -2.81451823416895525e-6         , 1.86204148612687571e-7          , -1.20383568275894111e-8         , 7.65459038837121202e-10         , -4.80016237271345686e-11        , 2.96990272148851264e-12         , -1.81050268470491688e-13        , 1.08464366887726906e-14         , -6.36522883688494307e-16        , 3.68491634772902015e-17         , -2.05347582958007839e-18        , },
+/* x = 18.0        */  {0.00535037880873593826          , -0.000422398179563457296        , 0.000027789280197642749         , -1.70633473671298659e-6         , 1.01026834414548166e-7          , -5.84769330899209888e-9         , 3.3321632912412623e-10          , -1.87611401315773349e-11        , 1.04548598755392437e-12         , -5.76762449497136601e-14        , 3.14662485627490552e-15         , -1.69445566054308078e-16        , 9.06599231820816925e-18         , -4.71709321602468028e-19        , },
+/* x = 20.0        */  {0.00460453736111246404          , -0.000328895507740032127        , 0.0000195771045290966409        , -1.08761390933059595e-6         , 5.82642786188596026e-8          , -3.05178795621752966e-9         , 1.5740843106681605e-10          , -8.02746031486523768e-12        , 4.0570352365713374e-13          , -2.03427541603366581e-14        , 1.01213541993990666e-15         , -4.9935278865144998e-17         , 2.45901886068962554e-18         , -1.18713018275055205e-19        , },
+/* x = 22.0        */  {0.00401719756473001537          , -0.00026199114329502717         , 0.0000142386479766993427        , -7.22249887880414785e-7         , 3.53273472162557863e-8          , -1.68955018954624395e-9         , 7.95771641558158631e-11         , -3.70656812490779648e-12        , 1.71172008162023184e-13         , -7.849572629206999e-15          , 3.57728309479657773e-16         , -1.62044507587859536e-17        , 7.34319996060095635e-19         , -3.28053877634027958e-20        , },
+/* x = 24.0        */  {0.00354490770152782302          , -0.000212694461813910504        , 0.0000106347229518160866        , -4.96287024791604489e-7         , 2.2332904542335726e-8           , -9.82645485205463826e-10        , 4.25809185822163624e-11         , -1.82484139976887405e-12        , 7.75488719679962503e-14         , -3.27352029133104027e-15        , 1.37409345646293402e-16         , -5.73923900662713841e-18        , 2.3998325915942669e-19          , -9.92705161495295335e-21        , },
+/* x = 26.0        */  {0.00315841576523150046          , -0.000175467542478055048        , 8.12349731954394834e-6          , -3.51015310475575494e-7         , 1.46256364862286197e-8          , -5.9585897420301607e-10         , 2.39078734625079298e-11         , -9.48718231428364339e-13        , 3.7332956456130127e-14          , -1.45942296195409075e-15        , 5.67451443452778192e-17         , -2.19632712696856643e-18        , 8.5099593366031708e-20          , -3.26848413345101883e-21        , },
+/* x = 28.0        */  {0.00283738290729827846          , -0.000146761184855870152        , 6.32591313814641547e-6          , -2.54490757700239229e-7         , 9.87248610736089417e-9          , -3.74473574421941525e-10        , 1.39889492751359492e-11         , -5.16832231132527737e-13        , 1.89355550059691008e-14         , -6.89213097968701212e-16        , 2.49528594084368762e-17         , -8.99443526202759876e-19        , 3.24434387747220833e-20         , -1.16139422608327468e-21        , },
+/* x = 30.0        */  {0.00256727507435754446          , -0.000124222987468358203        , 5.00899142989811488e-6          , -1.88510430064916229e-7         , 6.84110429373703594e-9          , -2.42748857408845028e-10        , 8.48315822428922565e-12         , -2.93196602654459981e-13        , 1.00490633847139128e-14         , -3.4217087953206944e-16         , 1.15894348344567485e-17         , -3.90831763536199491e-19        , 1.31832502107497343e-20         , -4.4164615243065988e-22         , },
+/* x = 32.0        */  {0.00233745917920661146          , -0.000106248144509320841        , 4.0245509283480706e-6           , -1.42282103515692177e-7         , 4.85052625327556384e-9          , -1.61684207854275624e-10        , 5.30781480626006737e-12         , -1.72331635548008514e-13        , 5.54855471520840877e-15         , -1.77478828517590169e-16        , 5.64700724863924887e-18         , -1.78897778050115757e-19        , 5.66646648133937994e-21         , -1.78344615613455588e-22        , },
+/* x = 34.0        */  {0.00213999559057533463          , -0.0000917140967389339055       , 3.27550345495742154e-6          , -1.091834484970795e-7           , 3.50946798703082264e-9          , -1.10297565231622094e-10        , 3.41397224465652169e-12         , -1.0450935264105863e-13         , 3.17260513201172134e-15         , -9.5681717317509953e-17         , 2.87043822044840633e-18         , -8.57400866346964296e-20        , 2.55963632858234519e-21         , -7.59592215900645527e-23        , },
+/* x = 36.0        */  {0.00196884877117802295          , -0.0000798181934261349126       , 2.69656058872019752e-6          , -8.50266852297239522e-8         , 2.58527083463950634e-9          , -7.68594031823760402e-11        , 2.25038792941287617e-12         , -6.51656734028393862e-14        , 1.87131154182802319e-15         , -5.33857615541945985e-17        , 1.51499645375410808e-18         , -4.28069761691170203e-20        , 1.2084724989263932e-21          , -3.39236092635164936e-23        , },
+},
+/* n = 2 */
+{
+/* x = 0.0         */  {0.100268798145017384            , -0.0667322747768222647          , 0.0248116205665767248           , -0.00656081075224706603         , 0.00135695975996137063          , -0.000231216683037758924        , 0.0000335490194886849006        , -4.24211896310449616e-6         , 4.75519698540195807e-7          , -4.78839334453273483e-8         , 4.37696553998920485e-9          , -3.66447815148252734e-10        , 2.87799720119032359e-11         , -2.06031166197345633e-12        , },
+/* x = 2.0         */  {0.0295818629273205841           , -0.0163537077114564953          , 0.00539074046769404031          , -0.00131239611251754766         , 0.000255771354575549248         , -0.0000416855475816600789       , 5.84419379017585356e-6          , -7.19109254325933099e-7         , 7.88477628345056182e-8          , -7.79636200009763298e-9         , 7.0183837147905065e-10          , -5.8000388622396687e-11         , 4.50321054032933588e-12         , -3.19279950938301896e-13        , },
+/* x = 4.0         */  {0.0109954361784342959           , -0.00482392338930860125         , 0.00135147583630369758          , -0.000293143634239689717        , 0.0000525397202536911546        , -8.04537143329938581e-6         , 1.07551688242872368e-6          , -1.27507533138332591e-7         , 1.35718719298902798e-8          , -1.30997090441030012e-9         , 1.1559753449758879e-10          , -9.39464543561074342e-12        , 7.18860421180159101e-13         , -5.03537313123604251e-14        , },
+/* x = 6.0         */  {0.00504694480160842391          , -0.00173734586017768596         , 0.000401769251988896774         , -0.0000752376734553053215       , 0.0000120648942932423017        , -1.69783634162236119e-6         , 2.1272057969051757e-7           , -2.3977011525880541e-8          , 2.45209331254231513e-9          , -2.29189052127633758e-10        , 1.97006469573489583e-11         , -1.56663168523602176e-12        , 1.17654526888695219e-13         , -8.11541709388216242e-15        , },
+/* x = 8.0         */  {0.00272720908140031163          , -0.000750701977939715478        , 0.000142541778930313667         , -0.0000226142797838793141       , 3.1692885686491288e-6           , -4.00651958023534651e-7         , 4.61237437563777247e-8          , -4.86270745011329815e-9         , 4.71565345554532953e-10         , -4.22352525518687957e-11        , 3.50695675879458584e-12         , -2.71060800259909004e-13        , 1.98701342989464924e-14         , -1.34378822175531534e-15        , },
+/* x = 10.0        */  {0.00165537745358642705          , -0.000375462980324631344        , 0.000059353162760958323         , -7.96708506747729873e-6         , 9.64253624364969884e-7          , -1.07630844701360602e-7         , 1.11763774880972489e-8          , -1.08312734217958617e-9         , 9.80999901229200547e-11         , -8.31247895934558873e-12        , 6.59756401538502899e-13         , -4.91402543540270326e-14        , 3.49114259441773187e-15         , -2.30174620335454831e-16        , },
+/* x = 12.0        */  {0.0010907094273137885           , -0.000209664877198536979        , 0.0000281806502112072356        , -3.23712419483813435e-6         , 3.38765813225373908e-7          , -3.31521167690230718e-8         , 3.06695944036840211e-9          , -2.69225077419938698e-10        , 2.24365390148877843e-11         , -1.77396382394247485e-12        , 1.32958406023046636e-13         , -9.44455492899833945e-15        , 6.44562705989370605e-16         , -4.11326607379105995e-17        , },
+/* x = 14.0        */  {0.000762731444680706105         , -0.000127111710702767623        , 0.0000148246012099811869        , -1.48076066366199711e-6         , 1.35311529835072808e-7          , -1.1642026385568746e-8          , 9.56006720475982387e-10         , -7.53678567312282328e-11        , 5.71372804151067796e-12         , -4.1630157012388687e-13         , 2.91043223211363563e-14         , -1.94944560115166716e-15        , 1.26509127952181638e-16         , -7.74678570208606705e-18        , },
+/* x = 16.0        */  {0.000557805595618873625         , -0.0000820290170210935375       , 8.44355470250686529e-6          , -7.44816594450665243e-7         , 6.01917841379530116e-8          , -4.59275423378807691e-9         , 3.36011366061352223e-10         , -2.3759218856290233e-11         , 1.62945247749819073e-12         , -1.08469712187151889e-13        , 7.00169181822491048e-15         , -4.37524973138406272e-16        , 2.67169684567326166e-17         , -1.5549961963587152e-18         , },
+/* x = 18.0        */  {0.000422398179563457296         , -0.0000555785603952854985       , 5.11900421013895968e-6          , -4.04107337658174271e-7         , 2.92384665449617174e-8          , -1.99929797491030729e-9         , 1.31327980915170924e-10         , -8.36388726976508214e-12        , 5.19086217126895441e-13         , -3.14674047843226249e-14        , 1.86388892666872156e-15         , -1.07782841717928124e-16        , 6.13669388216564686e-18         , -3.36355366856635499e-19        , },
+/* x = 20.0        */  {0.000328895507740032127         , -0.000039154209058193282        , 3.26284172799178784e-6          , -2.33057114475434084e-7         , 1.52589397810879192e-8          , -9.4445058643983394e-10         , 5.61922222027565246e-11         , -3.24562804092320685e-12        , 1.830847902290423e-13           , -1.01216261448146958e-14        , 5.49285343415604207e-16         , -2.92708921473626836e-17        , 1.54425981975417953e-18         , -7.91113936376076248e-20        , },
+/* x = 22.0        */  {0.00026199114329502717          , -0.0000284772959533986855       , 2.16674966364124435e-6          , -1.41309388865022033e-7         , 8.4477509477312849e-9           , -4.77462984944905131e-10        , 2.59459768740417428e-11         , -1.36937602716303472e-12        , 7.06461543332183825e-14         , -3.57735300557294681e-15        , 1.78248302888040427e-16         , -8.75082691152631444e-18        , 4.26708389507895339e-19         , -2.0337680398277729e-20         , },
+/* x = 24.0        */  {0.000212694461813910504         , -0.0000212694459036321731       , 1.48886107437481347e-6          , -8.93316181693425912e-8         , 4.91322742602733622e-9          , -2.55485511496112149e-10        , 1.27738897983000705e-11         , -6.20390965024065629e-13        , 2.94616827977962303e-14         , -1.37411310962095087e-15        , 6.31314571630721378e-17         , -2.86264726291660177e-18        , 1.29114183658528281e-19         , -5.71728233217283899e-21        , },
+/* x = 26.0        */  {0.000175467542478055048         , -0.0000162469946390878967       , 1.05304593142672648e-6          , -5.85025459449143831e-8         , 2.97929487101508523e-9          , -1.43447240775909365e-10        , 6.64102761997511725e-12         , -2.98663648366048457e-13        , 1.31348067078006629e-14         , -5.67457462272470474e-16        , 2.41595492986713522e-17         , -1.01594233229729835e-18        , 4.25081475468190577e-20         , -1.75092936502738216e-21        , },
+/* x = 28.0        */  {0.000146761184855870152         , -0.0000126518262762928309       , 7.63472273100717688e-7          , -3.94899444294435449e-8         , 1.87236787210970914e-9          , -8.39336956511013418e-11        , 3.61782561792043868e-12         , -1.51484438959575217e-13        , 6.20291789726576423e-15         , -2.49530589076615943e-16        , 9.89386358627599919e-18         , -3.87580181153671189e-19        , 1.51036529224860035e-20         , -5.8036138099793684e-22         , },
+/* x = 30.0        */  {0.000124222987468358203         , -0.0000100179828597962298       , 5.65531290194748687e-7          , -2.73644171749481325e-8         , 1.21374428704422564e-9          , -5.08989493458370421e-11        , 2.05237621857880023e-12         , -8.03925066903276921e-14        , 3.0795379209735678e-15          , -1.15895058547853701e-16        , 4.29914432917630435e-18         , -1.57579188751935658e-19        , 5.74324351683132542e-21         , -2.06604592353717804e-22        , },
+/* x = 32.0        */  {0.000106248144509320841         , -8.0491018566961412e-6          , 4.26846310547076532e-7          , -1.94021050131022511e-8         , 8.08421039271378298e-10         , -3.18468888375989877e-11        , 1.2063214488351967e-12          , -4.43884375746825541e-14        , 1.59730945850738891e-15         , -5.64703419583720211e-17        , 1.96787375056450097e-18         , -6.77624222302988398e-20        , 2.31913745271032617e-21         , -7.83918485912398376e-23        , },
+/* x = 34.0        */  {0.0000917140967389339055        , -6.55100690991484308e-6         , 3.27550345491238499e-7          , -1.40378719481232888e-8         , 5.5148782615811054e-10          , -2.0483833467954625e-11         , 7.31565468487083616e-13         , -2.53808409970658166e-14        , 8.61135456557860114e-16         , -2.87044904224000425e-17        , 9.43140268272690434e-19         , -3.06211912163154389e-20        , 9.87718865750945542e-22         , -3.14815755575677766e-23        , },
+/* x = 36.0        */  {0.0000798181934261349126        , -5.39312117744039503e-6         , 2.55080055689171857e-7          , -1.03410833385580246e-8         , 3.84297015911880228e-10         , -1.35023275764838029e-11        , 4.56159713819745104e-13         , -1.49704923096874777e-14        , 4.80471854267607987e-16         , -1.51500102548388257e-17        , 4.70876464222722659e-19         , -1.44617712545393574e-20        , 4.41106424994647026e-22         , -1.32995775257870126e-23        , },
+},
+/* n = 3 */
+{
+/* x = 0.0         */  {0.0667322747768222726           , -0.0496232411331567456          , 0.019682432256740535            , -0.00542783903974000989         , 0.00115608341519763654          , -0.000201294117881363205        , 0.0000296948326992902513        , -3.80415397211660869e-6         , 4.30955491953421403e-7          , -4.37762851089812816e-8         , 4.03083704216607401e-9          , -3.39573736210417199e-10        , 2.68163877746389585e-11         , -1.92864264414054376e-12        , },
+/* x = 2.0         */  {0.0163537077114564965           , -0.0107814809353885871          , 0.00393718833755254184          , -0.00102308541828599028         , 0.000208427737909648902         , -0.0000350651628869155752       , 5.03376477380869371e-6          , -6.30781547017173109e-7         , 7.01672718712458005e-8          , -7.01940242272220774e-9         , 6.37990712709639933e-10         , -5.31494722890127712e-11        , 4.15557104827924277e-12         , -2.96351398313086447e-13        , },
+/* x = 4.0         */  {0.00482392338930860143          , -0.0027029516726074742          , 0.000879430902719053511         , -0.00021015888101223542         , 0.0000402268571667054499        , -6.4531013173351276e-6          , 8.92552730967427879e-7          , -1.08574888723748914e-7         , 1.1789740284478969e-8           , -1.15613432316031553e-9         , 1.03339002667367261e-10         , -8.48758045684324587e-12        , 6.55361097733746007e-13         , -4.62481991062211154e-14        , },
+/* x = 6.0         */  {0.00173734586017768599          , -0.000803538503977806119        , 0.000225713020365913505         , -0.0000482595771725669368       , 8.48918170814459438e-6          , -1.27632348176353669e-6         , 1.67839080523779311e-7          , -1.96167327082193837e-8         , 2.06270180640115198e-9          , -1.97031755125241352e-10        , 1.72326187796469283e-11         , -1.38978693204461635e-12        , 1.05620334202035772e-13         , -7.35579687324209358e-15        , },
+/* x = 8.0         */  {0.000750701977939715483         , -0.00028508355786062938         , 0.0000678428393516375477        , -0.0000126771542745310144       , 2.00325979012293598e-6          , -2.76742463127773572e-7         , 3.40389521255319961e-8          , -3.77252051869446012e-9         , 3.80117327097728256e-10         , -3.50736847812522718e-11        , 2.98161587485899503e-12         , -2.34848424701760823e-13        , 1.74884934282751048e-14         , -1.19772896186569537e-15        , },
+/* x = 10.0        */  {0.000375462980324631345         , -0.000118706325521916989        , 0.0000239012552024318312        , -3.85701449744889814e-6         , 5.38154223507669406e-7          , -6.70582650274160296e-8         , 7.58189139109839273e-9          , -7.84799544478460679e-10        , 7.48123195456326804e-11         , -6.59825427436792092e-12        , 5.40534084405746287e-13         , -4.12913032933980078e-14        , 2.99543860565221145e-15         , -2.00802613204924887e-16        , },
+/* x = 12.0        */  {0.000209664877198536979         , -0.0000563613004224145309       , 9.71137258451439201e-6          , -1.35506325289958632e-6         , 1.65760583845262552e-7          , -1.84017566593942344e-8         , 1.88457554123304453e-9          , -1.79492246656924282e-10        , 1.5965675929467318e-11          , -1.32970407422345194e-12        , 1.03888623878049468e-13         , -7.63001298708502764e-15        , 5.3526289538638919e-16          , -3.49131615958065424e-17        , },
+/* x = 14.0        */  {0.000127111710702767623         , -0.0000296492024199623846       , 4.44228199098598938e-6          , -5.41246119339943929e-7         , 5.82101319278697308e-8          , -5.73604032598163178e-9         , 5.27574996993794705e-10         , -4.57098124245141499e-11        , 3.7467143985498189e-12          , -2.91065053758698879e-13        , 2.14436401208276466e-14         , -1.49905742138808544e-15        , 1.00803302069188775e-16         , -6.35070467936474058e-18        , },
+/* x = 16.0        */  {0.0000820290170210935375        , -0.0000168871094050137327       , 2.23444978335199537e-6          , -2.40767136551745284e-7         , 2.29637711689452025e-8          , -2.01606819696897734e-9         , 1.66314531970905112e-10         , -1.30356175309797997e-11        , 9.76227459241192268e-13         , -7.00211146927471176e-14        , 4.81272624895998271e-15         , -3.16941212318889367e-16        , 2.02325707572037657e-17         , -1.22080305396734403e-18        , },
+/* x = 18.0        */  {0.0000555785603952854985        , -0.0000102380084202779198       , 1.21232201297452274e-6          , -1.16953866179833162e-7         , 9.99648987455248228e-9          , -7.87967885614394872e-10        , 5.8547210883815497e-11          , -4.15268926703676175e-12        , 2.8320665278764214e-13          , -1.86397508937571461e-14        , 1.18560174635288271e-15         , -7.28883611431393252e-17        , 4.37607887616413895e-18         , -2.50655147616145697e-19        , },
+/* x = 20.0        */  {0.000039154209058193282         , -6.52568345598357578e-6         , 6.99171343426302237e-7          , -6.1035759124348641e-8          , 4.72225293219936837e-9          , -3.37153333243860219e-10        , 2.27193962855088504e-11         , -1.46467821775206701e-12        , 9.10946373467556259e-14         , -5.49304424798691029e-15        , 3.2197781560703423e-16          , -1.83645894028378906e-17        , 1.02917466781809534e-18         , -5.55094780707545971e-20        , },
+/* x = 22.0        */  {0.0000284772959533986855        , -4.33349932728248872e-6         , 4.23928166595066095e-7          , -3.37910037909244092e-8         , 2.38731492472457068e-9          , -1.55675861250823839e-10        , 9.58563218992513127e-12         , -5.65169209624291451e-13        , 3.21961775132532267e-14         , -1.78252893821568834e-15        , 9.62586432211219462e-17         , -5.08043434511955662e-18        , 2.64554501783978689e-19         , -1.33554429917291506e-20        , },
+/* x = 24.0        */  {0.0000212694459036321731        , -2.97772214874962694e-6         , 2.67994854508027773e-7          , -1.96529097041091533e-8         , 1.27742755748057182e-9          , -7.66433387915243321e-11        , 4.34273675511532261e-12         , -2.35693455815097513e-13        , 1.23670181004531106e-14         , -6.31326611629991658e-16        , 3.14890085578531867e-17         , -1.53886256817554969e-18        , 7.43651554925860792e-20         , -3.502545242263229e-21          , },
+/* x = 26.0        */  {0.0000162469946390878967        , -2.10609186285345297e-6         , 1.75507637834743149e-7          , -1.19171794840602862e-8         , 7.17236203879549781e-10         , -3.9846165720343026e-11         , 2.09064553854814096e-12         , -1.05078451786891006e-13        , 5.10711719087703532e-15         , -2.41598931429590337e-16        , 1.11753359065759141e-17         , -5.07096947687517803e-19        , 2.2772899452398801e-20          , -1.00027429143696329e-21        , },
+/* x = 28.0        */  {0.0000126518262762928309        , -1.52694454620143538e-6         , 1.18469833288330635e-7          , -7.48947148843881961e-9         , 4.19668478255507566e-10         , -2.17069537076750588e-11        , 1.06039107271291235e-12         , -4.96233425974529403e-14        , 2.24577531050561785e-15         , -9.89397004302448637e-17        , 4.26337337252878666e-18         , -1.80314757992125738e-19        , 7.54783255719006129e-21         , -3.09692359235434687e-22        , },
+/* x = 30.0        */  {0.0000100179828597962298        , -1.13106258038949737e-6         , 8.20932515248443974e-8          , -4.85497714817689693e-9         , 2.54494746729185479e-10         , -1.23142573115236319e-11        , 5.62747546831007318e-13         , -2.46363031741483598e-14        , 1.04305552968752647e-15         , -4.29917982987644647e-17        , 1.73336838069130804e-18         , -6.86090979098264369e-20        , 2.6868399115016757e-21          , -1.03274764049822714e-22        , },
+/* x = 32.0        */  {8.0491018566961412e-6           , -8.53692621094153064e-7         , 5.82063150393067532e-8          , -3.23368415708551118e-9         , 1.59234444187995029e-10         , -7.23792869302930686e-12        , 3.10719063022346467e-13         , -1.27784755990051214e-14        , 5.08233078549802707e-16         , -1.96788641046263314e-17        , 7.45385740622203529e-19         , -2.77191630488249795e-20        , 1.01942272662564847e-21         , -3.68287945663115218e-23        , },
+/* x = 34.0        */  {6.55100690991484308e-6          , -6.55100690982476998e-7         , 4.21136158443698665e-8          , -2.2059513046324414e-9          , 1.02419167339773157e-10         , -4.38939281092936627e-12        , 1.77665886979306618e-13         , -6.88908362631211132e-15        , 2.58340414131811258e-16         , -9.43145062580449094e-18        , 3.36832780506613708e-19         , -1.18107851576630331e-20        , 4.09377890559697505e-22         , -1.39470771161044802e-23        , },
+/* x = 36.0        */  {5.39312117744039503e-6          , -5.10160111378343713e-7         , 3.10232500156740739e-8          , -1.53718806364752061e-9         , 6.75116378824190268e-11         , -2.73695828292121391e-12        , 1.04793446167754083e-13         , -3.84377482369025975e-15        , 1.36350092418394088e-16         , -4.7087838016681535e-18         , 1.5907936172960151e-19          , -5.27655613330864415e-21        , 1.72938897046656942e-22         , -5.57365554237338763e-24        , },
+},
+/* n = 4 */
+{
+/* x = 0.0         */  {0.049623241133156753            , -0.0393648645134841679          , 0.0162835171192194041           , -0.00462433366069141151         , 0.00100647058941515653          , -0.00017816899708795341         , 0.0000266290777647818497        , -3.44764053672488819e-6         , 3.93986651768855503e-7          , -4.03146017428796208e-8         , 3.73522721669115337e-9          , -3.16358409322826141e-10        , 2.5102856782349184e-11          , -1.81274799094712037e-12        , },
+/* x = 2.0         */  {0.0107814809353885882           , -0.00787437667510555615         , 0.00306925625485787606          , -0.000833710951623476487        , 0.000175325814435841458         , -0.0000302025887789242636       , 4.41547082305501756e-6          , -5.61337656600056347e-7         , 6.31746348013445936e-8          , -6.38085747193150418e-9         , 5.84631487153188105e-10         , -4.90374607232594046e-11        , 3.85718927841644307e-12         , -2.76463952030502867e-13        , },
+/* x = 4.0         */  {0.00270295167260747438          , -0.00175886180543818008         , 0.000630476643036691725         , -0.000160907428664483955        , 0.0000322655065868694472        , -5.35531640684517337e-6         , 7.60024220135958429e-7          , -9.43178421211418754e-8         , 1.04052109019084931e-8          , -1.03353697693844692e-9         , 9.33614358588591585e-11         , -7.73608566900192229e-12        , 6.01935376168709451e-13         , -4.27491679343432662e-14        , },
+/* x = 6.0         */  {0.000803538503977806146         , -0.000451426040731838498        , 0.000144778731517698547         , -0.000033956726832210775        , 6.38161740884785547e-6          , -1.00703448645109867e-6         , 1.37317128812710085e-7          , -1.65016018476937964e-8         , 1.7732861064677449e-9           , -1.72349294241404826e-10        , 1.52873528083752203e-11         , -1.24727838575341002e-12        , 9.57357026668961444e-14         , -6.72187489033974527e-15        , },
+/* x = 8.0         */  {0.000285083557860629384         , -0.000135685678703276939        , 0.0000380314628235926844        , -8.01303916043274303e-6         , 1.38371231564365075e-6          , -2.04233713284200023e-7         , 2.64076436079033523e-8          , -3.0409365938940306e-9          , 3.15663212226703024e-10         , -2.9819867376214949e-11         , 2.58328456951862567e-12         , -2.06625300666575159e-13        , 1.55879682136152699e-14         , -1.07887349090869928e-15        , },
+/* x = 10.0        */  {0.00011870632552191699          , -0.0000478025104048639659       , 0.0000115710434923466363        , -2.15261689402096464e-6         , 3.35291325137855341e-7          , -4.54913484340072479e-8         , 5.49359680762829954e-9          , -5.98498223348331904e-10        , 5.93842964427224608e-11         , -5.40595137472828522e-12        , 4.54196540003120512e-13         , -3.54124365005633949e-14        , 2.61326896230314115e-15         , -1.77608922421047496e-16        , },
+/* x = 12.0        */  {0.000056361300422414531         , -0.0000194227451690288356       , 4.06518975869874927e-6          , -6.63042335379400118e-7         , 9.20087832971002961e-8          , -1.13074532622490733e-8         , 1.25644572597867472e-9          , -1.27725350861238935e-10        , 1.19673379961437515e-11         , -1.0389899586964457e-12         , 8.39288442393109052e-14         , -6.33263554526123269e-15        , 4.54343325699811882e-16         , -3.01730664584791983e-17        , },
+/* x = 14.0        */  {0.0000296492024199623846        , -8.88456398197198786e-6         , 1.62373835801983012e-6          , -2.32840527711187459e-7         , 2.8680201629930406e-8           , -3.16544998458594926e-9         , 3.19968686864813015e-10         , -2.99737051953279627e-11        , 2.61958571265550456e-12         , -2.14454721837688801e-13        , 1.64894078931035111e-14         , -1.19365071188859075e-15        , 8.26405216191702631e-17         , -5.32963764722485019e-18        , },
+/* x = 16.0        */  {0.0000168871094050137327        , -4.46889956670399243e-6         , 7.22301409655235551e-7          , -9.18550846757268033e-8         , 1.00803409848488822e-8          , -9.978871923114932e-10          , 9.12493226976800128e-11         , -7.80981782226276988e-12        , 6.30190073331691676e-13         , -4.81306572120083065e-14        , 3.48631315180611205e-15         , -2.39828182257226746e-16        , 1.58850519567285597e-17         , -9.8755560973948104e-19         , },
+/* x = 18.0        */  {0.0000102380084202779198        , -2.42464402594904581e-6         , 3.50861598539499429e-7          , -3.99859594981993274e-8         , 3.93983942807272906e-9          , -3.51283265398308748e-10        , 2.90688248656347491e-11         , -2.26565285881250554e-12        , 1.67757765806492394e-13         , -1.18566838593533896e-14        , 8.01764382400411347e-16         , -5.19313647034423217e-17        , 3.26127698232670521e-18         , -1.93860603509115231e-19        , },
+/* x = 20.0        */  {6.52568345598357578e-6          , -1.39834268685260454e-6         , 1.83107277373045912e-7          , -1.88890117287952468e-8         , 1.68576666621945245e-9          , -1.36316377733092932e-10        , 1.02527475235379904e-11         , -7.28757022431836047e-13        , 4.94373997886222323e-14         , -3.21991811678676885e-15        , 2.02008961285400238e-16         , -1.22279484794812438e-17        , 7.22176722489467436e-19         , -4.07158447786334341e-20        , },
+/* x = 22.0        */  {4.33349932728248872e-6          , -8.47856333190132206e-7         , 1.01373011372773225e-7          , -9.54925969889777812e-9         , 7.78379306254151709e-10         , -5.75137931440920616e-11        , 3.9561844672139752e-12          , -2.57569402805934615e-13        , 1.60427607783660869e-14         , -9.62618149045084688e-16        , 5.58844508030875321e-17         , -3.14697387548900212e-18        , 1.73739665520693749e-19         , -9.22671530624738294e-21        , },
+/* x = 24.0        */  {2.97772214874962694e-6          , -5.35989709016055549e-7         , 5.89587291123274595e-8          , -5.10971022992216321e-9         , 3.83216693957629195e-10         , -2.60564205318084511e-11        , 1.64985419066951556e-12         , -9.89361405502329304e-14        , 5.68193958217071356e-15         , -3.14897883463782034e-16        , 1.69274124713821604e-17         , -8.8557643878361489e-19         , 4.55606439853805677e-20         , -2.26847570913935344e-21        , },
+/* x = 26.0        */  {2.10609186285345297e-6          , -3.51015275669486299e-7         , 3.57515384521808585e-8          , -2.86894481551816598e-9         , 1.99230828601717021e-10         , -1.2543873231587161e-11         , 7.35549162499160171e-13         , -4.08569363905772178e-14        , 2.17439040231675837e-15         , -1.11755442537377963e-16        , 5.57804740634947456e-18         , -2.71456490925086157e-19        , 1.30104815025791655e-20         , -6.06100834566485153e-22        , },
+/* x = 28.0        */  {1.52694454620143538e-6          , -2.3693966657666127e-7          , 2.24684144653164588e-8          , -1.67867391302202066e-9         , 1.08534768538375808e-10         , -6.36234643636391059e-12        , 3.47363398179702888e-13         , -1.79662021547631307e-14        , 8.90457309160119903e-16         , -4.26343374086100592e-17        , 1.98345716750650051e-18         , -9.00471397869126196e-20        , 4.02788081801796477e-21         , -1.75616966456038626e-22        , },
+/* x = 30.0        */  {1.13106258038949737e-6          , -1.64186503049688795e-7         , 1.45649314445306908e-8          , -1.01797898691673891e-9         , 6.15712865576183106e-11         , -3.37648528101307173e-12        , 1.72454122218313916e-13         , -8.34444413453707594e-15        , 3.86926186241600909e-16         , -1.7333872572662137e-17         , 7.54698558792269328e-19         , -3.20773379206615594e-20        , 1.34312401112823274e-21         , -5.49136724528496573e-23        , },
+/* x = 32.0        */  {8.53692621094153064e-7          , -1.16412630078613507e-7         , 9.70105247125653353e-9          , -6.36937776751979107e-10        , 3.61896434651465819e-11         , -1.86431437814314165e-12        , 8.94493291928072118e-14         , -4.06586459387326887e-15        , 1.77109777431576036e-16         , -7.45392070233548254e-18        , 3.04910314485556113e-19         , -1.21778324750447251e-20        , 4.78948529914290158e-22         , -1.84134148210188614e-23        , },
+/* x = 34.0        */  {6.55100690982476998e-7          , -8.4227231688739733e-8          , 6.61785391389732419e-9          , -4.09676669359092269e-10        , 2.19469640546468474e-11         , -1.06599532187907679e-12        , 4.82235853841077258e-14         , -2.06672330072274103e-15        , 8.48830557973550532e-17         , -3.36835041327269265e-18        , 1.29918475288872767e-19         , -4.89280388826787372e-21        , 1.81370709935029831e-22         , -6.57693281616544439e-24        , },
+/* x = 36.0        */  {5.10160111378343713e-7          , -6.20465000313481479e-8         , 4.61156419094256182e-9          , -2.70046551529675971e-10        , 1.36847914146060753e-11         , -6.28760677007748319e-13        , 2.69064237658042545e-14         , -1.09080073468497314e-15        , 4.23790542740786756e-17         , -1.59080216462521903e-18        , 5.80420597136630328e-20         , -2.0678072772546368e-21         , 7.24785230443278004e-23         , -2.48649576841550026e-24        , },
+},
+/* n = 5 */
+{
+/* x = 0.0         */  {0.0393648645134841749           , -0.0325670342384417305          , 0.0138730009820736426           , -0.00402588235756711271         , 0.000890844985447659828         , -0.000159774467430311754        , 0.0000241334837191888775        , -3.15189000797691487e-6         , 3.62831496868787759e-7          , -3.73581501524483111e-8         , 3.47986312374371957e-9          , -2.9610440310154812e-10         , 2.35945889031736505e-11         , -1.70995942888069604e-12        , },
+/* x = 2.0         */  {0.00787437667510555721          , -0.00613851250971619483         , 0.00250113285487034031          , -0.000701303257729198767        , 0.000151012943895809954         , -0.0000264928250658337002       , 3.92936359049494074e-6          , -5.05396592682776482e-7         , 5.74277294733557178e-8          , -5.84720537282903839e-9         , 5.39400113671943918e-10         , -4.55091065725690947e-11        , 3.59837838872727638e-12         , -2.59054922809407366e-13        , },
+/* x = 4.0         */  {0.00175886180543818024          , -0.00126095328607345135         , 0.000482722285993438288         , -0.000129062026345304865        , 0.0000267765820344068719        , -4.56014534037206691e-6         , 6.60224893979168762e-7          , -8.32416127150152431e-8         , 9.30183465421252079e-9          , -9.33750942385211322e-10        , 8.50951219651114778e-11         , -7.10402410970183363e-12        , 5.56401144568159682e-13         , -3.97334681075599254e-14        , },
+/* x = 6.0         */  {0.000451426040731838523         , -0.000289557463035407666        , 0.00010187018049663023          , -0.0000255264696350531492       , 5.03517243228342532e-6          , -8.23902775920714578e-7         , 1.15511212799783048e-7          , -1.41862772538217023e-8         , 1.551143935473058e-9            , -1.52894790937556485e-10        , 1.37197813273266013e-11         , -1.13027175959174398e-12        , 8.74865248329290502e-14         , -6.18555747033658323e-15        , },
+/* x = 8.0         */  {0.000135685678703276943         , -0.0000760629256471870446       , 0.0000240391174812979006        , -5.53484926252098085e-6         , 1.02116856642538015e-6          , -1.58445862130019421e-7         , 2.12865561362340436e-8          , -2.52530385934007192e-9         , 2.68378851437728632e-10         , -2.58362162300320973e-11        , 2.27283425668921484e-12         , -1.84114060879740499e-13        , 1.40413737974901516e-14         , -9.80519227880913241e-16        , },
+/* x = 10.0        */  {0.0000478025104048639666        , -0.0000231420869846935442       , 6.45785068206284138e-6          , -1.3411653005427307e-6          , 2.27456742170736616e-7          , -3.29615809239857266e-8         , 4.18948756007651441e-9          , -4.75074073576334298e-10        , 4.86535695764308083e-11         , -4.54251167001441719e-12        , 3.89529757716094754e-13         , -3.0882482835016256e-14         , 2.31147736969274122e-15         , -1.58914904207145936e-16        , },
+/* x = 12.0        */  {0.0000194227451690288357        , -8.13037951739754378e-6         , 1.98912700613819175e-6          , -3.68035133186953623e-7         , 5.65372663113600696e-8          , -7.53867436890009551e-9         , 8.94077455478098327e-10         , -9.5738654338494102e-11         , 9.35091080806990247e-12         , -8.39379431928944551e-13        , 6.96578374138021762e-14         , -5.37271085894130707e-15        , 3.92669349077096236e-16         , -2.64696831521451732e-17        , },
+/* x = 14.0        */  {8.88456398197198788e-6          , -3.24747671603966803e-6         , 6.98521583133560925e-7          , -1.14720806519472229e-7         , 1.58272499229490923e-8          , -1.91981212343342953e-9         , 2.09815936274434776e-10         , -2.09566771505718903e-11        , 1.93009269552697507e-12         , -1.64909755163302966e-13        , 1.31299632649492093e-14         , -9.78005183996278333e-16        , 6.93560406231190433e-17         , -4.56035847792160815e-18        , },
+/* x = 16.0        */  {4.46889956670399243e-6          , -1.4446028193104725e-6          , 2.75565254027180156e-7          , -4.03213639393507401e-8         , 4.98943596156084898e-9          , -5.47495936589179835e-10        , 5.46687247396011064e-11         , -5.04151905103540638e-12        , 4.3317594970439485e-13          , -3.48659468179606786e-14        , 2.63807598176096068e-15         , -1.88163634477492015e-16        , 1.28505949515345347e-17         , -8.18996334416900422e-19        , },
+/* x = 18.0        */  {2.42464402594904581e-6          , -7.01723197078999123e-7         , 1.19957878494597936e-7          , -1.57593577122824567e-8         , 1.75641632699216193e-9          , -1.74412949269944814e-10        , 1.58595700087202004e-11         , -1.34206183640881833e-12        , 1.06710161092762775e-13         , -8.01817556972561228e-15        , 5.71238794457425742e-16         , -3.86712547946124073e-17        , 2.52244867486933331e-18         , -1.54689664436018434e-19        , },
+/* x = 20.0        */  {1.39834268685260454e-6          , -3.66214554746091876e-7         , 5.66670351863857315e-8          , -6.74306666487611338e-9         , 6.81581888665583751e-10         , -6.15164851564955444e-11        , 5.10129915645121858e-12         , -3.95499140146684856e-13        , 2.89792642760103865e-14         , -2.02019624372450644e-15        , 1.34506235565481683e-16         , -8.57306100107006613e-18        , 5.29741512599324993e-19         , -3.10198896011810339e-20        , },
+/* x = 22.0        */  {8.47856333190132206e-7          , -2.02746022745546462e-7         , 2.86477790966933325e-8          , -3.11351722501624243e-9         , 2.87568965720484709e-10         , -2.37371068065634853e-11        , 1.80298581952441777e-12         , -1.28342073733084448e-13        , 8.66356359238690273e-15         , -5.58867413411994459e-16        , 3.46164672265971572e-17         , -2.06488583545344074e-18        , 1.20036536720076395e-19         , -6.66338359829475113e-21        , },
+/* x = 24.0        */  {5.35989709016055549e-7          , -1.17917458224654922e-7         , 1.53291306897664892e-8          , -1.53286677583043234e-9         , 1.30282102659047615e-10         , -9.89912514477707634e-12        , 6.9255298382590456e-13          , -4.54555137621923894e-14        , 2.83408100630108038e-15         , -1.69279432531573284e-16        , 9.74128692462306844e-18         , -5.42095450514010317e-19        , 2.95097849448826296e-20         , -1.54409243685216524e-21        , },
+/* x = 26.0        */  {3.51015275669486299e-7          , -7.15030769043617177e-8         , 8.60683444655449784e-9          , -7.96923314406846893e-10        , 6.2719366157937074e-11          , -4.41329497518568208e-12        , 2.85998554727949121e-13         , -1.73951224919776753e-14        , 1.00579899588940906e-15         , -5.5781806083546172e-17         , 2.98600863723538196e-18         , -1.54963287804250575e-19        , 7.88395191866094842e-21         , -3.8749674223313676e-22         , },
+/* x = 28.0        */  {2.3693966657666127e-7           , -4.49368289306329178e-8         , 5.03602173906606195e-9          , -4.34139074153497472e-10        , 3.18117321818198777e-11         , -2.08418038913006469e-12        , 1.25763415081783294e-13         , -7.12365827576718181e-15        , 3.83709040017391198e-16         , -1.98349337836569359e-17        , 9.90515271975388171e-19         , -4.80185477723487125e-20        , 2.28420808416510017e-21         , -1.05340681288954903e-22        , },
+/* x = 30.0        */  {1.64186503049688795e-7          , -2.91298628890613816e-8         , 3.05393696075021673e-9          , -2.46285146230471551e-10        , 1.68824264050654483e-11         , -1.03472473332510688e-12        , 5.84111089413289431e-14         , -3.09540943193896746e-15        , 1.56004854076648809e-16         , -7.54709190996235942e-18        , 3.52849814941914585e-19         , -1.60246979898301607e-20        , 7.14205809291615989e-22         , -3.09300479028774056e-23        , },
+/* x = 32.0        */  {1.16412630078613507e-7          , -1.94021049425130671e-8         , 1.91081333025593732e-9          , -1.44758573860585794e-10        , 9.32157189071573492e-12         , -5.36695975161646558e-13        , 2.84610521569849001e-14         , -1.41687820115437208e-15        , 6.70852865952663956e-17         , -3.0491366916219298e-18         , 1.33955889072818157e-19         , -5.71810518104973227e-21        , 2.39471902736452333e-22         , -9.75905930724987606e-24        , },
+/* x = 34.0        */  {8.4227231688739733e-8           , -1.32357078277946484e-8         , 1.22903000807727681e-9          , -8.77878562185872098e-11        , 5.32997660939539243e-12         , -2.89341512306265044e-13        , 1.44670631050184718e-14         , -6.79064440212403208e-16        , 3.03151538067014773e-17         , -1.29919605802362699e-18        , 5.382075746253084e-20           , -2.16658221967185948e-21        , 8.55311478522492957e-23         , -3.28876651616616478e-24        , },
+/* x = 36.0        */  {6.20465000313481479e-8          , -9.22312838188512365e-9         , 8.10139654589027913e-10         , -5.47391656584242368e-11        , 3.14380338503874447e-12         , -1.61438542595404548e-13        , 7.63560514278102796e-15         , -3.39032431986833534e-16        , 1.43172195111641798e-17         , -5.8042464109572642e-19         , 2.27458511689748362e-20         , -8.66213003138980913e-22        , 3.23349471080082637e-23         , -1.17642446431756396e-24        , },
+},
+/* n = 6 */
+{
+/* x = 0.0         */  {0.0325670342384417372           , -0.0277460019641500506          , 0.0120776470727007763           , -0.00356337994170214524         , 0.000798872337159049353         , -0.000144800903111579869        , 0.0000220632300198836166        , -2.90264894086800042e-6         , 3.36223428418008088e-7          , -3.48041937216568926e-8         , 3.25707310027648113e-9          , -2.78280535155439192e-10        , 2.22568666992847535e-11         , -1.61817722754820483e-12        , },
+/* x = 2.0         */  {0.00613851250971619584          , -0.00500226570974109709         , 0.00210390977318751215          , -0.00060405177556991294         , 0.000132464125330290521         , -0.0000235761816629115432       , 3.53777614339373931e-6          , -4.59421378865326894e-7         , 5.26248598962386197e-8          , -5.39483882617066138e-9         , 5.00588887982703007e-10         , -4.24494662345697659e-11        , 3.37181738399758108e-12         , -2.43691476719183542e-13        , },
+/* x = 4.0         */  {0.0012609532860734515           , -0.000965444571986939995        , 0.000387186079035901861         , -0.000107106328135598102        , 0.0000228007267020300993        , -3.96134938213948498e-6         , 5.82691288190235926e-7          , -7.44146076547576604e-8         , 8.40376022761856481e-9          , -8.51078781045708955e-10        , 7.81425578584275444e-11         , -6.56548742680845283e-12        , 5.17155939322870167e-13         , -3.71087693364877837e-14        , },
+/* x = 6.0         */  {0.000289557463035407689         , -0.000203740360993270246        , 0.000076579408905157498         , -0.0000201406897288205393       , 4.11951387962956707e-6          , -6.93067279617155955e-7         , 9.93039406519798622e-8          , -1.24091407468028818e-8         , 1.37605338580669595e-9          , -1.37217497739499998e-10        , 1.24327279283479933e-11         , -1.03265912746367084e-12        , 8.05073115366266688e-14         , -5.72639017715925435e-15        , },
+/* x = 8.0         */  {0.0000760629256471870482        , -0.0000480782349625973357       , 0.0000166045477875626397        , -4.08467426565241434e-6         , 7.92229310654134636e-7          , -1.27719337259360608e-7         , 1.76771269960003677e-8          , -2.14702912785860408e-9         , 2.32525987599151217e-10         , -2.27314292461379478e-11        , 2.02521406367841197e-12         , -1.65802656409911383e-13        , 1.27615157801731497e-14         , -8.97943053323478889e-16        , },
+/* x = 10.0        */  {0.0000231420869846935447        , -0.0000129157013641259281       , 4.02349590162814426e-6          , -9.09826968675094445e-7         , 1.64807904620566695e-7          , -2.51369254311272666e-8         , 3.32551851197164499e-9          , -3.8922828739933182e-10         , 4.0882611593047817e-11          , -3.89579113270446619e-12        , 3.39700894109740084e-13         , -2.73069890528784397e-14        , 2.06822723667061805e-15         , -1.4357979447815165e-16         , },
+/* x = 12.0        */  {8.13037951739754387e-6          , -3.97825401227642368e-6         , 1.10410539956085315e-6          , -2.26149065244154362e-7         , 3.76933718446034568e-8          , -5.36446474444183403e-9         , 6.70170579875158607e-10         , -7.48072423760103861e-11        , 7.55441594657501645e-12         , -6.96659203144216741e-13        , 5.90987837719392389e-14         , -4.6414905107913555e-15         , 3.4448249058339229e-16          , -2.3513892711266442e-17         , },
+/* x = 14.0        */  {3.24747671603966805e-6          , -1.39704316626712863e-6         , 3.44162419558415409e-7          , -6.33089996915794912e-8         , 9.59906061718420136e-9          , -1.25889561959851218e-9         , 1.46696739972145476e-10         , -1.54407341283928763e-11        , 1.48418797187920442e-12         , -1.31313264991519919e-13        , 1.07578855124697324e-14         , -8.2037517079859849e-16         , 5.93470280272824734e-17         , -3.96577222627667652e-18        , },
+/* x = 16.0        */  {1.4446028193104725e-6           , -5.51130508054361497e-7         , 1.20964091818052002e-7          , -1.99577438462054726e-8         , 2.73747968294881382e-9          , -3.28012348778916122e-10        , 3.52906333432575549e-11         , -3.46540629740855715e-12        , 3.13793551340838408e-13         , -2.63831435663792924e-14        , 2.06977066626438508e-15         , -1.52126776855779689e-16        , 1.06576116157931892e-17         , -6.93454187544908932e-19        , },
+/* x = 18.0        */  {7.01723197078999124e-7          , -2.39915756989196088e-7         , 4.72780731368473312e-8          , -7.02566530796171806e-9         , 8.72064746350241752e-10         , -9.51574201146882665e-11        , 9.39443285237685538e-12         , -8.53681051153286129e-13        , 7.21635854522582473e-14         , -5.71282352407038347e-15        , 4.25378596340282772e-16         , -2.98892419927219872e-17        , 2.01285887419686085e-18         , -1.2671403523667087e-19         , },
+/* x = 20.0        */  {3.66214554746091876e-7          , -1.13334070372771505e-7         , 2.02291999946283329e-8          , -2.72632755466100013e-9         , 3.07582425782574038e-10         , -3.06077949507211813e-11        , 2.76849398056447685e-12         , -2.31834068440960063e-13        , 1.81817671842001405e-14         , -1.34514626204703671e-15        , 9.43027023472900793e-17         , -6.28367075434546588e-18        , 4.03610806444680065e-19         , -2.44091322821446805e-20        , },
+/* x = 22.0        */  {2.02746022745546462e-7          , -5.72955581933866736e-8         , 9.34055167504872588e-9          , -1.15027586288166534e-9         , 1.18685534032836358e-10         , -1.0817914919607934e-11         , 8.98394516040722424e-13         , -6.93084993622289769e-14        , 5.02980691542662444e-15         , -3.46181863187420692e-16        , 2.27135537983951888e-17         , -1.42543545464895693e-18        , 8.66932200842533223e-20         , -5.0009953306532718e-21         , },
+/* x = 24.0        */  {1.17917458224654922e-7          , -3.06582613795329803e-8         , 4.59860032749129672e-9          , -5.21128410636130392e-10        , 4.94956257238893448e-11         , -4.1553179034960359e-12         , 3.18188596316324094e-13         , -2.26726459909475299e-14        , 1.52351493354694082e-15         , -9.74166449249379889e-17        , 5.96301009871242783e-18         , -3.50822281557671286e-19        , 2.00876951124183874e-20         , -1.09837926030675646e-21        , },
+/* x = 26.0        */  {7.15030769043617177e-8          , -1.72136688931089961e-8         , 2.39076994322054061e-9          , -2.50877464631734074e-10        , 2.20664748759293e-11            , -1.71599132849569194e-12        , 1.21765857439573746e-13         , -8.04639147950682347e-15        , 5.02036263901875199e-16         , -2.98609803211770468e-17        , 1.70458721921954192e-18         , -9.38272495054785963e-20        , 5.04071096801783471e-21         , -2.600578394842616e-22          , },
+/* x = 28.0        */  {4.49368289306329178e-8          , -1.0072043478132124e-8          , 1.3024172224604924e-9           , -1.27246928727275872e-10        , 1.04209019456505385e-11         , -7.54580490523448617e-13        , 4.98656079293381994e-14         , -3.06967219538160216e-15        , 1.78514406264497919e-16         , -9.90538144188748838e-18        , 5.28201863056684341e-19         , -2.72108849661062963e-20        , 1.37021519826604872e-21         , -6.6537347958301925e-23         , },
+/* x = 30.0        */  {2.91298628890613816e-8          , -6.10787392150043348e-9         , 7.38855438691414648e-10         , -6.75297056202607882e-11        , 5.17362366662559041e-12         , -3.5046665365702041e-13         , 2.16678660233038541e-14         , -1.24803879814937504e-15        , 6.79238277659142688e-17         , -3.52856133308076209e-18        , 1.76271114440720739e-19         , -8.51532760681612913e-21        , 4.02295512705052914e-22         , -1.83807015610875797e-23        , },
+/* x = 32.0        */  {1.94021049425130671e-8          , -3.82162666051187465e-9         , 4.34275721581757381e-10         , -3.72862875628626409e-11        , 2.6834798758082485e-12          , -1.70766312944598186e-13        , 9.91814740800520199e-15         , -5.36682282519138322e-16        , 2.74422303861743767e-17         , -1.33957766954839356e-18        , 6.28989990051387765e-20         , -2.85727404428877845e-21        , 1.26925220597258743e-22         , -5.46292951621651459e-24        , },
+/* x = 34.0        */  {1.32357078277946484e-8          , -2.45806001615455361e-9         , 2.63363568655761629e-10         , -2.13199064375814747e-11        , 1.44670756153132994e-12         , -8.68023786309661851e-14        , 4.75345108146416003e-15         , -2.42521227195120297e-16        , 1.16927645707749774e-17         , -5.38213548526430702e-19        , 2.38323569332189459e-20         , -1.02116018779298241e-21        , 4.27712313179813595e-23         , -1.73786214466971246e-24        , },
+/* x = 36.0        */  {9.22312838188512365e-9          , -1.62027930917805583e-9         , 1.6421749697527271e-10          , -1.25752135401549457e-11        , 8.07192712977024254e-13         , -4.58136308569757329e-14        , 2.37322702390057097e-15         , -1.14537754986208058e-16        , 5.22382178542675052e-18         , -2.27460534049613139e-19        , 9.52832781520966083e-21         , -3.86254396686839406e-22        , 1.52990523339935003e-23         , -5.88322869753253033e-25        , },
+},
+/* n = 7 */
+{
+/* x = 0.0         */  {0.027746001964150057            , -0.0241552941454041772          , 0.0106901398251059012           , -0.00319548934855221236         , 0.000724004515565026657         , -0.000132379380875167172        , 0.0000203185425518649084        , -2.6897845478565502e-6          , 3.1323781680440026e-7           , -3.25760100632080672e-8         , 3.06101420632134289e-9          , -2.62475220368211902e-10        , 2.10623695539405634e-11         , -1.53572667440171353e-12        , },
+/* x = 2.0         */  {0.00500226570974109804          , -0.00420781954637541743         , 0.00181215532670965914          , -0.000529856501308582021        , 0.000117880908315620142         , -0.0000212266569735829956       , 3.21594964695764201e-6          , -4.20998447853490974e-7         , 4.85535603633493354e-8          , -5.00667962659333342e-9         , 4.66933443607181814e-10         , -3.97717023391971423e-11        , 3.17187464210778996e-12         , -2.30035422924610207e-13        , },
+/* x = 4.0         */  {0.000965444571986940138         , -0.000774372158071863203        , 0.000321318984406782319         , -0.000091202906806217021        , 0.0000198067469108572463        , -3.49614774627180072e-6         , 5.20902252816160855e-7          , -6.7230016562338383e-8          , 7.65971067328874106e-9          , -7.81545219369523797e-10        , 7.22187543481405253e-11         , -6.10145749565769721e-12        , 4.82998491102506945e-13         , -3.48045920722482643e-14        , },
+/* x = 6.0         */  {0.000203740360993270268         , -0.000153158817810324103        , 0.0000604220691864597952        , -0.0000164780555182268296       , 3.46533639811008215e-6          , -5.9582364653482737e-7          , 8.68639851109687927e-8          , -1.10084170942699606e-8         , 1.23495772962274264e-9          , -1.24345598286759364e-10        , 1.1359005989685335e-11          , -9.50100244668380104e-13        , 7.45319495449045767e-14         , -5.32916459037997387e-15        , },
+/* x = 8.0         */  {0.0000480782349625973391        , -0.000033209095575126694        , 0.0000122540227969569623        , -3.16891724257127177e-6         , 6.38596686300546139e-7          , -1.06062762383403177e-7         , 1.50292038770433597e-8          , -1.86020634878951092e-9         , 2.04582901715674715e-10         , -2.02549859768986093e-11        , 1.82379157564102214e-12         , -1.50654983443977759e-13        , 1.16869487361154331e-14         , -8.27735306033345922e-16        , },
+/* x = 10.0        */  {0.0000129157013641259287        , -8.04699180325651206e-6         , 2.72948090602523943e-6          , -6.59231618475113289e-7         , 1.25684627156221796e-7          , -1.99531111362112739e-8         , 2.72459800898510088e-9          , -3.27060647481891179e-10        , 3.50621262162441777e-11         , -3.39745858899822197e-12        , 3.00370991497769329e-13         , -2.44263068538762461e-14        , 1.86867844963179216e-15         , -1.30806662057056833e-16        , },
+/* x = 12.0        */  {3.97825401227642377e-6          , -2.20821079912174237e-6         , 6.7844719573245609e-7           , -1.50773487377259325e-7         , 2.68223237223024644e-8          , -4.02102348964146653e-9         , 5.23650696184260458e-10         , -6.04352879896862631e-11        , 6.26993378789561885e-12         , -5.91060406394817858e-13        , 5.10554573454293553e-14         , -4.0704572248112066e-15         , 3.0602179552848384e-16          , -2.11108873965002903e-17        , },
+/* x = 14.0        */  {1.39704316626712864e-6          , -6.88324839116836793e-7         , 1.89926999074737333e-7          , -3.83962424685456216e-8         , 6.2944780980077681e-9           , -8.80180441553527685e-10        , 1.08085138825755483e-10         , -1.18734972201581003e-11        , 1.18181954134078833e-12         , -1.0759087239651163e-13         , 9.02397393761128217e-15         , -7.01676535471267375e-16        , 5.1610653913706332e-17          , -3.49593361870743525e-18        , },
+/* x = 16.0        */  {5.51130508054361499e-7          , -2.41928183636105024e-7         , 5.98732315386162268e-8          , -1.09499187317625812e-8         , 1.64006174389712892e-9          , -2.11743800353611907e-10        , 2.42578440696279815e-11         , -2.5103472904730783e-12         , 2.37448318308667638e-13         , -2.06997604609636079e-14        , 1.67336891663188124e-15         , -1.26098933583184776e-16        , 9.02422399506394038e-18         , -5.9746860211116467e-19         , },
+/* x = 18.0        */  {2.39915756989196088e-7          , -9.45561462736948437e-8         , 2.10769959238851211e-8          , -3.48825898539516387e-9         , 4.75787100573882999e-10         , -5.63665971664893644e-11        , 5.97576735595300436e-12         , -5.77308484653372017e-13        , 5.14154162594874865e-14         , -4.25415073200842241e-15        , 3.28777220018218523e-16         , -2.38359629800251429e-17        , 1.64889769506702516e-18         , -1.06114503445729092e-19        , },
+/* x = 20.0        */  {1.13334070372771505e-7          , -4.04583999892566996e-8         , 8.17898266398299441e-9          , -1.23032970312921652e-9         , 1.53038974753685642e-10         , -1.66109638931035945e-11        , 1.62283847870399093e-12         , -1.45454100457474033e-13        , 1.21063171785579912e-14         , -9.4309488637256715e-16         , 6.9119576388353966e-17          , -4.78410387399097639e-18        , 3.17610323102847631e-19         , -1.97419344483947978e-20        , },
+/* x = 22.0        */  {5.72955581933866736e-8          , -1.86811033500974584e-8         , 3.4508275886449949e-9           , -4.74742136131133239e-10        , 5.40895745980547826e-11         , -5.39036709815406004e-12        , 4.85159495463062791e-13         , -4.02384480482682467e-14        , 3.11563692412974381e-15         , -2.27148875749324758e-16        , 1.56796380124688923e-17         , -1.02867840941289892e-18        , 6.50682079056321512e-20         , -3.88007719938031635e-21        , },
+/* x = 24.0        */  {3.06582613795329803e-8          , -9.19720065498259482e-9         , 1.56338523190839095e-9          , -1.97982502895512961e-10        , 2.07765895174832109e-11         , -1.9091315782977062e-12         , 1.58708521922081879e-13         , -1.21881179454740643e-14        , 8.76749835504793569e-16         , -5.96328929731383655e-17        , 3.85901460967941924e-18         , -2.38615699009453642e-19        , 1.42900167312477983e-20         , -8.12214113189002225e-22        , },
+/* x = 26.0        */  {1.72136688931089961e-8          , -4.78153988644108153e-9         , 7.52632393895202174e-10         , -8.82658995037072301e-11        , 8.57995664247910799e-12         , -7.30595144727170714e-13        , 5.63247403534360511e-14         , -4.01628976939313875e-15        , 2.68748829558550326e-16         , -1.70464988656106359e-17        , 1.0320932247801799e-18          , -5.99416166356613046e-20        , 3.38312274241709394e-21         , -1.82304993517570628e-22        , },
+/* x = 28.0        */  {1.0072043478132124e-8           , -2.60483444492098487e-9         , 3.81740786181827605e-10         , -4.16836077825997443e-11        , 3.7729024526173917e-12          , -2.9919364759771554e-13         , 2.14877053669578415e-14         , -1.42811516750134102e-15        , 8.91484345056453264e-17         , -5.28217009074445417e-18        , 2.99318239939414457e-19         , -1.63103989514595608e-20        , 8.65529046277853366e-22         , -4.40611425776746335e-23        , },
+/* x = 30.0        */  {6.10787392150043348e-9          , -1.47771087738282932e-9         , 2.02589116860782362e-10         , -2.06944946665017338e-11        , 1.75233326828513868e-12         , -1.30007196145473401e-13        , 8.73627158686978843e-15         , -5.43390600602452986e-16        , 3.17570523745201489e-17         , -1.76275060665267621e-18        , 9.36682352548715484e-20         , -4.79310637459693396e-21        , 2.3908309124172836e-22          , -1.14799259545670044e-23        , },
+/* x = 32.0        */  {3.82162666051187465e-9          , -8.68551443163514767e-10        , 1.11858862688587922e-10         , -1.0733919503232818e-11         , 8.5383156472300064e-13          , -5.95088844496154191e-14        , 3.75677597758736699e-15         , -2.19537837054320317e-16        , 1.20561991257953922e-17         , -6.29001054354998204e-19        , 3.1429916846434201e-20          , -1.51344652765254e-21           , 7.10535894353099599e-23         , -3.21870650485497395e-24        , },
+/* x = 34.0        */  {2.45806001615455361e-9          , -5.2672713731152326e-10         , 6.39597193127444238e-11         , -5.78683024612526687e-12        , 4.34011893154833685e-13         , -2.85207064892610737e-14        , 1.69764859035259513e-15         , -9.35421147524341612e-17        , 4.84392196512420118e-18         , -2.3832689456922927e-19         , 1.12327343102051626e-20         , -5.10352750762850894e-22        , 2.26023007962131269e-23         , -9.67341684308473592e-25        , },
+/* x = 36.0        */  {1.62027930917805583e-9          , -3.28434993950545421e-10        , 3.7725640620464837e-11          , -3.22877085190808006e-12        , 2.29068154284879503e-13         , -1.42393621435560233e-14        , 8.01764284899434198e-16         , -4.17905737020905227e-17        , 2.04714481506553513e-18         , -9.52843439118126162e-20        , 4.24878993607206489e-21         , -1.82658510437587821e-22        , 7.65126184612631679e-24         , -3.1003919011139406e-25         , },
+},
+/* n = 8 */
+{
+/* x = 0.0         */  {0.0241552941454041833           , -0.0213802796502142996          , 0.00958646804565612726          , -0.0028960180621801942          , 0.000661896904382633449         , -0.000121911256030401328        , 0.0000188284918023674251        , -2.50589979458043175e-6         , 2.93184160486928888e-7          , -3.06151651302923673e-8         , 2.88715905972863174e-9          , -2.48364667014758698e-10        , 1.99893065205674303e-11         , -1.46125587750935432e-12        , },
+/* x = 2.0         */  {0.00420781954637541833          , -0.00362431065341969052         , 0.0015895695039256704           , -0.000471523633250568602        , 0.000106133284868923784         , -0.000019295697988953551        , 2.94698913013216651e-6          , -3.88428074496512935e-7         , 4.50601270156335139e-8          , -4.67008318825502284e-9         , 4.37478580021955678e-10         , -3.74090392544966542e-11        , 2.99414984682461889e-12         , -2.1781881693227512e-13         , },
+/* x = 4.0         */  {0.000774372158071863338         , -0.000642637968813620635        , 0.000273608720418639741         , -0.0000792269876416370801       , 0.0000174807387315099687        , -3.12541353302411055e-6         , 4.70610115211735944e-7          , -6.1277623949565457e-8          , 7.0339085271101508e-9           , -7.22300177512936245e-10        , 6.71145141741188566e-11         , -5.6976831020757635e-12         , 4.53011798072250248e-13         , -3.27662637181066136e-14        , },
+/* x = 6.0         */  {0.000153158817810324124         , -0.000120844138372928105        , 0.0000494341665546787778        , -0.0000138613455921678557       , 2.97911823269695013e-6          , -5.211839131180685e-7           , 7.70589195503859872e-8          , -9.87965249505529793e-9         , 1.11911061923169933e-9          , -1.13607186762365849e-10        , 1.04508732549507986e-11         , -8.79436311909764447e-13        , 6.93625710936242381e-14         , -4.982360876363491e-15          , },
+/* x = 8.0         */  {0.0000332090955751266971        , -0.000024508045593915236        , 9.50675172771355374e-6          , -2.55438674516021838e-6         , 5.30313811920503407e-7          , -9.0175223639955693e-8          , 1.30214444247864718e-8          , -1.6366617748852658e-9          , 1.82294909663740301e-10         , -1.82405536299854202e-11        , 1.65716974337877838e-12         , -1.379412406223026e-13          , 1.07733133438796667e-14         , -7.67381403694198963e-16        , },
+/* x = 10.0        */  {8.04699180325651255e-6          , -5.45896181205068397e-6         , 1.97769485542529933e-6          , -5.02738508618323314e-7         , 9.97655556815969144e-8          , -1.63475881129854242e-8         , 2.28942452977862327e-9          , -2.80496784683024102e-10        , 3.05771328608732575e-11         , -3.00412250101477795e-12        , 2.68683939056473554e-13         , -2.20640663086712621e-14        , 1.70246345625633992e-15         , -1.20025028970081258e-16        , },
+/* x = 12.0        */  {2.20821079912174245e-6          , -1.35689439146494487e-6         , 4.52320462131771588e-7          , -1.07289294888163919e-7         , 2.01051174482925133e-8          , -3.1419041865190074e-9          , 4.23047015518936912e-10         , -5.01594344424234118e-11        , 5.31954453369678089e-12         , -5.10620318147114955e-13        , 4.47741727993568862e-14         , -3.61488435987949095e-15        , 2.74753053815007936e-16         , -1.91257288207717109e-17        , },
+/* x = 14.0        */  {6.88324839116836805e-7          , -3.79853998149479994e-7         , 1.15188727405635838e-7          , -2.51779123918605859e-8         , 4.40090220778133314e-9          , -6.48510834488911753e-10        , 8.31144804753720527e-11         , -9.45455048547353264e-12        , 9.6831799242856728e-13          , -9.02504556728651597e-14        , 7.71830416044272494e-15         , -6.09975442526071875e-16        , 4.54972205854570887e-17         , -3.11746814613470304e-18        , },
+/* x = 16.0        */  {2.41928183636105026e-7          , -1.19746463077233346e-7         , 3.28497561952875744e-8          , -6.56024697555994766e-9         , 1.05871900177031554e-9          , -1.45547064674880208e-10        , 1.75724310224827262e-11         , -1.89958556699384073e-12        , 1.86297867353290876e-13         , -1.67354848714028318e-14        , 1.38706558045481435e-15         , -1.06723527140168538e-16        , 7.77534235843357058e-18         , -5.22386933532915421e-19        , },
+/* x = 18.0        */  {9.4556146273694844e-8           , -4.21539918477703968e-8         , 1.04647769561854629e-8          , -1.90314840229058085e-9         , 2.81832985832829636e-10         , -3.58546041802783182e-11        , 4.0411593907360984e-12          , -4.11323160322406431e-13        , 3.82873605255880696e-14         , -3.2880834149201964e-15         , 2.62191742768281251e-16         , -1.95151667512672789e-17        , 1.3808885491564131e-18          , -9.05351965123410145e-20        , },
+/* x = 20.0        */  {4.04583999892566996e-8          , -1.63579653279660167e-8         , 3.6909891093876445e-9           , -6.12155899013848761e-10        , 8.30548194655853036e-11         , -9.73703088026819885e-12        , 1.01817870287912857e-12         , -9.68505067836895791e-14        , 8.48785466990238509e-15         , -6.91251945969848838e-16        , 5.26244654546040121e-17         , -3.76229223827343459e-18        , 2.5689138757339714e-19          , -1.63438796535789908e-20        , },
+/* x = 22.0        */  {1.86811033500974584e-8          , -6.90165517728999508e-9         , 1.42422640839339879e-9          , -2.16358298392049733e-10        , 2.69518354907826634e-11         , -2.91095697430295621e-12        , 2.81669136278534332e-13         , -2.4925089585116208e-14         , 2.04434000890834033e-15         , -1.56807027981216827e-16        , 1.13153381650003264e-17         , -7.71525820079596371e-19        , 5.04862176070574513e-20         , -3.09755826266314796e-21        , },
+/* x = 24.0        */  {9.19720065498259482e-9          , -3.12677046381678296e-9         , 5.93947508686538704e-10         , -8.31063580698988661e-11        , 9.54565789149091913e-12         , -9.5225113183829015e-13         , 8.53168256068553932e-14         , -7.01399751909024391e-15        , 5.36696061321939178e-16         , -3.85922818349860395e-17        , 2.62474867126996618e-18         , -1.69616283807543381e-19        , 1.05675172292838956e-20         , -6.21305655810066198e-22        , },
+/* x = 26.0        */  {4.78153988644108153e-9          , -1.50526478779040457e-9         , 2.64797698511121654e-10         , -3.43198265699091662e-11        , 3.65297572363634251e-12         , -3.37948442186007861e-13        , 2.81140283834050798e-14         , -2.14999038735771654e-15        , 1.53418494819548736e-16         , -1.03213889507262564e-17        , 6.593528656959951e-19           , -4.01988958112969122e-20        , 2.37175302346632753e-21         , -1.3285903256940504e-22         , },
+/* x = 28.0        */  {2.60483444492098487e-9          , -7.63481572363655261e-10        , 1.25050823347799225e-10         , -1.50916098104679012e-11        , 1.49596823798868448e-12         , -1.28926232216737421e-13        , 9.99680617199685279e-15         , -7.13187418938983854e-16        , 4.75395319149879146e-17         , -2.99328709405519949e-18        , 1.79413314584624239e-19         , -1.0294978669322669e-20         , 5.7318535584829005e-22          , -3.04566286705237851e-23        , },
+/* x = 30.0        */  {1.47771087738282932e-9          , -4.05178233721564737e-10        , 6.20834839995051996e-11         , -7.00933307314014422e-12        , 6.50035980727391986e-13         , -5.24176295249134281e-14        , 3.80373420409725313e-15         , -2.54056404921123117e-16        , 1.58647557168407325e-17         , -9.36708156785184993e-19        , 5.27239188642896009e-20         , -2.8464770339818958e-21         , 1.49330403328161092e-22         , -7.50668697294817238e-24        , },
+/* x = 32.0        */  {8.68551443163514767e-10         , -2.23717725377175848e-10        , 3.22017585096984534e-11         , -3.41532625889189377e-12        , 2.97544422248083369e-13         , -2.25406558665033351e-14        , 1.53676485935013047e-15         , -9.64495892763321395e-17        , 5.66100955372016015e-18         , -3.14306006854504963e-19        , 1.66478487128944343e-20         , -8.46675023626960352e-22        , 4.18661268480258137e-23         , -1.98934986558638897e-24        , },
+/* x = 34.0        */  {5.2672713731152326e-10          , -1.27919438625488849e-10        , 1.73604907383758005e-11         , -1.73604757261930382e-12        , 1.42603532446307058e-13         , -1.01858915423938862e-14        , 6.54794803258931255e-16         , -3.87513746607442872e-17        , 2.14494206849707816e-18         , -1.12329286892475748e-19        , 5.61386327046584876e-21         , -2.69531210638960582e-22        , 1.2581619323468729e-23          , -5.65466305198980181e-25        , },
+/* x = 36.0        */  {3.28434993950545421e-10         , -7.54512812409296743e-11        , 9.68631255572424015e-12         , -9.16272617139508621e-13        , 7.11968107177806026e-14         , -4.81058570948110693e-15        , 2.92534015912299568e-16         , -1.63771581986128738e-17        , 8.57559100207936645e-19         , -4.248848953163387e-20          , 2.00923872433754722e-21         , -9.13000839019773309e-23        , 4.03228782632768986e-24         , -1.71686083846156858e-25        , },
+},
+/* n = 9 */
+{
+/* x = 0.0         */  {0.0213802796502143054           , -0.0191729360913146363          , 0.00868805418654009531          , -0.00264758761745431792         , 0.000609556280158503617         , -0.000112970951500147402        , 0.0000175412985308775279        , -2.34547067077980866e-6         , 2.75536552998690592e-7          , -2.88763813092608047e-8         , 2.73194599612659896e-9          , -2.35690693250893038e-10        , 1.90200867842567759e-11         , -1.3936616653053754e-12         , },
+/* x = 2.0         */  {0.00362431065341969138          , -0.00317913900785169427         , 0.00141457089975163378          , -0.000424533139464384301        , 0.0000964784899457280645        , -0.0000176819348825905193       , 2.71899651686610613e-6          , -3.60480628324990908e-7         , 4.20307585717618049e-8          , -4.37549676702776285e-9         , 4.11489773832121596e-10         , -3.53093180383701312e-11        , 2.8351566082437949e-12          , -2.06826707841765158e-13        , },
+/* x = 4.0         */  {0.000642637968813620763         , -0.000547217440837332376        , 0.000237680962924900513         , -0.0000699229549243472552       , 0.0000156270676652635814        , -2.82366070650399297e-6         , 4.28943366960420707e-7          , -5.62712101842057745e-8         , 6.50070306876819522e-9          , -6.71251534979480405e-10        , 6.26730756633259194e-11         , -5.34328929617594341e-12        , 4.26484504519923837e-13         , -3.09507602303531876e-14        , },
+/* x = 6.0         */  {0.000120844138372928124         , -0.0000988683331093655486       , 0.0000415840367765019552        , -0.0000119164729305320212       , 2.60591956561183557e-6          , -4.62353519604329912e-7         , 6.91575673622203376e-8          , -8.95287618427649398e-9         , 1.02246490193289521e-9          , -1.04524810107525866e-10        , 9.67358327210712125e-12         , -8.18319529762431991e-13        , 6.48492946291936242e-14         , -4.67710778701962228e-15        , },
+/* x = 8.0         */  {0.0000245080455939152389        , -0.0000190135034554283294       , 7.66316023548041037e-6          , -2.12125524764291254e-6         , 4.50876118203042216e-7          , -7.81286669006286452e-8         , 1.14566324085308547e-8          , -1.45835793670110635e-9         , 1.64165016239881411e-10         , -1.65741552166172233e-11        , 1.51732082283298021e-12         , -1.27134786020863403e-13        , 9.98789425251491354e-15         , -7.14991368564199066e-16        , },
+/* x = 10.0        */  {5.45896181205068442e-6          , -3.95538971085078804e-6         , 1.50821552585493231e-6          , -3.99062222720327321e-7         , 8.17379405654289098e-8          , -1.37365472332147679e-8         , 1.96347749037258353e-9          , -2.4461685510402094e-10         , 2.70371076703869709e-11         , -2.68722032600078981e-12        , 2.42699682835947158e-13         , -2.00971087308832613e-14        , 1.56216048913350207e-15         , -1.10817581397605914e-16        , },
+/* x = 12.0        */  {1.35689439146494494e-6          , -9.04640924263573019e-7         , 3.21867884664485885e-7          , -8.04204697922150658e-8         , 1.57095209326733362e-8          , -2.53828210170850703e-9         , 3.51116040721127773e-10         , -4.25563235271530917e-11        , 4.59558366868712743e-12         , -4.47801755765687195e-13        , 3.97629404925391866e-14         , -3.24464877193136793e-15        , 2.48920825991928179e-16         , -1.74626246162424327e-17        , },
+/* x = 14.0        */  {3.79853998149480005e-7          , -2.30377454811276473e-7         , 7.55337371755808248e-8          , -1.76036088309718001e-8         , 3.2425541724569962e-9           , -4.98686884234024178e-10        , 6.61818533386150567e-11         , -7.74653867545953895e-12        , 8.12254228983654612e-13         , -7.71926922142592933e-14        , 6.70960478276013102e-15         , -5.37544296626610447e-16        , 4.0572571363990995e-17          , -2.8074501329582059e-18         , },
+/* x = 16.0        */  {1.19746463077233348e-7          , -6.56995123905759392e-8         , 1.96807409266796916e-8          , -4.23487600705597062e-9         , 7.27735323376419679e-10         , -1.05434586362520176e-10        , 1.32970989592674191e-11         , -1.49038207168797006e-12        , 1.50619384605766964e-13         , -1.38722455582025563e-14        , 1.17393849680351944e-15         , -9.19166869300790112e-17        , 6.7984125862313475e-18          , -4.624737903746119e-19          , },
+/* x = 18.0        */  {4.21539918477703971e-8          , -2.09295539123710599e-8         , 5.70944520687171733e-9          , -1.12733194332702705e-9         , 1.79273020901727891e-10         , -2.42469563830400439e-11        , 2.87926212064260643e-12         , -3.06298737067738617e-13        , 2.95927541933644627e-14         , -2.62218717878703618e-15        , 2.14663452049749356e-16         , -1.63352434443726634e-17        , 1.17818745072978273e-18         , -7.84730485014312622e-20        , },
+/* x = 20.0        */  {1.63579653279660168e-8          , -7.38197821877531258e-9         , 1.83646769704154195e-9          , -3.32219277861586434e-10        , 4.86851544013988204e-11         , -6.10907222406779577e-12        , 6.77953547208261511e-13         , -6.79028114810309901e-14        , 6.22126810851194679e-15         , -5.26292097890872929e-16        , 4.1384633055107363e-17          , -3.04129154993577e-18           , 2.12681914005769633e-19         , -1.38017003149985582e-20        , },
+/* x = 22.0        */  {6.90165517728999509e-9          , -2.84845281678680191e-9         , 6.49074895176148423e-10         , -1.07807341962992069e-10        , 1.45547848715251095e-11         , -1.6900148189184707e-12         , 1.74475627046236642e-13         , -1.63547153197821282e-14        , 1.41126335806698056e-15         , -1.13162092705093055e-16        , 8.48668014564709467e-18         , -5.98232235933599541e-19        , 4.03060302249719821e-20         , -2.5341251170299582e-21         , },
+/* x = 24.0        */  {3.12677046381678296e-9          , -1.18789501737307825e-9         , 2.49319074209696454e-10         , -3.81826315659369082e-11        , 4.76125565919338074e-12         , -5.11900953882047759e-13        , 4.90979826243677589e-14         , -4.29356757280256453e-15        , 3.4733055636619235e-16          , -2.6249169296439303e-17         , 1.86575971170538298e-18         , -1.25341770033174477e-19        , 8.08403177192875442e-21         , -4.89478906077423479e-22        , },
+/* x = 26.0        */  {1.50526478779040457e-9          , -5.29595397022243478e-10        , 1.0295947970972747e-10          , -1.46119028945398899e-11        , 1.68974221093041938e-12         , -1.68684170349751576e-13        , 1.50499327096796816e-14         , -1.22734777066649858e-15        , 9.28925044658238475e-17         , -6.59387312176068251e-18        , 4.42184031509782188e-19         , -2.81604124555029792e-20        , 1.72855739230548204e-21         , -1.00207942030983736e-22        , },
+/* x = 28.0        */  {7.63481572363655261e-10         , -2.50101646695598487e-10        , 4.52748294314036977e-11         , -5.98387295195354119e-12        , 6.44631161083766521e-13         , -5.99808370427516424e-14        , 4.99231193219167926e-15         , -3.80316214289329505e-16        , 2.69395846633704775e-17         , -1.7942083685648979e-18         , 1.13243966641615797e-19         , -6.81257535208012581e-21        , 3.96226616692649911e-22         , -2.1882972699784929e-23         , },
+/* x = 30.0        */  {4.05178233721564737e-10         , -1.24166967999010408e-10        , 2.10279992194204313e-11         , -2.60014392290928796e-12        , 2.62088147624584844e-13         , -2.28224052271033496e-14        , 1.77839483436288266e-15         , -1.26918036135370363e-16        , 8.43037359316485659e-18         , -5.27256787461307609e-19        , 3.13110693222356875e-20         , -1.77660587114235545e-21        , 9.76516766720230776e-23         , -5.11965626519255043e-24        , },
+/* x = 32.0        */  {2.23717725377175848e-10         , -6.44035170193969091e-11        , 1.0245978776675681e-11          , -1.19017768899226317e-12        , 1.12703279332520899e-13         , -9.2205891567334838e-15         , 6.75147124914050074e-16         , -4.52880740194718014e-17        , 2.82875410513676394e-18         , -1.66482905992990631e-19        , 9.31338277914883378e-21         , -4.98537059008640021e-22        , 2.58769957972521791e-23         , -1.28548772255658101e-24        , },
+/* x = 34.0        */  {1.27919438625488849e-10         , -3.47209814767516016e-11        , 5.20814271785791137e-12         , -5.70414129785209302e-13        , 5.09294577119705104e-14         , -3.92876881972393899e-15        , 2.71259622620028997e-16         , -1.7159535899018675e-17         , 1.01096359313445365e-18         , -5.61398224609006429e-20        , 2.96483246157158139e-21         , -1.49941099161198279e-22        , 7.35500940649038312e-24         , -3.46110906808823098e-25        , },
+/* x = 36.0        */  {7.54512812409296743e-11         , -1.93726251114484805e-11        , 2.74881785141852584e-12         , -2.84787242871116962e-13        , 2.40529285474058296e-14         , -1.75520409552283569e-15        , 1.14640107388874344e-16         , -6.86047261485100164e-18        , 3.82396408818503493e-19         , -2.00927297329432497e-20        , 1.00429795654083548e-21         , -4.80885539295082979e-23        , 2.2329977739691867e-24          , -9.96333288079934831e-26        , },
+},
+/* n = 10 */
+{
+/* x = 0.0         */  {0.0191729360913146418           , -0.0173761083730824671          , 0.00794276285236248714          , -0.0024382251205611688          , 0.000564854757506958801         , -0.000105247791840876133        , 0.0000164182946655940609        , -2.20428992642394405e-6         , 2.59887495778917976e-7          , -2.73240388314972464e-8         , 2.59253505231288363e-9          , -2.24244936481984452e-10        , 1.81403556296752577e-11         , -1.33203497636561967e-12        , },
+/* x = 2.0         */  {0.00317913900785169509          , -0.00282914179950360404         , 0.00127359941839308419          , -0.000385913959772145125        , 0.0000884096744138688346        , -0.0000163139791981008308       , 2.52336439387699466e-6          , -3.36245699415259989e-7         , 3.93794803274106519e-8          , -4.11557452951770838e-9         , 3.88393283687080436e-10         , -3.34312251638048735e-11        , 2.69209801466694979e-12         , -1.96884711706888418e-13        , },
+/* x = 4.0         */  {0.000547217440837332497         , -0.00047536192584985114         , 0.000209768864773031575         , -0.0000625082706594506811       , 0.0000141183035326558418        , -2.57366021619532485e-6         , 3.93898470637231114e-7          , -5.20055695680480188e-8         , 6.04126521240669748e-9          , -6.26831557145421183e-10        , 5.87748157241476236e-11         , -5.02984269817044112e-12        , 4.02856804371956497e-13         , -2.93237853562149727e-14        , },
+/* x = 6.0         */  {0.0000988683331093655668        , -0.000083168073553011441        , 0.0000357494187915945399        , -0.0000104236782622063634       , 2.31176759804196452e-6          , -4.14945406342132451e-7         , 6.26701331924236476e-8          , -8.17971095332820789e-9         , 9.40723499921611939e-10         , -9.67509799684865027e-11        , 9.0013105169271394e-12          , -7.64972119624252043e-13        , 6.08766959438414531e-14         , -4.40647197535714933e-15        , },
+/* x = 8.0         */  {0.0000190135034554283321        , -0.0000153263204709619643       , 6.36376574292850763e-6          , -1.80350447277557634e-6         , 3.90643334506209541e-7          , -6.87397947805178372e-8         , 1.02085055421894339e-8          , -1.31331887531825478e-9         , 1.49167428488791971e-10         , -1.51755083297900544e-11        , 1.39845180786446785e-12         , -1.1784736975577695e-13         , 9.30610174225443684e-15         , -6.69120424800670755e-16        , },
+/* x = 10.0        */  {3.95538971085078846e-6          , -3.01643105171004042e-6         , 1.19718666816094686e-6          , -3.26951762256089767e-7         , 6.86827361665418817e-8          , -1.17808649928683516e-8         , 1.71231798348154517e-9          , -2.1629666847604664e-10         , 2.41849877481529933e-11         , -2.42735045461620517e-12        , 2.2106348887485053e-13          , -1.84373065909981609e-14        , 1.44234025448354757e-15         , -1.02873092867954637e-16        , },
+/* x = 12.0        */  {9.04640924263573083e-7          , -6.43735769328999203e-7         , 2.41261409376639767e-7          , -6.28380837298154974e-8         , 1.26914105086149341e-8          , -2.1066962522273925e-9          , 2.97894264342556606e-10         , -3.67646392518746674e-11        , 4.03021654656626148e-12         , -3.97684583899703933e-13        , 3.56904083645033599e-14         , -2.93889371613988047e-15        , 2.27278893371765221e-16         , -1.60520652544192226e-17        , },
+/* x = 14.0        */  {2.30377454811276483e-7          , -1.51067474351166007e-7         , 5.2810826492914547e-8           , -1.2970216689688546e-8          , 2.49343442118149955e-9          , -3.97091121286639535e-10        , 5.42257706735992014e-11         , -6.49802905111040056e-12        , 6.9473434696598617e-13          , -6.71048125521345933e-14        , 5.91287282607690755e-15         , -4.79221642229754035e-16        , 3.65384651160229921e-17         , -2.54973804604596838e-18        , },
+/* x = 16.0        */  {6.56995123905759408e-8          , -3.93614818533600904e-8         , 1.27046280211677752e-8          , -2.91094129348304786e-9         , 5.2717293181442378e-10          , -7.97825939592822398e-11        , 1.04326744930658656e-11         , -1.2049543009309923e-12         , 1.24850228773661803e-13         , -1.17408074791314492e-14        , 1.01106522305515631e-15         , -8.03394868053174367e-17        , 6.01882588422006852e-18         , -4.1382140981957777e-19         , },
+/* x = 18.0        */  {2.09295539123710602e-8          , -1.14188904137435525e-8         , 3.38199582998105873e-9          , -7.17092083603141432e-10        , 1.21234781915499083e-10         , -1.72755727577868109e-11        , 2.14409115803962473e-12         , -2.36741904285306832e-13        , 2.35996876831095756e-14         , -2.1468715001137543e-15         , 1.79684672173543802e-16         , -1.39314308345662015e-17        , 1.02124261762969552e-18         , -6.89395247303970905e-20        , },
+/* x = 20.0        */  {7.38197821877531263e-9          , -3.67293539408310415e-9         , 9.96657833584755523e-10         , -1.94740617604947037e-10        , 3.05453611203893653e-11         , -4.06772128908377535e-12        , 4.75319680125362145e-13         , -4.9770122642547828e-14         , 4.73662939927811138e-15         , -4.13887077388608387e-16        , 3.34537003059330093e-17         , -2.51662209167526515e-18        , 1.79606374407876055e-19         , -1.18536254646568129e-20        , },
+/* x = 22.0        */  {2.84845281678680192e-9          , -1.29814979035230046e-9         , 3.23422025888975547e-10         , -5.82191394859846578e-11        , 8.45007409460113886e-12         , -1.04685376331944292e-12        , 1.14483007196305149e-13         , -1.12901028949241689e-14        , 1.01845892470958296e-15         , -8.48740790778761614e-17        , 6.58046623960736152e-18         , -4.77320984018749116e-19        , 3.29757558531107066e-20         , -2.11712622697155651e-21        , },
+/* x = 24.0        */  {1.18789501737307825e-9          , -4.98638148419393583e-10        , 1.14547894697810605e-10         , -1.90450226367518892e-11        , 2.55950476941183331e-12         , -2.9458789594091047e-13         , 3.00549730019642538e-14         , -2.77864370920033453e-15        , 2.36242540068734798e-16         , -1.86589569539283271e-17        , 1.37874343404564904e-18         , -9.58216145363110777e-20        , 6.36905716783203355e-21         , -3.95588908944658438e-22        , },
+/* x = 26.0        */  {5.29595397022243479e-10         , -2.05918959419455073e-10        , 4.3835708683619647e-11          , -6.75896884371741743e-12        , 8.43420851749061234e-13         , -9.0299596296418818e-14         , 8.59143439320938147e-15         , -7.43139889666672406e-16        , 5.93448612160787917e-17         , -4.42210809161484159e-18        , 3.09761486116386931e-19         , -2.05089928382667713e-20        , 1.3038126624558213e-21          , -7.78986231330044073e-23        , },
+/* x = 28.0        */  {2.50101646695598488e-10         , -9.05496588628074232e-11        , 1.7951618855860619e-11          , -2.57852464433417596e-12        , 2.99904185213819127e-13         , -2.99538716011611949e-14        , 2.66221349973291621e-15         , -2.15516646788414024e-16        , 1.61478759436347793e-17         , -1.13249561709078271e-18        , 7.49377162455320712e-20         , -4.70588972063930401e-21        , 2.84701418678772339e-22         , -1.62765598908316407e-23        , },
+/* x = 30.0        */  {1.24166967999010408e-10         , -4.20559984388408688e-11        , 7.80043176872786292e-12         , -1.04835259049814096e-12        , 1.14112026135529737e-13         , -1.06703690079630372e-14        , 8.88426252885247082e-16         , -6.74429819424952141e-17        , 4.74531122074917948e-18         , -3.13123165065694369e-19        , 1.9542533953986266e-20          , -1.16093560224246407e-21        , 6.66030327491918835e-23         , -3.6281726072709524e-24         , },
+/* x = 32.0        */  {6.44035170193969091e-11         , -2.04919575533513634e-11        , 3.5705330669767893e-12          , -4.50813117330036261e-13        , 4.61029457836703729e-14         , -4.05088274991032984e-15        , 3.17016518122124209e-16         , -2.26300312181249874e-17        , 1.49834618431920211e-18         , -9.31368032348825029e-20        , 5.48387794197053298e-21         , -3.07927198968482108e-22        , 1.67221429839654636e-23         , -8.65583532848013911e-25        , },
+/* x = 34.0        */  {3.47209814767516016e-11         , -1.04162854357158231e-11        , 1.71124238935562785e-12         , -2.03717830847869946e-13        , 1.9643844098620413e-14          , -1.62755773582903473e-15        , 1.20116751289684251e-16         , -8.08770833036803247e-18        , 5.0525840953340748e-19          , -2.96490849129764583e-20        , 1.64934486958930252e-21         , -8.75965807231404146e-23        , 4.50206767356144724e-24         , -2.21177384914727618e-25        , },
+/* x = 36.0        */  {1.93726251114484805e-11         , -5.49763570283705179e-12        , 8.54361728613350871e-13         , -9.62117141896200133e-14        , 8.77602047761436497e-15         , -6.87840644362992003e-16        , 4.80233083030616874e-17         , -3.05917115723016324e-18        , 1.80834569515040963e-19         , -1.00431873148269846e-20        , 5.28972217307357846e-22         , -2.66146647040988264e-23        , 1.29591542622516267e-24         , -6.04361945104713373e-26        , },
+},
+/* n = 11 */
+{
+/* x = 0.0         */  {0.0173761083730824724           , -0.0158855257047271543          , 0.00731467536168305874          , -0.00225941902995807473         , 0.000526238959210349602         , -0.0000985097686214085922       , 0.0000154300294563167007        , -2.07909757444381362e-6         , 2.459164108782773e-7            , -2.59297354669341823e-8         , 2.46663427082868254e-9          , -2.1385740750780112e-10         , 1.73382839557153944e-11         , -1.27562001610065768e-12        , },
+/* x = 2.0         */  {0.00282914179950360482          , -0.0025471988367864894          , 0.00115774187931636967          , -0.000353638697645202296        , 0.0000815698959913801696        , -0.0000151401864557193464       , 2.35371989170194608e-6          , -3.15035490400700749e-7         , 3.7040179776103314e-8           , -3.88457857094232533e-9         , 3.6773466659000257e-10          , -3.17416264408578206e-11        , 2.56270496558992713e-12         , -1.87849911715192309e-13        , },
+/* x = 4.0         */  {0.000475361925849851256         , -0.000419537729546110758        , 0.000187524811978342338         , -0.0000564732141290999001       , 0.0000128683010811060243        , -2.36339083753458893e-6         , 3.64038986355215826e-7          , -4.83300694661021729e-8         , 5.64148534528087451e-9          , -5.87843918019055646e-10        , 5.53269682849484013e-11         , -4.75070861021235667e-12        , 3.81682444149504115e-13         , -2.78576807503737648e-14        , },
+/* x = 6.0         */  {0.0000831680735530114582        , -0.0000714988375831961977       , 0.0000312710347866176458        , -9.24707039194008672e-6         , 2.07472703172991972e-6          , -3.76020801204484207e-7         , 5.7257976580861613e-8           , -7.52578019006881551e-9         , 8.70759017793183271e-10         , -9.00274222267513878e-11        , 8.41449964076879823e-12         , -7.18025464798102853e-13        , 5.73545629879972099e-14         , -4.16496217599819478e-15        , },
+/* x = 8.0         */  {0.0000153263204709619668        , -0.0000127275314858580896       , 5.41051341832651221e-6          , -1.56257333799045902e-6         , 3.43698973905480093e-7          , -6.12510335625489099e-8         , 9.19323211335142815e-9          , -1.19333824919678704e-9         , 1.36579604703157633e-10         , -1.39866790534840156e-11        , 1.29629199304522818e-12         , -1.09787279229086272e-13        , 8.70913798361536434e-15         , -6.28647225988990183e-16        , },
+/* x = 10.0        */  {3.01643105171004082e-6          , -2.39437333632205771e-6         , 9.80855286768236419e-7          , -2.74730944660919965e-7         , 5.89043249647801748e-8          , -1.0273907948117321e-8          , 1.51407667722792556e-9          , -1.93479722068842804e-10        , 2.1846158600976393e-11          , -2.21096473544726634e-12        , 2.02805963280001013e-13         , -1.70202168439747537e-14        , 1.33895356036659465e-15         , -9.5955403275939026e-17         , },
+/* x = 12.0        */  {6.43735769328999263e-7          , -4.825228187533049e-7           , 1.88514251189441446e-7          , -5.0765642033648031e-8          , 1.05334812612042534e-8          , -1.78736559336068811e-9         , 2.57352474440126353e-10         , -3.224170454263114e-11          , 3.57916194723230436e-12         , -3.56955105126445397e-13        , 3.23271541233468094e-14         , -2.68281888213815839e-15        , 2.08922940740859277e-16         , -1.48426127743414203e-17        , },
+/* x = 14.0        */  {1.51067474351166016e-7          , -1.05621652985833081e-7         , 3.89106500690648522e-8          , -9.97373768459842799e-9         , 1.98545560644367445e-9          , -3.25354625189727228e-10        , 4.54862033074842911e-11         , -5.55787040189162426e-12        , 6.0394342073031017e-13          , -5.91367469605884258e-14        , 5.27133269811954907e-15         , -4.31463443368115628e-16        , 3.31849096559595249e-17         , -2.33271267472009274e-18        , },
+/* x = 16.0        */  {3.93614818533600919e-8          , -2.5409256042336189e-8          , 8.73282388044901913e-9          , -2.10869172723725837e-9         , 3.98912969798070479e-10         , -6.25960471423259535e-11        , 8.43468009855239941e-12         , -9.98801129500686225e-13        , 1.05667284379068867e-13         , -1.01119368263332682e-14        , 8.837176672367972e-16           , -7.11048088375163338e-17        , 5.38574655372527615e-18         , -3.73700591041496151e-19        , },
+/* x = 18.0        */  {1.14188904137435527e-8          , -6.76399165996222216e-9         , 2.15127625080940418e-9          , -4.84939127658645825e-10        , 8.63778637892023008e-11         , -1.28645469783923219e-11        , 1.65719332870956545e-12         , -1.88797386590310899e-13        , 1.93218462601288745e-14         , -1.797057325105899e-15          , 1.53243041388588823e-16         , -1.20711121064267637e-17        , 8.97194836636759692e-19         , -6.12664350431941971e-20        , },
+/* x = 20.0        */  {3.67293539408310419e-9          , -1.9933156671695287e-9          , 5.84221852814837776e-10         , -1.22181444480992605e-10        , 2.03386064454633294e-11         , -2.8519180858358762e-12         , 3.48390858284461792e-13         , -3.78930158277360268e-14        , 3.72498415372534139e-15         , -3.34572508288914572e-16        , 2.76823959411812581e-17         , -2.12429011071169513e-18        , 1.54259700948414403e-19         , -1.03287940609391757e-20        , },
+/* x = 22.0        */  {1.29814979035230047e-9          , -6.46844051777954172e-10        , 1.74657418457953404e-10         , -3.38002963783060708e-11        , 5.23426881660480388e-12         , -6.86898044064192233e-13        , 7.90307202280406269e-14         , -8.14766802106204922e-15        , 7.63866789762075529e-16         , -6.58108528562000944e-17        , 5.25045449770927714e-18         , -3.903064868542193e-19          , 2.75503960404350124e-20         , -1.80086112770305973e-21        , },
+/* x = 24.0        */  {4.98638148419393584e-10         , -2.29095789395621768e-10        , 5.71350679102555669e-11         , -1.02380190776294593e-11        , 1.47293947970589505e-12         , -1.80329838172650999e-13        , 1.94505059579573676e-14         , -1.88993970772901597e-15        , 1.67930626396013649e-16         , -1.37885578453709289e-17        , 1.05402425614424346e-18         , -7.54481726341108192e-20        , 5.14756627270906566e-21         , -3.2683779329119445e-22         , },
+/* x = 26.0        */  {2.05918959419455074e-10         , -8.76714173672394002e-11        , 2.02769065311522337e-11         , -3.3736834069928446e-12         , 4.51497981482341861e-13         , -5.15486063898593265e-14        , 5.20197922647740558e-15         , -4.74758773145629709e-16        , 3.97989753730362733e-17         , -3.09782859666501508e-18        , 2.25596429351628745e-19         , -1.54592191484699094e-20        , 1.01358823502205355e-21         , -6.21776003333153911e-23        , },
+/* x = 28.0        */  {9.05496588628074232e-11         , -3.59032377117212594e-11        , 7.73557393300252428e-12         , -1.19961674085459375e-12        , 1.49769358005853985e-13         , -1.59732810045423414e-14        , 1.50861652728844916e-15         , -1.29182984140147948e-16        , 1.01924610476363458e-17         , -7.49420078827511198e-19        , 5.1764304081493213e-20          , -3.37896273568811713e-21        , 2.11770858776859025e-22         , -1.24847628190503138e-23        , },
+/* x = 30.0        */  {4.20559984388408689e-11         , -1.56008635374557304e-11        , 3.14505777149442215e-12         , -4.56448104541973372e-13        , 5.33518450398250166e-14         , -5.33055751862165455e-15        , 4.72100873550278946e-16         , -3.79624847748617805e-17        , 2.81810858670743246e-18         , -1.95434489947897352e-19        , 1.27701927555102552e-20         , -7.91250582341844322e-22        , 4.72021963151949625e-23         , -2.6619368828194267e-24         , },
+/* x = 32.0        */  {2.04919575533513634e-11         , -7.14106613395357964e-12        , 1.35243935199010862e-12         , -1.84411783134648387e-13        , 2.02544137495537875e-14         , -1.90209910903068322e-15        , 1.58410218516610933e-16         , -1.19867683395518546e-17        , 8.38231251108182372e-19         , -5.484086025626942e-20          , 3.38717768317434199e-21         , -1.9884971298801599e-22         , 1.12604061011918879e-23         , -6.0533427318985777e-25         , },
+/* x = 34.0        */  {1.04162854357158231e-11         , -3.42248477871125596e-12        , 6.11153492543609801e-13         , -7.85753763944736054e-14        , 8.13778867914566939e-15         , -7.20700507810523948e-16        , 5.66139583101965484e-17         , -4.04206700038747297e-18        , 2.66841769316100113e-19         , -1.64939544755022928e-20        , 9.63557401960600095e-22         , -5.35834044237401918e-23        , 2.87711909259853746e-24         , -1.47135886332391682e-25        , },
+/* x = 36.0        */  {5.49763570283705179e-12         , -1.70872345722670181e-12        , 2.88635142568860031e-13         , -3.51040819104553697e-14        , 3.43920322181508268e-15         , -2.88139849837181967e-16        , 2.14141981000223443e-17         , -1.44667648445616642e-18        , 9.03886870951536426e-20         , -5.28985355736927935e-21        , 2.92760078072323129e-22         , -1.54363224566357269e-23        , 7.86119136913931526e-25         , -3.82208860220750283e-26        , },
+},
+/* n = 12 */
+{
+/* x = 0.0         */  {0.0158855257047271594           , -0.0146293507233682089          , 0.00677825708987379401          , -0.00210495583677447276         , 0.000492548843112778772         , -0.0000925801773402310466       , 0.0000145536829935748037        , -1.96732899243253327e-6         , 2.33367678199318288e-7          , -2.46705494633762182e-8         , 2.35237379671762396e-9          , -2.04388057572387311e-10        , 1.66040368886497711e-11         , -1.22378329873247387e-12        , },
+/* x = 2.0         */  {0.00254719883678649015          , -0.00231548375863304629         , 0.00106091609293554395          , -0.000326279583955698579        , 0.0000757009322794358926        , -0.0000141223194386105665       , 2.20524842877693359e-6          , -2.96321101451150375e-7         , 3.49612157698487528e-8          , -3.67796405497294388e-9         , 3.49149451289785051e-10         , -3.02136473052596241e-11        , 2.44511778307967308e-12         , -1.79604093939833807e-13        , },
+/* x = 4.0         */  {0.000419537729546110868         , -0.000375049623956730016        , 0.000169419642387290437         , -0.000051473204322973243        , 0.0000118169541877964522        , -2.18423393118898273e-6         , 3.38310485669879067e-7          , -4.51318330186745256e-8         , 5.29059653253466397e-9          , -5.53360879399013278e-10        , 5.22565525794652817e-11         , -4.50059961384123622e-12        , 3.6260153443509228e-13          , -2.65299053176043879e-14        , },
+/* x = 6.0         */  {0.0000714988375831962141        , -0.0000625420695732420389       , 0.0000277412111758188874        , -8.29890812670376297e-6         , 1.88010400604072422e-6          , -3.43547861428412924e-7         , 5.26804612426263955e-8          , -6.96606473951405477e-9         , 8.10246988302147766e-10         , -8.41585682652755379e-11        , 7.8980960349801953e-12          , -6.7641022559773615e-13         , 5.42114456694078338e-14         , -3.94817675274345607e-15        , },
+/* x = 8.0         */  {0.0000127275314858580921        , -0.0000108210268366540373       , 4.68772001397117199e-6          , -1.37479589558950767e-6         , 3.06255167815478649e-7          , -5.51593929718229132e-8         , 8.35336773125382999e-9          , -1.09263572633252087e-9         , 1.25880139603526074e-10         , -1.29649573004759627e-11        , 1.20763257428712567e-12         , -1.02731587419081044e-13        , 8.18241293161080427e-15         , -5.92689461434442569e-16        , },
+/* x = 10.0        */  {2.39437333632205808e-6          , -1.96171057353662645e-6         , 8.2419283398272898e-7           , -2.3561729985420525e-7          , 5.13695397409988244e-8          , -9.08446010760659704e-9         , 1.35435805250324772e-9          , -1.74769100278120856e-10        , 1.98986868589937699e-11         , -2.02836860389887051e-12        , 1.87218239536868848e-13         , -1.57977952199391671e-14        , 1.24892778689755035e-15         , -8.98825014866562487e-17        , },
+/* x = 12.0        */  {4.82522818753304957e-7          , -3.77028502378906467e-7         , 1.52296926100939381e-7          , -4.21339250440625709e-8         , 8.93682796686627088e-9          , -1.54411485343074288e-9         , 2.25691931496832414e-10         , -2.86332697112498316e-11        , 3.21259659239279174e-12         , -3.2331896334924068e-13         , 2.95103758099539795e-14         , -2.46568871512514567e-15        , 1.9318374554489767e-16          , -1.3795524588388552e-17         , },
+/* x = 14.0        */  {1.05621652985833089e-7          , -7.78213001381333751e-8         , 2.99212130537945564e-8          , -7.94182242565723768e-9         , 1.62677312595833679e-9          , -2.72917220902046723e-10        , 3.89050927666782686e-11         , -4.8315433386387624e-12         , 5.32230822423369807e-13         , -5.2720710188013586e-14         , 4.74600031626582921e-15         , -3.91775389921176547e-16        , 3.036074141988582e-17           , -2.14784198344591753e-18        , },
+/* x = 16.0        */  {2.54092560423361903e-8          , -1.74656477608986196e-8         , 6.32607518171166105e-9          , -1.59565187917367929e-9         , 3.12980235713150615e-10         , -5.06080807587380215e-11        , 6.99160789920473585e-12         , -8.45337637228265123e-13        , 9.10074470800016758e-14         , -8.83834598022529622e-15        , 7.82137601832690599e-16         , -6.36084717874021711e-17        , 4.86366963989911282e-18         , -3.40162285767047535e-19        , },
+/* x = 18.0        */  {6.76399165996222238e-9          , -4.30255250161890233e-9         , 1.45481738297591926e-9          , -3.45511455153801893e-10        , 6.43227348922044564e-11         , -9.94315999932318005e-12        , 1.32158170496651118e-12         , -1.54574666973269693e-13        , 1.61735184238069061e-14         , -1.53261944478160971e-15        , 1.32779790824741852e-16         , -1.06013656215569151e-17        , 7.97351781362451265e-19         , -5.49908060280670695e-20        , },
+/* x = 20.0        */  {1.99331566716952873e-9          , -1.16844370562969112e-9         , 3.66544333442974842e-10         , -8.13544257813549721e-11        , 1.42595904292190216e-11         , -2.09034515419188171e-12        , 2.65251110603877465e-13         , -2.97998561436657694e-14        , 3.01115298233177804e-15         , -2.76855283996242341e-16        , 2.33667925469827937e-17         , -1.82377859224227381e-18        , 1.34419294008883013e-19         , -9.11260637956634184e-21        , },
+/* x = 22.0        */  {6.46844051777954178e-10         , -3.49314836915909467e-10        , 1.01400889134917714e-10         , -2.09370752663341372e-11        , 3.43449022032760523e-12         , -4.74184322133948921e-13        , 5.70336761155428402e-14         , -6.11093140112456913e-15        , 5.92297744044738727e-16         , -5.25098927591571124e-17        , 4.29330453510159899e-18         , -3.25937597229067943e-19        , 2.34354929491627979e-20         , -1.55571841871740202e-21        , },
+/* x = 24.0        */  {2.29095789395621769e-10         , -1.14270135820511604e-10        , 3.07140572328882917e-11         , -5.89175791880852864e-12        , 9.01649190864404426e-13         , -1.16703035883208336e-13        , 1.32295779485858559e-14         , -1.34344449511427855e-15        , 1.24097032431029591e-16         , -1.05411886601319535e-17        , 8.29918339010459344e-19         , -6.09451091434741183e-20        , 4.25309493633449776e-21         , -2.75228709678223195e-22        , },
+/* x = 26.0        */  {8.76714173672394004e-11         , -4.05538130623045542e-11        , 1.01210502209785183e-11         , -1.80599192592659008e-12        , 2.57743031949503103e-13         , -3.12118753838607534e-14        , 3.32331141102834733e-15         , -3.18391707760214312e-16        , 2.78804594936865e-17            , -2.2561388709887238e-18         , 1.70049334125168363e-19         , -1.20107002988656453e-20        , 8.09063898151514827e-22         , -5.07861737996657793e-23        , },
+/* x = 28.0        */  {3.59032377117212594e-11         , -1.54711478660050654e-11        , 3.59885022256377833e-12         , -5.99077432022877799e-13        , 7.98664050227504631e-14         , -9.05169916857395516e-15        , 9.04280888795007381e-16         , -8.1539669930575812e-17         , 6.74478110807958118e-18         , -5.17676866759014604e-19        , 3.71682003190773448e-20         , -2.51172948139578513e-21        , 1.62443652462906318e-22         , -9.84027464217439023e-24        , },
+/* x = 30.0        */  {1.56008635374557304e-11         , -6.29011554298884774e-12        , 1.36934431362591954e-12         , -2.13407380159189881e-13        , 2.66527875931159232e-14         , -2.83260524229334406e-15        , 2.65737393387310353e-16         , -2.2544864915867521e-17         , 1.75891048822131392e-18         , -1.27708853506990187e-19        , 8.70367946419447641e-21         , -5.60381888680403382e-22        , 3.46331582278565932e-23         , -2.01482236731205581e-24        , },
+/* x = 32.0        */  {7.14106613395357964e-12         , -2.70487870398021799e-12        , 5.53235349403945042e-13         , -8.10176549981911845e-14        , 9.5104955451550134e-15          , -9.50461311315356338e-16        , 8.39073783691959284e-17         , -6.70584918718645511e-18        , 4.93567758735826266e-19         , -3.38732832432505136e-20        , 2.18733077856450034e-21         , -1.33810186808111842e-22        , 7.87518711644107901e-24         , -4.38228802063604145e-25        , },
+/* x = 34.0        */  {3.42248477871125596e-12         , -1.22230698508721977e-12        , 2.3572612918342079e-13          , -3.25511547165771215e-14        , 3.60350253905297401e-15         , -3.39683749911183877e-16        , 2.82944690010118227e-17         , -2.1347339640351366e-18         , 1.48445593923423596e-19         , -9.63592325799056573e-21        , 5.89413885733802426e-22         , -3.42206392482895533e-23        , 1.9140621322627952e-24          , -1.01596620964298739e-25        , },
+/* x = 36.0        */  {1.70872345722670181e-12         , -5.77270285137720104e-13        , 1.05312245731366103e-13         , -1.37568128872589561e-14        , 1.44069924918599351e-15         , -1.28485188612505913e-16        , 1.01267353907915293e-17         , -7.23109449630381895e-19        , 4.76086828769712824e-20         , -2.92768718727651646e-21        , 1.69798705500730634e-22         , -9.35802028737284819e-24        , 4.9717752638237968e-25          , -2.51364518647767069e-26        , },
+},
+/* n = 13 */
+{
+/* x = 0.0         */  {0.0146293507233682138           , -0.0135565141797495978          , 0.00631486751032300426          , -0.00197019537238680314         , 0.000462900886706675421         , -0.0000873220985402563482       , 0.0000137713029205308314        , -1.86693922061349476e-6         , 2.22035001949460657e-7          , -2.35277804324373965e-8         , 2.24821311597878289e-9          , -1.95720472981333013e-10        , 1.59293709989685329e-11         , -1.17598989415474687e-12        , },
+/* x = 2.0         */  {0.00231548375863304701          , -0.00212183218587138193         , 0.000978838751867035343         , -0.00030280372910833466         , 0.000070611597193858102         , -0.0000132314906573417966       , 2.07424770629275859e-6          , -2.7968940356757092e-7          , 3.31016847775294309e-8          , -3.49208593013287205e-9         , 3.32342021646540729e-10         , -2.88252674463918178e-11        , 2.33779820715061621e-12         , -1.72048650188086409e-13        , },
+/* x = 4.0         */  {0.000375049623956730121         , -0.000338839284774624149        , 0.00015441961296891087          , -0.0000472678167498010166       , 0.0000109211696560630379        , -2.02986292648240285e-6         , 3.15922830563725381e-7          , -4.23247247816927611e-8         , 4.98024912958318768e-9          , -5.22652569866329124e-10        , 4.95054077600091603e-11         , -4.27525267793996662e-12        , 3.45320766308652699e-13         , -2.53219117603802462e-14        , },
+/* x = 6.0         */  {0.0000625420695732420545        , -0.0000554824223516441879       , 0.0000248967243801099811        , -7.52041602395767938e-6         , 1.71773930715950251e-6          , -3.16082769302716019e-7         , 4.87624530928965221e-8          , -6.48196887038805282e-9         , 7.57427293748611172e-10         , -7.89938597365390102e-11        , 7.44033710624668556e-12         , -6.39279701426007766e-13        , 5.13900706323602349e-14         , -3.75254886896207984e-15        , },
+/* x = 8.0         */  {0.0000108210268366540396        , -9.37544002794330195e-6         , 4.12438768676832852e-6          , -1.22502067123125983e-6         , 2.75796964861707696e-7          , -5.01202066634158549e-8         , 7.64845007188062494e-9          , -1.00704006580773262e-9         , 1.16684642376471908e-10         , -1.20782526137438729e-11        , 1.13002138213694208e-12         , -9.65073224177736862e-14        , 7.71444644335662821e-15         , -5.60544253851988332e-16        , },
+/* x = 10.0        */  {1.96171057353662679e-6          , -1.64838566796560239e-6         , 7.06851899562586582e-7          , -2.05478158959373541e-7         , 4.54223005384218845e-8          , -8.12614835661529701e-9         , 1.2233837000801292e-9           , -1.59189336411718987e-10        , 1.82553214351972502e-11         , -1.8724729057925043e-12         , 1.7377183620319113e-13          , -1.47335970728949754e-14        , 1.16989477974097028e-15         , -8.45121232918762744e-17        , },
+/* x = 12.0        */  {3.7702850237890652e-7           , -3.04593852201900775e-7         , 1.26401775132183295e-7          , -3.57473118667606455e-8         , 7.72057426721261931e-9          , -1.35415159532093634e-9         , 2.0043288769600516e-10          , -2.57007485869828808e-11        , 2.90987127602244045e-12         , -2.95148037058537273e-13        , 2.71219834510861471e-14         , -2.27956149141370045e-15        , 1.79557243391034918e-16         , -1.28811517083571943e-17        , },
+/* x = 14.0        */  {7.78213001381333831e-8          , -5.98424261075925116e-8         , 2.3825467276971036e-8           , -6.50709250372458753e-9         , 1.36458610451926024e-9          , -2.33430557578906185e-10        , 3.38208033271435183e-11         , -4.25784285048572792e-12        , 4.74486484537447569e-13         , -4.74668394815809443e-14        , 4.30943850703709786e-15         , -3.58362655069769785e-16        , 2.79549574560129846e-17         , -1.98874732295335151e-18        , },
+/* x = 16.0        */  {1.74656477608986208e-8          , -1.26521503634238549e-8         , 4.78695563752093269e-9          , -1.25192094283555165e-9         , 2.53040403795092567e-10         , -4.19496475486857242e-11        , 5.91736345386605222e-12         , -7.28058992040740793e-13        , 7.95451282473211786e-14         , -7.82244778366003053e-15        , 6.99679084929989337e-16         , -5.74286768426079321e-17        , 4.42723870822054347e-18         , -3.1178627872714058e-19         , },
+/* x = 18.0        */  {4.30255250161890253e-9          , -2.90963476595192361e-9         , 1.03653436546138907e-9          , -2.57290939566095231e-10        , 4.97157999968374081e-11         , -7.92949025430241787e-12        , 1.08202266774965031e-12         , -1.29388054044356934e-13        , 1.37935772814006578e-14         , -1.32796904276099527e-15        , 1.16612794101315004e-16         , -9.41886761904607393e-18        , 7.15690564114349154e-19         , -4.97845857677804137e-20        , },
+/* x = 20.0        */  {1.16844370562969116e-9          , -7.33088666885963572e-10        , 2.4406327734406224e-10          , -5.70383617164316806e-11        , 1.04517257709950882e-11         , -1.59150666762291567e-12        , 2.08598992834398029e-13         , -2.40892086218889624e-14        , 2.49169792295694556e-15         , -2.33695859539474836e-16        , 2.0061205679250839e-17          , -1.58865270368748399e-18        , 1.1859436853951623e-19          , -8.12627480637072403e-21        , },
+/* x = 22.0        */  {3.49314836915909472e-10         , -2.02801778269837756e-10        , 6.28112257990019702e-11         , -1.37379608812359373e-11        , 2.37092161067562868e-12         , -3.42202057363609717e-13        , 4.2776519779628415e-14          , -4.73837939863343261e-15        , 4.7258909535434754e-16          , -4.29377271792242049e-17        , 3.58525439251807592e-18         , -2.77139956226420477e-19        , 2.02458583530249386e-20         , -1.36198638784436593e-21        , },
+/* x = 24.0        */  {1.14270135820511605e-10         , -6.14281144657769861e-11        , 1.76752737564255111e-11         , -3.60659676344473241e-12        , 5.83515179417039786e-13         , -7.93774678074827214e-14        , 9.40411146100904756e-15         , -9.92775817666955842e-16        , 9.48707082074067171e-17         , -8.29999332245288916e-18        , 6.70386162497282946e-19         , -5.0330289186592254e-20         , 3.58162343706503084e-21         , -2.35616683140573044e-22        , },
+/* x = 26.0        */  {4.05538130623045543e-11         , -2.02421004419571089e-11        , 5.4179757777797571e-12          , -1.03097212779569793e-12        , 1.56059376919478849e-13         , -1.99398684870004311e-14        , 2.22874195348110504e-15         , -2.23043596595788471e-16        , 2.03052516397452652e-17         , -1.70063882304148627e-18        , 1.32115942459587758e-19         , -9.58180085217223761e-21        , 6.60860560462688109e-22         , -4.23219752153134371e-23        , },
+/* x = 28.0        */  {1.54711478660050654e-11         , -7.19770044512757024e-12        , 1.797232296068631e-12           , -3.19465620090567429e-13        , 4.52584958429017248e-14         , -5.42568533667985435e-15        , 5.7077768936067553e-16          , -5.39582339701221228e-17        , 4.65909212944931743e-18         , -3.71709309800738868e-19        , 2.7628702979794e-20             , -1.92549260631232694e-21        , 1.28040412369953052e-22         , -7.94374108084962283e-24        , },
+/* x = 30.0        */  {6.29011554298884775e-12         , -2.73868862725184176e-12        , 6.40222140477569185e-13         , -1.06611150372377942e-13        , 1.41630262114728229e-14         , -1.59442436109562305e-15        , 1.57814054381780436e-16         , -1.4071280965728876e-17         , 1.1493797443319357e-18          , -8.70421847182763428e-20        , 6.16413940132762657e-21         , -4.10893832117628651e-22        , 2.62150086502605922e-23         , -1.56802220555015614e-24        , },
+/* x = 32.0        */  {2.70487870398021799e-12         , -1.10647069880789064e-12        , 2.43052964994573461e-13         , -3.80419821806021509e-14        , 4.75230655657800907e-15         , -5.03444270376299704e-16        , 4.69409443044137714e-17         , -3.94854145608038905e-18        , 3.04859561813713996e-19         , -2.18744330970503113e-20        , 1.47189971097339788e-21         , -9.35201554435696652e-23        , 5.70146312349317443e-24         , -3.27363317907760976e-25        , },
+/* x = 34.0        */  {1.22230698508721977e-12         , -4.71452258366841703e-13        , 9.7653464149731345e-14          , -1.44140101562079256e-14        , 1.69841874955618062e-15         , -1.69766814041804957e-16        , 1.49431377469920097e-17         , -1.18756461525778651e-18        , 8.67233120089431667e-20         , -5.89438842827549894e-21        , 3.76424404414844956e-22         , -2.27509382235392711e-23        , 1.32171146029593086e-24         , -7.2602454538090438e-26         , },
+/* x = 36.0        */  {5.77270285137720104e-13         , -2.10624491462732235e-13        , 4.12704386617768638e-14         , -5.7627969967430363e-15         , 6.42425943062588615e-16         , -6.07604123531886804e-17        , 5.06176614712924253e-18         , -3.80869430865276395e-19        , 2.63491852928402074e-20         , -1.69804599757939122e-21        , 1.02937629306243394e-22         , -5.91468952640539135e-24        , 3.26989821463164827e-25         , -1.71469300610549362e-26        , },
+},
+/* n = 14 */
+{
+/* x = 0.0         */  {0.0135565141797496025           , -0.0126297350206479427          , 0.0059105861171600104           , -0.00185160354676480719         , 0.000436610492706601913         , -0.0000826278180802354171       , 0.0000130685745187576381        , -1.7762778934988136e-6          , 2.1175007861370497e-7           , -2.24860216707191902e-8         , 2.15287169706556014e-9          , -1.87757096992979883e-10        , 1.53073252527764395e-11         , -1.13178499821417053e-12        , },
+/* x = 2.0         */  {0.00212183218587138262          , -0.00195767750373435284         , 0.000908411187324945929         , -0.000282446388766403464        , 0.0000661574532874829824        , -0.0000124454863190170469       , 1.95782582125779878e-6          , -2.64813168656443695e-7         , 3.14287813323337031e-8          , -3.32398775008361878e-9         , 3.17070157686629902e-10         , -2.75582764190046381e-11        , 2.23946307923788474e-12         , -1.65100688934252132e-13        , },
+/* x = 4.0         */  {0.000338839284774624251         , -0.000308839225937863128        , 0.000141803450249394561         , -0.0000436846786229277129       , 0.0000101493146325252016        , -1.89553699530229926e-6         , 2.96273072928550207e-7          , -3.9841947627343676e-8          , 4.70387429300936363e-9          , -4.95137328023438275e-10        , 4.70266411163248169e-11         , -4.07119428078310071e-12        , 3.29598795072148992e-13         , -2.42183049735772264e-14        , },
+/* x = 6.0         */  {0.0000554824223516442027        , -0.0000497934487602260721       , 0.0000225612480718717894        , -6.8709572284424935e-6          , 1.58041384653022989e-6          , -2.92574720317027886e-7         , 4.53737820127973397e-8          , -6.05941164656506767e-9         , 7.109449088839155e-10           , -7.44156606728066402e-11        , 7.0319092662897749e-12          , -6.05955369473601736e-13        , 4.88440259860745021e-14         , -3.57515937157369445e-15        , },
+/* x = 8.0         */  {9.37544002794330415e-6          , -8.24877537353756561e-6         , 3.67506201369359457e-6          , -1.10318785941775643e-6         , 2.50601033319545022e-7          , -4.58907006929529391e-8         , 7.0492804488185411e-9           , -9.33476142176767704e-10        , 1.08704298885667486e-10         , -1.13020413522166133e-11        , 1.06155574822227328e-12         , -9.09784213081842897e-14        , 7.29609289034394621e-15         , -5.31645337365082938e-16        , },
+/* x = 10.0        */  {1.64838566796560272e-6          , -1.41370379912530942e-6         , 6.16434476878093021e-7          , -1.81689202149327214e-7         , 4.06307417834445024e-8          , -7.3403022397236944e-9          , 1.11432535311554968e-9          , -1.46042421984743e-10           , 1.68522599374537474e-11         , -1.73799243956274798e-12        , 1.62065866598885144e-13         , -1.37995424208887284e-14        , 1.1000034947796951e-15          , -7.97316453343049926e-17        , },
+/* x = 12.0        */  {3.04593852201900825e-7          , -2.52803550264387228e-7         , 1.0724193560027778e-7           , -3.0882297068190045e-8          , 6.77075797666010808e-9          , -1.20259733211992089e-9         , 1.79905239842833636e-10         , -2.32789475647892984e-11        , 2.65633290362654183e-12         , -2.71261347392940957e-13        , 2.50746189747266943e-14         , -2.11845749633213953e-15        , 1.67657674326465595e-16         , -1.20764747867598272e-17        , },
+/* x = 14.0        */  {5.98424261075925191e-8          , -4.76509345539452347e-8         , 1.95212775111731299e-8          , -5.45834441797583728e-9         , 1.16715278790296741e-9          , -2.02924820873694334e-10        , 2.98048999129049696e-11         , -3.79588840645872546e-12        , 4.27201642109498242e-13         , -4.31007464452719828e-14        , 3.94190435883705129e-15         , -3.29907744104006678e-16        , 2.58845686276358757e-17         , -1.85058178938304595e-18        , },
+/* x = 16.0        */  {1.26521503634238561e-8          , -9.57391127504235675e-9         , 3.75576282850655742e-9          , -1.01216161516464659e-9         , 2.09748237744728857e-10         , -3.55041808647094017e-11        , 5.09641293804405414e-12         , -6.36360486881090029e-13        , 7.04020434267933007e-14         , -6.997779194678793e-15          , 6.31702368612395274e-16         , -5.22643085316068521e-17        , 4.05797677119536519e-18         , -2.87518655679889844e-19        , },
+/* x = 18.0        */  {2.90963476595192379e-9          , -2.07306873092285574e-9         , 7.7187281869827044e-10          , -1.98863199984866243e-10        , 3.96474512717154658e-11         , -6.49213602884840771e-12        , 9.05716377334291574e-13         , -1.10348533106420984e-13        , 1.19517234767210284e-14         , -1.16628403978432787e-15        , 1.0360549842348187e-16          , -8.45205511452607989e-18        , 6.47943391717488219e-19         , -4.54105516153699859e-20        , },
+/* x = 20.0        */  {7.33088666885963601e-10         , -4.88126554688136981e-10        , 1.71115085149292614e-10         , -4.18069030835803464e-11        , 7.95753333814695434e-12         , -1.25159396060644505e-12        , 1.68624460197818052e-13         , -1.99335696691531937e-14        , 2.10326306886531277e-15         , -2.00637200046854761e-16        , 1.74748541307461756e-17         , -1.40118921868099805e-18        , 1.05759976052327855e-19         , -7.31440126439890418e-21        , },
+/* x = 22.0        */  {2.02801778269837761e-10         , -1.25622451598006002e-10        , 4.12138826437074171e-11         , -9.48368644263654978e-12        , 1.71101028682331211e-12         , -2.56659119271454919e-13        , 3.31686557651691052e-14         , -3.78071050117981032e-15        , 3.86439598752138748e-16         , -3.58566902926257629e-17        , 3.04848658246129727e-18         , -2.39331652284295966e-19        , 1.77250725071869279e-20         , -1.20621598400109909e-21        , },
+/* x = 24.0        */  {6.14281144657769869e-11         , -3.53505475128513718e-11        , 1.08197902903341314e-11         , -2.33406071765696998e-12        , 3.96887339038291103e-13         , -5.64246688667567321e-14        , 6.94943071945671209e-15         , -7.58965282030885048e-16        , 7.4699948927744863e-17          , -6.70456494364876028e-18        , 5.53624355954073343e-19         , -4.2365675854877107e-20         , 3.06622600753343145e-21         , -2.04601796634421018e-22        , },
+/* x = 26.0        */  {2.02421004419571091e-11         , -1.08359515555595755e-11        , 3.09291638338708249e-12         , -6.24237507675952723e-13        , 9.96993424351528914e-14         , -1.33724517385506957e-14        , 1.56130517544698769e-15         , -1.62441945826284041e-16        , 1.53057509577982602e-17         , -1.32128279267235802e-18        , 1.05398293402897128e-19         , -7.82266004062386472e-21        , 5.50736939979978562e-22         , -3.58888949761308635e-23        , },
+/* x = 28.0        */  {7.19770044512757026e-12         , -3.59446459213727319e-12        , 9.58396860271700276e-13         , -1.81033983371248765e-13        , 2.71284266834260978e-14         , -3.42466613938725599e-15        , 3.77707637662089759e-16         , -3.7272724756726691e-17         , 3.34538406413186577e-18         , -2.76309541055662064e-19        , 2.11801488758911063e-20         , -1.51683875988199832e-21        , 1.03366740794496028e-22         , -6.54872951914610414e-24        , },
+/* x = 30.0        */  {2.73868862725184177e-12         , -1.28044428095514051e-12        , 3.19833451117133452e-13         , -5.66521048458228878e-14        , 7.97212180548309053e-15         , -9.46884326906314891e-16        , 9.84989667362207103e-17         , -9.19503560938967267e-18        , 7.83379713638961992e-19         , -6.16456936672665861e-20        , 4.51978211602956233e-21         , -3.10827678502483883e-22        , 2.04024840410076037e-23         , -1.25080843354774095e-24        , },
+/* x = 32.0        */  {1.10647069880789064e-12         , -4.86105929989147353e-13        , 1.1412594654180638e-13          , -1.90092262262982792e-14        , 2.51722135188246584e-15         , -2.81645665950295837e-16        , 2.76397901879195825e-17         , -2.43887602284034652e-18        , 1.96869907823040382e-19         , -1.47198618369039618e-20        , 1.0287119813936319e-21          , -6.76628864972056562e-23        , 4.25926076394068064e-24         , -2.51556994904145672e-25        , },
+/* x = 34.0        */  {4.71452258366841703e-13         , -1.95306928299462781e-13        , 4.32420304686237619e-14         , -6.79367499822179457e-15        , 8.48834070209223009e-16         , -8.96588265083034427e-17        , 8.31295230585302835e-18         , -6.93786395685319583e-19        , 5.30494978933592234e-20         , -3.76442808556232605e-21        , 2.50258326887637561e-22         , -1.56999195623498712e-23        , 9.44556844011328734e-25         , -5.35393204004330193e-26        , },
+/* x = 36.0        */  {2.10624491462732235e-13         , -8.25408773235537483e-14        , 1.72883909902291057e-14         , -2.56970377224969269e-15        , 3.03802061765986399e-16         , -3.03705968887313647e-17        , 2.66608601585055058e-18         , -2.10793459653542669e-19        , 1.52824144204663428e-20         , -1.0294178898905821e-21         , 6.50611523664556962e-23         , -3.8875751711741274e-24         , 2.23067335885935508e-25         , -1.21008954612835087e-26        , },
+},
+/* n = 15 */
+{
+/* x = 0.0         */  {0.0126297350206479473           , -0.0118211722343218849          , 0.00555481064029403651          , -0.00174644197076675565         , 0.000413139090406311215         , -0.0000784114476494138566       , 0.0000124339452298478741        , -1.69399858369810386e-6         , 2.02374247844660844e-7          , -2.15324665251380807e-8         , 2.0652764322499382e-9           , -1.80415564575880791e-10        , 1.47319812214534936e-11         , -1.09077948581216103e-12        , },
+/* x = 2.0         */  {0.00195767750373435351          , -0.00181682237465016306         , 0.000847339166299154513         , -0.000264629813141253568        , 0.0000622274315958302931        , -0.0000117469550056520437       , 1.8536921770188237e-6           , -2.51429953114856034e-7         , 2.99158974142143487e-8          , -3.1712470738578829e-9          , 3.03133547446422068e-10         , -2.63974868491086844e-11        , 2.14903374255580526e-12         , -1.5869003391531081e-13         , },
+/* x = 4.0         */  {0.000308839225937863225         , -0.00028360690049882878         , 0.000131054035868774991         , -0.000040597258528831717        , 9.47768497662014014e-6          , -1.77763844899310453e-6         , 2.78893632869915386e-7          , -3.76309508324433193e-8         , 4.45623706969025761e-9          , -4.70346182487829455e-10        , 4.47820444421745974e-11         , -3.88556693032212029e-12        , 3.15235290634507744e-13         , -2.32062035145558706e-14        , },
+/* x = 6.0         */  {0.0000497934487602260863        , -0.0000451224961437494126       , 0.0000206128716853262858        , -6.32165538593423847e-6         , 1.46287360160106856e-6          , -2.72242693756914029e-7         , 4.24158814494956681e-8          , -5.68755287057612059e-9         , 6.69741109897700477e-10         , -7.03308269041039988e-11        , 6.66534886271203037e-12         , -5.75887519507439621e-13        , 4.65353269204902929e-14         , -3.41359744181813492e-15        , },
+/* x = 8.0         */  {8.24877537353756771e-6          , -7.35012402738805308e-6         , 3.30956357825309303e-6          , -1.00240413325053382e-6         , 2.29453503467114802e-7          , -4.22956829417276823e-8         , 6.53433298395686456e-9          , -8.69633443213203673e-10        , 1.01718396342469585e-10         , -1.06172952478057866e-11        , 1.0007389990370746e-12          , -8.60365192661895139e-14        , 6.91998405954701887e-15         , -5.05531805979280222e-16        , },
+/* x = 10.0        */  {1.41370379912530974e-6          , -1.23286895375631499e-6         , 5.4506760644795545e-7           , -1.6252296712965179e-7          , 3.6701511198967689e-8           , -6.68595215582927301e-9         , 1.02229695221695949e-9          , -1.34817938029249251e-10        , 1.56419355480108138e-11         , -1.62091802835351857e-12        , 1.5179145450471808e-13          , -1.29736893281922995e-14        , 1.03778852573066775e-15         , -7.54508697213472333e-17        , },
+/* x = 12.0        */  {2.52803550264387275e-7          , -2.14483871200574979e-7         , 9.26468912045662108e-8          , -2.70830319060189971e-8         , 6.01298666065192876e-9          , -1.0794314446499184e-9          , 1.6295263270236851e-10          , -2.12506419226634197e-11        , 2.44135266472913712e-12         , -2.50785251386944219e-13        , 2.33025062268221127e-14         , -1.97780193365378282e-15        , 1.57185529621122159e-16         , -1.13633860879347712e-17        , },
+/* x = 14.0        */  {4.76509345539452418e-8          , -3.90425550223492156e-8         , 1.63750332539269182e-8          , -4.66861115151728171e-9         , 1.01462410437638763e-9          , -1.78829400328721082e-10        , 2.65712188072144729e-11         , -3.4176098938616458e-12         , 3.8790679942874501e-13          , -3.94249891146607709e-14        , 3.62890557320906833e-15         , -3.05426000587405376e-16        , 2.40865130565269155e-17         , -1.72960764807504413e-18        , },
+/* x = 16.0        */  {9.57391127504235784e-9          , -7.5115256570135704e-9          , 3.03648484549384893e-9          , -8.38992950964337693e-10        , 1.77520904324758214e-10         , -3.05784777594639268e-11        , 4.45452340235384277e-12         , -5.6321584760633898e-13         , 6.29800252102250622e-14         , -6.317940000804233e-15          , 5.74895212578770717e-16         , -4.789602844246343e-17          , 3.74217207616753377e-18         , -2.66564270626984059e-19        , },
+/* x = 18.0        */  {2.07306873092285591e-9          , -1.54374563739661213e-9         , 5.96589599954584642e-10         , -1.58589805084581725e-10        , 3.24606801444298526e-11         , -5.43429828452699693e-12        , 7.72439730843439337e-13         , -9.5613709637587347e-14         , 1.04965582898608414e-14         , -1.03619830723309882e-15        , 9.29707173868272562e-17         , -7.65023881120175534e-18        , 5.91024033894218039e-19         , -4.16939631360344286e-20        , },
+/* x = 20.0        */  {4.88126554688137007e-10         , -3.4223017029859657e-10         , 1.2542070925073882e-10          , -3.1830133352224844e-11         , 6.2579698030618129e-12          , -1.01174676445366888e-12        , 1.39534987542051554e-13         , -1.68260921061203177e-14        , 1.80573510475198267e-15         , -1.74771356778133282e-16        , 1.54127838380964864e-17         , -1.2492080291327849e-18         , 9.51954227624556204e-20         , -6.63722783171645298e-21        , },
+/* x = 22.0        */  {1.25622451598006006e-10         , -8.24277652874166782e-11        , 2.84510593279092931e-11         , -6.84404114723423941e-12        , 1.28329559636202438e-12         , -1.99011935122095863e-13        , 2.64649734854596919e-14         , -3.09151476685051049e-15        , 3.22710261488589698e-16         , -3.04885749633787087e-17        , 2.63260040583515407e-18         , -2.09463803527055389e-19        , 1.56981784436875828e-20         , -1.07902218639591541e-21        , },
+/* x = 24.0        */  {3.53505475128513725e-11         , -2.16395805806685703e-11        , 7.00218215297085146e-12         , -1.58754935614332714e-12        , 2.82123344334563479e-13         , -4.16965844052757039e-14        , 5.3127569704730664e-15          , -5.9759925414412524e-16         , 6.03410925138294122e-17         , -5.53686190223578404e-18        , 4.66014591657313334e-19         , -3.6255067556538833e-20         , 2.66267526400559788e-21         , -1.79881511287448132e-22        , },
+/* x = 26.0        */  {1.08359515555595756e-11         , -6.18583276677421778e-12        , 1.87271252302784831e-12         , -3.98797369738921779e-13        , 6.68622586928849806e-14         , -9.36783106789000494e-15        , 1.13709362015277836e-15         , -1.22445949726847726e-16        , 1.18915464866439217e-17         , -1.05408914918262427e-18        , 8.60479379117785473e-20         , -6.51614641838985974e-21        , 4.67036556538415605e-22         , -3.08989537899609992e-23        , },
+/* x = 28.0        */  {3.59446459213727321e-12         , -1.91679372054340995e-12        , 5.4310195011374458e-13          , -1.08513706733403675e-13        , 1.71233306969591696e-14         , -2.26624582867898065e-15        , 2.60909073187216707e-16         , -2.67630622027993107e-17        , 2.4867861049369513e-18          , -2.11820390894206105e-19        , 1.66849961546202068e-20         , -1.22390448054918824e-21        , 8.52171943240901504e-23         , -5.49880299492136583e-24        , },
+/* x = 30.0        */  {1.28044428095514051e-12         , -6.39666902234268646e-13        , 1.69956314537468353e-13         , -3.18884872218765922e-14        , 4.73442163453570958e-15         , -5.90993800919253259e-16        , 6.43652492458791115e-17         , -6.26703579700123267e-18        , 5.5481128553810764e-19          , -4.5201326696144936e-20         , 3.41906287599025445e-21         , -2.41770431750872849e-22        , 1.62756323768727304e-23         , -1.01979224707279858e-24        , },
+/* x = 32.0        */  {4.86105929989147353e-13         , -2.28251893083613099e-13        , 5.70276786788947793e-14         , -1.00688854075190208e-14        , 1.40822832975225896e-15         , -1.65838741225100357e-16        , 1.70721321561394823e-17         , -1.57495889084008797e-18        , 1.32478764552728562e-19         , -1.02878013450339855e-20        , 7.44283909111754868e-22         , -5.05163383911428777e-23        , 3.27309270012020279e-24         , -1.98263592048429985e-25        , },
+/* x = 34.0        */  {1.95306928299462782e-13         , -8.64840609372475933e-14        , 2.03810249946653721e-14         , -3.39533628083467028e-15        , 4.4829413254167156e-16          , -4.98777138551139419e-17        , 4.85650476905637239e-18         , -4.2439590697250523e-19         , 3.38798543576281248e-20         , -2.50272292188539743e-21        , 1.72697562897929151e-22         , -1.121280313844417e-23          , 6.96575633539968369e-25         , -4.06263298972582645e-26        , },
+/* x = 36.0        */  {8.25408773235537483e-14         , -3.45767819804582264e-14        , 7.70911131674907566e-15         , -1.2152082470634637e-15         , 1.51852984443689045e-16         , -1.5996516099440344e-17         , 1.475554217420133e-18           , -1.22259298841671545e-19        , 9.26476134044170529e-21         , -6.50641814106418655e-22        , 4.27630028214816255e-23         , -2.65037273591556659e-24        , 1.57429481518058644e-25         , -8.81176490521983487e-27        , },
+},
+/* n = 16 */
+{
+/* x = 0.0         */  {0.0118211722343218894           , -0.011109621280589872           , 0.0052393259122998949           , -0.00165255636156767869         , 0.00039205723825202993          , -0.0000746036718971827457       , 0.000011857990062075623         , -1.61899200906013981e-6         , 1.93792249750037136e-7          , -2.06563827672687671e-8         , 1.98452132040237659e-9          , -1.73625859222342171e-10        , 1.41982751091261317e-11         , -1.05263847836658401e-12        , },
+/* x = 2.0         */  {0.0018168223746501637           , -0.00169467833259857009         , 0.00079388943942370684          , -0.00024890972637496728         , 0.0000587347750289784159        , -0.0000111221531372979707       , 1.7600096683566453e-6           , -2.39326892894558591e-7         , 2.85412310518929581e-8          , -3.03186057625058359e-9         , 2.90365132327561581e-10         , -2.53301342607529452e-11        , 2.06559699094774859e-12         , -1.52756883305572639e-13        , },
+/* x = 4.0         */  {0.000283606900498828874         , -0.000262108071737588048        , 0.000121791775586487317         , -0.0000379107399052624102       , 8.88819224506997145e-6          , -1.67336180818284556e-6         , 2.63416655325749042e-7          , -3.56498547923668223e-8         , 4.23311671672087934e-9          , -4.47897013873016656e-10        , 4.27401857771382895e-11         , -3.71599923923240675e-12        , 3.02062629836511298e-13         , -2.22747494605620598e-14        , },
+/* x = 6.0         */  {0.0000451224961437494262        , -0.0000412257433706581529       , 0.0000189649661578015703        , -5.85149440622567275e-6         , 1.3612134687998378e-6           , -2.54495290304387246e-7         , 3.98128700207481067e-8          , -5.35792275570260372e-9         , 6.32977599175659046e-10         , -6.66647150052871552e-11        , 6.33460916560818017e-12         , -5.48626356645722168e-13        , 4.44326027340559935e-14         , -3.26585546672044876e-15        , },
+/* x = 8.0         */  {7.35012402738805509e-6          , -6.61912715650700948e-6         , 3.0072123997514331e-6           , -9.17814013842109403e-7         , 2.11478414710883086e-7          , -3.92059981408894182e-8         , 6.08743409171798704e-9          , -8.13746267317925148e-10        , 9.55556803183349524e-11         , -1.0009046263728552e-11         , 9.46379136913719715e-13         , -8.1594333784115308e-14         , 6.58012257386334746e-15         , -4.81824976816306147e-16        , },
+/* x = 10.0        */  {1.23286895375631528e-6          , -1.09013521289603326e-6         , 4.87568901388930455e-7          , -1.46806044791955306e-7         , 3.34297607794785722e-8          , -6.13378174854080216e-9         , 9.43725564610150439e-10         , -1.25135350140104827e-10        , 1.45882656721694978e-11         , -1.51816065901360059e-12        , 1.42707241555347528e-13         , -1.22386719380743737e-14        , 9.82076235383974645e-16         , -7.15967902312130862e-17        , },
+/* x = 12.0        */  {2.14483871200575023e-7          , -1.85293782409150755e-7         , 8.12490957180532757e-8          , -2.40519466420210565e-8         , 5.39715722329913413e-9          , -9.77715801494137943e-10        , 1.48754493220841822e-10         , -1.95308012038259301e-11        , 2.25706777205846174e-12         , -2.33061937948026986e-13        , 2.17553230181381458e-14         , -1.85404394398653471e-15        , 1.47905201708048487e-16         , -1.07274704889770668e-17        , },
+/* x = 14.0        */  {3.90425550223492222e-8          , -3.27500665078566098e-8         , 1.40058334545512861e-8          , -4.05849641741679799e-9         , 8.94147001651059184e-10         , -1.59427313642059668e-10        , 2.39232692212533974e-11         , -3.10325135248584271e-12        , 3.54824978699353689e-13         , -3.62946344629725229e-14        , 3.35961104277485853e-15         , -2.84169446090535694e-16        , 2.2512158947375793e-17          , -1.62290352926243057e-18        , },
+/* x = 16.0        */  {7.51152565701357141e-9          , -6.07296969098812222e-9         , 2.5169788528929281e-9           , -7.10083617285453179e-10        , 1.52892388798452696e-10         , -2.67271405363401531e-11        , 3.9425109278056771e-12          , -5.03839736092861446e-13        , 5.68614716615861454e-14         , -5.74980570550930076e-15        , 5.26844917504561526e-16         , -4.41611226115287277e-17        , 3.46947928634577626e-18         , -2.48314100827225844e-19        , },
+/* x = 18.0        */  {1.54374563739661229e-9          , -1.19317919990923509e-9         , 4.75769415253732099e-10         , -1.29842720575613727e-10        , 2.71714914228093195e-11         , -4.63463840401178437e-12        , 6.69295966626304284e-13         , -8.39723941240358972e-14        , 9.32578655825605706e-15         , -9.29839531094800828e-16        , 8.41508736130109376e-17         , -6.97677664539685729e-18        , 5.42659088116946158e-19         , -3.85039204445863934e-20        , },
+/* x = 20.0        */  {3.42230170298596594e-10         , -2.50841418501488007e-10        , 9.54904000566724912e-11         , -2.50318792119155346e-11        , 5.05873382229555364e-12         , -8.37209928237762753e-13        , 1.17782644612237961e-13         , -1.44458694648599447e-14        , 1.57294249086947575e-15         , -1.54148689166812157e-16        , 1.37410146734350003e-17         , -1.12414802368273924e-18        , 8.63834698216352017e-20         , -6.06568315557606912e-21        , },
+/* x = 22.0        */  {8.24277652874166821e-11         , -5.69021186558202503e-11        , 2.05321234417023943e-11         , -5.13318238539484724e-12        , 9.950596756147985e-13           , -1.58789841392010824e-13        , 2.16406033472214947e-14         , -2.58168026618424951e-15        , 2.74397219096291328e-16         , -2.63293512198763368e-17        , 2.30405840015650283e-18         , -1.85456982175338037e-19        , 1.40430842926401541e-20         , -9.73719716304319001e-22        , },
+/* x = 24.0        */  {2.16395805806685709e-11         , -1.40043643059419761e-11        , 4.76264806842992895e-12         , -1.12849337732951152e-12        , 2.0848292202707809e-13          , -3.18765419015199743e-14        , 4.18319477565093855e-15         , -4.82728440371298621e-16        , 4.98317643157037734e-17         , -4.66069543869037436e-18        , 3.98798707442026012e-19         , -3.14725202293841054e-20        , 2.3410180757917897e-21          , -1.5986097956102303e-22         , },
+/* x = 26.0        */  {6.18583276677421788e-12         , -3.74542504605574268e-12        , 1.19639210921675663e-12         , -2.67449034770065721e-13        , 4.68391553395660794e-14         , -6.82256173418448363e-15        , 8.57121647530871243e-16         , -9.51323213491001615e-17        , 9.48680353634969757e-18         , -8.60572043211674811e-19        , 7.16764434230110947e-20         , -5.52356819652120154e-21        , 4.0211082809762478e-22          , -2.69568273132619085e-23        , },
+/* x = 28.0        */  {1.91679372054340997e-12         , -1.08620390022749718e-12        , 3.25541120200209541e-13         , -6.84933227875800835e-14        , 1.13312291434147108e-14         , -1.56545444143265362e-15        , 1.87341435324519148e-16         , -1.98942800419589486e-17        , 1.90638372178219822e-18         , -1.66866090363415422e-19        , 1.34627500791276497e-20         , -1.00853027323015481e-21        , 7.15568778115853758e-23         , -4.69201955297566615e-24        , },
+/* x = 30.0        */  {6.39666902234268649e-13         , -3.39912629074938155e-13        , 9.56654616656295145e-14         , -1.8937686538096485e-14         , 2.95496900459976186e-15         , -3.8619149589245484e-16         , 4.38692505622299105e-17         , -4.43848869504706672e-18        , 4.06811976219700643e-19         , -3.41935423991922773e-20        , 2.65943959384996552e-21         , -1.92764776051433216e-22        , 1.32700829972684975e-23         , -8.47604157013183072e-25        , },
+/* x = 32.0        */  {2.282518930836131e-13           , -1.14055357357789832e-13        , 3.02066562225570143e-14         , -5.63291331900029517e-15        , 8.2919370612614312e-16          , -1.02432793015503087e-16        , 1.10247122328021991e-17         , -1.05982981674109332e-18        , 9.2590218701913036e-20          , -7.44338850579869803e-21        , 5.55673272286675306e-22         , -3.87976232251666416e-23        , 2.57977215695553481e-24         , -1.5982972542526394e-25         , },
+/* x = 34.0        */  {8.64840609372475934e-14         , -4.07620499893307983e-14        , 1.01860088425040016e-14         , -1.79317653016495622e-15        , 2.49388569275692715e-16         , -2.91390286299083947e-17        , 2.97077134821710783e-18         , -2.71038775546128473e-19        , 2.25245075621731071e-20         , -1.72708437295625347e-21        , 1.23339597434011923e-22         , -8.26400376804008779e-24        , 5.28592139163974417e-25         , -3.16346114798442139e-26        , },
+/* x = 36.0        */  {3.45767819804582265e-14         , -1.54182226334981626e-14        , 3.64562474119038924e-15         , -6.07411937774395035e-16        , 7.99825804972265089e-17         , -8.8533253077711192e-18         , 8.55815091772714935e-19         , -7.41180783413576178e-20        , 5.85577658192751559e-21         , -4.27652728870861262e-22        , 2.91538507913179382e-23         , -1.86934229657742527e-24        , 1.14643599678146705e-25         , -6.60382721309281988e-27        , },
+},
+/* n = 17 */
+{
+/* x = 0.0         */  {0.0111096212805898763           , -0.010478651824601528           , 0.00495766908470267619          , -0.00156822895295249858         , 0.000373018359490712223         , -0.0000711479408730439696       , 0.0000113329440403882052        , -1.55033609098989007e-6         , 1.859074942613622e-7            , -1.9848709389769961e-8          , 1.90983619230120829e-9          , -1.67328084658288762e-10        , 1.37018489986039885e-11         , -1.01707221707493918e-12        , },
+/* x = 2.0         */  {0.0016946783325985707           , -0.00158777887884766533         , 0.000746729179124849851         , -0.000234939100107860931        , 0.0000556107656871830529        , -0.0000105600580826144646       , 1.67528824693455327e-6          , -2.28329572321456889e-7         , 2.72867523163056954e-8          , -2.90415749503470359e-9         , 2.78624505263404653e-10         , -2.43454139925327419e-11        , 1.98837461201889659e-12         , -1.47249966280080381e-13        , },
+/* x = 4.0         */  {0.000262108071737588138         , -0.000243583551173011232        , 0.000113732219715779688         , -0.0000355527689791087679       , 8.36680904101479165e-6          , -1.58049994249455574e-6         , 2.49548983063861373e-7          , -3.38648935811518421e-8         , 4.03107415922797042e-9          , -4.27475470899235897e-10        , 4.08749802467541912e-11         , -3.56050737373006118e-12        , 2.89939519279046048e-13         , -2.14147281026914662e-14        , },
+/* x = 6.0         */  {0.000041225743370658166         , -0.0000379299323156084902       , 0.0000175544832186759189        , -5.44485387502816572e-6         , 1.27247645153659466e-6          , -2.38877221665157961e-7         , 3.75054592195577393e-8          , -5.06381492418881457e-9         , 5.99982585820056003e-10         , -6.33568518862544322e-11        , 6.0347425011307071e-12          , -5.23800486476194379e-13        , 4.2509729057270107e-14          , -3.13024877749251452e-15        , },
+/* x = 8.0         */  {6.6191271565070114e-6           , -6.01442479950365269e-6         , 2.7534420415261671e-6           , -8.45913658818364555e-7         , 1.96029990706595265e-7          , -3.65246047768180405e-8         , 5.69622386091423929e-9          , -7.64444579650990972e-10        , 9.00814384690642775e-11         , -9.46537334456638348e-12        , 8.97516067129232831e-13         , -7.75808377845248283e-14        , 6.27158087898854605e-15         , -4.60211033945113719e-16        , },
+/* x = 10.0        */  {1.09013521289603354e-6          , -9.75137802777977308e-7         , 4.40418134375842163e-7          , -1.33719043114189537e-7         , 3.06689087430207586e-8          , -5.66235342118366544e-9         , 8.75947449460344281e-10         , -1.1670599767159292e-10         , 1.36634491890999167e-11         , -1.42730654278575682e-12        , 1.34622205740806961e-13         , -1.15805856037074444e-14        , 9.31916665009824607e-16         , -6.81097403000837811e-17        , },
+/* x = 12.0        */  {1.85293782409150797e-7          , -1.6249819143612391e-7          , 7.21558399260596419e-8          , -2.15886288926410687e-8         , 4.88857900751772352e-9          , -8.92526964324261682e-10        , 1.36715608201019221e-10         , -1.80565231318553085e-11        , 2.09755792530857746e-12         , -2.17588145304088105e-13        , 2.03940103581025053e-14         , -1.74439104067987169e-15        , 1.39629125720111487e-16         , -1.01571266055700518e-17        , },
+/* x = 14.0        */  {3.27500665078566161e-8          , -2.80116669091051838e-8         , 1.21754892522498659e-8          , -3.5765880065206656e-9          , 7.97136568217339249e-10         , -1.43539616079660626e-10        , 2.17227594336045349e-11         , -2.83859696429867217e-12        , 3.26651782587532864e-13         , -3.36013634707037005e-14        , 3.12579309556640509e-15         , -2.65561433516772627e-16        , 2.11234954911343392e-17         , -1.52815795057896316e-18        , },
+/* x = 16.0        */  {6.07296969098812317e-9          , -5.03395770578625319e-9         , 2.13025085185627974e-9          , -6.11569555181107137e-10        , 1.33635702682764755e-10         , -2.36550656811668667e-11        , 3.52687814754288329e-12         , -4.54891337739149656e-13        , 5.17482622934697891e-14         , -5.26924768986804516e-15        , 4.85761648038202268e-16         , -4.09368657729377625e-17        , 3.2319744702498404e-18          , -2.32295221070517526e-19        , },
+/* x = 18.0        */  {1.19317919990923523e-9          , -9.51538830507525278e-10        , 3.8952816172682899e-10          , -1.086859656892827e-10          , 2.31731920202214857e-11         , -4.01577581734902392e-12        , 5.87806758087944678e-13         , -7.46062254519600235e-14        , 8.36855745193878473e-15         , -8.41631595292236566e-16        , 7.67429081712454242e-17         , -6.4046865159105339e-18         , 5.01145485095988943e-19         , -3.57408471642733342e-20        , },
+/* x = 20.0        */  {2.50841418501488029e-10         , -1.90980800113354515e-10        , 7.50956376357447166e-11         , -2.02349352888771598e-11        , 4.18604964121397469e-12         , -7.06695870418920526e-13        , 1.01121086133247165e-13         , -1.25835294679357757e-14        , 1.38733846129941139e-15         , -1.37429321604405639e-16        , 1.23653752134770845e-17         , -1.01986720581106779e-18        , 7.89458981254151109e-20         , -5.5781440161848752e-21         , },
+/* x = 22.0        */  {5.69021186558202538e-11         , -4.10642468834063018e-11        , 1.53995471561842452e-11         , -3.98023870241077064e-12        , 7.93949206964008345e-13         , -1.29843620519139244e-13        , 1.80717618443094709e-14         , -2.19517609254070729e-15        , 2.36964201650906375e-16         , -2.30436277558744754e-17        , 2.03998703573202612e-18         , -1.65860644114346141e-19        , 1.26728174743897044e-20         , -8.85455799111902851e-22        , },
+/* x = 24.0        */  {1.40043643059419767e-11         , -9.525296136860103e-12          , 3.3854801319884871e-12          , -8.3393168810046949e-13         , 1.59382709508232657e-13         , -2.5099168724491458e-14         , 3.37909907956171943e-15         , -3.98653845627242861e-16        , 4.19462654568653433e-17         , -3.98848005479702409e-18        , 3.46191358507961617e-19         , -2.76619794897801951e-20        , 2.08050692166186038e-21         , -1.43412473240427095e-22        , },
+/* x = 26.0        */  {3.74542504605574278e-12         , -2.39278421843355392e-12        , 8.02347104310189403e-13         , -1.87356621356963265e-13        , 3.41128086710258808e-14         , -5.14272989689470455e-15        , 6.65926248947080501e-16         , -7.58943836832657906e-17        , 7.74514945309213693e-18         , -7.16846214705059076e-19        , 6.07582096232710035e-20         , -4.75395788630767604e-21        , 3.50817132695027854e-22         , -2.37906836212737727e-23        , },
+/* x = 28.0        */  {1.08620390022749719e-12         , -6.51082240400426021e-13        , 2.05479968362738949e-13         , -4.53249165734367943e-14        , 7.82727220718062108e-15         , -1.12404861394555407e-15        , 1.39259960210418247e-16         , -1.52510621611559352e-17        , 1.50179499175872381e-18         , -1.34641458144302439e-19        , 1.10936584839463534e-20         , -8.46501571098202371e-22        , 6.10597165833561781e-23         , -4.0603208802740462e-24         , },
+/* x = 30.0        */  {3.39912629074938158e-13         , -1.91330923331260254e-13        , 5.68130596142892299e-14         , -1.18198760183598624e-14        , 1.93095747946527349e-15         , -2.63215503726045184e-16        , 3.10694208509328574e-17         , -3.25449446626914276e-18        , 3.07741912442608294e-19         , -2.65968590006806787e-20        , 2.12038237224080686e-21         , -1.57091414427419631e-22        , 1.1029822886610838e-23          , -7.16527179934112925e-25        , },
+/* x = 32.0        */  {1.14055357357789832e-13         , -6.04133124451142533e-14        , 1.68987399570008452e-14         , -3.31677482449738342e-15        , 5.12163965078052365e-16         , -6.61482734615146988e-17        , 7.41880871461038682e-18         , -7.40721503133383369e-19        , 6.6990502074902051e-20          , -5.55718460638843757e-21        , 4.26768455490036894e-22         , -3.05628948099962964e-23        , 2.0797500620906728e-24          , -1.31457024490040449e-25        , },
+/* x = 34.0        */  {4.07620499893307984e-14         , -2.03720176850080463e-14        , 5.37952959049486116e-15         , -9.97554277101392089e-16        , 1.45695143149642062e-16         , -1.78246281017115996e-17        , 1.89727142834247535e-18         , -1.80196013225184214e-19        , 1.55437603860862008e-20         , -1.23348264004129666e-21        , 9.09030348458529646e-23         , -6.26747014894012336e-24        , 4.11615986542702424e-25         , -2.52118403425232168e-26        , },
+/* x = 36.0        */  {1.54182226334981626e-14         , -7.29124948238078717e-15        , 1.82223581332318364e-15         , -3.19930321988628192e-16        , 4.42666265388751247e-17         , -5.13489055313687796e-18        , 5.18826548295765486e-19         , -4.68462031293692803e-20        , 3.84887476070454727e-21         , -2.91555972339727349e-22        , 2.05625688592623362e-23         , -1.36048151478680695e-24        , 8.59211730754218641e-26         , -5.08056045031783611e-27        , },
+},
+/* n = 18 */
+{
+/* x = 0.0         */  {0.0104786518246015321           , -0.00991533816940703373         , 0.00470468685885714725          , -0.00149207343790904576         , 0.000355739704369866447         , -0.0000679976647265574278       , 0.0000108523526146255564        , -1.48725810941205237e-6         , 1.78638432301517111e-7          , -1.91017438342283285e-8         , 1.8405621997334363e-9           , -1.61470701830888074e-10        , 1.32389320975160591e-11         , -9.83828717453262584e-13        , },
+/* x = 2.0         */  {0.00158777887884766593          , -0.00149345835824994259         , 0.000704817300323532552         , -0.000222443062740959746        , 0.0000528002904137422009        , -0.0000100517295515595065       , 1.59830700303478339e-6          , -2.18293752045923984e-7         , 2.61374243454869836e-8          , -2.78673360759027586e-9         , 2.67792816858201131e-10         , -2.34341201096993422e-11        , 1.91669940151705574e-12         , -1.42125078175805635e-13        , },
+/* x = 4.0         */  {0.000243583551173011319         , -0.000227464439431594613        , 0.000106658306937319032         , -0.000033467236162931605        , 7.90249971256973465e-6          , -1.49729390853122296e-6         , 2.37054254602674278e-7          , -3.22485546145676698e-8         , 3.84728023535444598e-9          , -4.08820677770380152e-10        , 3.91646060110704897e-11         , -3.41741942159881633e-12        , 2.7874604713869206e-13          , -2.06182699165787486e-14        , },
+/* x = 6.0         */  {0.0000379299323156085028        , -0.0000351089664373569739       , 0.00001633456162508344          , -5.08990580598202338e-6         , 1.19438610833988536e-6          , -2.25032756796543958e-7         , 3.54467044016630063e-8          , -4.7998550515222678e-9          , 5.70211811959209324e-10         , -6.03577559146374827e-11        , 5.76166359016135828e-12         , -5.01100687598881997e-13        , 4.07447835898681019e-14         , -3.00535369611976232e-15        , },
+/* x = 8.0         */  {6.01442479950365453e-6          , -5.50688408305308688e-6         , 2.5377409764549392e-6           , -7.84119962802295163e-7         , 1.82623023886149731e-7          , -3.4177343382258518e-8          , 5.35111204767119815e-9          , -7.20650681950296155e-10        , 8.51883812848231451e-11         , -8.97667464202544802e-12        , 8.5336850265353917e-13          , -7.39376869989580787e-14        , 5.9902754326442751e-15          , -4.40427849634824644e-16        , },
+/* x = 10.0        */  {9.75137802777977578e-7          , -8.80836268751795309e-7         , 4.01157129342545914e-7          , -1.226756349685316e-7           , 2.83117671062209666e-8          , -5.25568472872497777e-9         , 8.16941982248481252e-10         , -1.09307471749324714e-10        , 1.28457619979343574e-11         , -1.34644529044487225e-12        , 1.27383397952959098e-13         , -1.09881784207265054e-14        , 8.86533419473012936e-16         , -6.49405197971299512e-17        , },
+/* x = 12.0        */  {1.6249819143612395e-7           , -1.44311679852135763e-7         , 6.47658866779198488e-8          , -1.95543160295435467e-8         , 4.46263482166607006e-9          , -8.20293653952241858e-10        , 1.26395661708131247e-10         , -1.67804453219865991e-11        , 1.95829376814231892e-12         , -2.03973251131396056e-13        , 1.91878512731865278e-14         , -1.6466207374084633e-15         , 1.32206345614978233e-16         , -9.64292374429151274e-18        , },
+/* x = 14.0        */  {2.80116669091051898e-8          , -2.43509785045021987e-8         , 1.07297640195614965e-8          , -3.18854627279041442e-9         , 7.17698080404973194e-10         , -1.30336557312110371e-10        , 1.98701787180743949e-11         , -2.613211554097741e-12          , 3.02412339842712602e-13         , -3.12628930602875498e-14        , 2.92110868689140747e-15         , -2.49151381858558553e-16        , 1.98904467368324953e-17         , -1.44352134501783913e-18        , },
+/* x = 16.0        */  {5.03395770578625408e-9          , -4.26050170371293226e-9         , 1.83470866554324622e-9          , -5.3454281071912972e-10         , 1.18275328406836878e-10         , -2.11612689926209849e-11        , 3.18423935936183511e-12         , -4.13985689343243313e-13        , 4.74232395206962997e-14         , -4.85836632199285619e-15        , 4.50295440771397591e-16         , -3.81292864189979282e-17        , 3.02350432152319937e-18         , -2.18135741333385547e-19        , },
+/* x = 18.0        */  {9.51538830507525414e-10         , -7.79056323453714936e-10        , 3.26057897067836685e-10         , -9.2692768079063322e-11         , 2.00788790868973279e-11         , -3.5268405649312552e-12         , 5.22243577433120204e-13         , -6.6948397125654548e-14         , 7.57468592320147342e-15         , -7.67543646447958823e-16        , 7.04500208941458642e-17         , -5.91376205198423238e-18        , 4.65187660724647406e-19         , -3.33279230558783106e-20        , },
+/* x = 20.0        */  {1.90980800113354536e-10         , -1.50191275271498249e-10        , 6.07048058666297258e-11         , -1.67441985645738057e-11        , 3.53347935211798432e-12         , -6.06726519338320879e-13        , 8.80847061633183114e-14         , -1.10986980186319064e-14        , 1.23686413493704712e-15         , -1.23671483700976175e-16        , 1.12183041109119625e-17         , -9.31875956089420468e-19        , 7.26013823957790899e-20         , -5.158273805186954e-21          , },
+/* x = 22.0        */  {4.10642468834063051e-11         , -3.07990943123698757e-11        , 1.19407161072320388e-11         , -3.17579682781170115e-12        , 6.49218102599338011e-13         , -1.08430571464846875e-13        , 1.53662326303043652e-14         , -1.89571209324515482e-15        , 2.07392687261268535e-16         , -2.0402656954496597e-17         , 1.82443045926840169e-18         , -1.49641870338783426e-19        , 1.15242439300568685e-20         , -8.10646451297675656e-22        , },
+/* x = 24.0        */  {9.52529613686010351e-12         , -6.7709602639771959e-12         , 2.50179506430136523e-12         , -6.37530838025836386e-13        , 1.25495843623033846e-13         , -2.02745945412184951e-14        , 2.79057691662323222e-15         , -3.35569880423766232e-16        , 3.58963264234613712e-17         , -3.46235950886655874e-18        , 3.04275975883608965e-19         , -2.45769132095197149e-20        , 1.86647069902489088e-21         , -1.29723283474203189e-22        , },
+/* x = 26.0        */  {2.39278421843355401e-12         , -1.60469420862041505e-12        , 5.62069864070882815e-13         , -1.36451234682943618e-13        , 2.57136494845665822e-14         , -3.99555750412163059e-15        , 5.3126068533617537e-16          , -6.19611558565558215e-17        , 6.45161688952802634e-18         , -6.07655004565045509e-19        , 5.22926008376118794e-20         , -4.14617650230210273e-21        , 3.09619218630216145e-22         , -2.12096966794105089e-23        , },
+/* x = 28.0        */  {6.51082240400426034e-13         , -4.10959936725483977e-13        , 1.3597474972030923e-13          , -3.13090888285279477e-14        , 5.6202430697431384e-15          , -8.35559763013339174e-16        , 1.06757435054324936e-16         , -1.20143532642423958e-17        , 1.21177328137003102e-18         , -1.10948812856353863e-19        , 9.31136272346691372e-21         , -7.22044875168714923e-22        , 5.28403745756761857e-23         , -3.55724127718640453e-24        , },
+/* x = 30.0        */  {1.91330923331260256e-13         , -1.13626119228579511e-13        , 3.54596280550793915e-14         , -7.72382991782747133e-15        , 1.31607751863283336e-15         , -1.86416525408200891e-16        , 2.27814612513682917e-17         , -2.46193414676468907e-18        , 2.39371757825499646e-19         , -2.12059371453997486e-20        , 1.72797933531415653e-21         , -1.30513432755682051e-22        , 9.32438911640143445e-24         , -6.14813961216001964e-25        , },
+/* x = 32.0        */  {6.04133124451142538e-14         , -3.37974799140018786e-14        , 9.95032447349211602e-15         , -2.04865586030619059e-15        , 3.30741367308030135e-16         , -4.45128523418321325e-17        , 5.18505051974180704e-18         , -5.35923810238029232e-19        , 5.00146661543742514e-20         , -4.26806288374352559e-21        , 3.36187250406719624e-22         , -2.46268228456059011e-23        , 1.71061131954857525e-24         , -1.10059299827390847e-25        , },
+/* x = 34.0        */  {2.03720176850080464e-14         , -1.07590591809897574e-14        , 2.99266283130417004e-15         , -5.82780572597446326e-16        , 8.91231405086409627e-17         , -1.13836285801521385e-17        , 1.2613720921780601e-18          , -1.24350044622836664e-19        , 1.11013446137203785e-20         , -9.09100869188923454e-22        , 6.89413372529373647e-23         , -4.87784647380510603e-24        , 3.28057337326980792e-25         , -2.05151215691076871e-26        , },
+/* x = 36.0        */  {7.29124948238078719e-15         , -3.64447162664637412e-15        , 9.59790965965883398e-16         , -1.77066506155281605e-16        , 2.56744527657001078e-17         , -3.11295929174463398e-18        , 3.27923421830138439e-19         , -3.07909905807180439e-20        , 2.6240039127286673e-21          , -2.05639447609569597e-22        , 1.49651385842252977e-23         , -1.01904620757016604e-24        , 6.61047689194332434e-26         , -4.00262311163211048e-27        , },
+},
+/* n = 19 */
+{
+/* x = 0.0         */  {0.00991533816940703775          , -0.00940937371771592263         , 0.00447622031372679948          , -0.00142295881742736567         , 0.000339988323637291156         , -0.0000651141161566543709       , 0.000010410806744265085         , -1.42910567212248824e-6         , 1.71915740835087023e-7          , -1.84088968616902066e-8         , 1.77613242259730371e-9          , -1.56009121732365574e-10        , 1.28062451605160914e-11         , -9.52687812609045048e-13        , },
+/* x = 2.0         */  {0.00149345835824994317          , -0.00140963460064729982         , 0.000667329188222830634         , -0.000211201161647457809        , 0.0000502586477584456033        , -9.58984208580765443e-6         , 1.5280562612107284e-6           , -2.09099137244070724e-7         , 2.50806091341828186e-8          , -2.67840028826144366e-9         , 2.57768803466808822e-10         , -2.25883610979727987e-11        , 1.84999610351599773e-12         , -1.37343906743956725e-13        , },
+/* x = 4.0         */  {0.000227464439431594696         , -0.000213316613874672036        , 0.000100401708488787795         , -0.0000316099988491918269       , 7.48646954274971153e-6          , -1.42232553740005141e-6         , 2.25739881852709511e-7          , -3.07782046104327249e-8         , 3.67938706264237294e-9          , -3.91714392849250304e-10        , 3.75906723221676562e-11         , -3.28531672111558642e-12        , 2.68379805431641341e-13         , -1.98786148495727652e-14        , },
+/* x = 6.0         */  {0.000035108966437356986         , -0.0000326691232501718189       , 0.0000152697174179450521        , -4.77754443320149681e-6         , 1.12516378399629377e-6          , -2.12680227832379844e-7         , 3.3598985295500778e-8           , -4.56168907700012669e-9         , 5.43219942849801434e-10         , -5.76265701364514083e-11        , 5.51197104814725831e-12         , -4.80267525401769527e-13        , 3.91192400279000573e-14         , -2.88995922554923205e-15        , },
+/* x = 8.0         */  {5.50688408305308864e-6          , -5.07548195291060003e-6         , 2.35235988840673715e-6          , -7.30492095521506863e-7         , 1.70886716913270417e-7          , -3.21066724938557551e-8         , 5.04455476415850398e-9          , -6.81506258550713663e-10        , 8.07900921215914054e-11         , -8.5351365276331378e-12         , 8.13294665700885053e-13         , -7.06165405973347044e-14        , 5.73279524076319762e-15         , -4.22254864798865626e-16        , },
+/* x = 10.0        */  {8.80836268751795567e-7          , -8.02314258685197868e-7         , 3.68026904905573071e-7          , -1.13247068421490604e-7         , 2.62784236439146037e-8          , -4.90165192403024838e-9         , 7.65152300854642013e-10         , -1.02765979643052503e-10        , 1.21180105939273935e-11         , -1.27404727030391083e-12        , 1.20867048924971459e-13         , -1.04522563579061066e-14        , 8.45286285733635219e-16         , -6.20482252566828859e-17        , },
+/* x = 12.0        */  {1.44311679852135802e-7          , -1.29531773355855381e-7         , 5.8662948088627438e-8           , -1.78505392861624062e-8         , 4.10146826980390368e-9          , -7.58373974765653681e-10        , 1.17463117048973117e-10         , -1.56663329380292281e-11        , 1.83575969932487299e-12         , -1.91910059098957818e-13        , 1.81123987279025685e-14         , -1.55894477246261266e-15        , 1.25514148163254325e-16         , -9.17712497237537968e-18        , },
+/* x = 14.0        */  {2.43509785045022044e-8          , -2.14595280391253301e-8         , 9.56563881837076813e-9          , -2.87079232154510771e-9         , 6.51682786566887145e-10         , -1.19221072981512001e-10        , 1.82924808482748045e-11         , -2.41929615468215098e-12        , 2.81366102705550395e-13         , -2.92157876447554407e-14        , 2.74060148554752919e-15         , -2.34582865562252302e-16        , 1.87889465385464145e-17         , -1.36749842657921376e-18        , },
+/* x = 16.0        */  {4.26050170371293311e-9          , -3.66941733108684371e-9         , 1.60362843215731809e-9          , -4.73101313616107053e-10        , 1.05806344964052492e-10         , -1.91054362573351453e-11        , 2.89789982085438042e-12         , -3.79385530778390873e-13        , 4.37253066443416357e-14         , -4.50366095087643753e-15        , 4.19412620789845692e-16         , -3.56654323710391573e-17        , 2.83923002610910929e-18         , -2.05539829079745046e-19        , },
+/* x = 18.0        */  {7.79056323453715064e-10         , -6.52115794135726699e-10        , 2.78078304237179238e-10         , -8.03155163458827819e-11        , 1.76342028247993125e-11         , -3.13346147995748891e-12        , 4.68638779193006395e-13         , -6.05974288760205871e-14        , 6.90789428926471752e-15         , -7.04607476525325789e-16        , 6.50499440328070715e-17         , -5.48863658277535012e-18        , 4.33786104824412459e-19         , -3.12051153068062481e-20        , },
+/* x = 20.0        */  {1.50191275271498268e-10         , -1.21409611733267644e-10        , 5.02325956937197802e-11         , -1.41339174082097899e-11        , 3.03363259671342847e-12         , -5.28508239339236183e-13        , 7.76908860256677883e-14         , -9.89490409158660707e-15        , 1.11304357778497793e-15         , -1.12199518943697711e-16        , 1.02504160291511057e-17         , -8.56835933117565567e-19        , 6.71373732247102129e-20         , -4.79355187726117087e-21        , },
+/* x = 22.0        */  {3.07990943123698787e-11         , -2.38814322144653535e-11        , 9.52739048343485057e-12         , -2.59687241035652222e-12        , 5.42152857327606264e-13         , -9.21973961492945679e-14        , 1.32699846365310295e-14         , -1.65914009821061735e-15        , 1.83623947272728521e-16         , -1.82468710384907273e-17        , 1.64602666218433994e-18         , -1.36051119911189677e-19        , 1.05507353367889625e-20         , -7.46602416497581799e-22        , },
+/* x = 24.0        */  {6.77096026397719637e-12         , -5.00359012860293245e-12        , 1.9125925140774695e-12          , -5.01983374485671462e-13        , 1.01372972706621189e-13         , -1.67434615579146792e-14        , 2.34898916042853783e-15         , -2.87170389767554586e-16        , 3.11612410179971706e-17         , -3.04316606241945994e-18        , 2.70340727955422563e-19         , -2.2043056170084622e-20         , 1.68833626672620558e-21         , -1.18197406071356189e-22        , },
+/* x = 26.0        */  {1.60469420862041513e-12         , -1.12413972814179823e-12        , 4.09353704048824526e-13         , -1.02854597937223038e-13        , 1.99777875206925128e-14         , -3.18756412140667311e-15        , 4.33728090590963286e-16         , -5.16128993462398694e-17        , 5.4688959087871192e-18          , -5.22991586680744698e-19        , 4.56070931058737236e-20         , -3.65819864861635024e-21        , 2.7603457299575711e-22          , -1.90773249820811664e-23        , },
+/* x = 28.0        */  {4.10959936725483989e-13         , -2.71949499440623844e-13        , 9.39272664855828126e-14         , -2.24809722788002665e-14        , 4.17779881508043622e-15         , -6.40544611876533805e-16        , 8.41004727837430777e-17         , -9.69418034397285448e-18        , 9.98539457036526333e-19         , -9.31244567115575573e-20        , 7.94235543816633044e-21         , -6.24633315078220367e-22        , 4.62943870359809737e-23         , -3.15039327663128705e-24        , },
+/* x = 30.0        */  {1.13626119228579513e-13         , -7.09192561101596965e-14        , 2.3171489753482242e-14          , -5.26431007450210298e-15        , 9.32082627043297555e-16         , -1.3668876777128388e-16         , 1.72335390163459418e-17         , -1.91497306041683439e-18        , 1.90853457894772816e-19         , -1.72816306962733321e-20        , 1.43562469827464808e-21         , -1.10289169936366184e-22        , 8.00096769139147312e-24         , -5.34499820150343254e-25        , },
+/* x = 32.0        */  {3.37974799140018789e-14         , -1.9900648946984392e-14         , 6.14596758091854224e-15         , -1.32296546922700158e-15        , 2.22564261709554451e-16         , -3.11103031645214695e-17        , 3.75146666977602203e-18         , -4.00117153727842432e-19        , 3.84125700040829988e-20         , -3.36219426717842538e-21        , 2.70891090919091313e-22         , -2.02465243920556556e-23        , 1.43221103687375333e-24         , -9.36038141757491436e-26        , },
+/* x = 34.0        */  {1.07590591809897575e-14         , -5.98532566260836915e-15        , 1.74834171779233373e-15         , -3.56492562033633852e-16        , 5.69181429008306063e-17         , -7.56823256143834652e-18        , 8.7045031202427065e-19          , -8.88107250241024591e-20        , 8.18190854181316802e-21         , -6.89471829573750644e-22        , 5.36556080792849388e-23         , -3.88567099101293612e-24        , 2.66952264969755392e-25         , -1.70056856369444587e-26        , },
+/* x = 36.0        */  {3.64447162664637413e-15         , -1.9195819319317723e-15         , 5.31199518465843849e-16         , -1.02697811062624246e-16        , 1.55647964587360666e-17         , -1.96754053256649851e-18        , 2.15536934003122234e-19         , -2.09920252611898132e-20        , 1.85075516113771112e-21         , -1.49662460348049181e-22        , 1.12093785795000748e-23         , -7.83592203792875501e-25        , 5.20812654591271204e-26         , -3.22167441344114018e-27        , },
+},
+/* n = 20 */
+{
+/* x = 0.0         */  {0.00940937371771592653          , -0.00895244062745517712         , 0.00426887645228176927          , -0.00135995329449866311         , 0.000325570580787641773         , -0.0000624648409201041518       , 0.0000100037396838818085        , -1.37532419520015526e-6         , 1.65680116702945924e-7          , -1.77644986069647223e-8         , 1.71605639016049179e-9          , -1.50904573060722297e-10        , 1.24009229804737777e-11         , -9.23456288490266343e-13        , },
+/* x = 2.0         */  {0.00140963460064730038          , -0.00133465837644588835         , 0.000633603484942326354         , -0.000201034591026515916        , 0.000047949210429665907         , -9.16833763266284157e-6         , 1.46369395769584784e-6          , -2.00644623936429457e-7         , 2.4105609050025621e-8           , -2.57814478589542339e-9         , 2.48465659864464452e-10         , -2.180133398924492e-11          , 1.78776613793919519e-12         , -1.32873084315684269e-13        , },
+/* x = 4.0         */  {0.000213316613874672117         , -0.000200803416977608386        , 0.000094829996547568696         , -0.0000299458781699493971       , 7.11162768709071839e-6          , -1.35443930056129793e-6         , 2.15447431838814693e-7          , -2.94350605200309345e-8         , 3.52543046610264135e-9          , -3.75972688586433196e-10        , 3.61375741497581381e-11         , -3.16298789230117928e-12        , 2.58752823049286846e-13         , -1.91899242928389382e-14        , },
+/* x = 6.0         */  {0.0000326691232501718305        , -0.0000305394348358948603       , 0.0000143326332996035087        , -4.50065513583297817e-6         , 1.06340113917498855e-6          , -2.01593913142776765e-7         , 3.19318234761720825e-8          , -4.34575432461899491e-9         , 5.18639265861214841e-10         , -5.51292771437362804e-11        , 5.28281113811512409e-12         , -4.61081793268301204e-13        , 3.76173394973548184e-14         , -2.7830290221664946e-15         , },
+/* x = 8.0         */  {5.07548195291060172e-6          , -4.7047197768141673e-6          , 2.19147628656437792e-6          , -6.835468676309056e-7           , 1.60533362471181067e-7          , -3.02673287845356329e-8         , 4.77054380072399729e-9          , -6.4631997665041106e-10         , 7.6816248315123274e-11          , -8.13434058126252044e-12        , 7.76762814955093185e-13         , -6.75770271768646313e-14        , 5.49627019350836706e-15         , -4.05505237431246726e-16        , },
+/* x = 10.0        */  {8.02314258685198116e-7          , -7.36053809811247653e-7         , 3.39741205264450975e-7          , -1.05113694572410054e-7         , 2.45082596204290748e-8          , -4.59091383436309683e-9         , 7.1936185616776948e-10          , -9.69439733790581748e-11        , 1.14664282904452856e-11         , -1.20887467191149904e-12        , 1.14972025731547631e-13         , -9.96523965124628162e-15        , 8.07643003034892512e-16         , -5.9398592519113669e-17         , },
+/* x = 12.0        */  {1.29531773355855418e-7          , -1.17325896177269835e-7         , 5.35516178584841582e-8          , -1.6405873078736917e-8          , 3.7918698738690744e-9           , -7.04778706602117781e-10        , 1.09664330370335815e-10         , -1.46860611821072476e-11        , 1.72719095160943961e-12         , -1.81154076847209041e-13        , 1.71479821053543687e-14         , -1.47990979118085028e-15        , 1.19451857998832866e-16         , -8.75332892606720504e-18        , },
+/* x = 14.0        */  {2.14595280391253355e-8          , -1.9131277636743756e-8          , 8.61237696463487075e-9          , -2.60673114619651669e-9         , 5.96105364913591683e-10         , -1.09754885728935821e-10        , 1.69350730538230062e-11         , -2.25092638626537836e-12        , 2.62942150842907603e-13         , -2.74104797170207603e-14        , 2.58035085974521967e-15         , -2.21570752022875447e-16        , 1.77995382508227434e-17         , -1.29886881322717589e-18        , },
+/* x = 16.0        */  {3.66941733108684451e-9          , -3.20725686431496819e-9         , 1.4193039408482538e-9           , -4.23225379845585846e-10        , 9.55271812875738422e-11         , -1.7387399020743374e-11         , 2.65569871113778031e-12         , -3.49802088899146461e-13        , 4.05329577956503631e-14         , -4.19479400980726901e-15        , 3.92310723602614892e-16         , -3.34879513747096701e-17        , 2.67530231578789927e-18         , -1.94269646199880473e-19        , },
+/* x = 18.0        */  {6.5211579413572682e-10          , -5.56156608474408593e-10        , 2.40946549037638231e-10         , -7.05368112975935418e-11        , 1.56673073999223079e-11         , -2.81183268959141301e-12        , 4.24182001484799842e-13         , -5.52630993298334108e-14        , 6.34146867589421926e-15         , -6.50600244849341198e-16        , 6.03736460701591845e-17         , -5.11745840296598259e-18        , 4.06159713668360071e-19         , -2.93249516423223075e-20        , },
+/* x = 20.0        */  {1.21409611733267662e-10         , -1.00465191387447207e-10        , 4.2401752224627836e-11          , -1.2134530386609028e-11         , 2.6425411967166317e-12          , -4.66145318356179135e-13        , 6.92643285429424796e-14         , -8.90434023305161424e-15        , 1.00979588084421478e-15         , -1.02519540543227902e-16        , 9.42498958782306667e-18         , -7.92225713561821254e-19        , 6.23909658480877887e-20         , -4.47425504490043351e-21        , },
+/* x = 22.0        */  {2.38814322144653563e-11         , -1.90547809668708825e-11        , 7.79061723106933141e-12         , -2.16861142927262089e-12        , 4.60986980749609647e-13         , -7.96199081594236572e-14        , 1.16139806724176454e-14         , -1.46899028203904559e-15        , 1.64221871610722297e-16         , -1.64626428836114476e-17        , 1.49653077170190712e-18         , -1.24534995589352827e-19        , 9.71730316762467961e-21         , -6.91276150704907876e-22        , },
+/* x = 24.0        */  {5.00359012860293289e-12         , -3.82518502815512425e-12        , 1.50595012345697781e-12         , -4.05491890820557143e-13        , 8.37173077900610159e-14         , -1.40939350159197618e-14        , 2.01019272603230555e-15         , -2.49289724911463661e-16        , 2.73884995772963244e-17         , -2.70377987249601608e-18        , 2.42468713805772245e-19         , -1.99348631787882587e-20        , 1.53834957534893866e-21         , -1.08390673975402743e-22        , },
+/* x = 26.0        */  {1.1241397281417983e-12          , -8.18707408097678608e-13        , 3.08563793811663337e-13         , -7.99111500818242784e-14        , 1.59378206071103705e-14         , -2.60236855205773587e-15        , 3.61290295054055392e-16         , -4.37511348437973141e-17        , 4.70692507217747303e-18         , -4.56130379641409704e-19        , 4.02394106851373406e-20         , -3.2605324765258406e-21         , 2.4828684281887773e-22          , -1.72941331410815746e-23        , },
+/* x = 28.0        */  {2.71949499440623856e-13         , -1.87854532971170439e-13        , 6.74429168363998702e-14         , -1.6711195260167703e-14         , 3.20272305939505774e-15         , -5.04602838088835245e-16        , 6.78592623483441388e-17         , -7.98831037485686367e-18        , 8.38120237830823474e-19         , -7.94332370131327987e-20        , 6.87084187076175379e-21         , -5.4708234787657668e-22         , 4.10004199048140954e-23         , -2.81676551839833479e-24        , },
+/* x = 30.0        */  {7.09192561101596983e-14         , -4.63429795069652874e-14        , 1.57929302235061561e-14         , -3.72833050814748317e-15        , 6.83443838858456698e-16         , -1.03401234329439146e-16        , 1.34048114131388197e-17         , -1.52682678177343805e-18        , 1.55534697221505012e-19         , -1.435786285477803e-20          , 1.21316037992267208e-21         , -9.46013967055274567e-23        , 6.95594834462935004e-24         , -4.70071863723406937e-25        , },
+/* x = 32.0        */  {1.99006489469843923e-14         , -1.22919351618372224e-14        , 3.96889640768097896e-15         , -8.90257046833803335e-16        , 1.55551515822951127e-16         , -2.2508800058386344e-17         , 2.80082007444475466e-18         , -3.07300408679476015e-19        , 3.02597519406251837e-20         , -2.70918839003553459e-21        , 2.22708310871464874e-22         , -1.69443673417244925e-23        , 1.21810683561104327e-24         , -8.07217002535157999e-26        , },
+/* x = 34.0        */  {5.9853256626083692e-15          , -3.49668343558469196e-15        , 1.06947768610089707e-15         , -2.27672571602538701e-16        , 3.78411628072515178e-17         , -5.22270187919914001e-18        , 6.21675074881748424e-19         , -6.54552414639677889e-20        , 6.20524708109687742e-21         , -5.36605343445034163e-22        , 4.27417796332011585e-23         , -3.16043431954853428e-24        , 2.21292556167964827e-25         , -1.4330953362843475e-26         , },
+/* x = 36.0        */  {1.91958193193177231e-15         , -1.06239903693169222e-15        , 3.0809343318787193e-16          , -6.22591858347997019e-17        , 9.83770266284325811e-18         , -1.29322160531981318e-18        , 1.46944176776654018e-19         , -1.48060363326072939e-20        , 1.34696225386388746e-21         , -1.12102872701391708e-22        , 8.6194059709755699e-24          , -6.17044794477414654e-25        , 4.19211385551204968e-26         , -2.64346367737026333e-27        , },
+},
+/* n = 21 */
+{
+/* x = 0.0         */  {0.00895244062745518091          , -0.00853775290456506973         , 0.00407985988349567106          , -0.00130228232310156907         , 0.000312324204604764328         , -0.0000600224385442730754       , 9.62726934603195662e-6          , -1.3254392536912837e-6          , 1.59880531110818697e-7          , -1.71636437774583542e-8         , 1.65990762549033151e-9          , -1.46123184111777245e-10        , 1.20204510876875567e-11         , -8.95963884636029146e-13        , },
+/* x = 2.0         */  {0.00133465837644588889          , -0.00126720696988487263         , 0.000603103773079502116         , -0.000191796841711626254        , 0.0000458416881639226531        , -8.78216380951145626e-6         , 1.40451236463446881e-6          , -1.92844631118798407e-7         , 2.32033093313532176e-8          , -2.48509894789000668e-9         , 2.39808554660496023e-10         , -2.10671434047724507e-11        , 1.72957526744865792e-12         , -1.28683416832630524e-13        , },
+/* x = 4.0         */  {0.000200803416977608464         , -0.000189659993095169089        , 0.0000898376345098416267        , -0.0000284465107473485774       , 6.77219650289401792e-6          , -1.29268460016155365e-6         , 2.06045423220080825e-7          , -2.82034089529525832e-8         , 3.38375509756872061e-9          , -3.61439497256585235e-10        , 3.47919865309538316e-11         , -3.04939248691535211e-12        , 2.49789119210229999e-13         , -1.85471298920300119e-14        , },
+/* x = 6.0         */  {0.0000305394348358948716        , -0.0000286652665992116038       , 0.0000135019654074979867        , -4.25360455655319095e-6         , 1.00796956572652169e-6          , -1.91590942177901913e-7         , 3.04202802116712135e-8          , -4.14910909500622124e-9         , 4.96163624283092587e-10         , -5.28373365008966291e-11        , 5.07177262514005099e-12         , -4.43357060372282681e-13        , 3.62255957649870663e-14         , -2.68367119865837987e-15        , },
+/* x = 8.0         */  {4.70471977681416894e-6          , -4.38295257312942237e-6         , 2.05064060289257938e-6          , -6.42133449863395066e-7         , 1.5133664392451042e-7           , -2.86232629963068008e-8         , 4.52423982775804909e-9          , -6.14529255234064153e-10        , 7.32090840774233909e-11         , -7.76896884224133698e-12        , 7.43328871686153072e-13         , -6.47851832468377424e-14        , 5.27826890819088832e-15         , -3.9001969175422077e-16         , },
+/* x = 10.0        */  {7.36053809811247891e-7          , -6.79482410528999298e-7         , 3.15341083717210147e-7          , -9.80330384786011508e-8         , 2.29545691720823583e-8          , -4.3161711650429543e-9          , 6.78607812372411571e-10         , -9.1731319518467358e-11         , 1.0879874792194175e-11          , -1.14991606665617549e-12        , 1.09614952172818434e-13         , -9.52082788453579299e-15        , 7.73157699435991902e-16         , -5.69627172943057179e-17        , },
+/* x = 12.0        */  {1.1732589617726987e-7           , -1.07103235716982614e-7         , 4.92176192362078206e-8          , -1.51674794950187712e-8         , 3.52389353304966349e-9          , -6.57985986339752794e-10        , 1.028024280871927e-10           , -1.38175119262549215e-11        , 1.63038709353495235e-12         , -1.71508579857968513e-13        , 1.6278614724253283e-14          , -1.40832370303341872e-15        , 1.13936177397444602e-16         , -8.36619765085855454e-18        , },
+/* x = 14.0        */  {1.91312776367437611e-8          , -1.72247539292718549e-8         , 7.82019343858911843e-9          , -2.38442145958673865e-9         , 5.4877442865043427e-10          , -1.01610438931590752e-10        , 1.57564846762328631e-11         , -2.10353488806625105e-12        , 2.46694376649155573e-13         , -2.5807759505303452e-14         , 2.43722039174887129e-15         , -2.09884575794231953e-16        , 1.69063420275018772e-17         , -1.23662773854698905e-18        , },
+/* x = 16.0        */  {3.20725686431496895e-9          , -2.83860788169682228e-9         , 1.26967613953669353e-9          , -3.82108725140225644e-10        , 8.69369951045702883e-11         , -1.59341923574542015e-11        , 2.44861461819761796e-12         , -3.24263317117509128e-13        , 3.77531548662809943e-14         , -3.92374019013140593e-15        , 3.6835888217324597e-16          , -3.15512314794123113e-17        , 2.5286264728022281e-18          , -1.8413210334749332e-19         , },
+/* x = 18.0        */  {5.56156608474408707e-10         , -4.81893098075323715e-10        , 2.1161043389277106e-10          , -6.26692295981771508e-11        , 1.40591634480846044e-11         , -2.5450920225175281e-12         , 3.86841694696645116e-13         , -5.07316975643764396e-14        , 5.85540351547712746e-15         , -6.03831505793335074e-16        , 5.62907597514148381e-17         , -4.79096812031713913e-18        , 3.81690800881451948e-19         , -2.764948123439391e-20          , },
+/* x = 20.0        */  {1.00465191387447224e-10         , -8.48035044492628373e-11        , 3.64035911598256417e-11         , -1.05701647866372363e-11        , 2.33072659180012786e-12         , -4.15585973321269348e-13        , 6.2330381539046814e-14          , -8.07835918536525922e-15        , 9.22676062705806001e-16         , -9.42643084237388763e-17        , 8.7142894283530367e-18          , -7.36113368642616042e-19        , 5.82356504298863974e-20         , -4.19274051147914104e-21        , },
+/* x = 22.0        */  {1.90547809668708851e-11         , -1.55812344621397619e-11        , 6.50583428781764288e-12         , -1.84394792296326973e-12        , 3.98099540800048815e-13         , -6.96838843510255591e-14        , 1.02829319602067792e-14         , -1.31377376709649578e-15        , 1.48163816095088653e-16         , -1.49675183307038388e-17        , 1.36985547873249196e-18         , -1.14678375159335365e-19        , 8.99730732294166999e-21         , -6.43087617386929969e-22        , },
+/* x = 24.0        */  {3.82518502815512465e-12         , -3.01190024691412647e-12        , 1.21647567246163753e-12         , -3.34869231154777111e-13        , 7.04696750800508271e-14         , -1.20611564053964066e-14        , 1.74502807221055879e-15         , -2.19107809179996081e-16        , 2.43340235017930708e-17         , -2.42503077507766541e-18        , 2.19278948956165319e-19         , -1.81602935049643119e-20        , 1.41073185640951818e-21         , -9.99671330743173179e-23        , },
+/* x = 26.0        */  {8.18707408097678671e-13         , -6.17127587623353653e-13        , 2.39733450245467531e-13         , -6.37512824275781566e-14        , 1.30118427603594041e-14         , -2.16774177809426049e-15        , 3.06257943567102607e-16         , -3.76553709776935534e-17        , 4.10517414422681181e-18         , -4.02448373016130047e-19        , 3.5865145953306984e-20          , -2.93208255185710069e-21        , 2.25082381189428662e-22         , -1.57865206564773558e-23        , },
+/* x = 28.0        */  {1.87854532971170449e-13         , -1.34885833672804081e-13        , 5.01335857805022651e-14         , -1.28108922374413403e-14        , 2.52301419045542966e-15         , -4.07155575340081228e-16        , 5.59181725699815541e-17         , -6.70495714067936992e-18        , 7.14899248867819957e-19         , -6.87171489808503061e-20        , 6.01779264923145837e-21         , -4.84385891309171444e-22        , 3.66591071613183902e-23         , -2.53971584953256702e-24        , },
+/* x = 30.0        */  {4.6342979506965289e-14          , -3.1585860447013026e-14         , 1.11849915244423125e-14         , -2.73377535541098709e-15        , 5.17006171649022123e-16         , -8.04288686843902399e-17        , 1.06877874636473822e-17         , -1.24427679469652921e-18        , 1.2922078447875389e-19          , -1.21330394376633433e-20        , 1.04059699547032856e-21         , -8.22184593181362207e-23        , 6.11761360675827799e-24         , -4.17640272471993285e-25        , },
+/* x = 32.0        */  {1.22919351618372227e-14         , -7.93779281536207835e-15        , 2.67077114050138725e-15         , -6.22206063287950575e-16        , 1.12544000292235118e-16         , -1.68049204813539318e-17        , 2.15110285930002276e-18         , -2.4207788339012979e-19         , 2.43826986309827002e-20         , -2.22732535597939339e-21        , 1.86384989444144742e-22         , -1.44058662326462779e-23        , 1.0504916723228602e-24          , -7.0471931562080434e-26         , },
+/* x = 34.0        */  {3.49668343558469201e-15         , -2.13895537220181509e-15        , 6.83017714807612219e-16         , -1.51364651228335873e-16        , 2.61135093960474928e-17         , -3.73005045532227737e-18        , 4.58186689999169491e-19         , -4.96419536705394965e-20        , 4.82944862373037345e-21         , -4.27459923097136722e-22        , 3.47642566283026869e-23         , -2.61874549717909487e-24        , 1.86491807073761611e-25         , -1.22550589454943507e-26        , },
+/* x = 36.0        */  {1.06239903693169222e-15         , -6.16186866375747632e-16        , 1.86777557504398421e-16         , -3.93508106512523537e-17        , 6.46610802660819175e-18         , -8.81665061746032635e-19        , 1.03642254284447068e-19         , -1.07756938933548129e-20        , 1.00892594817821599e-21         , -8.6201645229614804e-23         , 6.78740095946517579e-24         , -4.96433572602590704e-25        , 3.43984022735899365e-26         , -2.20669668628508611e-27        , },
+},
+/* n = 22 */
+{
+/* x = 0.0         */  {0.00853775290456507341          , -0.00815971976699282903         , 0.00390684696930439788          , -0.00124929681837147591         , 0.000300112192725489692         , -0.0000577636165044243891       , 9.2780747560422724e-6           , -1.27904261752407571e-6         , 1.54472836418654062e-7          , -1.66020670861053958e-8         , 1.60731354640131693e-9          , -1.4163523309407114e-10         , 1.16626137105348406e-11         , -8.70059986059847057e-13        , },
+/* x = 2.0         */  {0.00126720696988487315          , -0.00120620754615921743         , 0.000575390525134834482         , -0.000183366752648868388        , 0.000043910819048147673         , -8.42707424920683556e-6         , 1.34991241499770876e-6          , -1.8562624074597735e-7          , 2.23658966036102485e-8          , -2.39851437216034417e-9         , 2.3173263979897944e-10          , -2.03806554519579126e-11        , 1.67504356555783965e-12         , -1.2474925247532749e-13         , },
+/* x = 4.0         */  {0.000189659993095169164         , -0.000179675269019713923        , 0.0000853395322420393738        , -0.0000270887860105946602       , 6.46342300089254691e-6          , -1.23627254815318883e-6         , 1.97423862263730581e-7          , -2.70700071321540055e-8         , 3.25295634731819831e-9          , -3.47981554035097214e-10        , 3.35424647251139248e-11         , -2.94363199730772241e-12        , 2.41422736216371412e-13         , -1.79458110716791903e-14        , },
+/* x = 6.0         */  {0.0000286652665992116147        , -0.0000270039308150004015       , 0.0000127608136696586566        , -4.0318782627643852e-6          , 9.57954710901725861e-7          , -1.82521682545341276e-7         , 2.90437636064053209e-8          , -3.96930413592571265e-9         , 4.75536154161414914e-10         , -5.072663320628527e-11          , 4.87680480304641852e-12         , -4.26933806734963226e-13        , 3.49324023275374752e-14         , -2.59111414829385661e-15        , },
+/* x = 8.0         */  {4.38295257312942395e-6          , -4.10128120578580076e-6         , 1.92640034959005266e-6          , -6.05346575677497685e-7         , 1.4311631498330115e-7           , -2.7145439151444266e-8          , 4.30170477815614714e-9          , -5.85671968253781572e-10        , 6.99207377565333197e-11         , -7.43458005380504787e-12        , 7.1261924327306805e-13          , -6.22122419294029577e-14        , 5.0767186990401849e-15          , -3.75661656295900689e-16        , },
+/* x = 10.0        */  {6.79482410528999527e-7          , -6.30682167434513803e-7         , 2.94099115435784197e-7          , -9.18182766853371487e-8         , 2.15808558254715075e-8          , -4.07164690116502908e-9         , 6.42119235396938602e-10         , -8.70388957449452054e-11        , 1.03492472406189453e-11         , -1.096337608176541e-12          , 1.04726524699047063e-13         , -9.11374422012063189e-15        , 7.41454245133850783e-16         , -5.47160577037569767e-17        , },
+/* x = 12.0        */  {1.07103235716982648e-7          , -9.84352384724293322e-8         , 4.55024384850535024e-8          , -1.40955741317605389e-8         , 3.28992993173624564e-9          , -6.16814572466192111e-10        , 9.67225833038724042e-11         , -1.30430817271904315e-11        , 1.54357760424753e-12            , -1.62813685906042781e-13        , 1.54911837747945231e-14         , -1.34320038606974225e-15        , 1.08897645305918623e-16         , -8.01124756653099431e-18        , },
+/* x = 14.0        */  {1.72247539292718598e-8          , -1.56403868771802534e-8         , 7.15326437875980328e-9          , -2.19509771453720904e-9         , 5.08052194663456106e-10         , -9.45389086381495085e-11        , 1.47247441900525021e-11         , -1.97355280080341632e-12        , 2.32269892143278013e-13         , -2.43762599655072033e-14        , 2.30867499586842806e-15         , -1.99336280604794534e-16        , 1.60962834622466483e-17         , -1.17994124174266438e-18        , },
+/* x = 16.0        */  {2.838607881696823e-9            , -2.53935227907368608e-9         , 1.14632617542061597e-9          , -3.47747980408712535e-10        , 7.96709617880838443e-11         , -1.46916877953032726e-11        , 2.2698432159209467e-12          , -3.0202491086333416e-13         , 3.53136700717909352e-14         , -3.68419027774108303e-15        , 3.47055371456548754e-16         , -2.98186106115554671e-17        , 2.39669000423983869e-18         , -1.7496902069042337e-19         , },
+/* x = 18.0        */  {4.81893098075323823e-10         , -4.23220867785586807e-10        , 1.88007688794522382e-10         , -5.62366537909084455e-11        , 1.2725460112708583e-11          , -2.32105018104961833e-12        , 3.55121882370111085e-13         , -4.6843179096206992e-14         , 5.43448479611999831e-15         , -5.6299748146586584e-16         , 5.26994329875055003e-17         , -4.50184543453309528e-18        , 3.59885560040949965e-19         , -2.61480586814426975e-20        , },
+/* x = 20.0        */  {8.48035044492628535e-11         , -7.28071823196580219e-11        , 3.17104943599103481e-11         , -9.32290636698488227e-12        , 2.07792986662449121e-12         , -3.73982291174943349e-13        , 5.65485142104633703e-14         , -7.38140110864658101e-15        , 8.48378962442458941e-16         , -8.71564481166198569e-17        , 8.09706457356658957e-18         , -6.86999005371445545e-19        , 5.45719835591149758e-20         , -3.94293326239707458e-21        , },
+/* x = 22.0        */  {1.55812344621397643e-11         , -1.30116685756363125e-11        , 5.53184376888960308e-12         , -1.59239816316733888e-12        , 3.48419421757876087e-13         , -6.1697592056948081e-14         , 9.1964163564836719e-15          , -1.18530940225630609e-15        , 1.34707693244474314e-16         , -1.37006200453973436e-17        , 1.2614344867938079e-18          , -1.0616528083027541e-19         , 8.37018992016867713e-21         , -6.00802348341543446e-22        , },
+/* x = 24.0        */  {3.01190024691412684e-12         , -2.43295134492343342e-12        , 1.00460769346429976e-12         , -2.81878700315135463e-13        , 6.03057820274029646e-14         , -1.04701684788739641e-14        , 1.53375466223950089e-15         , -1.94672014259634747e-16        , 2.18252813052811437e-17         , -2.19310803986298952e-18        , 1.99758995185389188e-19         , -1.66507747412025108e-20        , 1.30111213695457732e-21         , -9.26691785705691143e-23        , },
+/* x = 26.0        */  {6.17127587623353712e-13         , -4.79466900490959841e-13        , 1.91253847282729571e-13         , -5.20473710406446921e-14        , 1.08387088905366161e-14         , -1.83754766853893302e-15        , 2.63587596530349575e-16         , -3.28413659678435365e-17        , 3.62203602894223819e-18         , -3.58701300479826236e-19        , 3.22522512021840657e-20         , -2.65749102074028933e-21        , 2.05463629713857218e-22         , -1.44991845109515346e-23        , },
+/* x = 28.0        */  {1.3488583367280409e-13          , -1.00267171561008473e-13        , 3.8432676712323249e-14          , -1.00920567616955541e-14        , 2.03577787671069608e-15         , -3.35509036555370373e-16        , 4.69346999353638594e-17         , -5.71918966530046979e-18        , 6.18454446667074223e-19         , -6.01858568361460086e-20        , 5.32814131696656132e-21         , -4.3298825859203171e-22         , 3.30539378382232125e-23         , -2.30700911459632403e-24        , },
+/* x = 30.0        */  {3.15858604470130275e-14         , -2.23699830488852649e-14        , 8.20132606623283749e-15         , -2.06802468657561289e-15        , 4.02144343423601633e-16         , -6.41267249661647456e-17        , 8.70993755495362251e-18         , -1.03376557380926099e-18        , 1.09197371914860063e-19         , -1.04072569927818541e-20        , 9.04386453851524451e-22         , -7.22881300488940592e-23        , 5.43535941412644957e-24         , -3.74411077401758899e-25        , },
+/* x = 32.0        */  {7.9377928153620786e-15          , -5.34154228100288079e-15        , 1.86661818986383145e-15         , -4.5017600116553918e-16         , 8.40246024070400054e-17         , -1.29066171864117631e-17        , 1.69454518243324489e-18         , -1.95061472432141368e-19        , 2.00459309845223468e-20         , -1.86406368992854233e-21        , 1.58461809644809609e-22         , -1.24193149155005841e-23        , 9.17123806415935753e-25         , -6.21950507912460794e-26        , },
+/* x = 34.0        */  {2.13895537220181513e-15         , -1.36603542961524258e-15        , 4.54093953685004214e-16         , -1.04454037583609357e-16        , 1.86502522766567761e-17         , -2.74912014522054101e-18        , 3.47493675475907914e-19         , -3.86355690830846377e-20        , 3.84713977473543433e-21         , -3.47679062006668444e-22        , 2.88057439824596219e-23         , -2.20605087152521885e-24        , 1.59481761386125326e-25         , -1.06169377866401606e-26        , },
+/* x = 36.0        */  {6.16186866375747639e-16         , -3.73555115008800039e-16        , 1.18052431953756473e-16         , -2.58644321063304668e-17        , 4.4083253087380058e-18          , -6.21853526627384232e-19        , 7.54298572158390998e-20         , -8.07140407799021473e-21        , 7.75814887733513265e-22         , -6.78804398930926783e-23        , 5.46069042424802523e-24         , -4.07168930461912346e-25        , 2.87157385146052157e-26         , -1.87063227372229734e-27        , },
+},
+/* n = 23 */
+{
+/* x = 0.0         */  {0.00815971976699283261          , -0.0078136939386102409          , 0.00374789045511412685          , -0.00120044877085571442         , 0.000288818082526133523         , -0.0000556684489524527349       , 8.9532983034129605e-6           , -1.23578110582884956e-6         , 1.49418645036883206e-7          , -1.60760422513818869e-8         , 1.55794721903201965e-9          , -1.37414531913719062e-10        , 1.13254507288736051e-11         , -8.4561087089967525e-13         , },
+/* x = 2.0         */  {0.00120620754615921794          , -0.00115078105026987583         , 0.00055010025794656216          , -0.000175643276185970882        , 0.0000421353712466075541        , -8.09947454956454604e-6         , 1.29938368246963536e-6          , -1.78926945863954516e-7         , 2.1586635247027572e-8           , -2.31774250035682684e-9         , 2.24181443444495328e-10         , -1.97373789027384895e-11        , 1.62383720110351571e-12         , -1.21047961318528763e-13        , },
+/* x = 4.0         */  {0.000179675269019713996         , -0.000170679064484108453        , 0.0000812663580317778158        , -0.0000258536920026196043       , 6.18136274084814e-6             , -1.18454318213763343e-6         , 1.89490049530538078e-7          , -2.60236181871172226e-8         , 3.13183483175864706e-9          , -3.35484398203139743e-10        , 3.23791253152299686e-11         , -2.84492654921420643e-12        , 2.33596145806366929e-13         , -1.73820951274168384e-14        , },
+/* x = 6.0         */  {0.0000270039308150004121        , -0.0000255216273393215937       , 0.000012095634788292269         , -3.83181884346992837e-6         , 9.12608412738528155e-7          , -1.74262582871207579e-7         , 2.77851288947354727e-8          , -3.80428453700311597e-9         , 4.56539820451958487e-10         , -4.87766578921703029e-11        , 4.6961529808133403e-12          , -4.11674766805110619e-13        , 3.37277178446402024e-14         , -2.50468704177969423e-15        , },
+/* x = 8.0         */  {4.10128120578580228e-6          , -3.85280069918072451e-6         , 1.81603972703236507e-6          , -5.72465259913390587e-7         , 1.35727195758927795e-7          , -2.58102288472630037e-8         , 4.09970376958544093e-9          , -5.59365222714663055e-10        , 6.69112380364527284e-11         , -7.12743788500376771e-12        , 6.84317499065186034e-13         , -5.98336842228788345e-14        , 4.88984231666361832e-15         , -3.62313388534461449e-16        , },
+/* x = 10.0        */  {6.30682167434514023e-7          , -5.88198230871658351e-7         , 2.75454830055992896e-7          , -8.63234232990074086e-8         , 2.03582345060724762e-8          , -3.85271543828922472e-9         , 6.0927226902742836e-10          , -8.27938792293587576e-11        , 9.86704101756332042e-12         , -1.04744618891061256e-12        , 1.00248698979641133e-13         , -8.73953799311870681e-15        , 7.12213274398229138e-16         , -5.26376494958341937e-17        , },
+/* x = 12.0        */  {9.84352384724293644e-8          , -9.10048769701201378e-8         , 4.22867223952789158e-8          , -1.31597197265247262e-8         , 3.08407286236697207e-9          , -5.80335503605541453e-10        , 9.13015719174777463e-11         , -1.23486064251915603e-11        , 1.46532354355854462e-12         , -1.5493825386052473e-13         , 1.47748420738111204e-14         , -1.28371768178346078e-15        , 1.0427791762164631e-16          , -7.68468729585423329e-18        , },
+/* x = 14.0        */  {1.56403868771802581e-8          , -1.43065287575215345e-8         , 6.58529314361123185e-9          , -2.0322087785921308e-9          , 4.72694543196017899e-10         , -8.83484656955576013e-11        , 1.38148695803262063e-11         , -1.85815702193636233e-12        , 2.19386393898939019e-13         , -2.30906278434308623e-14        , 2.19264608193131005e-15         , -1.89771065768124891e-16        , 1.53585105868109345e-17         , -1.12811192627829619e-18        , },
+/* x = 16.0        */  {2.53935227907368677e-9          , -2.29265235084151674e-9         , 1.04324394122607942e-9          , -3.1868384714322172e-10         , 7.34584389772922044e-11         , -1.36190593775485946e-11        , 2.11417437231930088e-12         , -2.8250904810608216e-13         , 3.31577204797516905e-14         , -3.47112657301524422e-15        , 3.27996913980321289e-16         , -2.82603308583631465e-17        , 2.27743463144417602e-18         , -1.66649730838305926e-19        , },
+/* x = 18.0        */  {4.23220867785586909e-10         , -3.76015377589087139e-10        , 1.68709961372716714e-10         , -5.09018404494783167e-11        , 1.16052509053630644e-11         , -2.1307313064248035e-12         , 3.27902253121579827e-13         , -4.34758318770095608e-14        , 5.06697851576947131e-15         , -5.2707956511750211e-16         , 4.95191434826670529e-17         , -4.24423959981028768e-18        , 3.40345234566753343e-19         , -2.47957068937039684e-20        , },
+/* x = 20.0        */  {7.28071823196580372e-11         , -6.34209887198270535e-11        , 2.79687191009533592e-11         , -8.31171946629452983e-12        , 1.86991145589188508e-12         , -3.39291087093695268e-13        , 5.16698076781180637e-14         , -6.78702472462521082e-15        , 7.84408209638157321e-16         , -8.09834330788438679e-17        , 7.55681639469792823e-18         , -6.43703939572240297e-19        , 5.1320919461333883e-20          , -3.71995437904647095e-21        , },
+/* x = 22.0        */  {1.30116685756363148e-11         , -1.10636875377801691e-11        , 4.77719448950182268e-12         , -1.39367768700069096e-12        , 3.08487960287326697e-13         , -5.51784984162225033e-14        , 8.29716580337993856e-15         , -1.07766048949685384e-15        , 1.23305607010441899e-16         , -1.26162817093293054e-17        , 1.16779207841979657e-18         , -9.87519447369538744e-20        , 7.819888969615678e-21           , -5.6344476835675039e-22         , },
+/* x = 24.0        */  {2.43295134492343377e-12         , -2.00921538692874701e-12        , 8.45636100945376869e-13         , -2.41223128104892504e-13        , 5.23508423947634143e-14         , -9.20252801591119695e-15        , 1.36270409792819295e-15         , -1.74602088635804947e-16        , 1.97379764071603471e-17         , -1.99788659700159695e-18        , 1.83154563724084931e-19         , -1.53544553327305e-20           , 1.20613875019655779e-21         , -8.62967702414759275e-23        , },
+/* x = 26.0        */  {4.79466900490959895e-13         , -3.82507694565482026e-13        , 1.5614211312192953e-13          , -4.33548355614141992e-14        , 9.18773834275527805e-15         , -1.58152558577248238e-15        , 2.2988956148396258e-16          , -2.8976263125309615e-17         , 3.22831232776595359e-18         , -3.22568540107039954e-19        , 2.92317916350149909e-20         , -2.42539359130144598e-21        , 1.88711068870803324e-22         , -1.33899884216135444e-23        , },
+/* x = 28.0        */  {1.00267171561008481e-13         , -7.68653534246501032e-14        , 3.02761702850859524e-14         , -8.14311150672742038e-15        , 1.67754518278631637e-15         , -2.81608200650458688e-16        , 4.00343276116736735e-17         , -4.9476316180012334e-18         , 5.4167280887448898e-19          , -5.3288664617826315e-20         , 4.76277565865244386e-21         , -3.90318717482066082e-22        , 3.00257315297176497e-23         , -2.1095121922041562e-24         , },
+/* x = 30.0        */  {2.23699830488852662e-14         , -1.64026521324662532e-14        , 6.20407405972672601e-15         , -1.60857737367590335e-15        , 3.20633624832325765e-16         , -5.22596254962503881e-17        , 7.2363590094550514e-18          , -8.73578340924011896e-19        , 9.36653283845557403e-20         , -9.04502759577435474e-21        , 7.95154324341426982e-22         , -6.42092811797484676e-23        , 4.87283716855292718e-24         , -3.38343929922975733e-25        , },
+/* x = 32.0        */  {5.34154228100288101e-15         , -3.73323637972775761e-15        , 1.35052800349659932e-15         , -3.36098409625129209e-16        , 6.45330859323017762e-17         , -1.01672711218767844e-17        , 1.36543030585877829e-18         , -1.60367343962597413e-19        , 1.6776575708381067e-20          , -1.58480860468059155e-21        , 1.36610020580191206e-22         , -1.08392239468133731e-23        , 8.09424202219006048e-25         , -5.54205767259519781e-26        , },
+/* x = 34.0        */  {1.36603542961524262e-15         , -9.08187907370024328e-16        , 3.13362112750825058e-16         , -7.46010091061182661e-17        , 1.37456007261428922e-17         , -2.08496205743499244e-18        , 2.704489833886942e-19           , -3.07771007519979197e-20        , 3.12911197141343817e-21         , -2.88089423948113768e-22        , 2.42661554189868416e-23         , -1.88586771974546111e-24        , 1.38167161331982378e-25         , -9.30447229601426489e-27        , },
+/* x = 36.0        */  {3.73555115008800046e-16         , -2.36104863907515693e-16        , 7.75932963189908887e-17         , -1.76333012348641059e-17        , 3.10926763314374382e-18         , -4.5257914408629044e-19         , 5.64998285131827378e-20         , -6.2065160875601401e-21         , 6.10924029213759814e-22         , -5.46124304737512836e-23        , 4.47878961862034247e-24         , -3.39765969429635253e-25        , 2.43431709986419853e-26         , -1.60763091520911172e-27        , },
+},
+/* n = 24 */
+{
+/* x = 0.0         */  {0.00781369393861024438          , -0.00749578091022965933         , 0.00360134631256685041          , -0.00115527233005955376         , 0.000278342244766168509         , -0.0000537197902253007059       , 8.65046772205874178e-6          , -1.19534761811242578e-6         , 1.44684420426448007e-7          , -1.55822995251599521e-8         , 1.51152057957346281e-9          , -1.33437916522696629e-10        , 1.10072218589491844e-11         , -8.22497407928877071e-13        , },
+/* x = 2.0         */  {0.00115078105026987633          , -0.00110020051589332523         , 0.000526929828557870846         , -0.000168541484980001181        , 0.0000404973727483800423        , -7.7963021526791305e-6          , 1.25248861837258321e-6          , -1.72692861552150718e-7         , 2.08596882355651479e-8          , -2.24221854523969277e-9         , 2.17105562962054951e-10         , -1.9133367901469539e-11         , 1.5756616673475769e-12          , -1.17559503924216509e-13        , },
+/* x = 4.0         */  {0.000170679064484108525         , -0.000162532716063584432        , 0.0000775610760078528305        , -0.0000247254509624709348       , 5.9227159107679323e-6           , -1.13694030547785532e-6         , 1.82165326926947916e-7          , -2.5054647055490687e-8          , 3.01936040426963268e-9          , -3.23849183879530357e-10        , 3.12933898320118328e-11         , -2.75259602409327176e-12        , 2.26258949145305411e-13         , -1.68525751943771302e-14        , },
+/* x = 6.0         */  {0.0000255216273393216039        , -0.0000241912695765886802       , 0.0000114954565304089262        , -3.65043365082156084e-6         , 8.71312914367489682e-7          , -1.66710774561378858e-7         , 2.66299917040532309e-8          , -3.65231401898320367e-9         , 4.38990038819348933e-10         , -4.69698616343178084e-11        , 4.52830726259148077e-12         , -3.97461202192928681e-13        , 3.26028123666764028e-14         , -2.42380398091791601e-15        , },
+/* x = 8.0         */  {3.85280069918072599e-6          , -3.63207945406532807e-6         , 1.71739577974004803e-6          , -5.42908783016577506e-7         , 1.29051144237964796e-7          , -2.45982227897156947e-8         , 3.9155565510837087e-9           , -5.35289248280006156e-10        , 6.41469579341753754e-11         , -6.84437767861392437e-12        , 6.5815393440223379e-13          , -5.7628489214889364e-14         , 4.71610752346923128e-15         , -3.49872861691351959e-16        , },
+/* x = 10.0        */  {5.88198230871658564e-7          , -5.50909660112072454e-7         , 2.58970269897004332e-7          , -8.14329380215167301e-8         , 1.92635771916847063e-8          , -3.65563363912314397e-9         , 5.79557153460314319e-10         , -7.8936233060225403e-11         , 9.42701815418905032e-12         , -1.00266130364520537e-12        , 9.61325184639581833e-14         , -8.39443084292212682e-15        , 6.85161974481332389e-16         , -5.07094832855409443e-17        , },
+/* x = 12.0        */  {9.10048769701201687e-8          , -8.45734447905704495e-8         , 3.94791591795715799e-8          , -1.23362914490641146e-8         , 2.9016775180623579e-9           , -5.47809435138829854e-10        , 8.64402448100178645e-11         , -1.17225745047983553e-11        , 1.39444464115127399e-12         , -1.4777380079978093e-13         , 1.41205460132122314e-14         , -1.22918513945708538e-15        , 1.00027657175500371e-16         , -7.38329066755678141e-18        , },
+/* x = 14.0        */  {1.4306528757521539e-8           , -1.31705862872243103e-8         , 6.09662633577601315e-9          , -1.89077817272497888e-9         , 4.41742328482844775e-10         , -8.28892180137916837e-11        , 1.30070991292820484e-11         , -1.75508912515552698e-12        , 2.07815702603351838e-13         , -2.1930175218619252e-14         , 2.08743086680805317e-15         , -1.81060469465453563e-16        , 1.46839483657344415e-17         , -1.08055252542588367e-18        , },
+/* x = 16.0        */  {2.2926523508415174e-9           , -2.08648788245243067e-9         , 9.56051541429609512e-10         , -2.93833755900469925e-10        , 6.80952968884849593e-11         , -1.26850463122058341e-11        , 1.97756333318104063e-12         , -2.65261465590284783e-13        , 3.12401467889968251e-14         , -3.28051592730590397e-15        , 3.10856177179248049e-16         , -2.68520192113451751e-17        , 2.16916005098763586e-18         , -1.5906545532831239e-19         , },
+/* x = 18.0        */  {3.76015377589087237e-10         , -3.37419922745473711e-10        , 1.52705521348426734e-10         , -4.64210036201631696e-11        , 1.06536565322335645e-11         , -1.96741353033126998e-12        , 3.04330822613241245e-13         , -4.05357839288566744e-14        , 4.74371721282683449e-15         , -4.95272463208346614e-16        , 4.66855338679157855e-17         , -4.01342713624736593e-18        , 3.22744818708107568e-19         , -2.35718928512247311e-20        , },
+/* x = 20.0        */  {6.3420988719827068e-11          , -5.59374382019127337e-11        , 2.49351583988823679e-11         , -7.47964582337504864e-12        , 1.69645543548476434e-12         , -3.10018847801133545e-13        , 4.75091729941940956e-14         , -6.27525907739035365e-15        , 7.28851065243266418e-16         , -7.55802634243049679e-17        , 7.08057952459351631e-18         , -6.05291489688135572e-19        , 4.84189744552866503e-20         , -3.51984794929034102e-21        , },
+/* x = 22.0        */  {1.10636875377801713e-11         , -9.55438897900455152e-12        , 4.18103306100188978e-12         , -1.23395184112030952e-12        , 2.75892492083553983e-13         , -4.97829950812550139e-14        , 7.54362341475893816e-15         , -9.86443861891601638e-16        , 1.13546560496189634e-16         , -1.16797434694094824e-17        , 1.08624683793007101e-18         , -9.22479605417008258e-20        , 7.33371078006379616e-21         , -5.30235697895770072e-22        , },
+/* x = 24.0        */  {2.00921538692874734e-12         , -1.69127220189089164e-12        , 7.23669384314649807e-13         , -2.09403369574640773e-13        , 4.60126400799253804e-14         , -8.17622462728511645e-15        , 1.22221461867753538e-15         , -1.57903659958392384e-16        , 1.79809831725127747e-17         , -1.83182301853990235e-18        , 1.68895293594931226e-19         , -1.4231586777730578e-20         , 1.12320894590437774e-21         , -8.06927415427051497e-23        , },
+/* x = 26.0        */  {3.82507694565482076e-13         , -3.12284226243880297e-13        , 1.3006450668423836e-13          , -3.67509533703415428e-14        , 7.90762792891891071e-15         , -1.37933737501990012e-15        , 2.02833841605972961e-16         , -2.5826475322605219e-17         , 2.90311744209409666e-18         , -2.92360632141234521e-19        , 2.66787612875952106e-20         , -2.22725359059397813e-21        , 1.74276473743047059e-22         , -1.24264119518872521e-23        , },
+/* x = 28.0        */  {7.6865353424650111e-14          , -6.05523405701752208e-14        , 2.44293345201816048e-14         , -6.71018073103915474e-15        , 1.40804100326104468e-15         , -2.40205966625038674e-16        , 3.46334212840027049e-17         , -4.33337883291349961e-18        , 4.79598071573141668e-19         , -4.76344264042801931e-20        , 4.29341787988022335e-21         , -3.54487846497044221e-22        , 2.7455663015928049e-23          , -1.94031061985585829e-24        , },
+/* x = 30.0        */  {1.64026521324662544e-14         , -1.24081481194539783e-14        , 4.82573212102760687e-15         , -1.28253449931246337e-15        , 2.61298127482627587e-16         , -4.34181542082875027e-17        , 6.11504837986497784e-18         , -7.49322049715705661e-19        , 8.14052625114808258e-20         , -7.95260173810474856e-21        , 7.06288257899191879e-22         , -5.75502688382173133e-23        , 4.40350202646823532e-24         , -3.07925728139270956e-25        , },
+/* x = 32.0        */  {3.73323637972775781e-15         , -2.70105600699328376e-15        , 1.00829522887537113e-15         , -2.58132343726483273e-16        , 5.08363556096039353e-17         , -8.19258185966715596e-18        , 1.12257140668211926e-18         , -1.3421251227852957e-19         , 1.42632797051166802e-20         , -1.36627141808668254e-21        , 1.19229250712287664e-22         , -9.56366879628292829e-24        , 7.21272116586262997e-25         , -4.98072101150480966e-26        , },
+/* x = 34.0        */  {9.0818790737002436e-16          , -6.26724225501664194e-16        , 2.23803027318352105e-16         , -5.4982402904121042e-17         , 1.04248102872108691e-17         , -1.62269390438690666e-18        , 2.15439705091632524e-19         , -2.50328803246733693e-20        , 2.59280518486069505e-21         , -2.42689873019117738e-22        , 2.07441837968105207e-23         , -1.63329132136619797e-24        , 1.2108945635347691e-25          , -8.23820487253018831e-27        , },
+/* x = 36.0        */  {2.36104863907515699e-16         , -1.55186592637984168e-16        , 5.28999037045918676e-17         , -1.24370705324984905e-17        , 2.26289572043745247e-18         , -3.38998971767459373e-19        , 4.34456125841196823e-20         , -4.88738961137504322e-21        , 4.91511935980829584e-22         , -4.47927038004347889e-23        , 3.73736531814835652e-24         , -2.87922315927240582e-25        , 2.09211457441298192e-26         , -1.39857868548774729e-27        , },
+},
+/* n = 25 */
+{
+/* x = 0.0         */  {0.00749578091022966273          , -0.00720269262513506905         , 0.00346581699017837602          , -0.00111336897902089051         , 0.000268598951130307152         , -0.0000519028067264042209       , 8.36743330852959523e-6          , -1.15747386226198319e-6         , 1.40240734849407994e-7          , -1.51179579033362229e-8         , 1.4677788281805356e-9           , -1.2968482294599835e-10         , 1.07063766918489749e-11         , -8.00613120463954291e-13        , },
+/* x = 2.0         */  {0.00110020051589332571          , -0.00105385965711593697         , 0.000505624454939962883         , -0.000161989490987271244        , 0.0000389815107639377744        , -7.51493176647583143e-6         , 1.20885002826286983e-6          , -1.66877291635636823e-7         , 2.01799724832683699e-8          , -2.17144841924187606e-9         , 2.10461594718610789e-10         , -1.85651417931950313e-11        , 1.53025616830722896e-12         , -1.14266071658630499e-13        , },
+/* x = 4.0         */  {0.000162532716063584501         , -0.00015512215201573361         , 0.0000741763528874069938        , -0.0000236908636421773566       , 5.68470152746675017e-6          , -1.09299196961104122e-6         , 1.75382529016561713e-7          , -2.41548525699524124e-8         , 2.91464345178669257e-9          , -3.12990116028641552e-10        , 3.02777771023492859e-11         , -2.66604466230521554e-12        , 2.19366809409340313e-13         , -1.63542424794831296e-14        , },
+/* x = 6.0         */  {0.0000241912695765886901        , -0.0000229909130608218651       , 0.0000109513009524638497        , -3.48525165734155516e-6         , 8.33553872817998421e-7          , -1.59779951379951537e-7         , 2.55661980795826013e-8          , -3.51191590814659713e-9         , 4.22728868922769729e-10         , -4.52911437076044285e-11        , 4.37196154829963797e-12         , -3.84189895289175101e-13        , 3.15500611419610952e-14         , -2.34795103698057737e-15        , },
+/* x = 8.0         */  {3.63207945406532949e-6          , -3.43479155948067412e-6         , 1.62872634904961276e-6          , -5.1620457693336107e-7          , 1.2299111395017518e-7           , -2.34933394729852871e-8         , 3.74702473029585243e-9          , -5.13175029252317831e-10        , 6.15994155307910287e-11         , -6.58270208267848605e-12        , 6.33897323059533783e-13         , -5.55785365453560206e-14        , 4.55418658535092844e-15         , -3.38251245424918252e-16        , },
+/* x = 10.0        */  {5.5090966011207266e-7           , -5.17940539794092261e-7         , 2.44298814064532908e-7          , -7.70543087640637312e-8         , 1.82781681958461456e-8          , -3.47734294483773281e-9         , 5.52553630315534256e-10         , -7.54160535160004029e-11        , 9.02395410290020229e-12         , -9.6149333341158126e-13         , 9.23364218475306587e-14         , -8.07519567457648894e-15        , 6.60065982571209111e-16         , -4.89160063998332416e-17        , },
+/* x = 12.0        */  {8.45734447905704793e-8          , -7.8958318359155301e-8          , 3.70088743471898397e-8          , -1.16067100718609154e-8         , 2.73904717572753672e-9          , -5.18641472356753067e-10        , 8.20580213733287371e-11         , -1.11555438086544582e-11        , 1.32996455061177771e-12         , -1.41229881150967436e-13        , 1.35207007516952537e-14         , -1.1790189969320792e-15         , 9.61048813446692446e-17         , -7.10429639130841859e-18        , },
+/* x = 14.0        */  {1.31705862872243147e-8          , -1.21932526715537981e-8         , 5.67233451817457217e-9          , -1.766969313874681e-9           , 4.1444609007381793e-10          , -7.8042595285975211e-11         , 1.22856238527630323e-11         , -1.66252367689187907e-12        , 1.9737162695112307e-13          , -2.08778725487958683e-14        , 1.99161629131573808e-15         , -1.73097084491792283e-16        , 1.40649547593550748e-17         , -1.03676529900700493e-18        , },
+/* x = 16.0        */  {2.08648788245243131e-9          , -1.912103082859479e-9           , 8.81501267701356459e-10         , -2.72381187545620502e-10        , 6.34252315617400667e-11         , -1.18653800739602597e-11        , 1.85683025571969046e-12         , -2.49920889077628337e-13        , 2.95246506578310433e-14         , -3.10908470142729797e-15        , 2.95365061737509458e-16         , -2.55735456578291058e-17        , 2.07045076919077653e-18         , -1.52124984674174838e-19        , },
+/* x = 18.0        */  {3.37419922745473804e-10         , -3.05411042696891852e-10        , 1.39263010860481664e-10         , -4.26146261277059985e-11        , 9.83706765176094593e-12         , -1.82598494673378267e-12        , 2.83750486999935675e-13         , -3.79496955908615479e-14        , 4.45745324472021864e-15         , -4.66932543559892674e-16        , 4.41466465612907769e-17         , -3.80555901949235806e-18        , 3.06817129767829969e-19         , -2.24596016683109175e-20        , },
+/* x = 20.0        */  {5.59374382019127475e-11         , -4.98703167977704427e-11        , 2.24389374701239841e-11         , -6.78582174175643511e-12        , 1.55009423902115816e-12         , -2.8505503960876465e-13         , 4.39268134673784045e-14         , -5.83080226061250773e-15        , 6.8022253014889699e-16          , -7.08172743575784666e-17        , 6.65805059708726249e-18         , -5.71009559665647711e-19        , 4.58146740615849077e-20         , -3.33937793259736441e-21        , },
+/* x = 22.0        */  {9.55438897900455358e-12         , -8.36206612200463498e-12        , 3.70185552336075523e-12         , -1.10356996830684229e-12        , 2.48914975408586387e-13         , -4.526174073491645e-14          , 6.9051070221468878e-15          , -9.08371545444484664e-16        , 1.05117714998236044e-16         , -1.0864189008526792e-17         , 1.01470432070913355e-18         , -8.65028893089122212e-20        , 6.90151689067247708e-21         , -5.00546683951110879e-22        , },
+/* x = 24.0        */  {1.69127220189089195e-12         , -1.44733876862942904e-12        , 6.2821010872389623e-13          , -1.84050560315559914e-13        , 4.08811231367734309e-14         , -7.33328774933968656e-15        , 1.10532561803907335e-15         , -1.43847723382104857e-16        , 1.64864107447305529e-17         , -1.68921326561110281e-18        , 1.5654395619185871e-19          , -1.32513105551080507e-20        , 1.05027777211976629e-21         , -7.5732265248160713e-23         , },
+/* x = 26.0        */  {3.12284226243880345e-13         , -2.60129013368496516e-13        , 1.10252860111020663e-13         , -3.16305117150421946e-14        , 6.89668687515237391e-15         , -1.21700305533687248e-15        , 1.80785327004444532e-16         , -2.32249178185252975e-17        , 2.63124623311111158e-18         , -2.66827429626324338e-19        , 2.449925774186623e-20           , -2.05656852095534409e-21        , 1.6173672070818136e-22          , -1.15830546537402071e-23        , },
+/* x = 28.0        */  {6.0552340570175228e-14          , -4.88586690403662757e-14        , 2.01305421931168545e-14         , -5.63216401294606383e-15        , 1.20102983313332342e-15         , -2.07800528587050123e-16        , 3.03336517913702721e-17         , -3.83678120864649177e-18        , 4.2870992126186144e-19          , -4.29403460196451287e-20        , 3.89928454642422266e-21         , -3.24085654364609879e-22        , 2.52537708011311668e-23         , -1.79410060884223642e-24        , },
+/* x = 30.0        */  {1.24081481194539794e-14         , -9.65146424205569571e-15        , 3.84760349793729508e-15         , -1.04519250991508748e-15        , 2.17090771042704545e-16         , -3.66902904179957044e-17        , 5.2452543419281913e-18          , -6.51241571307704281e-19        , 7.15734286752605859e-20         , -7.06385201658618109e-21        , 6.33040214509604864e-22         , -5.19959696898989958e-23        , 4.00766817882346145e-24         , -2.82018209239942668e-25        , },
+/* x = 32.0        */  {2.70105600699328393e-15         , -2.01659045775081933e-15        , 7.74397031179434775e-16         , -2.03345422435949144e-16        , 4.09629092985363663e-17         , -6.73542846229208956e-18        , 9.39487584986891809e-19         , -1.1410615307188962e-19         , 1.22964448259555329e-20         , -1.19244755036988288e-21        , 1.0519833943206417e-22          , -8.51995492892061968e-24        , 6.48227304967640269e-25         , -4.51034900381787599e-26        , },
+/* x = 34.0        */  {6.26724225501664223e-16         , -4.4760605463671679e-16         , 1.649472087123607e-16           , -4.16992411484409285e-17        , 8.1134695219668772e-18          , -1.29263823417272481e-18        , 1.75230162117462872e-19         , -2.07424276772487411e-20        , 2.18420918985216074e-21         , -2.07467140968940532e-22        , 1.7965879247818217e-23          , -1.43099085733089406e-24        , 1.07214949601059934e-25         , -7.3608729702762864e-27         , },
+/* x = 36.0        */  {1.55186592637984172e-16         , -1.05799807409185837e-16        , 3.73112115974950719e-17         , -9.05158288168254326e-18        , 1.6949948588426253e-18          , -2.60673676110117627e-19        , 3.4211727254048802e-20          , -3.93209318156269988e-21        , 4.03134389010699949e-22         , -3.73778813687010122e-23        , 3.1670918863413942e-24          , -2.47363694630695044e-25        , 1.82010097688869682e-26         , -1.23001809962092888e-27        , },
+},
+/* n = 26 */
+{
+/* x = 0.0         */  {0.00720269262513507236          , -0.00693163398035808481         , 0.00334010693706239345          , -0.00107439580447857987         , 0.000259514033635728626         , -0.0000502046002350161704       , 8.10231701803778211e-6          , -1.12192441655298188e-6         , 1.36061659264526463e-7          , -1.46804690593224837e-8         , 1.42649576533886925e-9          , -1.26136932650876272e-10        , 1.04215294995268978e-11         , -7.79862550437142273e-13        , },
+/* x = 2.0         */  {0.00105385965711593744          , -0.00101124890988011572         , 0.000485968472961774151         , -0.000155926043049672484        , 0.0000375746588329068934        , -7.25310022428473827e-6         , 1.16814103891632386e-6          , -1.61439571456549674e-7         , 1.95430412013209624e-8          , -2.10499803144779789e-9         , 2.04211252206491392e-10         , -1.80296186640300188e-11        , 1.48738893834545192e-12         , -1.11151785218909598e-13        , },
+/* x = 4.0         */  {0.000155122152015733677         , -0.000148352705774841134        , 0.0000710725909265264215        , -0.0000227388061089983209       , 5.46495984813051563e-6          , -1.05229518191748815e-6         , 1.69083967628181113e-7          , -2.33171178309873771e-8         , 2.81691181887014751e-9          , -3.02832373751459137e-10        , 2.93257338865921247e-11         , -2.58474842305060448e-12        , 2.12880569966097489e-13         , -1.58844299538264249e-14        , },
+/* x = 6.0         */  {0.0000229909130608218747        , -0.0000219026019049315902       , 0.0000104557549720238572        , -3.33421549114748799e-6         , 7.98899756910534532e-7          , -1.53397189598046871e-7         , 2.45834113052973035e-8          , -3.38182668261544195e-9         , 4.07620404216032126e-10         , -4.37274415553088373e-11        , 4.22598046386848463e-12         , -3.71770706958115597e-13        , 3.05627759579989531e-14         , -2.27667558180584863e-15        , },
+/* x = 8.0         */  {3.4347915594806755e-6           , -3.257452698099785e-6           , 1.54861373079996719e-6          , -4.91964455782797626e-7         , 1.17466697366473353e-7          , -2.24821485429029563e-8         , 3.59222519734101838e-9          , -4.92794710425978684e-10        , 5.92443346552630336e-11         , -6.34009856790283933e-12        , 6.11348344423516252e-13         , -5.36681264649371069e-14        , 4.40292349066938268e-15         , -3.27370853091344817e-16        , },
+/* x = 10.0        */  {5.1794053979409246e-7           , -4.88597628129146555e-7         , 2.31162926292174483e-7          , -7.31126727808009413e-8         , 1.73867147244114666e-8          , -3.31532180514597466e-9         , 5.27912373542550561e-10         , -7.21915442412239927e-11        , 8.65344229238764418e-12         , -9.2352661876762022e-13         , 8.88249116632266022e-14         , -7.7790606266535206e-15         , 6.36722903966841624e-16         , -4.72437214003295768e-17        , },
+/* x = 12.0        */  {7.89583183591553297e-8          , -7.40177486943913779e-8         , 3.48201302155803303e-8          , -1.0956188702535793e-8          , 2.59320736181597726e-9          , -4.92348131609157372e-10        , 7.80888065059639877e-11         , -1.06397035699039364e-11        , 1.27106926168132097e-12         , -1.35230538332475658e-13        , 1.29688850063635863e-14         , -1.1327225916794888e-15         , 9.24736566831130345e-17         , -6.8453281521807129e-18         , },
+/* x = 14.0        */  {1.21932526715538023e-8          , -1.1344669036350847e-8          , 5.30090794162369223e-9          , -1.65778436024078515e-9         , 3.90212976434552866e-10         , -7.37137436069573138e-11        , 1.16376657157944618e-11         , -1.57897114749805132e-12        , 1.87900901043502158e-13         , -1.99195877832016648e-14        , 1.90402089405569065e-15         , -1.65790479619067585e-16        , 1.34950526521908685e-17         , -9.96325831064437382e-19        , },
+/* x = 16.0        */  {1.91210308285947961e-9          , -1.76300253540296201e-9         , 8.17143562636810337e-10         , -2.53700926238989491e-10        , 5.93269003704835509e-11         , -1.11409816060551242e-11        , 1.74944622026858592e-12         , -2.36196931978909545e-13        , 2.79817693303008985e-14         , -2.95415163756289781e-15        , 2.81302140724352621e-16         , -2.44081552482065032e-17        , 1.98011989595247022e-18         , -1.45751327360938389e-19        , },
+/* x = 18.0        */  {3.05411042696891941e-10         , -2.78526021720999977e-10        , 1.27843878383110491e-10         , -3.93482706058710306e-11        , 9.12992473376897491e-12         , -1.7025029325543923e-12         , 2.65647868655735238e-13         , -3.56595857490827089e-14        , 4.20239392124388377e-15         , -4.41540181524481471e-16        , 4.18601428807851152e-17         , -3.61747167074963826e-18        , 2.92340761190159569e-19         , -2.14446288214404576e-20        , },
+/* x = 20.0        */  {4.98703167977704559e-11         , -4.48778749402533958e-11        , 2.0357465225268198e-11          , -6.20037695591095194e-12        , 1.42527519805858807e-12         , -2.63560882367396557e-13        , 4.08156157534164244e-14         , -5.44177428642496593e-15        , 6.37355621084912722e-16         , -6.65914230422576169e-17        , 6.28095666443130203e-18         , -5.40248462803025889e-19        , 4.34659101749740244e-20         , -3.1758753119976676e-21         , },
+/* x = 22.0        */  {8.36206612200463694e-12         , -7.40371104672232028e-12        , 3.31070990492036232e-12         , -9.95659901608430989e-13        , 2.26308703676776047e-13         , -4.14306423661123517e-14        , 6.35860080758116665e-15         , -8.40940831486745863e-16        , 9.77777236415111274e-17         , -1.01486721221858959e-17        , 9.51509719067368334e-19         , -8.1396604060089734e-20         , 6.51512992069756869e-21         , -4.73866209326663635e-22        , },
+/* x = 24.0        */  {1.44733876862942933e-12         , -1.25642021744791434e-12        , 5.52151680946655099e-13         , -1.63524492543193674e-13        , 3.66664387470269897e-14         , -6.63195374333488875e-15        , 1.00693406209766065e-15         , -1.31891152241849623e-16        , 1.52029227699428104e-17         , -1.5656847079090532e-18         , 1.45761111762034178e-19         , -1.23893876737576874e-20        , 9.85721027918591064e-22         , -7.13151972265026826e-23        , },
+/* x = 26.0        */  {2.6012901336849656e-13          , -2.20505720222059851e-13        , 9.48915351451228593e-14         , -2.7586747500016691e-14         , 6.08501527673402079e-15         , -1.0847119673619089e-15         , 1.62574424491316809e-16         , -2.10499495401585723e-17        , 2.4014473774089349e-18          , -2.45029839424249557e-19        , 2.26217543089821703e-20         , -1.90832107998566107e-21        , 1.50761318326482561e-22         , -1.08398561708384142e-23        , },
+/* x = 28.0        */  {4.88586690403662825e-14         , -4.02610843862365574e-14        , 1.68964920388376226e-14         , -4.80411933244214252e-15        , 1.03900264294283577e-15         , -1.82001911568582062e-16        , 2.68574684241166752e-17         , -3.42967624491230149e-18        , 3.86463192195593003e-19         , -3.89985749656572796e-20        , 3.56486591297468251e-21         , -2.9804495746952775e-22         , 2.33510479280494963e-23         , -1.66676404801541724e-24        , },
+/* x = 30.0        */  {9.65146424205569676e-15         , -7.69520699587503408e-15        , 3.13557752974517447e-15         , -8.68363084156612902e-16        , 1.83451452091151443e-16         , -3.14715261794166353e-17        , 4.55869099352391178e-18         , -5.72586942364037131e-19        , 6.35746802136003187e-20         , -6.33129504818323492e-21        , 5.71943870360304323e-22         , -4.73127572697916903e-23        , 3.67052625778639323e-24         , -2.59753625363282375e-25        , },
+/* x = 32.0        */  {2.0165904577508195e-15          , -1.54879406235893983e-15        , 6.10036267307833633e-16         , -1.63851637191896636e-16        , 3.36771423116444339e-17         , -5.63692553016081287e-18        , 7.98743070620093948e-19         , -9.83714815049318459e-20        , 1.07320298457576448e-20         , -1.05212474929340693e-21        , 9.37176538433990191e-23         , -7.65536331974384601e-24        , 5.87018234033704741e-25         , -4.11214466226124062e-26        , },
+/* x = 34.0        */  {4.47606054636716817e-16         , -3.29894417424732732e-16        , 1.25097723445320585e-16         , -3.24538780875049001e-17        , 6.46319117089297039e-18         , -1.05138097596825535e-18        , 1.45196993599878791e-19         , -1.74736610865196677e-20        , 1.86720457056845774e-21         , -1.79681585023815636e-22        , 1.57406042903800594e-23         , -1.26668771902351252e-24        , 9.57986723444190762e-26         , -6.63055872973556349e-27        , },
+/* x = 36.0        */  {1.05799807409185842e-16         , -7.46224231949920105e-17        , 2.71547486450472718e-17         , -6.77997943531076532e-18        , 1.3033683805553611e-18          , -2.05270364061915908e-19        , 2.75246522480286814e-20         , -3.22507306399761435e-21        , 3.36400981411633006e-22         , -3.16746736913868695e-23        , 2.72095263857650236e-24         , -2.1513517645027055e-25         , 1.60076906991241202e-26         , -1.09231359212435648e-27        , },
+},
+/* n = 27 */
+{
+/* x = 0.0         */  {0.00693163398035808804          , -0.00668021387412608601         , 0.00322318741343546841          , -0.00103805613450134326         , 0.000251023001178697006         , -0.0000486139024823678785       , 7.85347089851333508e-6          , -1.08849184881645595e-6         , 1.32124258728626876e-7          , -1.42675707029409036e-8         , 1.38746989098454973e-9          , -1.2277787438512036e-10         , 1.01514379466243994e-11         , -7.60159869734137613e-13        , },
+/* x = 2.0         */  {0.00101124890988011618          , -0.000971936945923733217        , 0.000467778129148978896         , -0.000150298635325710253        , 0.0000362655011219377843        , -7.00884628675383194e-6         , 1.13007699772820159e-6          , -1.56344126730991416e-7         , 1.89449875708433159e-8          , -2.04248446795476693e-9         , 1.98320634998153919e-10         , -1.75240599380918865e-11        , 1.44685331918265661e-12         , -1.0820244068451217e-13         , },
+/* x = 4.0         */  {0.000148352705774841199         , -0.000142145181853079231        , 0.0000682164183269894681        , -0.0000218598393916776457       , 5.26147590966070347e-6          , -1.01450381336883835e-6         , 1.63219824465250534e-7          , -2.25352655995262194e-8         , 2.72549211732264472e-9          , -2.93310416496682451e-10        , 2.84314958398111114e-11         , -2.50824454365611918e-12        , 2.06765521670848192e-13         , -1.54407653123502291e-14        , },
+/* x = 6.0         */  {0.0000219026019049315996        , -0.0000209115099440514905       , 0.0000100026464734416788        , -3.19559902752130186e-6         , 7.66985948000702567e-7          , -1.47500468919310224e-7         , 2.36727867280606704e-8          , -3.26095909077053082e-9         , 3.93547081670829287e-10         , -4.22674000611828546e-11        , 4.08937249622395903e-12         , -3.60124579134089303e-13        , 2.96350663144987707e-14         , -2.20957745396604499e-15        , },
+/* x = 8.0         */  {3.25745269809978634e-6          , -3.09722746160047641e-6         , 1.47589336734828037e-6          , -4.69866789448548537e-7         , 1.12410742716014901e-7          , -2.15533513401499999e-8         , 3.44956296578127934e-9          , -4.73954082560619866e-10        , 5.70609025409215155e-11         , -6.11457369362323315e-12        , 5.90334304202701389e-13         , -5.18835915129891355e-14        , 4.26130723986267751e-15         , -3.17163458347818879e-16        , },
+/* x = 10.0        */  {4.88597628129146748e-7          , -4.62325852584427035e-7         , 2.19338018342386649e-7          , -6.95468588951476944e-8         , 1.65766090259455362e-8          , -3.16747426373885176e-9         , 5.0534080865338618e-10          , -6.92274526874882063e-11        , 8.31174178715522949e-12         , -8.88406144589335796e-13        , 8.55674979409111606e-14         , -7.50363226688666093e-15        , 6.14957088123399428e-16         , -4.568086023847952e-17          , },
+/* x = 12.0        */  {7.40177486943914057e-8          , -6.96402604311719473e-8         , 3.28685661076050453e-8          , -1.03728294469027347e-8         , 2.4617406580769022e-9           , -4.68532842286352834e-10        , 7.44779248399739189e-11         , -1.016854171033092e-11          , 1.21707516503578573e-12         , -1.29711552449656688e-13        , 1.24596355770474565e-14         , -1.08987088876099986e-15        , 8.91030592245020777e-17         , -6.60433047878551891e-18        , },
+/* x = 14.0        */  {1.13446690363508511e-8          , -1.06018158832490232e-8         , 4.97335308072201742e-9          , -1.56085190568577325e-9         , 3.68568718039293704e-10         , -6.98259947667106881e-11        , 1.10527980108521125e-11         , -1.50320541046642698e-12        , 1.79276336407915116e-13         , -1.9043505056805755e-14         , 1.82364994691183606e-15         , -1.59064021281840841e-16        , 1.29687190394403692e-17         , -9.58870181483193683e-19        , },
+/* x = 16.0        */  {1.76300253540296259e-9          , -1.63428712527385973e-9         , 7.6110277871691929e-10          , -2.37307601474284566e-10        , 5.57049080309314031e-11         , -1.04966773904582535e-11        , 1.65337852070461245e-12         , -2.23853892369119655e-13        , 2.65873714832539924e-14         , -2.81350224160400322e-15        , 2.68483112435424115e-16         , -2.33418014913769819e-17        , 1.89716554472762461e-18         , -1.39879086684220245e-19        , },
+/* x = 18.0        */  {2.78526021721000062e-10         , -2.55687756766256042e-10        , 1.180448118176059e-10           , -3.65196989339539838e-11        , 8.51251466286785581e-12         , -1.59388722203165461e-12        , 2.496170997832862e-13           , -3.36191129042627824e-14        , 3.97386262006196805e-15         , -4.18671949236378705e-16        , 3.97912239553141984e-17         , -3.44654403302150451e-18        , 2.79130873926661379e-19         , -2.05150337534701064e-20        , },
+/* x = 20.0        */  {4.48778749402534084e-11         , -4.07149304505415693e-11        , 1.86011308677317982e-11         , -5.70110079206880655e-12        , 1.31780441185108488e-12         , -2.44893696010410077e-13        , 3.80924199372846871e-14         , -5.09883929282585102e-15        , 5.99322952430477975e-16         , -6.28199723756394081e-17        , 5.94259126401073761e-18         , -5.12509556578477137e-19        , 4.13379524459868305e-20         , -3.02712184040371853e-21        , },
+/* x = 22.0        */  {7.40371104672232215e-12         , -6.6214198098414933e-12         , 2.98697970482513643e-12         , -9.0523481468250715e-13         , 2.07153211832648969e-13         , -3.81516050668603362e-14        , 5.88658581038861019e-15         , -7.8222094580509336e-16         , 9.13380705681248799e-17         , -9.51664329016572592e-18        , 8.95341653285877474e-19         , -7.68322358553154829e-20        , 6.16789394855920909e-21         , -4.49774397685113804e-22        , },
+/* x = 24.0        */  {1.25642021744791461e-12         , -1.10430336189342532e-12        , 4.90573477629557681e-13         , -1.46665754984424185e-13        , 3.31597687169856412e-14         , -6.04160440573993121e-15        , 9.23238064199199416e-16         , -1.21623255858714707e-16        , 1.40911655720699373e-17         , -1.45784266913793182e-18        , 1.36280134653730727e-19         , -1.16265710105808757e-20        , 9.28235657618656595e-22         , -6.73604414807390171e-23        , },
+/* x = 26.0        */  {2.20505720222059893e-13         , -1.89783070290263117e-13        , 8.27602425000465637e-14         , -2.43400611063793201e-14        , 5.42355983685633559e-15         , -9.7544655195876807e-16         , 1.47349646556512839e-16         , -1.92115599302535044e-17        , 2.20526903609788887e-18         , -2.26252539622775567e-19        , 2.09910612953025928e-20         , -1.77859339115805501e-21        , 1.41089251871691735e-22         , -1.01808095865785754e-23        , },
+/* x = 28.0        */  {4.02610843862365637e-14         , -3.37929840776779028e-14        , 1.44123579973258948e-14         , -4.15601057168630036e-15        , 9.10009557850014364e-16         , -1.61144811310084622e-16        , 2.40077336802866586e-17         , -3.0917026218139967e-18         , 3.50987247761169498e-19         , -3.56540046727835837e-20        , 3.27842308569424544e-21         , -2.75547373940877351e-22        , 2.16939131589494473e-23         , -1.55506706523886826e-24        , },
+/* x = 30.0        */  {7.69520699587503505e-15         , -6.27115505949075988e-15        , 2.6050892524697569e-15          , -7.33805808351455493e-16        , 1.57357630898173941e-16         , -2.73521460794959664e-17        , 4.0081085913125923e-18          , -5.08596990842152314e-19        , 5.69816666529368792e-20         , -5.7202652924618084e-21         , 5.20429359997449599e-22         , -4.33249284530598449e-23        , 3.38078620981685042e-24         , -2.40462213458957958e-25        , },
+/* x = 32.0        */  {1.54879406235893998e-15         , -1.22007253461573173e-15        , 4.91554911575677183e-16         , -1.34708569244514996e-16        , 2.81846276509737431e-17         , -4.79245844228521794e-18        , 6.88600369720064807e-19         , -8.58561680435687933e-20        , 9.46912448890804947e-21         , -9.37306196336659523e-22        , 8.42072900335149138e-23         , -6.93106282062031268e-24        , 5.35199345609376667e-25         , -3.77186625947147347e-26        , },
+/* x = 34.0        */  {3.29894417424732756e-16         , -2.50195446890651451e-16        , 9.73616342625126904e-17         , -2.58527646832428747e-17        , 5.25690487986807653e-18         , -8.71181964560334475e-19        , 1.22315627476998852e-19         , -1.49376252843125042e-20        , 1.6171345408689595e-21          , -1.5742672333492303e-22         , 1.39332953802980559e-23         , -1.13153569188072185e-24        , 8.62952740176829893e-26         , -6.01612541743568787e-27        , },
+/* x = 36.0        */  {7.46224231949920144e-17         , -5.43094972900962158e-17        , 2.03399383059319728e-17         , -5.21347352216793504e-18        , 1.02635182031388814e-18         , -1.65147913969756226e-19        , 2.2575511427302019e-20          , -2.69120601668682312e-21        , 2.85072107539513606e-22         , -2.72128898305400646e-23        , 2.36644360874412389e-24         , -1.89156918403999112e-25        , 1.42158338644719633e-26         , -9.78456661830110196e-28        , },
+},
+/* n = 28 */
+{
+/* x = 0.0         */  {0.00668021387412608916          , -0.0064463748268722039          , 0.00311416840350376509          , -0.0010040920046742412          , 0.000243069512415368572         , -0.0000471208257560014547       , 7.61944292477513052e-6          , -1.05699267965208447e-6         , 1.28408172626599104e-7          , -1.38772475675514791e-8         , 1.35052112477492894e-9          , -1.19592972270635996e-10        , 9.89498501977834277e-12         , -7.41427696285599026e-13        , },
+/* x = 2.0         */  {0.000971936945923733665         , -0.000935556258298137928        , 0.000450895905977093173         , -0.000145062004481986785        , 0.0000350442314342702958        , -6.78046203824837794e-6         , 1.0944088847114865e-6           , -1.51559702931819171e-7         , 1.83823653661359207e-8          , -1.98356868068169086e-9         , 1.92759619321392818e-10         , -1.70460239464231497e-11        , 1.40846445530517972e-12         , -1.05405294589576538e-13        , },
+/* x = 4.0         */  {0.000142145181853079295         , -0.000136432836654004607        , 0.0000655795181750275877        , -0.0000210459036378213458       , 5.07251906691551566e-6          , -9.79318954184716351e-7         , 1.57746858854328822e-7          , -2.18039087739596448e-8         , 2.63979448208738722e-9          , -2.84366593537551559e-10        , 2.75899726655775973e-11         , -2.43612286562942656e-12        , 2.00990790747721606e-13         , -1.50211314735839119e-14        , },
+/* x = 6.0         */  {0.0000209115099440514996        , -0.0000200052929468870257       , 9.58679708256314233e-6          , -3.0679437918854344e-6          , 7.375023446067278e-7            , -1.42036721424746843e-7         , 2.28267135865456523e-8          , -3.14837262905112779e-9         , 3.80406705225067374e-10         , -4.09011028740015324e-11        , 3.9612680221515592e-12          , -3.4918189096356309e-13         , 2.87617244737124492e-14         , -2.14630160347405254e-15        , },
+/* x = 8.0         */  {3.09722746160047771e-6          , -2.95178673469708637e-6         , 1.40960036834553641e-6          , -4.49642970847239428e-7         , 1.07766756702206049e-7          , -2.06973779460692471e-8         , 3.31767857093529992e-9          , -4.56486643635672923e-10        , 5.50311782191215421e-11         , -5.90440031014221503e-12        , 5.70704862941824357e-13         , -5.02129801596311351e-14        , 4.12844994072387586e-15         , -3.07568906240331702e-16        , },
+/* x = 10.0        */  {4.62325852584427221e-7          , -4.38676036684848865e-7         , 2.08640576685427411e-7          , -6.6306436101364021e-8          , 1.58373713189032213e-8          , -3.03204487368342987e-9         , 4.84592167809397509e-10         , -6.64938513901455077e-11        , 7.99565745063245301e-12         , -8.55826975752380059e-13        , 8.25378533701764394e-14         , -7.2468337033555973e-15         , 5.94615388764535891e-16         , -4.42171180417319452e-17        , },
+/* x = 12.0        */  {6.96402604311719742e-8          , -6.57371322152209931e-8         , 3.11184883407059473e-8          , -9.84696263195872898e-9         , 2.34266421146185427e-9          , -4.46867552179761987e-10        , 7.11797918278839646e-11         , -9.73658935869209926e-12        , 1.16740428154507219e-12         , -1.24618285359816582e-13        , 1.19882771559459368e-14         , -1.05009815999553774e-15        , 8.59663400151432581e-17         , -6.37951689949573129e-18        , },
+/* x = 14.0        */  {1.0601815883249027e-8           , -9.94670616144561409e-9         , 4.68255571705699356e-9          , -1.47427487210663894e-9         , 3.49129973837902598e-10         , -6.63167885199355724e-11        , 1.05224378523890316e-11         , -1.43420895860466386e-12        , 1.71391590245445934e-13         , -1.82396760099896568e-14        , 1.74966049399931368e-15         , -1.5285237462197139e-16         , 1.24812178505308175e-17         , -9.24084617104347035e-19        , },
+/* x = 16.0        */  {1.63428712527386029e-9          , -1.52220555743406836e-9         , 7.11922804422806354e-10         , -2.22819632116372747e-10        , 5.24833869529225186e-11         , -9.92027119040346031e-12        , 1.56697724355383272e-12         , -2.12698719767801155e-13        , 2.53215266673035907e-14         , -2.68529330444401301e-15        , 2.5675346782353092e-16          , -2.23626293674760526e-17        , 1.82073670202791082e-18         , -1.34452389751814228e-19        , },
+/* x = 18.0        */  {2.55687756766256124e-10         , -2.36089623635245399e-10        , 1.09559096801855047e-10         , -3.40500586503962279e-11        , 7.96943611025032536e-12         , -1.49770260837647493e-12        , 2.35333789887988288e-13         , -3.17908640966567538e-14        , 3.768048489951384e-15           , -3.9797982325795808e-16         , 3.7911058579793689e-17          , -3.2905883447349804e-18         , 2.67032087319787977e-19         , -1.96607141283187149e-20        , },
+/* x = 20.0        */  {4.07149304505415813e-11         , -3.72022617354685375e-11        , 1.71033023762054076e-11         , -5.27121764724622371e-12        , 1.22446848006554502e-12         , -2.28554521046750511e-13        , 3.5691874985006691e-14          , -4.79457819832996447e-15        , 5.65379890182753482e-16         , -5.94358513488494792e-17        , 5.63746940485330191e-18         , -4.87381647176915674e-19        , 3.94019357470471029e-20         , -2.89126072497543049e-21        , },
+/* x = 22.0        */  {6.62141980984149508e-12         , -5.97395940965100417e-12        , 2.71570444404737219e-12         , -8.2861284730719379e-13         , 1.90758025336291827e-13         , -3.53195150729504412e-14        , 5.47554661108295515e-15         , -7.30703762187741752e-16        , 8.56498100815594696e-17         , -8.95488752116380249e-18        , 8.45134579230932563e-19         , -7.2730955771049934e-20         , 5.85434541628384258e-21         , -4.27923870553525024e-22        , },
+/* x = 24.0        */  {1.10430336189342558e-12         , -9.81146955259224398e-13        , 4.39997264953250392e-13         , -1.32639074864453407e-13        , 3.02080220289951601e-14         , -5.5394284165976221e-15         , 8.51362789592583341e-16         , -1.12729204948271461e-16        , 1.31205870617119777e-17         , -1.36302066506537639e-18        , 1.27889309189589252e-19         , -1.09474226305635583e-20        , 8.76766439904291135e-22         , -6.38017536201069617e-23        , },
+/* x = 26.0        */  {1.89783070290263157e-13         , -1.65520485000109522e-13        , 7.30201833191346439e-14         , -2.16942393469007241e-14        , 4.8772327598380606e-15          , -8.84097884060641286e-16        , 1.34480919299517326e-16         , -1.76421343018716807e-17        , 2.03627331144184784e-18         , -2.09943588957314611e-19        , 1.95640825733568183e-20         , -1.66429196417199614e-21        , 1.32512244400716665e-22         , -9.5930194294348943e-24         , },
+/* x = 28.0        */  {3.37929840776779088e-14         , -2.88247159946542785e-14        , 1.24680317150584003e-14         , -3.64003823132040822e-15        , 8.05724056557099801e-16         , -1.44046402798563131e-16        , 2.16419183206498645e-17         , -2.80789525125819519e-18        , 3.20886110729578762e-19         , -3.27892373807372312e-20        , 3.03095396492373113e-21         , -2.55957628050133537e-22        , 2.02402894575306461e-23         , -1.45644328575327704e-24        , },
+/* x = 30.0        */  {6.27115505949076079e-15         , -5.21017850493989596e-15        , 2.20141742505429009e-15         , -6.29430523580466487e-16        , 1.3676073039849838e-16          , -2.40486516579390282e-17        , 3.56017893100603544e-18         , -4.55852913934068506e-19        , 5.14823981086507641e-20         , -5.20506229725646224e-21        , 4.76563969300158366e-22         , -3.98985714353589348e-23        , 3.12973375078460906e-24         , -2.23621027481090076e-25        , },
+/* x = 32.0        */  {1.22007253461573187e-15         , -9.83109823151413814e-16        , 4.04125707733533195e-16         , -1.1273851060199262e-16         , 2.39622922115833402e-17         , -4.13160223544155842e-18        , 6.00993175550178866e-19         , -7.5752930687761236e-20         , 8.43575738446426481e-21         , -8.42192476757608558e-22        , 7.62401095354794301e-23         , -6.31803454225702654e-24        , 4.90917701492749517e-25         , -3.47858683518311549e-26        , },
+/* x = 34.0        */  {2.50195446890651473e-16         , -1.9472326852503477e-16         , 7.75582940497267778e-17         , -2.10276195191718461e-17        , 4.35590982282628929e-18         , -7.33893767566133577e-19        , 1.04563376872026352e-19         , -1.29370660254641801e-20        , 1.41684076321683162e-21         , -1.3935183986338983e-22         , 1.24466450348863471e-23         , -1.01906090821865046e-24        , 7.82996579908796569e-26         , -5.49412666451513651e-27        , },
+/* x = 36.0        */  {5.43094972900962193e-17         , -4.06798766118654551e-17        , 1.56404205665035114e-17         , -4.10540728120724852e-18        , 8.25739569852697593e-19         , -1.35453068998548512e-19        , 1.88384420980087527e-20         , -2.28057520417745116e-21        , 2.4491604875845163e-22          , -2.36674723416470025e-23        , 2.08068671404385418e-24         , -1.67940184521360804e-25        , 1.27342596583863595e-26         , -8.83273950767585274e-28        , },
+},
+/* n = 29 */
+{
+/* x = 0.0         */  {0.00644637482687220698          , -0.00622833680700876679         , 0.00301227601402246512          , -0.000972278049621902627        , 0.000235604128783453562         , -0.000045716657904795729        , 7.39894874102240626e-6          , -1.0272640242701418e-6          , 1.24895263555502691e-7          , -1.3507698609276181e-8          , 1.31548803516071419e-9          , -1.16569031995689248e-10        , 9.65116362126979267e-12         , -7.23596080550288339e-13        , },
+/* x = 2.0         */  {0.000935556258298138365         , -0.000901791811954361941        , 0.000435186013445923694         , -0.000140176925731462104        , 0.000033902310191730705         , -6.56645335884063398e-6         , 1.06091791817642066e-6          , -1.47058730274935105e-7         , 1.78521231539499442e-8          , -1.92794939249307265e-9         , 1.87501347325144284e-10         , -1.6593326820045159e-11         , 1.37205649712280881e-12         , -1.02748881205665891e-13        , },
+/* x = 4.0         */  {0.000136432836654004669         , -0.000131159036350080167        , 0.0000631377109134588259        , -0.0000202900762668623327       , 4.8965947709930665e-6           , -9.4648116032354242e-7          , 1.52627361084190755e-7          , -2.11183284373867547e-8         , 2.55930005653816098e-9          , -2.75949995395071676e-10        , 2.67966527039533401e-11         , -2.36801858922368197e-12        , 1.95528824782173417e-13         , -1.46236332496590989e-14        , },
+/* x = 6.0         */  {0.0000200052929468870345        , -0.0000191735941651298505       , 9.20383137565556063e-6          , -2.95000937831280398e-6         , 7.10183607133635087e-7          , -1.36960282546238851e-7         , 2.20386083558337079e-8          , -3.04324972955316042e-9         , 3.68110027703556446e-10         , -3.96198526750429739e-11        , 3.84090122611304343e-12         , -3.38881097878834318e-13        , 2.79381297492174355e-14         , -2.08653193523835749e-15        , },
+/* x = 8.0         */  {2.95178673469708763e-6          , -2.819200736691583e-6           , 1.3489289125416122e-6           , -4.31067026792498122e-7         , 1.03486889731760715e-7          , -1.99060715725464833e-8         , 3.19540649866020799e-9          , -4.40248866001796051e-10        , 5.31396173402137978e-11         , -5.70807483990810018e-12        , 5.52328556131721405e-13         , -4.86457974066298279e-14        , 4.00356873538652311e-15         , -2.98533960685560829e-16        , },
+/* x = 10.0        */  {4.38676036684849046e-7          , -4.17281153370928041e-7         , 1.98919308304076863e-7          , -6.33494852732698849e-8         , 1.51602243686198117e-8          , -2.90755302794338786e-9         , 4.65456958758239057e-10         , -6.39651792736203856e-11        , 7.70244486629891398e-12         , -8.25525808007034991e-13        , 7.97131325322513064e-14         , -7.00685436239281821e-15        , 5.75563699873520339e-16         , -4.28434342605374914e-17        , },
+/* x = 12.0        */  {6.57371322152210191e-8          , -6.2236976681422438e-8          , 2.95408878958740022e-8          , -9.37065684551003196e-9         , 2.23433776092793946e-9          , -4.27078754003769788e-10        , 6.81561253710229742e-11         , -9.33922268487105069e-12        , 1.12156486785632194e-12         , -1.19903978623591881e-13        , 1.15507868001553789e-14         , -1.0130880969387987e-15         , 8.3040250528184957e-17          , -6.16932774764013195e-18        , },
+/* x = 14.0        */  {9.94670616144561784e-9          , -9.36511143411551102e-9         , 4.42282461631960168e-9          , -1.3965198953028457e-9          , 3.31583942603879588e-10         , -6.31346275532164761e-11        , 1.0039462690064363e-11          , -1.37113105003104783e-12        , 1.64157127307658393e-13         , -1.7499670149612473e-14         , 1.6813338634846809e-15          , -1.47099522174949093e-16        , 1.2028466333994471e-17          , -8.9169734380690555e-19         , },
+/* x = 16.0        */  {1.5222055574340689e-9           , -1.42384560884583389e-9         , 6.68458896349072607e-10         , -2.09933547804612241e-10        , 4.96013559526257585e-11         , -9.40186352502349693e-12        , 1.48889103545401459e-12         , -2.02571970669855084e-13        , 2.4167645998410736e-14          , -2.56797957062031754e-15        , 2.45982803703498069e-16         , -2.14605707065094747e-17        , 1.7501062808603158e-18          , -1.29423239275151696e-19        , },
+/* x = 18.0        */  {2.36089623635245478e-10         , -2.19118193603742348e-10        , 1.02150175951182046e-10         , -3.18777444399691804e-11        , 7.48851304197087435e-12         , -1.41200274861701946e-12        , 2.22536048251798759e-13         , -3.01443525326025793e-14        , 3.58181931960416171e-15         , -3.79175461980173523e-16        , 3.61955817380466558e-17         , -3.14776583424912104e-18        , 2.5591293968200824e-19          , -1.88730711961115605e-20        , },
+/* x = 20.0        */  {3.7202261735468549e-11          , -3.42066047524155434e-11        , 1.58136529417377009e-11         , -4.89787392011087469e-12        , 1.14277260524668852e-12         , -2.14151251271788767e-13        , 3.35620473262171123e-14         , -4.52303393384823449e-15        , 5.34922795195300362e-16         , -5.63842046738208599e-17        , 5.36106802008335754e-18         , -4.64523046895176947e-19        , 3.76336981020314614e-20         , -2.76672735646276243e-21        , },
+/* x = 22.0        */  {5.97395940965100587e-12         , -5.43140888809544169e-12        , 2.48583854192143876e-12         , -7.63032101322853433e-13        , 1.76597575366653623e-13         , -3.28532798673225903e-14        , 5.11492632618739306e-15         , -6.85197715605392449e-16        , 8.05940072479010747e-17         , -8.4527483786287229e-18         , 8.00021390664182588e-19         , -6.90280696621139452e-20        , 5.5699640689655294e-21          , -4.08025111097388562e-22        , },
+/* x = 24.0        */  {9.81146955259224649e-13         , -8.79994529906604321e-13        , 3.97917224593339125e-13         , -1.20832088112667421e-13        , 2.76971420832693664e-14         , -5.10817676737447342e-15        , 7.8910443328787192e-16          , -1.04964582897606788e-16        , 1.2267188878506184e-17          , -1.27910135139245391e-18        , 1.20418820305464734e-19         , -1.03394435363979167e-20        , 8.30451390055720394e-22         , -6.05845808178589887e-23        , },
+/* x = 26.0        */  {1.65520485000109559e-13         , -1.46040366638284781e-13        , 6.50827180406990296e-14         , -1.95089310388564453e-14        , 4.42048942034511043e-15         , -8.06885520259277668e-16        , 1.23494939911962572e-16         , -1.62901694927777739e-17        , 1.88949273162838767e-18         , -1.95671990121417709e-19        , 1.83067901713925938e-20         , -1.56294892159446812e-21        , 1.2486250149151318e-22          , -9.06600373804395166e-24        , },
+/* x = 28.0        */  {2.88247159946542842e-14         , -2.493606343011914e-14          , 1.09201146939607525e-14         , -3.22289622615354099e-15        , 7.20232013999110612e-16         , -1.29851510597623146e-16        , 1.96552667285915735e-17         , -2.56708631926916905e-18        , 2.95103201174762653e-19         , -3.03142450229158967e-20        , 2.81547059927117668e-21         , -2.38776965552693173e-22        , 1.8956784271262501e-23          , -1.36883597922486029e-24        , },
+/* x = 30.0        */  {5.21017850493989681e-15         , -4.40283485010893704e-15        , 1.88829157074132786e-15         , -5.47042921582573821e-16        , 1.20243258290649808e-16         , -2.13610736888134982e-17        , 3.19097039295607734e-18         , -4.11858793336689756e-19        , 4.68455704947414433e-20         , -4.76635750261490463e-21        , 4.38874684565293695e-22         , -3.6930352983244275e-23         , 2.91056471131038443e-24         , -2.08817342057011253e-25        , },
+/* x = 32.0        */  {9.83109823151413944e-16         , -8.08251415467121485e-16        , 3.38215531805966882e-16         , -9.58491688445703324e-17        , 2.06580111773541688e-17         , -3.60595906916833049e-18        , 5.30270514111720772e-19         , -6.74859986290196763e-20        , 7.57973379640679121e-21         , -7.62511914294604878e-22        , 6.94969078340311976e-23         , -5.79429770680558183e-24        , 4.52751608863293867e-25         , -3.22382370358041231e-26        , },
+/* x = 34.0        */  {1.9472326852503479e-16          , -1.5511658809946218e-16         , 6.30828585575138334e-17         , -1.74236392910291668e-17        , 3.66946883785339835e-18         , -6.27380263716071096e-19        , 9.05594620691430441e-20         , -1.13347166432089891e-20        , 1.25416679256954356e-21         , -1.24483798312580587e-22        , 1.12094413869041794e-23         , -9.244558548283459e-25          , 7.15067751845060986e-26         , -5.04668035406999436e-27        , },
+/* x = 36.0        */  {4.06798766118654583e-17         , -3.12808411330083949e-17        , 1.23162218436214769e-17         , -3.30295827936688212e-18        , 6.77265344996324777e-19         , -1.13030652983226742e-19        , 1.59640264120475065e-20         , -1.95932688464199163e-21        , 2.13007287920504988e-22         , -2.08096270874111235e-23        , 1.8473060028459356e-24          , -1.50402434906383194e-25        , 1.14956620468997848e-26         , -8.02893664751039992e-28        , },
+},
+/* n = 30 */
+{
+/* x = 0.0         */  {0.0062283368070087698           , -0.00602455202804613781         , 0.00291683414886545534          , -0.000942416515095171972        , 0.000228583289527345845         , -0.0000443936927939149295       , 7.1908481537284309e-6           , -9.99160783565956912e-7         , 1.21569322117546475e-7          , -1.31573092947256027e-8         , 1.28222548753753279e-9          , -1.13694158551853574e-10        , 9.41906337989881853e-12         , -7.06601634461312771e-13        , },
+/* x = 2.0         */  {0.000901791811954362367         , -0.000870372026892018668        , 0.00042053077719435053          , -0.000135609240761441883        , 0.0000328322667946802548        , -6.36550755838696118e-6         , 1.02941110963453828e-6          , -1.42816797313743526e-7         , 1.73515494395964871e-8          , -1.87535798932082661e-9         , 1.82521796909637619e-10         , -1.61640093958296856e-11        , 1.3374802232587946e-12          , -1.00222856548006705e-13        , },
+/* x = 4.0         */  {0.000131159036350080227         , -0.000126275421826941999        , 0.0000608702288005819178        , -0.0000195863790831931567       , 4.73240580168544988e-6          , -9.15764173517127754e-7         , 1.47828298736565915e-7          , -2.04743737399882378e-8         , 2.48355065528714766e-9          , -2.68015499620791861e-10        , 2.60475232328802075e-11         , -2.30360619010597045e-12        , 1.9035495900203888e-13          , -1.42465690933701835e-14        , },
+/* x = 6.0         */  {0.0000191735941651298591        , -0.0000184076627513145905       , 8.85002813493768899e-6          , -2.84073442842352548e-6         , 6.84801412740833809e-7          , -1.32231651134136046e-7         , 2.13027480606022525e-8          , -2.94487641540445747e-9         , 3.56578773225109188e-10         , -3.84159903384529449e-11        , 3.72759513027191979e-12         , -3.29167598600054507e-13        , 2.71601683927378149e-14         , -2.02998613018490649e-15        , },
+/* x = 8.0         */  {2.81920073669158423e-6          , -2.69785782508372002e-6         , 1.29320108037739123e-6          , -4.13947558911182865e-7         , 9.95303578641076197e-8          , -1.91724391347012058e-8         , 3.08174205541159735e-9          , -4.25116394950442384e-10        , 5.13726877041193439e-11         , -5.52428247530854331e-12        , 5.35089940858629042e-13         , -4.7172790795841833e-14         , 3.88597080320285981e-15         , -2.90011342932148128e-16        , },
+/* x = 10.0        */  {4.17281153370928217e-7          , -3.97838616608224738e-7         , 1.900484558197949e-7            , -6.06408974722068822e-8         , 1.45377651399136673e-8          , -2.79274177300071666e-9         , 4.47756253971048126e-10         , -6.16194810207443898e-11        , 7.42973429555168691e-12         , -7.97274159675203499e-13        , 7.70734194643572839e-14         , -6.78210896340695562e-15        , 5.576841079192479e-16           , -4.15518116917628169e-17        , },
+/* x = 12.0        */  {6.22369766814224632e-8          , -5.90817757917582112e-8         , 2.81119705365279788e-8          , -8.93735104338514246e-9         , 2.13539377004707669e-9          , -4.08936755165676305e-10        , 6.53745586586041687e-11         , -8.97250774460882514e-12        , 1.07913609795486854e-12         , -1.1552839811142954e-13         , 1.11436851758416562e-14         , -9.78565819537563981e-16        , 8.03044936230051836e-17         , -5.97239560021850083e-18        , },
+/* x = 14.0        */  {9.36511143411551465e-9          , -8.8456492326406756e-9          , 4.1895596859082323e-9           , -1.32633577036840661e-9         , 3.15673137770146211e-10         , -6.02367765643918311e-11        , 9.59791733071095006e-12         , -1.31325540320163581e-12        , 1.57497073145908187e-13         , -1.68162999441709219e-14        , 1.61805387340397478e-15         , -1.4175718059779874e-16         , 1.16069274769316803e-17         , -8.6147180337830429e-19         , },
+/* x = 16.0        */  {1.42384560884583441e-9          , -1.33691779269835841e-9         , 6.29800643413792681e-10         , -1.98405423803680758e-10        , 4.70093176257047093e-11         , -8.93334627412457265e-12        , 1.41800379187030732e-12         , -1.93340934080676022e-13        , 2.3111822175607719e-14          , -2.4602568658197356e-15         , 2.36060371969517756e-16         , -2.06270247945376841e-17        , 1.68464967497205067e-18         , -1.24750191928701824e-19        , },
+/* x = 18.0        */  {2.19118193603742425e-10         , -2.04300351902395102e-10        , 9.56332333199011507e-11         , -2.99540521668912067e-11        , 7.0600137431703028e-12          , -1.33521629844140904e-12        , 2.11010467319231617e-13         , -2.86545205354371453e-14        , 3.41258003422107172e-15         , -3.6201818994007198e-16         , 3.46245672527749907e-17         , -3.01652104234663945e-18        , 2.45661534264119629e-19         , -1.81447446124864786e-20        , },
+/* x = 20.0        */  {3.42066047524155545e-11         , -3.16273058834799344e-11        , 1.46936217603316925e-11         , -4.57109042084171216e-12        , 1.0707562563713644e-12          , -2.01372285262679953e-13        , 3.16612374773189425e-14         , -4.27937738869657831e-15        , 5.074579698187425e-16           , -5.36197971215119836e-17        , 5.10962860047784669e-18         , -4.43647791905039428e-19        , 3.60128794045976338e-20         , -2.65219510644603635e-21        , },
+/* x = 22.0        */  {5.43140888809544331e-12         , -4.97167708384354375e-12        , 2.2890963039684238e-12          , -7.0639030144529538e-13         , 1.64266399338432974e-13         , -3.0689558148996354e-14         , 4.79638400050163884e-15         , -6.44751327042272966e-16        , 7.60747541278905922e-17         , -8.00155396502381609e-18        , 7.59290462056324822e-19         , -6.56700633305767157e-20        , 5.31098252678553336e-21         , -3.89835165669879054e-22        , },
+/* x = 24.0        */  {8.79994529906604561e-13         , -7.95834449186776797e-13        , 3.62496264337982144e-13         , -1.10788568329923984e-13        , 2.55408838371406355e-14         , -4.73462662810856291e-15        , 7.34752078995559275e-16         , -9.81374029086918032e-17        , 1.15119149218640317e-17         , -1.2043864218770408e-18         , 1.13731180886918251e-19         , -9.79242570839798798e-21        , 7.88580646435378475e-22         , -5.76636574235522515e-23        , },
+/* x = 26.0        */  {1.46040366638284817e-13         , -1.30165436081412741e-13        , 5.85267931165663504e-14         , -1.7681957680910612e-14         , 4.03442760133619604e-15         , -7.40969643700242474e-16        , 1.14031186258367479e-16         , -1.51159257445812324e-17        , 1.76104832054334087e-18         , -1.8309743386468566e-19         , 1.71920377858594778e-20         , -1.47257650450785479e-21        , 1.18003631023542833e-22         , -8.59117113010112376e-24        , },
+/* x = 28.0        */  {2.49360634301191453e-14         , -2.18402293879237106e-14        , 9.66868867846017655e-15         , -2.88092805592586376e-15        , 6.49257552994067961e-16         , -1.17931601006757623e-16        , 1.79696042063134666e-17         , -2.360823189557409e-18          , 2.72828266429207413e-19         , -2.81591423673141789e-20        , 2.62648675862560082e-21         , -2.23609666147590421e-22        , 1.78166358950228501e-23         , -1.29058170251986369e-24        , },
+/* x = 30.0        */  {4.40283485010893784e-15         , -3.77658314148299021e-15        , 1.64112876474765413e-15         , -4.80973033151895679e-16        , 1.0680536844496532e-16          , -1.91458224540684538e-17        , 2.88301154904724673e-18         , -3.74764196978923035e-19        , 4.2897226758351777e-20          , -4.38941964050187309e-21        , 4.06224853216221367e-22         , -3.4339610122107623e-23         , 2.71790893745593108e-24         , -1.95722137872330053e-25        , },
+/* x = 32.0        */  {8.08251415467121607e-16         , -6.7643106361198505e-16         , 2.87547506533700737e-16         , -8.26320447077755474e-17        , 1.80297953459784519e-17         , -3.18162309944047342e-18        , 4.72401989746500405e-19         , -6.06378141040208501e-20        , 6.86260863573143615e-21         , -6.95072234935024471e-22        , 6.37358989633134242e-23         , -5.34299173279225819e-24        , 4.19597376573808495e-25         , -3.00091911890894075e-26        , },
+/* x = 34.0        */  {1.55116588099462199e-16         , -1.26165717115035631e-16        , 5.22709178730859189e-17         , -1.46778753511587505e-17        , 3.13690131860144332e-18         , -5.43356774708444369e-19        , 7.9343016401241276e-20          , -1.00333256030854762e-20        , 1.120354401716756e-21           , -1.12110432565640935e-22        , 1.01688023196595484e-23         , -8.44101348818459488e-25        , 6.56839658582759348e-26         , -4.65998446520456476e-27        , },
+/* x = 36.0        */  {3.12808411330083979e-17         , -2.46324436872442088e-17        , 9.90887483810039925e-18         , -2.70906137994513768e-18        , 5.65153264919428594e-19         , -9.5784158833737905e-20         , 1.37152881766784884e-20         , -1.70405692640074151e-21        , 1.87286677676956618e-22         , -1.8475584461173078e-23         , 1.65439364683051978e-24         , -1.35744803285367353e-25        , 1.04496675107436498e-26         , -7.34380425810021558e-28        , },
+},
+/* n = 31 */
+{
+/* x = 0.0         */  {0.00602455202804614074          , -0.00583366829773209054         , 0.00282724954528526904          , -0.000914333158071627855        , 0.000221968463972866307         , -0.0000431450892621703287       , 6.99412546916173455e-6          , -9.72553282465159267e-7         , 1.18415817509595782e-7          , -1.28246280799316359e-8         , 1.25060263938426124e-9          , -1.10957600218735145e-10        , 9.19785931568000044e-12         , -6.90386780016892473e-13        , },
+/* x = 2.0         */  {0.000870372026892019084         , -0.00084106155438886823         , 0.000406827722284290705         , -0.000131329067173371605        , 0.0000318275377924007093        , -6.17646670595195993e-6         , 9.9971757895986815e-7           , -1.38812212108275659e-7         , 1.68782266960371541e-8          , -1.82555421800614423e-9         , 1.77799417696627839e-10         , -1.57563090851261525e-11        , 1.30460101057816079e-12         , -9.78178646597942132e-14        , },
+/* x = 4.0         */  {0.000126275421826942058         , -0.000121740457601187571        , 0.0000587591372495745145        , -0.0000189296232059822773       , 4.57882086765171505e-6          , -8.86969799255095831e-7         , 1.43320615862751503e-7          , -1.98683792015339729e-8         , 2.41214017622890101e-9          , -2.60522973728017374e-10        , 2.53390035525419545e-11         , -2.24259428689111518e-12        , 1.85447048622438028e-13         , -1.38884070444504588e-14        , },
+/* x = 6.0         */  {0.0000184076627513145989        , -0.0000177000562698787556       , 8.52220328526987208e-6          , -2.73920565085525025e-6         , 6.61158255680071854e-7          , -1.27816489336378436e-7         , 2.06141348627514079e-8          , -2.8526264800297456e-9          , 3.45744009645635953e-10         , -3.72827452164536757e-11        , 3.62074913169802682e-12         , -3.19992786908218567e-13        , 2.64241662024302398e-14         , -1.97641126821173719e-15        , },
+/* x = 8.0         */  {2.69785782508372122e-6          , -2.58640216075526431e-6         , 1.24184267673344824e-6          , -3.9812143144101085e-7          , 9.58621956748440655e-8          , -1.84904524712462426e-8         , 2.97581475823052166e-9          , -4.10980972959969913e-10        , 4.97185560404376719e-11         , -5.35186864239182617e-12        , 5.18887241930384384e-13         , -4.57857728626940279e-14        , 3.77504084861820876e-15         , -2.81958925246763292e-16        , },
+/* x = 10.0        */  {3.97838616608224909e-7          , -3.80096911639658732e-7         , 1.81922692416606312e-7          , -5.81510605574488399e-8         , 1.3963708865194712e-8           , -2.68653754367875326e-9         , 4.31336366227793017e-10         , -5.94377987359772605e-11        , 7.17546940297192836e-12         , -7.7087284677666983e-13         , 7.46012763889373543e-14         , -6.57120379705541958e-15        , 5.40872536916246641e-16         , -4.03351659918517413e-17        , },
+/* x = 12.0        */  {5.90817757917582356e-8          , -5.62239410730658484e-8         , 2.68120531301533739e-8          , -8.54157507987180193e-9         , 2.0446837758557611e-9           , -3.92247354800168437e-10        , 6.28075540808398063e-11         , -8.63307793204495126e-12        , 1.03975586462137244e-12         , -1.11456746347411113e-13        , 1.07639486545956631e-14         , -9.46291373080817597e-16        , 7.77412738274007815e-17         , -5.78751679841486876e-18        , },
+/* x = 14.0        */  {8.84564923264067912e-9          , -8.37911937181788853e-9         , 3.97900731110492474e-9          , -1.26269255103501915e-9         , 3.01183882825893741e-10         , -5.75875043943569177e-11        , 9.19278780352544155e-12         , -1.25997502291500906e-12        , 1.51346739967557808e-13         , -1.61834028631765487e-14        , 1.55928941589004197e-15         , -1.36783526112881222e-16        , 1.12135227841885606e-17         , -8.33201203432980555e-19        , },
+/* x = 16.0        */  {1.33691779269835892e-9          , -1.25960128682779112e-9         , 5.95216271410999719e-10         , -1.8803727049623461e-10         , 4.46667313711902644e-11         , -8.50802281047988562e-12        , 1.35338653584120676e-12         , -1.84894351659941057e-13        , 2.21423176285034661e-14         , -2.36101758538311888e-15        , 2.26891566305754274e-16         , -1.98546042265521813e-17        , 1.623827562040488e-18           , -1.20397291037475565e-19        , },
+/* x = 18.0        */  {2.04300351902395175e-10         , -1.91266466639832156e-10        , 8.98621565006674593e-11         , -2.82400549717258534e-11        , 6.67608149228918826e-12         , -1.26606281251361035e-12        , 2.0058164335377333e-13          , -2.73006075186423081e-14        , 3.25816455436069197e-15         , -3.46305723592570309e-16        , 3.31809053413254238e-17         , -2.89553020914435724e-18        , 2.36182088866909737e-19         , -1.74694006750261019e-20        , },
+/* x = 20.0        */  {3.16273058834799451e-11         , -2.93872435206677371e-11        , 1.37132712625242407e-11         , -4.28302502534619409e-12        , 1.00686142632534346e-12         , -1.89967426117285149e-13        , 2.99556416635463216e-14         , -4.05965898380139016e-15        , 4.82578296943021863e-16         , -5.11050397104531779e-17        , 4.8800055915284013e-18          , -4.24514955175423777e-19        , 3.45222161754466213e-20         , -2.54653255991594259e-21        , },
+/* x = 22.0        */  {4.97167708384354531e-12         , -4.5781926079374853e-12         , 2.11917090433575526e-12         , -6.57065597333325318e-13        , 1.53447790746726883e-13         , -2.87783041866690291e-14        , 4.51325928091936767e-15         , -6.08597333369044315e-16        , 7.20140036349495527e-17         , -7.59418731971068959e-18        , 7.22353145784140587e-19         , -6.2612343792750293e-20         , 5.07423928178234971e-21         , -3.73148842892035787e-22        , },
+/* x = 24.0        */  {7.95834449186777026e-13         , -7.24992528676058283e-13        , 3.32365704989752724e-13         , -1.02163535345554666e-13        , 2.36731331407992009e-14         , -4.4085125010442379e-15         , 6.86961819130188311e-16         , -9.20952162477417608e-17        , 1.08394804340097493e-17         , -1.13750087534841993e-18        , 1.07714104278582036e-19         , -9.29796428443552122e-21        , 7.50565187886481787e-22         , -5.500115759634016e-23          , },
+/* x = 26.0        */  {1.30165436081412775e-13         , -1.17053586233146649e-13        , 5.30458730427289934e-14         , -1.61377104048984562e-14        , 3.7048482185391149e-15          , -6.84187121567156167e-16        , 1.05811480030136467e-16         , -1.40883712616751363e-17        , 1.64787729463679928e-18         , -1.71948432756510956e-19        , 1.61979603583942488e-20         , -1.39155929773748639e-21        , 1.11823839670279653e-22         , -8.16142484834253499e-24        , },
+/* x = 28.0        */  {2.18402293879237157e-14         , -1.93373773569224386e-14        , 8.64278416777716805e-15         , -2.5970302119095354e-15         , 5.89658005039431187e-16         , -1.07817625838508799e-16        , 1.65257622998151075e-17         , -2.18262384332699714e-18        , 2.53432339348875116e-19         , -2.62690624484699718e-20        , 2.45964957442148818e-21         , -2.10138660080815003e-22        , 1.67981996607605721e-23         , -1.2203235531530659e-24         , },
+/* x = 30.0        */  {3.77658314148299097e-15         , -3.28225752949562283e-15        , 1.44291909945562351e-15         , -4.27221473769794917e-16        , 9.57291122711892556e-17         , -1.72980693848807567e-17        , 2.62334937478692558e-18         , -3.43177468934333091e-19        , 3.95047854763789949e-20         , -4.06288127504427619e-21        , 3.77727193077983104e-22         , -3.20626952796711514e-23        , 2.54748534332238125e-24         , -1.84070656600007169e-25        , },
+/* x = 32.0        */  {6.76431063611985165e-16         , -5.75095013067449404e-16        , 2.47896134123317019e-16         , -7.21191813823800453e-17        , 1.59081154973306799e-17         , -2.83441195228286289e-18        , 4.24464698112244701e-19         , -5.49008164997163802e-20        , 6.25565143420361322e-21         , -6.3745539754750065e-22         , 5.87716186009528124e-23         , -4.95103070271138192e-24        , 3.90588743553445086e-25         , -2.80459387247733403e-26        , },
+/* x = 34.0        */  {1.26165717115035648e-16         , -1.04541835746179226e-16        , 4.40336260534747779e-17         , -1.25476052741693446e-17        , 2.71678387356186945e-18         , -4.76058100535305438e-19        , 7.02332791272898361e-20         , -8.96282710760916517e-21        , 1.00899409518040544e-21         , -1.01702884425547341e-22        , 9.28491723824684937e-24         , -7.75237790486781292e-25        , 6.06516521408247971e-26         , -4.32326660417664192e-27        , },
+/* x = 36.0        */  {2.46324436872442116e-17         , -1.98177496762019529e-17        , 8.12718413983518459e-18         , -2.26061305964077397e-18        , 4.78920794171735456e-19         , -8.22917293925345754e-20        , 1.19283984701847218e-20         , -1.49829215488748078e-21        , 1.66280291480133593e-22         , -1.65462584366208299e-23        , 1.49316220277594763e-24         , -1.23369565053463015e-25        , 9.55808494029146499e-27         , -6.7548169182026069e-28         , },
+},
+};
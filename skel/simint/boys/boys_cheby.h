@@ -0,0 +1,10 @@
+#pragma once
+
+#define BOYS_CHEBY_MAXN 31
+#define BOYS_CHEBY_MAXX 36.5
+#define BOYS_CHEBY_WIDTH 2.0
+#define BOYS_CHEBY_NSEG 19
+#define BOYS_CHEBY_ORDER 13
+#define BOYS_CHEBY_LOOKUPFAC 0.5
+#define BOYS_CHEBY_MAXERR 2.705e-15
+
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <math.h>
+
+#include "simint/boys/boys_cheby.h"
+#include "simint/vectorization/vectorization.h"
+
+#ifdef __cplusplus
+#include "simint/cpp_restrict.hpp"
+extern "C" {
+#endif
+
+extern const double boys_cheby[BOYS_CHEBY_MAXN+1][BOYS_CHEBY_NSEG][BOYS_CHEBY_ORDER+1];
+
+// Plain multiply and add where fma() would be a library call
+#ifdef FP_FAST_FMA
+  #define BOYS_CHEBY_FMA(a,b,c) fma((a), (b), (c))
+#else
+  #define BOYS_CHEBY_FMA(a,b,c) ((a)*(b)+(c))
+#endif
+
+
+// Segment containing x, and where x is within it (t, from -1 to 1)
+static inline
+int boys_cheby_lookup(double x, double * t)
+{
+    const int seg = (int)(x * BOYS_CHEBY_LOOKUPFAC);
+    *t = x * (2.0 * BOYS_CHEBY_LOOKUPFAC) - (double)(2*seg+1);
+    return seg;
+}
+
+
+// Horner's rule for the polynomial of one segment
+static inline
+double boys_cheby_poly(double const * restrict c, double t)
+{
+    double p = c[BOYS_CHEBY_ORDER];
+    for(int k = BOYS_CHEBY_ORDER-1; k >= 0; k--)
+        p = BOYS_CHEBY_FMA(p, t, c[k]);
+    return p;
+}
+
+
+static inline
+void boys_F_cheby(double * restrict F, double x, int n)
+{
+    double t;
+    const int seg = boys_cheby_lookup(x, &t);
+
+    for(int i = 0; i <= n; ++i)
+        F[i*SIMINT_SIMD_LEN] = boys_cheby_poly(boys_cheby[i][seg], t);
+}
+
+static inline
+double boys_F_cheby_single(double x, int n)
+{
+    double t;
+    const int seg = boys_cheby_lookup(x, &t);
+    return boys_cheby_poly(boys_cheby[n][seg], t);
+}
+
+static inline
+void boys_F_cheby_vec(SIMINT_DBLTYPE * restrict F, SIMINT_DBLTYPE x, int n)
+{
+    double * restrict Fd = (double *)F;
+    double * restrict xd = (double *)&x;
+
+    #ifndef SIMINT_SCALAR
+      // workaround for GCC missing simdlen??
+      #if defined __clang__ || defined __INTEL_COMPILER
+        #pragma omp simd simdlen(SIMINT_SIMD_LEN)
+      #else
+        #pragma omp simd
+      #endif
+    #endif
+    for(int v = 0; v < SIMINT_SIMD_LEN; v++)
+    {
+        double t;
+        const int seg = boys_cheby_lookup(xd[v], &t);
+
+        for(int i = 0; i <= n; ++i)
+            Fd[i*SIMINT_SIMD_LEN + v] = boys_cheby_poly(boys_cheby[i][seg], t);
+    }
+}
+
+static inline
+SIMINT_DBLTYPE boys_F_cheby_single_vec(SIMINT_DBLTYPE x, int n)
+{
+    SIMINT_DBLTYPE ret;
+    double * retd = (double *)&ret;
+    double * restrict xd = (double *)&x;
+
+    #ifndef SIMINT_SCALAR
+      // workaround for GCC missing simdlen??
+      #if defined __clang__ || defined __INTEL_COMPILER
+        #pragma omp simd simdlen(SIMINT_SIMD_LEN)
+      #else
+        #pragma omp simd
+      #endif
+    #endif
+    for(int v = 0; v < SIMINT_SIMD_LEN; v++)
+    {
+        double t;
+        const int seg = boys_cheby_lookup(xd[v], &t);
+        retd[v] = boys_cheby_poly(boys_cheby[n][seg], t);
+    }
+
+    return ret;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "simint/vectorization/vectorization_f32.h"
+
+#include "simint/boys/boys_shortgrid.h"
+#include "simint/boys/boys_longfac.h"
+
+#ifdef __cplusplus
+#include "simint/cpp_restrict.hpp"
+extern "C" {
+#endif
+
+// Same grid as boys_shortgrid, in single precision
+extern const float boys_shortgrid_f32[BOYS_SHORTGRID_NPOINT][BOYS_SHORTGRID_MAXN+1];
+
+
+// Single precision version of the split Boys function, for the
+// SIMINT_FLT_LEN lanes of SIMINT_FLTTYPE.
+//
+// As boys_F_blend_vec, every lane computes both the short and the long
+// range value and keeps one of them, so there are no branches and the
+// grid points are gathered. Only five terms of the Taylor series are
+// needed for single precision (the truncation error is below
+// dx^5/120 ~ 3e-9 relative). Since no vector is evaluated lane by lane,
+// this always returns 0 (see boys_F_split).
+static inline
+int boys_F_split_f32(SIMINT_FLTTYPE * restrict F,
+                     SIMINT_FLTTYPE x,
+                     int n)
+{
+    const SIMINT_FLTTYPE islong = vector_ge_f32(x, SIMINT_FLTSET1((float)BOYS_SHORTGRID_MAXX));
+    const SIMINT_FLTTYPE isshort = SIMINT_FLT_SUB(SIMINT_FLTSET1(1.0f), islong);
+
+    // zero for the long range lanes, and MAXX for the short ones
+    const SIMINT_FLTTYPE xs = SIMINT_FLT_MUL(x, isshort);
+    const SIMINT_FLTTYPE xl = SIMINT_FLT_FMADD(x, islong, SIMINT_FLT_MUL(isshort, SIMINT_FLTSET1((float)BOYS_SHORTGRID_MAXX)));
+
+    const SIMINT_FLTTYPE lookup_idx = vector_floor_f32(SIMINT_FLT_MUL(SIMINT_FLTSET1((float)BOYS_SHORTGRID_LOOKUPFAC),
+                                                                      SIMINT_FLT_ADD(xs, SIMINT_FLTSET1((float)BOYS_SHORTGRID_LOOKUPFAC2))));
+    const SIMINT_FLTTYPE idx = SIMINT_FLT_MUL(lookup_idx, SIMINT_FLTSET1((float)(BOYS_SHORTGRID_MAXN+1)));
+    const SIMINT_FLTTYPE dx = SIMINT_FLT_FMSUB(lookup_idx, SIMINT_FLTSET1((float)BOYS_SHORTGRID_SPACE), xs);
+    const SIMINT_FLTTYPE x1 = SIMINT_FLT_DIV(SIMINT_FLTSET1(1.0f), xl);
+
+    // n is small - do all of them directly. Otherwise
+    // only the highest, then recur down
+    const int nlow = (n < 4) ? 0 : n;
+
+    // x^-(nlow+1/2), without pow
+    SIMINT_FLTTYPE xp = SIMINT_FLT_SQRT(x1);
+    SIMINT_FLTTYPE x1p = x1;
+    for(int m = nlow; m > 0; m >>= 1)
+    {
+        if(m & 1)
+            xp = SIMINT_FLT_MUL(xp, x1p);
+        x1p = SIMINT_FLT_MUL(x1p, x1p);
+    }
+
+    for(int i = nlow; i <= n; i++)
+    {
+        float const * gridpts = &(boys_shortgrid_f32[0][0]) + i;
+
+        SIMINT_FLTTYPE Fshort = SIMINT_FLT_MUL(SIMINT_FLTSET1(1.0f/24.0f), vector_gather_f32(gridpts+4, idx));
+        Fshort = SIMINT_FLT_FMADD(dx, Fshort, SIMINT_FLT_MUL(SIMINT_FLTSET1(1.0f/6.0f), vector_gather_f32(gridpts+3, idx)));
+        Fshort = SIMINT_FLT_FMADD(dx, Fshort, SIMINT_FLT_MUL(SIMINT_FLTSET1(1.0f/2.0f), vector_gather_f32(gridpts+2, idx)));
+        Fshort = SIMINT_FLT_FMADD(dx, Fshort, vector_gather_f32(gridpts+1, idx));
+        Fshort = SIMINT_FLT_FMADD(dx, Fshort, vector_gather_f32(gridpts, idx));
+
+        const SIMINT_FLTTYPE Flong = SIMINT_FLT_MUL(SIMINT_FLTSET1((float)boys_longfac[i]), xp);
+        xp = SIMINT_FLT_MUL(xp, x1);
+
+        F[i] = SIMINT_FLT_FMADD(islong, Flong, SIMINT_FLT_MUL(isshort, Fshort));
+    }
+
+    if(n < 4)
+        return 0;
+
+    // factors for the recursion
+    const SIMINT_FLTTYPE x2 = SIMINT_FLT_MUL(SIMINT_FLTSET1(2.0f), (x));
+    const SIMINT_FLTTYPE ex = SIMINT_FLT_EXP(SIMINT_FLT_NEG(x));
+
+    // now recur down
+    for(int n2 = n-1; n2 >= 0; n2--)
+    {
+        const SIMINT_FLTTYPE den = SIMINT_FLTSET1(1.0f / (2.0f * n2 + 1));
+
+        //F[n2] = den * (x2 * F[(n2+1)] + ex);
+        F[n2] = SIMINT_FLT_MUL(den, ( SIMINT_FLT_FMADD(x2, F[(n2+1)], ex)));
+    }
+
+    return 0;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
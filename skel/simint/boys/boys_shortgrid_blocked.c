@@ -0,0 +1,2602 @@
+/*
+ Generated with:
+   ../../../python/boys/gen_boys_shortgrid.py --filename boys_shortgrid_blocked --max-n 31 --max-x 36.5 --spacing 0.1 --layout blocked --block-k 4
+------------------------------------
+Options for Boys function Fn(x):
+    Max n: 31
+    Max x: 36.5
+  Spacing: 0.1
+  npoints: 366
+      DPS: 256
+  Every k: 4
+------------------------------------
+*/
+
+#include "simint/vectorization/vectorization.h"
+
+const double boys_shortgrid_blocked[7][366][8] SIMINT_ALIGN_ARRAY_DBL = 
+{
+/* n = 0 */
+{
+/* x = 0.0         */  {1.0                             , 0.333333333333333333            , 0.1                             , 0.0238095238095238095           , 0.00462962962962962963          , 0.000757575757575757576         , 0.000106837606837606838         , 0.0000132275132275132275        , },
+/* x = 0.1         */  {0.967643312635591831            , 0.314029472998161289            , 0.0931275023963107363           , 0.022031338272623158            , 0.00426641446129438829          , 0.000696171066817845689         , 0.0000979749316916440047        , 0.0000121110541645122127        , },
+/* x = 0.2         */  {0.937150028797978684            , 0.296048189299992062            , 0.0867672685274929107           , 0.0203924717487280202           , 0.00393261045506197801          , 0.000639856358654278971         , 0.000089859862311341608         , 0.0000110900586092140832        , },
+/* x = 0.3         */  {0.908392877032750536            , 0.279291093918387782            , 0.0808792175612045678           , 0.0188816541473132812           , 0.00362578149343332949          , 0.000588202526387240331         , 0.0000824285049755541005        , 0.0000101562784026020219        , },
+/* x = 0.4         */  {0.881254034939924496            , 0.263667486130356494            , 0.0754265077221438633           , 0.0174885481637081941           , 0.00334369671042212776          , 0.000540817118911878079         , 0.0000756224842500690347        , 9.30218416294813106e-6          , },
+/* x = 0.5         */  {0.855624391892148803            , 0.24909373217951538             , 0.0703752684129563576           , 0.0162036707361550253           , 0.00308431296691156833          , 0.000497341176168877791         , 0.0000693884622642850839        , 8.52090219862598441e-6          , },
+/* x = 0.6         */  {0.831402871214021221            , 0.235492695933328991            , 0.0656943548774835581           , 0.0150183212056679373           , 0.00284575883833426847          , 0.0004574463401817747           , 0.0000636777001688844577        , 7.80615699185385103e-6          , },
+/* x = 0.7         */  {0.808495806912583465            , 0.22279321651512425             , 0.0613551234835582988           , 0.0139245156004968421           , 0.00262631998301957891          , 0.000420832217504878157         , 0.0000584456580506246549        , 7.15221875884881733e-6          , },
+/* x = 0.8         */  {0.78681637046172043             , 0.210929628965311774            , 0.0573312258683480406           , 0.0129149265173186266           , 0.00242442577109793551          , 0.000387223971041314996         , 0.0000536516299108630238        , 6.55385563596928461e-6          , },
+/* x = 0.9         */  {0.76628404352069614             , 0.199841324322276127            , 0.0535984203406192414           , 0.011982828117184565            , 0.00223863706437853279          , 0.000356370121135018388         , 0.0000492584106154515123        , 6.00629008157264581e-6          , },
+/* x = 1.0         */  {0.746824132812427025            , 0.189472345820492352            , 0.0501343990725086835           , 0.0111220457961370428           , 0.00206763504721486409          , 0.000328040537612368007         , 0.0000452319919978357276        , 5.50515911987104053e-6          , },
+/* x = 1.1         */  {0.728367323703093494            , 0.179771018184097246            , 0.0469186297395936782           , 0.0103269101286255476           , 0.00191021101712487588          , 0.000302024606063991048         , 0.0000415412855469625189        , 5.0464780863536818e-6           , },
+/* x = 1.2         */  {0.710849269313848801            , 0.170689607250686127            , 0.0439322103833033923           , 0.00959221471672443241          , 0.00176525705191361223          , 0.000278129553128951893         , 0.0000381578693391287048        , 4.6266075646529911e-6           , },
+/* x = 1.3         */  {0.694210212260006337            , 0.162184007394612975            , 0.0411577363749666001           , 0.00891317760997778195          , 0.00163175747732458716          , 0.000256178916884930201         , 0.0000350557570801790932        , 4.24222323233086916e-6          , },
+/* x = 1.4         */  {0.678394636355279378            , 0.154213454433454607            , 0.0385791784569209545           , 0.00828540598973827786          , 0.00150878106588394633          , 0.000236011149670612886         , 0.000032211187313294907         , 3.89028835819400883e-6          , },
+/* x = 1.5         */  {0.663350945840334806            , 0.146740261897301659            , 0.0361817709239125246           , 0.00770486383837196763          , 0.00139547390365545572          , 0.00021747834178096835          , 0.0000296024310196520339        , 3.56802871663447143e-6          , },
+/* x = 1.6         */  {0.649031169897861785            , 0.139729578719751993            , 0.033951909088218839            , 0.00716784233789234279          , 0.00129105286714613267          , 0.000200445055491951165         , 0.0000272096159959722785        , 3.27290970533513876e-6          , },
+/* x = 1.7         */  {0.635390690402152862            , 0.133149166573358298            , 0.0318770552451970945           , 0.0066709327646684458           , 0.00119479965763897149          , 0.000184787259797262723         , 0.0000250145665358056145        , 3.00261547166234254e-6          , },
+/* x = 1.8         */  {0.622387991021315007            , 0.126969195222146797            , 0.0299456524228963683           , 0.00621100166700820116          , 0.00110605534482358693          , 0.000170391357084046847         , 0.0000230006570715105323        , 2.75502987035670437e-6          , },
+/* x = 1.9         */  {0.609984425946011281            , 0.121162054400888481            , 0.0281470452605303145           , 0.005785168130818776            , 0.00102421537578677126          , 0.000157153293744095484         , 0.0000211526785524747755        , 2.52821909087974341e-6          , },
+/* x = 2.0         */  {0.598144006661304101            , 0.115702180856172852            , 0.0264714074164882332           , 0.00539078295534456832          , 0.0009487250092485331           , 0.000144977747418896787         , 0.0000194567164431705093        , 2.32041580711623389e-6          , },
+/* x = 2.1         */  {0.586833205308846941            , 0.110565899299015484            , 0.024909674957626731            , 0.0050254095763208492           , 0.000879075138417596788         , 0.000133777384216704357         , 0.0000179000393231044449        , 2.13000471519631964e-6          , },
+/* x = 2.2         */  {0.576020773306374634            , 0.105731276123645625            , 0.02345348522825034             , 0.00468680658788520896          , 0.000814798469023152395         , 0.000123472179823233019         , 0.0000164709971604588704        , 1.95550933710142244e-6          , },
+/* x = 2.3         */  {0.565677574001107307            , 0.101177984843109472            , 0.0220951207398396395           , 0.00437291172737654571          , 0.000755466021983796974         , 0.000113988798959594951         , 0.0000151589284130016911        , 1.79557997855814766e-6          , },
+/* x = 2.4         */  {0.555776428234162854            , 0.096887182280156323            , 0.0208274576615683818           , 0.0040818271988288651           , 0.000700683932824651311         , 0.000105260028126236423         , 0.0000139540751843806641        , 1.64898273959947557e-6          , },
+/* x = 2.5         */  {0.546291971785147992            , 0.0928413946322498393           , 0.0196439185272850723           , 0.00381180622163173092          , 0.000650090522371949196         , 0.0000972242570140703851        , 0.0000128475057318539203        , 1.51458948516880552e-6          , },
+/* x = 2.6         */  {0.537200523750481533            , 0.0890244126031053179           , 0.0185384288072098147           , 0.00356124070056936753          , 0.000603353615461374645         , 0.0000898250043675048764        , 0.0000118310436834328409        , 1.3913686913384276e-6           , },
+/* x = 2.7         */  {0.5284799649863474              , 0.0854211948604810435           , 0.0175053770223790153           , 0.00332864992234692555          , 0.000560168086410656699         , 0.000083010484452086546         , 0.0000108972033788591758        , 1.27837709018122136e-6          , },
+/* x = 2.8         */  {0.52010962581807524             , 0.0820177791415816563           , 0.0165395781071006253           , 0.00311267019183893716          , 0.000520253611845367527         , 0.0000767332106151509238        , 0.0000100391308002929699        , 1.17475204313790508e-6          , },
+/* x = 2.9         */  {0.512070182282748204            , 0.0788012003838518923           , 0.0156362397495817627           , 0.00291204532871868961          , 0.00048335261314495499          , 0.0000709496327340561045        , 9.2505496054949303e-6           , 1.07970457892122737e-6          , },
+/* x = 3.0         */  {0.504343560231438807            , 0.0757594153105958107           , 0.0147909314636602908           , 0.00272561795190941568          , 0.000449228372307857748         , 0.0000656198056258796257        , 8.52571181905026921e-6          , 9.92513037647042886e-7          , },
+/* x = 3.1         */  {0.496912846672130588            , 0.0728812329481569003           , 0.0139995561653962012           , 0.00255232148549473672          , 0.000417663306432937743         , 0.0000607070857472536915        , 7.85935277616869774e-6          , 9.12517268029352431e-7          , },
+/* x = 3.2         */  {0.489762207784512201            , 0.0701562505947103103           , 0.0132583240473253684           , 0.0023911728253876945           , 0.000388457387291126002         , 0.0000561778537454648455        , 7.24664994914222674e-6          , 8.39113329166822518e-7          , },
+/* x = 3.3         */  {0.482876813083812836            , 0.0675747948003898229           , 0.0125637285606007169           , 0.00224126561123149403          , 0.000361426693626784999         , 0.0000520012606340221646        , 6.68318531895396714e-6          , 7.71748652722737102e-7          , },
+/* x = 3.4         */  {0.476242765253032195            , 0.0651278669548097229           , 0.0119125243311840507           , 0.00210176405273319675          , 0.000336402084892574657         , 0.0000481489955593995667        , 6.16491098408524275e-6          , 7.09917625195838955e-7          , },
+/* x = 3.5         */  {0.469847035201623517            , 0.062807093111329288            , 0.0113017068508335259           , 0.00197189726395277997          , 0.000313227986093442012         , 0.0000445950733022202069        , 5.68811772551828817e-6          , 6.53157553529837769e-7          , },
+/* x = 3.6         */  {0.463677401944206322            , 0.060604677707904689            , 0.0107284937969737157           , 0.00185095406301955084          , 0.000291761274302827399         , 0.0000413156398172663858        , 5.24940627150830797e-6          , 6.01044980545227122e-7          , },
+/* x = 3.7         */  {0.457722396925483523            , 0.0585133608723167745           , 0.0101903078477439819           , 0.00173827819835811775          , 0.000271870258224670913         , 0.0000382887942637269437        , 4.84566102811189461e-6          , 5.5319231962644633e-7           , },
+/* x = 3.8         */  {0.451971252447459716            , 0.056526379025170279            , 0.00968476086969376587          , 0.00163326396580640489          , 0.000253433742915040622         , 0.0000354944261112754152        , 4.47402606190021058e-6          , 5.0924478078582851e-7           , },
+/* x = 3.9         */  {0.446413853882527473            , 0.0546374285175286006           , 0.00920963936581932136          , 0.00153535218402540225          , 0.000236340172453325352         , 0.0000329140660300362046        , 4.13188313992938063e-6          , 4.68877562676399427e-7          , },
+/* x = 4.0         */  {0.44104069538121084             , 0.0528406320615595825           , 0.00876289108099653544          , 0.00144402649835898279          , 0.000220486843970536964         , 0.0000305307493842727124        , 3.81683164904614585e-6          , 4.31793287359567085e-7          , },
+/* x = 4.1         */  {0.435842838806517484            , 0.0511305077322873459           , 0.008342612670432975            , 0.00135880998582456306          , 0.000205779187006455289         , 0.0000283288912516596493        , 3.52667023211881599e-6          , 3.97719656670317221e-7          , },
+/* x = 4.2         */  {0.430811875648124345            , 0.0495019403366245999           , 0.00794703834460691032          , 0.00127926203622205153          , 0.000192130102682780049         , 0.000026294171983137683         , 3.25937999293386827e-6          , 3.66407310879235186e-7          , },
+/* x = 4.3         */  {0.425939891689163391            , 0.0479501549624374953           , 0.00757452941134369501          , 0.00120497548645806237          , 0.000179459357650376395         , 0.000024413432403372451         , 3.01310913440741337e-6          , 3.37627872043476777e-7          , },
+/* x = 4.4         */  {0.42121943421632775             , 0.0464706925355976487           , 0.00722356464225707414          , 0.00113557398711178599          , 0.000167693028198989443         , 0.000022674577829463332         , 2.78615890653774574e-6          , 3.11172155982252411e-7          , },
+/* x = 4.5         */  {0.416643481580515841            , 0.0450593872269192816           , 0.0068927313968064188           , 0.00107070958203373855          , 0.000156762990310994039         , 0.0000210664901564188944        , 2.57697075127015959e-6          , 2.86848538219717532e-7          , },
+/* x = 4.6         */  {0.412205414930392648            , 0.0437123455636694637           , 0.00658071744273776138          , 0.00101006048338304406          , 0.000146606451800064624         , 0.0000195789473226271532        , 2.38411454124913354e-6          , 2.64481460521443846e-7          , },
+/* x = 4.7         */  {0.407898991955183335            , 0.0424259271120731402           , 0.0062863034167299789           , 0.000953329025985886028         , 0.000137165523004039876         , 0.0000182025495276390037        , 2.20627781837879252e-6          , 2.43910065820873035e-7          , },
+/* x = 4.8         */  {0.403718322485826271            , 0.0411967266080006502           , 0.00600835587369697509          , 0.000900239786249127119         , 0.000128386822801403256         , 0.0000169286516285443355        , 2.04225594627582378e-6          , 2.24986950399340313e-7          , },
+/* x = 4.9         */  {0.399657845815392672            , 0.0400215574229049318           , 0.00574582087743828851          , 0.000850537852099635113         , 0.000120221116995154482         , 0.0000157493011905008738        , 1.89094309814864129e-6          , 2.07577023156522149e-7          , },
+/* x = 5.0         */  {0.395712309610513542            , 0.0388974362611428075           , 0.00549771808921714777          , 0.00080398723155143351          , 0.000112622986358644751         , 0.0000146571817119848327        , 1.75132400843534889e-6          , 1.91556462695821399e-7          , },
+/* x = 5.1         */  {0.391876750295519059            , 0.0378215689931375905           , 0.00526313531440672232          , 0.000760369388538424625         , 0.000105550521867231202         , 0.0000136455605864430584        , 1.62246642273818095e-6          , 1.76811763758826207e-7          , },
+/* x = 5.2         */  {0.38814647480016237             , 0.0367913375364809228           , 0.00504122347060971135          , 0.000719481895598338799         , 0.0000989650448492366072        , 0.0000127082413995787939        , 1.50351418625577397e-6          , 1.63238865281465047e-7          , },
+/* x = 5.3         */  {0.384517043570234199            , 0.0358042877040871682           , 0.00483119194364864567          , 0.000681137193861261643         , 0.000092830849981378824         , 0.0000118395201958078693        , 1.39368091608440399e-6          , 1.5074235301811555e-7           , },
+/* x = 5.4         */  {0.380984254748136658            , 0.034858117944955925            , 0.00463230430056736607          , 0.000645161451590447419         , 0.0000871149692291131312        , 0.0000110341453787621669        , 1.29224420747857412e-6          , 1.39234730294436835e-7          , },
+/* x = 5.5         */  {0.377544129437629076            , 0.0339506689090150008           , 0.00444387433129913343          , 0.000611393513250413141         , 0.0000817869549926260792        , 0.0000102872809393508834        , 1.19854032846958322e-6          , 1.28635751010303607e-7          , },
+/* x = 5.6         */  {0.374192897973535809            , 0.0330799137729511499           , 0.00426526239296296959          , 0.000579683931743255432         , 0.0000768186808658251389        , 9.59447273105304999e-6          , 1.11195936117399494e-6          , 1.18871809525681367e-7          , },
+/* x = 5.7         */  {0.370926987123262128            , 0.0322439492689290224           , 0.00409587203286472783          , 0.000549894077063976689         , 0.0000721841585497651614        , 8.95161753602193136e-6          , 1.03194075171511655e-6          , 1.09875382528930279e-7          , },
+/* x = 5.8         */  {0.367743008152541549            , 0.0314409873626867012           , 0.00393514686821915039          , 0.000521895315184133464         , 0.0000678593695846185013        , 8.35493468742944075e-6          , 9.57969233959656015e-7          , 1.01584518412810714e-7          , },
+/* x = 5.9         */  {0.364637745692975407            , 0.0306693475317124608           , 0.00378256770238851751          , 0.000495568251484700648         , 0.0000638221106765150353        , 7.80094003344553559e-6          , 8.89571095265976665e-7          , 9.39423700719863524e-8          , },
+/* x = 6.0         */  {0.361608147353658497            , 0.0299274495980826782           , 0.00363764985906590317          , 0.000470802033527676018         , 0.0000600518514982501192        , 7.2864220464969912e-6           , 8.2631075517473032e-7           , 8.68967673903623904e-8          , },
+/* x = 6.1         */  {0.358651314023545994            , 0.0292138070741032944           , 0.00349994071732885577          , 0.000447493708385283541         , 0.0000565296039368036416        , 6.80841989813100008e-6          , 7.67787630469844903e-7          , 8.03998260101474405e-8          , },
+/* x = 6.2         */  {0.355764490815236588            , 0.0285270209821726495           , 0.00336901743186379895          , 0.000425547630139008806         , 0.0000532378018465814365        , 6.36420333505769887e-6          , 7.13633262318596342e-7          , 7.44075892698145065e-8          , },
+/* x = 6.3         */  {0.352945058604552237            , 0.0278657741132955024           , 0.00324448482392292065          , 0.000404874913521167985         , 0.0000501601904459660997        , 5.95125420588609174e-6          , 6.63508683282708804e-7          , 6.88797004676437324e-8          , },
+/* x = 6.4         */  {0.350190526123711584            , 0.0272288256914482539           , 0.00312597342973323543          , 0.000385392930002062758         , 0.0000472817245667731163        , 5.56724950081318921e-6          , 6.17102003895342368e-7          , 6.37791028535229115e-8          , },
+/* x = 6.5         */  {0.347498522569044835            , 0.0266150064135436356           , 0.00301313769414051286          , 0.000367024842928558412         , 0.000044588475032121413         , 5.21004577817990562e-6          , 5.74126200237169121e-7          , 5.90717649762260458e-8          , },
+/* x = 6.6         */  {0.344866790687104269            , 0.0260232138370876042           , 0.00290565429824677724          , 0.00034969917859747322          , 0.0000420675424985668618        , 4.87766486246373025e-6          , 5.34317085532852538e-7          , 5.47264292183683011e-8          , },
+/* x = 6.7         */  {0.342293180305705876            , 0.0254524080897785369           , 0.00280322061069634812          , 0.000333349430401616915         , 0.0000397069781535896432        , 4.56828070802355831e-6          , 4.97431450240217224e-7          , 5.07143815383640138e-8          , },
+/* x = 6.8         */  {0.339775642278912               , 0.0249016078772843527           , 0.00270555325308853879          , 0.00031791369341961501          , 0.0000374957107101073142        , 4.28020733182498577e-6          , 4.63245356430165252e-7          , 4.70092406095580018e-8          , },
+/* x = 6.9         */  {0.337312222817248617            , 0.0243698867672608773           , 0.00261238677075123627          , 0.000303334327034587584         , 0.000035423479186002922         , 4.01188772652664274e-6          , 4.31552573466853629e-7          , 4.3586764702686324e-8           , },
+/* x = 7.0         */  {0.334901058176559283            , 0.0238563697293574833           , 0.00252347240080421192          , 0.000289557643362947655         , 0.0000334807709990752539        , 3.76188367276532061e-6          , 4.02163143104732837e-7          , 4.04246748002520287e-8          , },
+/* x = 7.1         */  {0.332540369680844635            , 0.0233602299125055444           , 0.00243857693007925102          , 0.000276533619454537629         , 0.0000316587649466686506        , 3.52886637629960344e-6          , 3.74902063130826709e-7          , 3.75024925614609005e-8          , },
+/* x = 7.2         */  {0.330228459056234436            , 0.0228806856422123442           , 0.00235748163605070671          , 0.000264215631390398007         , 0.0000299492786748264957        , 3.31160786191310399e-6          , 3.49608079605383671e-7          , 3.48013918751338155e-8          , },
+/* x = 7.3         */  {0.327963704054900268            , 0.0224169976218977002           , 0.00227998130446915262          , 0.000252560208555909611         , 0.0000283447202744131262        , 3.10897306168915013e-6          , 3.26132578599299271e-7          , 3.23040628464828894e-8          , },
+/* x = 7.4         */  {0.325744554349251862            , 0.0219684663235217763           , 0.00220588331788634312          , 0.000241526806506011922         , 0.0000268380436715172527        , 2.9199125404944561e-6           , 3.04338569099390906e-7          , 2.999458716270815e-8            , },
+/* x = 7.5         */  {0.32356952767817865             , 0.0215344295538687211           , 0.00213500680971527766          , 0.000231077596966721589         , 0.000025422707506817981         , 2.7434558062915835e-6           , 2.84099749458986726e-7          , 2.78583238728608753e-8          , },
+/* x = 7.6         */  {0.321437206228409496            , 0.0211142601838795319           , 0.00206718187888809161          , 0.000221177273634213876         , 0.0000240926372236742656        , 2.57870515727688085e-6          , 2.65299650417111844e-7          , 2.58818047000777486e-8          , },
+/* x = 7.7         */  {0.319346233235276195            , 0.020707364029375935            , 0.00200224886055977298          , 0.00021179287254016161          , 0.0000228421901076839571        , 2.42483002184682775e-6          , 2.47830848300055517e-7          , 2.40526380797995591e-8          , },
+/* x = 7.8         */  {0.317295309788287817            , 0.0203131778723915404           , 0.00194005764866009085          , 0.000202893605850653011         , 0.0000216661230415268156        , 2.2810617510630371e-6           , 2.31594242559065372e-7          , 2.23594211865723593e-8          , },
+/* x = 7.9         */  {0.315283191827960479            , 0.0199311676131329994           , 0.00188046706642214904          , 0.000194450708056565423         , 0.0000205595627582190384        , 2.14668882664357802e-6          , 2.16498392291704871e-7          , 2.07916592750561234e-8          , },
+/* x = 8.0         */  {0.313308687321307169            , 0.0195608265433377911           , 0.00182334428131596442          , 0.000186437293596428462         , 0.0000195179783936132385        , 2.02105245058226441e-6          , 2.02458906846013644e-7          , 1.93396917184545619e-8          , },
+/* x = 8.1         */  {0.31137065360428081             , 0.0192016737324816015           , 0.00176856426109154129          , 0.000178828225029182574         , 0.0000185371561552129667        , 1.90354248531231181e-6          , 1.8939788601966606e-7           , 1.79946241802029157e-8          , },
+/* x = 8.2         */  {0.309467994880286342            , 0.0188532525189215975           , 0.00171600926789001982          , 0.000171599990944390812         , 0.0000176131759392588206        , 1.79359371590841612e-6          , 1.77243405744153705e-7          , 1.67482664028399191e-8          , },
+/* x = 8.3         */  {0.307599659864639378            , 0.0185151290986464714           , 0.00166556838761540549          , 0.000164730592861908664         , 0.0000167423897416973189        , 1.69068240818206268e-6          , 1.65929045489656185e-7          , 1.55930751419395423e-8          , },
+/* x = 8.4         */  {0.305764639565554556            , 0.0181868912048437922           , 0.00161713709197477762          , 0.000158199440432231428         , 0.0000159214017211678366        , 1.59432313868720458e-6          , 1.55393453942481959e-7          , 1.45221018131470009e-8          , },
+/* x = 8.5         */  {0.303961965192900388            , 0.0178681468719935143           , 0.00157061683079323232          , 0.000151987254303153716         , 0.0000151470497836318919        , 1.50406587463423748e-6          , 1.45579949796286708e-7          , 1.35289444570798251e-8          , },
+/* x = 8.6         */  {0.302190706186563224            , 0.0175585232786567235           , 0.00152591465239251719          , 0.000146075976068387527         , 0.0000144163885688098281        , 1.41949328352487584e-6          , 1.36436154763021397e-7          , 1.26077036604178335e-8          , },
+/* x = 8.7         */  {0.300449968356824519            , 0.017257665663553844            , 0.00148294284999062927          , 0.000140448684759757273         , 0.0000137266737282619062        , 1.34021825398320801e-6          , 1.27913656151835981e-7          , 1.1752942102188827e-8           , },
+/* x = 8.8         */  {0.29873889212967622             , 0.0169652363099193604           , 0.00144161863223473309          , 0.00013508951938685468          , 0.0000130753473938267518        , 1.26588161078177168e-6          , 1.19967696585895046e-7          , 1.09596474223090394e-8          , },
+/* x = 8.9         */  {0.297056650890482049            , 0.0166809135934831482           , 0.0014018638161226807           , 0.000129983607066898835         , 0.0000124600247432765441        , 1.19615000845773505e-6          , 1.12556888630009271e-7          , 1.0223198135086447e-8           , },
+/* x = 9.0         */  {0.295402449419840411            , 0.0164043910897640962           , 0.00136360454070015581          , 0.000125116996323285912         , 0.000011878481577526224         , 1.13071398919397446e-6          , 1.05642952287759779e-7          , 9.53933233384867707e-9          , },
+/* x = 9.1         */  {0.293775522415920395            , 0.0161353767366719934           , 0.00132677100004191938          , 0.000120476595164185706         , 0.0000113286428305990955        , 1.06928619181286167e-6          , 9.91904734968607045e-8          , 8.90411895430513538e-9          , },
+/* x = 9.2         */  {0.292175133097928179            , 0.0158735920487006025           , 0.0012912971941376281           , 0.000116050113582782497         , 0.0000108085719398545551        , 1.01159969980592869e-6          , 9.316668190721109e-8            , 8.31393138386821139e-9          , },
+/* x = 9.3         */  {0.290600571885719452            , 0.0156187713792602838           , 0.00125712069640598597          , 0.000111826010148581419         , 0.000010316461009772057         , 9.57406517308508504e-7          , 8.75412463686572497e-8          , 7.76542322209910521e-9          , },
+/* x = 9.4         */  {0.289051155150906142            , 0.0153706612279441229           , 0.00122418243665626958          , 0.000107793442384805528         , 9.85062170790159556e-6          , 9.06476162832496621e-7          , 8.22860866860419088e-8          , 7.25550601385427224e-9          , },
+/* x = 9.5         */  {0.287526224035114883            , 0.0151290195897487991           , 0.00119242649840417623          , 0.000103942220650474225         , 9.40947683647415981e-6          , 8.58594371399437688e-7          , 7.73752003186810787e-8          , 6.78132879172049191e-9          , },
+/* x = 9.6         */  {0.286025143331341837            , 0.0148936153434818221           , 0.00116179992953006803          , 0.00010026276526744641          , 8.9915525276516826e-6           , 8.1356189647652325e-7           , 7.27845028109199086e-8          , 6.34025927806047941e-9          , },
+/* x = 9.7         */  {0.284547300424615478            , 0.0146642276767815596           , 0.00113225256534256332          , 0.0000967460666526839438        , 8.59547101451783408e-6          , 7.71193403815562743e-7          , 6.84916808407302924e-8          , 5.92986660955667487e-9          , },
+/* x = 9.8         */  {0.283092104288427166            , 0.0144406455453568872           , 0.00110373686317955318          , 0.0000933836482343822688        , 8.21994393369872089e-6          , 7.31316449934841297e-7          , 6.44760568652078749e-8          , 5.54790545863873428e-9          , },
+/* x = 9.9         */  {0.281658984533620193            , 0.0142226671642204049           , 0.0010762077477425515           , 0.0000901675319475533647        , 7.86376611898372478e-6          , 6.93770538570837227e-7          , 6.07184644260192086e-8          , 5.19230143670198503e-9          , },
+/* x = 10.0        */  {0.280247390506642741            , 0.0140100995288440128           , 0.00104962246641923884          , 0.0000870902061202491961        , 7.52580984851662788e-6          , 6.58406248965461155e-7          , 5.72011332549947134e-8          , 4.86113767365342922e-9          , },
+/* x = 10.1        */  {0.278856790434270053            , 0.0138027579643091461           , 0.00102394045390351826          , 0.0000841445955759891246        , 7.2050195110689821e-6           , 6.25084430348844648e-7          , 5.39075833907573038e-8          , 4.55264247713527085e-9          , },
+/* x = 10.2        */  {0.27748667061208716             , 0.0136004657006570114           , 0.000999123205472718324         , 0.0000813240337912014423        , 6.90040665961261003e-6          , 5.93675457431453049e-7          , 5.08225275820664025e-8          , 4.26517798284328142e-9          , },
+/* x = 10.3        */  {0.276136534634196706            , 0.0134030534727675236           , 0.00097513415832807893          , 0.0000786222369586979798        , 6.6110454228956233e-6           , 5.64058542135815388e-7          , 4.79317813129421061e-8          , 3.99722971474244028e-9          , },
+/* x = 10.4        */  {0.274805902661777768            , 0.0132103591432100656           , 0.000951938580447639258         , 0.0000760332798194550396        , 6.33606824801423883e-6          , 5.36121097180557673e-7          , 4.52221798390713469e-8          , 3.74739698074351506e-9          , },
+/* x = 10.5        */  {0.273494310728271882            , 0.0130222273466153398           , 0.000929503466440387432         , 0.0000735515731353502156        , 6.07466194907730535e-6          , 5.09758147480536031e-7          , 4.26815016749047886e-8          , 3.51438403559487588e-9          , },
+/* x = 10.6        */  {0.272201310079112563            , 0.0128385091542160877           , 0.000907797439927282076         , 0.0000711718426850732513        , 5.82606403899680298e-6          , 4.84871785649294909e-7          , 4.02983980166120338e-8          , 3.29699194841256214e-9          , },
+/* x = 10.7        */  {0.2709264665440452              , 0.0126590617572958873           , 0.000886790662008748822         , 0.0000688891096742544862        , 5.58955932321938517e-6          , 4.61370668186205219e-7          , 3.80623276280230202e-8          , 3.09411111746294387e-9          , },
+/* x = 10.8        */  {0.269669359940206005            , 0.0124837481683701312           , 0.000866454745409704203         , 0.0000666986724589959112        , 5.36447673585388953e-6          , 4.39169549202649769e-7          , 3.59634967551649794e-8          , 2.90471437956691166e-9          , },
+/* x = 10.9        */  {0.268429583504242283            , 0.0123124369390021332           , 0.000846762673922261901         , 0.000064596089489501823         , 5.1501864001592049e-6           , 4.18188848791516702e-7          , 3.39928036702995338e-8          , 2.72785066584956196e-9          , },
+/* x = 11.0        */  {0.267206743351862277            , 0.0121450018932305469           , 0.000827688726793213522         , 0.0000625771633874385573        , 4.94609689674654118e-6          , 3.98354253373866378e-7          , 3.21417874787410328e-8          , 2.56263915954879516e-9          , },
+/* x = 11.1        */  {0.266000457963301802            , 0.0119813218756523399           , 0.000809208407728314522         , 0.0000606379260770517282        , 4.75165272412972514e-6          , 3.79596345567629731e-7          , 3.04025808514399535e-8          , 2.40826391525117025e-9          , },
+/* x = 11.2        */  {0.264810357693287246            , 0.0118212805132688199           , 0.000791298378208499524         , 0.0000587746248959770408        , 4.56633193743555573e-6          , 3.61850261317112755e-7          , 2.87678663735681971e-8          , 2.26396890227215642e-9          , },
+/* x = 11.3        */  {0.263636084304160788            , 0.0116647659902610177           , 0.000773936394834541256         , 0.0000569837096171358726        , 4.3896439521716785e-6           , 3.45055372200329766e-7          , 2.72308362243514664e-8          , 2.12905343796654634e-9          , },
+/* x = 11.4        */  {0.262477290520914275            , 0.0115116708349154247           , 0.000757101250436484283         , 0.0000552618203181451161        , 4.22112750094938584e-6          , 3.29154990995057163e-7          , 2.57851549263453041e-8          , 2.00286797956698258e-9          , },
+/* x = 11.5        */  {0.261333639606953566            , 0.0113618917179719537           , 0.000740772718702548487         , 0.0000536057760393250301        , 4.0603487319801097e-6           , 3.14096098735171371e-7          , 2.44249249234176026e-8          , 1.88481024572600112e-9          , },
+/* x = 11.6        */  {0.260204804959485507            , 0.0112153292617133301           , 0.000724931502099218595         , 0.0000520125641756892122        , 3.90689943901346856e-6          , 2.99829091627392814e-7          , 2.31446547660387273e-8          , 1.77432164129955933e-9          , },
+/* x = 11.7        */  {0.259090469723485612            , 0.0110718878591591818           , 0.000709559182870016839         , 0.0000504793305522750073        , 3.76039541316736635e-6          , 2.86307546325994931e-7          , 2.1939229700234802e-8           , 1.67088396107584098e-9          , },
+/* x = 11.8        */  {0.257990326423266081            , 0.0109314755027691103           , 0.00069463817691509013          , 0.0000490033701358462178        , 3.62047490782214739e-6          , 2.73488002180263762e-7          , 2.08038844728620117e-8          , 1.57401635013881798e-9          , },
+/* x = 11.9        */  {0.256904076610721443            , 0.0107940036220972296           , 0.000680151690367317421         , 0.0000475821183393963217        , 3.486797208416082e-6            , 2.61329759177343921e-7          , 1.97341781808306783e-8          , 1.48327250037678134e-9          , },
+/* x = 12.0        */  {0.255831430529383064            , 0.010659386929876239            , 0.000666083678693237266         , 0.000046213142879021142         , 3.35904129959298569e-6          , 2.49794690402346076e-7          , 1.87259710056579057e-8          , 1.39823806431572245e-9          , },
+/* x = 12.1        */  {0.254772106793464264            , 0.0105275432760422568           , 0.000652418808158783474         , 0.0000448941361456348801        , 3.23690462271868943e-6          , 2.38847067928921065e-7          , 1.77754026873579925e-8          , 1.31852826898875661e-9          , },
+/* x = 12.2        */  {0.253725832081125116            , 0.0103983935092425412           , 0.000639142419510666232         , 0.0000436229080566909213        , 3.12010191730516948e-6          , 2.2845340113757007e-7           , 1.68788726032833019e-8          , 1.24378571395735966e-9          , },
+/* x = 12.3        */  {0.252692340841230325            , 0.0102718613453970424           , 0.000626240493734309835         , 0.0000423973793555556579        , 3.00836414036289702e-6          , 2.18582286536349092e-7          , 1.60330213281897904e-8          , 1.17367833888867276e-9          , },
+/* x = 12.4        */  {0.251671375012915116            , 0.010147873242911596            , 0.000613699619758613957         , 0.000041215575328485241         , 2.90143745814658e-6             , 2.09204268229880904e-7          , 1.5234713561598739e-8           , 1.10789754727525352e-9          , },
+/* x = 12.5        */  {0.250662683757313042            , 0.0100263582841656385           , 0.000601506963986496739         , 0.0000400756199112859248        , 2.79908230516988362e-6          , 2.00291708248205397e-7          , 1.44810223175306918e-8          , 1.04615647396832226e-9          , },
+/* x = 12.6        */  {0.249666023200836123            , 0.00990724806292071363          , 0.000589650241538254002         , 0.0000389757301597116458        , 2.70107250574363416e-6          , 1.91818666007435779e-7          , 1.37692142799645086e-8          , 9.88188385190921971e-10         , },
+/* x = 12.7        */  {0.248681156189432009            , 0.00979047657731787294          , 0.000578117689102275244         , 0.0000379142110594797639        , 2.60719445364191874e-6          , 1.83760786229861558e-7          , 1.30967362349836415e-8          , 9.33745200610942885e-10         , },
+/* x = 12.8        */  {0.247707852053275027            , 0.00967598012815246053          , 0.000566898039294635632         , 0.0000368894506534786401        , 2.51724634582367462e-6          , 1.76095194702433762e-7          , 1.24612024975681079e-8          , 8.8259612789248736e-10          , },
+/* x = 12.9        */  {0.24674588638137813             , 0.00956369722213380865          , 0.000555980496435572855         , 0.0000358999154653091855        , 2.43103746643591595e-6          , 1.68800401299835662e-7          , 1.18603832574244421e-8          , 8.34526400913822309e-10         , },
+/* x = 13.0        */  {0.245795040805641159            , 0.0094535684798551607           , 0.000545354713656894251         , 0.0000349441461997561632        , 2.34838751760060545e-6          , 1.61856209741906962e-7          , 1.12921937741632551e-8          , 7.89336113546909445e-10         , },
+/* x = 13.1        */  {0.244855102793877416            , 0.00934553654821575925          , 0.000535010771259976227         , 0.0000340207537021325622        , 2.26912599374211852e-6          , 1.55243633595348e-7             , 1.07546843575771772e-8          , 7.46839141542460997e-10         , },
+/* x = 13.2        */  {0.243925865451385581            , 0.00923954601705257573          , 0.000524939156249245176         , 0.0000331284151596898349        , 2.19309159644790271e-6          , 1.48944818066655644e-7          , 1.02460310737796477e-8          , 7.06862145660440683e-10         , },
+/* x = 13.3        */  {0.243007127330657544            , 0.00913554333975368832          , 0.000515130742970895314         , 0.000032265870529445607         , 2.12013168707280894e-6          , 1.42942967167384857e-7          , 9.76452712257277276e-9          , 6.69243649733313088e-10         , },
+/* x = 13.4        */  {0.242098692248834791            , 0.00903347675763890478          , 0.000505576774791130058         , 0.000031431919177855456         , 2.05010177449904525e-6          , 1.37222275864319193e-7          , 9.30857483565288582e-9          , 6.33833187852165968e-10         , },
+/* x = 13.5        */  {0.241200369112546835            , 0.00893329622790594262          , 0.000496268846752434144         , 0.0000306254167187528232        , 1.98286503565005322e-6          , 1.317678668561813e-7            , 8.87667824916539257e-9          , 6.00490515327777705e-10         , },
+/* x = 13.6        */  {0.240311971749784688            , 0.00883495335495237983          , 0.00048719888915031586          , 0.0000298452720369068743        , 1.91829186652900124e-6          , 1.26565731645314814e-7          , 8.46743620771338041e-9          , 5.6908487850315511e-10          , },
+/* x = 13.7        */  {0.239433318748480856            , 0.00873840132489473074          , 0.000478359151976623319         , 0.0000290904444854075355        , 1.85625946171210789e-6          , 1.21602675597500292e-7          , 8.07953596023246363e-9          , 5.39494338884120584e-10         , },
+/* x = 13.8        */  {0.23856423330148461             , 0.00864359484311643504          , 0.000469742190178954758         , 0.0000283599412458849341        , 1.79665142037464484e-6          , 1.1686626670589396e-7           , 7.71174721119049596e-9          , 5.11605147413018686e-10         , },
+/* x = 13.9        */  {0.23770454305763765             , 0.00855049007468632202          , 0.000461340849688868131         , 0.0000276528148413116508        , 1.73935737706413576e-6          , 1.1234478779614969e-7           , 7.36291659337628065e-9          , 4.85311165040139527e-10         , },
+/* x = 14.0        */  {0.23685407997867067             , 0.00845904458749827022          , 0.000453148254174566198         , 0.0000269681607918247525        , 1.68427265556180958e-6          , 1.08027191929240268e-7          , 7.03196253112567391e-9          , 4.60513326050402068e-10         , },
+/* x = 14.1        */  {0.236012680201655776            , 0.00836921729799136738          , 0.000445157792476505066         , 0.0000263051154046444104        , 1.63129794429055676e-6          , 1.03903060776460945e-7          , 6.71787046521434332e-9          , 4.37119140881387428e-10         , },
+/* x = 14.2        */  {0.235180183906763438            , 0.00828096841931792397          , 0.000437363106686960815         , 0.0000256628536897606251        , 1.58033899183619222e-6          , 9.99625657576936287e-8          , 6.41968841284027563e-9          , 4.15042235424961897e-10         , },
+/* x = 14.3        */  {0.234356435190085478            , 0.00819425941183424286          , 0.000429758080837003436         , 0.0000250405873936124843        , 1.53130632124940601e-6          , 9.61964317493413886e-8          , 6.13652283814095667e-9          , 3.94201924040315943e-10         , },
+/* x = 14.4        */  {0.233541281941297795            , 0.00810905293579612936          , 0.000422336830156581921         , 0.0000244375631434985518        , 1.48411496188898975e-6          , 9.25959031825093536e-8          , 5.86753481055376577e-9          , 3.74522813722951029e-10         , },
+/* x = 14.5        */  {0.232734575725947972            , 0.00802531280614777255          , 0.000415093690875530168         , 0.0000238530606959352517        , 1.43868419765332282e-6          , 8.91527123651005291e-8          , 5.61193643004620739e-9          , 3.55934437073512679e-10         , },
+/* x = 14.6        */  {0.231936171672163723            , 0.00794300394929886756          , 0.000408023210535270758         , 0.0000232863912826250981        , 1.3949373305272028e-6           , 8.58590498735974329e-8          , 5.3689874998267795e-9           , 3.38370911893810182e-10         , },
+/* x = 14.7        */  {0.231145928361588385            , 0.00786209236179070739          , 0.000401120138782832225         , 0.0000227368960481107422        , 1.35280145844538527e-6          , 8.27075368714897651e-8          , 5.1379924286082371e-9           , 3.21770625406177602e-10         , },
+/* x = 14.8        */  {0.23036370772435927             , 0.00778254507075747574          , 0.000394379418620514167         , 0.0000222039445735763128        , 1.3122072665430977e-6           , 7.96911992216555681e-8          , 4.91829734584256868e-9          , 3.06075941247706969e-10         , },
+/* x = 14.9        */  {0.229589374937953857            , 0.00770433009609414317          , 0.000387796178086141595         , 0.0000216869334816164736        , 1.27308883092771451e-6          , 7.68034432695737863e-8          , 4.70928741459018103e-9          , 2.91232927533914061e-10         , },
+/* x = 15.0        */  {0.228822798329737351            , 0.00762741641424722832          , 0.000381365722340353052         , 0.0000211852851171279372        , 1.23538343416509936e-6          , 7.40380331830998987e-8          , 4.51038432783287224e-9          , 2.77191104418081074e-10         , },
+/* x = 15.1        */  {0.228063849283053361            , 0.0075517739235492552           , 0.000375083526138773369         , 0.0000206984462997896226        , 1.19903139172918056e-6          , 7.13890697427287306e-8          , 4.32104397509877869e-9          , 2.63903209693777514e-10         , },
+/* x = 15.2        */  {0.227312402146707067            , 0.00747737341102203401          , 0.000368945226668237981         , 0.0000202258871438878676        , 1.16397588871444309e-6          , 6.8850970483850588e-8           , 4.14075426724460957e-9          , 2.51324981099733602e-10         , },
+/* x = 15.3        */  {0.226568334147697597            , 0.0074041865205779353           , 0.000362946616727467799         , 0.0000197670999415136243        , 1.13016282615849081e-6          , 6.64184510995254476e-8          , 3.96903310814256625e-9          , 2.39414954089103181e-10         , },
+/* x = 15.4        */  {0.22583152530706318             , 0.00733218572255213047          , 0.000357083638233747244         , 0.0000193215981054107751        , 1.09754067636592446e-6          , 6.40865080187982931e-8          , 3.80542650285229771e-9          , 2.28134273919915442e-10         , },
+/* x = 15.5        */  {0.225101858358709184            , 0.00726134428450235234          , 0.000351352376038238636         , 0.0000188889151679899181        , 1.06606034666574591e-6          , 6.18504020815966451e-8          , 3.64950679262750778e-9          , 2.17446521010828693e-10         , },
+/* x = 15.6        */  {0.224379218671095322            , 0.00719163624321610007          , 0.000345749052033578536         , 0.0000184686038332413771        , 1.03567505107256714e-6          , 5.97056432368255703e-8          , 3.50087100781740503e-9          , 2.07317548586763233e-10         , },
+/* x = 15.7        */  {0.223663494171664143            , 0.0071230363778683881           , 0.000340270019538350436         , 0.0000180602350784859207        , 1.00634018935728739e-6          , 5.76479761954398034e-8          , 3.35913933037967287e-9          , 1.97715331713153636e-10         , },
+/* x = 15.8        */  {0.222954575273898488            , 0.00705552018427612962          , 0.00033491175794391767          , 0.0000176633973030927455        , 9.78013233065800598e-7          , 5.5673366975058225e-8           , 3.22395365832826641e-9          , 1.88609826885927981e-10         , },
+/* x = 15.9        */  {0.222252354806900806            , 0.00698906385019806433          , 0.000329670867609934477         , 0.000017277695521472665         , 9.50653618054889468e-7          , 5.37779902771215509e-8          , 3.09497626500000699e-9          , 1.7997284140735611e-10          , },
+/* x = 16.0        */  {0.221556727947392236            , 0.00692364423163179741          , 0.000324544064995635515         , 0.0000169027505978210203        , 9.24222643142921345e-7          , 5.19582176417061852e-8          , 2.9718885465422268e-9           , 1.71777911836036605e-10         , },
+/* x = 16.1        */  {0.220867592154034052            , 0.00685923883006202239          , 0.000319528178014738136         , 0.0000165381985202404253        , 8.98683374499439262e-7          , 5.02106063289202072e-8          , 2.85438985150291035e-9          , 1.64000190852903732e-10         , },
+/* x = 16.2        */  {0.220184847103978547            , 0.00679582577061636423          , 0.000314620141602480664         , 0.0000161836897120188322        , 8.74000555422383347e-7          , 4.8531888879343915e-8           , 2.74219638684792123e-9          , 1.56616341934590446e-10         , },
+/* x = 16.3        */  {0.219508394631560686            , 0.00673338378108750879          , 0.000309816993483966668         , 0.0000158388883779742692        , 8.50140521174616152e-7          , 4.69189633092580422e-8          , 2.63504019513978306e-9          , 1.4960444127111173e-10          , },
+/* x = 16.4        */  {0.21883813866904588             , 0.00667189217178238967          , 0.000305115870133592539         , 0.0000155034718839046085        , 8.27071118572783427e-7          , 4.53688838994468439e-8          , 2.53266819799167478e-9          , 1.42943886406937388e-10         , },
+/* x = 16.5        */  {0.218173985189353034            , 0.00661133081616119003          , 0.000300514002915906163         , 0.0000151771301672994862        , 8.04761630041433174e-7          , 4.38788525391884386e-8          , 2.43484130126116962e-9          , 1.36615311123383832e-10         , },
+/* x = 16.6        */  {0.217515842150675703            , 0.00655168013223079358          , 0.000296008714398780496         , 0.0000148595651775825761        , 7.83182701863845874e-7          , 4.24462105896673958e-8          , 2.34133355777297351e-9          , 1.3060050611612658e-10          , },
+/* x = 16.7        */  {0.21686361944292757             , 0.00649292106465909116          , 0.000291597414830289645         , 0.0000145504903442563437        , 7.62306276378294974e-7          , 4.10684312334796736e-8          , 2.25193138366051175e-9          , 1.2488234505475482e-10          , },
+/* x = 16.8        */  {0.216217228835941802            , 0.00643503506757822378          , 0.000287277598771148631         , 0.0000142496300714186654        , 7.42105527884549347e-7          , 3.97431122791615336e-8          , 2.16643282469452171e-9          , 1.19444715641873157e-10         , },
+/* x = 16.9        */  {0.215576583929356896            , 0.00637800408804642609          , 0.000283046841875023429         , 0.0000139567192572117349        , 7.22554802040431961e-7          , 3.84679693917748633e-8          , 2.08464686922453819e-9          , 1.14272455317502697e-10         , },
+/* x = 17.0        */  {0.21494160010412462             , 0.00632181055013963037          , 0.000278902797809436813         , 0.0000136715028368489229        , 7.03629558542238861e-7          , 3.72408297225332702e-8          , 2.00639280459787847e-9          , 1.09351291280627281e-10         , },
+/* x = 17.1        */  {0.214312194475578458            , 0.00626643733964540629          , 0.000274843195310389706         , 0.000013393735347945098         , 6.85306316895871301e-7          , 3.60596259122673607e-8          , 1.93149961414189261e-9          , 1.04667784523839473e-10         , },
+/* x = 17.2        */  {0.21368828584800363             , 0.00621186778933315023          , 0.00027086583536418879          , 0.000013123180516950707         , 6.67562605097708e-7             , 3.49223904452138951e-8          , 1.85980541200017653e-9          , 1.00209277599319878e-10         , },
+/* x = 17.3        */  {0.213069794670652326            , 0.00615808566477570464          , 0.000266968588510320351         , 0.000012859610865560009         , 6.50376911055605423e-7          , 3.38272503311813911e-8          , 1.79115691330337992e-9          , 9.59638458549752301e-11         , },
+/* x = 17.4        */  {0.212456642995150194            , 0.00610507515069878653          , 0.000263149392259539327         , 0.000012602807336029554         , 6.33728636591018748e-7          , 3.27724220956028836e-8          , 1.72540893733131381e-9          , 9.19202518985967989e-11         , },
+/* x = 17.5        */  {0.21184875443424243             , 0.00605282083783573922          , 0.000259406248621652289         , 0.0000123525589344045974        , 6.17598053873137678e-7          , 3.17562070583429283e-8          , 1.66242394148631847e-9          , 8.80679030655017068e-11         , },
+/* x = 17.6        */  {0.211246054121830035            , 0.00600130771026619623          , 0.000255737221737765071         , 0.0000121086623907089156        , 6.01966264145178403e-7          , 3.07769868833879727e-8          , 1.60207158404925763e-9          , 8.43968116813971907e-11         , },
+/* x = 17.7        */  {0.210648468674248853            , 0.00595052113321826427          , 0.000252140435612040893         , 0.0000118709218352076804        , 5.86815158611611315e-7          , 2.98332193827237381e-8          , 1.5442283138299486e-9           , 8.08975579272638912e-11         , },
+/* x = 17.8        */  {0.210055926152746031            , 0.00590044684131479675          , 0.000248614071938274204         , 0.0000116391484899039098        , 5.72127381363175673e-7          , 2.89234345587965894e-8          , 1.48877698495414257e-9          , 7.7561255126983341e-11          , },
+/* x = 17.9        */  {0.209468356027110429            , 0.00585107092724524393          , 0.000245156368016830098         , 0.0000114131603744767423        , 5.57886294224076396e-7          , 2.80462308709738743e-8          , 1.4356064951500922e-9           , 7.43795172913237419e-11         , },
+/* x = 18.0        */  {0.208885689140415294            , 0.00580237983084543193          , 0.000241765614757729876         , 0.0000111927820259146021        , 5.4407594341281085e-7           , 2.72002717123663035e-8          , 1.38461144600998487e-9          , 7.13444287638268617e-11         , },
+/* x = 18.1        */  {0.208307857674833271            , 0.00575436032856844537          , 0.000238440154765881038         , 0.0000109778442311384044        , 5.30681027914668554e-7          , 2.63842820842586238e-8          , 1.33569182380572582e-9          , 6.84485158251811361e-11         , },
+/* x = 18.2        */  {0.207734795118485443            , 0.00570699952333056752          , 0.000235178380504655451         , 0.0000107681837719494906        , 5.17686869470115449e-7          , 2.55970454562177623e-8          , 1.2887526995353211e-9           , 6.56847201228897092e-11         , },
+/* x = 18.3        */  {0.20716643623328766             , 0.00566028483471697171          , 0.000231978732534213383         , 0.0000105636431816741272        , 5.05079384089045817e-7          , 2.48374008007145719e-8          , 1.24370394696598886e-9          , 6.3046373802509753e-11          , },
+/* x = 18.4        */  {0.206602717023758925            , 0.00561420398953255982          , 0.000228839697821154292         , 0.0000103640705129113194        , 4.92845055006286024e-7          , 2.41042397918102771e-8          , 1.200459977523625e-9            , 6.05271762255086073e-11         , },
+/* x = 18.5        */  {0.206043574706758025            , 0.00556874501268400982          , 0.000225759808116248209         , 0.0000101693191158235141        , 4.80970906998790113e-7          , 2.33965041581253815e-8          , 1.15893949095583832e-9          , 5.81211721669062426e-11         , },
+/* x = 18.6        */  {0.20548894768211595             , 0.00552389621837972711          , 0.000222737638397165053         , 9.97924742644063242e-6          , 4.6944448198970115e-7           , 2.27131831809305721e-8          , 1.11906524076788309e-9          , 5.58227313934012366e-11         , },
+/* x = 18.7        */  {0.204938775504132952            , 0.00547964620163499556          , 0.000219771805373273642         , 9.79371876447690799e-6          , 4.58253815868885774e-7          , 2.20533113287792028e-8          , 1.0807638134978566e-9           , 5.3626529529654065e-11          , },
+/* x = 18.8        */  {0.204392998853910345            , 0.00543598383007019475          , 0.000216860966049728218         , 9.61260114018732255e-6          , 4.47387416463702714e-7          , 2.14159660206421915e-8          , 1.04396542095986535e-9          , 5.15275301268686767e-11         , },
+/* x = 18.9        */  {0.203851559512488303            , 0.00539289823599049261          , 0.000214003816348198349         , 9.43576706981614119e-6          , 4.36834242597657921e-7          , 2.08002655100113419e-8          , 1.00860370464183963e-9          , 4.9520967853809497e-11          , },
+/* x = 19.0        */  {0.203314400334762091            , 0.00535037880873593826          , 0.000211199089781728648         , 9.26309339921424975e-6          , 4.26583684178246658e-7          , 2.02053668829087151e-8          , 9.74615551498609893e-10         , 4.76023327359516047e-11         , },
+/* x = 19.1        */  {0.2027814652241502              , 0.0053084151872913701           , 0.000208445556181338324         , 9.09446113522478587e-6          , 4.16625543258702754e-7          , 1.96304641631800769e-8          , 9.41940920431042001e-10         , 4.57673553736195818e-11         , },
+/* x = 19.2        */  {0.202252699107988929            , 0.00526699725314602036          , 0.000205742020472087428         , 8.92975528445801922e-6          , 4.06950016021582204e-7          , 1.90747865188617857e-8          , 9.10522678788733711e-10         , 4.40119930747556011e-11         , },
+/* x = 19.3        */  {0.201728047913628923            , 0.00522611512339314081          , 0.000203087321496447341         , 8.76886469909665678e-6          , 3.97547675635116458e-7          , 1.85375965637947877e-8          , 8.80306448277253222e-10         , 4.23324168423975653e-11         , },
+/* x = 19.4        */  {0.201207458545210142            , 0.00518575914406039628          , 0.000200480330882917821         , 8.61168192939180529e-6          , 3.88409455936093089e-7          , 1.8018188749018507e-8           , 8.51240459691383556e-10         , 4.07249991610692388e-11         , },
+/* x = 19.5        */  {0.200690878861092613            , 0.00514591988366217419          , 0.000197919951957932091         , 8.45810308252778381e-6          , 3.79526635895670326e-7          , 1.75158878388130973e-8          , 8.23275415933539649e-10         , 3.91863025301100735e-11         , },
+/* x = 19.6        */  {0.200178257651921216            , 0.00510658812696534022          , 0.000195405118699185473         , 8.30802768755091472e-6          , 3.70890824827018316e-7          , 1.70300474665723575e-8          , 7.96364362811647013e-10         , 3.77130686955247278e-11         , },
+/* x = 19.7        */  {0.199669544619303561            , 0.00506775486896033478          , 0.000192934794728612098         , 8.1613585660733924e-6           , 3.62493948296014662e-7          , 1.65600487659831115e-8          , 7.70462567143495887e-10         , 3.63022085352313755e-11         , },
+/* x = 19.8        */  {0.199164690355080809            , 0.00502941130902985074          , 0.000190507972343318596         , 8.01800170847839445e-6          , 3.54328234698414487e-7          , 1.61052990732613828e-8          , 7.45527401725083718e-10         , 3.49507925556524838e-11         , },
+/* x = 19.9        */  {0.198663646321172061            , 0.00499154884530766382          , 0.000188123671582863697         , 7.87786615536681642e-6          , 3.46386202468975172e-7          , 1.56652306964525611e-8          , 7.21518236748889421e-10         , 3.36560419604390984e-11         , },
+/* x = 20.0        */  {0.198166364829973654            , 0.00495415906922050079          , 0.000185780939331348499         , 7.74086388399942731e-6          , 3.38660647889951571e-7          , 1.5239299748043146e-8           , 6.98396337284531742e-10         , 3.24153202547657666e-11         , },
+/* x = 20.1        */  {0.1976727990252954              , 0.00491723376020613131          , 0.00018347884845285413          , 7.60690969950090959e-6          , 3.31144633468196828e-7          , 1.48269850373566775e-8          , 6.76124766458986716e-10         , 3.12261253510928142e-11         , },
+/* x = 20.2        */  {0.197182902863816483            , 0.00488076488060115409          , 0.000181216496958831742         , 7.47592113060420756e-6          , 3.23831476851814366e-7          , 1.44277870194171606e-8          , 6.54668293996601466e-10         , 3.00860821445794102e-11         , },
+/* x = 20.3        */  {0.196696631097044347            , 0.00484474457069222137          , 0.000178993007206114593         , 7.34781832972490479e-6          , 3.16714740258915101e-7          , 1.40412267971606189e-8          , 6.33993309800659904e-10         , 2.89929355284573173e-11         , },
+/* x = 20.4        */  {0.196213939253760549            , 0.00480916514392470485          , 0.000176807525124283376         , 7.22252397716602401e-6          , 3.09788220392546905e-7          , 1.36668451740602639e-8          , 6.14067742278338397e-10         , 2.79445438216530883e-11         , },
+/* x = 20.5        */  {0.195734783622938109            , 0.0047740190822630547           , 0.000174659219471174362         , 7.0999631892637286e-6           , 3.03045938817286803e-7          , 1.33042017544039762e-8          , 5.9486098112963624e-10          , 2.69388725827865295e-11         , },
+/* x = 20.6        */  {0.19525912123711547             , 0.00473929903169733928          , 0.000172547281115375316         , 6.98006343029393766e-6          , 2.96482132774326062e-7          , 1.2952874088625133e-8           , 5.76343804338369876e-10         , 2.59739887863854716e-11         , },
+/* x = 20.7        */  {0.194786909856212718            , 0.00470499779789067923          , 0.000170470922344606762         , 6.86275442796888029e-6          , 2.90091246413139304e-7          , 1.26124568612400021e-8          , 5.58488309119667315e-10         , 2.50480553387505111e-11         , },
+/* x = 20.8        */  {0.194318107951776224            , 0.00467110834196250485          , 0.000168429376198936208         , 6.74796809236113791e-6          , 2.83867922419016161e-7          , 1.2282561119087627e-8           , 5.41267846593670236e-10         , 2.41593259123869459e-11         , },
+/* x = 20.9        */  {0.193852674691638376            , 0.00463762377640277151          , 0.000166421895827820426         , 6.63563843810078671e-6          , 2.77806994016852167e-7          , 1.19628135377019777e-8          , 5.24656959969419943e-10         , 2.33061400793025306e-11         , },
+/* x = 21.0        */  {0.193390569924979533            , 0.00460453736111246404          , 0.000164447753870016064         , 6.52570150969888033e-6          , 2.71903477332648991e-7          , 1.16528557237717045e-8          , 5.08631326036238717e-10         , 2.24869187247562509e-11         , },
+/* x = 21.1        */  {0.192931754167779802            , 0.00457184249956590906          , 0.000162506241855441792         , 6.4180953098577328e-6           , 2.66152564095166675e-7          , 1.13523435517606699e-8          , 4.93167699772383983e-10         , 2.17001597242418225e-11         , },
+/* x = 21.2        */  {0.19247618858864868             , 0.0045395327350905929           , 0.000160596669628116011         , 6.31275973063529549e-6          , 2.60549614661106004e-7          , 1.10609465328730261e-8          , 4.78243861892408741e-10         , 2.09444338676063448e-11         , },
+/* x = 21.3        */  {0.192023834995020999            , 0.00450760174726035462          , 0.000158718364789332998         , 6.20963648733739255e-6          , 2.5509015134808103e-7           , 1.07783472146504423e-8          , 4.63838569165562795e-10         , 2.0218381015245296e-11          , },
+/* x = 21.4        */  {0.191574655819708063            , 0.00447604334839798686          , 0.000156870672160277279         , 6.10866905501770747e-6          , 2.49769852060473329e-7          , 1.05042406095865904e-8          , 4.49931507347767029e-10         , 1.95207064722852173e-11         , },
+/* x = 21.5        */  {0.191128614107793203            , 0.00444485148018343408          , 0.000155052953263311213         , 6.0098026074712181e-6           , 2.4458454419404389e-7           , 1.02383336512355843e-8          , 4.36503246579234692e-10         , 1.8850177567570005e-11          , },
+/* x = 21.6        */  {0.190685673503861391            , 0.00441402021036392712          , 0.000153264585821204189         , 5.91298395861227804e-6          , 2.39530198805918456e-7          , 9.98034467637711499e-9          , 4.23535199108743871e-10         , 1.82056204251103221e-11         , },
+/* x = 21.7        */  {0.19024579823955289             , 0.00438354372956253646          , 0.00015150496327360371          , 5.81816150613375476e-6          , 2.3460292503726031e-7           , 9.73000293188188667e-9          , 4.11009579213925028e-10         , 1.75859169164425478e-11         , },
+/* x = 21.8        */  {0.189808953121431268            , 0.00435341634818176297          , 0.000149773494310078976         , 5.72528517734857612e-6          , 2.29798964776603549e-7          , 9.48704810499696554e-9          , 3.98909365194755082e-10         , 1.6990001783077875e-11          , },
+/* x = 21.9        */  {0.189375103519156438            , 0.00432363249339891637          , 0.000148069602419096436         , 5.6343063771197224e-6           , 2.25114687552441997e-7          , 9.25122987584211518e-9          , 3.8721826332478051e-10          , 1.64168599189073336e-11         , },
+/* x = 22.0        */  {0.188944215353953703            , 0.00429418670625015666          , 0.000146392725452314326         , 5.54517793778914385e-6          , 2.20546585644256396e-7          , 9.02230749097539673e-9          , 3.75920673651459495e-10         , 1.58655238030680645e-11         , },
+/* x = 22.1        */  {0.188516255087370082            , 0.00426507363880019392          , 0.000144742315203609401         , 5.45785407102029913e-6          , 2.16091269401717458e-7          , 8.80004935694952607e-9          , 3.65001657543448023e-10         , 1.53350710743732896e-11         , },
+/* x = 22.2        */  {0.188091189710309518            , 0.00423628805139475645          , 0.000143117837002274078         , 5.37229032147300879e-6          , 2.11745462762326514e-7          , 8.58423265283995699e-9          , 3.54446906888685782e-10         , 1.48246222389660319e-11         , },
+/* x = 22.3        */  {0.1876689867323388              , 0.00420782480999304756          , 0.000141518769319846006         , 5.28844352223311339e-6          , 2.07505998958250973e-7          , 8.37464296078163106e-9          , 3.44242714852791238e-10         , 1.43333385033774879e-11         , },
+/* x = 22.4        */  {0.187249614171256368            , 0.00417967888357751629          , 0.000139944603390054808         , 5.20627175192302843e-6          , 2.0336981640357994e-7           , 8.17107391360402238e-9          , 3.34375948112576477e-10         , 1.3860419725657566e-11          , },
+/* x = 22.5        */  {0.186833040542916369            , 0.00415184534163836837          , 0.000138394842841392365         , 5.12573429342270884e-6          , 1.99333954753668065e-7          , 7.9733268587037112e-9           , 3.24834020484464113e-10         , 1.3405102477699835e-11          , },
+/* x = 22.6        */  {0.186419234851300638            , 0.00412431935173034034          , 0.000136869003341833697         , 5.04679159413378387e-6          , 1.95395551128654254e-7          , 7.78121053734043711e-9          , 3.15604867872252613e-10         , 1.29666582123081565e-11         , },
+/* x = 22.7        */  {0.186008166578831486            , 0.00409709617709935242          , 0.00013536661225525519          , 4.96940522772270875e-6          , 1.9155183649363779e-7           , 7.59454077858658798e-9          , 3.06676924463052642e-10         , 1.25443915289496423e-11         , },
+/* x = 22.8        */  {0.185599805676918419            , 0.00407017117437674426          , 0.000133887208309115701         , 4.89353785728171106e-6          , 1.87800132188368973e-7          , 7.41314020720154193e-9          , 2.98039100104324277e-10         , 1.2137638532510158e-11          , },
+/* x = 22.9        */  {0.185194122556732157            , 0.00404353979133888314          , 0.000132430341272984062         , 4.81915319984909491e-6          , 1.84137846599665801e-7          , 7.23683796474135291e-9          , 2.89680758798800593e-10         , 1.17457652797161401e-11         , },
+/* x = 23.0        */  {0.184791088080199504            , 0.00401719756473001537          , 0.000130995571647513585         , 4.74621599223311424e-6          , 1.80562471970103697e-7          , 7.06546944325110172e-9          , 2.81591698257703419e-10         , 1.13681663082116416e-11         , },
+/* x = 23.1        */  {0.184390673551212858            , 0.0039911401181463102           , 0.000129582470363480562         , 4.67469195808614327e-6          , 1.77071581336842817e-7          , 6.89887603092196016e-9          , 2.73762130456057178e-10         , 1.10042632435837702e-11         , },
+/* x = 23.2        */  {0.183992850707048346            , 0.00396536315997912028          , 0.000128190618490519358         , 4.60454777617826579e-6          , 1.73662825594758239e-7          , 6.73690486912776418e-9          , 2.66182663137100698e-10         , 1.06535034799144514e-11         , },
+/* x = 23.3        */  {0.183597591709986741            , 0.00393986248141555509          , 0.000126819606955201622         , 4.53575104982168142e-6          , 1.70333930678323072e-7          , 6.57940862028678244e-9          , 2.58844282215798067e-10         , 1.03153589297030359e-11         , },
+/* x = 23.4        */  {0.183204869139131545            , 0.00391463395449453223          , 0.000125469036268121372         , 4.46827027739949234e-6          , 1.67082694856964394e-7          , 6.42624524602351098e-9          , 2.51738335034270037e-10         , 9.98932483925390125e-12         , },
+/* x = 23.5        */  {0.182814655982418753            , 0.00388967353021653844          , 0.000124138516259661373         , 4.4020748239544947e-6           , 1.63906986138867507e-7          , 6.27727779513282846e-9          , 2.44856514424618927e-10         , 9.67491866585699121e-12         , },
+/* x = 23.6        */  {0.182426925628813042            , 0.00386497723670539517          , 0.000122827665824129195         , 4.3371348937955595e-6           , 1.60804739778446326e-7          , 6.1323742008748068e-9           , 2.38190843537112883e-10         , 9.37167901330826206e-12         , },
+/* x = 23.7        */  {0.182041651860685237            , 0.00384054117742038504          , 0.000121536112671963808         , 4.27342150408105462e-6          , 1.57773955882927347e-7          , 5.99140708715298228e-9          , 2.31733661394039874e-10         , 9.07916462252222483e-12         , },
+/* x = 23.8        */  {0.181658808846366126            , 0.00381636152941715397          , 0.000120263493089725467         , 4.21090645934053649e-6          , 1.54812697113712434e-7          , 5.85425358315203741e-9          , 2.25477609131747237e-10         , 8.79695341418111433e-12         , },
+/* x = 23.9        */  {0.181278371132871801            , 0.00379243454165586008          , 0.000119009451707593003         , 4.14956232689763226e-6          , 1.51919086478392132e-7          , 5.72079514603270551e-9          , 2.19415616895457627e-10         , 8.5246415805455178e-12          , },
+/* x = 24.0        */  {0.180900313638795883            , 0.00376875653335509453          , 0.000117773641274103522         , 4.08936241315864508e-6          , 1.49091305209477127e-7          , 5.590917391302364e-9            , 2.13540891353405026e-10         , 8.26184272372035487e-12         , },
+/* x = 24.1        */  {0.180524611647364136            , 0.00374532389239015157          , 0.000116555722437879925         , 4.03028074073295059e-6          , 1.46327590726101303e-7          , 5.46450993049929868e-9          , 2.07846903798672672e-10         , 8.00818703782865036e-12         , },
+/* x = 24.2        */  {0.180151240799647079            , 0.00372213307373427463          , 0.000115355363536101616         , 3.97229202635271582e-6          , 1.43626234675126188e-7          , 5.34146621584706828e-9          , 2.02327378808845444e-10         , 7.7633205326942693e-12          , },
+/* x = 24.3        */  {0.179780177087926397            , 0.00369918059794155375          , 0.000114172240389483299         , 3.91537165956086569e-6          , 1.40985581048243998e-7          , 5.22168339155283683e-9          , 1.9697628343521906e-10          , 7.52690429677432854e-12         , },
+/* x = 24.4        */  {0.179411396849211014            , 0.0036764630496701953           , 0.000113006036103535884         , 3.859495682137552e-6            , 1.38404024371835356e-7          , 5.10506215144003104e-9          , 1.91787816894843632e-10         , 7.29861379721295732e-12         , },
+/* x = 24.5        */  {0.179044876758898891            , 0.00365397707624492944          , 0.000111856440875892243         , 3.80464076823664619e-6          , 1.35880007966488676e-7          , 4.99150660262127511e-9          , 1.86756400740125473e-10         , 7.07813821501100571e-12         , },
+/* x = 24.6        */  {0.178680593824580661            , 0.00363171938625736347          , 0.000110723151809488951         , 3.75078420520498595e-6          , 1.33412022273231498e-7          , 4.88092413493230798e-9          , 1.81876669482073998e-10         , 6.86517981342171335e-12         , },
+/* x = 24.7        */  {0.178318525379981388            , 0.00360968674820313005          , 0.000109605872731403105         , 3.69790387505825813e-6          , 1.30998603243660169e-7          , 4.7732252958615471e-9           , 1.77143461644565253e-10         , 6.65945333779073296e-12         , },
+/* x = 24.8        */  {0.177958649079036819            , 0.00358787598915471866          , 0.000108504314017151039         , 3.64597823658849948e-6          , 1.28638330791283633e-7          , 4.66832367072317252e-9          , 1.7255181122820469e-10          , 6.46068544516070651e-12         , },
+/* x = 24.9        */  {0.177600942890100603            , 0.0035662839934689167           , 0.000107418192420263036         , 3.59498630807924596e-6          , 1.26329827301519962e-7          , 4.56613576783410984e-9          , 1.68096939563513877e-10         , 6.26861416205623471e-12         , },
+/* x = 25.0        */  {0.177245385090279095            , 0.00354490770152782302          , 0.000106347230906955252         , 3.54490765060536219e-6          , 1.24071756197901122e-7          , 4.46658090846712958e-9          , 1.63774247534242947e-10         , 6.08298836895495641e-12         , },
+/* x = 25.1        */  {0.176891954259890405            , 0.00352374410851243174          , 0.000105291158495726733         , 3.49572235189553804e-6          , 1.21862820562152498e-7          , 4.36958112136349118e-9          , 1.59579308152626709e-10         , 5.90356731003492929e-12         , },
+/* x = 25.2        */  {0.176540629277044512            , 0.00350279026320781796          , 0.000104249710101715944         , 3.44741101073635152e-6          , 1.19701761805919333e-7          , 4.27506104159917933e-9          , 1.55507859469361151e-10         , 5.73012012686791819e-12         , },
+/* x = 25.3        */  {0.176191389312341317            , 0.00348204326683898963          , 0.000103222626385657382         , 3.39995472189766783e-6          , 1.1758735839201267e-7           , 4.18294781360883954e-9          , 1.51555797801981918e-10         , 5.56242541480287259e-12         , },
+/* x = 25.4        */  {0.17584421382368361             , 0.00346150027193650085          , 0.000102209653607284797         , 3.35333506155997638e-6          , 1.15518424603142911e-7          , 4.09317099818105279e-9          , 1.47719171266180522e-10         , 5.40027080085410725e-12         , },
+/* x = 25.5        */  {0.175499082551202029            , 0.00344115848123095227          , 0.000101210543483033265         , 3.30753407322506176e-6          , 1.13493809356200032e-7          , 4.00566248324762295e-9          , 1.4399417359540054e-10          , 5.24345254197476885e-12         , },
+/* x = 25.6        */  {0.175155975512289159            , 0.00342101514657553308          , 0.000100225053047897794         , 3.26253425409216387e-6          , 1.11512395060225983e-7          , 3.92035639829811488e-9          , 1.40377138234817631e-10         , 5.09177514265833686e-12         , },
+/* x = 25.7        */  {0.174814872996740007            , 0.00340106756789578711          , 0.0000992529445213114059        , 3.21831854188250725e-6          , 1.09573096516307135e-7          , 3.83718903225900095e-9          , 1.36864532696526644e-10         , 4.94505099086941111e-12         , },
+/* x = 25.8        */  {0.174475755561996173            , 0.00338131309216581236          , 0.0000982939851769106749        , 3.17487030209577299e-6          , 1.07674859857693019e-7          , 3.75609875468447377e-9          , 1.33452953163438706e-10         , 4.80310001136011032e-12         , },
+/* x = 25.9        */  {0.174138604028491117            , 0.00336174911241012935          , 0.0000973479472160615004        , 3.13217331568274901e-6          , 1.05816661528522238e-7          , 3.67702594011328697e-9          , 1.30139119330033439e-10         , 4.66574933548025568e-12         , },
+/* x = 26.0        */  {0.173803399475093974            , 0.00334237306673047857          , 0.0000964146076450225642        , 3.09021176711902761e-6          , 1.03997507299607477e-7          , 3.59991289545291458e-9          , 1.26919869468718461e-10         , 4.53283298663834224e-12         , },
+/* x = 26.1        */  {0.173470123234649488            , 0.00332318243735683128          , 0.0000954937481556283421        , 3.04897023286522509e-6          , 1.02216431319799273e-7          , 3.52470379025889499e-9          , 1.23792155711122199e-10         , 4.40419158061629232e-12         , },
+/* x = 26.2        */  {0.173138756889611648            , 0.00330417474972192136          , 0.0000945851550093778222        , 3.00843367019977708e-6          , 1.00472495201512667e-7          , 3.45134458978346511e-9          , 1.20753039534188572e-10         , 4.27967203998431459e-12         , },
+/* x = 26.3        */  {0.172809282267768735            , 0.00328534757155862793          , 0.0000936886189248191782        , 2.96858740641091742e-6          , 9.87647871390623327e-8          , 3.37978299067351407e-9          , 1.1779968744145531e-10          , 4.15912732190302155e-12         , },
+/* x = 26.4        */  {0.172481681438057513            , 0.00326669851201956038          , 0.0000928039349681245865        , 2.92941712833497813e-6          , 9.70924210585103292e-8          , 3.30996835920350988e-9          , 1.14929366830383011e-10         , 4.0424161586384398e-12          , },
+/* x = 26.5        */  {0.172155936706464366            , 0.00324822522081821787          , 0.0000919309024467531555        , 2.8909088722286554e-6           , 9.54545357977864685e-8          , 3.24185167193439284e-9          , 1.12139442037061316e-10         , 3.9294028101518239e-12          , },
+/* x = 26.6        */  {0.171832030612011287            , 0.00322992538739111578          , 0.0000910693248061035697        , 2.85304901396337152e-6          , 9.38502943158944983e-8          , 3.17538545869450238e-9          , 1.0942737055005312e-10          , 3.81995682816038892e-12         , },
+/* x = 26.7        */  {0.171509945922824607            , 0.00321179674008029042          , 0.0000902190095290615424        , 2.81582425953032739e-6          , 9.22788829300680583e-8          , 3.11052374778342283e-9          , 1.0679069938554908e-10          , 3.71395283109733478e-12         , },
+/* x = 26.8        */  {0.171189665632284498            , 0.00319383704533561263          , 0.0000893797680383505242        , 2.77922163584528471e-6          , 9.07395105797887726e-8          , 3.04722201330421243e-9          , 1.04227061616394067e-10         , 3.61127028942996293e-12         , },
+/* x = 26.9        */  {0.170871172955253268            , 0.00317604410693635812          , 0.0000885514156015973399        , 2.74322848184254279e-6          , 8.92314081166250072e-8          , 2.98543712453383114e-9          , 1.01734173047915876e-10         , 3.51179332082339381e-12         , },
+/* x = 27.0        */  {0.170554451324380554            , 0.00315841576523150046          , 0.0000877337712390275238        , 2.70783243984798278e-6          , 8.77538276188938737e-8          , 2.92512729724571916e-9          , 9.9309829033835719e-11          , 3.41541049466448336e-12         , },
+/* x = 27.1        */  {0.170239484386483585            , 0.00314094989639820879          , 0.0000869266576337081031        , 2.67302144722144228e-6          , 8.63060417301910934e-8          , 2.86625204690241001e-9          , 9.69519014258707392e-11         , 3.32201464548610612e-12         , },
+/* x = 27.2        */  {0.169926255999000692            , 0.00312364441171804897          , 0.0000861299010442584453        , 2.63878372825905763e-6          , 8.48873430208734505e-8          , 2.80877214363980115e-9          , 9.4658335650952158e-11          , 3.23150269485610995e-12         , },
+/* x = 27.3        */  {0.169614750226516342            , 0.00310649725687040207          , 0.0000853433312199525367        , 2.60510778634656952e-6          , 8.34970433716168545e-8          , 2.75264956896826114e-9          , 9.24271479102795868e-11         , 3.14377548131803936e-12         , },
+/* x = 27.4        */  {0.169304951337355985            , 0.00308950641124262955          , 0.0000845667813181387117        , 2.57198239635493088e-6          , 8.21344733782095911e-8          , 2.69784747411913456e-9          , 9.02564224947134729e-11         , 3.05873759799224916e-12         , },
+/* x = 27.5        */  {0.168996843800249066            , 0.00307266988725652862          , 0.0000838000878239054001        , 2.5393965972698853e-6           , 8.07989817767752495e-8          , 2.64433013996842437e-9          , 8.81443092112744224e-11         , 2.97629723746636201e-12         , },
+/* x = 27.6        */  {0.168690412281058598            , 0.00305598572971063569          , 0.0000830430904719239112        , 2.50733968504749948e-6          , 7.94899348886531501e-8          , 2.59206293847249329e-9          , 8.60890209157710911e-11         , 2.89636604362323342e-12         , },
+/* x = 27.7        */  {0.168385641639575727            , 0.00303945201513794911          , 0.0000822956321704016329        , 2.47580120568793604e-6          , 7.82067160841959428e-8          , 2.54101229555354021e-9          , 8.40888311468182092e-11         , 2.81885897007273971e-12         , },
+/* x = 27.8        */  {0.168082516926377776            , 0.00302306685117865555          , 0.0000815575589270812943        , 2.44477094852004259e-6          , 7.69487252647744698e-8          , 2.49114565537538209e-9          , 8.21420718567338178e-11         , 2.74369414487086178e-12         , },
+/* x = 27.9        */  {0.167781023379748275            , 0.00300682837596745727          , 0.0000808287197772241257        , 2.41423893968961131e-6          , 7.57153783623090528e-8          , 2.44243144595271266e-9          , 8.02471312350206417e-11         , 2.67079274122575594e-12         , },
+/* x = 28.0        */  {0.167481146422657556            , 0.00299073475753510921          , 0.0000801089667135168537        , 2.38419543584443014e-6          , 7.45061068556741481e-8          , 2.3948390460395246e-9           , 7.84024516203413139e-11         , 2.60007885390583902e-12         , },
+/* x = 28.1        */  {0.167182871659802484            , 0.00297478419322378725          , 0.0000793981546178444926        , 2.35463091800950217e-6          , 7.33203573033498644e-8          , 2.34833875324477709e-9          , 7.66065274970915322e-11         , 2.53147938107941711e-12         , },
+/* x = 28.2        */  {0.166886184874703995            , 0.00295897490911592006          , 0.0000786961411948728457        , 2.32553608564605572e-6          , 7.21575908917192225e-8          , 2.30290175332567249e-9          , 7.4857903572859708e-11          , 2.46492391132910546e-12         , },
+/* x = 28.3        */  {0.166591072026861071            , 0.0029433051594761279           , 0.0000780027869073865048        , 2.29690185088820286e-6          , 7.10172829984343062e-8          , 2.25850009061107946e-9          , 7.31551729332368095e-11         , 2.40034461559726466e-12         , },
+/* x = 28.4        */  {0.166297519248959897            , 0.00292777322620592273          , 0.0000773179549133299479        , 2.26871933295133034e-6          , 6.98989227702976631e-8          , 2.21510663950971177e-9          , 7.14969752706064099e-11         , 2.33767614383095866e-12         , },
+/* x = 28.5        */  {0.166005512844136918            , 0.002912377418310834            , 0.000076641511004501074         , 2.2409798527065239e-6           , 6.88020127151275131e-8          , 2.17269507705964576e-9          , 6.9881995183702889e-11          , 2.27685552610656225e-12         , },
+/* x = 28.6        */  {0.16571503928329457             , 0.00289711607137963462          , 0.0000759733235468481952        , 2.21367492741553505e-6          , 6.77260683070965534e-8          , 2.13123985647764161e-9          , 6.83089605448757622e-11         , 2.21782207802514709e-12         , },
+/* x = 28.7        */  {0.165426085202468511            , 0.00288198754707535107          , 0.0000753132634223231208        , 2.1867962656209996e-6           , 6.66706176050544681e-8          , 2.09071618166852749e-9          , 6.67766409321406437e-11         , 2.16051731018019143e-12         , },
+/* x = 28.8        */  {0.165138637400245154            , 0.00286699023263775122          , 0.0000746612039722445281        , 2.16033576218680919e-6          , 6.5635200883363688e-8           , 2.05109998265661644e-9          , 6.52838461232327824e-11         , 2.10488484150902188e-12         , },
+/* x = 28.9        */  {0.164852682835228414            , 0.00285212254039701202          , 0.0000740170209421273144        , 2.13428549348372149e-6          , 6.4619370274796549e-8           , 2.01236789190275731e-9          , 6.38294246490078281e-11         , 2.05087031634873741e-12         , },
+/* x = 29.0        */  {0.164568208623554517            , 0.00283738290729827846          , 0.0000733805924279350759        , 2.10863771271547182e-6          , 6.36226894250598074e-8          , 1.97449722147217725e-9          , 6.24122624036568302e-11         , 1.99842132502621508e-12         , },
+/* x = 29.1        */  {0.164285202036453842            , 0.00282276979443683302          , 0.0000727517988237142497        , 2.08338484538081933e-6          , 6.26447331585295149e-8          , 1.93746594101975795e-9          , 6.1031281309318796e-11          , 1.9474873278201817e-12          , },
+/* x = 29.2        */  {0.16400365049785871             , 0.00280828168660360363          , 0.0000721305227705698046        , 2.05851948486712419e-6          , 6.16850871547955814e-8          , 1.90125265656080429e-9          , 5.96854380327847356e-11         , 1.89801958214128078e-12         , },
+/* x = 29.3        */  {0.163723541582056126            , 0.00279391709184074551          , 0.0000715166491069436616        , 2.03403438817120941e-6          , 6.07433476356309795e-8          , 1.86583658999671582e-9          , 5.8373722752092316e-11          , 1.84997107278359536e-12         , },
+/* x = 29.4        */  {0.163444863011384467            , 0.00277967454100704014          , 0.0000709100648201582774        , 2.00992247174341204e-6          , 5.98191210620155174e-8          , 1.83119755936626196e-9          , 5.70951579709102986e-11         , 1.80329644510822606e-12         , },
+/* x = 29.5        */  {0.16316760265397315             , 0.00276555258735286219          , 0.0000703106589991890292        , 1.98617680745087337e-6          , 5.89120238408584471e-8          , 1.79731595979439326e-9          , 5.58487973787071276e-11         , 1.75795194102629269e-12         , },
+/* x = 29.6        */  {0.162891748521524333            , 0.00275154980610447186          , 0.0000697183227886302048        , 1.96279061865625765e-6          , 5.80216820410779074e-8          , 1.76417274511169727e-9          , 5.4633724754788613e-11          , 1.71389533765514685e-12         , },
+/* x = 29.7        */  {0.162617288767135735            , 0.00273766479405739765          , 0.0000691329493438205239        , 1.93975727640822262e-6          , 5.71477311187083699e-8          , 1.73174941011873037e-9          , 5.34490529143758479e-11         , 1.67108588852767126e-12         , },
+/* x = 29.8        */  {0.162344211683163666            , 0.00272389616917868073          , 0.0000685544337870952007        , 1.91707029574009436e-6          , 5.62898156507198671e-8          , 1.7000279734705294e-9           , 5.22939226949765513e-11         , 1.62948426724031733e-12         , },
+/* x = 29.9        */  {0.162072505699125406            , 0.00271024257021775901          , 0.0000679826731651326028        , 1.89472333207332302e-6          , 5.54475890772448713e-8          , 1.66899096115763162e-9          , 5.11675019813811331e-11         , 1.58905251343101254e-12         , },
+/* x = 30.0        */  {0.16180215937964007             , 0.00269670265632577489          , 0.0000674175664073645704        , 1.87271017772241521e-6          , 5.4620713451920284e-8           , 1.63862139056090995e-9          , 5.00689847676891539e-11         , 1.54975398098326981e-12         , },
+/* x = 30.1        */  {0.161533161422407123            , 0.00268327510668309721          , 0.0000668590142854204348        , 1.85102475849815358e-6          , 5.38088592000631066e-8          , 1.6089027550584658e-9           , 4.89975902548426726e-11         , 1.51155328835776695e-12         , },
+/* x = 30.2        */  {0.161265500656221755            , 0.00266995862013485333          , 0.000066306919373575714         , 1.82966113040602484e-6          , 5.30117048844090138e-8          , 1.5798190091637155e-9           , 4.79525619822104365e-11         , 1.47441627095735008e-12         , },
+/* x = 30.3        */  {0.160999166039026295            , 0.00265675191483427347          , 0.0000657611860101773715        , 1.80861347643688322e-6          , 5.22289369781532723e-8          , 1.55135455417466046e-9          , 4.69331669918311292e-11         , 1.43830993543586422e-12         , },
+/* x = 30.4        */  {0.16073414665599692             , 0.00264365372789365451          , 0.0000652217202600184004        , 1.78787610344697912e-6          , 5.14602496450432431e-8          , 1.52349422431514774e-9          , 4.59386950239851157e-11         , 1.40320241586543863e-12         , },
+/* x = 30.5        */  {0.160470431717664887            , 0.00263066281504275623          , 0.000064688429877635343         , 1.76744343912458081e-6          , 5.07053445262811078e-8          , 1.4962232733497086e-9           , 4.49684577428224733e-11         , 1.36906293168086789e-12         , },
+/* x = 30.6        */  {0.160208010558071566            , 0.00261777795029444788          , 0.0000641612242715031691        , 1.74731002904051189e-6          , 4.9963930534004477e-8           , 1.46952736165430873e-9          , 4.40217879908306965e-11         , 1.3358617473235411e-12          , },
+/* x = 30.7        */  {0.159946872632956549            , 0.00260499792561742801          , 0.0000636400144691027318        , 1.72747053378001829e-6          , 4.92357236511211914e-8          , 1.44339254372605821e-9          , 4.30980390709784743e-11         , 1.30357013351099372e-12         , },
+/* x = 30.8        */  {0.159687007517978144            , 0.00259232155061584575          , 0.0000631247130828367754        , 1.70791972615346657e-6          , 4.85204467372829312e-8          , 1.41780525611561185e-9          , 4.21965840554224677e-11         , 1.27216033006159795e-12         , },
+/* x = 30.9        */  {0.159428404906965571            , 0.00257974765221565575          , 0.0000626152342767712136        , 1.68865248848345976e-6          , 4.78178293407902199e-8          , 1.39275230576664396e-9          , 4.13168151197122026e-11         , 1.24160551020717866e-12         , },
+/* x = 31.0        */  {0.159171054610202181            , 0.00256727507435754446          , 0.0000621114937341791016        , 1.66966380996603829e-6          , 4.71276075162290573e-8          , 1.36822085874740662e-9          , 4.04581429014741411e-11         , 1.21187974632945109e-12         , },
+/* x = 31.1        */  {0.158914946552739077            , 0.00255490267769626895          , 0.0000616134086258654182        , 1.65094878410371211e-6          , 4.6449523647646763e-8           , 1.34419842935997854e-9          , 3.96199958825998278e-11         , 1.18295797705913274e-12         , },
+/* x = 31.2        */  {0.158660070772738475            , 0.00254262933930625465          , 0.000061120897579251437         , 1.6325026062081457e-6           , 4.57833262770816645e-8          , 1.32067286961338418e-9          , 3.88018197940048159e-11         , 1.15481597567939281e-12         , },
+/* x = 31.3        */  {0.1584064174198462              , 0.00253045395239330188          , 0.0000606338806481981082        , 1.61432057097039027e-6          , 4.51287699382680335e-8          , 1.29763235904731065e-9          , 3.80030770420649714e-11         , 1.12743031977797578e-12         , },
+/* x = 31.4        */  {0.15815397675359272             , 0.00251837542601225548          , 0.0000601522792835484938        , 1.59639807009662772e-6          , 4.44856149953441812e-8          , 1.27506539489367423e-9          , 3.72232461558748197e-11         , 1.10077836209487847e-12         , },
+/* x = 31.5        */  {0.157902739141822107            , 0.00250639268479049568          , 0.0000596760163043698997        , 1.57873059000745851e-6          , 4.38536274863978693e-8          , 1.25296078256379109e-9          , 3.64618212545089313e-11         , 1.07483820251487932e-12         , },
+/* x = 31.6        */  {0.157652695059148381            , 0.00249450466865711216          , 0.0000592050158698769285        , 1.56131370959883062e-6          , 4.3232578971689195e-8           , 1.23130762644938702e-9          , 3.57183115335020202e-11         , 1.04958866115651989e-12         , },
+/* x = 31.7        */  {0.157403835085438639            , 0.00248271033257762689          , 0.0000587392034520172384        , 1.54414309806276958e-6          , 4.26222463863968763e-8          , 1.2100953210261422e-9           , 3.49922407697965365e-11         , 1.02500925251132947e-12         , },
+/* x = 31.8        */  {0.157156149904322457            , 0.00247100864629413505          , 0.0000582785058087023358        , 1.52721451276613027e-6          , 4.20224118977394029e-8          , 1.1893135422489078e-9           , 3.42831468444381455e-11         , 1.00108016058916813e-12         , },
+/* x = 31.9        */  {0.156909630301727               , 0.00245939859407073675          , 0.0000578228509576662552        , 1.51052379718564912e-6          , 4.14328627663278447e-8          , 1.16895223922815399e-9          , 3.35905812823296719e-11         , 9.77782215027548459e-13         , },
+/* x = 32.0        */  {0.156664267164437336            , 0.0024478791744441355           , 0.0000573721681509354871        , 1.49406687889763205e-6          , 4.08533912116122268e-8          , 1.14900162617761399e-9          , 3.29141088083829192e-11         , 9.55096868124685561e-13         , },
+/* x = 32.1        */  {0.156420051478681435            , 0.00243644939997928312          , 0.0000569263878498940058        , 1.47783976762066731e-6          , 4.02837942812883023e-8          , 1.12945217462347643e-9          , 3.22533069194353157e-11         , 9.33006172757824315e-13         , },
+/* x = 32.2        */  {0.156176974328739355            , 0.00242510829702995321          , 0.0000564854417009277259        , 1.46183855330980517e-6          , 3.97238737245362806e-8          , 1.11029460586585078e-9          , 3.16077654713246469e-11         , 9.11492761150106287e-13         , },
+/* x = 32.3        */  {0.155935026895576132            , 0.00241385490550412926          , 0.0000560492625116331729        , 1.44605940430069629e-6          , 3.91734358689676211e-8          , 1.09151988368358637e-9          , 3.09770862805402783e-11         , 8.90539824450871102e-13         , },
+/* x = 32.4        */  {0.15569420045549789             , 0.0024026882786340957           , 0.0000556177842275756023        , 1.43049856550222988e-6          , 3.86322915011603723e-8          , 1.07311920727386785e-9          , 3.0360882739893294e-11          , 8.70131093095841901e-13         , },
+/* x = 32.5        */  {0.155454486378830719            , 0.00239160748275112366          , 0.0000551909419095822291        , 1.4151523566362592e-6           , 3.81002557506677446e-8          , 1.05508400441833694e-9          , 2.97587794476709418e-11         , 8.50250817915126161e-13         , },
+/* x = 32.6        */  {0.155215876128621851            , 0.00238061159706464571          , 0.0000547686717115566479        , 1.40001717052304764e-6          , 3.757714797738865e-8            , 1.03740592486780509e-9          , 2.91704118497627236e-11         , 8.30883751958374959e-13         , },
+/* x = 32.7        */  {0.154978361259362701            , 0.0023696997134458167           , 0.000054350910858800927         , 1.38508947141111221e-6          , 3.70627916621928353e-8          , 1.02007683393792227e-9          , 2.85954258942664563e-11         , 8.12015133007789471e-13         , },
+/* x = 32.8        */  {0.154741933415733343            , 0.00235887093621536055          , 0.0000539375976268322506        , 1.37036579335018326e-6          , 3.65570143006969769e-8          , 1.00308880630845663e-9          , 2.80334776981026924e-11         , 7.93630666750946131e-13         , },
+/* x = 32.9        */  {0.15450658433136798             , 0.00234812438193560534          , 0.0000535286713206813613        , 1.35584273860604039e-6          , 3.60596473000917117e-8          , 9.86434120019116545e-10         , 2.74842332251850802e-11         , 7.75716510586634803e-13         , },
+/* x = 33.0        */  {0.154272305827641016            , 0.00233745917920661146          , 0.0000531240722546604205        , 1.34151697611602353e-6          , 3.55705258789230443e-8          , 9.70105250655112554e-10         , 2.69473679757125932e-11         , 7.58259258038070367e-13         , },
+/* x = 33.1        */  {0.154039089812473303            , 0.00232687446846630042          , 0.0000527237417325882607        , 1.32738523998405607e-6          , 3.50894889697349072e-8          , 9.54094865715912066e-10         , 2.6422566686167116e-11          , 7.41245923748950077e-13         , },
+/* x = 33.2        */  {0.153806928279158193            , 0.00231636940179449366          , 0.0000523276220284613449        , 1.31344432801405391e-6          , 3.46163791244828631e-8          , 9.38395819160884171e-10         , 2.59095230396166697e-11         , 7.24663929038889684e-13         , },
+/* x = 33.3        */  {0.15357581330520698             , 0.00230594314272077371          , 0.0000519356563675590821        , 1.29969110028062921e-6          , 3.41510424226320315e-8          , 9.23001146125767151e-10         , 2.54079393859406259e-11         , 7.08501087995783028e-13         , },
+/* x = 33.4        */  {0.153345737051213378            , 0.00229559486603608166          , 0.0000515477889079724704        , 1.28612247773603233e-6          , 3.36933283818552976e-8          , 9.07904057804116706e-10         , 2.49175264716086427e-11         , 6.92745594083595072e-13         , },
+/* x = 33.5        */  {0.15311669175973665             , 0.00228532375760796753          , 0.0000511639647225453496        , 1.27273544085230781e-6          , 3.3243089871250728e-8           , 8.93097936488109447e-10         , 2.44380031786597675e-11         , 6.77386007245019357e-13         , },
+/* x = 33.6        */  {0.152888669754203041            , 0.00227512901419941196          , 0.0000507841297812178499        , 1.25952702829767274e-6          , 3.28001830269998786e-8          , 8.78576330763284082e-10         , 2.39690962725422466e-11         , 6.62411241479309869e-13         , },
+/* x = 33.7        */  {0.15266166343782514             , 0.00226500984329113986          , 0.0000504082309337619142        , 1.2464943356461563e-6           , 3.23644671703913391e-8          , 8.64332950852002332e-10         , 2.35105401584880623e-11         , 6.478105528764362e-13           , },
+/* x = 33.8        */  {0.152435665292538855            , 0.00225496546290734854          , 0.0000500362158928990551        , 1.23363451411956898e-6          , 3.19358047281364181e-8          , 8.50361664100603281e-10         , 2.30620766461091355e-11         , 6.33573528089511785e-13         , },
+/* x = 33.9        */  {0.152210667877957634            , 0.00224499510144477493          , 0.0000496680332177907864        , 1.22094476936089897e-6          , 3.15140611549063392e-8          , 8.36656490605408985e-10         , 2.26234547219144974e-11         , 6.19690073228209548e-13         , },
+/* x = 34.0        */  {0.151986663830343628            , 0.00223509799750502814          , 0.0000493036322978924303        , 1.20842236023826077e-6          , 3.10991048580226985e-8          , 8.23211598972915986e-10         , 2.21944303294595725e-11         , 6.06150403156609381e-13         , },
+/* x = 34.1        */  {0.151763645861595444            , 0.00222527339973011574          , 0.0000489429633371612639        , 1.19606459767854797e-6          , 3.0690807124235219e-8           , 8.10021302209677275e-10         , 2.17747661568500636e-11         , 5.92945031179619104e-13         , },
+/* x = 34.2        */  {0.151541606758252209            , 0.00221552056664109365          , 0.0000485859773386102172        , 1.18386884352996818e-6          , 3.02890420485230471e-8          , 7.97080053737542475e-10         , 2.13642314313337907e-11         , 5.80064759102776444e-13         , },
+/* x = 34.3        */  {0.151320539380513597            , 0.00220583876647977153          , 0.0000482326260891985779        , 1.17183250945266298e-6          , 2.98936864648579633e-8          , 7.8438244353008084e-10          , 2.09626017207242492e-11         , 5.67500667650875727e-13         , },
+/* x = 34.4        */  {0.151100436661275548            , 0.00219622727705340696          , 0.0000478828621450513954        , 1.15995305583664023e-6          , 2.95046198788699264e-8          , 7.71923194366162418e-10         , 2.05696587414096256e-11         , 5.55244107231470667e-13         , },
+/* x = 34.5        */  {0.150881291605181365            , 0.00218668538558232356          , 0.0000475366388169995009        , 1.14822799074626925e-6          , 2.91217244023573494e-8          , 7.59697158196817568e-10         , 2.01851901727105712e-11         , 5.43286689029885366e-13         , },
+/* x = 34.6        */  {0.150663097287687907            , 0.00217721238855038969          , 0.0000471939101564322866        , 1.13665486889061236e-6          , 2.8744884689586408e-8           , 7.476993126216343e-10           , 1.98089894773591921e-11         , 5.3162027642292053e-13          , },
+/* x = 34.7        */  {0.150445846854146595            , 0.00216780759155829602          , 0.0000468546309414555977        , 1.12523129061888779e-6          , 2.83739878753255196e-8          , 7.35924757471086755e-10         , 1.94408557278804991e-11         , 5.20236976698972291e-13         , },
+/* x = 34.8        */  {0.150229533518898948            , 0.00215847030917957153          , 0.0000465187566633473022        , 1.11395490094038054e-6          , 2.80089235145629035e-8          , 7.24368711491316865e-10         , 1.90805934386659794e-11         , 5.09129133072788004e-13         , },
+/* x = 34.9        */  {0.150014150564386391            , 0.00214919986481927929          , 0.0000461862435133033027        , 1.10282338856813802e-6          , 2.76495835238568372e-8          , 7.13026509128015004e-10         , 1.87280124035370232e-11         , 4.98289316983568044e-13         , },
+/* x = 35.0        */  {0.149799691340274055            , 0.00213999559057533463          , 0.0000458570483694669527        , 1.09183448498580718e-6          , 2.72958621242698749e-8          , 7.01893597406164442e-10         , 1.83829275386036783e-11         , 4.87710320665586034e-13         , },
+/* x = 35.1        */  {0.149586149262588317            , 0.00213085682710238954          , 0.0000455311287842350294        , 1.08098596353698904e-6          , 2.69476557858398796e-8          , 6.90965532902528897e-10         , 1.80451587302316316e-11         , 4.77385149980943095e-13         , },
+/* x = 35.2        */  {0.14937351781286783             , 0.00212178292347822889          , 0.000045208442971833597         , 1.07027563853650509e-6          , 2.66048631735422553e-8          , 6.80237978807872615e-10         , 1.7714530687937432e-11          , 4.67307017504495468e-13         , },
+/* x = 35.3        */  {0.149161790537327789            , 0.00211277323707262495          , 0.0000448889497961572788        , 1.05970136440298794e-6          , 2.62673850946992441e-8          , 6.69706702076008284e-10         , 1.73908728020388023e-11         , 4.57469335851400274e-13         , },
+/* x = 35.4        */  {0.148950961046037182            , 0.0021038271334185983           , 0.0000445726087588656233        , 1.04926103481222596e-6          , 2.59351244477935768e-8          , 6.59367570656870054e-10         , 1.70740190058934372e-11         , 4.47865711238111931e-13         , },
+/* x = 35.5        */  {0.148741023012108812            , 0.00209494398608603422          , 0.0000442593799877304242        , 1.03895258187070849e-6          , 2.56079861726451479e-8          , 6.49216550810906958e-10         , 1.67638076425659726e-11         , 4.38489937268032755e-13         , },
+/* x = 35.6        */  {0.148531970170901827            , 0.00208612317655760507          , 0.000043949224225228014         , 1.02877397530883452e-6          , 2.5285877201910708e-8           , 6.3924970450218642e-10          , 1.64600813357688423e-11         , 4.29335988933376302e-13         , },
+/* x = 35.7        */  {0.148323796319236555            , 0.00207736409410695017          , 0.0000436421028173707102        , 1.0187232216932633e-6           , 2.49687064138678547e-8          , 6.29463186867688351e-10         , 1.61626868649285285e-11         , 4.20398016825141707e-13         , },
+/* x = 35.8        */  {0.148116495314621405            , 0.00206866613567906594          , 0.0000433379777027717494        , 1.00879836365790081e-6          , 2.46563845864458372e-8          , 6.19853243760357738e-10         , 1.58714750442342694e-11         , 4.11670341543422462e-13         , },
+/* x = 35.9        */  {0.147910061074491618            , 0.00206002870577286019          , 0.0000430368114019381909        , 9.98997479153030553e-7          , 2.4348824352466885e-8           , 6.1041620936356781e-10          , 1.55863006055316193e-11         , 4.03147448300584292e-13         , },
+/* x = 36.0        */  {0.147704487575459666            , 0.00205145121632582547          , 0.0000427385670067864198        , 9.89318680712111681e-7          , 2.40459401560629273e-8          , 6.01148503874726852e-10         , 1.53070220849283789e-11         , 3.94823981710144796e-13         , },
+/* x = 36.1        */  {0.147499768852577068            , 0.00204293308660078751          , 0.0000424432081703750184        , 9.79760114735780943e-7          , 2.37476482102336799e-8          , 5.92046631255839768e-10         , 1.50335017129853299e-11         , 3.86694740754472758e-13         , },
+/* x = 36.2        */  {0.147295898998607438            , 0.00203447374307468574          , 0.0000421506990968499125        , 9.70319960792608698e-7          , 2.34538664555131554e-8          , 5.83107177048910578e-10         , 1.47656053083689283e-11         , 3.78754673924698275e-13         , },
+/* x = 36.3        */  {0.147092872163310547            , 0.00202607261932934401          , 0.0000418610045315968334        , 9.60996430936171945e-7          , 2.31645145197126878e-8          , 5.74326806254144408e-10         , 1.45032021748476458e-11         , 3.7099887452648642e-13          , },
+/* x = 36.4        */  {0.14689068255273722             , 0.00201772915594419045          , 0.0000415740897515962629        , 9.51787769038020025e-7          , 2.28795136787095689e-8          , 5.65702261268977177e-10         , 1.42461650015180023e-11         , 3.63422576145577785e-13         , },
+/* x = 36.5        */  {0.146689324428534857            , 0.00200944280039088652          , 0.0000412899205559761567        , 9.42692250136120734e-7          , 2.25987868182513611e-8          , 5.57230359886028291e-10         , 1.3994369766150517e-11          , 3.56021148267239258e-13         , },
+},
+/* n = 4 */
+{
+/* x = 0.0         */  {0.111111111111111111            , 0.0909090909090909091           , 0.0384615384615384615           , 0.0111111111111111111           , 0.00245098039215686275          , 0.000438596491228070175         , 0.0000661375661375661376        , 8.62663906142167012e-6          , },
+/* x = 0.1         */  {0.102393947071065319            , 0.0835405280181414827           , 0.0352709754089918417           , 0.0101732854981902587           , 0.00224130766690910576          , 0.000400671252623149031         , 0.0000603683190612515039        , 7.86861723230472782e-6          , },
+/* x = 0.2         */  {0.0943826509214874721           , 0.0767827630385134765           , 0.0323495504320829789           , 0.00931564923173982991          , 0.00204975810193779516          , 0.000366053177346636844         , 0.0000551058724734380068        , 7.17759857162738302e-6          , },
+/* x = 0.3         */  {0.0870187558423999078           , 0.0705843031664688398           , 0.0296742617911994762           , 0.00853127385818569841          , 0.00187475184409687437          , 0.000334451829302873313         , 0.0000503054401130400178        , 6.5476302339441808e-6           , },
+/* x = 0.4         */  {0.0802487210501310663           , 0.0648980542694253695           , 0.0272240943300248525           , 0.00781383469687643009          , 0.00171484774391871915          , 0.000305602432116647012         , 0.0000459262138720761919        , 5.97329060271644869e-6          , },
+/* x = 0.5         */  {0.0740235112058776398           , 0.0596809411402653349           , 0.0249798464151426302           , 0.0071575578468458269           , 0.00156873110431212489          , 0.000279263590389279441         , 0.0000419310088540606972        , 5.44964169856434869e-6          , },
+/* x = 0.6         */  {0.0682982121200224433           , 0.054893560821812964            , 0.0229239720607984048           , 0.00655717187315723486          , 0.00143520251701821893          , 0.000255215214231992292         , 0.0000382859402255972141        , 4.97218586590665408e-6          , },
+/* x = 0.7         */  {0.0630316795924698939           , 0.0504998661005853788           , 0.0210404368982248758           , 0.00600786375743300655          , 0.00131316768980836533          , 0.000233256628871449646         , 0.0000349601290034679357        , 4.5368263521861782e-6           , },
+/* x = 0.8         */  {0.0581862185063504523           , 0.0464668765249577995           , 0.0193145867679106886           , 0.00550523873421419907          , 0.0012016281760952168           , 0.000213204852758473243         , 0.000031925434177167884         , 4.13983142876448589e-6          , },
+/* x = 0.9         */  {0.0537272895450847871           , 0.0427644145362022065           , 0.0177330278215625444           , 0.00504528366852102248          , 0.00109967292653455814          , 0.000194893029099539858         , 0.0000291562088011973494        , 3.77780173429285836e-6          , },
+/* x = 1.0         */  {0.0496232411331567381           , 0.0393648645134841608           , 0.0162835171192208619           , 0.00462433366069167404          , 0.00100647058939184046          , 0.000178168997085119115         , 0.0000266290779046036538        , 3.44764055021477415e-6          , },
+/* x = 1.1         */  {0.0458450644109970211           , 0.0362429527276789258           , 0.0149548627969065068           , 0.00423904159253709271          , 0.000921262492997325584         , 0.000162893990321323049         , 0.0000243227362591773987        , 3.14652674428956667e-6          , },
+/* x = 1.2         */  {0.0423661692459266935           , 0.0333755463754742271           , 0.0137368329620863337           , 0.00388635035430851252          , 0.000843356249575764417         , 0.000148941451092742311         , 0.0000222177642241032246        , 2.87189014188480985e-6          , },
+/* x = 1.3         */  {0.0391621794557900918           , 0.0307414700261916241           , 0.0126200725488644736           , 0.00356346751515793009          , 0.000772119925163479251         , 0.000136195950104765806         , 0.0000202964600453276891        , 2.62138910648214716e-6          , },
+/* x = 1.4         */  {0.0362107455812147118           , 0.0283213379604735463           , 0.0115960274327861665           , 0.00326784222088296742          , 0.000706976725265782603         , 0.000124552202282240551         , 0.0000185426871338799502        , 2.39289013057386412e-6          , },
+/* x = 1.5         */  {0.0334913736877309372           , 0.026097401013716202            , 0.0106568751670747322           , 0.002997144121972956            , 0.000647400150404669603         , 0.00011391417004632047          , 0.0000169417349801763155        , 2.18444925607381362e-6          , },
+/* x = 1.6         */  {0.030985268811507184            , 0.0240534066590341398           , 0.00979546175855002025          , 0.00274924415248151656          , 0.000592909579800534922         , 0.000104194246260319895         , 0.0000154801924821501524        , 1.99429515968842357e-6          , },
+/* x = 1.7         */  {0.0286751917833353157           , 0.0221744711756715268           , 0.00900524395289002123          , 0.00252219699619636773          , 0.000543066245158559384         , 0.0000953125097351901431        , 0.0000141458325749586912        , 1.82081375353879318e-6          , },
+/* x = 1.8         */  {0.0265453282757660862           , 0.0204469628500856216           , 0.00828023654574379163          , 0.00231422509109963167          , 0.000497469559923383245         , 0.0000871960468221153376        , 0.0000129275071500140554        , 1.66253416482726956e-6          , },
+/* x = 1.9         */  {0.0245811690188825104           , 0.018858395249291458            , 0.00761496427889091917          , 0.00212370403633898447          , 0.00045575377245475383          , 0.0000797783331993519957        , 0.0000118150513420641438        , 1.51811597062316216e-6          , },
+/* x = 2.0         */  {0.0227694002219647944           , 0.0173973296902676144           , 0.00700441791954138335          , 0.00194914927797763647          , 0.000417584914389318648         , 0.000072998670487977743         , 0.0000107991963458251952        , 1.38633757501310812e-6          , },
+/* x = 2.1         */  {0.0210978033220223229           , 0.0160532861060045229           , 0.00644401415631760016          , 0.00178920396076490849          , 0.000382658018014482682         , 0.0000668016728113631426        , 9.87148999898348376e-6          , 1.26608562602269294e-6          , },
+/* x = 2.2         */  {0.0195551632565556575           , 0.0148166615787879623           , 0.00592955897776519336          , 0.00164262784316519485          , 0.000350694578811871712         , 0.0000611367988502079075        , 9.02422443691292481e-6          , 1.15634537895876352e-6          , },
+/* x = 2.3         */  {0.0181311845276111274           , 0.0136786558751513941           , 0.00545721422868060881          , 0.00150828718198884404          , 0.000321440241451016573         , 0.0000559579253427736012        , 8.25037018681161747e-6          , 1.05619192122963778e-6          , },
+/* x = 2.4         */  {0.0168164143877916315           , 0.0126312033751483708           , 0.00502346706637703909          , 0.00138514550126355948          , 0.00029466268944711675          , 0.000051222958342033213         , 7.54351612570116384e-6          , 9.64782181348755532e-7          , },
+/* x = 2.5         */  {0.0156021725369267807           , 0.0116669108416884462           , 0.00462510206346741132          , 0.00127225516754179664          , 0.000270149720457190851         , 0.0000468934788710584537        , 6.89781477836513314e-6          , 8.81347651785000709e-7          , },
+/* x = 2.6         */  {0.0144804867710729915           , 0.0107790005241005852           , 0.00425917572603582273          , 0.00116874970072427919          , 0.000247707490792077295         , 0.0000429344199180026536        , 6.3079324782885069e-6           , 8.05187761652485647e-7          , },
+/* x = 2.7         */  {0.0134440340738557608           , 0.00996125813425038551          , 0.00392299321638930329          , 0.00107383675575222594          , 0.000227158914181717356         , 0.000039313771985171167         , 5.76900395741782297e-6          , 7.35663840990877359e-7          , },
+/* x = 2.8         */  {0.0124860866842888206           , 0.00920798527381811086          , 0.00361408708810546915          , 0.000986791716235840265         , 0.000208342201160771271         , 0.0000360023146553224905        , 5.27659096947354003e-6          , 6.72193623626061517e-7          , },
+/* x = 2.9         */  {0.0116004627154789198           , 0.00851395592808673254          , 0.00333019785797817491          , 0.000906951846293830993         , 0.00019110952665256868          , 0.0000329733718647137824        , 4.82664458695885894e-6          , 6.14246240367088057e-7          , },
+/* x = 3.0         */  {0.0107814809353885859           , 0.00787437667510555509          , 0.00306925625485809692          , 0.000833710951623516024         , 0.000175325814432309022         , 0.0000302025887784974139        , 4.41547084423846313e-6          , 5.61337658631667313e-7          , },
+/* x = 3.1         */  {0.0100239193543905058           , 0.00728485028967044298          , 0.00282936699942073119          , 0.000766514505144656042         , 0.000160867628154981436         , 0.0000276677283517131987        , 4.03969942839343348e-6          , 5.13026528537855484e-7          , },
+/* x = 3.2         */  {0.00932297729498702405          , 0.00674134244945578145          , 0.00260879398169120163          , 0.000704855196500130915         , 0.000147622159548473745         , 0.0000253484858299623343        , 3.69625514625605624e-6          , 4.68910399089327726e-7          , },
+/* x = 3.3         */  {0.00867424064704283998          , 0.00624015127608265975          , 0.00240594671482342817          , 0.000648268868287099165         , 0.000135486305205801259         , 0.0000232263195994026619        , 3.38233192032787537e-6          , 4.28622271347927796e-7          , },
+/* x = 3.4         */  {0.00807365003742179176          , 0.005777879467127948            , 0.00221936795427068739          , 0.000596330805164504722         , 0.000124365824169603833         , 0.0000212842969373434857        , 3.09536908840217889e-6          , 3.91827458459233934e-7          , },
+/* x = 3.5         */  {0.00751747166624260828          , 0.00535140879626642483          , 0.00204772238118658374          , 0.000548652344965063726         , 0.000114174569193674016         , 0.0000195069533436910686        , 2.83302980184466976e-6          , 3.58220725101272845e-7          , },
+/* x = 3.6         */  {0.00700227058326785757          , 0.0049578767780719663           , 0.00188978625774299087          , 0.000504877783657990782         , 0.000104833785196334546         , 0.0000178801642509397386        , 2.59318133581212252e-6          , 3.27523681387420958e-7          , },
+/* x = 3.7         */  {0.00652488619739210191          , 0.00459465531164723324          , 0.00174443797012028206          , 0.000464681548486214917         , 0.0000962714689944817081        , 0.0000163910280173526416        , 2.3738771413709894e-6           , 2.99482408493939527e-7          , },
+/* x = 3.8         */  {0.00608240982996097494          , 0.00425933113335304982          , 0.00161064938228407581          , 0.000427765615860095948         , 0.0000884217849300605239        , 0.000015027759205371818         , 2.17334048466413545e-6          , 2.73865295320492175e-7          , },
+/* x = 3.9         */  {0.00567216413887980845          , 0.00394968792360434456          , 0.00148747793037457703          , 0.000393857152648175518         , 0.0000812245314771976933        , 0.0000137795912359960154        , 1.98994953209874049e-6          , 2.50461067346575287e-7          , },
+/* x = 4.0         */  {0.00529168425529288713          , 0.00366368992611272549          , 0.00137405939365661251          , 0.000362706361382036351         , 0.0000746246543523390173        , 0.0000126366875906459779        , 1.82222375311434882e-6          , 2.29076990534592608e-7          , },
+/* x = 4.1         */  {0.00493870048815492694          , 0.00339946695019915792          , 0.00126960128356277376          , 0.000334084511603066465         , 0.0000685718020452984468        , 0.0000115900608056102833        , 1.66881152354847533e-6          , 2.09537234666369035e-7          , },
+/* x = 4.2         */  {0.00461112246438672118          , 0.00315530063797652196          , 0.00117337679745619258          , 0.000307782141138557556         , 0.0000630199200495658425        , 0.0000106314985711757515        , 1.52847882304943902e-6          , 1.91681381897907498e-7          , },
+/* x = 4.3         */  {0.00430702458360903347          , 0.00292961188840469412          , 0.00108471928838666881          , 0.000283607412516520492         , 0.0000579268803986720569        , 9.75349630858262352e-6          , 1.40009892948440728e-6          , 1.75363067589592707e-7          , },
+/* x = 4.4         */  {0.00402463267677574664          , 0.00272094933953559983          , 0.00100301720635358847          , 0.000261384611025092025         , 0.0000532541434147246263        , 8.94919565354091512e-6          , 1.28264302193889604e-6          , 1.60448741627156993e-7          , },
+/* x = 4.5         */  {0.00376231176746385694          , 0.00252797881877026733          , 0.000927709470457257451         , 0.000240952772104562727         , 0.0000489664488480015689        , 8.21232832568734596e-6          , 1.17517161177852504e-6          , 1.46816539502843743e-7          , },
+/* x = 4.6         */  {0.00351855484320155097          , 0.00234947367871525838          , 0.000858281234849688073         , 0.000222164426838012831         , 0.0000450315338350886465        , 7.53716490949509612e-6          , 1.0768267284141361e-6           , 1.343552533857004e-7            , },
+/* x = 4.7         */  {0.00329197255209695703          , 0.00218430594331668044          , 0.000794260014616365307         , 0.000204884455289533349         , 0.0000414198753296196114        , 6.91846811417463154e-6          , 9.86824792940653489e-7          , 1.22963394283326234e-7          , },
+/* x = 4.8         */  {0.00308128374723367814          , 0.00203143819542532025          , 0.00073521214065929656          , 0.000188989038335445863         , 0.0000381044548661896652        , 6.35145011839006472e-6          , 9.04450118765815786e-7          , 1.12548337192441837e-7          , },
+/* x = 4.9         */  {0.00288530680788370757          , 0.00188991614286010486          , 0.000680739515333510865         , 0.000174364699451478605         , 0.0000350605437062446171        , 5.83173364049614221e-6          , 8.29048983759476152e-7          , 1.03025541859388948e-7          , },
+/* x = 5.0         */  {0.00270295167260747403          , 0.00175886180543817992          , 0.000630476643036725601         , 0.000160907428664489975         , 0.0000322655065863276279        , 5.3553164067801709e-6           , 7.60024223385183687e-7          , 9.4317842430525997e-8           , },
+/* x = 5.1         */  {0.00253321252481354884          , 0.001637467270373167            , 0.000584087912185745144         , 0.000148521881557414014         , 0.0000296986224454723248        , 4.91853871914793498e-6          , 6.96830298766565311e-7          , 8.6354799872292861e-8           , },
+/* x = 5.2         */  {0.00237516107638167857          , 0.00152498896794945526          , 0.000541265107052078628         , 0.00013712064683643064          , 0.0000273409206511137226        , 4.51805385007502115e-6          , 6.38968797731073157e-7          , 7.90721115867875021e-8          , },
+/* x = 5.3         */  {0.00222794039955309177          , 0.00142074242349694432          , 0.000501725129790385438         , 0.000126623576535217062         , 0.0000251750313728746832        , 4.15080101668447682e-6          , 5.85984330598845773e-7          , 7.24110731458582637e-8          , },
+/* x = 5.4         */  {0.00209075926149871515          , 0.00132409744545146003          , 0.000465207914692286684         , 0.000116957173447326942         , 0.000023185048872093969         , 3.81398070771733901e-6          , 5.37460785877426051e-7          , 6.63180875193638652e-8          , },
+/* x = 5.5         */  {0.0019628869198230259           , 0.00123447371272210601          , 0.00043147451824904996          , 0.00010805403084865503          , 0.0000213564065830109307        , 3.50503215712453994e-6          , 4.93017914113621726e-7          , 6.07442175853876893e-8          , },
+/* x = 5.6         */  {0.00184364834077980333          , 0.001151336727726366            , 0.000400305370022638177         , 0.0000998523200015723479        , 0.0000196757629600393619        , 3.22161277620024468e-6          , 4.52308210968951767e-7          , 5.56447780854524501e-8          , },
+/* x = 5.7         */  {0.00173241980519436387          , 0.00107419410432263176          , 0.000371498670617441957         , 0.0000922953213243014345        , 0.0000181308971553942118        , 2.96157937275553044e-6          , 4.15014073149529317e-7          , 5.09789635294766519e-8          , },
+/* x = 5.8         */  {0.00162862487003084403          , 0.00100259216249153289          , 0.000344868924225476166         , 0.0000853309954667609994        , 0.0000167106136732495517        , 2.72297100094109364e-6          , 3.80845203157313069e-7          , 4.67095088663580811e-8          , },
+/* x = 5.9         */  {0.00153173065623636085          , 0.00093611280401346427          , 0.000320245594295751599         , 0.000078911590860468536         , 0.0000154046552213057874        , 2.50399329909914693e-6          , 3.49536240957825536e-7          , 4.2802380019403297e-8           , },
+/* x = 6.0         */  {0.00144124443595800286          , 0.000874370645579638944         , 0.000297471871862902915         , 0.0000729932846079044079        , 0.0000142036230487674941        , 2.30300418557692997e-6          , 3.20844602598268739e-7          , 3.92264916438403589e-8          , },
+/* x = 6.1         */  {0.0013567104944832874           , 0.00081701038777572001          , 0.000276403546969144165         , 0.00006753585384852385          , 0.0000130989041218625138        , 2.11850079387575351e-6          , 2.94548507576379273e-7          , 3.59534496986249697e-8          , },
+/* x = 6.2         */  {0.00127770724431795448          , 0.000763704400206923864         , 0.000256907974434694683         , 0.0000625023749866441855        , 0.0000120826045446983949        , 1.94910753893898573e-6          , 2.70445178369752812e-7          , 3.295731663874373e-8            , },
+/* x = 6.3         */  {0.00120384457070318639          , 0.000714150504706331009         , 0.000238863125981775169         , 0.0000578589483928207352        , 0.0000111474886849370349        , 1.79356521588981706e-6          , 2.48349197001750008e-7          , 3.02143972291123913e-8          , },
+/* x = 6.4         */  {0.00113476138960255479          , 0.000668069940097582706         , 0.000222156721402323252         , 0.0000535744463969592456        , 0.0000102869235109127526        , 1.65072104119691964e-6          , 2.28091004856232887e-7          , 2.77030431586729098e-8          , },
+/* x = 6.5         */  {0.00107012340077091391          , 0.000625205493381588674         , 0.000206685432085380883         , 0.0000496202825800298785        , 9.49482768982409172e-6          , 1.51951955414785703e-6          , 2.09515533170891196e-7          , 2.54034747949679858e-8          , },
+/* x = 6.6         */  {0.00100962101996560468          , 0.00058531978349564763          , 0.000192354150791826914         , 0.0000459702005434293729        , 8.76562503586095374e-6          , 1.39899430371425234e-6          , 1.92480952748379832e-7          , 2.32976185667329492e-8          , },
+/* x = 6.7         */  {0.000952967475686151438         , 0.000548193684962826997         , 0.000179075322086478201         , 0.0000426000804922257716        , 8.09420193291927318e-6          , 1.28826025246118301e-6          , 1.76857532435532345e-7          , 2.1368958596182301e-8           , },
+/* x = 6.8         */  {0.00089989705704257554          , 0.000513624879818998293         , 0.000166768328314859491         , 0.0000394877621120287215        , 7.47586838920889049e-6          , 1.18650683514241682e-6          , 1.62526596842310791e-7          , 1.96024013248560935e-8          , },
+/* x = 6.9         */  {0.000850163500464070127         , 0.000481426527183197129         , 0.000155358926448067306         , 0.0000366128823502565121        , 6.90632241085318639e-6          , 1.09299161508429305e-6          , 1.49379574611883795e-7          , 1.79841519881983583e-8          , },
+/* x = 7.0         */  {0.000803538503977806093         , 0.000451426040731838473         , 0.000144778731517703821         , 0.0000339567268322117041        , 6.38161740876350346e-6          , 1.00703448644106738e-6          , 1.37317129318563237e-7          , 1.65016018954387746e-8          , },
+/* x = 7.1         */  {0.000759810358720047615         , 0.000423463965155952413         , 0.000134964742727097615         , 0.0000315020937516271564        , 5.89813237787717079e-6          , 9.28012374945998482e-7          , 1.26248365767896349e-7          , 1.51432255637252476e-8          , },
+/* x = 7.2         */  {0.000718782688195835896         , 0.000397392943429572479         , 0.000125858908657938122         , 0.000029233169175112405         , 5.4525446104844823e-6           , 8.55354393924183686e-7          , 1.1609010510903351e-7           , 1.3898486839615125e-8           , },
+/* x = 7.3         */  {0.00068027328658591503          , 0.000373076767402698016         , 0.000117407728295747737         , 0.0000271354127910456271        , 5.04180472602814556e-6          , 7.88537416110524629e-7          , 1.06766222749063158e-7          , 1.27577532177102456e-8          , },
+/* x = 7.4         */  {0.000644113048116414065         , 0.000350389504859334732         , 0.000109561884875780726         , 0.000025195453216674846         , 4.66311381861251008e-6          , 7.27082025261447949e-7          , 9.82070435873243964e-8          , 1.17122176360839275e-8          , },
+/* x = 7.5         */  {0.000610144980163631543         , 0.00032921469675499002          , 0.000102275909805235221         , 0.0000234009920532031352        , 4.31390254066791275e-6          , 6.70548814691486009e-7          , 9.03487895693291221e-8          , 1.07538270918045336e-8          , },
+/* x = 7.6         */  {0.000578223293368182374         , 0.000309444618873225702         , 0.0000955078741501602639        , 0.0000217407159480653089        , 3.99181195692233306e-6          , 6.18535002732292321e-7          , 8.31330749989963265e-8          , 9.87521747786411028e-9          , },
+/* x = 7.7         */  {0.000548212562584414971         , 0.00029097960262161933          , 0.0000892191053880199861        , 0.0000202042159870316297        , 3.69467601717004765e-6          , 5.70671337726505619e-7          , 7.65064454481994726e-8          , 9.06965409567587827e-9          , },
+/* x = 7.8         */  {0.000519986952996643573         , 0.000273727410127564452         , 0.0000833739273212635341        , 0.0000187819137967207818        , 3.42050550941528754e-6          , 5.26619267554300538e-7          , 7.04199564675942414e-8          , 8.33097734547006284e-9          , },
+/* x = 7.9         */  {0.000493429506197256923         , 0.000257602659197229363         , 0.0000779394212250137536        , 0.0000174649937910471437        , 3.16747336691760167e-6          , 4.86068350866715775e-7          , 6.48287886354626927e-8          , 7.65355314081157749e-9          , },
+/* x = 8.0         */  {0.000468431481446717723         , 0.000242526294069871729         , 0.0000728852064645649119        , 0.000016245341043501832         , 2.93390121357461729e-6          , 4.48733889185381259e-7          , 5.96918957847358881e-8          , 7.03222763346595721e-9          , },
+/* x = 8.1         */  {0.000444891747725111201         , 0.000228425098237477417         , 0.0000681832389670797815        , 0.0000151154843113704492        , 2.71824704203825557e-6          , 4.1435476083988766e-7           , 5.49716835250409125e-8          , 6.46228587129815716e-9          , },
+/* x = 8.2         */  {0.000422716222542211694         , 0.000215231245909009934         , 0.0000638076260678953337        , 0.000014068543778385532         , 2.51909392805527325e-6          , 3.82691439367077825e-7          , 5.06337154289291255e-8          , 5.93941404511791098e-9          , },
+/* x = 8.3         */  {0.000401817353800735653         , 0.000202881888981847522         , 0.0000597344563762762264        , 0.0000130981831192292155        , 2.33513969282800546e-6          , 3.53524180504956932e-7          , 4.66464444815386365e-8          , 5.4596650106725971e-9           , },
+/* x = 8.4         */  {0.000382113641308028078         , 0.00019131877664246455          , 0.0000559416434192935051        , 0.0000121985655230434808        , 2.16518743277545882e-6          , 3.26651363290445895e-7          , 4.29809676027916971e-8          , 5.01942679959564187e-9          , },
+/* x = 8.5         */  {0.000363529194807165405         , 0.000180487904956108498         , 0.0000524087819266632149        , 0.0000113643133439470531        , 2.00813684300144755e-6          , 3.01887972026444327e-7          , 3.96108012426183734e-8          , 4.61539385828367918e-9          , },
+/* x = 8.6         */  {0.000345993325651435873         , 0.000170339194022985101         , 0.000049117015714687703         , 0.0000105904710747509802        , 1.8629762671027352e-6           , 2.79064207030201956e-7          , 3.65116762242636736e-8          , 4.24454077661599783e-9          , },
+/* x = 8.7         */  {0.00032944016947828575          , 0.000160826190477984962         , 0.0000460489162146609531        , 9.87247136583861465e-6          , 1.72877541172854863e-6          , 2.58024213121462849e-7          , 3.36613501699634326e-8          , 3.90409828934288553e-9          , },
+/* x = 8.8         */  {0.000313808337451842044         , 0.000151905793293812602         , 0.0000431883707709222165        , 9.20610383473959308e-6          , 1.60467866958117135e-6          , 2.38624915764034711e-7          , 3.10394359885197711e-8          , 3.59153135203533481e-9          , },
+/* x = 8.9         */  {0.000299040593838637057         , 0.000143538001014928206         , 0.0000405204799068033376        , 8.58748643347261545e-6          , 1.48989899936920399e-6          , 2.20734955646359447e-7          , 2.86272450368046263e-8          , 3.30451911087117111e-9          , },
+/* x = 9.0         */  {0.000285083557860629376         , 0.000135685678703276935         , 0.0000380314628235935205        , 8.01303916043288873e-6          , 1.38371231563027879e-6          , 2.04233713282626943e-7          , 2.64076436880948981e-8          , 3.0409366013813416e-9           , },
+/* x = 9.1         */  {0.000271887427934378292         , 0.000128314343017543401         , 0.0000357085704588698536        , 7.47945992161631372e-6          , 1.28545234536482028e-6          , 1.8901041594264283e-7           , 2.43649221504205522e-8          , 2.7988380257309002e-9           , },
+/* x = 9.2         */  {0.000259405726556509322         , 0.000121391963976711443         , 0.0000335400054865959924        , 6.98370236244929757e-6          , 1.19450591209996248e-6          , 1.74963319882106585e-7          , 2.24846744787220459e-8          , 2.57644147128605917e-9          , },
+/* x = 9.3         */  {0.000247595064234529369         , 0.00011488878207702102          , 0.0000315148486927166099        , 6.52295550656324838e-6          , 1.11030861136316984e-6          , 1.61998961450716826e-7          , 2.07536888164173407e-8          , 2.37211494523443477e-9          , },
+/* x = 9.4         */  {0.000236414920989638293         , 0.000108777139539899595         , 0.0000296229912069750872        , 6.09462505163758868e-6          , 1.03234084461602553e-6          , 1.50031471208646345e-7          , 1.91598469857477396e-8          , 2.18436361098313027e-9          , },
+/* x = 9.5         */  {0.000225827444075379836         , 0.000103031324567932523         , 0.0000278550721147251883        , 5.6963161850452132e-6           , 9.60124181505194291e-7          , 1.38981945687025737e-7          , 1.76920326227133105e-8          , 2.01181812205226257e-9          , },
+/* x = 9.6         */  {0.000215797260663640382         , 0.00009762742757718279          , 0.0000262024210119311671        , 5.32581779357080271e-6          , 8.93218022852687436e-7          , 1.28777871889341407e-7          , 1.63400471221675734e-8          , 1.85322395829530254e-9          , },
+/* x = 9.7         */  {0.000206291304348428018         , 0.0000925432084578675291        , 0.0000246570051026629053        , 4.98108795202760689e-6          , 8.31216539152196143e-7          , 1.19352600051921792e-7          , 1.50945327223052398e-8          , 1.70743167758993138e-9          , },
+/* x = 9.8         */  {0.000197278654408769301         , 0.0000877579739921809556        , 0.0000232113804714748349        , 4.66024058525653679e-6          , 7.73745861481529187e-7          , 1.10644860566448523e-7          , 1.39469021158819197e-8          , 1.57338800372487087e-9          , },
+/* x = 9.9         */  {0.000188730386855609395         , 0.0000832524646285004672        , 0.0000218586471933669151        , 4.36153320682966742e-6          , 7.20461503700536123e-7          , 1.025983213188735e-7            , 1.28892740285393012e-8          , 1.45012767812388701e-9          , },
+/* x = 10.0        */  {0.000180619436364399069         , 0.0000790087498758553385        , 0.0000205924079717980968        , 4.08335564586888055e-6          , 6.71045996595238328e-7          , 9.5161182020155161e-8           , 1.19144142530186747e-8          , 1.33676600935672133e-9          , },
+/* x = 10.1        */  {0.00017292046826565557          , 0.0000750101316418613577        , 0.0000194067300206726294        , 3.82421968079362752e-6          , 6.25206716266761073e-7          , 8.82858023974990962e-8          , 1.10156816722357832e-8          , 1.23249206014168173e-9          , },
+/* x = 10.2        */  {0.000165609759830702641         , 0.0000712410548917743658        , 0.0000182961099295439049        , 3.58274950558835639e-6          , 5.82673890561326329e-7          , 8.19283613827183161e-8          , 1.01869788445309815e-8          , 1.13656241679487371e-9          , },
+/* x = 10.3        */  {0.000158665090149494959         , 0.0000676870250562978465        , 0.0000172554412726591582        , 3.35767296038364984e-6          , 5.43198768707138939e-7          , 7.60485446791236624e-8          , 9.42270676123806341e-9          , 1.04829549087109459e-9          , },
+/* x = 10.4        */  {0.000152065637952341732         , 0.0000643345316616669207        , 0.0000162799847420656849        , 3.14781346382455265e-6          , 5.0655194057653466e-7           , 7.0609258312028247e-8           , 8.71772342034059607e-9          , 9.67066307111818682e-10         , },
+/* x = 10.5        */  {0.000145791886777855328         , 0.0000611709776976643237        , 0.0000153653406029657239        , 2.95208258989969574e-6          , 4.72521793137352101e-7          , 6.55763659723382933e-8          , 8.06730589068678247e-9          , 8.92301735803448536e-10         , },
+/* x = 10.6        */  {0.000139825536935923272         , 0.0000581846142779153891        , 0.0000145074232859803322        , 2.7694732366665522e-6           , 4.40913092705358691e-7          , 6.09184481494823701e-8          , 7.46711556926864567e-9          , 8.23476131287798802e-10         , },
+/* x = 10.7        */  {0.000134149423757265244         , 0.0000553644801823446263        , 0.0000137024379460882873        , 2.59905333866887285e-6          , 4.11545682568119865e-7          , 5.66065812206311178e-8          , 6.91316635967203752e-9          , 7.6010734168733323e-10          , },
+/* x = 10.8        */  {0.000128747441660493349         , 0.0000527003459043179723        , 0.0000129468588318593926        , 2.43996007883620579e-6          , 3.84253286427636159e-7          , 5.26141348191757779e-8          , 6.40179552318343861e-9          , 7.01753057937992866e-10         , },
+/* x = 10.9        */  {0.000123604473603820918         , 0.0000501826618549820043        , 0.0000122374093213078322        , 2.29139455931363204e-6          , 3.58882408911403515e-7          , 4.89165859480397819e-8          , 5.92963697539182837e-9          , 6.48007472988057741e-10         , },
+/* x = 11.0        */  {0.000118706325521916988         , 0.0000478025104048639653        , 0.0000115710434923467718        , 2.15261689402098793e-6          , 3.35291325135687983e-7          , 4.54913484337556961e-8          , 5.49359682062609392e-9          , 5.98498224545642864e-10         , },
+/* x = 11.1        */  {0.000114039665379113403         , 0.0000455515614681155677        , 0.0000109449291065183833        , 2.02294168881098301e-6          , 3.13349151976601807e-7          , 4.23176164364108518e-8          , 5.09083093438198912e-9          , 5.52883597061352848e-10         , },
+/* x = 11.2        */  {0.000109591966498453338         , 0.0000434220313580535306        , 0.000010356431894484551         , 1.90173387790861139e-6          , 2.92934994319371414e-7          , 3.93762208395173302e-8          , 4.71872442016484124e-9          , 5.10849960735645604e-10         , },
+/* x = 11.3        */  {0.000105351454852120284         , 0.000041406644664039572         , 9.8031010407665279e-6           , 1.78840488789189893e-6          , 2.73937160118883984e-7          , 3.66494974434795115e-8          , 4.37487278203939624e-9          , 4.72109427260214221e-10         , },
+/* x = 11.4        */  {0.00010130706002278526          , 0.0000394985989194068596        , 9.28265577348430946e-6          , 1.68240910283626537e-6          , 2.5625243861965084e-7           , 3.41211659774220026e-8          , 4.05706466775896821e-9          , 4.36397703755261903e-10         , },
+/* x = 11.5        */  {0.0000974483695675226328        , 0.0000376915318482205645        , 8.79297297243033694e-6          , 1.58324060640984094e-6          , 2.39785436554809735e-7          , 3.17762190274390077e-8          , 3.76326604975424075e-9          , 4.03472127964573925e-10         , },
+/* x = 11.6        */  {0.0000937655865363232455        , 0.0000359794909952871377        , 8.33207571577394182e-6          , 1.49043017869162983e-6          , 2.24447967575429365e-7          , 2.96008200555055914e-8          , 3.49160572259968475e-9          , 3.73109869231147534e-10         , },
+/* x = 11.7        */  {0.0000902494899160167924        , 0.0000343569055591193917        , 7.89812269208452872e-6          , 1.40354252730370642e-6          , 2.10158490556581575e-7          , 2.75822097529657827e-8          , 3.24036200593569678e-9          , 3.45106281110011958e-10         , },
+/* x = 11.8        */  {0.0000868913977877315374        , 0.0000328185602616316514        , 7.4893984102303242e-6           , 1.3221737341166071e-6           , 1.96841592788520085e-7          , 2.57086200362427017e-8          , 3.0079505512921667e-9           , 3.19273392692869729e-10         , },
+/* x = 11.9        */  {0.0000836831330019859679        , 0.0000313595711012812705        , 7.10430414509904418e-6          , 1.24594890031649633e-6          , 1.8442751439269117e-7           , 2.39691950507137691e-8          , 2.79291315991176007e-9          , 2.95438526831452074e-10         , },
+/* x = 12.0        */  {0.0000806169911902316565        , 0.0000299753628482815291        , 6.74134956203684605e-6          , 1.17451997402520686e-6          , 1.72851710605799319e-7          , 2.23539186020270528e-8          , 2.59390752657948326e-9          , 2.73443034462248488e-10         , },
+/* x = 12.1        */  {0.0000776857109452485464        , 0.0000286616481514705278        , 6.39914496744887731e-6          , 1.10756374595055555e-6          , 1.62054448853133359e-7          , 2.08535474829298438e-8          , 2.40969783169363519e-9          , 2.53141135162974057e-10         , },
+/* x = 12.2        */  {0.0000748824460153240676        , 0.0000274144081365084084        , 6.07639413718198868e-6          , 1.04477999972418211e-6          , 1.51980437786996151e-7          , 1.94595502083275223e-8          , 2.23914611042095323e-9          , 2.34398854918466762e-10         , },
+/* x = 12.3        */  {0.0000722007393687095284        , 0.0000262298743843618911        , 5.77188767814832454e-6          , 9.85889804666485116e-7          , 1.4257848569935709e-7           , 1.8164050712145819e-8           , 2.08120433381940112e-9          , 2.17093052847674782e-10         , },
+/* x = 12.4        */  {0.0000696344989955179199        , 0.0000251045121875857085        , 5.48449688217554604e-6          , 9.30633939711212956e-7          , 1.33801185931575028e-7          , 1.69597765969579645e-8          , 1.93490714233470261e-9          , 2.01110529350398379e-10         , },
+/* x = 12.5        */  {0.0000671779753240772068        , 0.0000240350049897846476        , 5.21316803431104906e-6          , 8.78771438133390697e-7          , 1.25604627099877486e-7          , 1.58400115615571145e-8          , 1.79936517712619722e-9          , 1.86347208778328817e-10         , },
+/* x = 12.6        */  {0.0000648257401378472198        , 0.0000230182399208922934        , 4.95691714078722311e-6          , 8.30078243560374455e-7          , 1.17948126134746226e-7          , 1.47985516629752901e-8          , 1.67375895929477944e-9          , 1.7270739032500222e-10          , },
+/* x = 12.7        */  {0.0000625726668874060498        , 0.0000220512943475833869        , 4.71482504459411094e-6          , 7.84345968513192023e-7          , 1.10793982296835403e-7          , 1.38296650981208741e-8          , 1.55733327130791627e-9          , 1.60103061368417025e-10         , },
+/* x = 12.8        */  {0.0000604139122997681908        , 0.0000211314233642920514        , 4.48603289912451884e-6          , 7.41380747429689383e-7          , 1.04107250482804107e-7          , 1.29280552164540609e-8          , 1.44939199877810645e-9          , 1.48453267992681739e-10         , },
+/* x = 12.9        */  {0.0000583448991944619827        , 0.0000202560481559802794        , 4.26973797267279917e-6          , 7.0100217676761074e-7           , 9.78555322726394228e-8          , 1.20888264991505971e-8          , 1.34929339428276945e-9          , 1.37683537865208858e-10         , },
+/* x = 13.0        */  {0.0000563613004224145308        , 0.0000194227451690288355        , 4.06518975869877184e-6          , 6.63042335379403934e-7          , 9.20087832967392623e-8          , 1.13074532622078733e-8          , 1.25644572814385133e-9          , 1.277253510573411e-10           , },
+/* x = 13.1        */  {0.0000544590238498108444        , 0.00001862923603144176          , 3.87168636872778379e-6          , 6.27344878895667237e-7          , 8.65391356171860091e-8          , 1.05797508610968202e-8          , 1.17030329404035524e-9          , 1.18515654772254653e-10         , },
+/* x = 13.2        */  {0.0000526341983147496652        , 0.0000178733781679986773        , 3.68857118656067316e-6          , 5.93764202354770174e-7          , 8.14207339241594206e-8          , 9.90184919301614168e-9          , 1.09036274003024496e-9          , 1.09996418287603694e-10         , },
+/* x = 13.3        */  {0.0000508831604897474145        , 0.0000171531560600861828        , 3.51522976412619819e-6          , 5.62164665775982994e-7          , 7.66295844461218708e-8          , 9.27016830970659652e-9          , 1.01615969803136868e-9          , 1.02114224734455389e-10         , },
+/* x = 13.4        */  {0.000049202442587977086         , 0.0000164666731037183031        , 3.3510869408350389e-6           , 5.32419877795819413e-7          , 7.21434155620032612e-8          , 8.68139596926432865e-9          , 9.47265687073974902e-10         , 9.48198966211742693e-11         , },
+/* x = 13.5        */  {0.0000475887608556012774        , 0.000015812144022741756         , 3.19560416969954133e-6          , 5.04412032875333272e-7          , 6.79415491857961576e-8          , 8.13246696957430492e-9          , 8.83285267708093151e-10         , 8.80681522733853915e-11         , },
+/* x = 13.6        */  {0.0000460390047966960297        , 0.0000151878877974377777        , 3.04827703477681695e-6          , 4.78031297942650292e-7          , 6.40047820693655229e-8          , 7.62054411897806997e-9          , 8.23853426844019944e-10         , 8.18172906011092772e-11         , },
+/* x = 13.7        */  {0.0000445502270810905894        , 0.0000145923210717000351        , 2.90863294568368691e-6          , 4.53175244662661291e-7          , 6.03152762384506886e-8          , 7.14300071169511483e-9          , 7.68633174038448826e-10         , 7.60289018235647873e-11         , },
+/* x = 13.8        */  {0.0000431196340889914761        , 0.0000140239520047072752        , 2.77622899602857855e-6          , 4.29748323826935696e-7          , 5.68564578403105703e-8          , 6.69740438642639546e-9          , 7.17313331826172037e-10         , 7.06676019827555662e-11         , },
+/* x = 13.9        */  {0.0000417445770495392581        , 0.0000134813745355379628        , 2.65064997361546103e-6          , 4.07661378633717203e-7          , 5.36129237397131157e-8          , 6.28150225656624514e-9          , 6.69606504150333808e-10         , 6.57007892604137386e-11         , },
+/* x = 14.0        */  {0.0000404225437334834298        , 0.0000129632630315088322        , 2.53150651120524261e-6          , 3.86831193882337737e-7          , 5.05703552534327805e-8          , 5.89320720961220433e-9          , 6.25247208274417559e-10         , 6.10984202806521089e-11         , },
+/* x = 14.1        */  {0.0000391511506629733622        , 0.0000124683672931753134        , 2.4184333674771636e-6           , 3.6718007834036544e-7           , 4.77154384624947821e-8          , 5.53058528176165781e-9          , 5.83990156776997575e-10         , 5.68328047341254522e-11         , },
+/* x = 14.2        */  {0.0000379281358040686134        , 0.0000119955078909232354        , 2.31108782862249923e-6          , 3.48635477756967994e-7          , 4.50357905864575787e-8          , 5.19184402138411336e-9          , 5.45608677345370926e-10         , 5.28784167998573009e-11         , },
+/* x = 14.3        */  {0.0000367513517099857443        , 0.0000115435718099209666        , 2.2091482217307444e-6           , 3.31129616193865392e-7          , 4.25198919453901984e-8          , 4.87532176211746731e-9          , 5.09893259105272548e-10         , 4.92117219692784146e-11         , },
+/* x = 14.4        */  {0.000035618759085335754         , 0.0000111115083819011224        , 2.11231253179935568e-6          , 3.14599163527278864e-7          , 4.01570230731852401e-8          , 4.57947773280964068e-9          , 4.7665021515897574e-10          , 4.58110179944765031e-11         , },
+/* x = 14.5        */  {0.0000345284207436797477        , 0.0000106983254838120635        , 2.02029711481663466e-6          , 2.9898492714175065e-7           , 3.79372065807322851e-8          , 4.30288293746289777e-9          , 4.45700451860513355e-10         , 4.26562887901140794e-11         , },
+/* x = 14.6        */  {0.0000334784959326528671        , 0.000010303085984831692         , 1.93283549993764062e-6          , 2.84231565990800553e-7          , 3.58511533995171954e-8          , 4.04421174378213942e-9          , 4.16878336141213787e-10         , 3.9729070216791376e-11          , },
+/* x = 14.7        */  {0.0000324672350026892464        , 9.92490442457877181e-6          , 1.84967727429896536e-6          , 2.70287325341189186e-7          , 3.38902130656458331e-8          , 3.80223412392181775e-9          , 3.9003065291734777e-10          , 3.70123267635985004e-11         , },
+/* x = 14.8        */  {0.0000314929743970343449        , 9.56294390659866817e-6          , 1.77058704450332472e-6          , 2.57103790648073854e-7          , 3.20463277313318139e-8          , 3.57580849560665929e-9          , 3.65015645270019561e-10         , 3.44903382299319597e-11         , },
+/* x = 14.9        */  {0.0000305541319422651482        , 9.21641319234885436e-6          , 1.69534346925246517e-6          , 2.44635659128487811e-7          , 3.03119896157346605e-8          , 3.3638751160037102e-9           , 3.41702130690621991e-10         , 3.21485955819999114e-11         , },
+/* x = 15.0        */  {0.0000296492024199623846        , 8.88456398197198784e-6          , 1.62373835801983401e-6          , 2.32840527711188102e-7          , 2.86802016298681992e-8          , 3.16544998457899986e-9          , 3.19968687237883976e-10         , 2.99737052284059519e-11         , },
+/* x = 15.1        */  {0.0000287767534015003334        , 8.56668836912744767e-6          , 1.55557583103556033e-6          , 2.21678696142773112e-7          , 2.71444409312851814e-8          , 2.97961921471034033e-9          , 2.99702903959045959e-10         , 2.79533010223292749e-11         , },
+/* x = 15.2        */  {0.0000279354213291466341        , 8.26211645806207057e-6          , 1.49067153620805944e-6          , 2.11112984123776226e-7          , 2.56986251835349483e-8          , 2.80553383707497175e-9          , 2.8080069039191217e-10          , 2.60759633556087485e-11         , },
+/* x = 15.3        */  {0.0000271239078278037794        , 7.97021413194305371e-6          , 1.42885191893132385e-6          , 2.01108561434846672e-7          , 2.43370813131258569e-8          , 2.64240500081121417e-9          , 2.63165640390023473e-10         , 2.4331144762945999e-11          , },
+/* x = 15.4        */  {0.0000263409762327821871        , 7.69038096225579517e-6          , 1.36995354102682718e-6          , 1.91632790092728971e-7          , 2.3054516573030864e-8           , 2.48949954118923153e-9          , 2.46708445903240221e-10         , 2.27091015028847106e-11         , },
+/* x = 15.5        */  {0.000025585448319977902         , 7.42204824979159741e-6          , 1.3138224453459028e-6           , 1.82655077649096102e-7          , 2.18459917367702303e-8          , 2.3461358850378108e-9           , 2.31346356703611594e-10         , 2.12008306265809619e-11         , },
+/* x = 15.6        */  {0.0000248562012257416113        , 7.16467718841906844e-6          , 1.26031356281426581e-6          , 1.74146740812881115e-7          , 2.07068962608970808e-8          , 2.21168026748035329e-9          , 2.1700268237427169e-10          , 1.97980120860005959e-11         , },
+/* x = 15.7        */  {0.0000241521645445748973        , 6.91775714345277641e-6          , 1.20929015893668223e-6          , 1.66080878639049054e-7          , 1.96329252663979811e-8          , 2.08554323565113589e-9          , 2.03606333179745822e-10         , 1.84929554703825482e-11         , },
+/* x = 15.8        */  {0.0000234723175935792143        , 6.68080403700698701e-6          , 1.16062331699817591e-6          , 1.58432254584179504e-7          , 1.86200582011920037e-8          , 1.96717641700796356e-9          , 1.9109139671176236e-10          , 1.72785509938825296e-11         , },
+/* x = 15.9        */  {0.0000228156868333173472        , 6.4533588332545861e-6           , 1.11419145540000252e-6          , 1.51177186782179132e-7          , 1.76645390566507271e-8          , 1.85606953164392286e-9          , 1.79396747457540929e-10         , 1.6148224388525331e-11          , },
+/* x = 16.0        */  {0.0000221813434354301123        , 6.23498611700474223e-6          , 1.06987987675520165e-6          , 1.44293445942270748e-7          , 1.67628580209441514e-8          , 1.75174762964217569e-9          , 1.6846568666948357e-10          , 1.50958953851893134e-11         , },
+/* x = 16.1        */  {0.0000215684009879865423        , 6.02527275947042486e-6          , 1.02758034654104772e-6          , 1.37760160316439135e-7          , 1.59117344611132533e-8          , 1.65376853602562301e-9          , 1.582456101279857e-10           , 1.41159394915455472e-11         , },
+/* x = 16.2        */  {0.0000209760133301372003        , 5.8238266655212698e-6           , 9.87190699265251644e-7          , 1.31557727225055975e-7          , 1.51081011341427166e-8          , 1.56172048723882899e-9          , 1.48687701584313649e-10         , 1.32031527998797343e-11         , },
+/* x = 16.3        */  {0.0000204033725081907877        , 5.63027559711096507e-6          , 9.48614470250321901e-7          , 1.25667730667733853e-7          , 1.43490895350158729e-8          , 1.47521994437291625e-9          , 1.39746649849634513e-10         , 1.23527195797232329e-11         , },
+/* x = 16.4        */  {0.0000198497068457468023        , 5.44426606793362127e-6          , 9.1176055127700292e-7           , 1.20072864581827406e-7          , 1.36320162968318395e-8          , 1.3939095695144685e-9           , 1.31380387660676901e-10         , 1.15601824303800829e-11         , },
+/* x = 16.5        */  {0.0000193142791209943962        , 5.26546230470261263e-6          , 8.76542868454021064e-7          , 1.14756861343642419e-7          , 1.29543705646016023e-8          , 1.31745635267527905e-9          , 1.23549850603379105e-10         , 1.08214147869152439e-11         , },
+/* x = 16.6        */  {0.000018796384844732301         , 5.0935452707600875e-6           , 8.42880080798270463e-7          , 1.09704425137546327e-7          , 1.23138022703606497e-8          , 1.24554987774883067e-9          , 1.16218754514371243e-10         , 1.01325955901073908e-11         , },
+/* x = 16.7        */  {0.0000182953506330790794        , 4.92821174801756083e-6          , 8.10695298117784229e-7          , 1.04901169845994049e-7          , 1.17081112427822876e-8          , 1.17790071684880007e-9          , 1.09353389907272186e-10         , 9.49018594639751937e-12         , },
+/* x = 16.8        */  {0.0000178105326692291843        , 4.76917347349938404e-6          , 7.79915816890027815e-7          , 1.00333561139173452e-7          , 1.11352370895861303e-8          , 1.11423894322117706e-9          , 1.0292243208750531e-10          , 8.89090761810117302e-12         , },
+/* x = 16.9        */  {0.0000173413152489703671        , 4.6161563270129836e-6           , 7.5047287292083375e-7           , 9.59888624667022655e-8          , 1.05932497957454954e-8          , 1.05431275369075544e-9          , 9.68967657265148074e-11         , 8.33172319720605475e-12         , },
+/* x = 17.0        */  {0.0000168871094050137327        , 4.46889956670399242e-6          , 7.2230140965523625e-7           , 9.18550846757269158e-8          , 1.00803409848377093e-8          , 9.97887192310277871e-10         , 9.12493227646888022e-11         , 7.80981782804763669e-12         , },
+/* x = 17.1        */  {0.0000164473516055009112        , 4.32715510947208329e-6          , 6.9533986109108134e-7           , 8.79209390000251576e-8          , 9.59481579488220233e-9          , 9.44742967531429348e-10         , 8.59549326026927553e-11         , 7.32258235513414296e-12         , },
+/* x = 17.2        */  {0.000016021502522344992         , 4.19068685342566741e-6          , 6.6952994832006355e-7           , 8.41757931834286972e-8          , 9.13508532369987103e-9          , 8.94675355815789284e-10         , 8.09901836239514838e-11         , 6.86759778246226246e-12         , },
+/* x = 17.3        */  {0.0000156090458653345302        , 4.05927003974176693e-6          , 6.44816488789216773e-7          , 8.06096305181791933e-8          , 8.69965960222843428e-9          , 8.47493185155001352e-10         , 7.6333295167299595e-11          , 6.44262093990236664e-12         , },
+/* x = 17.4        */  {0.00001520948727818445          , 3.93269065147234604e-6          , 6.21147217439272972e-7          , 7.72130115948213111e-8          , 8.28714105736531427e-9          , 8.0301789247668599e-10          , 7.19639991389063112e-11         , 6.04557126070662231e-12         , },
+/* x = 17.5        */  {0.0000148223532929553043        , 3.81074484700115139e-6          , 5.9847261893507465e-7           , 7.39770385750214337e-8          , 7.89621842880296335e-9          , 7.61082649379564102e-10         , 6.78634305169827911e-11         , 5.67451858196904752e-12         , },
+/* x = 17.6        */  {0.0000144471903394842817        , 3.69323842600655672e-6          , 5.76745770257732746e-7          , 7.08933218123736402e-8          , 7.52566110699087243e-9          , 7.21531551071149944e-10         , 6.401402606196667e-11           , 5.32767188700169926e-12         , },
+/* x = 17.7        */  {0.0000140835638066786716        , 3.57998632592684858e-6          , 5.55922192978781495e-7          , 6.79539486589016686e-8          , 7.17431386182149918e-9          , 6.84218863777205084e-10         , 6.03994305992789989e-11         , 5.00336891513930362e-12         , },
+/* x = 17.8        */  {0.0000137310571527162162        , 3.47081214705559073e-6          , 5.35959714583491327e-7          , 6.51514543066660064e-8          , 6.84109193391037576e-9          , 6.49008326256675512e-10         , 5.70044102917565794e-11         , 4.70006657049471619e-12         , },
+/* x = 17.9        */  {0.0000133892710613778335        , 3.36554770451686491e-6          , 5.16818338254033191e-7          , 6.24787945247119432e-8          , 6.5249764624387073e-9           , 6.15772501391586361e-10         , 5.38147723648385835e-11         , 4.41633206670447487e-12         , },
+/* x = 18.0        */  {0.0000130578226419074604        , 3.26403260548395642e-6          , 4.98460120563594555e-7          , 5.99293201616145639e-8          , 6.22501022546365523e-9          , 5.84392174130661737e-10         , 5.08172907898609619e-11         , 4.15083474976843648e-12         , },
+/* x = 18.1        */  {0.0000127363446699520453        , 3.16611385011103486e-6          , 4.80849056570061294e-7          , 5.74967532931521543e-8          , 5.94029367038990349e-9          , 5.54755792350399375e-10         , 4.79996374696886448e-11         , 3.90233854573767085e-12         , },
+/* x = 18.2        */  {0.0000124244848672827708        , 3.07164545474613148e-6          , 4.63950971832715595e-7          , 5.51751649032273557e-8          , 5.66998121394770036e-9          , 5.26758947459915468e-10         , 4.53503185066718669e-11         , 3.66969498427485417e-12         , },
+/* x = 18.3        */  {0.0000121219052181370996        , 2.98048809608574863e-6          , 4.47733420907755988e-7          , 5.29589539941081925e-8          , 5.41327779254808824e-9          , 5.00303891817878732e-10         , 4.28586151658039957e-11         , 3.45183675303289423e-12         , },
+/* x = 18.4        */  {0.0000118282813201508646        , 2.89250877501723325e-6          , 4.32165591908505002e-7          , 5.08428280294272302e-8          , 5.16943564529534997e-9          , 4.75299090252922365e-10         , 4.05145291762177449e-11         , 3.24777174139932e-12            , },
+/* x = 18.5        */  {0.0000115433017679709627        , 2.80758049897504578e-6          , 4.17218216744101797e-7          , 4.88217846202012438e-8          , 4.93775131323889791e-9          , 4.51658803184572016e-10         , 3.83087320419990091e-11         , 3.05657753546253981e-12         , },
+/* x = 18.6        */  {0.0000112666675677528276        , 2.72558198171166865e-6          , 4.02863486676437911e-7          , 4.68910943704570388e-8          , 4.71756283965026755e-9          , 4.29302699031347343e-10         , 3.62325180589194042e-11         , 2.87739632909565823e-12         , },
+/* x = 18.7        */  {0.0000109980915808532586        , 2.64639735945350433e-6          , 3.89074972859228376e-7          , 4.50462848049094146e-8          , 4.50824715722324218e-9          , 4.08155493767561871e-10         , 3.4277760757270348e-11          , 2.70943021884635498e-12         , },
+/* x = 18.8        */  {0.0000107372979951288651        , 2.56991592247706298e-6          , 3.75827551545551527e-7          , 4.32831253065696884e-8          , 4.30921764912350839e-9          , 3.88146615651634182e-10         , 3.24368725126886799e-11         , 2.55193685288772188e-12         , },
+/* x = 18.9        */  {0.0000104840218223437901        , 2.49603186120136103e-6          , 3.63097333671062266e-7          , 4.15976129971999774e-8          , 4.11992187176513882e-9          , 3.69209893297511598e-10         , 3.07027670868482662e-11         , 2.40422540664358022e-12         , },
+/* x = 19.0        */  {0.0000102380084202779198        , 2.42464402594904581e-6          , 3.50861598539499561e-7          , 3.99859594981993479e-8          , 3.93983942807061847e-9          , 3.51283265398086638e-10         , 2.90688248782931384e-11         , 2.26565285986975243e-12         , },
+/* x = 19.1        */  {9.99901303820886608e-6          , 2.35565569958160923e-6          , 3.3909873135517512e-7           , 3.84445785138404487e-8          , 3.76847998078459652e-9          , 3.34308510536167776e-10         , 2.7528860680633371e-11          , 2.13562055196571032e-12         , },
+/* x = 19.2        */  {9.76680038451797291e-6          , 2.28897438226341429e-6          , 3.27788164363944136e-7          , 3.69700741827947049e-8          , 3.60538139616414488e-9          , 3.1823099563548689e-10          , 2.607709376093253e-11           , 2.01357099412332761e-12         , },
+/* x = 19.3        */  {9.54114421524279499e-6          , 2.22451158765537453e-6          , 3.1691032137981116e-7           , 3.55592301476139548e-8          , 3.45010800906472119e-9          , 3.02999441712156308e-10         , 2.47081200854928812e-11         , 1.89898491860429588e-12         , },
+/* x = 19.4        */  {9.32182694246623412e-6          , 2.16218264988222085e-6          , 3.0644656548889808e-7           , 3.42089992952981606e-8          , 3.30224900108558436e-9          , 2.88565705686636624e-10         , 2.3416886533490593e-11          , 1.79137854698719251e-12         , },
+/* x = 19.5        */  {9.10863926149608782e-6          , 2.10190654065757167e-6          , 2.96379149736074274e-7          , 3.29164941252924617e-8          , 3.16141688403507103e-9          , 2.7488457710829357e-10          , 2.21986669511187418e-11         , 1.69030106065028645e-12         , },
+/* x = 19.6        */  {8.90137979584843959e-6          , 2.0436056959886829e-6           , 2.86691170612192925e-7          , 3.16789777042407714e-8          , 3.02724608152857442e-9          , 2.6191358872960709e-10          , 2.10490399101444712e-11         , 1.59533225806708472e-12         , },
+/* x = 19.7        */  {8.6998547591043519e-6           , 1.98720585191797338e-6          , 2.77366524171658519e-7          , 3.04938551695943555e-8          , 2.89939160204365072e-9          , 2.49612839945599328e-10         , 1.99638680451547729e-11         , 1.50608038469766888e-12         , },
+/* x = 19.8        */  {8.50387763276194769e-6          , 1.93263588879136593e-6          , 2.68389864621030139e-7          , 2.93586657467480864e-8          , 2.77752779723052346e-9          , 2.37944832186577292e-10         , 1.89392788533234409e-11         , 1.42218012236858739e-12         , },
+/* x = 19.9        */  {8.31326885925540412e-6          , 1.87982768357430733e-6          , 2.59746565229600192e-7          , 2.82710752467688426e-8          , 2.6613471997152329e-9           , 2.26874315419306879e-10         , 1.79716468493444416e-11         , 1.34329072605528929e-12         , },
+/* x = 20.0        */  {8.12785554935883771e-6          , 1.82871596976517752e-6          , 2.51422681422431427e-7          , 2.72288690140032439e-8          , 2.55055943503943062e-9          , 2.16368144973676903e-10         , 1.70575769763036383e-11         , 1.26909429692099431e-12         , },
+/* x = 20.1        */  {7.94747120323672388e-6          , 1.7792382044828013e-6           , 2.43404915925235218e-7          , 2.62299452949179639e-8          , 2.44489020275778812e-9          , 2.06395147969169731e-10         , 1.61938891807560882e-11         , 1.19929418133108902e-12         , },
+/* x = 20.2        */  {7.77195544444354478e-6          , 1.73133444233005927e-6          , 2.35680585838776528e-7          , 2.52723090014467046e-8          , 2.34408032206342294e-9          , 1.96925998668392745e-10         , 1.53776040671901447e-11         , 1.13361348635866757e-12         , },
+/* x = 20.3        */  {7.60115376621396243e-6          , 1.68494721565927427e-6          , 2.28237591528237566e-7          , 2.43540658439041465e-8          , 2.24788483763572104e-9          , 1.8793310213387676e-10          , 1.46059295534384374e-11         , 1.07179370303025336e-12         , },
+/* x = 20.4        */  {7.43491728942112571e-6          , 1.64002142088723166e-6          , 2.21064387220201823e-7          , 2.34734168101885942e-8          , 2.15607218170536554e-9          , 1.79390485609622059e-10         , 1.38762484544818476e-11         , 1.01359342923614028e-12         , },
+/* x = 20.5        */  {7.27310253161488328e-6          , 1.59650421052847714e-6          , 2.14149953206669046e-7          , 2.26286529695406848e-8          , 2.06842338861003546e-9          , 1.71273697090753602e-10         , 1.31861069275247788e-11         , 9.58787184851857884e-13         , },
+/* x = 20.6        */  {7.11557118658382549e-6          , 1.55434489063501597e-6          , 2.07483769561813155e-7          , 2.18181505805637961e-8          , 1.98473135837274476e-9          , 1.63559710583395677e-10         , 1.25332037162341731e-11         , 9.07164312190288673e-13         , },
+/* x = 20.7        */  {6.9621899139153433e-6           , 1.51349482334880025e-6          , 2.01055791283080233e-7          , 2.10403664845504294e-8          , 1.90480016607465703e-9          , 1.56226837592733626e-10         , 1.19153801366637564e-11         , 8.5852795543189068e-13          , },
+/* x = 20.8        */  {6.81283013805638788e-6          , 1.47390733429051524e-6          , 1.94856424773721285e-7          , 2.02938337664050346e-8          , 1.82844441401682325e-9          , 1.49254644410418091e-10         , 1.13306107516592038e-11         , 8.12694113166926059e-13         , },
+/* x = 20.9        */  {6.66736785640445201e-6          , 1.43553762452423732e-6          , 1.8887650558899118e-7           , 1.95771576666141257e-8          , 1.75548862387193318e-9          , 1.4262387480318995e-10          , 1.07769946844871457e-11         , 7.69490758631890787e-13         , },
+/* x = 21.0        */  {6.52568345598357578e-6          , 1.39834268685260454e-6          , 1.83107277373045938e-7          , 1.88890117287952508e-8          , 1.68576666621902915e-9          , 1.36316377733050139e-10         , 1.0252747526076823e-11          , 7.2875702263553653e-13          , },
+/* x = 21.1        */  {6.3876615382840002e-6           , 1.36228122621128039e-6          , 1.77540371918058234e-7          , 1.82281341683631309e-8          , 1.61912122503229901e-9          , 1.30315039765641518e-10         , 9.75619379363129664e-12         , 6.90342434550777948e-13         , },
+/* x = 21.2        */  {6.25319075186654411e-6          , 1.32731358394476313e-6          , 1.72167790281267147e-7          , 1.75933244487893296e-8          , 1.55540329486055356e-9          , 1.24603721847909884e-10         , 9.28575990147714144e-12         , 6.54106217099964513e-13         , },
+/* x = 21.3        */  {6.12216363235394473e-6          , 1.29340166575805307e-6          , 1.66981884899602606e-7          , 1.69834400528060486e-8          , 1.49447170858773733e-9          , 1.19167200158715787e-10         , 8.83996760789743945e-12         , 6.19916630984832859e-13         , },
+/* x = 21.4        */  {5.99447644945135989e-6          , 1.26050887315039085e-6          , 1.6197534264519613e-7           , 1.63973934367195825e-8          , 1.43619269380768286e-9          , 1.13991110757014022e-10         , 8.41742790435103118e-12         , 5.8765036571111945e-13          , },
+/* x = 21.5        */  {5.87002906065705337e-6          , 1.22860003814827012e-6          , 1.57141168768524489e-7          , 1.58341491567588042e-8          , 1.38043945597909607e-9          , 1.09061897771629063e-10         , 8.01683531593827625e-12         , 5.57191973233303364e-13         , },
+/* x = 21.6        */  {5.74872477134204295e-6          , 1.1976413611652538e-6           , 1.52472671679147794e-7          , 1.52927211570926706e-8          , 1.32709178665019091e-9          , 1.04366764894648047e-10         , 7.63696258424559968e-12         , 5.28433341299102787e-13         , },
+/* x = 21.7        */  {5.63047020089424744e-6          , 1.1676003518258264e-6           , 1.4796344851701301e-7           , 1.47721702098117401e-8          , 1.27603569515715771e-9          , 9.98936299571350253e-11         , 7.27665570580218645e-12         , 5.01273203607855697e-13         , },
+/* x = 21.8        */  {5.51517515463848519e-6          , 1.13844577259963586e-6          , 1.43607371470111829e-7          , 1.4271601497785415e-8           , 1.22716306230738185e-9          , 9.56310823813396032e-11         , 6.93482930132553854e-12         , 4.75616684113328025e-13         , },
+/* x = 21.9        */  {5.40275250125860792e-6          , 1.11014758510105382e-6          , 1.39398574796920984e-7          , 1.37901623318821602e-8          , 1.18037131465761088e-9          , 9.15683433179207325e-11         , 6.6104622927303844e-12          , 4.51374873001239149e-13         , },
+/* x = 22.0        */  {5.29311805546215351e-6          , 1.08267689891704761e-6          , 1.35331442514525418e-7          , 1.33270399945771742e-8          , 1.135563118089639e-9            , 8.76952282900162535e-11         , 6.30259386653883098e-12         , 4.28464432056187915e-13         , },
+/* x = 22.1        */  {5.18619046564121898e-6          , 1.05600592283394313e-6          , 1.31400596715641288e-7          , 1.28814597024735633e-8          , 1.09264608947203636e-9          , 8.40021121783382946e-11         , 6.01031970386899166e-12         , 4.06807227302909902e-13         , },
+/* x = 22.2        */  {5.08189110629583633e-6          , 1.03010791834079484e-6          , 1.27600886479926881e-7          , 1.24526826807314668e-8          , 1.05153252527646007e-9          , 8.04798963929353515e-11         , 5.73278845860411798e-12         , 3.86329986964009126e-13         , },
+/* x = 22.3        */  {4.98014397499802335e-6          , 1.00495715529379573e-6          , 1.23927377347004846e-7          , 1.20400043428370898e-8          , 1.01213914609157074e-9          , 7.71199780878998702e-11         , 5.46919846666327061e-12         , 3.66963982921506395e-13         , },
+/* x = 22.4        */  {4.88087559368591856e-6          , 9.80528869632482686e-7          , 1.20375341320527532e-7          , 1.16427525695523554e-8          , 9.74386856046939459e-10         , 7.39142212851764536e-11         , 5.21879467051586154e-12         , 3.4864473400367215e-13          , },
+/* x = 22.5        */  {4.78401491408803355e-6          , 9.56799223044445344e-7          , 1.16940247374407081e-7          , 1.12602860812678614e-8          , 9.38200516223931496e-10         , 7.08549297827967662e-11         , 4.98086574421342944e-12         , 3.31311729542528836e-13         , },
+/* x = 22.6        */  {4.68949322708770209e-6          , 9.33745264480852453e-7          , 1.13617752434010941e-7          , 1.08919928983388514e-8          , 9.03508731190734404e-10         , 6.79348217313848984e-11         , 4.75474140525963681e-12         , 3.14908171761912491e-13         , },
+/* x = 22.7        */  {4.59724407584730697e-6          , 9.11344893430390558e-7          , 1.10403692806698951e-7          , 1.05372888843176995e-8          , 8.70243647854773845e-10         , 6.51470057706894921e-11         , 4.53978990061003017e-12         , 2.99380735661808092e-13         , },
+/* x = 22.8        */  {4.50720317252085535e-6          , 8.89576824864185032e-7          , 1.0729407603755674e-7           , 1.01956163673085327e-8          , 8.38340765878021985e-10         , 6.24849586252507834e-11         , 4.33541565499241906e-12         , 2.84679345162492571e-13         , },
+/* x = 22.9        */  {4.41930831839197923e-6          , 8.68420555768962349e-7          , 1.04285073167568213e-7          , 9.86644283496155768e-9          , 8.07738758949420209e-10         , 5.99425040651430035e-11         , 4.14105707057219039e-12         , 2.7075696436245417e-13          , },
+/* x = 23.0        */  {4.33349932728248872e-6          , 8.47856333190132206e-7          , 1.01373011372773231e-7          , 9.54925969889777893e-9          , 7.78379306254060766e-10         , 5.75137931440832923e-11         , 3.95618446775944709e-12         , 2.57569402847678662e-13         , },
+/* x = 23.1        */  {4.24971795208422762e-6          , 8.27865123710635219e-7          , 9.85543669641805839e-8          , 9.243581124610367e-9            , 7.50206933521132378e-10         , 5.51932856331025543e-11         , 3.78029815767112717e-12         , 2.45075134067228378e-13         , },
+/* x = 23.2        */  {4.16790781427419773e-6          , 8.08428584295331702e-7          , 9.58257587293562514e-8          , 8.94894292312813918e-9          , 7.23168863072147932e-10         , 5.29757325734640387e-11         , 3.61292663742544957e-12         , 2.33235125861573826e-13         , },
+/* x = 23.3        */  {4.08801433627975372e-6          , 7.89529034434413893e-7          , 9.31839415976873042e-8          , 8.6649015009505502e-9           , 6.97214872327837486e-10         , 5.08561598776218921e-11         , 3.45362490006204818e-12         , 2.2201268229631657e-13          , },
+/* x = 23.4        */  {4.00998467656714545e-6          , 7.71149429522821318e-7          , 9.06258006123372131e-8          , 8.39103286497327705e-9          , 6.72297160266491799e-10         , 4.88298529117623412e-11         , 3.30197285145259947e-12         , 2.11373296015177546e-13         , },
+/* x = 23.5        */  {3.93376766733282018e-6          , 7.53273335415939415e-7          , 8.81483451928628137e-8          , 8.12693167931987262e-9          , 6.48370221358652002e-10         , 4.68923419978902374e-11         , 3.15757382709694632e-12         , 2.01284510382796144e-13         , },
+/* x = 23.6        */  {3.85931375468271183e-6          , 7.35884904104976815e-7          , 8.5748703673360638e-8           , 7.87221037117894013e-9          , 6.25390726533018952e-10         , 4.5039388777537251e-11          , 3.02005320219174286e-12         , 1.91715790740341713e-13         , },
+/* x = 23.7        */  {3.78657494119025633e-6          , 7.18968850458357874e-7          , 8.34241181018543546e-8          , 7.62649828291866886e-9          , 6.03317410756449017e-10         , 4.32669733829970822e-11         , 2.88905708881532911e-12         , 1.82638404145502564e-13         , },
+/* x = 23.8        */  {3.71550473072909842e-6          , 7.02510429978244489e-7          , 8.11719392874290052e-8          , 7.38944086791213604e-9          , 5.82110966837048461e-10         , 4.15712823655580689e-11         , 2.76425111449650779e-12         , 1.74025307013385002e-13         , },
+/* x = 23.9        */  {3.64605807548141116e-6          , 6.86495417523924662e-7          , 7.89896220823647456e-8          , 7.16069892765823496e-9          , 5.61733945083803649e-10         , 3.99486973335234115e-11         , 2.64531927682856166e-12         , 1.65851040116500017e-13         , },
+/* x = 24.0        */  {3.57819132502745105e-6          , 6.7091008695628368e-7           , 7.68747208872258093e-8          , 6.93994788792509809e-9          , 5.42150658479006977e-10         , 3.83957842559013985e-11         , 2.53196286915545132e-12         , 1.58091630440590414e-13         , },
+/* x = 24.1        */  {3.51186217742643127e-6          , 6.55741191659915842e-7          , 7.4824885367522162e-8           , 6.7268771117760663e-9           , 5.23327093041068576e-10         , 3.69092833905287241e-11         , 2.42389947269673964e-12         , 1.50724499428789044e-13         , },
+/* x = 24.2        */  {3.44702963220302852e-6          , 6.40975945901648193e-7          , 7.283785637118436e-8            , 6.52118924746318621e-9          , 5.0523082307524335e-10          , 3.5486099798074243e-11          , 2.32086201079330782e-12         , 1.43728377179714068e-13         , },
+/* x = 24.3        */  {3.38365394515785596e-6          , 6.26602006986340419e-7          , 7.09114620366788615e-8          , 6.32259960929043598e-9          , 4.87830931028446475e-10         , 3.41232944058722381e-11         , 2.22259786124912647e-12         , 1.37083222195797909e-13         , },
+/* x = 24.4        */  {3.32169658492404855e-6          , 6.12607458172803725e-7          , 6.90436140821437076e-8          , 6.13083558965888415e-9          , 4.71097931681766098e-10         , 3.28180755878663677e-11         , 2.12886802301685449e-12         , 1.30770146306595274e-13         , },
+/* x = 24.5        */  {3.26112019119572823e-6          , 5.98980792314553013e-7          , 6.72323042664451702e-8          , 5.9456361006092448e-9           , 4.55003700430591477e-10         , 3.15677912291198753e-11         , 2.03944633372836905e-12         , 1.24771344418191143e-13         , },
+/* x = 24.6        */  {3.20188853455755594e-6          , 5.85710896191876957e-7          , 6.54756010135466394e-8          , 5.76675104327423922e-9          , 4.39521405417534147e-10         , 3.03699212453754612e-11         , 1.9541187348068779e-12          , 1.19070028764287267e-13         , },
+/* x = 24.7        */  {3.14396647784784405e-6          , 5.72787035503385652e-7          , 6.37716461920434912e-8          , 5.59394080374421568e-9          , 4.2462544329759967e-10          , 2.92220705300397137e-11         , 1.87268258111632097e-12         , 1.13650367357229333e-13         , },
+/* x = 24.8        */  {3.08731993899080718e-6          , 5.60198840486780702e-7          , 6.21186520421536883e-8          , 5.42697577393499347e-9          , 4.1029137842843378e-10          , 2.81219623027317106e-11         , 1.79494599230752855e-12         , 1.08497426358278894e-13         , },
+/* x = 24.9        */  {3.03191585523647909e-6          , 5.47936292140093181e-7          , 6.05148982428649957e-8          , 5.26563589612723716e-9          , 3.96495885290980521e-10         , 2.70674318351821665e-11         , 1.72072724321017164e-12         , 1.03597116105957042e-13         , },
+/* x = 25.0        */  {2.97772214874962694e-6          , 5.35989709016055549e-7          , 5.89587291123274608e-8          , 5.10971022992216339e-9          , 3.83216693957608117e-10         , 2.60564205318065247e-11         , 1.64985419079594201e-12         , 9.89361405594034885e-14         , },
+/* x = 25.1        */  {2.92470769349165994e-6          , 5.24349734563618942e-7          , 5.74485509349456151e-8          , 4.95899654042934061e-9          , 3.70432538435733775e-10         , 2.50869703437102885e-11         , 1.58216373540258011e-12         , 9.4501949930509742e-14          , },
+/* x = 25.2        */  {2.87284228334206398e-6          , 5.13007324991901519e-7          , 5.59828294089700143e-8          , 4.81330090656905128e-9          , 3.58123107725260705e-10         , 2.4157218496224719e-11          , 1.51750131406120736e-12         , 9.02826962941948088e-14         , },
+/* x = 25.3        */  {2.82209660140830407e-6          , 5.01953737633060745e-7          , 5.45600872087134903e-8          , 4.67243734843441297e-9          , 3.46268999437775195e-10         , 2.32653925113223501e-11         , 1.45572042391172562e-12         , 8.62671919806854304e-14         , },
+/* x = 25.4        */  {2.77244219047542986e-6          , 4.91180519781726335e-7          , 5.31789016558249881e-8          , 4.53622747271745009e-9          , 3.34851675834481303e-10         , 2.24098055074306871e-11         , 1.39668217382357457e-12         , 8.24448705671226428e-14         , },
+/* x = 25.5        */  {2.72385142454880077e-6          , 4.80679497989714754e-7          , 5.18379024943441944e-8          , 4.40450013525880584e-9          , 3.23853422148315406e-10         , 2.15888517602546106e-11         , 1.34025486246258288e-12         , 7.88057502983184896e-14         , },
+/* x = 25.6        */  {2.67629748144542359e-6          , 4.70442767795773786e-7          , 5.0535769764534347e-8           , 4.27709111983300296e-9          , 3.13257307063619591e-10         , 2.08010025092386524e-11         , 1.28631358115965751e-12         , 7.53403997781013946e-14         , },
+/* x = 25.7        */  {2.62975431639137123e-6          , 4.60462683871080114e-7          , 4.92712317707495917e-8          , 4.15384283233030533e-9          , 3.03047145234196059e-10         , 2.00448019952543403e-11         , 1.23473984004422489e-12         , 7.203990578348102e-14           , },
+/* x = 25.8        */  {2.58419663658463246e-6          , 4.50731850562136853e-7          , 4.80430631388379343e-8          , 4.03460400954249267e-9          , 2.93207461727546655e-10         , 1.93188637159897404e-11         , 1.18542121600522302e-12         , 6.88958430638935405e-14         , },
+/* x = 25.9        */  {2.53959987668453372e-6          , 4.41243112813594436e-7          , 4.68500829588120379e-8          , 3.91922944180341477e-9          , 2.83723458289652232e-10         , 1.86218668863523867e-11         , 1.13825102113555788e-12         , 6.59002459971117552e-14         , },
+/* x = 26.0        */  {2.49594017519057945e-6          , 4.3198954745434975e-7           , 4.5691153008738646e-8           , 3.80757970877620748e-9          , 2.74580981330793758e-10         , 1.79525530919768894e-11         , 1.0931279904027576e-12          , 6.304558198207277e-14           , },
+/* x = 26.1        */  {2.45319435167518255e-6          , 4.22964454831067399e-7          , 4.45651760560039916e-8          , 3.69952092771768555e-9          , 2.65766491538686966e-10         , 1.73097231246583035e-11         , 1.04995598736952595e-12         , 6.03247264569367045e-14         , },
+/* x = 26.2        */  {2.41133988483630401e-6          , 4.14161350774015813e-7          , 4.3471094232307886e-8           , 3.59492451358682426e-9          , 2.57267035030619191e-10         , 1.66922339892151942e-11         , 1.00864372686342117e-12         , 5.77309394381870206e-14         , },
+/* x = 26.3        */  {2.37035489133749598e-6          , 4.05573958880821688e-7          , 4.24078874789239115e-8          , 3.4936669503985381e-9           , 2.49070215961363557e-10         , 1.6098996071925421e-11          , 9.69104513565348685e-13         , 5.52578434835573879e-14         , },
+/* x = 26.4        */  {2.3302181054042479e-6           , 3.97196203104421186e-7          , 4.1374572058937884e-8           , 3.39562957325628943e-9          , 2.41164170508422946e-10         , 1.5528970461275895e-11          , 9.3125599555230821e-13          , 5.28994029880591952e-14         , },
+/* x = 26.5        */  {2.29090885914687524e-6          , 3.89022200632127141e-7          , 4.03701991333420739e-8          , 3.30069836052753207e-9          , 2.33537542160643997e-10         , 1.49811664123276775e-11         , 8.95019931891205004e-13         , 5.06499047284227981e-14         , },
+/* x = 26.6        */  {2.25240706358146796e-6          , 3.81046255043340285e-7          , 3.93938533980191231e-8          , 3.20876373565472669e-9          , 2.26179458240458146e-10         , 1.44546389465223186e-11         , 8.603219734378249e-13           , 4.85039395768866773e-14         , },
+/* x = 26.7        */  {2.2146931903216334e-6           , 3.73262849734010739e-7          , 3.84446517787976689e-8          , 3.11972037812176121e-9          , 2.19079507593969578e-10         , 1.39484865792466432e-11         , 8.27091456048565551e-13         , 4.64563853105018019e-14         , },
+/* x = 26.8        */  {2.17774825391493054e-6          , 3.65666641596505491e-7          , 3.75217421819018642e-8          , 3.03346704312116886e-9          , 2.12227719386835071e-10         , 1.34618491679334805e-11         , 7.95261205462473393e-13         , 4.45023904469913652e-14         , },
+/* x = 26.9        */  {2.14155379479900017e-6          , 3.58252454944059737e-7          , 3.66243022972497154e-8          , 2.9499063894916508e-9           , 2.05614542947382936e-10         , 1.29939058739071428e-11         , 7.64767353157800533e-13         , 4.26373590427443645e-14         , },
+/* x = 27.0        */  {2.10609186285345297e-6          , 3.51015275669486299e-7          , 3.57515384521808588e-8          , 2.86894481551816602e-9          , 1.99230828601711731e-10         , 1.25438732315867048e-11         , 7.3554916253089372e-13          , 4.08569363927490225e-14         , },
+/* x = 27.1        */  {2.07134500152458624e-6          , 3.43950245628289201e-7          , 3.49026845133134661e-8          , 2.79049230220832914e-9          , 1.9306780944860712e-10          , 1.21110033190390873e-11         , 7.07548864785968572e-13         , 3.91569955762108424e-14         , },
+/* x = 27.2        */  {2.03729623250096281e-6          , 3.37052657236776138e-7          , 3.40770008343427769e-8          , 2.71446226367913236e-9          , 1.871170840250295e-10           , 1.16945820242292646e-11         , 6.80711503962401105e-13         , 3.75336247952705849e-14         , },
+/* x = 27.3        */  {2.00392904091880451e-6          , 3.30317948276191337e-7          , 3.32737732477006512e-8          , 2.64077140430715306e-9          , 1.81370599815667115e-10         , 1.12939274016481371e-11         , 6.54984790561766486e-13         , 3.59831154576585876e-14         , },
+/* x = 27.4        */  {1.97122736107703019e-6          , 3.23741696894296147e-7          , 3.24923120980968503e-8          , 2.56933958231348929e-9          , 1.75820637562630177e-10         , 1.09083881143111746e-11         , 6.30318963270140165e-13         , 3.45019509573111875e-14         , },
+/* x = 27.5        */  {1.93917556264260599e-6          , 3.17319616796210925e-7          , 3.17319513160587921e-8          , 2.50008967947174409e-9          , 1.70459796333790851e-10         , 1.05373419564141853e-11         , 6.06666658302305508e-13         , 3.30867961099488273e-14         , },
+/* x = 27.6        */  {1.9077584373276756e-6           , 3.11047552616699194e-7          , 3.09920475296775928e-8          , 2.43294747664351607e-9          , 1.65280979310561259e-10         , 1.0180194452207745e-11          , 5.83982785923630433e-13         , 3.17344872033888366e-14         , },
+/* x = 27.7        */  {1.87696118602070263e-6          , 3.04921475466424825e-7          , 3.02719792128545553e-8          , 2.36784153486110136e-9          , 1.60277380258055638e-10         , 9.83637752691010148e-12         , 5.62224413732618472e-13         , 3.04420226249528878e-14         , },
+/* x = 27.8        */  {1.84676940635458727e-6          , 2.98937478645045851e-7          , 2.95711458684241744e-8          , 2.30470308169152389e-9          , 1.55442470642611651e-10         , 9.50534824572083175e-12         , 5.41350656312633204e-13         , 2.92065540307427275e-14         , },
+/* x = 27.9        */  {1.81716908069541727e-6          , 2.9309177351432552e-7           , 2.8888967244607431e-8           , 2.24346590262963499e-9          , 1.5076998736355715e-10          , 9.18658761722519481e-12         , 5.21322570885156094e-13         , 2.80253780238100472e-14         , },
+/* x = 28.0        */  {1.78814656453617955e-6          , 2.87380685524742952e-7          , 2.8224882583322873e-8           , 2.18406623728090477e-9          , 1.46253921067909773e-10         , 8.87959945769293059e-12         , 5.02103058619275489e-13         , 2.68959283103484672e-14         , },
+/* x = 28.1        */  {1.75968857528039675e-6          , 2.81800650389373251e-7          , 2.75783498989529516e-8          , 2.12644268010671037e-9          , 1.41888505018394077e-10         , 8.58390931297609433e-12         , 4.83656771273020263e-13         , 2.58157683049979638e-14         , },
+/* x = 28.2        */  {1.73178218140126134e-6          , 2.76348210399080699e-7          , 2.69488452862294949e-8          , 2.07053608551644859e-9          , 1.37668204486761015e-10         , 8.29906343489920659e-12         , 4.65950022861739737e-13         , 2.47825841581843165e-14         , },
+/* x = 28.3        */  {1.70441479196242335e-6          , 2.71020010873329535e-7          , 2.63358622559652514e-8          , 2.01628947710170231e-9          , 1.33587706645903105e-10         , 8.02462780921231395e-12         , 4.48950706067080028e-13         , 2.37941781801272489e-14         , },
+/* x = 28.4        */  {1.67757414648714392e-6          , 2.65812796741165413e-7          , 2.57389110974183076e-8          , 1.96364796081800527e-9          , 1.29641910935681247e-10         , 7.76018723234421205e-12         , 4.32628213117297637e-13         , 2.2848462637749207e-14          , },
+/* x = 28.5        */  {1.65124830516306032e-6          , 2.60723409247157491e-7          , 2.515751826613304e-8            , 1.91255864192951229e-9          , 1.25825919878720956e-10         , 7.50534443434975325e-12         , 4.1695336088576022e-13          , 2.19434539022098878e-14         , },
+/* x = 28.6        */  {1.62542563937031728e-6          , 2.55748782777316993e-7          , 2.45912257961552744e-8          , 1.86297054554112356e-9          , 1.22135030323701625e-10         , 7.25971924559247276e-12         , 4.01898319969583043e-13         , 2.10772669261868886e-14         , },
+/* x = 28.7        */  {1.60009482252130723e-6          , 2.50885941800223299e-7          , 2.40395907355706317e-8          , 1.8148345405513608e-9           , 1.18564725094856786e-10         , 7.02294780484230613e-12         , 3.87436547524503822e-13         , 2.02481100313268547e-14         , },
+/* x = 28.8        */  {1.57524482120072851e-6          , 2.46131997918793973e-7          , 2.35021846043638017e-8          , 1.76810326686757838e-9          , 1.15110665027530599e-10         , 6.79468180659848525e-12         , 3.73542723645370178e-13         , 1.94542799875104812e-14         , },
+/* x = 28.9        */  {1.55086488659511718e-6          , 2.41484147028330877e-7          , 2.29785928736428181e-8          , 1.72273106573293942e-9          , 1.11768681370699733e-10         , 6.57458778557030162e-12         , 3.60192691094060188e-13         , 1.86941573667144201e-14         , },
+/* x = 29.0        */  {1.52694454620143538e-6          , 2.3693966657666127e-7           , 2.24684144653164589e-8          , 1.67867391302202067e-9          , 1.0853476853837437e-10          , 6.36234643636379384e-12         , 3.47363398188331233e-13         , 1.79662021553189332e-14         , },
+/* x = 29.1        */  {1.50347359580470836e-6          , 2.32495912922370954e-7          , 2.19712612713547665e-8          , 1.63588935536895263e-9          , 1.05405077192740596e-10         , 6.15765196653099818e-12         , 3.3503284467604534e-13          , 1.72689496097069956e-14         , },
+/* x = 29.2        */  {1.48044209171509395e-6          , 2.28150318787296515e-7          , 2.14867576918025048e-8          , 1.59433644899867585e-9          , 1.02375907642802313e-10         , 5.96021148124061615e-12         , 3.23180030429497224e-13         , 1.66010063409331257e-14         , },
+/* x = 29.3        */  {1.45784034325514351e-6          , 2.23900390799605899e-7          , 2.10145401907532338e-8          , 1.5539757011382201e-9           , 9.94437035431270757e-11         , 5.76974439792519298e-12         , 3.11784906804217626e-13         , 1.59610466151128197e-14         , },
+/* x = 29.4        */  {1.43565890548837242e-6          , 2.19743707123951435e-7          , 2.05542568695277075e-8          , 1.51476901389090989e-9          , 9.66050458780998479e-11         , 5.58598188935053189e-12         , 3.00828330515679984e-13         , 1.53478088570001096e-14         , },
+/* x = 29.5        */  {1.41388857218060273e-6          , 2.15677915175327191e-7          , 2.01055670563345659e-8          , 1.47667963046208586e-9          , 9.38566472178442149e-11         , 5.4086663536384351e-12          , 2.90292019895840698e-13         , 1.47600923449851768e-14         , },
+/* x = 29.6        */  {1.39252036898586978e-6          , 2.11700729413403673e-7          , 1.96681409117239007e-8          , 1.43967208363032336e-9          , 9.11953462326847837e-11         , 5.23755090985428357e-12         , 2.80158513399427675e-13         , 1.41967540864596241e-14         , },
+/* x = 29.7        */  {1.37154554684900088e-6          , 2.07809929214247644e-7          , 1.92416590491753052e-8          , 1.40371214636324386e-9          , 8.86181024536995811e-11         , 5.07239891784674585e-12         , 2.70411130237391412e-13         , 1.3656705863167166e-14          , },
+/* x = 29.8        */  {1.35095557561727681e-6          , 2.04003356816463528e-7          , 1.88258121701915585e-8          , 1.36876678448186655e-9          , 8.61219912675496017e-11         , 4.91298352109832185e-12         , 2.61033933021978332e-13         , 1.31389114367851574e-14         , },
+/* x = 29.9        */  {1.33074213785387691e-6          , 2.00278915338915795e-7          , 1.84203007132972079e-8          , 1.33480411128205053e-9          , 8.37041991343763051e-11         , 4.75908721141274494e-12         , 2.5201169231450631e-13          , 1.26423839055703556e-14         , },
+/* x = 30.0        */  {1.31089712284608682e-6          , 1.96634566867309194e-7          , 1.80248345163680954e-8          , 1.30179334402594664e-9          , 8.13620190181288261e-11         , 4.61050141432873231e-12         , 2.43329852973144011e-13         , 1.21661832034532045e-14         , },
+/* x = 30.1        */  {1.29141262080151456e-6          , 1.93068330607015896e-7          , 1.76391324917433621e-8          , 1.26970476222052424e-9          , 7.90928460192228132e-11         , 4.46702609420941957e-12         , 2.34974502203844035e-13         , 1.17094137334811904e-14         , },
+/* x = 30.2        */  {1.27228091722581633e-6          , 1.89578281099645861e-7          , 1.72629223135957571e-8          , 1.23850966760417407e-9          , 7.68941731999438902e-11         , 4.32846937801325941e-12         , 2.26932339223078286e-13         , 1.12712221279957055e-14         , },
+/* x = 30.3        */  {1.25349448747567854e-6          , 1.86162546500959255e-7          , 1.68959401170592065e-8          , 1.20818034576612594e-9          , 7.47635875934924086e-11         , 4.19464719680540798e-12         , 2.19190646446194406e-13         , 1.08507951283804925e-14         , },
+/* x = 30.4        */  {1.23504599148103783e-6          , 1.82819306917817729e-7          , 1.65379302086346417e-8          , 1.17869002932696845e-9          , 7.26987663880239637e-11         , 4.06538294411885754e-12         , 2.11737262120074987e-13         , 1.04473575776450933e-14         , },
+/* x = 30.5        */  {1.21692826863074659e-6          , 1.79546792801965032e-7          , 1.61886447874160904e-8          , 1.15001286261192903e-9          , 7.06974732774735561e-11         , 3.94050715032197876e-12         , 2.04560554323355766e-13         , 1.00601705195056364e-14         , },
+/* x = 30.6        */  {1.19913433281610745e-6          , 1.76343283398517048e-7          , 1.58478436766990507e-8          , 1.12212386775177452e-9          , 6.87575549713616504e-11         , 3.8198571721938778e-12          , 1.9764939626176304e-13          , 9.68852939799947596e-15         , },
+/* x = 30.7        */  {1.18165736762690859e-6          , 1.73207105247126985e-7          , 1.55152940655522507e-8          , 1.09499891214923472e-9          , 6.68769378561690265e-11         , 3.70327689695121001e-12         , 1.90993142790180767e-13         , 9.33176235202124286e-15         , },
+/* x = 30.8        */  {1.16449072169479035e-6          , 1.70136630733873422e-7          , 1.51907702599520884e-8          , 1.06861467725174228e-9          , 6.50536248012354256e-11         , 3.59061646000997047e-12         , 1.84581608096870058e-13         , 8.98922859949727951e-15         , },
+/* x = 30.9        */  {1.14762790417896528e-6          , 1.67130276691997276e-7          , 1.4874053443096393e-8           , 1.04294862857403008e-9          , 6.32856921024857354e-11         , 3.48173197580344064e-12         , 1.78405044488852491e-13         , 8.66031690622458983e-15         , },
+/* x = 31.0        */  {1.13106258038949737e-6          , 1.64186503049688795e-7          , 1.45649314445306908e-8          , 1.01797898691673891e-9          , 6.15712865576178881e-11         , 3.37648528101303947e-12         , 1.72454122220847789e-13         , 8.34444413469064858e-15         , },
+/* x = 31.1        */  {1.11478856754352231e-6          , 1.61303811523197425e-7          , 1.4263198517735938e-8           , 9.93684700729671498e-10         , 5.99086226666997924e-11         , 3.27474368960242906e-12         , 1.66719910313338547e-13         , 8.04105386846288878e-15         , },
+/* x = 31.2        */  {1.09879983064995995e-6          , 1.58480744353606102e-7          , 1.39686551258417337e-8          , 9.70045419570689963e-10         , 5.82959799524194324e-11         , 3.17637975907697298e-12         , 1.6119385830833208e-13          , 7.74961510799255423e-15         , },
+/* x = 31.3        */  {1.0830904785184328e-6           , 1.55715883085677278e-7          , 1.36811077351433897e-8          , 9.47041468613499654e-10         , 5.67317003945136492e-11         , 3.08127106742064783e-12         , 1.55867778914213142e-13         , 7.46962103391792293e-15         , },
+/* x = 31.4        */  {1.06765475988826035e-6          , 1.53007847387240908e-7          , 1.34003686161149351e-8          , 9.24653824159697914e-10         , 5.52141859731679101e-11         , 2.98930000019086638e-12         , 1.50733831493741974e-13         , 7.20058783417766271e-15         , },
+/* x = 31.5        */  {1.05248705967354886e-6          , 1.50355293907654931e-7          , 1.31262556516232153e-8          , 9.02864090112498626e-10         , 5.37418963164323809e-11         , 2.90035354727847817e-12         , 1.45784506351759563e-13         , 6.94205359145719365e-15         , },
+/* x = 31.6        */  {1.03758189532054068e-6          , 1.47756915173926443e-7          , 1.28585921520607273e-8          , 8.81654475371476709e-10         , 5.23133464469395851e-11         , 2.81432310886556033e-12         , 1.41012609781525501e-13         , 6.69357722769026402e-15         , },
+/* x = 31.7        */  {1.02293391327352503e-6          , 1.45211438523137064e-7          , 1.25972066771267531e-8          , 8.61007772109516758e-10         , 5.09271046234365807e-11         , 2.73110431013758121e-12         , 1.36411249830842055e-13         , 6.45473750252530177e-15         , },
+/* x = 31.8        */  {1.00853788554574567e-6          , 1.42717625069868936e-7          , 1.23419328639977324e-8          , 8.40907334894901233e-10         , 4.95817902728605736e-11         , 2.65059682432919059e-12         , 1.31973822751219057e-13         , 6.22513206284223285e-15         , },
+/* x = 31.9        */  {9.94388706391868272e-7          , 1.40274268707378479e-7          , 1.20926092616386819e-8          , 8.21337060623140706e-10         , 4.82760720088918475e-11         , 2.57270420370433741e-12         , 1.27694000095315716e-13         , 6.00437654057106495e-15         , },
+/* x = 32.0        */  {9.80481389078693443e-7          , 1.37880195141313679e-7          , 1.18490791710178509e-8          , 8.02281369224735872e-10         , 4.70086657331124215e-11         , 2.49733371809170818e-12         , 1.23565716429764444e-13         , 5.79210369621927485e-15         , },
+/* x = 32.1        */  {9.66811062750919254e-7          , 1.35534260954817172e-7          , 1.16111904909967137e-8          , 7.83725185116572425e-10         , 4.57783328150835029e-11         , 2.42439620061568174e-12         , 1.19583157632245097e-13         , 5.5879626056615266e-15          , },
+/* x = 32.2        */  {9.53372969388870734e-7          , 1.33235352703902093e-7          , 1.13787955696768729e-8          , 7.65653919366089281e-10         , 4.45838783478301231e-11         , 2.35380590028117147e-12         , 1.15740749743341827e-13         , 5.39161788788305761e-15         , },
+/* x = 32.3        */  {9.40162460855222907e-7          , 1.30982386042030365e-7          , 1.11517510609945002e-8          , 7.48053452538731725e-10         , 4.3424149475387814e-11          , 2.2854803410879308e-12          , 1.12033148345284953e-13         , 5.20274897149773942e-15         , },
+/* x = 32.4        */  {9.27174996027848936e-7          , 1.28774304872864142e-7          , 1.09299177863615859e-8          , 7.30910118200507197e-10         , 4.22980337892242888e-11         , 2.21934018736618775e-12         , 1.08455228441162427e-13         , 5.02104939798385149e-15         , },
+/* x = 32.5        */  {9.1440613801602587e-7           , 1.26610080530200433e-7          , 1.07131606011615391e-8          , 7.14210687048705975e-10         , 4.12044577904992645e-11         , 2.15530911504089932e-12         , 1.05002074809584728e-13         , 4.84622615969546971e-15         , },
+/* x = 32.6        */  {9.01851551457327601e-7          , 1.2448871098413661e-7           , 1.05013482659145805e-8          , 6.97942351645034965e-10         , 4.01423854152682337e-11         , 2.09331368854652666e-12         , 1.01668972811108257e-13         , 4.67799907081550688e-15         , },
+/* x = 32.7        */  {8.89506999892628048e-7          , 1.22409220072550672e-7          , 1.02943533219359243e-8          , 6.82092711726543156e-10         , 3.91108166198715517e-11         , 2.03328324312807042e-12         , 9.84513996239701005e-14         , 4.51610016951826203e-15         , },
+/* x = 32.8        */  {8.77368343216727445e-7          , 1.20370656757014796e-7          , 1.00920519713169693e-8          , 6.6664976007079475e-10          , 3.81087860238790269e-11         , 1.9751497722772174e-12          , 9.53450158878656015e-14         , 4.360273149705225e-15           , },
+/* x = 32.9        */  {8.6543153520220108e-7           , 1.18372094402293985e-7          , 9.89432396106662889e-9          , 6.51601868892773234e-10         , 3.71353616080826449e-11         , 1.91884782006487347e-12         , 9.2345657735613672e-14          , 4.21027282076820249e-15         , },
+/* x = 33.0        */  {8.53692621094153064e-7          , 1.16412630078613507e-7          , 9.70105247125653354e-9          , 6.36937776751979108e-10         , 3.61896434651464486e-11         , 1.86431437814313206e-12         , 8.94493291936068182e-14         , 4.06586459391892132e-15         , },
+/* x = 33.1        */  {8.42147735273637774e-7          , 1.14491383885909448e-7          , 9.51212400702016176e-9          , 6.22646575949118065e-10         , 3.52707626006332549e-11         , 1.81148878720088841e-12         , 8.66521949329371248e-14         , 3.92682399370443961e-15         , },
+/* x = 33.2        */  {8.30793098987588715e-7          , 1.126074982993061e-7            , 9.32742829426200108e-9          , 6.08717700392667334e-10         , 3.43778797822331187e-11         , 1.76031264266789036e-12         , 8.39505733540291986e-14         , 3.79293619340325408e-15         , },
+/* x = 33.3        */  {8.19625018143168757e-7          , 1.10760137535092058e-7          , 9.14685817893862534e-9          , 5.95140913916457744e-10         , 3.35101844351185264e-11         , 1.71072970447204885e-12         , 8.13409299884994786e-14         , 3.6639955730682103e-15          , },
+/* x = 33.4        */  {8.08639881164527144e-7          , 1.08948486936494005e-7          , 8.97030952977911135e-9          , 5.8190629903021986e-10          , 3.26668935814464896e-11         , 1.66268581066434537e-12         , 7.88198712028013179e-14         , 3.53980529904946258e-15         , },
+/* x = 33.5        */  {7.97834156910017471e-7          , 1.07171752378573134e-7          , 8.79768114431751629e-9          , 5.6900424608581626e-10          , 3.18472508221182688e-11         , 1.61612879473469733e-12         , 7.63841381890095938e-14         , 3.42017692389403561e-15         , },
+/* x = 33.6        */  {7.87204392647997085e-7          , 1.0542915969159409e-7           , 8.62887465811520879e-9          , 5.5642544284262029e-10          , 3.10505253589936126e-11         , 1.57100840645070266e-12         , 7.40306012288499173e-14         , 3.30493000557824039e-15         , },
+/* x = 33.7        */  {7.76747212089392139e-7          , 1.0371995410224028e-7           , 8.46379445705570242e-9          , 5.44160864416206408e-10         , 3.02760110558383933e-11         , 1.52727623605930672e-12         , 7.17562542177882384e-14         , 3.19389174508550724e-15         , },
+/* x = 33.8        */  {7.66459313475274033e-7          , 1.02043399692072394e-7          , 8.3023475925992888e-9           , 5.32201763595189899e-10         , 2.95230255363625527e-11         , 1.48488564169914151e-12         , 6.95582094366690732e-14         , 3.0868966413953193e-15          , },
+/* x = 33.9        */  {7.5633746771775214e-7           , 1.00398778872649078e-7          , 8.14444369988921907e-9          , 5.2053966151169602e-10          , 2.8790909317779552e-11          , 1.44379167987860158e-12         , 6.74336925590268931e-14         , 2.98378616299905136e-15         , },
+/* x = 34.0        */  {7.46378516592544764e-7          , 9.87853918767499183e-8          , 7.9899949186054461e-9           , 5.0916633865155188e-10          , 2.80790249783892388e-11         , 1.40395103888166396e-12         , 6.53800378827974321e-14         , 2.88440843510581709e-15         , },
+/* x = 34.1        */  {7.36579370981645255e-7          , 9.7202556265161273e-8           , 7.8389158164660229e-9           , 4.98073826190880047e-10         , 2.73867563577533751e-11         , 1.36532197497005096e-12         , 6.33946837757257301e-14         , 2.78861794174606983e-15         , },
+/* x = 34.2        */  {7.2693700916455313e-7           , 9.5649606448505097e-8           , 7.69112331528016466e-9          , 4.87254397646332213e-10         , 2.67135077880971968e-11         , 1.32786425125659301e-12         , 6.14751683243074075e-14         , 2.69627524202284397e-15         , },
+/* x = 34.3        */  {7.17448475156591119e-7          , 9.41258932236097008e-8          , 7.5465366194607297e-9           , 4.76700560826735611e-10         , 2.60587033556314446e-11         , 1.29153907913059217e-12         , 5.96191251766106955e-14         , 2.60724669980031194e-15         , },
+/* x = 34.4        */  {7.08110877092878234e-7          , 9.26307833239394902e-8          , 7.40507714690746521e-9          , 4.6640505007443536e-10          , 2.54217861905474829e-11         , 1.25630906212163206e-12         , 5.78242795698106904e-14         , 2.52140422615690438e-15         , },
+/* x = 34.5        */  {6.98921385656576387e-7          , 9.11636589836181082e-8          , 7.26666846217580564e-9          , 4.56360818785103708e-10         , 2.4802217784493552e-11          , 1.22213814209364221e-12         , 5.6088444533725696e-14          , 2.43862503396572594e-15         , },
+/* x = 34.6        */  {6.89877232550073791e-7          , 8.97239175145961161e-8          , 7.13123621184930915e-9          , 4.46561032195253245e-10         , 2.41994773343930044e-11         , 1.18899154766611938e-12         , 5.4409517262079756e-14          , 2.35879140399851902e-15         , },
+/* x = 34.7        */  {6.8097570900781247e-7           , 8.83109708965304105e-8          , 6.99870806203697966e-9          , 4.36999060427136724e-10         , 2.36130611115157097e-11         , 1.15683574476424957e-12         , 5.27854756436269186e-14         , 2.28179046198109608e-15         , },
+/* x = 34.8        */  {6.72214164349509684e-7          , 8.69242453789580237e-8          , 6.86901363791975259e-9          , 4.27668471781141924e-10         , 2.30424818547617774e-11         , 1.12563838920427503e-12         , 5.12143749456626543e-14         , 2.20751396605808474e-15         , },
+/* x = 34.9        */  {6.63590004572564094e-7          , 8.55631810953618005e-8          , 6.74208446527332835e-9          , 4.18563026266197157e-10         , 2.24872681871624739e-11         , 1.09536828122482349e-12         , 4.96943446428173692e-14         , 2.13585810415310975e-15         , },
+/* x = 35.0        */  {6.55100690982476998e-7          , 8.4227231688739733e-8           , 6.61785391389732419e-9          , 4.09676669359092269e-10         , 2.19469640546468025e-11         , 1.06599532187907374e-12         , 4.82235853843772244e-14         , 2.06672330073726649e-15         , },
+/* x = 35.1        */  {6.46743738860157109e-7          , 8.29158639483034676e-8          , 6.49625714288338737e-9          , 4.010035259839922e-10           , 2.14211281861637827e-11         , 1.03749047120658433e-12         , 4.68003660937095461e-14         , 2.00001403254401079e-15         , },
+/* x = 35.2        */  {6.38516716165014127e-7          , 8.16285574569447137e-8          , 6.37723104765747551e-9          , 3.92537894703776193e-10         , 2.0909333574290103e-11          , 1.00982570810737011e-12         , 4.54230211936849851e-14         , 1.935638652792483e-15           , },
+/* x = 35.3        */  {6.30417242272781858e-7          , 8.03648042491209941e-8          , 6.26071420873396882e-9          , 3.84274242115176231e-10         , 2.04111669754906296e-11         , 9.82973991844386088e-13         , 4.40899479522871879e-14         , 1.87350922350387927e-15         , },
+/* x = 35.4        */  {6.22442986747045844e-7          , 7.91241084788244065e-8          , 6.1466468421216374e-9           , 3.76207197440014022e-10         , 1.99262284292353144e-11         , 9.56909225103977472e-13         , 4.27996039428839639e-14         , 1.81354135551685343e-15         , },
+/* x = 35.5        */  {6.14591668143483549e-7          , 7.79059860973088349e-8          , 6.03497075132375015e-9          , 3.68331547305147514e-10         , 1.94541307952104539e-11         , 9.31606218547089482e-13         , 4.15505046139026058e-14         , 1.75565405582814831e-15         , },
+/* x = 35.6        */  {6.06861052845856991e-7          , 7.67099645402623704e-8          , 5.92562928087678322e-9          , 3.60642230704036094e-10         , 1.89944993078950749e-11         , 9.0704065678710745e-13          , 4.03412209629069229e-14         , 1.6997695819037815e-15          , },
+/* x = 35.7        */  {5.99248953932828514e-7          , 7.55355824241226021e-8          , 5.81856727137427025e-9          , 3.53134334133119034e-10         , 1.85469711478045523e-11         , 8.83189065733126188e-13         , 3.91703773103154282e-14         , 1.64581330262420828e-15         , },
+/* x = 35.8        */  {5.91753230074700094e-7          , 7.43823892512429286e-8          , 5.71373101592433698e-9          , 3.45803086896474868e-10         , 1.81111950287334613e-11         , 8.60028781240234399e-13         , 3.80366491682296746e-14         , 1.59371356554401224e-15         , },
+/* x = 35.9        */  {5.84371784459205241e-7          , 7.32499451236281372e-8          , 5.61106821799138295e-9          , 3.38643856572490806e-10         , 1.76868308003582027e-11         , 8.37537919011052592e-13         , 3.69387612000596241e-14         , 1.54340157016288615e-15         , },
+/* x = 36.0        */  {5.77102563745510254e-7          , 7.21378204649672223e-8          , 5.5105279505742164e-9           , 3.31652144636521628e-10         , 1.72735490655871895e-11         , 8.1569534569528823e-13          , 3.5875485266839779e-14          , 1.49481124692001332e-15         , },
+/* x = 36.1        */  {5.69943557045608317e-7          , 7.10455957507007722e-8          , 5.41206061667471876e-9          , 3.24823582233757117e-10         , 1.6871030812072389e-11          , 7.94480651136476203e-13         , 3.48456385563261939e-14         , 1.44787914163849089e-15         , },
+/* x = 36.2        */  {5.6289279493231573e-7           , 6.99728612458692693e-8          , 5.31561791101281419e-9          , 3.18153926096746551e-10         , 1.64789670573208576e-11         , 7.73874121717362173e-13         , 3.38480817911509821e-14         , 1.40254430516019767e-15         , },
+/* x = 36.3        */  {5.55948348473104507e-7          , 6.8919216750497329e-8           , 5.22115278294515249e-9          , 3.11639054602248593e-10         , 1.60970585068686271e-11         , 7.53856714757566833e-13         , 3.28817175124880392e-14         , 1.35874818792454185e-15         , },
+/* x = 36.4        */  {5.49108328289029653e-7          , 6.78842713522772612e-8          , 5.12861940054648083e-9          , 3.0527496396228534e-10          , 1.57250152250019549e-11         , 7.34410033919245942e-13         , 3.19454884358519481e-14         , 1.31643453925686928e-15         , },
+/* x = 36.5        */  {5.42370883638032666e-7          , 6.68676431863233949e-8          , 5.03797311581418611e-9          , 2.99057764544480976e-10         , 1.53625563175326008e-11         , 7.15516305578439485e-13         , 3.1038375875811849e-14          , 1.27554931114400933e-15         , },
+},
+/* n = 8 */
+{
+/* x = 0.0         */  {0.0588235294117647059           , 0.0526315789473684211           , 0.0238095238095238095           , 0.0072463768115942029           , 0.00166666666666666667          , 0.000308641975308641975         , 0.00004789272030651341          , 6.40040962621607783e-6          , },
+/* x = 0.1         */  {0.0537913840058185382           , 0.0480805503147778837           , 0.0217325948620505414           , 0.00660963847513597137          , 0.00151931073600093239          , 0.00028120931519166097          , 0.0000436164110070970025        , 5.82663074625579334e-6          , },
+/* x = 0.2         */  {0.049194194446507084            , 0.0439263812815964213           , 0.0198381140904376824           , 0.00602918280016700174          , 0.00138504930677753972          , 0.000256225645594624453         , 0.0000397233980854214151        , 5.30446376270698793e-6          , },
+/* x = 0.3         */  {0.044994044258324985            , 0.0401342195163447976           , 0.0181099584406944064           , 0.00550000939651311187          , 0.00126271361368691473          , 0.000233471493478207925         , 0.0000361792087677680806        , 4.82925211285702968e-6          , },
+/* x = 0.4         */  {0.0411563458540492596           , 0.0366722918539976414           , 0.0165334369939474291           , 0.0050175641062818169           , 0.00115123961621101206          , 0.000212747121780915962         , 0.0000329524800946673881        , 4.39676050124398857e-6          , },
+/* x = 0.5         */  {0.0376495465034909974           , 0.0335116308467135329           , 0.015095163187461851            , 0.0045776990267940529           , 0.0010496585827060782           , 0.000193870749258445799         , 0.0000300146776176818942        , 4.00313669535010473e-6          , },
+/* x = 0.6         */  {0.0344448604084372543           , 0.030625825707839075            , 0.0137829384812149971           , 0.00417663612736158942          , 0.000957088523676142635         , 0.000176676931330966309         , 0.0000273398396045189897        , 3.64487679370536899e-6          , },
+/* x = 0.7         */  {0.031516024555400768            , 0.0279907954645739576           , 0.0125856464412484569           , 0.00381093413583638969          , 0.000872726397440841154         , 0.000161015087339852249         , 0.0000249043444342378706        , 3.31879365015266777e-6          , },
+/* x = 0.8         */  {0.0288390762262852032           , 0.0255845823310167891           , 0.0114931563037804382           , 0.00347745840016216815          , 0.000795841018363479505         , 0.000146748160942010999         , 0.0000226866990754288594        , 3.0219881668815716e-6           , },
+/* x = 0.9         */  {0.0263921502368293954           , 0.023387163491944783            , 0.0104962351684310458           , 0.00317335345680600103          , 0.000725766604134931243         , 0.000133751401575739046         , 0.0000206673467320952136        , 2.75182319505610095e-6          , },
+/* x = 1.0         */  {0.0241552941454041711           , 0.0213802796502142938           , 0.00958646804565731536          , 0.00289601806218041029          , 0.000661896904363631216         , 0.000121911256028068367         , 0.0000188284919163188792        , 2.50589980568411471e-6          , },
+/* x = 1.1         */  {0.022110299831935814            , 0.0195472788385587659           , 0.00875618505330386354          , 0.002643082465203236            , 0.000603679857953920742         , 0.000111124360129821561         , 0.0000171539413652413529        , 2.28203571502163554e-6          , },
+/* x = 1.2         */  {0.020240549989818346            , 0.0178729741311290773           , 0.00799839512067716087          , 0.00241238771918324027          , 0.000550612731511893421         , 0.000101296621510187348         , 0.0000156289593638917306        , 2.0782456684736474e-6           , },
+/* x = 1.3         */  {0.018530878203923502            , 0.0163435140125718967           , 0.00730672561631796808          , 0.00220196684944500362          , 0.000502237695342915            , 0.0000923423851658217844        , 0.0000142401361662660141        , 1.89272360482461625e-6          , },
+/* x = 1.4         */  {0.0169674414063787825           , 0.0149462642738688661           , 0.00667536736819678208          , 0.00201002770968204586          , 0.000458137797537438268         , 0.0000841836743477871535        , 0.0000129752683260039189        , 1.7238264388715526e-6           , },
+/* x = 1.5         */  {0.0155376036097120705           , 0.0136697004055584563           , 0.00609902459286347359          , 0.00183493737510200344          , 0.000417933300217314534         , 0.0000767494999498858092        , 0.0000118232498561112004        , 1.57005931528915579e-6          , },
+/* x = 1.6         */  {0.0142298299152128381           , 0.0125033095512383873           , 0.00557286929357405485          , 0.0016752079341382758           , 0.00038127834526597203          , 0.0000699752322003328368        , 0.0000107739732354266418        , 1.43006219996607586e-6          , },
+/* x = 1.7         */  {0.0130335898838054252           , 0.0114375011682228172           , 0.00509249972698512882          , 0.00152948355297258627          , 0.000347857919822086467         , 0.0000638020290208755636        , 9.81823936883258816e-6          , 1.30259768723679917e-6          , },
+/* x = 1.8         */  {0.0119392694381611979           , 0.0104635256186538405           , 0.00465390257400505993          , 0.00139652869845490643          , 0.000317385094504520246         , 0.0000581763159285315028        , 8.94767568937327574e-6          , 1.18653991250702487e-6          , },
+/* x = 1.9         */  {0.0109380905389140919           , 0.00957339998392223948          , 0.00425341848314309177          , 0.00127521741532345621          , 0.000289598509780722639         , 0.0000530493128197336204        , 8.1546616642185225e-6           , 1.08086446983331752e-6          , },
+/* x = 2.0         */  {0.0100220379453436476           , 0.00875984045855732916          , 0.00388771068449707028          , 0.00116452356301101082          , 0.000264260088113612515         , 0.0000483766033990725356        , 7.43226103346608451e-6          , 9.84639243162656385e-7          , },
+/* x = 2.1         */  {0.00918379243234758436          , 0.00801620073736357711          , 0.00355373639963405415          , 0.00106351192585906207          , 0.000241152951543339836         , 0.000044117743398853158         , 6.77416017172695825e-6          , 8.97016068248156562e-7          , },
+/* x = 2.2         */  {0.00841666989148492109          , 0.0073364158620249489           , 0.00324872079728865293          , 0.000971330118325361355         , 0.000220079526198541512         , 0.0000402359040848314847        , 6.1746120178409492e-6           , 8.17223149809935789e-7          , },
+/* x = 2.3         */  {0.00771456579482439774          , 0.00671495104113283215          , 0.00297013326725218229          , 0.000887201213832895738         , 0.000200859816903404693         , 0.0000366975478609403666        , 5.62838506843087382e-6          , 7.44558165374090392e-7          , },
+/* x = 2.4         */  {0.007071904546730802            , 0.00614675500104398556          , 0.00271566580525241898          , 0.000810417032332954647         , 0.000183329836567146162         , 0.0000334721330744361004        , 5.13071697678254102e-6          , 6.78381993460935561e-7          , },
+/* x = 2.5         */  {0.00648359329097258044          , 0.00562721746452701445          , 0.00248321332021144793          , 0.000740332027499400596         , 0.000167340176425154058         , 0.0000305318453853227331        , 4.67727234015190561e-6          , 6.18113009463214049e-7          , },
+/* x = 2.6         */  {0.00594497977900985508          , 0.00515213039016031843          , 0.00227085569218386248          , 0.000676357719788087944         , 0.000152754704458511665         , 0.0000278513533025210236        , 4.26410429643008443e-6          , 5.63221897707809922e-7          , },
+/* x = 2.7         */  {0.00545181394036121655          , 0.00471765263822054004          , 0.00207684142467041627          , 0.000617957626432336982         , 0.000139449380462289648         , 0.000025407585706209913         , 3.88761958548620187e-6          , 5.13226932877797249e-7          , },
+/* x = 2.8         */  {0.00500021282785851051          , 0.00432027775863869886          , 0.00189957274901047441          , 0.000564642643845891675         , 0.000127311177273177724         , 0.0000231795293730486152        , 3.54454676177072131e-6          , 4.67689688228270122e-7          , },
+/* x = 2.9         */  {0.00458662863966164833          , 0.00395680462376565389          , 0.00173759205130518922          , 0.000515966841908353968         , 0.000116237098613115076         , 0.0000211480447003761729        , 3.23190727318284752e-6          , 4.26211131898283634e-7          , },
+/* x = 3.0         */  {0.00420781954637541653          , 0.00362431065341968967          , 0.00158956950392584673          , 0.000471523633250600543         , 0.000106133284866103694         , 0.0000192956979886087131        , 2.94698914704358506e-6          , 3.88428076137768289e-7          , },
+/* x = 3.1         */  {0.00386082307571955447          , 0.00332012740220558385          , 0.00145429179422163605          , 0.000430942283971798606         , 0.0000969141988881075378        , 0.0000176066087893907481        , 2.6873230475063212e-6           , 3.54009947464611515e-7          , },
+/* x = 3.2         */  {0.00354293182916336988          , 0.00304181829959548012          , 0.00133065185265218025          , 0.00039388473523503529          , 0.0000885018846619053048        , 0.0000160663109619491767        , 2.45066049009312442e-6          , 3.22655848672439938e-7          , },
+/* x = 3.3         */  {0.00325167132493923022          , 0.00278715835192831943          , 0.00121763949131803513          , 0.000360042707932259348         , 0.0000808252922563875292        , 0.0000146616262027683233        , 2.23495401846156609e-6          , 2.94091886250525927e-7          , },
+/* x = 3.4         */  {0.00298477978007049199          , 0.00255411563248121828          , 0.0011143328718247844           , 0.000329135065105756504         , 0.0000738196631388990081        , 0.0000133805489252614281        , 2.03833916616032428e-6          , 2.68068739177797952e-7          , },
+/* x = 3.5         */  {0.00274018966064817637          , 0.00234083440124292823          , 0.00101989072866408111          , 0.00030090540908506919          , 0.0000674259704251252823        , 0.0000122121414675674627        , 1.85911804218255523e-6          , 2.44359447235069513e-7          , },
+/* x = 3.6         */  {0.00251601084471202911          , 0.00214561971011276863          , 0.000933545280892364108         , 0.000275119892365433605         , 0.0000615904091385259068        , 0.0000111464386988691936        , 1.69574439371983538e-6          , 2.22757398963227565e-7          , },
+/* x = 3.7         */  {0.00231051525586756099          , 0.00196692336208231699          , 0.000854595770893556186         , 0.000251565223134909202         , 0.0000562639319948090019        , 0.000010174361178542804         , 1.54681001278890647e-6          , 2.03074501198331617e-7          , },
+/* x = 3.8         */  {0.00212212283832145257          , 0.00180333110464461816          , 0.000782402574479088763         , 0.000230046848069213427         , 0.0000514018266304049187        , 9.28763609876903006e-6          , 1.41103236546894401e-6          , 1.85139513753810441e-7          , },
+/* x = 3.9         */  {0.00194938875545274464          , 0.00165355094831952184          , 0.000716381831555546575         , 0.000210387296571123241         , 0.0000469633305609541602        , 8.47872531064968763e-6          , 1.28724333345808395e-6          , 1.68796534310144597e-7          , },
+/* x = 4.0         */  {0.00179099170445613641          , 0.00151640251087751734          , 0.000656000551121165577         , 0.00019242467204905779          , 0.0000429112804897697645        , 7.74075979700799833e-6          , 1.17437896763398165e-6          , 1.5390361992716658e-7           , },
+/* x = 4.1         */  {0.00164572324908716272          , 0.001390807296673234            , 0.00060077214847745112          , 0.00017601127711974999          , 0.0000392117928900622512        , 7.06748001247571463e-6          , 1.07147016237467274e-6          , 1.40331532825733627e-7          , },
+/* x = 4.2         */  {0.00151247808118958022          , 0.00127577982854109018          , 0.000550252376297798048         , 0.000161012360794242298         , 0.0000358339730611494589        , 6.45318156370235031e-6          , 9.77634167645156875e-7          , 1.2796259920524304e-7           , },
+/* x = 4.3         */  {0.00139024512956812937          , 0.00117041955702991482          , 0.000504035614614386621         , 0.000147304976775257874         , 0.0000327496501103907698        , 5.89266575003249045e-6          , 8.92066863356643622e-7          , 1.16689670881455036e-7          , },
+/* x = 4.4         */  {0.00127809944195339103          , 0.00107390347842490981          , 0.000461751487898002574         , 0.000134776942966811874         , 0.0000299331355414374877        , 5.38119452821406386e-6          , 8.14035727327197874e-7          , 1.06415180454623251e-7          , },
+/* x = 4.5         */  {0.00117519477235203765          , 0.000985479399082481515         , 0.000423061780240269016         , 0.000123325893182388744         , 0.0000273610033376265747        , 4.91444950401262808e-6          , 7.4287343437632847e-7           , 9.7050281559423103e-8           , },
+/* x = 4.6         */  {0.00108075681204212751          , 0.000904459789139411534         , 0.000387657622229088995         , 0.000112858412843988336         , 0.0000250118896188261264        , 4.48849458936783893e-6          , 6.77972029727991621e-7          , 8.8514066513260943e-8           , },
+/* x = 4.7         */  {0.000994077007910870675         , 0.000830216173700955785         , 0.000355256925458635256         , 0.000103289251197994037         , 0.000022866310122461702         , 4.0997419962599327e-6           , 6.18777625027536181e-7          , 8.07328543751928901e-8          , },
+/* x = 4.8         */  {0.000914506916788551964         , 0.000762174014206807766         , 0.000325602042755693683         , 0.000094540603241651143         , 0.000020906493916353424         , 3.7449212680486333e-6           , 5.64785569944667686e-7          , 7.36395430601982565e-8          , },
+/* x = 4.9         */  {0.00084145304894987081          , 0.000699808036859537066         , 0.000298457634153411415         , 0.0000865414551618867161        , 0.000019116231893775622         , 3.4210510759702659e-6           , 5.15536056578701956e-7          , 6.71730197286798737e-8          , },
+/* x = 5.0         */  {0.000774372158071863069         , 0.000642637968813620508         , 0.000273608720418666127         , 0.0000792269876416418375        , 0.0000174807387310879437        , 3.12541353297274925e-6          , 4.70610117742533401e-7          , 6.12776241940204427e-8          , },
+/* x = 5.1         */  {0.000712766938691335795         , 0.000590224646297752197         , 0.000250858907555963512         , 0.0000725380318927260032        , 0.000015986527106538204         , 2.85553079935235808e-6          , 4.29625983712691186e-7          , 5.59026605665529852e-8          , },
+/* x = 5.2         */  {0.000656182095626729342         , 0.000542166462009002538         , 0.000230028767183186336         , 0.0000664205737329015018        , 0.0000146212930864568703        , 2.60914377493056872e-6          , 3.92235765226264723e-7          , 5.10019527847152587e-8          , },
+/* x = 5.3         */  {0.000604200752948992396         , 0.000498096122002137219         , 0.000210954359015584478         , 0.0000608253014425209415        , 0.0000133738116830097237        , 2.38419269095567455e-6          , 3.58122433410137493e-7          , 4.65334400773707442e-8          , },
+/* x = 5.4         */  {0.000556441172930255256         , 0.000457677684926080682         , 0.000193485882915873378         , 0.0000557071935162656467        , 0.000012233841676820954         , 2.1787994316974571e-6           , 3.2699706997004797e-7           , 4.24588087588538661e-8          , },
+/* x = 5.5         */  {0.000512553757992262336         , 0.000420603858854944793         , 0.000177486449080903821         , 0.0000510251427717256591        , 0.0000111920388789169468        , 1.99125143097431901e-6          , 2.98596363370293761e-7          , 3.87431570834716222e-8          , },
+/* x = 5.6         */  {0.000472218311040944687         , 0.000386593533144029362         , 0.000162830955948822636         , 0.000046741613591780058         , 0.0000102398770802928467        , 1.81998700274760208e-6          , 2.72680328921044136e-7          , 3.53546901819102668e-8          , },
+/* x = 5.7         */  {0.000435141531729461083         , 0.000355389524730663653         , 0.000149405066333830554         , 0.0000428223293647603876        , 9.36957600462595292e-6          , 1.66358197756162207e-6          , 2.49030232678896531e-7          , 3.22644423709288292e-8          , },
+/* x = 5.8         */  {0.000401054728157989241         , 0.000326756520112931237         , 0.000137104273136632705         , 0.0000392359874477407882        , 8.57403564084918828e-6          , 1.52073752811328895e-6          , 2.27446700875388106e-7          , 2.94460243723024236e-8          , },
+/* x = 5.9         */  {0.000369711725311338899         , 0.000300479195891897631         , 0.000125833046744817193         , 0.0000359539992162987695        , 7.84677638799739037e-6          , 1.39026907770484816e-6          , 2.07747998233914641e-7          , 2.68753931994176835e-8          , },
+/* x = 6.0         */  {0.000340886953170419857         , 0.000276360502269231596         , 0.000115504056935376746         , 0.0000329502529808259015        , 7.18188449544311105e-6          , 1.27109619486076959e-6          , 1.89768460032700814e-7          , 2.45306426722294078e-8          , },
+/* x = 6.1         */  {0.00031437369892470033          , 0.000254220095265090422         , 0.000106037462727496538         , 0.0000302008977468449746        , 6.57396232779646181e-6          , 1.16223338606016025e-6          , 1.73357064133551543e-7          , 2.23918127052880845e-8          , },
+/* x = 6.2         */  {0.000289982509072761478         , 0.000233892904672678288         , 0.0000973602642131110122        , 0.0000276841459765447332        , 6.01808302576424333e-6          , 1.06278170642662072e-6          , 1.5837613043531774e-7           , 2.04407156809027784e-8          , },
+/* x = 6.3         */  {0.000267539728438488837         , 0.000215227825906778047         , 0.0000894057109206300029        , 0.0000253800936724544087        , 5.50974917251918511e-6          , 9.71921115398547777e-7          , 1.44700136338446646e-7          , 1.86607783717223976e-8          , },
+/* x = 6.4         */  {0.000246886164261906063         , 0.000198086524943630357         , 0.0000821127617482438395        , 0.0000232705562532852443        , 5.04485510995907945e-6          , 8.88903510938485138e-7          , 1.32214637832764469e-7          , 1.70368980154728984e-8          , },
+/* x = 6.5         */  {0.000227875864555778201         , 0.000182342346497742844         , 0.0000754255919415208304        , 0.0000213389188277731081        , 4.61965258094588611e-6          , 8.13046381788435397e-7          , 1.2081528675394853e-7           , 1.55553112705261425e-8          , },
+/* x = 6.6         */  {0.00021037500086066289          , 0.000167879316445710281         , 0.0000692931429894167396        , 0.0000195699995960556773        , 4.23071940248671103e-6          , 7.43727022692003285e-7          , 1.10406935603345668e-7          , 1.42034748955321688e-8          , },
+/* x = 6.7         */  {0.000194260846390062556         , 0.000154591230295341961         , 0.0000636687116767916444        , 0.0000179499252207931328        , 3.87493090110687545e-6          , 6.8037726243199259e-7           , 1.00902822098484122e-7          , 1.29699571005518136e-8          , },
+/* x = 6.8         */  {0.000179420841341013372         , 0.000142380820217090018         , 0.0000585095748632318846        , 0.0000164660171128791186        , 3.54943386560206888e-6          , 6.22478659017425397e-7          , 9.22238263247196901e-8          , 1.18443386119185348e-8          , },
+/* x = 6.9         */  {0.000165751737860476473         , 0.000131158993810115166         , 0.0000537766468602781661        , 0.000015106687670086621         , 3.2516227941529074e-6           , 5.69558120436735313e-7          , 8.42977939982399005e-8          , 1.08171225792894289e-8          , },
+/* x = 7.0         */  {0.000153158817810324083         , 0.000120844138372928086         , 0.0000494341665546827653        , 0.0000138613455921685706        , 2.97911823263317422e-6          , 5.21183913110350195e-7          , 7.70589199328391292e-8          , 9.8796525317908845e-9           , },
+/* x = 7.1         */  {0.000141555177069052099         , 0.000111361484993519818         , 0.0000454494116764426855        , 0.000012720309473529208         , 2.72974701901738977e-6          , 4.76962023558996239e-7          , 7.04471863326724907e-8          , 9.02403766152885838e-9          , },
+/* x = 7.2         */  {0.000130861070651627575         , 0.000102642527270902042         , 0.0000417924378392520638        , 0.000011674728945276705         , 2.5015242652532e-6              , 4.36532841883819809e-7          , 6.44078510153256957e-8          , 8.24308477765819497e-9          , },
+/* x = 7.3         */  {0.000121003313424675493         , 0.0000946244899332629555        , 0.0000384358401896627369        , 0.0000107165127028766063        , 2.2926369229541308e-6           , 3.99568138458124566e-7          , 5.88909811083028308e-8          , 7.53023633327243516e-9          , },
+/* x = 7.4         */  {0.000111914731646700242         , 0.0000872498430313737539        , 0.0000353545356914367827        , 9.83826281431049908e-6          , 2.1014287929202599e-6           , 3.65768307782986141e-7          , 5.38510281613459591e-8          , 6.87951398111501326e-9          , },
+/* x = 7.5         */  {0.000103533660976029906         , 0.0000804658577629783211        , 0.0000325255642449584839        , 9.03321475711580825e-6          , 1.92638685092818877e-6          , 3.34859855782822042e-7          , 4.92464409804175772e-8          , 6.28546716300642101e-9          , },
+/* x = 7.6         */  {0.0000958034869661359935        , 0.0000742242003278750785        , 0.0000299279069996386775        , 8.29518268140585264e-6          , 1.76612877355646099e-6          , 3.06593108932711567e-7          , 4.5039312819935561e-8           , 5.74312628236794877e-9          , },
+/* x = 7.7         */  {0.0000886722244120811436        , 0.0000684805605271806742        , 0.0000275423203613518101        , 7.61850944036773775e-6          , 1.61939155812757238e-6          , 2.8074012553557704e-7           , 4.11950598708939891e-8          , 5.24796004969941036e-9          , },
+/* x = 7.8         */  {0.000082092132225966901         , 0.0000631943121065160646        , 0.0000253511843283339269        , 6.99802097019485279e-6          , 1.4850211402433306e-6           , 2.57092791221266908e-7          , 3.76821282565097999e-8          , 4.79583662769813177e-9          , },
+/* x = 7.9         */  {0.0000760193608060224402        , 0.000058328202104005893         , 0.0000233383639087665694        , 6.42898463828172509e-6          , 1.36196292094881247e-6          , 2.35461082336602905e-7          , 3.44717269964403162e-8          , 4.3829882362189249e-9           , },
+/* x = 8.0         */  {0.000070413629125790815         , 0.0000538480667022457511        , 0.0000214890824825049197        , 5.90707121211140406e-6          , 1.24925312335641125e-6          , 2.15671482349653601e-7          , 3.15375846276359225e-8          , 4.00597890776942241e-9          , },
+/* x = 8.1         */  {0.0000652379290089181336        , 0.0000497225713007865192        , 0.0000197898060690147285        , 5.42832013189045202e-6          , 1.14601090566362067e-6          , 1.97565537715692254e-7          , 2.88557273765411731e-8          , 3.66167511198453157e-9          , },
+/* x = 8.2         */  {0.0000604582542733265581        , 0.000045922972724049339         , 0.0000182281375544144852        , 4.98910779789904523e-6          , 1.05143116396830771e-6          , 1.80998540858151574e-7          , 2.64042769654699162e-8          , 3.34721899277571529e-9          , },
+/* x = 8.3         */  {0.0000560433526278721311        , 0.0000424229016605948318        , 0.0000167927200133539092        , 4.58611860896498156e-6          , 9.64777964179757618e-7          , 1.65838329016015336e-7          , 2.41632663072237005e-8          , 3.06000398483073778e-9          , },
+/* x = 8.4         */  {0.0000519644983866110116        , 0.0000391981635948535074        , 0.000015473148337005011         , 4.21631851166033917e-6          , 8.85378547694143185e-7          , 1.51964188709145654e-7          , 2.21144714979153147e-8          , 2.7976525970524317e-9           , },
+/* x = 8.5         */  {0.0000481952842320347413        , 0.0000362265566431733192        , 0.0000142598884473426144        , 3.87693084095829051e-6          , 8.12617860396078226e-7          , 1.39265856483824883e-7          , 2.0241258659881409e-8           , 2.55799616955741884e-9          , },
+/* x = 8.6         */  {0.0000447114304104656448        , 0.0000334877048436242347        , 0.0000131442034407349225        , 3.56541425235743818e-6          , 7.45933559006170891e-7          , 1.2764260743029235e-7           , 1.85284443157758469e-8          , 2.33905642817714745e-9          , },
+/* x = 8.7         */  {0.000041490609881485167         , 0.0000309629055745755419        , 0.0000121180860611868357        , 3.27944256304802385e-6          , 6.8481145285678611e-7           , 1.17002423719558551e-7          , 1.69621680925715432e-8          , 2.139028676168359e-9            , },
+/* x = 8.8         */  {0.0000385122880699481123        , 0.0000286349898916841653        , 0.0000111741969558671176        , 3.01688633570968124e-6          , 6.28781342879875497e-7          , 1.07261236094909421e-7          , 1.55297766613028665e-8          , 1.95626647718848363e-9          , },
+/* x = 8.9         */  {0.0000357575759848608957        , 0.0000264881946775631336        , 0.0000103058082132496655        , 2.77579605313178373e-6          , 5.77413222963892104e-7          , 9.83422318803014114e-8          , 1.42197179158992763e-8          , 1.78926769665112183e-9          , },
+/* x = 9.0         */  {0.0000332090955751266909        , 0.0000245080455939152331        , 9.50675172771416333e-6          , 2.55438674516032695e-6          , 5.30313811910753633e-7          , 9.0175223638783625e-8           , 1.3021444483254583e-8           , 1.63666178046380228e-9          , },
+/* x = 9.1         */  {0.0000308508562887556868        , 0.0000226812499131171395        , 8.77137197415139878e-6          , 2.35102394161395616e-6          , 4.87123387025208826e-7          , 8.26960731341623442e-8          , 1.19253257375283318e-8          , 1.49719816097022536e-9          , },
+/* x = 9.2         */  {0.0000286681418903990995        , 0.0000209955983858527902        , 8.09448281233993651e-6          , 2.1642108358802897e-6           , 4.47512892922071168e-7          , 7.58461657228937274e-8          , 1.09225675652990886e-8          , 1.36973568976828437e-9          , },
+/* x = 9.3         */  {0.0000266474066727160761        , 0.0000194398753740860192        , 7.47132797391024264e-6          , 1.99257655399692521e-6          , 4.11181301463714921e-7          , 6.9571930734791942e-8           , 1.00051391952324189e-8          , 1.25323300604070201e-9          , },
+/* x = 9.4         */  {0.0000247761802707846127        , 0.0000180037765450375613        , 6.89754491486918624e-6          , 1.83486543322582943e-6          , 3.77853200861108596e-7          , 6.38244037943408221e-8          , 9.16570646697931449e-9          , 1.14673975719663779e-9          , },
+/* x = 9.5         */  {0.000023042980356124663         , 0.0000166778334824430884        , 6.36913174417679179e-6          , 1.68992722252390056e-6          , 3.47276593904819486e-7          , 5.85588273926276754e-8          , 8.39757096962083895e-9          , 1.0493885960524491e-9           , },
+/* x = 9.6         */  {0.0000214372325484644985        , 0.0000154533446267209688        , 5.88241696398032641e-6          , 1.55670812496805414e-6          , 3.19220887054552078e-7          , 5.37342863463009436e-8          , 7.69461453061061807e-9          , 9.60387885543731732e-10         , },
+/* x = 9.7         */  {0.0000199491969396527074        , 0.000014322312006230615         , 5.43403178002988633e-6          , 1.43424260917554236e-6          , 2.93475053722084943e-7          , 4.9313375077331989e-8           , 7.05124858228332968e-9          , 8.79015048118698128e-10         , },
+/* x = 9.8         */  {0.0000185699006755567005        , 0.0000132773832679738228        , 5.0208847617174911e-6           , 1.32164592312889153e-6          , 2.69845956546790072e-7          , 4.52618939183235804e-8          , 6.46236797499939193e-9          , 8.04610502569346469e-10         , },
+/* x = 9.9         */  {0.000017291076088812867         , 0.00001231179855826482          , 4.64013865027414843e-6          , 1.21810724962406508e-6          , 2.48156814797865487e-7          , 4.15485718950100968e-8          , 5.9233088442520631e-9           , 7.36572136161293244e-10         , },
+/* x = 10.0        */  {0.0000161051039182857199        , 0.0000114193418424186193        , 4.28918913108672289e-6          , 1.12288344785964592e-6          , 2.28245804254471427e-7          , 3.81448136625825018e-8          , 5.42981017390850378e-9          , 6.74350264570681621e-10         , },
+/* x = 10.1        */  {0.0000150049611904022657        , 0.0000105942962876998915        , 3.96564540200488196e-6          , 1.03529333051901265e-6          , 2.09964778024593725e-7          , 3.50244684774981545e-8          , 4.97797872949623984e-9          , 6.17443036368269483e-10         , },
+/* x = 10.2        */  {0.0000139841733734718319        , 9.83140336592619793e-6          , 3.66731238403115334e-6          , 9.54712430107693919e-7          , 1.93178097775194151e-7          , 3.21636192732801413e-8          , 4.56425706435872503e-9          , 5.65392242643980257e-10         , },
+/* x = 10.3        */  {0.0000130367704489713345        , 9.12582536149483949e-6          , 3.39217443404570283e-6          , 8.80568212331719458e-7          , 1.77761565768726318e-7          , 2.95403900790925554e-8          , 4.18539432784121398e-9          , 5.17779495873839905e-10         , },
+/* x = 10.4        */  {0.0000121572465738368318        , 8.47311099744338964e-6          , 3.13838043132261458e-6          , 8.12335697973927693e-7          , 1.63601448942304457e-7          , 2.71347701750717299e-8          , 3.838419628661109e-9            , 4.74222745326239311e-10         , },
+/* x = 10.5        */  {0.0000113405230352964504        , 7.8691639166805952e-6           , 2.90423012064724169e-6          , 7.4953345807489677e-7           , 1.50593587032913882e-7          , 2.49284535198417346e-8          , 3.52061772847487185e-9          , 4.34373099213984942e-10         , },
+/* x = 10.6        */  {0.0000105819142249286086        , 7.31021377793788441e-6          , 2.68816160493671244e-6          , 6.91719950281750993e-7          , 1.38642577451608571e-7          , 2.29046921145683751e-8          , 3.2295068605672392e-9           , 3.97911926448232613e-10         , },
+/* x = 10.7        */  {9.87709638163487675e-6          , 6.79278974647573413e-6          , 2.48873988948193351e-6          , 6.38490167017359913e-7          , 1.27661030247631374e-7          , 2.10481620854231425e-8          , 2.96281848673148931e-9          , 3.64548213263437382e-10         , },
+/* x = 10.8        */  {9.22207887426326781e-6          , 6.31369617830109335e-6          , 2.3046463883460379e-6           , 5.89472568667914008e-7          , 1.17568887085262725e-7          , 1.93448413734512726e-8          , 2.71847882193995542e-9          , 3.34016152180099324e-10         , },
+/* x = 10.9        */  {8.61317781387368437e-6          , 5.86999031376477383e-6          , 2.13466931114105821e-6          , 5.44326277309968503e-7          , 1.08292798686917218e-7          , 1.77818980184899718e-8          , 2.49459197146578389e-9          , 3.06072942773636622e-10         , },
+/* x = 11.0        */  {8.04699180325651158e-6          , 5.45896181205068353e-6          , 1.97769485542539381e-6          , 5.02738508618340006e-7          , 9.97655556800857225e-8          , 1.63475881128052175e-8          , 2.28942453884111397e-9          , 2.80496785540735935e-10         , },
+/* x = 11.1        */  {7.52037964743844336e-6          , 5.07811397236930221e-6          , 1.83269913637751608e-6          , 4.64422221531536393e-7          , 9.19255682272841483e-8          , 1.50311625812745724e-8          , 2.10139157554270437e-9          , 2.57085051814999279e-10         , },
+/* x = 11.2        */  {7.03043986366491394e-6          , 4.72514650074207962e-6          , 1.69874079125934284e-6          , 4.29113967017942307e-7          , 8.47163902209730004e-8          , 1.3822782018937071e-8           , 1.92904375469216001e-9          , 2.35652614196174778e-10         , },
+/* x = 11.3        */  {6.57449184285321563e-6          , 4.39793969321754138e-6          , 1.57495420153418265e-6          , 3.96571918898579946e-7          , 7.80862841928757412e-8          , 1.2713438884195138e-8           , 1.77105566144321635e-9          , 2.16030323334967402e-10         , },
+/* x = 11.4        */  {6.15005852687162016e-6          , 4.09453991729064031e-6          , 1.46054328039322856e-6          , 3.66574071154419998e-7          , 7.1987823422366623e-8           , 1.16948864074667508e-8          , 1.62621510219306341e-9          , 1.98063618170427983e-10         , },
+/* x = 11.5        */  {5.75485047731543365e-6          , 3.81314628329268093e-6          , 1.35477577791152667e-6          , 3.38916587490242097e-7          , 6.63775280344614107e-8          , 1.07595736311761361e-8          , 1.49341334338043299e-9          , 1.81611257860185732e-10         , },
+/* x = 11.6        */  {5.38675122181030477e-6          , 3.55209840666067097e-6          , 1.25697806013588651e-6          , 3.13412290154163929e-7          , 6.1215532157016896e-8           , 9.90058604811872239e-9          , 1.37163619849479442e-9          , 1.66544164685307994e-10         , },
+/* x = 11.7        */  {5.04380377335795781e-6          , 3.30986517035589392e-6          , 1.16653032213685084e-6          , 2.89889276132410044e-7          , 5.64652794613875019e-8          , 9.1115913518786097e-9           , 1.25995588908649871e-9          , 1.52744368160432167e-10         , },
+/* x = 11.8        */  {4.72419822692448203e-6          , 3.0850344043491242e-6           , 1.08286219846518001e-6          , 2.68189649862010573e-7          , 5.20932446431507692e-8          , 8.38678985551327619e-9          , 1.15752361209899668e-9          , 1.40104041444294687e-10         , },
+/* x = 11.9        */  {4.42626034542458809e-6          , 2.87630340608565229e-6          , 1.00544873756823362e-6          , 2.48168362538419742e-7          , 4.80686786115589135e-8          , 7.72086917351396188e-9          , 1.06356275179772196e-9          , 1.28524621933414712e-10         , },
+/* x = 12.0        */  {4.14844105453918364e-6          , 2.68247023224324634e-6          , 9.33806709568613974e-7          , 2.2969214894828873e-7           , 4.43633753498882552e-8          , 7.10896279743220256e-9          , 9.77362679997229544e-10         , 1.17916008639334847e-10         , },
+/* x = 12.1        */  {3.88930677247520062e-6          , 2.50242569795158125e-6          , 8.67491219409708668e-7          , 2.12638553536898208e-7          , 4.09514585854714332e-8          , 6.54661222783495718e-9          , 8.98273093235486511e-10         , 1.08195829603722403e-10         , },
+/* x = 12.2        */  {3.64753050688790762e-6          , 2.33514602499930267e-6          , 8.06092599751543164e-7          , 1.9689503813151208e-7           , 3.78091865693941645e-8          , 6.02973235468751858e-9          , 8.25698840054423717e-10         , 9.92887732014777102e-11         , },
+/* x = 12.3        */  {3.42188365678457015e-6          , 2.17968608545749828e-6          , 7.49233560174984403e-7          , 1.82358164392046817e-7          , 3.49147734129729437e-8          , 5.55457980511535619e-9          , 7.59095195657775479e-10         , 9.11259777249573916e-11         , },
+/* x = 12.4        */  {3.21122846235780068e-6          , 2.03517319163495574e-6          , 6.96566571240492938e-7          , 1.68932844654334638e-7          , 3.22482255624369469e-8          , 5.11772400199141765e-9          , 6.97963544966200937e-10         , 8.36444741372133121e-11         , },
+/* x = 12.5        */  {3.01451105039705967e-6          , 1.90080138738685373e-6          , 6.47771463765430999e-7          , 1.56531655373796207e-7          , 2.97911921158420092e-8          , 4.71602069914217817e-9          , 6.41847438507888127e-10         , 7.67866773330637547e-11         , },
+/* x = 12.6        */  {2.83075502723390943e-6          , 1.77582619955703481e-6          , 6.02553225346120598e-7          , 1.45074207873001865e-7          , 2.75268277981730722e-8          , 4.3465877793533929e-9           , 5.90328988699614737e-10         , 7.04999216577599246e-11         , },
+/* x = 12.7        */  {2.65905557512404968e-6          , 1.6595598117745049e-6           , 5.60639977670849858e-7          , 1.34486571549470301e-7          , 2.54396675127796609e-8          , 4.00678311995780063e-9          , 5.43025576915291656e-10         , 6.47360368075464752e-11         , },
+/* x = 12.8        */  {2.49857401158729858e-6          , 1.55136662597448731e-6          , 5.21781119560118321e-7          , 1.24700745113852661e-7          , 2.35155114805899518e-8          , 3.69418434775936533e-9          , 4.99586844330682665e-10         , 5.94509605777797406e-11         , },
+/* x = 12.9        */  {2.34853277454334615e-6          , 1.45065917989807165e-6          , 4.85745621941797003e-7          , 1.1565417180677544e-7           , 2.17413200637409154e-8          , 3.4065703205355017e-9           , 4.59691941896446465e-10         , 5.46043852354125617e-11         , },
+/* x = 13.0        */  {2.2082107991217423e-6           , 1.3568943914649448e-6           , 4.52320462131786477e-7          , 1.07289294888166524e-7          , 2.01051174480543685e-8          , 3.14190418649088679e-9          , 4.23047016947084342e-10         , 5.0159434576267298e-11          , },
+/* x = 13.1        */  {2.07693925481246422e-6          , 1.26957010333161843e-6          , 4.21309185854527888e-7          , 9.95531500086939086e-8          , 1.85959034298286745e-8          , 2.89831788593311573e-9          , 3.89382915919200918e-10         , 4.60823689860461825e-11         , },
+/* x = 13.2        */  {1.95409761417982609e-6          , 1.188221903161937e-6            , 3.92530586410888187e-7          , 9.2396991361587103e-8           , 1.7203572617293424e-8           , 2.67409797121027388e-9          , 3.58453084445464048e-10         , 4.23423160596995443e-11         , },
+/* x = 13.3        */  {1.8391100267069249e-6           , 1.11242019716479158e-6          , 3.65817491291292724e-7          , 8.57759487769425264e-8          , 1.59188404163280098e-8          , 2.46767263169252466e-9          , 3.30031647726060605e-10         , 3.89110245486176621e-11         , },
+/* x = 13.4        */  {1.73144197348807827e-6          , 1.04176751631171944e-6          , 3.41015647346630965e-7          , 7.96487131617863862e-8          , 1.47331752241655343e-8          , 2.27759982038435043e-9          , 3.0391165557120884e-10          , 3.57626396009801511e-11         , },
+/* x = 13.5        */  {1.63059718045910778e-6          , 9.75896036348916591e-7          , 3.17982696374913534e-7          , 7.39772479096437289e-8          , 1.36387363042388121e-8          , 2.10255638770345768e-9          , 2.79903477869090459e-10         , 3.28734974391719901e-11         , },
+/* x = 13.6        */  {1.53611476966477255e-6          , 9.14465294277368397e-7          , 2.9658723366384718e-7           , 6.87265241049317929e-8          , 1.26283168604838763e-8          , 1.94132813613162158e-9          , 2.57833337474966348e-10         , 3.02219377809916578e-11         , },
+/* x = 13.7        */  {1.44756662972281653e-6          , 8.57160085403413779e-7          , 2.76707942653841577e-7          , 6.38642775317944213e-8          , 1.16952918706710565e-8          , 1.79280071690033167e-9          , 2.37541968649773481e-10         , 2.77881324598317613e-11         , },
+/* x = 13.8        */  {1.36455498816745369e-6          , 8.03688526371167455e-7          , 2.58232799457421933e-7          , 5.93607856655146756e-8          , 1.08335702760243574e-8          , 1.65595129668240444e-9          , 2.18883390209767485e-10         , 2.55539288343789839e-11         , },
+/* x = 13.9        */  {1.28671016975311478e-6          , 7.53780270787949417e-7          , 2.41058341494120171e-7          , 5.51886629787475404e-8          , 1.00375511588267433e-8          , 1.52984092847664526e-9          , 2.0172378349152544e-10          , 2.35027067018177868e-11         , },
+/* x = 14.0        */  {1.21368852608238673e-6          , 7.0718486515346452e-7           , 2.25088994978790321e-7          , 5.13226730357477715e-8          , 9.30208357117503658e-9          , 1.4136075665480518e-9           , 1.85940466096831347e-10         , 2.16192475410875188e-11         , },
+/* x = 14.1        */  {1.14517052309987477e-6          , 6.63670233811398938e-7          , 2.10236456439719127e-7          , 4.77395559766653799e-8          , 8.62242970680171597e-9          , 1.30645967046826493e-9          , 1.71420953166900971e-10         , 1.98896150153978894e-11         , },
+/* x = 14.2        */  {1.08085897407498189e-6          , 6.23021282566093604e-7          , 1.96419123844333533e-7          , 4.44178701118801328e-8          , 7.99423113415760644e-9          , 1.20767034803313676e-9          , 1.58062098651688641e-10         , 1.83010457568300432e-11         , },
+/* x = 14.3        */  {1.02047740668936476e-6          , 5.85038611454096077e-7          , 1.83561573277898117e-7          , 4.13378464541938683e-8          , 7.41347783296430752e-9          , 1.11657199115574923e-9          , 1.45769309693695337e-10         , 1.68418495412386606e-11         , },
+/* x = 14.4        */  {9.63768553756445764e-7          , 5.49537327937156881e-7          , 1.71594077457231266e-7          , 3.84812551153602626e-8          , 6.87647979839446822e-9          , 1.03255136277986722e-9          , 1.34455827842269965e-10         , 1.55013180395525868e-11         , },
+/* x = 14.5        */  {9.10492957937574842e-7          , 5.16345952495547733e-7          , 1.60452162669784808e-7          , 3.58312825836958267e-8          , 6.37984099710077013e-9          , 9.55045096463383334e-10         , 1.24042071358882851e-10         , 1.42696414026107406e-11         , },
+/* x = 14.6        */  {8.60427681588412691e-7          , 4.8530540925385673e-7           , 1.50076201010836963e-7          , 3.33724189821047559e-8          , 5.92043547765419105e-9          , 8.83535573573663073e-10         , 1.14455033370827109e-10         , 1.31378320014709095e-11         , },
+/* x = 14.7        */  {8.13365113575499995e-7          , 4.5626809487061813e-7           , 1.40411035050245197e-7          , 3.10903544814227403e-8          , 5.4953854547179865e-9           , 8.17547146044066047e-10         , 1.05627731084441001e-10         , 1.20976547042422606e-11         , },
+/* x = 14.8        */  {7.69111865551963534e-7          , 4.29097019472799115e-7          , 1.31405632297207042e-7          , 2.89718841131428462e-8          , 5.10204120161203053e-9          , 7.56642675388145279e-10         , 9.749870168304544e-11           , 1.11415631244199278e-11         , },
+/* x = 14.9        */  {7.27487750777631851e-7          , 4.03665013920445224e-7          , 1.23012767048623917e-7          , 2.70048202888799256e-8          , 4.7379625999370189e-9           , 7.00420361177778951e-10         , 9.00115409128229861e-11         , 1.02626413248992632e-11         , },
+/* x = 15.0        */  {6.88324839116836781e-7          , 3.79853998149479983e-7          , 1.15188727405638231e-7          , 2.51779123918609996e-8          , 4.40090220774304467e-9          , 6.48510834484444725e-10         , 8.3114480704989589e-11          , 9.45455050673516421e-12         , },
+/* x = 15.1        */  {6.51466582350844353e-7          , 3.5755430576524084e-7           , 1.07893045425256545e-7          , 2.34807728587565909e-8          , 4.08878971944581804e-9          , 6.00574493877872571e-10         , 7.67600024977109319e-11         , 8.71148025266821475e-12         , },
+/* x = 15.2        */  {6.1676700440483876e-7           , 3.36664060448996609e-7          , 1.01088248541088381e-7          , 2.19038092187113488e-8          , 3.79971770141091575e-9          , 5.56299063490621561e-10         , 7.09044832089204981e-11         , 8.02810393281052894e-12         , },
+/* x = 15.3        */  {5.84089951515020565e-7          , 3.17088600097345701e-7          , 9.47396305404084502e-8          , 2.04381616008746391e-8          , 3.53192849692828028e-9          , 5.15397354406426199e-10         , 6.55078710739038543e-11         , 7.39953791398576949e-12         , },
+/* x = 15.4        */  {5.53308397752740735e-7          , 2.98739944942707784e-7          , 8.88150405251664797e-8          , 1.90756452624231569e-8          , 3.28380220326461432e-9          , 4.77605212228781342e-10         , 6.05333888014095778e-11         , 6.82130424533755433e-12         , },
+/* x = 15.5        */  {5.24303801682485528e-7          , 2.81536306204537295e-7          , 8.3284688413300174e-8           , 1.7808697726328008e-8           , 3.05384563168234849e-9          , 4.42679635147261094e-10         , 5.59472617211258119e-11         , 6.28929652122061654e-12         , },
+/* x = 15.6        */  {4.9696551026152994e-7           , 2.65401632097642395e-7          , 7.81209656547378085e-8          , 1.66303301522405005e-8          , 2.84068216881626979e-9          , 4.1039704815443259e-10          , 5.17184687954413879e-11         , 5.79974864830872204e-12         , },
+/* x = 15.7        */  {4.71190206393551547e-7          , 2.50265188278136307e-7          , 7.3298279944708496e-8           , 1.55340825951213405e-8          , 2.64304246466275041e-9          , 3.80551720286824302e-10         , 4.7818514551150675e-11          , 5.34920626751042498e-12         , },
+/* x = 15.8        */  {4.4688139682860809e-7           , 2.36061170040955627e-7          , 6.87929028162344497e-8          , 1.45139828348613248e-8          , 2.45975587871667079e-9          , 3.52954312879183222e-10         , 4.4221220153675015e-11          , 4.93450060287695031e-12         , },
+/* x = 15.9        */  {4.2394893735961745e-7           , 2.22728343797270743e-7          , 6.45828290847147346e-8          , 1.3564508486361278e-8           , 2.2897426215376957e-9           , 3.27430547841281555e-10         , 4.09025319988410741e-11         , 4.55272452939699149e-12         , },
+/* x = 16.0        */  {4.02308592502659633e-7          , 2.10209715557061083e-7          , 6.06476472010140852e-8          , 1.26805521235590233e-8          , 2.13200653428631002e-9          , 3.03819985899095546e-10         , 3.78403463365369121e-11         , 4.20121066956616822e-12         , },
+/* x = 16.1        */  {3.81881627066718078e-7          , 1.98452224323074761e-7          , 5.69684196460748518e-8          , 1.18573891728982597e-8          , 1.98562845358276375e-9          , 2.81974905594839089e-10         , 3.5014348567808775e-11          , 3.87751134504490297e-12         , },
+/* x = 16.2        */  {3.62594427219425199e-7          , 1.87406458468659478e-7          , 5.35275725703529137e-8          , 1.10906483518989768e-8          , 1.84976011344701327e-9          , 2.61759274619996575e-10         , 3.24058659732136326e-11         , 3.57938022471486974e-12         , },
+/* x = 16.3        */  {3.44378148840380951e-7          , 1.77026393324749951e-7          , 5.03087939458684246e-8          , 1.03762844469675156e-8          , 1.72361854010977682e-9          , 2.43047805768465827e-10         , 2.99977327364605275e-11         , 3.30475552413616247e-12         , },
+/* x = 16.4        */  {3.27168391123964147e-7          , 1.6726914834173622e-7           , 4.72969395578436845e-8          , 9.71055324151926964e-9          , 1.60648089917583426e-9          , 2.25725090448947681e-10         , 2.77741662244303864e-11         , 3.05174462390911723e-12         , },
+/* x = 16.5        */  {3.10904893550438455e-7          , 1.58094762321033486e-7          , 4.44779462172164778e-8          , 9.08998842100880491e-9          , 1.49767975799983129e-9          , 2.096848032920581e-10           , 2.57206535733551997e-11         , 2.81860998586043695e-12         , },
+/* x = 16.6        */  {2.95531254488655594e-7          , 1.4946598532985968e-7           , 4.18387516251736477e-8          , 8.51138029569020826e-9          , 1.39659872922872116e-9          , 1.94828971933089604e-10         , 2.38238477119899013e-11         , 2.60375625639788572e-12         , },
+/* x = 16.7        */  {2.80994669826774902e-7          , 1.41348086021856009e-7          , 3.93672203666179871e-8          , 7.97175619497391627e-9          , 1.30266846429792641e-9          , 1.81067306550292717e-10         , 2.20714720266868666e-11         , 2.40571845589796086e-12         , },
+/* x = 16.8        */  {2.67245690150067126e-7          , 1.33708673186541247e-7          , 3.70520755515019116e-8          , 7.46836239920498534e-9          , 1.2153629682625654e-9           , 1.6831658419498611e-10          , 2.04522329409887465e-11         , 2.22315116168562091e-12         , },
+/* x = 16.9        */  {2.54237995097891889e-7          , 1.26517530442890653e-7          , 3.48828356615453307e-8          , 6.99864748565308599e-9          , 1.1341962097209909e-9           , 1.56500083367390653e-10         , 1.89557397442425899e-11         , 2.05481860010641042e-12         , },
+/* x = 17.0        */  {2.41928183636105022e-7          , 1.19746463077233344e-7          , 3.28497561952879688e-8          , 6.56024697556001482e-9          , 1.05871900176400782e-9          , 1.45547064674155153e-10         , 1.7572431060310908e-11          , 1.89958557044491184e-12         , },
+/* x = 17.1        */  {2.30275579077172856e-7          , 1.13369156103771522e-7          , 3.09437757369693919e-8          , 6.15096917831268009e-9          , 9.88516131876458754e-10         , 1.35392293753148817e-10         , 1.62935073991735567e-11         , 1.75640913006933629e-12         , },
+/* x = 17.2        */  {2.19242047768796905e-7          , 1.07361042697894714e-7          , 2.91564661046225342e-8          , 5.76878213726830047e-9          , 9.23203720543915028e-10         , 1.25975602971022238e-10         , 1.51108692814980149e-11         , 1.62433097623494217e-12         , },
+/* x = 17.3        */  {2.08791830453482423e-7          , 1.01699182218600162e-7          , 2.74799862602278542e-8          , 5.41180158951798797e-9          , 8.62426789990181561e-10         , 1.17241488691828845e-10         , 1.40170604694881939e-11         , 1.50247046550875032e-12         , },
+/* x = 17.4        */  {1.98891385376767542e-7          , 9.63621470972023188e-8          , 2.5907039690006272e-8           , 5.07827985899356274e-9          , 8.05857026004195563e-10         , 1.09138741182976488e-10         , 1.30052158768533004e-11         , 1.39001821683023963e-12         , },
+/* x = 17.5        */  {1.8950924229127112e-7           , 9.13299179255476922e-8          , 2.44308349861138048e-8          , 4.76659560885399992e-9          , 7.53190717219538298e-10         , 1.01620104470067419e-10         , 1.20690137668880405e-11         , 1.28623024883890288e-12         , },
+/* x = 17.6        */  {1.80615866567780938e-7          , 8.65837861285379933e-8          , 2.30450493823080012e-8          , 4.47524438508142738e-9          , 7.04146857497038814e-10         , 9.46419636767245975e-11         , 1.12026318807153215e-11         , 1.19042260631762561e-12         , },
+/* x = 17.7        */  {1.7218353268371598e-7           , 8.21062636532646101e-8          , 2.17437950157404396e-8          , 4.20282988871701504e-9          , 6.58465398240752833e-10         , 8.81640575910657323e-11         , 1.04007071679789903e-11         , 1.10196643445541234e-12         , },
+/* x = 17.8        */  {1.64186206413849018e-7          , 7.78809991508010615e-8          , 2.05215877050323686e-8          , 3.9480559192155616e-9           , 6.1590563855902619e-10          , 8.21492143886938648e-11         , 9.65829881993026679e-12         , 1.02028346315558926e-12         , },
+/* x = 17.9        */  {1.56599435098528975e-7          , 7.38927001669903633e-8          , 1.93733180513418901e-8          , 3.70971893603175889e-9          , 5.76244742173702461e-10         , 7.65631086144050054e-11         , 8.97085433014954394e-12         , 9.44841866835067529e-13         , },
+/* x = 18.0        */  {1.49400245411127726e-7          , 7.01270608956794085e-8          , 1.82942246843499463e-8          , 3.48670118980548665e-9          , 5.3927637088940339e-10          , 7.13740376826225476e-11         , 8.33417833128797939e-12         , 8.75152468102846016e-13         , },
+/* x = 18.1        */  {1.42567048089357684e-7          , 6.6570695082047925e-8           , 1.72798694890879121e-8          , 3.27796437841964352e-9          , 5.04809425268145796e-10         , 6.65527163010915608e-11         , 7.74440397738608501e-12         , 8.10765256395661874e-13         , },
+/* x = 18.2        */  {1.36079549134744809e-7          , 6.32110736951898562e-8          , 1.63261146624018721e-8          , 3.08254378679087751e-9          , 4.72666883918715792e-10         , 6.20720873547340877e-11         , 7.19796666069854487e-12         , 7.5126619510746248e-13          , },
+/* x = 18.3        */  {1.29918667021154118e-7          , 6.00364670181454478e-8          , 1.54291014596894385e-8          , 2.89954287254763116e-9          , 4.42684733511016037e-10         , 5.79071479078126159e-11         , 6.69157986968033782e-12         , 6.96274292997163895e-13         , },
+/* x = 18.4        */  {1.24066455487088399e-7          , 5.70358908303506838e-8          , 1.45852305034383882e-8          , 2.7281282627754288e-9           , 4.14710982268355471e-10         , 5.40347890936176765e-11         , 6.22221301101010147e-12         , 6.45438917714227999e-13         , },
+/* x = 18.5        */  {1.1850603151773355e-7           , 5.4199056382148642e-8           , 1.37911435351196433e-8          , 2.56752512978853344e-9          , 3.8860475028023313e-10          , 5.04336487626507394e-11         , 5.78707103337153907e-12         , 5.98437331160591704e-13         , },
+/* x = 18.6        */  {1.13221508151606421e-7          , 5.15163238837616812e-8          , 1.30437065012109855e-8          , 2.41701291644035292e-9          , 3.6423543051903459e-10          , 4.70839758535049582e-11         , 5.38357570430038246e-12         , 5.54972428125625988e-13         , },
+/* x = 18.7        */  {1.08197931773357812e-7          , 4.89786592521074245e-8          , 1.23399938726173253e-8          , 2.27592138383093818e-9          , 3.41481914940290034e-10         , 4.39675055360759551e-11         , 5.00934840384064767e-12         , 5.14770661201975581e-13         , },
+/* x = 18.8        */  {1.03421223578964201e-7          , 4.65775938781961018e-8          , 1.16772741045679248e-8          , 2.14362695642568638e-9          , 3.20231880501470222e-10         , 4.10673442550230809e-11         , 4.66219431013803154e-12         , 4.77580136427010017e-13         , },
+/* x = 18.9        */  {9.88781249223633317e-8          , 4.43051871957013918e-8          , 1.10529961512653758e-8          , 2.01954934158060739e-9          , 3.00381130352138216e-10         , 3.83678638731523148e-11         , 4.34008786252018923e-12         , 4.43168865408780136e-13         , },
+/* x = 19.0        */  {9.45561462736948433e-8          , 4.21539918477703965e-8          , 1.04647769561855298e-8          , 1.90314840229059204e-9          , 2.81832985831759248e-10         , 3.58546041801575178e-11         , 4.0411593971554492e-12          , 4.11323160897391979e-13         , },
+/* x = 19.1        */  {9.04435195388303164e-8          , 4.01170212643401331e-8          , 9.91038984502801356e-9          , 1.79392126365119667e-9          , 2.64497725263462965e-10         , 3.35141830924422961e-11         , 3.76368285911833718e-12         , 3.81846163862236073e-13         , },
+/* x = 19.2        */  {8.65291535079394771e-8          , 3.81877194762584268e-8          , 9.38775375393571079e-9          , 1.69139963506359519e-9          , 2.48292065855174279e-10         , 3.13342139250123799e-11         , 3.5060645026907042e-12          , 3.54556491141360691e-13         , },
+/* x = 19.3        */  {8.28025922175533085e-8          , 3.63599330054587569e-8          , 8.89492323077743725e-9          , 1.59514733162760854e-9          , 2.33138685316182807e-10         , 2.93032291671009193e-11         , 3.26683249905399944e-12         , 3.29286993649504904e-13         , },
+/* x = 19.4        */  {7.92539760260540246e-8          , 3.46278846823963949e-8          , 8.43007915205661348e-9          , 1.50475797946924171e-9          , 2.18965780069605947e-10         , 2.7410610239653194e-11          , 3.04462737723861869e-12         , 3.05883615973265735e-13         , },
+/* x = 19.5        */  {7.58740052168417047e-8          , 3.29861492529952284e-8          , 7.99152010240274704e-9          , 1.41985289094624062e-9          , 2.0570665719133134e-10          , 2.56465227554067805e-11         , 2.83819323034269578e-12         , 2.84204348952281322e-13         , },
+/* x = 19.6        */  {7.2653905956685786e-8           , 3.14296306475528508e-8          , 7.57765436765200963e-9          , 1.34007909677635116e-9          , 1.93299357435746014e-10         , 2.40018568413820149e-11         , 2.64636962466309232e-12         , 2.641182675503055e-13           , },
+/* x = 19.7        */  {6.95853984490476173e-8          , 2.99535407934719194e-8          , 7.18699249625571823e-9          , 1.26510752314604186e-9          , 1.81686306919562082e-10         , 2.24681721194419159e-11         , 2.46808415453947887e-12         , 2.4550464696523471e-13          , },
+/* x = 19.8        */  {6.6660667133532563e-8           , 2.8553379862389275e-8           , 6.81814038719643871e-9          , 1.19463130278961341e-9          , 1.70813995228880861e-10         , 2.10376469734617502e-11         , 2.30234559043833441e-12         , 2.2825215051764742e-13          , },
+/* x = 19.9        */  {6.38723327931655896e-8          , 2.72249178503168255e-8          , 6.46979286576399896e-9          , 1.128364209886443e-9            , 1.60632677892717511e-10         , 1.97030317618143088e-11         , 2.148237572134038e-12           , 2.12258083397908918e-13         , },
+/* x = 20.0        */  {6.12134264409463349e-8          , 2.59641773968412284e-8          , 6.14072771146930977e-9          , 1.06603920941363522e-9          , 1.51096101329836565e-10         , 1.84576056615548711e-11         , 2.00491280281247307e-12         , 1.9742770684665615e-13          , },
+/* x = 20.1        */  {5.86773648661869149e-8          , 2.47674177563003678e-8          , 5.82980010507219176e-9          , 1.00740711231811478e-9          , 1.42161248526116366e-10         , 1.72951368560876969e-11         , 1.87158770355933417e-12         , 1.83673607796415382e-13         , },
+/* x = 20.2        */  {5.62579277295221505e-8          , 2.36311198402071294e-8          , 5.53593746418845208e-9          , 9.52235328541280762e-10         , 1.33788103837859132e-10         , 1.62098458014040735e-11         , 1.74753749102862581e-12         , 1.70915119416790312e-13         , },
+/* x = 20.3        */  {5.39492361032573049e-8          , 2.25519722560652112e-8          , 5.25813463923783747e-9          , 9.00306710545412824e-10         , 1.25939435443493801e-10         , 1.51963713273747272e-11         , 1.63209164414229292e-12         , 1.59077788385352971e-13         , },
+/* x = 20.4        */  {5.1745732360928773e-8           , 2.15268582731546471e-8          , 4.99544944361346515e-9          , 8.51418480558357833e-10         , 1.18580594082898123e-10         , 1.42497393502163675e-11         , 1.52462972847295383e-12         , 1.48092885054056456e-13         , },
+/* x = 20.5        */  {4.9642161326640851e-8           , 2.05528436508904323e-8          , 4.74699849390892038e-9          , 8.05381235275560623e-10         , 1.11679326830935593e-10         , 1.33653339902793929e-11         , 1.42457754952975916e-12         , 1.37896952999393286e-13         , },
+/* x = 20.6        */  {4.76335526009458742e-8          , 1.96271652700074812e-8          , 4.5119533378443023e-9           , 7.62018022239842485e-10         , 1.05205604750532594e-10         , 1.25388709058551623e-11         , 1.33140360852208372e-12         , 1.28431394736137473e-13         , },
+/* x = 20.7        */  {4.57152039857917688e-8          , 1.87472205111280351e-8          , 4.28953684919895232e-9          , 7.21163482562788172e-10         , 9.91314633614184302e-11         , 1.1766372668899284e-11          , 1.24461583633501961e-12         , 1.19642090641610086e-13         , },
+/* x = 20.8        */  {4.38826659364037581e-8          , 1.79105573292501709e-8          , 4.07901987059731336e-9          , 6.82663055060217889e-10         , 9.3430854944163955e-11          , 1.10441460225243584e-11         , 1.16375858343089427e-12         , 1.11479048382079404e-13         , },
+/* x = 20.9        */  {4.21317269729263963e-8          , 1.7114864976382794e-8           , 3.87971808641537247e-9          , 6.46372237250788261e-10         , 8.80795117759777036e-11         , 1.0368760872934345e-11          , 1.08840984520731426e-12         , 1.03896080357051597e-13         , },
+/* x = 21.0        */  {4.04583999892566995e-8          , 1.63579653279660167e-8          , 3.69098910938765627e-9          , 6.12155899013850685e-10         , 8.30548194653970276e-11         , 9.73703088024742577e-12         , 1.0181787040082827e-12          , 9.68505068825668561e-14         , },
+/* x = 21.1        */  {3.88589094007751761e-8          , 1.56378047718769822e-8          , 3.51222976570726679e-9          , 5.79887645022653476e-10         , 7.83356996180458478e-11         , 9.14599552347120135e-12         , 9.52702970513340815e-13         , 9.03028830227808394e-14         , },
+/* x = 21.2        */  {3.73296790766532854e-8          , 1.49524466217491861e-8          , 3.34287356453177092e-9          , 5.49449222363970191e-10         , 7.39025011254790924e-11         , 8.59290352483236899e-12         , 8.91647008631961267e-13         , 8.42167471515376482e-14         , },
+/* x = 21.3        */  {3.5867321006105696e-8           , 1.43000640190458944e-8          , 3.1823883388430782e-9           , 5.20729970027259601e-10         , 6.97368994242176199e-11         , 8.0751975277951568e-12          , 8.34699729317115859e-13         , 7.85583894836595906e-14         , },
+/* x = 21.4        */  {3.44686246513843887e-8          , 1.36789332908416826e-8          , 3.03027404556637123e-9          , 4.93626307197340338e-10         , 6.5821803122782685e-11          , 7.59049993149513598e-12         , 7.81572739892706645e-13         , 7.32966389605080947e-14         , },
+/* x = 21.5        */  {3.31305469434983058e-8          , 1.30874277325954876e-8          , 2.88606071373777945e-9          , 4.68041257515974826e-10         , 6.21412674412202464e-11         , 7.13659979202847213e-12         , 7.31998636573224096e-13         , 6.8402667007122958e-14          , },
+/* x = 21.6        */  {3.18502028796045819e-8          , 1.25240117873577657e-8          , 2.74930653032841588e-9          , 4.43884006691246341e-10         , 5.86804139505879433e-11         , 6.71144070812699663e-12         , 6.85729428848670705e-13         , 6.38498067999422621e-14         , },
+/* x = 21.7        */  {3.06248566837717851e-8          , 1.1987235594856203e-8           , 2.61959605408878712e-9          , 4.21069491030598786e-10         , 5.54253561394599625e-11         , 6.31310961526782682e-12         , 6.42535085320872487e-13         , 5.96133867956746127e-14         , },
+/* x = 21.8        */  {2.94519134953771643e-8          , 1.14757298857607524e-8          , 2.49653854847719388e-9          , 3.99518014655195541e-10         , 5.23631303709613869e-11         , 5.93982641825952653e-12         , 6.02202191415579657e-13         , 5.56705773741913949e-14         , },
+/* x = 21.9        */  {2.8328911551782661e-8           , 1.09882011981504879e-8          , 2.37976642538293839e-9          , 3.79154893321040885e-10         , 4.94816318274255847e-11         , 5.58993439785796865e-12         , 5.64532710164445424e-13         , 5.20002495421094844e-14         , },
+/* x = 22.0        */  {2.72535148341513359e-8          , 1.05234273948019504e-8          , 2.26893379195397915e-9          , 3.59910122927197848e-10         , 4.67695550707068282e-11         , 5.26189133203356145e-12         , 5.2934283795776031e-13          , 4.85828447297580393e-14         , },
+/* x = 22.1        */  {2.62235061473288727e-8          , 1.00802534614005954e-8          , 2.163715093392837e-9            , 3.41718070934444317e-10         , 4.42163388746877779e-11         , 4.95426127717348147e-12         , 4.96461947817922289e-13         , 4.54002547931197316e-14         , },
+/* x = 22.2        */  {2.52367806066350418e-8          , 9.65758756715224218e-9          , 2.06380384509748247e-9          , 3.24517189049767666e-10         , 4.18121150127925866e-11         , 4.66570695879117761e-12         , 4.65731613339816622e-13         , 4.24357114047047646e-14         , },
+/* x = 22.3        */  {2.42913395061976978e-8          , 9.25439737054798442e-9          , 1.96891144799877742e-9          , 3.08249745654065372e-10         , 3.95476607075301412e-11         , 4.39498272526108492e-12         , 4.37004706991939368e-13         , 3.96736840837022912e-14         , },
+/* x = 22.4        */  {2.3385284545126547e-8           , 8.86970655422117443e-9          , 1.87876608138571015e-9          , 2.92861576563084606e-10         , 3.74143544714127522e-11         , 4.14092802172711437e-12         , 4.10144566975234563e-13         , 3.70997861766591076e-14         , },
+/* x = 22.5        */  {2.25168123893743559e-8          , 8.50259157393561194e-9          , 1.7931116679168346e-9           , 2.78301852815724223e-10         , 3.54041350891744719e-11         , 3.90246134467466113e-12         , 3.85024227298900896e-13         , 3.47006881558180674e-14         , },
+/* x = 22.6        */  {2.16842095485776257e-8          , 8.15217860776618781e-9          , 1.71170690589346925e-9          , 2.64522864280006493e-10         , 3.35094635101889271e-11         , 3.67857464073108563e-12         , 3.61525706157226205e-13         , 3.2464037653528126e-14          , },
+/* x = 22.7        */  {2.08858475485145723e-8          , 7.81764069248273905e-9          , 1.63432436421961086e-9          , 2.51479817955918797e-10         , 3.17232874374866172e-11         , 3.46832811609041748e-12         , 3.39539348081913141e-13         , 3.03783856981984237e-14         , },
+/* x = 22.8        */  {2.01201783810725277e-8          , 7.498195035030094e-9            , 1.56074963579727086e-9          , 2.39130649936493759e-10         , 3.00390084159132449e-11         , 3.27084542556419287e-12         , 3.18963215703195094e-13         , 2.84331186604620492e-14         , },
+/* x = 22.9        */  {1.9385730214786085e-8           , 7.19310048781716042e-9          , 1.49078054540598854e-9          , 2.27435850064461503e-10         , 2.84504512368615264e-11         , 3.08530921266001058e-12         , 2.99702527282900795e-13         , 2.66183954578631686e-14         , },
+/* x = 23.0        */  {1.86811033500974584e-8          , 6.90165517728999508e-9          , 1.42422640839340095e-9          , 2.16358298392050076e-10         , 2.69518354907480902e-11         , 2.91095697429924551e-12         , 2.81669136485885766e-13         , 2.49250896027789678e-14         , },
+/* x = 23.1        */  {1.80049664045071771e-8          , 6.62319427597230651e-9          , 1.36090733676160578e-9          , 2.05863112616471838e-10         , 2.55377491110855557e-11         , 2.74707722582068615e-12         , 2.64781051135088195e-13         , 2.33447357117054563e-14         , },
+/* x = 23.2        */  {1.73560527137315504e-8          , 6.35708790881568464e-9          , 1.30065358947316185e-9          , 1.95917505723722014e-10         , 2.4203123765701373e-11          , 2.59300594379170885e-12         , 2.48961987951884212e-13         , 2.18694801247209968e-14         , },
+/* x = 23.3        */  {1.67331569358680997e-8          , 6.10273918531462705e-9          , 1.24330496402233734e-9          , 1.86490653128905919e-10         , 2.29432119614564943e-11         , 2.44812326587586248e-12         , 2.34140960519245377e-13         , 2.04920353121200776e-14         , },
+/* x = 23.4        */  {1.61351318463958032e-8          , 5.85958234941148094e-9          , 1.18871022652293581e-9          , 1.77553568652749138e-10         , 2.1753565738789205e-11          , 2.31185042859725374e-12         , 2.20251897922120018e-13         , 1.9205637771089913e-14          , },
+/* x = 23.5        */  {1.5560885312607648e-8           , 5.62708103974682848e-9          , 1.13672657775490067e-9          , 1.69078988721548761e-10         , 2.06300168416175985e-11         , 2.18364692530877328e-12         , 2.07233291719011453e-13         , 1.80040091390741359e-14         , },
+/* x = 23.6        */  {1.50093774367924549e-8          , 5.40472665330447012e-9          , 1.08721915278902743e-9          , 1.61041264221887039e-10         , 1.95686582566381255e-11         , 2.06300786802297537e-12         , 1.95027869082323958e-13         , 1.68813202723053767e-14         , },
+/* x = 23.7        */  {1.44796178581547764e-8          , 5.19203680595964986e-9          , 1.04006055197351848e-9          , 1.53416259482222154e-10         , 1.85658270239125014e-11         , 1.9494615380104967e-12          , 1.83582290113988915e-13         , 1.58321580580515912e-14         , },
+/* x = 23.8        */  {1.39706632040891631e-8          , 4.98855388386696827e-9          , 9.95130401218742803e-10         , 1.46181257891243402e-10         , 1.76180882278917255e-11         , 1.84256711121970466e-12         , 1.72846867498359035e-13         , 1.48514947475559156e-14         , },
+/* x = 23.9        */  {1.34816146820112876e-8          , 4.79384368002280938e-9          , 9.52314939658282197e-10         , 1.39314873697860014e-10         , 1.67222200847307198e-11         , 1.74191254563054945e-12         , 1.62775306797459902e-13         , 1.39346596135906993e-14         , },
+/* x = 24.0        */  {1.30116158034961674e-8          , 4.60749411070816783e-9          , 9.11506632895962476e-10         , 1.32796969570095948e-10         , 1.58752000479430988e-11         , 1.64711261863247714e-12         , 1.53324465825417678e-13         , 1.30773127521161133e-14         , },
+/* x = 24.1        */  {1.25598502329856458e-8          , 4.4291140068634469e-9           , 8.7260381017082627e-10          , 1.26608579520182797e-10         , 1.50741918601723611e-11         , 1.55780710341728529e-12         , 1.44454131660159225e-13         , 1.2275420861845016e-14          , },
+/* x = 24.2        */  {1.21255397538058404e-8          , 4.25833197576890917e-9          , 8.35510323885590815e-10         , 1.20731836830959817e-10         , 1.43165334841497688e-11         , 1.47365907420898382e-12         , 1.36126813962150605e-13         , 1.15252348486718702e-14         , },
+/* x = 24.3        */  {1.17079423446827154e-8          , 4.09479532870466857e-9          , 8.00135230049685531e-10         , 1.15149906644470243e-10         , 1.35997258508038617e-11         , 1.3943533309195898e-12          , 1.28307553372776683e-13         , 1.08232691140191548e-14         , },
+/* x = 24.4        */  {1.13063503603623864e-8          , 3.93816907054396412e-9          , 7.66392488286067616e-10         , 1.0984692289754003e-10          , 1.29214223670128118e-11         , 1.31959493452741942e-12         , 1.20963743859680099e-13         , 1.01662823972767105e-14         , },
+/* x = 24.5        */  {1.09200888103341954e-8          , 3.78813494749438504e-9          , 7.34200680142212859e-10         , 1.0480792931128056e-10          , 1.22794191296770933e-11         , 1.24910784512751708e-12         , 1.14064967963625278e-13         , 9.5512600527374485e-15          , },
+/* x = 24.6        */  {1.05485137300208195e-8          , 3.64439054944505535e-9          , 7.03482744530476043e-10         , 1.00018824162001304e-10         , 1.16716457966624077e-11         , 1.1826336552066795e-12          , 1.0758284398183245e-13          , 8.97539765083983684e-15         , },
+/* x = 24.7        */  {1.01910106391423921e-8          , 3.50664846360476564e-9          , 6.7416572920187555e-10          , 9.54663085800726393e-11         , 1.10961570687455984e-11         , 1.1199304112520439e-12          , 1.0149088419678867e-13          , 8.43608580218055007e-15         , },
+/* x = 24.8        */  {9.84699308228241071e-9          , 3.37463547632780527e-9          , 6.46180557230710277e-10         , 9.11378381409542707e-11         , 1.05511247400116337e-11         , 1.06077151731605167e-12         , 9.57643633277936475e-14         , 7.93089611072104893e-15         , },
+/* x = 24.9        */  {9.5159012469835325e-9           , 3.24809182022185998e-9          , 6.19461807555661791e-10         , 8.70215775290039152e-11         , 1.0034830277218135e-11          , 1.00494471463511641e-12         , 9.03801964454024938e-14         , 7.45756816993600882e-15         , },
+/* x = 25.0        */  {9.19720065498259482e-9          , 3.12677046381678296e-9          , 5.93947508686539122e-10         , 8.31063580698989303e-11         , 9.5456578914842403e-12          , 9.52251131837596694e-13         , 8.53168256469124796e-14         , 7.01399752239114506e-15         , },
+/* x = 25.1        */  {8.8903809224576106e-9           , 3.01043644124523462e-9          , 5.69578944744928838e-10         , 7.93816379416281833e-11         , 9.08208806829024478e-12         , 9.02504400681531288e-13         , 8.05541148444986438e-14         , 6.59822450944052873e-15         , },
+/* x = 25.2        */  {8.59495458540625691e-9          , 2.89886621954696628e-9          , 5.46300473062034649e-10         , 7.58374648871236394e-11         , 8.64269152420948702e-12         , 8.55529832636644425e-13         , 7.60732520668943234e-14         , 6.20842394344248686e-15         , },
+/* x = 25.3        */  {8.31045598650660469e-9          , 2.79184710135868201e-9          , 5.24059352608221224e-10         , 7.24644412637757615e-11         , 8.22612356104914761e-12         , 8.11163651970770478e-13         , 7.18566587209685475e-14         , 5.8428955401485862e-15          , },
+/* x = 25.4        */  {8.03644022002755127e-9          , 2.68917666089168245e-9          , 5.02805582576486846e-10         , 6.92536912763830199e-11         , 7.83111879016564443e-12         , 7.69252281320289305e-13         , 6.78879053014773155e-14         , 5.50005505375868364e-15         , },
+/* x = 25.5        */  {7.77248213155956974e-9          , 2.59066221123055327e-9          , 4.82491750486529839e-10         , 6.61968302505875313e-11         , 7.45648620165572767e-12         , 7.29651676019439208e-13         , 6.41516330759399343e-14         , 5.17842606159024736e-15         , },
+/* x = 25.6        */  {7.51817536952687018e-9          , 2.49612030110863829e-9          , 4.63072889217476704e-10         , 6.32859358136051715e-11         , 7.10110455491780661e-12         , 6.92226703736355968e-13         , 6.06334813072721472e-14         , 4.87663234941301437e-15         , },
+/* x = 25.7        */  {7.27313148562070542e-9          , 2.40537623943052083e-9          , 4.4450634241592096e-10          , 6.05135208581240568e-11         , 6.7639180687401902e-12          , 6.56850566216098074e-13         , 5.73200196097313165e-14         , 4.59339085227892304e-15         , },
+/* x = 25.8        */  {7.03697908146111972e-9          , 2.31826364591876885e-9          , 4.26751637761880289e-10         , 5.7872508173670574e-11          , 6.44393239061367636e-12         , 6.23404260164348096e-13         , 5.41986850641129798e-14         , 4.32750510915819418e-15         , },
+/* x = 25.9        */  {6.80936299895165356e-9          , 2.2346240263622864e-9           , 4.09770367608800836e-10         , 5.53562066375738744e-11         , 6.1402108263944013e-12          , 5.91776074521390898e-13         , 5.1257723746182742e-14          , 4.07785919289935608e-15         , },
+/* x = 26.0        */  {6.58994355193905019e-9          , 2.15430637103722673e-9          , 3.93526076544992736e-10         , 5.29582888649411268e-11         , 5.85187081276747771e-12         , 5.61861121575708862e-13         , 4.84861363482167037e-14         , 3.8434120799858877e-15          , },
+/* x = 26.1        */  {6.37839579692848718e-9          , 2.07716677495899642e-9          , 3.77984155453029343e-10         , 5.06727702238268318e-11         , 5.57808061619048062e-12         , 5.33560899551344142e-13         , 4.58736275974267335e-14         , 3.62319242728517274e-15         , },
+/* x = 26.2        */  {6.17440884073486058e-9          , 2.0030680787058233e-9           , 3.63111741670831623e-10         , 4.84939891280770973e-11         , 5.31805624313545698e-12         , 5.0678288447420252e-13          , 4.34105591971195776e-14         , 3.41629372549515343e-15         , },
+/* x = 26.3        */  {5.97768518307272538e-9          , 1.93187952863105051e-9          , 3.48877624883525527e-10         , 4.64165885261882058e-11         , 5.07105854750546423e-12         , 4.81440149280767456e-13         , 4.10879060368243609e-14         , 3.22186980130748045e-15         , },
+/* x = 26.4        */  {5.78794009220215071e-9          , 1.8634764553531074e-9           , 3.35252158398830956e-10         , 4.4435498509969724e-11          , 4.83639052208280486e-12         , 4.57451008279228429e-13         , 3.88972154364532966e-14         , 3.03913064243872221e-15         , },
+/* x = 26.5        */  {5.60490101185545594e-9          , 1.7977399694793213e-9           , 3.22207175480833801e-10         , 4.25459199718751504e-11         , 4.61339476177676803e-12         , 4.34738685208701099e-13         , 3.68305692069567541e-14         , 2.8673385216477059e-15          , },
+/* x = 26.6        */  {5.4283069977709955e-9           , 1.73455667358267823e-9          , 3.09715910437616964e-10         , 4.07433092445848089e-11         , 4.40145108728403991e-12         , 4.13231003267854398e-13         , 3.48805483260079045e-14         , 2.70580439767052891e-15         , },
+/* x = 26.7        */  {5.25790818225526987e-9          , 1.67381838950959718e-9          , 2.97752924177483598e-10         , 3.90233636608215136e-11         , 4.19997431855982419e-12         , 3.92860095600623648e-13         , 3.30402000421068049e-14         , 2.55388457267735235e-15         , },
+/* x = 26.8        */  {5.0934652652840417e-9           , 1.61542190015201766e-9          , 2.86294033966490422e-10         , 3.73820079754727467e-11         , 4.00841218822658325e-12         , 3.73562134834481902e-13         , 3.13030072342236476e-14         , 2.41097758739793371e-15         , },
+/* x = 26.9        */  {4.93474903073719047e-9          , 1.55926870486885714e-9          , 2.75316247136808192e-10         , 3.58153815959052662e-11         , 3.8262433857242895e-12          , 3.55277080366612386e-13         , 2.96628598667931639e-14         , 2.27652133648624066e-15         , },
+/* x = 27.0        */  {4.78153988644108153e-9          , 1.50526478779040457e-9          , 2.64797698511121739e-10         , 3.43198265699091789e-11         , 3.652975723634975e-12           , 3.37948442185871284e-13         , 2.81140283916070956e-14         , 2.14999038800785226e-15         , },
+/* x = 27.1        */  {4.63362742676657088e-9          , 1.45332039828469047e-9          , 2.54717591322948686e-10         , 3.28918762840171076e-11         , 3.48814441819870806e-12         , 3.21523060104204094e-13         , 2.66511389590031739e-14         , 2.03089349214587677e-15         , },
+/* x = 27.2        */  {4.490810016600708e-9            , 1.40334984290751175e-9          , 2.45056141426464398e-10         , 3.15282448280272913e-11         , 3.33131047658116528e-12         , 3.05950897350689699e-13         , 2.52691503107852792e-14         , 1.91877126533978108e-15         , },
+/* x = 27.3        */  {4.35289439557601075e-9          , 1.35527128819777645e-9          , 2.35794524602235935e-10         , 3.02258169844332136e-11         , 3.182059183957719e-12           , 2.91184847555104228e-13         , 2.39633322365931319e-14         , 1.81319403710417791e-15         , },
+/* x = 27.4        */  {4.21969530150312424e-9          , 1.30900657371734095e-9          , 2.26914826777250459e-10         , 2.89816388041413975e-11         , 3.03999868394820945e-12         , 2.7718055421625576e-13          , 2.27292454840288137e-14         , 1.71375984772800748e-15         , },
+/* x = 27.5        */  {4.09103511201098043e-9          , 1.26448103476970224e-9          , 2.18399996988829983e-10         , 2.77929087323570149e-11         , 2.90475864637289675e-12         , 2.63896241813741468e-13         , 2.15627230207948991e-14         , 1.62009258593489588e-15         , },
+/* x = 27.6        */  {3.96674350345347021e-9          , 1.2216233342649294e-9           , 2.10233802932506956e-10         , 2.66569692508466228e-11         , 2.77598901670587504e-12         , 2.51292557780590933e-13         , 2.04598525544541048e-14         , 1.53184025639848971e-15         , },
+/* x = 27.7        */  {3.84665712619333532e-9          , 1.18036530322921218e-9          , 2.0240078894374265e-10          , 2.55712990049604258e-11         , 2.65335884197968787e-12         , 2.39332424608824752e-13         , 1.94169602222284002e-14         , 1.44867336775751829e-15         , },
+/* x = 27.8        */  {3.73061929542267961e-9          , 1.14064178948649981e-9          , 1.94886236272547953e-10         , 2.45335053858238911e-11         , 2.53655516824605291e-12         , 2.27980901410591692e-13         , 1.84305953695581812e-14         , 1.3702834324690635e-15          , },
+/* x = 27.9        */  {3.61847969672537161e-9          , 1.10239051406702338e-9          , 1.87676125518656194e-10         , 2.35413175400004396e-11         , 2.42528200502437853e-12         , 2.1720505430454214e-13          , 1.7497516341977887e-14          , 1.29638157047948076e-15         , },
+/* x = 28.0        */  {3.51009410562983456e-9          , 1.06555193492315167e-9          , 1.80757101102939176e-10         , 2.25925797806927124e-11         , 2.31925935247388415e-12         , 2.06973835040719713e-13         , 1.66146772202687958e-14         , 1.22669720928471668e-15         , },
+/* x = 28.1        */  {3.40532412044145784e-9          , 1.03006911755713132e-9          , 1.74116437658287295e-10         , 2.16852453761982896e-11         , 2.21822228730824498e-12         , 1.97257967317755613e-13         , 1.57792154338554036e-14         , 1.16097687349918691e-15         , },
+/* x = 28.2        */  {3.30403690768226435e-9          , 9.95887612187904791e-10         , 1.67742008230226305e-10         , 2.08173706928748259e-11         , 2.12192010373527054e-12         , 1.88029840283761608e-13         , 1.49884401920489521e-14         , 1.09898305755839228e-15         , },
+/* x = 28.3        */  {3.20610495950167452e-9          , 9.62955337105477674e-10         , 1.6162225418414881e-10          , 1.99871096713068891e-11         , 2.0301155059495879e-12          , 1.79263408747250036e-13         , 1.4239821677038173e-14          , 1.04049317564826463e-15         , },
+/* x = 28.4        */  {3.11140586245634992e-9          , 9.31222467881305446e-10         , 1.55746156722227149e-10         , 1.91927086157093339e-11         , 1.94258384893492428e-12         , 1.70934099656859634e-13         , 1.35309809465088497e-14         , 9.85298583386798159e-16         , },
+/* x = 28.5        */  {3.01982207708930295e-9          , 9.0064133212197039e-10          , 1.50103209918873679e-10         , 1.84325012778563058e-11         , 1.85911242454556451e-12         , 1.63018724438815899e-13         , 1.28596804974640731e-14         , 9.33203666183555733e-16         , },
+/* x = 28.6        */  {2.93124072776883899e-9          , 8.71166309471096731e-10         , 1.44683395189049895e-10         , 1.77049042179969864e-11         , 1.77949979003500457e-12         , 1.5549539680907239e-13          , 1.22238154462379732e-14         , 8.84024989572646185e-16         , },
+/* x = 28.7        */  {2.84555340227656286e-9          , 8.42753736581076736e-10         , 1.39477157108821376e-10         , 1.7008412426314558e-11          , 1.70355513638475971e-12         , 1.4834345570312018e-13          , 1.16214052828674351e-14         , 8.37590507157057198e-16         , },
+/* x = 28.8        */  {2.76265596066073438e-9          , 8.1536181679181823e-10          , 1.34475380512333264e-10         , 1.63415951895088042e-11         , 1.63109769395866655e-12         , 1.4154339299066053e-13          , 1.10505861609275119e-14         , 7.93738822118923969e-16         , },
+/* x = 28.9        */  {2.68244835289679358e-9          , 7.88950534268436194e-10         , 1.29669368793861668e-10         , 1.57030921880401129e-11         , 1.56195617316872597e-12         , 1.35076785664843812e-13         , 1.05096036866641447e-14         , 7.52318498543377677e-16         , },
+/* x = 29.0        */  {2.60483444492098487e-9          , 7.63481572363655261e-10         , 1.25050823347799244e-10         , 1.50916098104679039e-11         , 1.4959682379883858e-12          , 1.28926232216708878e-13         , 9.99680617378829196e-15         , 7.13187419074855788e-16         , },
+/* x = 29.1        */  {2.52972185262577431e-9          , 7.38918235983719782e-10         , 1.20611824083376322e-10         , 1.45059176721538763e-11         , 1.43298001028891967e-12         , 1.23075292924925526e-13         , 9.51063833264334609e-15         , 6.76212185675834343e-16         , },
+/* x = 29.2        */  {2.4570217834272555e-9           , 7.15225377748873938e-10         , 1.16344810954619001e-10         , 1.39448453263838256e-11         , 1.37284560310492464e-12         , 1.17508433809053829e-13         , 9.04963536463634077e-15         , 6.41267560490396163e-16         , },
+/* x = 29.3        */  {2.38664888503504982e-9          , 6.92369327751023157e-10         , 1.12242566449518345e-10         , 1.34072791566947685e-11         , 1.31542668105658999e-12         , 1.12210974011385679e-13         , 8.61241743484546126e-15         , 6.08235944030294615e-16         , },
+/* x = 29.4        */  {2.31852110107439635e-9          , 6.70317826722063827e-10         , 1.08298198985644794e-10         , 1.2892159439880092e-11          , 1.26059204626988932e-12         , 1.07169036388116311e-13         , 8.19768449759334729e-15         , 5.77006888100516258e-16         , },
+/* x = 29.5        */  {2.25255953322826116e-9          , 6.49039962436612212e-10         , 1.04505127162502651e-10         , 1.23984775697875485e-11         , 1.20821724824178143e-12         , 1.02369501105190631e-13         , 7.80421145151832523e-15         , 5.47476641065992205e-16         , },
+/* x = 29.6        */  {2.18868830958443481e-9          , 6.28506109182514028e-10         , 1.00857064823793963e-10         , 1.19252734326260843e-11         , 1.15818421619639521e-12         , 9.77999620477584204e-14         , 7.43084360229391827e-15         , 5.19547723232168676e-16         , },
+/* x = 29.7        */  {2.12683445888878995e-9          , 6.08687870141609502e-10         , 9.73480068854609082e-11         , 1.14716329250604195e-11         , 1.11038091257050592e-12         , 9.34486858648258852e-14         , 7.07649241264990703e-15         , 4.93128530270647663e-16         , },
+/* x = 29.8        */  {2.06692779042119044e-9          , 5.89558022531798622e-10         , 9.39722158879121994e-11         , 1.10366856068995322e-11         , 1.06470100635283544e-12         , 8.93045734824750584e-14         , 6.74013152074430336e-15         , 4.68132962767995002e-16         , },
+/* x = 29.9        */  {2.00890077922503132e-9          , 5.71090465369529393e-10         , 9.07242092332222715e-11         , 1.06196024806790987e-11         , 1.02104356508224696e-12         , 8.53571239299990783e-14         , 6.42079300923267895e-15         , 4.44480080111959003e-16         , },
+/* x = 30.0        */  {1.95268845643509183e-9          , 5.53260169719447877e-10         , 8.75987470703318439e-11         , 1.02195938909006918e-11         , 9.79312764385143795e-13         , 8.15964003335274827e-14         , 6.11756390858658894e-15         , 4.22093777055554151e-16         , },
+/* x = 30.1        */  {1.89822830446134752e-9          , 5.36043131305130349e-10         , 8.45908207933838524e-11         , 9.83590753612419991e-12         , 9.39417614002684658e-13         , 7.80129979412444631e-14         , 5.82958291933303957e-15         , 4.00902481416485633e-16         , },
+/* x = 30.2        */  {1.84546015679865337e-9          , 5.1941632536159113e-10          , 8.16956421203081828e-11         , 9.46782658751639264e-12         , 9.01271699324130244e-13         , 7.45980140531836593e-14         , 5.55603733892825775e-15         , 3.80838871477908646e-16         , },
+/* x = 30.3        */  {1.79432610224381781e-9          , 5.03357663616648958e-10         , 7.89086327206299862e-11         , 9.11466790783961374e-12         , 8.64792937504050351e-13         , 7.13430197368611586e-14         , 5.29616017994715549e-15         , 3.61839611757166238e-16         , },
+/* x = 30.4        */  {1.74477039331257513e-9          , 4.87845953294262905e-10         , 7.62254143632269953e-11         , 8.77578036522187837e-12         , 8.29903347298537997e-13         , 6.82400332177261824e-14         , 5.04922746717014483e-15         , 3.43845105902516881e-16         , },
+/* x = 30.5        */  {1.69673935865936535e-9          , 4.72860858038637452e-10         , 7.36417995564080758e-11         , 8.45054323638473458e-12         , 7.96528831809267108e-13         , 6.52814948406057291e-14         , 4.81455570198625308e-15         , 3.26799265564489452e-16         , },
+/* x = 30.6        */  {1.65018131931267961e-9          , 4.58382860663265336e-10         , 7.11537826542346943e-11         , 8.1383646943195598e-12          , 7.64598973374444751e-13         , 6.2460243505031597e-14          , 4.59149948331035703e-15         , 3.1064929416888893e-16          , },
+/* x = 30.7        */  {1.60504650854805664e-9          , 4.44393227634145201e-10         , 6.87575314044650762e-11         , 7.838680375697844e-12           , 7.3404683989268119e-13          , 5.97694944835995174e-14         , 4.3794492749370016e-15          , 2.953454845930831e-16           , },
+/* x = 30.8        */  {1.56128699522965021e-9          , 4.30873975201196457e-10         , 6.64493789148732208e-11         , 7.55095202357771479e-12         , 7.04808801909748888e-13         , 5.72028185383519275e-14         , 4.17782930992758749e-15         , 2.80841029816455828e-16         , },
+/* x = 30.9        */  {1.51885661045965765e-9          , 4.17807837096412877e-10         , 6.42258160159868968e-11         , 7.27466620122865546e-12         , 6.76824359839327287e-13         , 5.47541222556273126e-14         , 3.98609562325530994e-15         , 2.67091845680210902e-16         , },
+/* x = 31.0        */  {1.47771087738282932e-9          , 4.05178233721564737e-10         , 6.2083483999505204e-11          , 7.00933307314014481e-12         , 6.50035980727322099e-13         , 5.24176295249070645e-14         , 3.80373420451644689e-15         , 2.54056404951416767e-16         , },
+/* x = 31.1        */  {1.43780694400079502e-9          , 3.92969242752291488e-10         , 6.00191677128018771e-11         , 6.75448524950882658e-12         , 6.2438894400538137e-13          , 5.01878640919405229e-14         , 3.63025926306052464e-15         , 2.41695581941634116e-16         , },
+/* x = 31.2        */  {1.39910351885806638e-9          , 3.81165571089236758e-10         , 5.80297889909995488e-11         , 6.50967669071374556e-12         , 5.99831195712968866e-13         , 4.80596331208635959e-14         , 3.46521159839840049e-15         , 2.2997250698197716e-16          , },
+/* x = 31.3        */  {1.36156080946832758e-9          , 3.6975252809047774e-10          , 5.61124004091167309e-11         , 6.27448166849105526e-12         , 5.76313210698950535e-13         , 4.60280117041677287e-14         , 3.3081570692190517e-15          , 2.18852430104313913e-16         , },
+/* x = 31.4        */  {1.32514046335602984e-9          , 3.58716000022903966e-10         , 5.42641793377471105e-11         , 6.04849378070923668e-12         , 5.53787862343243365e-13         , 4.40883282632441291e-14         , 3.15868515478531307e-15         , 2.08302593322777887e-16         , },
+/* x = 31.5        */  {1.28980551159437714e-9          , 3.4804242567341738e-10          , 5.24824222866334425e-11         , 5.83132501682404266e-12         , 5.32210299366799887e-13         , 4.22361507858417292e-14         , 3.0164076028882439e-15          , 1.98292110951089926e-16         , },
+/* x = 31.6        */  {1.25552031472655004e-9          , 3.3771877306386724e-10          , 5.07645395213491804e-11         , 5.62260487125982178e-12         , 5.11537829324178698e-13         , 4.0467273850153753e-14          , 2.88095715892134764e-15         , 1.88791857429602994e-16         , },
+/* x = 31.7        */  {1.22225051096247794e-9          , 3.27732517216509746e-10         , 4.91080499391031398e-11         , 5.42197950212125348e-12         , 4.91729808397296225e-13         , 3.87777063884030875e-14         , 2.75198637099147735e-15         , 1.79774362171695839e-16         , },
+/* x = 31.8        */  {1.18996296654865377e-9          , 3.18071618919502871e-10         , 4.75105761904388607e-11         , 5.2291109327874756e-12          , 4.72747537131774222e-13         , 3.71636601457459476e-14         , 2.62916646631475825e-15         , 1.71213710972349168e-16         , },
+/* x = 31.9        */  {1.15862572821340434e-9          , 3.0872450444452049e-10          , 4.59698400343136579e-11         , 5.04367629407969456e-12         , 4.54554161778690762e-13         , 3.56215387930705202e-14         , 2.5121862944549358e-15          , 1.63085453552621365e-16         , },
+/* x = 32.0        */  {1.12820797759469811e-9          , 2.99680046171004982e-10         , 4.44836579147151997e-11         , 4.86536710482419087e-12         , 4.37114580924602374e-13         , 3.41479276548453555e-14         , 2.4007513332497799e-15          , 1.55366516842467479e-16         , },
+/* x = 32.1        */  {1.09867998756200407e-9          , 2.90927544073881809e-10         , 4.30499367476082348e-11         , 4.69388858875568235e-12         , 4.20395357111518134e-13         , 3.27395840155833149e-14         , 2.29458275353999909e-15         , 1.48035123631070312e-16         , },
+/* x = 32.2        */  {1.07001308034792295e-9          , 2.82456708033740576e-10         , 4.16666699076030577e-11         , 4.5289590258217684e-12          , 4.04364633166153549e-13         , 3.13934279707421086e-14         , 2.19341653906589281e-15         , 1.4107071623871983e-16          , },
+/* x = 32.3        */  {1.04217958740930754e-9          , 2.74257640930551697e-10         , 4.03319334043025831e-11         , 4.37030913605810111e-12         , 3.88992052974348204e-13         , 3.01065337899923147e-14         , 2.09700265813094687e-15         , 1.34453884887419751e-16         , },
+/* x = 32.4        */  {1.01515281094138293e-9          , 2.6632082248394253e-10          , 3.90438822388184737e-11         , 4.21768149430643525e-12         , 3.74248686452066739e-13         , 2.88761217627579953e-14         , 2.00510428384992355e-15         , 1.28166300468941468e-16         , },
+/* x = 32.5        */  {9.88906986971982347e-10         , 2.58637093804907918e-10         , 3.78007469314505019e-11         , 4.07082997414419456e-12         , 3.60106958478983107e-13         , 2.7699550497782649e-14          , 1.91749706000279018e-15         , 1.22190651429099685e-16         , },
+/* x = 32.6        */  {9.63417249966437609e-10         , 2.51197642625583199e-10         , 3.66008302119989726e-11         , 3.92951921948502578e-12         , 3.46540581574334607e-13         , 2.65743096502027096e-14         , 1.83396840970607565e-15         , 1.16510584505697048e-16         , },
+/* x = 32.7        */  {9.38659598876917241e-10         , 2.4399398917536845e-10          , 3.54425038646292362e-11         , 3.79352414239534011e-12         , 3.33524492107581851e-13         , 2.54980130512299502e-14         , 1.75431688429087192e-15         , 1.11110649074974953e-16         , },
+/* x = 32.8        */  {9.14610864573096645e-10         , 2.37017972673266088e-10         , 3.43242057196316165e-11         , 3.662629445752389e-12           , 3.21034789848476943e-13         , 2.44683922170602874e-14         , 1.67835154994257596e-15         , 1.05976244877605384e-16         , },
+/* x = 32.9        */  {8.91248678593983478e-10         , 2.30261738407784817e-10         , 3.32444367848209219e-11         , 3.53662916944529009e-12         , 3.09048680672474568e-13         , 2.34832902150464219e-14         , 1.60589140981239896e-15         , 1.01093572910348508e-16         , },
+/* x = 33.0        */  {8.68551443163514767e-10         , 2.23717725377175848e-10         , 3.22017585096984545e-11         , 3.41532625889189391e-12         , 2.97544422248065818e-13         , 2.25406558665018166e-14         , 1.53676485945540367e-15         , 9.64495892835609825e-17         , },
+/* x = 33.1        */  {8.46498302415198117e-10         , 2.17378654464106609e-10         , 3.11947901758573649e-11         , 3.29853215471172928e-12         , 2.86501272542615925e-13         , 2.16385382667496344e-14         , 1.47080917358506119e-15         , 9.20319618578430527e-17         , },
+/* x = 33.2        */  {8.25069114773594849e-10         , 2.11237517120146843e-10         , 3.02222064074505115e-11         , 3.18606640245873343e-12         , 2.75899440992685196e-13         , 2.07750816041979207e-14         , 1.40787002226069231e-15         , 8.78290294853257387e-17         , },
+/* x = 33.3        */  {8.04244426442844633e-10         , 2.05287564536645862e-10         , 2.92827347958598123e-11         , 3.07775628137729665e-12         , 2.65720042193645248e-13         , 1.99485202613166635e-14         , 1.34780101474227593e-15         , 8.38297636924851852e-17         , },
+/* x = 33.4        */  {7.84005445954715751e-10         , 1.99522297279721445e-10         , 2.83751536330084745e-11         , 2.97343645120154857e-12         , 2.55945051971705615e-13         , 1.91571741814181772e-14         , 1.29046326935752731e-15         , 8.00237326519874233e-17         , },
+/* x = 33.5        */  {7.64334019730838452e-10         , 1.9393545536816368e-10          , 2.74982897480434538e-11         , 2.87294861607098991e-12         , 2.46557265709272072e-13         , 1.8399444486103996e-14          , 1.2357250078293912e-15          , 7.64010673009671066e-17         , },
+/* x = 33.6        */  {7.45212608615846702e-10         , 1.8852100877408432e-10          , 2.66510164423859702e-11         , 2.77614120468572193e-12         , 2.37540258801898534e-13         , 1.7673809329143285e-14          , 1.18346117260864281e-15         , 7.29524294723780937e-17         , },
+/* x = 33.7        */  {7.26624265340121439e-10         , 1.83273148327116807e-10         , 2.58322515184037658e-11         , 2.68286906587182608e-12         , 2.2887834913199821e-13          , 1.69788199733935744e-14         , 1.13355306584659342e-15         , 6.96689819146683352e-17         , },
+/* x = 33.8        */  {7.08552612872701264e-10         , 1.78186277003896982e-10         , 2.50409553972008664e-11         , 2.59299317877206822e-12         , 2.20556561450973801e-13         , 1.63130970781679932e-14         , 1.08588800872737464e-15         , 6.65423600830693599e-17         , },
+/* x = 33.9        */  {6.90981823626709248e-10         , 1.73255001585432189e-10         , 2.42761293212496815e-11         , 2.50638037691920314e-12         , 2.12560593567536411e-13         , 1.56753271851975248e-14         , 1.04035901995831685e-15         , 6.35646455932916346e-17         , },
+/* x = 34.0        */  {6.7389659948134173e-10          , 1.68474124665799675e-10         , 2.35368136378070756e-11         , 2.42290308548888635e-12         , 2.04876784245732092e-13         , 1.5064259392035259e-14          , 9.96864512290904761e-16         , 6.07283412354182697e-17         , },
+/* x = 34.1        */  {6.57282152586081002e-10         , 1.63838636996406116e-10         , 2.28220861592612628e-11         , 2.34243907106669866e-12         , 1.97492082721605858e-13         , 1.44787022024051281e-14         , 9.55308006014024693e-16         , 5.80263474523253533e-17         , },
+/* x = 34.2        */  {6.41124186914332724e-10         , 1.59343710150791162e-10         , 2.21310605967506667e-11         , 2.26487120329918893e-12         , 1.90394019752526322e-13         , 1.39175205436129301e-14         , 9.15597858426028069e-16         , 5.54519401930596253e-17         , },
+/* x = 34.3        */  {6.25408880535154669e-10         , 1.5498468949567106e-10          , 2.14628850635798504e-11         , 2.19008722783226203e-12         , 1.83570680117989245e-13         , 1.33796329417151216e-14         , 8.77647008352816803e-16         , 5.29987500573029423e-17         , },
+/* x = 34.4        */  {6.10122868573139589e-10         , 1.50757087454595847e-10         , 2.08167406451318486e-11         , 2.11797954997179968e-12         , 1.77010676495233541e-13         , 1.28640088456833082e-14         , 8.41372734835981641e-16         , 5.06607426523756591e-17         , },
+/* x = 34.5        */  {5.95253226827845247e-10         , 1.46656577051237066e-10         , 2.01918400321412506e-11         , 2.04844502853120979e-12         , 1.70703124637255604e-13         , 1.23696660923117986e-14         , 8.06696429168247931e-16         , 4.84322000892033201e-17         , },
+/* x = 34.6        */  {5.80787456025432105e-10         , 1.42678985719934326e-10         , 1.95874262143487122e-11         , 1.98138477935875597e-12         , 1.64637619784813279e-13         , 1.18956685040941158e-14         , 7.7354337950334187e-16          , 4.63077035483167846e-17         , },
+/* x = 34.7        */  {5.66713466676377032e-10         , 1.38820289371709948e-10         , 1.90027712317056907e-11         , 1.9167039880641207e-12          , 1.58804214247784287e-13         , 1.14411236127439271e-14         , 7.41842567314104541e-16         , 4.42821168512972727e-17         , },
+/* x = 34.8        */  {5.53019564514282658e-10         , 1.35076606704513004e-10         , 1.84371749804385555e-11         , 1.85431173148879118e-12         , 1.53193396094799477e-13         , 1.10051805014582794e-14         , 7.11526475016456911e-16         , 4.23505709771354559e-17         , },
+/* x = 34.9        */  {5.39694436491899374e-10         , 1.31444193746978818e-10         , 1.78899640714142529e-11         , 1.79412080748861219e-12         , 1.47796068893422065e-13         , 1.05870277594180277e-14         , 6.82530904117848045e-16         , 4.05084494667668071e-17         , },
+/* x = 35.0        */  {5.2672713731152326e-10          , 1.27919438625488849e-10         , 1.73604907383758008e-11         , 1.73604757261930385e-12         , 1.42603532446302332e-13         , 1.01858915423934981e-14         , 6.54794803287280143e-16         , 3.87513746625918217e-17         , },
+/* x = 35.1        */  {5.14107076467930784e-10         , 1.24498856544790119e-10         , 1.68481317937354366e-11         , 1.68001178733696906e-12         , 1.37607464471714604e-13         , 9.80103373367423973e-15         , 6.28260105780064302e-16         , 3.70751947331060235e-17         , },
+/* x = 35.2        */  {5.01824005782962472e-10         , 1.21179084972884413e-10         , 1.63522876297265946e-11         , 1.62593646834568572e-12         , 1.32799903179690637e-13         , 9.43175019987157368e-15         , 6.02871575684275781e-16         , 3.54759714358663373e-17         , },
+/* x = 35.3        */  {4.89868007411775111e-10         , 1.17956879021326331e-10         , 1.58723812628233876e-11         , 1.57374774774325859e-12         , 1.28173230697610801e-13         , 9.07736913645284893e-15         , 5.78576662487592191e-16         , 3.39499685749218172e-17         , },
+/* x = 35.4        */  {4.78229482301647547e-10         , 1.14829107012477297e-10         , 1.5407857419438227e-11          , 1.52337473863415688e-12         , 1.23720157301611321e-13         , 8.73724949815808622e-15         , 5.55325363492947803e-16         , 3.24936411115512564e-17         , },
+/* x = 35.5        */  {4.66899139085050894e-10         , 1.11792746225650738e-10         , 1.49581816610049381e-11         , 1.47474940689564458e-12         , 1.1943370641252121e-13          , 8.41077950972416859e-15         , 5.33070093639348523e-16         , 3.11036248896903293e-17         , },
+/* x = 35.6        */  {4.55867983389481797e-10         , 1.08844878814452894e-10         , 1.45228395466464923e-11         , 1.42780644879917646e-12         , 1.15307200317264666e-13         , 8.09737525259998944e-15         , 5.11765562310383032e-16         , 2.97767269398082411e-17         , },
+/* x = 35.7        */  {4.45127307547309256e-10         , 1.05982687887975143e-10         , 1.41013358317135541e-11         , 1.38248317420433496e-12         , 1.11334246578761698e-13         , 7.79647932357899641e-15         , 4.91368656737546113e-16         , 2.85099163272191795e-17         , },
+/* x = 35.8        */  {4.34668680689603071e-10         , 1.03203453748828128e-10         , 1.36931937005626828e-11         , 1.33871939505697028e-12         , 1.07508725099338717e-13         , 7.50755956150430431e-15         , 4.71838331628563362e-16         , 2.73003155128972563e-17         , },
+/* x = 35.9        */  {4.24483939208596865e-10         , 1.00504550281326311e-10         , 1.32979540320214647e-11         , 1.29645731893682437e-12         , 1.0382477580452889e-13          , 7.23010783841687025e-15         , 4.53135504672568087e-16         , 2.6145192196814459e-17          , },
+/* x = 36.0        */  {4.14565177574092549e-10         , 9.78834414834345877e-11         , 1.29151746960623204e-11         , 1.25564144741281119e-12         , 1.00276786915905625e-13         , 6.96363891171994798e-15         , 4.35222957594321124e-16         , 2.50419516156481501e-17         , },
+/* x = 36.1        */  {4.04904739489737335e-10         , 9.53376781363771444e-11         , 1.25444298802774298e-11         , 1.21621847897633235e-12         , 9.68593837832577242e-14         , 6.70768933412393297e-15         , 4.18065242448766226e-16         , 2.39881292684159947e-17         , },
+/* x = 36.2        */  {3.95495209375700583e-10         , 9.28648946060834607e-11         , 1.21853094448143536e-11         , 1.17813721633456605e-12         , 9.35674182479873134e-14         , 6.46181641831549601e-15         , 4.01628592865155931e-16         , 2.29813840451994463e-17         , },
+/* x = 36.3        */  {3.86329404164847049e-10         , 9.04628057709080199e-11         , 1.18374183044956941e-11         , 1.14134847785661515e-12         , 9.03959585110969339e-14         , 6.22559725346425243e-15         , 3.8588083996683855e-16          , 2.20194917356191672e-17         , },
+/* x = 36.4        */  {3.77400365400046917e-10         , 8.81292040703095131e-11         , 1.15003758369067013e-11         , 1.10580501297577019e-12         , 8.73402794805352861e-14         , 5.99862777083975924e-15         , 3.70791332708634481e-16         , 2.11003388951335825e-17         , },
+/* x = 36.5        */  {3.6870135162078242e-10          , 8.58619566694127382e-11         , 1.11738153152922656e-11         , 1.07146142136096783e-12         , 8.4395853573996756e-14          , 5.7805218559619645e-15          , 3.56330862388613401e-16         , 2.02219170485513242e-17         , },
+},
+/* n = 12 */
+{
+/* x = 0.0         */  {0.04                            , 0.037037037037037037            , 0.0172413793103448276           , 0.00537634408602150538          , 0.00126262626262626263          , 0.000238095238095238095         , 0.0000375375375375375375        , 5.08750508750508751e-6          , },
+/* x = 0.1         */  {0.0364634576640223775           , 0.0337451178229993164           , 0.0157019079625549209           , 0.00489436982685486641          , 0.00114903536646782882          , 0.000216608008606702166         , 0.0000341404035568716858        , 4.62592531656958086e-6          , },
+/* x = 0.2         */  {0.0332411833626609533           , 0.0307470774713549343           , 0.0143004233107517094           , 0.00445574956067386986          , 0.0010456942924331183           , 0.000197065136021829926         , 0.000031051452130916084         , 4.20631532223344205e-6          , },
+/* x = 0.3         */  {0.0303051267284859535           , 0.028016579217384951            , 0.013024515156396509            , 0.00405657177479990493          , 0.000951675654935031304         , 0.000179290250372596202         , 0.0000282426640814494984        , 3.82485133865633963e-6          , },
+/* x = 0.4         */  {0.0276297507890642893           , 0.0255296546137099154           , 0.0118628928340802597           , 0.0036932788210449504           , 0.000866136181183410103         , 0.000163123015225223968         , 0.0000256885727609398705        , 3.47805861006915914e-6          , },
+/* x = 0.5         */  {0.0251918059849458768           , 0.0232644899110134958           , 0.0108052839423654819           , 0.00336263482409408797          , 0.000788309065369455797         , 0.000148417667166463067         , 0.0000233660310923770222        , 3.1627794818036601e-6           , },
+/* x = 0.6         */  {0.0229701245682274232           , 0.021201231759715957            , 0.00984234225762683628          , 0.00306169650671250995          , 0.000717497019253486732         , 0.000135041688574549021         , 0.0000212539999063419641        , 2.87614441318179429e-6          , },
+/* x = 0.7         */  {0.0209454335385801877           , 0.0193218104807822699           , 0.00896556399632563342          , 0.00278778666612824092          , 0.000653065955608431456         , 0.000122874601490882132         , 0.0000193333556252930949        , 2.61554564433085797e-6          , },
+/* x = 0.8         */  {0.0191001844407235081           , 0.0176097793130413199           , 0.00816721166715438939          , 0.00253847006018052015          , 0.000594439246780082185         , 0.000111806871523976557         , 0.0000175867155238541204        , 2.37861327359277968e-6          , },
+/* x = 0.9         */  {0.0174183984992383498           , 0.0160501681890886855           , 0.00744024482355427689          , 0.0023115314838471248           , 0.000541092505901993068         , 0.000101738911730460176         , 0.0000159982789562759482        , 2.16319352453617145e-6          , },
+/* x = 1.0         */  {0.0158855257047271492           , 0.014629350723368204            , 0.00677825708987479652          , 0.00210495583677465636          , 0.000492548843096745021         , 0.0000925801773382488974        , 0.0000145536830897243386        , 1.96732900186647415e-6          , },
+/* x = 1.1         */  {0.0144883165908940978           , 0.0133349232155785873           , 0.00617541889148688704          , 0.00191691000061817385          , 0.000448374553350393616         , 0.0000842483430130007229        , 0.0000132398718159870472        , 1.78924075395160403e-6          , },
+/* x = 1.2         */  {0.0132147055562854421           , 0.0121555945812224817           , 0.00562642537100102303          , 0.00174572636151786381          , 0.000408175196703482166         , 0.0000766685551283186758        , 0.0000120449766358427904        , 1.62731197640954369e-6          , },
+/* x = 1.3         */  {0.01205370468822996             , 0.0110810862198986141           , 0.00512644901985576508          , 0.00158988782805267765          , 0.000371592034996561534         , 0.0000697727521899491413        , 0.0000109582084208193324        , 1.48007320639609372e-6          , },
+/* x = 1.4         */  {0.0109953071408985184           , 0.0101020409217344584           , 0.00467109659736141081          , 0.00144801420865210418          , 0.000338298792673882456         , 0.0000634990471907988927        , 9.96975905741511532e-6          , 1.34618887102694128e-6          , },
+/* x = 1.5         */  {0.0100303992052155488           , 0.0092099399939862971           , 0.00425636994820003215          , 0.00131884982484289086          , 0.000307998712115942663         , 0.0000577911662427687773        , 9.07071206999955367e-6          , 1.22444506589671169e-6          , },
+/* x = 1.6         */  {0.00915068028638332871          , 0.00839702786403994041          , 0.00387863036475359103          , 0.00120125224797150372          , 0.000280421876667243277         , 0.0000525979383484407995        , 8.2529614013871309e-6           , 1.1137384510353273e-6           , },
+/* x = 1.7         */  {0.00834859007573007521          , 0.00765624348250506763          , 0.00353456617277973174          , 0.00109418205727891131          , 0.000255322776974789859         , 0.0000478728316453404862        , 7.50913760526772541e-6          , 1.01306616197464721e-6          , },
+/* x = 1.8         */  {0.0076172422681084859           , 0.00698115791142378033          , 0.00322116324817437927          , 0.00099669352650590089          , 0.000232478098478136889         , 0.0000435735318821710136        , 6.83254077296748412e-6          , 9.21516642982100892e-7          , },
+/* x = 1.9         */  {0.00695036423473734334          , 0.00636591753836803445          , 0.0029356781991186681           , 0.000907926154659986716         , 0.000211684709913623645         , 0.0000396615592740238476        , 6.21707957904426428e-6          , 8.38261318040107973e-7          , },
+/* x = 2.0         */  {0.00634224211472670036          , 0.00580519240788870427          , 0.00267561397204779042          , 0.000827096964256631363         , 0.000192757834532507726         , 0.00003610192023569464          , 5.65721588656416527e-6          , 7.62547022889715815e-7          , },
+/* x = 2.1         */  {0.00578767083704015607          , 0.00529412920786237896          , 0.00243869766182170497          , 0.000753493497328451512         , 0.000175529387401885625         , 0.0000328627908121260022        , 5.14791440408310153e-6          , 6.93689128486012594e-7          , },
+/* x = 2.2         */  {0.00528190862876499629          , 0.00482830849017977816          , 0.00222286032642274171          , 0.000686467445840346062         , 0.000159846463673962919         , 0.0000299152289156150545        , 4.68459693284385903e-6          , 6.31065292596794784e-7          , },
+/* x = 2.3         */  {0.00482063560568171264          , 0.00440370574331284399          , 0.00202621862463511458          , 0.000625428858914235929         , 0.000145569964087356423         , 0.0000272329127434466539        , 4.26310078492518502e-6          , 5.74109782073981848e-7          , },
+/* x = 2.4         */  {0.00439991607761150789          , 0.00401665596893233204          , 0.00184705811164171477          , 0.000569840874507185871         , 0.000132573345216354763         , 0.0000247919029894799809        , 3.87964099143617371e-6          , 5.22308313593219425e-7          , },
+/* x = 2.5         */  {0.0040161642342036974           , 0.00366382144623872798          , 0.00168381804245468602          , 0.000519214927949099801         , 0.000120741483121948065         , 0.0000225704266811401205        , 3.53077595469158635e-6          , 4.75193365439883545e-7          , },
+/* x = 2.6         */  {0.00366611290700427997          , 0.00334216239630252283          , 0.00153507754671483039          , 0.000473106394074560334         , 0.00010996964009242261          , 0.0000205486806712577355        , 3.21337622995422243e-6          , 4.32339917263683042e-7          , },
+/* x = 2.7         */  {0.00334678513109495155          , 0.00304891028474518956          , 0.00139954305077503267          , 0.000431110623617349689         , 0.000100162525100904915         , 0.0000187086529940847653        , 2.9245961510818542e-6           , 3.93361578669563149e-7          , },
+/* x = 2.8         */  {0.00305546825455626538          , 0.00278154352476583383          , 0.00127603683423745967          , 0.000392859338111746902         , 0.000091233439461063682         , 0.0000170339604582507011        , 2.66184804053446915e-6          , 3.57907071096240541e-7          , },
+/* x = 2.9         */  {0.00278969036671476182          , 0.00253776536404514075          , 0.00116348661834582511          , 0.000358017350794558253         , 0.0000831034999380790662        , 0.0000155097009979186658        , 2.42277876792413012e-6          , 3.25657030688683546e-7          , },
+/* x = 3.0         */  {0.00254719883678648866          , 0.00231548375863304557          , 0.00106091609293569062          , 0.000326279583955725363         , 0.0000757009322770901007        , 0.0000141223194383214122        , 2.20524844284397879e-6          , 2.96321102827369447e-7          , },
+/* x = 3.1         */  {0.00232594077331458091          , 0.00211279305472688977          , 0.000967436297102275633         , 0.000297368355870273673         , 0.0000689604287521041471        , 0.0000128594854544471485        , 2.00731104729395552e-6          , 2.69635301662607811e-7          , },
+/* x = 3.2         */  {0.00212404523188572731          , 0.0019279573154339012           , 0.00088223777643352479          , 0.000271030912884849548         , 0.0000628225639206757865        , 0.0000117099826130325621        , 1.82719683080958024e-6          , 2.45359610441499334e-7          , },
+/* x = 3.3         */  {0.0019398070141533007           , 0.0017593951443321988           , 0.000804583446646163791         , 0.000247037184450441779         , 0.0000572332632988773071        , 0.0000106636074892308355        , 1.66329630756092252e-6          , 2.2327580063080118e-7           , },
+/* x = 3.4         */  {0.00177167191533357619          , 0.00160566587103137138          , 0.000733802099817716739         , 0.000225177740909350279         , 0.0000521433201520408852        , 9.71107794128713436e-6          , 1.51414570937089151e-6          , 2.03185449851612694e-7          , },
+/* x = 3.5         */  {0.00161822329020300678          , 0.00146545697610809552          , 0.000669282495185719882         , 0.000205261935677458391         , 0.0000475079560338616669        , 8.84394971011897556e-6          , 1.37841376194071361e-6          , 1.84908140470014453e-7          , },
+/* x = 3.6         */  {0.00147816981932462176          , 0.00133757264386430324          , 0.000610467981739140736         , 0.000187116215129111155         , 0.0000432864211037159372        , 8.05454058663247854e-6          , 1.25488966368901409e-6          , 1.68279822348511207e-7          , },
+/* x = 3.7         */  {0.00135033436787541605          , 0.00122092334142513648          , 0.000556851604604006331         , 0.000170582581006598558         , 0.0000394416306131077739        , 7.33586145860581726e-6          , 1.14247215762106631e-6          , 1.53151324771713196e-7          , },
+/* x = 3.8         */  {0.00123364383912971805          , 0.00111451633185228361          , 0.000507971651568819843         , 0.00015551719155320077          , 0.0000359398342803165979        , 6.68155361167231337e-6          , 1.04015959664804831e-6          , 1.39387003930096368e-7          , },
+/* x = 3.9         */  {0.00112711993346289984          , 0.00101744703727796252          , 0.000463407600044910222         , 0.000141789088820521461         , 0.0000327503155705801461        , 6.08583171591355478e-6          , 9.47040911864768801e-7          , 1.26863513590584361e-7          , },
+/* x = 4.0         */  {0.00102987073175447435          , 0.000928891175640959799         , 0.000422776428348233393         , 0.000129279040738819927         , 0.0000298451181702412819        , 5.54343198135095306e-6          , 8.6228740155205253e-7           , 1.15468687713603648e-7          , },
+/* x = 4.1         */  {0.00094108302936149403          , 0.000848097601497085756         , 0.000385729258454882187         , 0.000117878487573616246         , 0.0000271987971896919426        , 5.04956501267761278e-6          , 7.85145266172887215e-7          , 1.05100524803631143e-7          , },
+/* x = 4.2         */  {0.000860015353467587013         , 0.000774381787644282037         , 0.000351948300352256475         , 0.000107488583332404154         , 0.0000247881928539160038        , 4.59987293633310394e-6          , 7.14928821448632663e-7          , 9.56662647135739777e-8          , },
+/* x = 4.3         */  {0.000785991602649378476         , 0.000707119890003898854         , 0.000321144070808391704         , 0.00009801932354042223          , 0.0000225922246430116425        , 4.1903904118840011e-6           , 6.510143277958451e-7            , 8.70815494712158939e-8          , },
+/* x = 4.4         */  {0.000718395252994499705         , 0.000645743343385687663         , 0.000293052861837791235         , 0.000089388751581883531         , 0.0000205917040301226117        , 3.81750917498926823e-6          , 5.92834380032589234e-7          , 7.92696604662638894e-8          , },
+/* x = 4.5         */  {0.000656664080103037793         , 0.00058973394048151537          , 0.000267434436375478249         , 0.0000815222365099154065        , 0.0000187691641324164774        , 3.47794579132550331e-6          , 5.39872806377285093e-7          , 7.21608250363441001e-8          , },
+/* x = 4.6         */  {0.000600285350851827033         , 0.000538619350724140672         , 0.000244069930702076984         , 0.0000743518158711391921        , 0.0000171087047436517577        , 3.16871233001685727e-6          , 4.91660030410208169e-7          , 6.56915861260861797e-8          , },
+/* x = 4.7         */  {0.000548791442939080847         , 0.000491969039551191925         , 0.000222759945009913025         , 0.0000678155976751620277        , 0.000015595851355870213         , 2.8870896916253472e-6           , 4.47768853890461162e-7          , 5.98042292710669591e-8          , },
+/* x = 4.8         */  {0.000501755853992482176         , 0.000449390552165835996         , 0.000203322805180080367         , 0.0000618572161705665354        , 0.0000142174269041030675        , 2.63060334985208387e-6          , 4.07810622158380124e-7          , 5.44462616831848887e-8          , },
+/* x = 4.9         */  {0.000458789565450614929         , 0.000410526129116431908         , 0.000185592980368332704         , 0.0000564253365720910939        , 0.0000129614350828426996        , 2.3970012879992156e-6           , 3.71431737340187785e-7          , 4.9569938690845928e-8           , },
+/* x = 5.0         */  {0.000419537729546110648         , 0.00037504962395672991          , 0.000169419642387312024         , 0.0000514732043229771719        , 0.0000118169541874511953        , 2.18423393114656632e-6          , 3.38310487740293258e-7          , 4.51318332205544701e-8          , },
+/* x = 5.1         */  {0.000383676650556916896         , 0.00034266369592228297          , 0.000154665354136568827         , 0.0000469582348759045075        , 0.0000107740405286054015        , 1.99043589308810613e-6          , 3.0815416468605796e-7           , 4.10924444001118104e-8          , },
+/* x = 5.2         */  {0.000350911034074964887         , 0.000313097252991668247         , 0.0001412048754814553           , 0.0000428416403391608173        , 9.82364055417924521e-6          , 1.813909373516979e-6            , 2.80696440706535707e-7          , 3.74158417212557009e-8          , },
+/* x = 5.3         */  {0.00032097148039223337          , 0.000286103122914680947         , 0.000128924076027649497         , 0.0000390880896649914251        , 8.95751089142369837e-6          , 1.65310905589414536e-6          , 2.55694985304663822e-7          , 3.40693415245213387e-8          , },
+/* x = 5.4         */  {0.000293612200243702895         , 0.000261455931803694852         , 0.000117718945189217269         , 0.0000356653993574372475        , 8.16814559363680575e-6          , 1.5066283700213597e-6           , 2.32929296743446858e-7          , 3.10232128643583981e-8          , },
+/* x = 5.5         */  {0.000268608933094006723         , 0.000238950171716918281         , 0.000107494690813305754         , 0.0000325442519501161626        , 7.44870994036946688e-6          , 1.37318699568829604e-6          , 2.12198730230653583e-7          , 2.82504100808179015e-8          , },
+/* x = 5.6         */  {0.000245757049927028321         , 0.000218398440329712249         , 0.000098164918411575889         , 0.0000296979397528046241        , 6.79298019917682016e-6          , 1.25161949498892169e-6          , 1.93320704671445965e-7          , 2.57263296478952255e-8          , },
+/* x = 5.7         */  {0.00022486982411102287          , 0.000199629837307394648         , 0.0000896508837644027513        , 0.0000271021315915802165        , 6.19528881053599237e-6          , 1.14086497110616461e-6          , 1.76129071780533456e-7          , 2.34285890901235467e-8          , },
+/* x = 5.8         */  {0.000205776855380380519         , 0.000182488503373594674         , 0.000081880812315139718         , 0.0000247346604727340358        , 5.650474506295675e-6            , 1.03995766063962633e-6          , 1.60472632819757643e-7          , 2.13368259602922972e-8          , },
+/* x = 5.9         */  {0.000188322633311937369         , 0.000166832289324581779         , 0.0000747892793642092708        , 0.0000225753302875108542        , 5.15383691634410185e-6          , 9.48018374983163443e-7          , 1.4621378956696295e-7           , 1.94325150540678599e-8          , },
+/* x = 6.0         */  {0.000172365227890634665         , 0.00015253154338329235          , 0.0000683166456117722932        , 0.0000206057398446727025        , 4.70109525848182031e-6          , 8.6424671392447449e-7           , 1.33227317339865097e-7          , 1.76988022034994667e-8          , },
+/* x = 6.1         */  {0.000157775095867115083         , 0.000139468006327219231         , 0.0000624085430880785554        , 0.000018809122672441991         , 4.28835074312980823e-6          , 7.87913981607244292e-7          , 1.21399249005535468e-7          , 1.61203531424288056e-8          , },
+/* x = 6.2         */  {0.00014443399261834184          , 0.000127533804771194487         , 0.0000570154069567143862        , 0.0000171702011719583339        , 3.91205235782431362e-6          , 7.18356741331399209e-7          , 1.1062585991220232e-7           , 1.46832160740741079e-8          , },
+/* x = 6.3         */  {0.000132233980140460443         , 0.000116630533847825733         , 0.0000520920490818407925        , 0.000015675053832246814         , 3.56896572674934055e-6          , 6.54970951426303501e-7          , 1.00812744594529087e-7          , 1.33746966957884236e-8          , },
+/* x = 6.4         */  {0.000121076522639017907         , 0.000106668421312618217         , 0.0000475972696197952089        , 0.0000143109943329972346        , 3.25614476811051804e-6          , 5.9720662966770559e-7           , 9.18739769347253668e-8          , 1.21832445493419716e-8          , },
+/* x = 6.5         */  {0.000110871661942701267         , 0.0000975655658146122477        , 0.0000434935032314214708        , 0.0000130664614672419597        , 2.97090589720971814e-6          , 5.44562998469566872e-7          , 8.37313462173726938e-8          , 1.10983496680896843e-8          , },
+/* x = 6.6         */  {0.000101537265659681065         , 0.0000892472427230403942        , 0.0000397464968172044404        , 0.0000119309189122470218        , 2.71080454586506515e-6          , 4.96584067409872591e-7          , 7.63136622026064252e-8          , 1.01104485860020104e-8          , },
+/* x = 6.7         */  {0.0000929983416265650108        , 0.0000816452714918391108        , 0.0000363250159554542839        , 0.0000108947639644635234        , 2.47361378954208385e-6          , 4.5285461358448335e-7           , 6.95561229665577204e-8          , 9.21083885861787026e-9          , },
+/* x = 6.8         */  {0.000085186412774449653         , 0.0000746974390820910476        , 0.0000332005774768990885        , 9.94924443401156926e-6          , 2.25730489240609315e-6          , 4.12996523860798219e-7          , 6.33997398254237583e-8          , 8.39160132330307311e-9          , },
+/* x = 6.9         */  {0.0000780389470596697776        , 0.0000683469744524082375        , 0.0000303472058393663642        , 9.0863829666031203e-6           , 2.06002959764392999e-6          , 3.76665466355967266e-7          , 5.77908141753775923e-8          , 7.64552939647383682e-9          , },
+/* x = 7.0         */  {0.0000714988375831961814        , 0.0000625420695732420234        , 0.0000277412111758220865        , 8.29890812670434298e-6          , 1.88010400598955829e-6          , 3.43547861422151165e-7          , 5.26804615494562189e-8          , 6.96606476931685749e-9          , },
+/* x = 7.1         */  {0.0000655139284564173545        , 0.0000572354428270795487        , 0.0000253609870797620967        , 7.58019163568424104e-6          , 1.71599389956386315e-6          , 3.13358125110724969e-7          , 4.802417861885178e-8            , 6.34723892158935767e-9          , },
+/* x = 7.2         */  {0.0000600365823660767999        , 0.0000523839410260583771        , 0.0000231868263655172505        , 6.92419121323288378e-6          , 1.5663013810319358e-6           , 2.85836160532762609e-7          , 4.37814492535613032e-8          , 5.78361992584592357e-9          , },
+/* x = 7.3         */  {0.0000550232861508991391        , 0.000047948176614974948         , 0.0000212007531989890191        , 6.32539851994884554e-6          , 1.4297527098077655e-6           , 2.60745074756795685e-7          , 3.99153861096554069e-8          , 5.27026406239638784e-9          , },
+/* x = 7.4         */  {0.0000504342910300862377        , 0.0000438921969339583369        , 0.0000193863701380845453        , 5.77879174413661114e-6          , 1.30518722770224413e-6          , 2.37869100906872072e-7          , 3.63924045307141652e-8          , 4.80267180888906058e-9          , },
+/* x = 7.5         */  {0.0000462332844222765304        , 0.0000401831826939386451        , 0.0000177287187529503278        , 5.27979241692539365e-6          , 1.19154727611191565e-6          , 2.17011706962668675e-7          , 3.31819258421643382e-8          , 4.37674780803471411e-9          , },
+/* x = 7.6         */  {0.0000423870905653550637        , 0.000036791173071925388         , 0.000016214152615176802         , 4.82422607718907696e-6          , 1.08786901567038821e-6          , 1.97993874435491649e-7          , 3.02561073819859496e-8          , 3.98876445300092681e-9          , },
+/* x = 7.7         */  {0.0000388653973950617371        , 0.0000336888150642692448        , 0.0000148302215535218361        , 4.4082864417475047e-6           , 9.93274067311252209e-7          , 1.80652531614564227e-7          , 2.75895968519455895e-8          , 3.635328762742649e-9            , },
+/* x = 7.8         */  {0.0000356405073658399344        , 0.0000308511349465520289        , 0.0000135655661723435279        , 4.02850276726643069e-6          , 9.06961900992973824e-7          , 1.64839127460816539e-7          , 2.51593087923471112e-8          , 3.31335224929207793e-9          , },
+/* x = 7.9         */  {0.0000326871101027714993        , 0.0000282553298803923486        , 0.0000124098217187185138        , 3.68171011842389691e-6          , 8.28202904978260685e-7          , 1.50418333482961017e-7          , 2.294422118225632e-8            , 3.02002350608072121e-9          , },
+/* x = 8.0         */  {0.0000299820749605538701        , 0.0000258805778819584321        , 0.0000113535304659489321        , 3.36502228252631483e-6          , 7.56332074602559164e-7          , 1.37266862074330739e-7          , 2.09251903480622626e-8          , 2.75278327095568995e-9          , },
+/* x = 8.1         */  {0.0000275042617359268961        , 0.0000237078645258830705        , 0.0000103880618555548223        , 3.07580709406700652e-6          , 6.90743264962954094e-7          , 1.25272390829111616e-7          , 1.90847825277265198e-8          , 2.50930173990505373e-9          , },
+/* x = 8.2         */  {0.000025234347935239385         , 0.0000217198249029781888        , 9.50553970756916984e-6          , 2.81166395393160084e-6          , 6.30883956959185541e-7          , 1.14332583302608039e-7          , 1.74071205876364699e-8          , 2.28745792782729904e-9          , },
+/* x = 8.3         */  {0.0000231546711403141828        , 0.0000199005994819218403        , 8.69877587060053219e-6          , 2.57040334725781974e-6          , 5.76250490667676834e-7          , 1.04354197540586361e-7          , 1.58777445249757946e-8          , 2.08532089115274367e-9          , },
+/* x = 8.4         */  {0.0000212490851446594364        , 0.0000182357026450974785        , 7.96120973924951328e-6          , 2.35002818152404263e-6          , 5.26383724168213434e-7          , 9.5252274485305936e-8           , 1.44834845121888772e-8          , 1.90113264391845493e-9          , },
+/* x = 8.5         */  {0.0000195028286495058774        , 0.000016711902778058986         , 7.28685311755730725e-6          , 2.14871678242823182e-6          , 4.80865079708350355e-7          , 8.69493990776320132e-8          , 1.32123453525661994e-8          , 1.73329261416572571e-9          , },
+/* x = 8.6         */  {0.0000179024054161481014        , 0.000015317112891635082         , 6.67023995367930488e-6          , 1.96480739966880386e-6          , 4.39312942516517423e-7          , 7.93750275220458692e-8          , 1.20534013182342963e-8          , 1.58034350140945147e-9          , },
+/* x = 8.7         */  {0.0000164354748685628666        , 0.0000140402908463470261        , 6.10638051332575556e-6          , 1.79678408798142156e-6          , 4.01379380691836683e-7          , 7.24648747702592153e-8          , 1.09967004348224212e-8          , 1.44095840854811952e-9          , },
+/* x = 8.8         */  {0.0000150907522291170119        , 0.0000128713483313891305        , 5.59071959806903193e-6          , 1.64326384083832625e-6          , 3.66747157434782389e-7          , 6.6160356814806369e-8           , 1.00331773616406368e-8          , 1.31392913305634428e-9          , },
+/* x = 8.9         */  {0.0000138579173511334105        , 0.0000118010678256361694        , 5.11909844972373947e-6          , 1.50298486518694233e-6          , 3.35127009463389106e-7          , 6.04080828712512755e-8          , 9.15457409310579815e-9          , 1.19815551273326885e-9          , },
+/* x = 9.0         */  {0.0000127275314858580872        , 0.000010821026836654035         , 4.68772001397164988e-6          , 1.37479589558959392e-6          , 3.06255167807835462e-7          , 5.51593929708917297e-8          , 8.35336777708840396e-9          , 1.09263573076450101e-9          , },
+/* x = 9.1         */  {0.0000116909612886050118        , 9.92352877609948131e-6          , 4.29311726551019944e-6          , 1.2576464552149893e-6           , 2.79891099312896692e-7          , 5.03699368890565221e-8          , 7.62270500945685722e-9          , 9.96457493478719047e-10         , },
+/* x = 9.2         */  {0.000010740309430129708         , 9.10153988674724729e-6          , 3.9321243235076719e-6           , 1.15057797940535887e-6          , 2.55815449122063858e-7          , 4.5999290700897294e-8           , 6.95634202194106915e-9          , 9.08790002020970621e-10         , },
+/* x = 9.3         */  {9.8683512351291581e-6           , 8.34863168817503304e-6          , 3.60185011028367082e-6          , 1.05271572507418969e-6          , 2.33828166186438048e-7          , 4.20106075902713243e-8          , 6.34859023304705976e-9          , 8.28876646294166392e-10         , },
+/* x = 9.4         */  {9.0684768206666063e-6           , 7.65892845532089866e-6          , 3.29965432811255322e-6          , 9.63261396045175744e-7          , 2.13746795451618851e-7          , 3.83702998408908987e-8          , 5.79426667960324407e-9          , 7.56028356003020086e-10         , },
+/* x = 9.5         */  {8.33463825371566766e-6          , 7.02705928711532105e-6          , 3.02312554906350202e-6          , 8.81486420684057245e-7          , 1.95404921841083456e-7          , 3.50477492151041692e-8          , 5.28864889003924848e-9          , 6.89617549529500711e-10         , },
+/* x = 9.6         */  {7.66130128930924988e-6          , 6.44811436155611323e-6          , 2.7700612310198225e-6           , 8.06725823856734655e-7          , 1.78650752488061573e-7          , 3.20150431769491722e-8          , 4.82743380008193361e-9          , 6.29072626729175331e-10         , },
+/* x = 9.7         */  {7.04340128933003864e-6          , 5.91760500927983868e-6          , 2.53844948962199868e-6          , 7.38372640419706428e-7          , 1.63345824881536297e-7          , 2.92467346447399708e-8          , 4.4067003475576877e-9           , 5.7387295661220243e-10          , },
+/* x = 9.8         */  {6.47630295712296172e-6          , 5.43142727019882965e-6          , 2.32645247099978109e-6          , 6.75872822158251034e-7          , 1.49363829696551255e-7          , 2.67196231664505155e-8          , 4.02287541573945459e-9          , 5.23544315305333743e-10         , },
+/* x = 9.9         */  {5.95576355514877169e-6          , 4.98582862740121162e-6          , 2.13239118393074272e-6          , 6.18720594375486325e-7          , 1.36589538084312193e-7          , 2.44125556004208564e-8          , 3.67270282446635065e-9          , 4.7765473372222502e-10          , },
+/* x = 10.0        */  {5.47789930210731424e-6          , 4.57737763950990022e-6          , 1.95473166260706136e-6          , 5.66454222239372562e-7          , 1.24917824112580094e-7          , 2.23062445561160761e-8          , 3.35321509536129639e-9          , 4.35810718035119884e-10         , },
+/* x = 10.1        */  {5.0391546725902494e-6           , 4.20293621729977854e-6          , 1.79207234261864634e-6          , 5.18652150549346366e-7          , 1.14252773879698258e-7          , 2.03831030063615149e-8          , 3.06170774212167588e-9          , 3.97653809374712568e-10         , },
+/* x = 10.2        */  {4.63627434660465962e-6          , 3.85963431279361696e-6          , 1.64313254316914101e-6          , 4.74929483820943416e-7          , 1.04506873583678045e-7          , 1.8627093625059766e-8           , 2.79571585928133936e-9          , 3.62857452216855119e-10         , },
+/* x = 10.3        */  {4.26627757844943163e-6          , 3.54484680949110665e-6          , 1.50674195802283703e-6          , 4.3493477653402552e-7           , 9.56002695178190796e-8          , 1.70235915341398533e-8          , 2.55299280324085693e-9          , 3.31124143672151285e-10         , },
+/* x = 10.4        */  {3.92643477461530698e-6          , 3.25617242100860759e-6          , 1.38183106631799924e-6          , 3.98347106074041022e-7          , 8.74600935924839614e-8          , 1.55592592615559539e-8          , 2.33149077792009681e-9          , 3.0218283840227929e-10          , },
+/* x = 10.5        */  {3.61424608878993316e-6          , 2.99141442238100815e-6          , 1.26742238225095386e-6          , 3.64873403339747352e-7          , 8.00198485544560507e-8          , 1.42219328195960453e-8          , 2.1293431542695921e-9           , 2.75786586167751093e-10         , },
+/* x = 10.6        */  {3.3274218588386057e-6           , 2.74856305374820501e-6          , 1.16262246980420611e-6          , 3.34246018216515395e-7          , 7.32188475958503679e-8          , 1.3000517910538638e-8           , 1.94484836823631313e-9          , 2.51710381086329977e-10         , },
+/* x = 10.7        */  {3.06386472594315297e-6          , 2.5257794502507771e-6           , 1.06661465522333615e-6          , 3.06220499141287401e-7          , 6.70017035184331429e-8          , 1.18848953556802394e-8          , 1.7764552557531679e-9           , 2.29749203568203888e-10         , },
+/* x = 10.8        */  {2.8216532900463054e-6           , 2.32138096481415271e-6          , 9.78652375898383953e-7          , 2.80573567831283432e-7          , 6.13178630506303665e-8          , 1.0865834924740476e-8           , 1.62274969603511207e-9          , 2.0971623761026096e-10          , },
+/* x = 10.9        */  {2.59902716848601324e-6          , 2.13382776221879662e-6          , 8.98053109727682201e-7          , 2.57101271929854762e-7          , 5.61211823072867374e-8          , 9.93491681635723674e-9          , 1.48244244603209923e-9          , 1.91441247692902276e-10         , },
+/* x = 11.0        */  {2.39437333632205734e-6          , 1.9617105735366261e-6           , 8.24192833982801031e-7          , 2.35617299854218185e-7          , 5.13695397398464454e-8          , 9.08446010746694147e-9          , 1.354358059413857e-9            , 1.74769100942816478e-10         , },
+/* x = 11.1        */  {2.20621363745481956e-6          , 1.80373950975294869e-6          , 7.56500967195373574e-7          , 2.15951443524599394e-7          , 4.70244832502260874e-8          , 8.30745755042193438e-9          , 1.23742479303785638e-9          , 1.5955842151681562e-10          , },
+/* x = 11.2        */  {2.03319336530335201e-6          , 1.65873384227244852e-6          , 6.94455751689177605e-7          , 1.97948195924786813e-7          , 4.30509084381127119e-8          , 7.59751615227095032e-9          , 1.13066541256554055e-9          , 1.45680365336814828e-10         , },
+/* x = 11.3        */  {1.87407082062901779e-6          , 1.52561266610341656e-6          , 6.37580038119557888e-7          , 1.81465471601372618e-7          , 3.9416765221362604e-8           , 6.94880302121347781e-9          , 1.03318881682081958e-9          , 1.33017504374898188e-10         , },
+/* x = 11.4        */  {1.72770776213679895e-6          , 1.4033863688960101e-6           , 5.85437436789502827e-7          , 1.66373439263159505e-7          , 3.6092790314979394e-8           , 6.35599601128389488e-9          , 9.44182407699891255e-10         , 1.21462810659758419e-10         , },
+/* x = 11.5        */  {1.59306067282707386e-6          , 1.29114883574113633e-6          , 5.37628803616955876e-7          , 1.52553456602556015e-7          , 3.30522632779795436e-8          , 5.81423873823517675e-9          , 8.62905139007067127e-10         , 1.10918731060365403e-10         , },
+/* x = 11.6        */  {1.4691727717684055e-6           , 1.18807032577424669e-6          , 4.93789031458125993e-7          , 1.39897098335658715e-7          , 3.02707840412803636e-8          , 5.31909957774656377e-9          , 7.88681183566089162e-10         , 1.01296344707452456e-10         , },
+/* x = 11.7        */  {1.35516670707330004e-6          , 1.09339096222543316e-6          , 4.53584120071139537e-7          , 1.2830526925476302e-7           , 2.77260700153642391e-8          , 4.86653429181307417e-9          , 7.20894163393729014e-10         , 9.25145956455329657e-11         , },
+/* x = 11.8        */  {1.25023787143561846e-6          , 1.00641478266159314e-6          , 4.16708500355638803e-7          , 1.17687394813207537e-7          , 2.53977710455150751e-8          , 4.45285196079487151e-9          , 6.58981892670762535e-10         , 8.44995939742420853e-11         , },
+/* x = 11.9        */  {1.15364828667741392e-6          , 9.26504300821675425e-7          , 3.82882590647179905e-7          , 1.07960682424068358e-7          , 2.32673006363747226e-8          , 4.07468392739121402e-9          , 6.02431587748811035e-10         , 7.71839793438112993e-11         , },
+/* x = 12.0        */  {1.06472100839731812e-6          , 8.53075535691864307e-7          , 3.51850564799002636e-7          , 9.90494472570412717e-8          , 2.13176820077803243e-8          , 3.72895548501173856e-9          , 5.50775502530155798e-10         , 7.05063412208592982e-11         , },
+/* x = 12.1        */  {9.82835006051314397e-7          , 7.85593467340194861e-7          , 3.23378313564775144e-7          , 9.08844968671268187e-8          , 1.95334076715486295e-8          , 3.41286006687891539e-9          , 5.03586951287953417e-10         , 6.44106908423597563e-11         , },
+/* x = 12.2        */  {9.07420477665459949e-7          , 7.23567882562502229e-7          , 2.97251582419592538e-7          , 8.34025694892412765e-8          , 1.79003113351902888e-8          , 3.12383571392051379e-9          , 4.60476684389498724e-10         , 5.88459802321168494e-11         , },
+/* x = 12.3        */  {8.37954561911350649e-7          , 6.66549576613842743e-7          , 2.73274270436799172e-7          , 7.6545821288964209e-8           , 1.64054510444852779e-8          , 2.85954361929170236e-9          , 4.21089585475492048e-10         , 5.37656640694272922e-11         , },
+/* x = 12.4        */  {7.73957413498486727e-7          , 6.14126880238970118e-7          , 2.51266876187832337e-7          , 7.02613582752591822e-8          , 1.50370025733576926e-8          , 2.61784856537754815e-9          , 3.85101661461133119e-10         , 4.91273005775479794e-11         , },
+/* x = 12.5        */  {7.1498861078020822e-7           , 5.65922483897061381e-7          , 2.31065077862839726e-7          , 6.4500808959773554e-8           , 1.37841621573986834e-8          , 2.39680108552702875e-9          , 3.52217299285269432e-10         , 4.48921879434992593e-11         , },
+/* x = 12.6        */  {6.60643867156153734e-7          , 5.21590533522407148e-7          , 2.12518435931861305e-7          , 5.92199341925183367e-8          , 1.26370577474689607e-8          , 2.19462119770378096e-9          , 3.22166765664500487e-10         , 4.1025033093687876e-11          , },
+/* x = 12.7        */  {6.10552020306711861e-7          , 4.80813974394936075e-7          , 1.95489207689504996e-7          , 5.43782709183390391e-8          , 1.15866680327667996e-8          , 2.0096835708382169e-9           , 2.94703928230757368e-10         , 3.74936499346250161e-11         , },
+/* x = 12.8        */  {5.64372275534158843e-7          , 4.4330212173112384e-7           , 1.79851263959045759e-7          , 4.99388068853349821e-8          , 1.06247485492107843e-8          , 1.84050399705004569e-9          , 2.69604178362249952e-10         , 3.42686844271851588e-11         , },
+/* x = 12.9        */  {5.21791681529781969e-7          , 4.08788438464260204e-7          , 1.65489099082720727e-7          , 4.58676835977465518e-8          , 9.7437642495384733e-9           , 1.68572705418857716e-9          , 2.46662537775914519e-10         , 3.13233640987120617e-11         , },
+/* x = 13.0        */  {4.82522818753304844e-7          , 3.77028502378906415e-7          , 1.52296926100950363e-7          , 4.21339250440645303e-8          , 8.93682796669062229e-9          , 1.54411485340958927e-9          , 2.25691932550172042e-10         , 2.86332698119316916e-11         , },
+/* x = 13.1        */  {4.46301682315888188e-7          , 3.47798146311973887e-7          , 1.4017784973091233e-7           , 3.87091899482787933e-8          , 8.19764425231610481e-9          , 1.41453677586223478e-9          , 2.06521619704087004e-10         , 2.61761278049905256e-11         , },
+/* x = 13.2        */  {4.12885742815042176e-7          , 3.20891756545232866e-7          , 1.29043110400367057e-7          , 3.55675454901476172e-8          , 7.52045811803274944e-9          , 1.29596011107955518e-9          , 1.88995752785786248e-10         , 2.39316201947408526e-11         , },
+/* x = 13.3        */  {3.82052169991872235e-7          , 2.96120715803102959e-7          , 1.18811393181381818e-7          , 3.26852606208388362e-8          , 6.90000824881227498e-9          , 1.18744151742639555e-9          , 1.72972074130983404e-10         , 2.18812122972246889e-11         , },
+/* x = 13.4        */  {3.53596205379972824e-7          , 2.73311978446122052e-7          , 1.09408196005635182e-7          , 3.00406172648233269e-8          , 6.33148429588602174e-9          , 1.08811923202689042e-9          , 1.58320722552326397e-10         , 2.00079952666039269e-11         , },
+/* x = 13.5        */  {3.2732967130173149e-7           , 2.52306766524414921e-7          , 1.00765252032872565e-7          , 2.76137378489044717e-8          , 5.81048789122244964e-9          , 9.97205964032128317e-10         , 1.44923146221751778e-10         , 1.82965426878555483e-11         , },
+/* x = 13.6        */  {3.03079604651613032e-7          , 2.32959376335794589e-7          , 9.28200014909878853e-8          , 2.53864277360329926e-8          , 5.33299705720806321e-9          , 9.13982410953453771e-10         , 1.32671111419924065e-10         , 1.67327798805881195e-11         , },
+/* x = 13.7        */  {2.80687004896105356e-7          , 2.15136086028039801e-7          , 8.55151087139184532e-8          , 2.33420312662586795e-8          , 4.89533371394429898e-9          , 8.37791343129422572e-10         , 1.21465798657199484e-10         , 1.53038647824227413e-11         , },
+/* x = 13.8        */  {2.60005686624584577e-7          , 1.98714155601888533e-7          , 7.87980204755162946e-8          , 2.14653002208783464e-8          , 4.49413401280326316e-9          , 7.6803220626138089e-10          , 1.11216978426696297e-10         , 1.39980793815037558e-11         , },
+/* x = 13.9        */  {2.4090122781184184e-7           , 1.83580911417197431e-7          , 7.26205620569491582e-8          , 1.97422736295269409e-8          , 4.12632124879204675e-9          , 7.04156196386493883e-10         , 1.01842259538634936e-10         , 1.28047307597584594e-11         , },
+/* x = 14.0        */  {2.23250005708200878e-7          , 1.69632907985766216e-7          , 6.6938567794859285e-8           , 1.81601679345135158e-8          , 3.7890811260653959e-9           , 6.45661765696495735e-10         , 9.32664036121882046e-11         , 1.17140608923265723e-11         , },
+/* x = 14.1        */  {2.06938312963241183e-7          , 1.56775160456191792e-7          , 6.17115431400843496e-8          , 1.67072766129342271e-8          , 3.47983917078803957e-9          , 5.92090521290693345e-10         , 8.54206998721676021e-11         , 1.07171644248714107e-11         , },
+/* x = 14.2        */  {1.91861547219782555e-7          , 1.44920441763976412e-7          , 5.69023555146079109e-8          , 1.53728784357372363e-8          , 3.19624010365242396e-9          , 5.43023482304896128e-10         , 7.82423949179836641e-11         , 9.80591371994083276e-12         , },
+/* x = 14.3        */  {1.7792346799114338e-7           , 1.33988638938689908e-7          , 5.24769514897303213e-8          , 1.41471536146404749e-8          , 2.93612900086112354e-9          , 4.98077663913157547e-10         , 7.16741726060221716e-11         , 8.97289052678139577e-12         , },
+/* x = 14.4        */  {1.65035515161467237e-7          , 1.23906163533584067e-7          , 4.84040980232171875e-8          , 1.30211071532241729e-8          , 2.69753408742800398e-9          , 4.56902959483078514e-10         , 6.5663679618029994e-11          , 8.21132368658274936e-12         , },
+/* x = 14.5        */  {1.53116183930418483e-7          , 1.14605411575606e-7             , 4.46551456891978263e-8          , 1.19864987781930221e-8          , 2.47865102036783626e-9          , 4.19179294702137426e-10         , 6.01630926810866434e-11         , 7.51503233754967231e-12         , },
+/* x = 14.6        */  {1.42090451463700585e-7          , 1.06024268828839569e-7          , 4.12038120134977591e-8          , 1.1035778881235564e-8           , 2.27782853184848127e-9          , 3.84614029804109002e-10         , 5.51287237626930453e-11         , 6.87837413192911166e-12         , },
+/* x = 14.7        */  {1.31889250913231676e-7          , 9.81056575252879257e-8          , 3.80259831903987603e-8          , 1.01620299515634989e-8          , 2.09355531378044773e-9          , 3.52939588131175656e-10         , 5.05206598905711861e-11         , 6.29619802058018514e-12         , },
+/* x = 14.8        */  {1.22448988838688733e-7          , 9.07971210465774335e-8          , 3.50995326058963584e-8          , 9.35891302451273931e-9          , 1.92444803571346175e-9          , 3.23911291187087674e-10         , 4.63024345437895057e-11         , 5.76380120024953176e-12         , },
+/* x = 14.9        */  {1.13711102398488454e-7          , 8.40504433413334741e-8          , 3.2404154728616275e-8           , 8.62061871291538109e-9          , 1.76924039738784546e-9          , 2.97305382086325445e-10         , 4.24407278324055303e-11         , 5.27688985475131509e-12         , },
+/* x = 15.0        */  {1.05621652985833072e-7          , 7.7821300138133367e-8           , 2.9921213053796252e-8           , 7.94182242565753794e-9          , 1.62677312593121704e-9          , 2.7291722089880503e-10          , 3.8905092929312747e-11          , 4.83154335406789546e-12         , },
+/* x = 15.1        */  {9.8130953266699633e-8           , 7.20689392653447086e-8          , 2.76336008991759355e-8          , 7.31764341224130039e-9          , 1.49598483557229752e-9          , 2.50559636843040566e-10         , 3.56677064425445985e-11         , 4.42418160527243953e-12         , },
+/* x = 15.2        */  {9.11932248338619781e-8          , 6.67558876188745874e-8          , 2.55256139552113793e-8          , 6.74360730356084431e-9          , 1.37590367493085944e-9          , 2.30061423605394374e-10         , 3.27031406208833321e-11         , 4.05153527639130359e-12         , },
+/* x = 15.3        */  {8.47662839262787266e-8          , 6.18476825287711438e-8          , 2.35828335866053876e-8          , 6.21561184774804637e-9          , 1.26563969349750199e-9          , 2.11265965270547498e-10         , 2.99881554720283372e-11         , 3.71061863911105755e-12         , },
+/* x = 15.4        */  {7.88112528783507436e-8          , 5.7312625467453761e-8           , 2.1792019968507448e-8           , 5.72989556608354564e-9          , 1.16437786489494959e-9          , 1.94029981449027956e-10         , 2.75015090424208453e-11         , 3.39870479881015879e-12         , },
+/* x = 15.5        */  {7.32922951603763638e-8          , 5.31215562176713313e-8          , 2.01410142196052923e-8          , 5.28300907782531789e-9          , 1.07137170996493455e-9          , 1.78222381191029661e-10         , 2.52237842625773634e-11         , 3.1133031009566253e-12          , },
+/* x = 15.6        */  {6.8176372051590475e-8           , 4.92476457785319108e-8          , 1.86186487663588996e-8          , 4.87178886457932651e-9          , 9.85937467697901276e-10         , 1.63723216190483855e-10         , 2.31372309027985193e-11         , 2.85213852164088762e-12         , },
+/* x = 15.7        */  {6.34330191519060099e-8          , 4.56662064344189162e-8          , 1.7214665238414243e-8           , 4.49333326470875698e-9          , 9.07448766559093048e-10         , 1.50422724617278507e-10         , 2.12256213126182525e-11         , 2.61313286707141574e-12         , },
+/* x = 15.8        */  {5.9034141089200099e-8           , 4.23545175455019866e-8          , 1.59196392553230054e-8          , 4.14498050641663826e-9          , 8.35331752902630562e-10         , 1.38220457675829037e-10         , 1.94741187344559711e-11         , 2.39438762239908185e-12         , },
+/* x = 15.9        */  {5.49538229169046969e-8          , 3.92916657409537866e-8          , 1.47249115195827867e-8          , 3.82428860469347285e-9          , 7.69060636940119162e-10         , 1.27024481681417026e-10         , 1.78691570886471218e-11         , 2.19416830439048816e-12         , },
+/* x = 16.0        */  {5.11681568228714404e-8          , 3.64583983078914655e-8          , 1.36225246811532884e-8          , 3.5290169624355813e-9           , 7.08153620174165374e-10         , 1.16750649077781214e-10         , 1.63983312242804681e-11         , 2.01089018536441316e-12         , },
+/* x = 16.1        */  {4.765508288598633e-8            , 3.38369886713806907e-8          , 1.2605165484411159e-8           , 3.2571095298377185e-9           , 6.5216917134914031e-10          , 1.07321932395786521e-10         , 1.50502967189054252e-11         , 1.84310526755176304e-12         , },
+/* x = 16.2        */  {4.43942427227283186e-8          , 3.1411112954399589e-8           , 1.16661117503569078e-8          , 3.00667938876049058e-9          , 6.00702620838207263e-10         , 9.86678156785490926e-11         , 1.38146783909570005e-11         , 1.68949039774050322e-12         , },
+/* x = 16.3        */  {4.13668449626346436e-8          , 2.91657366922158992e-8          , 1.07991837851257899e-8          , 2.77599464027437647e-9          , 5.53383046001286105e-10         , 9.07237383776561397e-11         , 1.26819867623776419e-11         , 1.54883642181634412e-12         , },
+/* x = 16.4        */  {3.85555415802200222e-8          , 2.70870108538737218e-8          , 9.99869984079493912e-9          , 2.56346548408365847e-9          , 5.09870422435363305e-10         , 8.34305871621862947e-11         , 1.16435417760306553e-11         , 1.42003828769244929e-12         , },
+/* x = 16.5        */  {3.59443141919959509e-8          , 2.5162176395046972e-8           , 9.2594352864078719e-9           , 2.36763238812276703e-9          , 4.6985301821652269e-10          , 7.67342314808427458e-11         , 1.06914031336780654e-11         , 1.30208601321449595e-12         , },
+/* x = 16.6        */  {3.35183695014893079e-8          , 2.33794766319707525e-8          , 8.57658517631636446e-9          , 2.18715525537422401e-9          , 4.33045010220634976e-10         , 7.05850990810590323e-11         , 9.81830667606443354e-12         , 1.19405644300148686e-12         , },
+/* x = 16.7        */  {3.12640431431502338e-8          , 2.17280767860351261e-8          , 7.94572992960727198e-9          , 2.02080350295428712e-9          , 3.9918430342354637e-10          , 6.49377880205254714e-11         , 9.01760627748770561e-12         , 1.09510572490192141e-12         , },
+/* x = 16.8        */  {2.91687112383015695e-8          , 2.01979901033983332e-8          , 7.36280385875594876e-9          , 1.86744697581592156e-9          , 3.68030535737110825e-10         , 5.97507120090368384e-11         , 8.28322077358628805e-12         , 1.00446244286767451e-12         , },
+/* x = 16.9        */  {2.72207090333037816e-8          , 1.87800100040868784e-8          , 6.82406630792733236e-9          , 1.72604762408938475e-9          , 3.39363252448431354e-10         , 5.49857761944525599e-11         , 7.60958548332686975e-12         , 9.21421348627370156e-13         , },
+/* x = 17.0        */  {2.54092560423361876e-8          , 1.74656477608986183e-8          , 6.32607518171192689e-9          , 1.59565187917372595e-9          , 3.12980235708898725e-10         , 5.0608080758234344e-11          , 6.99160792470312819e-12         , 8.45337639625581631e-13         , },
+/* x = 17.1        */  {2.37243871650350101e-8          , 1.6247075250377858e-8           , 5.86566266370248042e-9          , 1.47538366925824248e-9          , 2.88695975778606962e-10         , 4.65856499156199335e-11         , 6.42462735878213182e-12         , 7.75621735327923308e-13         , },
+/* x = 17.2        */  {2.21568892930539607e-8          , 1.51170723565226686e-8          , 5.43991294133928537e-9          , 1.36443802003735142e-9          , 2.66340271881029732e-10         , 4.28891841249530838e-11         , 5.9043778287642819e-12          , 7.11734508215158108e-13         , },
+/* x = 17.3        */  {2.06982429597643575e-8          , 1.40689786430194614e-8          , 5.04614176901574979e-9          , 1.26207519102735027e-9          , 2.45756951572075599e-10         , 3.9491833501793907e-11          , 5.42695438992850181e-12         , 6.53182929638382626e-13         , },
+/* x = 17.4        */  {1.93405686241006935e-8          , 1.30966489419571785e-8          , 4.68187771566718816e-9          , 1.16761530213740129e-9          , 2.26802698485571258e-10         , 3.6368990607798111e-11          , 4.98878225296713528e-12         , 5.99516094215454292e-13         , },
+/* x = 17.5        */  {1.80765772132689192e-8          , 1.21944125364080903e-8          , 4.34484495607969458e-9          , 1.08043340902467842e-9          , 2.09345979191845675e-10         , 3.34981009434528469e-11         , 4.58658858750246583e-12         , 5.50321589646405168e-13         , },
+/* x = 17.6        */  {1.68995245799289315e-8          , 1.13570356412069517e-8          , 4.03294747705751573e-9          , 9.99954989306805513e-10         , 1.93266060704696067e-10         , 3.0858489618934824e-11          , 4.21737675472647067e-12         , 5.05222181740251795e-13         , },
+/* x = 17.7        */  {1.5803169557778068e-8           , 1.05796869109278879e-8          , 3.74425458047243649e-9          , 9.25651804942546365e-10         , 1.78452110901258422e-10         , 2.84312028098380888e-11         , 3.87840275830647772e-12         , 4.63872787102502565e-13         , },
+/* x = 17.8        */  {1.47817353254166286e-8          , 9.85790572664326378e-9          , 3.47698757517489605e-9          , 8.57038109050694977e-10         , 1.64802374785245485e-10         , 2.61988627254210909e-11         , 3.56715372112410495e-12         , 4.25957708354682942e-13         , },
+/* x = 17.9        */  {1.38298738121688591e-8          , 9.18757303372860065e-9          , 3.22950755885383582e-9          , 7.93667168141456725e-10         , 1.5222342013218503e-10          , 2.41455349273633545e-11         , 3.28132821222022485e-12         , 3.91188108965201389e-13         , },
+/* x = 18.0        */  {1.29426329013456814e-8          , 8.56488452191470571e-9          , 3.00030419926367258e-9          , 7.35128073206390653e-10         , 1.40629446610736149e-10         , 2.22566069377292597e-11         , 3.01881826364777247e-12         , 3.592997067838626e-13           , },
+/* x = 18.1        */  {1.21154262064354991e-8          , 7.9863259561309873e-9           , 2.7879854318589906e-9           , 6.81042815372355974e-10         , 1.2994165298148305e-10          , 2.05186771667561782e-11         , 2.77769293091736537e-12         , 3.30050667207603679e-13         , },
+/* x = 18.2        */  {1.1344005214049179e-8           , 7.44865048256809052e-9          , 2.59126799785147615e-9          , 6.31063603890268483e-10         , 1.2008765743800247e-10          , 1.89194532749878608e-11         , 2.556183263476726e-12           , 3.03219678578345765e-13         , },
+/* x = 18.3        */  {1.06244336042643849e-8          , 6.9488577489375139e-9           , 2.40896875308492162e-9          , 5.84870406117617671e-10         , 1.11000966578301769e-10         , 1.74476591608648424e-11         , 2.35266856330205392e-12         , 2.78604193939576847e-13         , },
+/* x = 18.4        */  {9.9530635744405313e-9           , 6.48417469123412117e-9          , 2.23999668396363653e-9          , 5.42168690879951519e-10         , 1.02620488881423641e-10         , 1.60929498348029665e-11         , 2.16566382029645366e-12         , 2.56018824669491365e-13         , },
+/* x = 18.5        */  {9.32651400672559512e-9          , 6.05203785151808873e-9          , 2.08334557201375406e-9          , 5.02687358174897031e-10         , 9.4890088917297582e-11          , 1.48458335046236689e-11         , 1.99380822287720776e-12         , 2.35293872777124731e-13         , },
+/* x = 18.6        */  {8.74165033245683016e-9          , 5.65007710242059498e-9          , 1.93808725354813769e-9          , 4.6617683962552583e-10          , 8.77581788406957702e-11         , 1.36976002554785908e-11         , 1.83585465097205275e-12         , 2.16273989804792118e-13         , },
+/* x = 18.7        */  {8.19556595856696082e-9          , 5.27610066432911461e-9          , 1.80336542538263316e-9          , 4.32407355409659488e-10         , 8.11773440150752347e-11         , 1.26402567606226497e-11         , 1.69066006670937294e-12         , 1.98816951335161282e-13         , },
+/* x = 18.8        */  {7.68556513203528533e-9          , 4.92808131060276971e-9          , 1.67838995164969135e-9          , 4.01167314598688414e-10         , 7.5103999881580289e-11          , 1.16664665079773042e-11         , 1.55717672544646444e-12         , 1.82792537063470009e-13         , },
+/* x = 18.9        */  {7.20914712845131719e-9          , 4.60414366477827777e-9          , 1.56243163050726812e-9          , 3.72261846943375314e-10         , 6.94980774347484331e-11         , 1.07694950717938115e-11         , 1.4344441364958105e-12          , 1.68081507272950585e-13         , },
+/* x = 19.0        */  {6.76399165996222195e-9          , 4.30255250161890214e-9          , 1.45481738297596171e-9          , 3.45511455153809262e-10         , 6.43227348915254991e-11         , 9.94315999924362451e-12         , 1.32158170903822936e-12         , 1.54574667351927541e-13         , },
+/* x = 19.1        */  {6.34794540632311116e-9          , 4.02170197109307553e-9          , 1.35492582928260139e-9          , 3.20750777644278302e-10         , 5.95440933458916563e-11         , 9.18178491876612089e-12         , 1.21778202430538882e-12         , 1.42172012721127652e-13         , },
+/* x = 19.2        */  {5.9590095805241827e-9           , 3.76010567100148558e-9          , 1.26218322096865351e-9          , 2.97827452558742981e-10         , 5.51309943894082828e-11         , 8.48015751079944421e-12         , 1.12230468021955095e-12         , 1.30781947205694632e-13         , },
+/* x = 19.3        */  {5.59532844758838737e-9          , 3.51638750005211032e-9          , 1.1760596996594398e-9           , 2.7660107466558412e-10          , 5.10547778498493309e-11         , 7.83349101238826509e-12         , 1.03447065933838828e-12         , 1.20320568493895662e-13         , },
+/* x = 19.4        */  {5.25517872167054274e-9          , 3.28927322875838328e-9          , 1.09606585580590273e-9          , 2.56942237417543218e-10         , 4.72890779571786313e-11         , 7.23738895535807108e-12         , 9.53657175206386078e-13         , 1.10711014878701461e-13         , },
+/* x = 19.5        */  {4.93695977259195215e-9          , 3.07758273064881366e-9          , 1.02174956292337048e-9          , 2.3873165311991631e-10          , 4.38096363897535924e-11         , 6.68781286350208846e-12         , 8.79292956097353999e-13         , 1.01882867984017294e-13         , },
+/* x = 19.6        */  {4.63918457845790434e-9          , 2.88022282096584178e-9          , 9.52693064878713235e-10         , 2.2185934474225662e-10          , 4.05941307849416675e-11         , 6.18105265775663054e-12         , 8.10853928677410633e-13         , 9.37716066386237077e-14         , },
+/* x = 19.7        */  {4.36047136606948998e-9          , 2.69618065433302991e-9          , 8.88510295634212394e-10         , 2.06223903450797157e-10         , 3.76220174183929782e-11         , 5.71369953983742972e-12         , 7.47859267354107933e-13         , 8.63181074817579383e-14         , },
+/* x = 19.8        */  {4.09953588549314067e-9          , 2.52451763681541002e-9          , 8.28844412557800388e-10         , 1.91731806434823833e-10         , 3.48743868659921644e-11         , 5.2826211444502345e-12          , 6.89867778032151553e-13         , 7.94681882682892291e-14         , },
+/* x = 19.9        */  {3.85518426942522026e-9          , 2.36436381141771706e-9          , 7.73365525968253678e-10         , 1.78296790054243491e-10         , 3.23338315629019279e-11         , 4.88493876813504171e-12         , 6.36474587694088758e-13         , 7.31721901918578845e-14         , },
+/* x = 20.0        */  {3.62630643191607756e-9          , 2.21491267938658453e-9          , 7.21768609012490306e-10         , 1.65839273751191166e-10         , 2.99843242659197907e-11         , 4.51800649920206592e-12         , 5.87308113687851356e-13         , 6.73845958641160828e-14         , },
+/* x = 20.1        */  {3.41186996462679278e-9          , 2.07541642273052362e-9          , 6.737715732813603e-10           , 1.54285830548988921e-10         , 2.78111065093378622e-11         , 4.17939208820332031e-12         , 5.42027288852652555e-13         , 6.20636798800239593e-14         , },
+/* x = 20.2        */  {3.21091449210861917e-9          , 1.94518149616848882e-9          , 6.29113496770305291e-10         , 1.43568700310103862e-10         , 2.58005862212982545e-11         , 3.86685941207914332e-12         , 5.00319020669137487e-13         , 5.71711891654746774e-14         , },
+/* x = 20.3        */  {3.02254645064385123e-9          , 1.82356455928496727e-9          , 5.8755299189122545e-10          , 1.33625342243696496e-10         , 2.39402437378909467e-11         , 3.57835239763608787e-12         , 4.61895864495927727e-13         , 5.26720505465874234e-14         , },
+/* x = 20.4        */  {2.84593425798955496e-9          , 1.7099687220259641e-9           , 5.4886670225026338e-10          , 1.24398023445407423e-10         , 2.22185455165096425e-11         , 3.31198028145345141e-12         , 4.26493892668333235e-13         , 4.85341032018599177e-14         , },
+/* x = 20.5        */  {2.68030384394245423e-9          , 1.60384007883352715e-9          , 5.12847917830713297e-10         , 1.1583344051949036e-10          , 2.06248649087789272e-11         , 3.06600409377361132e-12         , 3.93870742800217647e-13         , 4.47278538608742522e-14         , },
+/* x = 20.6        */  {2.52493451401278225e-9          , 1.50466450870261947e-9          , 4.7930529906795014e-10          , 1.07882371578355477e-10         , 1.91494094071627069e-11         , 2.83882426349134906e-12         , 3.63803830059736781e-13         , 4.12262527980994457e-14         , },
+/* x = 20.7        */  {2.37915512067404232e-9          , 1.41196472026791407e-9          , 4.4806170108060706e-10          , 1.00499356138952472e-10         , 1.77831538285887121e-11         , 2.62896925009719094e-12         , 3.36088709495732237e-13         , 3.80044888390791128e-14         , },
+/* x = 20.8        */  {2.24234051865993492e-9          , 1.325297522702923e-9            , 4.18953090035121936e-10         , 9.36424006409466996e-11         , 1.65177789434688603e-11         , 2.43508511642038487e-12         , 3.10537575684723571e-13         , 3.50398017503446461e-14         , },
+/* x = 20.9        */  {2.11390828262346489e-9          , 1.2442513047521214e-9           , 3.91827544274633134e-10         , 8.72727074999233413e-11         , 1.53456150997186939e-11         , 2.25592596332321727e-12         , 2.86977888058531526e-13         , 3.23113105250404994e-14         , },
+/* x = 21.0        */  {1.99331566716952866e-9          , 1.16844370562969109e-9          , 3.66544333442981772e-10         , 8.13544257813561591e-11         , 1.42595904291081894e-11         , 2.09034515417906653e-12         , 2.65251111268547909e-13         , 2.97998562046623471e-14         , },
+/* x = 21.1        */  {1.88005679083310035e-9          , 1.09751946281654416e-9          , 3.42973069384802693e-10         , 7.58544217391359051e-11         , 1.32531832578099657e-11         , 1.93728726307585857e-12         , 2.45211560852727125e-13         , 2.74878579945615435e-14         , },
+/* x = 21.2        */  {1.77366002701149822e-9          , 1.03114842297988428e-9          , 3.20992923107506056e-10         , 7.07420676072916245e-11         , 1.23203783746225238e-11         , 1.79578068627371793e-12         , 2.26725345302976066e-13         , 2.53591815379366971e-14         , },
+/* x = 21.3        */  {1.67368558618122288e-9          , 9.69023703335418816e-10         , 3.00491902554161709e-10         , 6.59890471662740561e-11         , 1.14556268392852543e-11         , 1.66493086155559293e-12         , 2.09669396390576418e-13         , 2.33990183108056924e-14         , },
+/* x = 21.4        */  {1.57972327494678444e-9          , 9.10859991779416318e-10         , 2.81366186361374392e-10         , 6.15691767268267996e-11         , 1.06538090397967213e-11         , 1.54391404478356905e-12         , 1.93930580301804173e-13         , 2.1593775189741278e-14          , },
+/* x = 21.5        */  {1.49139041858928591e-9          , 8.56391975043416656e-10         , 2.63519509166360675e-10         , 5.74582402859832847e-11         , 9.91020073190664659e-12         , 1.43197159724899853e-12         , 1.79404882770689992e-13         , 1.99309733257011338e-14         , },
+/* x = 21.6        */  {1.40832993481411064e-9          , 8.05372884975239595e-10         , 2.46862594385521454e-10         , 5.36338377119515002e-11         , 9.22044181616566702e-12         , 1.32840474131573935e-12         , 1.65996661976070274e-13         , 1.83991555317648471e-14         , },
+/* x = 21.7        */  {1.3302085473470391e-9           , 7.57573153832139219e-10         , 2.31312630715514095e-10         , 5.00752449083666747e-11         , 8.58050762825947203e-12         , 1.23256974543401813e-12         , 1.53617963500439731e-13         , 1.69878014606218409e-14         , },
+/* x = 21.8        */  {1.25671512890307329e-9          , 7.12779170191143183e-10         , 2.16792788909608677e-10         , 4.67632849943207717e-11         , 7.98668253698458925e-12         , 1.14387350287630071e-12         , 1.42187892132947045e-13         , 1.56872499097983104e-14         , },
+/* x = 21.9        */  {1.18755916385821403e-9          , 6.70792127742956239e-10         , 2.03231775659200353e-10         , 4.36802096153719669e-11         , 7.43553566128740324e-12         , 1.06176947154219099e-12         , 1.31632035742114871e-13         , 1.4488627649380629e-14          , },
+/* x = 22.0        */  {1.12246932169696388e-9          , 6.31426959844027374e-10         , 1.90563421664793712e-10         , 4.0809589572996753e-11          , 6.92389853341903748e-12         , 9.85753944920641136e-13         , 1.21881936849109858e-13         , 1.3383784218855493e-14          , },
+/* x = 22.1        */  {1.06119213299250667e-9          , 5.94511353260817776e-10         , 1.78726301214452024e-10         , 3.81362140262205746e-11         , 6.44884454957815408e-12         , 9.15362626806443629e-13         , 1.12874607902920507e-13         , 1.23652321870703211e-14         , },
+/* x = 22.2        */  {1.00349076030702208e-9          , 5.59884835054941313e-10         , 1.67663380802333984e-10         , 3.56459975799520023e-11         , 6.00767006253276535e-12         , 8.50167484664000093e-13         , 1.04552086597617703e-13         , 1.14260924126107265e-14         , },
+/* x = 22.3        */  {9.49143856980723388e-10         , 5.27397927031330191e-10         , 1.57321694517098172e-10         , 3.33258946303099246e-11         , 5.59787698273251849e-12         , 7.89773858632921611e-13         , 9.68610278817112788e-14         , 1.05600438814507718e-14         , },
+/* x = 22.4        */  {8.97944507313906052e-10         , 4.96911362607253724e-10         , 1.47652044111084443e-10         , 3.11638203883936504e-11         , 5.2171567654376251e-12          , 7.33817805093734117e-13         , 8.97523295929749141e-14         , 9.76127773488063017e-15         , },
+/* x = 22.5        */  {8.49699242140187326e-10         , 4.68295361360959336e-10         , 1.38608721827604323e-10         , 2.91485780508871766e-11         , 4.8633756714847239e-12          , 6.81963655473034868e-13         , 8.31807889112726361e-14         , 9.02445513375127862e-15         , },
+/* x = 22.6        */  {8.04227124244534251e-10         , 4.41428956887730276e-10         , 1.30149254216601434e-10         , 2.72697916289636258e-11         , 4.53456119856128925e-12         , 6.33901772579755394e-13         , 7.71047870589670853e-14         , 8.34466863526713427e-15         , },
+/* x = 22.7        */  {7.61358898499678813e-10         , 4.16199373930850098e-10         , 1.22234165309488731e-10         , 2.55178439864866759e-11         , 4.22888958833989156e-12         , 5.8934648824042185e-13          , 7.14859998953253761e-14         , 7.71740678615172079e-15         , },
+/* x = 22.8        */  {7.20936201981917878e-10         , 3.92501451067703144e-10         , 1.14826757653150234e-10         , 2.38838196747881213e-11         , 3.94467432259677175e-12         , 5.48034207353062803e-13         , 6.62891322497009079e-14         , 7.13852166123359014e-15         , },
+/* x = 22.9        */  {6.82810829684676633e-10         , 3.7023710551920127e-10          , 1.07892909821844286e-10         , 2.23594521846050616e-11         , 3.68035552856536007e-12         , 5.09721664717297581e-13         , 6.14816740197462449e-14         , 6.60419909955527092e-15         , },
+/* x = 23.0        */  {6.46844051777954166e-10         , 3.49314836915909462e-10         , 1.01400889134918876e-10         , 2.09370752663343329e-11         , 3.4344902203090281e-12          , 4.7418432213183539e-13          , 5.70336762269531924e-14         , 6.11093141118449855e-15         , },
+/* x = 23.1        */  {6.12905978666053338e-10         , 3.29649267098482338e-10         , 9.53211784086317501e-11         , 1.96095779978325833e-11         , 3.20574330888835774e-12         , 4.41214894288984472e-13         , 5.29175453737459524e-14         , 5.65549234717559416e-15         , },
+/* x = 23.2        */  {5.80874970376832952e-10         , 3.11160713255005062e-10         , 8.96263156626783164e-11         , 1.83703633047656373e-11         , 2.99287931959215124e-12         , 4.10621992946909998e-13         , 4.91078545853817371e-14         , 5.23491414274588019e-15         , },
+/* x = 23.3        */  {5.50637087074955863e-10         , 2.93774791905103498e-10         , 8.42907457869283356e-11         , 1.72133096621808652e-11         , 2.79475475954002803e-12         , 3.82228879731693247e-13         , 4.55811701471458653e-14         , 4.84646645984012996e-15         , },
+/* x = 23.4        */  {5.2208557773094092e-10          , 2.77422051431670449e-10         , 7.92906832519632064e-11         , 1.61327357277155269e-11         , 2.61031108358595264e-12         , 3.55872318719502936e-13         , 4.23158921637751166e-14         , 4.48763706998551376e-15         , },
+/* x = 23.5        */  {4.95120404198822364e-10         , 2.62037631037052793e-10         , 7.46039850188441232e-11         , 1.51233676768222742e-11         , 2.43856821069136982e-12         , 3.31401520680582814e-13         , 3.92921081746267726e-14         , 4.15611413180926794e-15         , },
+/* x = 23.6        */  {4.69647798159315011e-10         , 2.47560944162757044e-10         , 7.02100328696366249e-11         , 1.41803090287365164e-11         , 2.278618546825785e-12           , 3.08677171536948963e-13         , 3.64914586556745188e-14         , 3.84976992990998445e-15         , },
+/* x = 23.7        */  {4.45579848573900033e-10         , 2.33935384561259604e-10         , 6.60896244410360095e-11         , 1.32990127687633366e-11         , 2.12962147402090806e-12         , 2.87570538199852949e-13         , 3.38970134287267575e-14         , 3.56664595304017318e-15         , },
+/* x = 23.8        */  {4.22834117469401411e-10         , 2.21108053346364559e-10         , 6.22248722994092525e-11         , 1.24752555879469691e-11         , 1.99079826847868873e-12         , 2.67962645515938238e-13         , 3.14931580800320478e-14         , 3.30493919986315982e-15         , },
+/* x = 23.9        */  {4.01333282033537275e-10         , 2.09029505475665934e-10         , 5.85991104470855648e-11         , 1.17051140754161874e-11         , 1.86142741363825892e-12         , 2.4974351856692832e-13          , 2.92654895653038913e-14         , 3.06298960997416253e-15         , },
+/* x = 24.0        */  {3.81004801150634372e-10         , 1.97653514235897257e-10         , 5.51968076971503641e-11         , 1.09849427117775352e-11         , 1.74084027686443626e-12         , 2.32811485040597663e-13         , 2.72007202467511345e-14         , 2.83926852649908749e-15         , },
+/* x = 24.1        */  {3.61780604644136667e-10         , 1.86936852410074234e-10         , 5.20034873976573211e-11         , 1.03113535239498134e-11         , 1.62841712095161369e-12         , 2.17072532824315261e-13         , 2.52865896704784901e-14         , 2.63236810447419975e-15         , },
+/* x = 24.2        */  {3.43596803619594452e-10         , 1.76839088905078058e-10         , 4.90056530263742177e-11         , 9.68119727288437097e-12         , 1.5235834239604078e-12          , 2.02439718369931075e-13         , 2.35117834501155653e-14         , 2.44099158642838845e-15         , },
+/* x = 24.3        */  {3.26393420419292681e-10         , 1.67322399710350777e-10         , 4.61907192141996057e-11         , 9.09154605577608999e-12         , 1.42580648303762298e-12         , 1.88832621743231844e-13         , 2.18658586751915996e-14         , 2.26394437319483197e-15         , },
+/* x = 24.4        */  {3.10114136808307484e-10         , 1.58351392143290331e-10         , 4.35469477894848356e-11         , 8.5396772137124368e-12          , 1.33459227982871779e-12         , 1.76176844605400533e-13         , 2.03391753110076067e-14         , 2.10012582402307634e-15         , },
+/* x = 24.5        */  {2.94706059112250239e-10         , 1.4989294141530205e-10          , 4.10633884669051002e-11         , 8.02305844429945674e-12         , 1.24948258689051312e-12         , 1.64403547680413411e-13         , 1.89228331009433333e-14         , 1.94852172559392157e-15         , },
+/* x = 24.6        */  {2.80119499119897786e-10         , 1.4191603862480154e-10          , 3.87298238334596818e-11         , 7.53933402670546294e-12         , 1.170052296163624e-12           , 1.53449024543425021e-13         , 1.76086135226167628e-14         , 1.80819737460197152e-15         , },
+/* x = 24.7        */  {2.66307769649894361e-10         , 1.34391649350245268e-10         , 3.65367183108439213e-11         , 7.08631207383166206e-12         , 1.09590695208117944e-12         , 1.43254308823051841e-13         , 1.6388926386402804e-14          , 1.67829122320435664e-15         , },
+/* x = 24.8        */  {2.53226993760279208e-10         , 1.272925820779262e-10           , 3.44751707980057131e-11         , 6.6619527330056811e-12          , 1.02668047328395163e-12         , 1.33764812147017646e-13         , 1.52567606988024599e-14         , 1.55800904087564351e-15         , },
+/* x = 24.9        */  {2.4083592665323524e-10          , 1.20593365756213969e-10         , 3.25368707203448978e-11         , 6.26435726274624741e-12         , 9.6203304819224956e-13          , 1.24929990377649984e-13         , 1.4205639444296759e-14          , 1.44661855009179701e-15         , },
+/* x = 25.0        */  {2.29095789395621767e-10         , 1.14270135820511603e-10         , 3.07140572328884927e-11         , 5.89175791880856185e-12         , 9.01649190861190402e-13         , 1.16703035882849796e-13         , 1.32295779678612534e-14         , 1.34344449682087211e-15         , },
+/* x = 25.1        */  {2.17970113638965875e-10         , 1.08300528081783755e-10         , 2.89994813440195118e-11         , 5.54250858793004413e-12         , 8.45235944626814259e-13         , 1.09040593770888862e-13         , 1.23230456664766166e-14         , 1.24786412005286266e-15         , },
+/* x = 25.2        */  {2.07424596581027689e-10         , 1.02663579916397331e-10         , 2.73863707440819564e-11         , 5.21507611249168896e-12         , 7.92521222043805734e-13         , 1.01902500185090511e-13         , 1.14809307219497745e-14         , 1.15930298758139354e-15         , },
+/* x = 25.3        */  {1.97426965465179543e-10         , 9.73396382364924574e-11         , 2.58683971395486771e-11         , 4.90803225372481241e-12         , 7.43252270528528394e-13         , 9.52515409083702673e-14         , 1.06985076293419219e-14         , 1.07723116797908657e-15         , },
+/* x = 25.4        */  {1.87946850963975466e-10         , 9.23102737584347166e-11         , 2.44396459085318336e-11         , 4.62004624515729426e-12         , 6.97194253960263842e-13         , 8.90532286689018875e-14         , 9.97140729545288907e-15         , 1.00115971120782523e-15         , },
+/* x = 25.5        */  {1.78955668839737464e-10         , 8.7558201122332705e-11          , 2.30945879073383763e-11         , 4.34987789173580778e-12         , 6.54128941265025817e-13         , 8.3275597667881013e-14          , 9.29558950028953179e-15         , 9.30637412594321815e-16         , },
+/* x = 25.6        */  {1.70426509318027359e-10         , 8.30672044483627161e-11         , 2.1828053270617973e-11          , 4.09637117350693207e-12         , 6.13853493715638399e-13         , 7.78890139694454282e-14         , 8.66731753138991692e-15         , 8.65247836998211518e-16         , },
+/* x = 25.7        */  {1.62334033649764565e-10         , 7.88220679459317689e-11         , 2.06352070595032739e-11         , 3.85844831591429536e-12         , 5.76179343334012432e-13         , 7.28660005021589893e-14         , 8.0831348164139255e-15          , 8.04606581920688095e-16         , },
+/* x = 25.8        */  {1.54654377374728233e-10         , 7.48085112197217716e-11         , 1.95115266230806727e-11         , 3.63510429169288311e-12         , 5.40931155381390385e-13         , 6.81810755218828778e-14         , 7.53984339366240527e-15         , 7.48358760061385159e-16         , },
+/* x = 25.9        */  {1.47365059833465631e-10         , 7.10131289425669077e-11         , 1.84527805486257871e-11         , 3.42540172203545911e-12         , 5.07945868474035096e-13         , 6.38106034780825021e-14         , 7.03448407325910409e-15         , 6.96176683443446904e-16         , },
+/* x = 26.0        */  {1.40444899506419465e-10         , 6.74233345890850634e-11         , 1.74550090853580133e-11         , 3.22846614718814567e-12         , 4.77071806369336354e-13         , 5.97326573103286968e-14         , 6.56431815372107911e-15         , 6.4775773270400726e-16          , },
+/* x = 26.1        */  {1.33873934788571535e-10         , 6.4027307946161297e-11          , 1.6514505935073624e-11          , 3.0434816389195451e-12          , 4.48167855934200766e-13         , 5.59268912795687002e-14         , 6.12681056964452618e-15         , 6.02822396501024404e-16         , },
+/* x = 26.2        */  {1.27633349835250967e-10         , 6.08139461369043024e-11         , 1.56278013109630479e-11         , 2.86968672941592888e-12         , 4.21102706237177188e-13         , 5.23744235102346681e-14         , 5.71961435632678291e-15         , 5.61112467228041153e-16         , },
+/* x = 26.3        */  {1.21705405140131142e-10         , 5.77728179136920947e-11         , 1.47916461732567699e-11         , 2.70637063309828358e-12         , 3.95754144101082371e-13         , 4.90577274849465904e-14         , 5.34055632640740706e-15         , 5.22389380365513023e-16         , },
+/* x = 26.4        */  {1.16073372529987317e-10         , 5.48941209935074115e-11         , 1.40029975571231868e-11         , 2.55286973964852666e-12         , 3.72008401816709573e-13         , 4.59605317939303022e-14         , 4.98762386211110274e-15         , 4.86432685839602083e-16         , },
+/* x = 26.5        */  {1.10721474282642433e-10         , 5.21686422250441319e-11         , 1.32590049145044315e-11         , 2.40856435818407296e-12         , 3.49759553053078415e-13         , 4.30677274967478427e-14         , 4.65895273447639187e-15         , 4.53038640714769594e-16         , },
+/* x = 26.6        */  {1.05634826094816958e-10         , 4.95877203921425277e-11         , 1.25569973973628456e-11         , 2.27287569404324428e-12         , 3.28908953307958931e-13         , 4.03652825049282583e-14         , 4.35281586811448445e-15         , 4.22018913422426577e-16         , },
+/* x = 26.7        */  {1.00799383645435781e-10         , 4.71432114720748377e-11         , 1.18944720151584498e-11         , 2.14526304104897598e-12         , 3.09364721526226083e-13         , 3.78401624409601864e-14         , 4.06761297661606845e-15         , 3.93199390531009899e-16         , },
+/* x = 26.8        */  {9.6201892517437998e-11          , 4.48274561801378283e-11         , 1.12690826043205131e-11         , 2.02522117341426432e-12         , 2.91041259774946212e-13         , 3.5480257472200722e-14          , 3.80186099975851669e-15         , 3.66419077799264572e-16         , },
+/* x = 26.9        */  {9.1829841257382948e-11          , 4.26332496439934863e-11         , 1.0678629552045539e-11          , 1.91227792264844216e-12         , 2.73858808104775486e-13         , 3.3274314657877641e-14          , 3.55418527920698983e-15         , 3.4152908792983299e-16          , },
+/* x = 27.0        */  {8.76714173672394e-11            , 4.0553813062304554e-11          , 1.01210502209785544e-11         , 1.8059919259265959e-12          , 2.57743031948925736e-13         , 3.12118753837978549e-14         , 3.323311414491047e-15           , 3.18391708059606146e-16         , },
+/* x = 27.1        */  {8.37154660367689934e-11         , 3.85827672125044913e-11         , 9.59441002524114261e-12         , 1.70595053340253648e-12         , 2.42624639615152505e-13         , 2.92832174928842831e-14         , 3.10805774571116703e-15         , 2.96879540591372645e-16         , },
+/* x = 27.2        */  {7.99514514379479668e-11         , 3.67141076820827639e-11         , 9.0968941118827005e-12          , 1.61176786288541611e-12         , 2.28439027614346342e-13         , 2.74793017504849098e-14         , 2.90732841372140037e-15         , 2.76874711492403763e-16         , },
+/* x = 27.3        */  {7.6369420414985256e-11          , 3.49421817066125073e-11         , 8.62679960517352747e-12         , 1.52308299116750945e-12         , 2.1512595174264977e-13          , 2.57917223117506287e-14         , 2.72010695247670283e-15         , 2.58268140663668182e-16         , },
+/* x = 27.4        */  {7.29599684147570268e-11         , 3.32616665059506913e-11         , 8.18252837425037295e-12         , 1.43955827209152628e-12         , 2.02629221993762241e-13         , 2.42126608844634894e-14         , 2.54545037185520241e-15         , 2.40958869421977477e-16         , },
+/* x = 27.5        */  {6.97142075129495219e-11         , 3.16675490176489762e-11         , 7.76258028748616366e-12         , 1.36087777218531254e-12         , 1.90896419525321043e-13         , 2.27348443046984713e-14         , 2.38248369259316222e-15         , 2.24853440539817772e-16         , },
+/* x = 27.6        */  {6.6623736400941001e-11          , 3.0155106933670912e-11          , 7.36554691960347772e-12         , 1.28674581537473135e-12         , 1.79878634038956332e-13         , 2.13515052647890597e-14         , 2.23039489802796314e-15         , 2.09865326656941046e-16         , },
+/* x = 27.7        */  {6.36806122075125088e-11         , 2.87198909530589702e-11         , 6.99010568000222407e-12         , 1.21688562891631536e-12         , 1.69530220058731114e-13         , 2.00563459533948966e-14         , 2.08843027015425183e-15         , 1.95914403216733638e-16         , },
+/* x = 27.8        */  {6.08773240379052697e-11         , 2.73577081692710031e-11         , 6.63501433304094522e-12         , 1.15103808327401334e-12         , 1.59808570708035452e-13         , 1.88435043861810708e-14         , 1.95589008008084841e-15         , 1.82926462391479059e-16         , },
+/* x = 27.9        */  {5.82067681205850846e-11         , 2.60646065165450568e-11         , 6.29910588311203932e-12         , 1.08896051920276384e-12         , 1.50673907691383758e-13         , 1.77075232228439352e-14         , 1.83212460534975065e-15         , 1.70832764746203886e-16         , },
+/* x = 28.0        */  {5.56622244593732195e-11         , 2.48368602048863655e-11         , 5.9812837992967665e-12          , 1.03042565579916201e-12         , 1.42089086285677168e-13         , 1.66433208820777228e-14         , 1.71653044876072459e-15         , 1.59569625652960894e-16         , },
+/* x = 28.1        */  {5.32373348953978795e-11         , 2.36709560781306736e-11         , 5.68051755618794531e-12         , 9.75220573739317005e-13         , 1.34019414235994832e-13         , 1.564616478067983e-14           , 1.60854713535122954e-15         , 1.49078033708106046e-16         , },
+/* x = 28.2        */  {5.0926082489646493e-11          , 2.25635808340513929e-11         , 5.39583846913762275e-12         , 9.23145768349049517e-13         , 1.26432483534470632e-13         , 1.47116465364416337e-14         , 1.50765396602617954e-15         , 1.39303298626145657e-16         , },
+/* x = 28.3        */  {4.87227721427901096e-11         , 2.15116090496700044e-11         , 5.12633580373374228e-12         , 8.74014267544542285e-13         , 1.19298014137849215e-13         , 1.38356589868589643e-14         , 1.41336710802849328e-15         , 1.30194726286697827e-16         , },
+/* x = 28.4        */  {4.66220123744381826e-11         , 2.05120919588231561e-11         , 4.87115314074318588e-12         , 8.27650810044910454e-13         , 1.1258770875040643e-13          , 1.30143748871071881e-14         , 1.32523690400163565e-15         , 1.21705318797522199e-16         , },
+/* x = 28.5        */  {4.46186981890935481e-11         , 1.95622469326579079e-11         , 4.6294849790870663e-12          , 7.83891079594186816e-13         , 1.06275117864532744e-13         , 1.22442271612385934e-14         , 1.24284538283051018e-15         , 1.13791497607793221e-16         , },
+/* x = 28.6        */  {4.27079949608401097e-11         , 1.86594476170886868e-11         , 4.40057356064567034e-12         , 7.42580991241022796e-13         , 1.00335514311844685e-13         , 1.15218905902463773e-14         , 1.16580395676731081e-15         , 1.06412847863078947e-16         , },
+/* x = 28.7        */  {4.0885323273234233e-11          , 1.78012146843744216e-11         , 4.18370590183227663e-12         , 7.03576026011928046e-13         , 9.4745776633605249e-14          , 1.08442648295661051e-14         , 1.09375129056362795e-15         , 9.95318823379895435e-17         , },
+/* x = 28.8        */  {3.91463446550079972e-11         , 1.69852071588792636e-11         , 3.97821101793390429e-12         , 6.66740610579896134e-13         , 8.94842806308639584e-14         , 1.02084586568127764e-14         , 1.02635132944780372e-15         , 9.31138234152307458e-17         , },
+/* x = 28.9        */  {3.74869481560494234e-11         , 1.62092142797812574e-11         , 3.7834573271990921e-12          , 6.31947538776437248e-13         , 8.45307985024065918e-14         , 9.61177535813539744e-15         , 9.63291473815113543e-16         , 8.71264017018032925e-17         , },
+/* x = 29.0        */  {3.59032377117212593e-11         , 1.54711478660050654e-11         , 3.59885022256378511e-12         , 5.99077432022878862e-13         , 7.98664050226420805e-14         , 9.05169916856247635e-15         , 9.04280889445036121e-16         , 8.15396699852150724e-17         , },
+/* x = 29.1        */  {3.43915202469340722e-11         , 1.47690351509910631e-11         , 3.42382979975160459e-12         , 5.68018235967700848e-13         , 7.5473390252233983e-14          , 8.52588268815827381e-15         , 8.4904894293129104e-16          , 7.63258313356299537e-17         , },
+/* x = 29.2        */  {3.29482944745181914e-11         , 1.41010120570864595e-11         , 3.25786873126908268e-12         , 5.38664750811932777e-13         , 7.13351783118678271e-14         , 8.03213520175424787e-15         , 7.97343752812554486e-16         , 7.14590802546100425e-17         , },
+/* x = 29.3        */  {3.15702403453581597e-11         , 1.34653168813662815e-11         , 3.10047027654436605e-12         , 5.10918192985447477e-13         , 6.74362517842742694e-14         , 7.56841183550274789e-15         , 7.48930847630395405e-16         , 6.6915455858198695e-17          , },
+/* x = 29.4        */  {3.02542091104773436e-11         , 1.28602843665739573e-11         , 2.95116641913360503e-12         , 4.84685786004433657e-13         , 6.3762081341723188e-14          , 7.13280348855723747e-15         , 7.03591922821133315e-16         , 6.26727061621655808e-17         , },
+/* x = 29.5        */  {2.89972139578027542e-11         , 1.22843401326228757e-11         , 2.80951612254659708e-12         , 4.59880378495433452e-13         , 6.02990602258696563e-14         , 6.72352748284881059e-15         , 6.61123688974713175e-16         , 5.87101626108661898e-17         , },
+/* x = 29.6        */  {2.77964211887134851e-11         , 1.17359954457310105e-11         , 2.67510369682581058e-12         , 4.36420087515021687e-13         , 5.70344432342572662e-14         , 6.33891887823345226e-15         , 6.21336804570645399e-16         , 5.50086240588825995e-17         , },
+/* x = 29.7        */  {2.66491419016921422e-11         , 1.12138423037791062e-11         , 2.54753726855396653e-12         , 4.14227965427344037e-13         , 5.39562898931406752e-14         , 5.97742240425684212e-15         , 5.84054886832540515e-16         , 5.15502494768927207e-17         , },
+/* x = 29.8        */  {2.55528241524680505e-11         , 1.0716548817897007e-11          , 2.42644734746794921e-12         , 3.93231688725115802e-13         , 5.10534115197370635e-14         , 5.63758496344967993e-15         , 5.49113594832424782e-16         , 4.83184587105043968e-17         , },
+/* x = 29.9        */  {2.4505045561973927e-11          , 1.02428548715998894e-11         , 2.31148548332376442e-12         , 3.73363267294045563e-13         , 4.83153218987024011e-14         , 5.31804866445060103e-15         , 5.16359779427204936e-16         , 4.52978406734948202e-17         , },
+/* x = 30.0        */  {2.35035063452434511e-11         , 9.79156804002329792e-12         , 2.20232300709117202e-12         , 3.54558772726665487e-13         , 4.57321913176884575e-14         , 5.01754434637789675e-15         , 4.85650695025434366e-16         , 4.24740684053874661e-17         , },
+/* x = 30.1        */  {2.25460227360644318e-11         , 9.36155975294933558e-12         , 2.09864985095989425e-12         , 3.36758084389847932e-13         , 4.32948037253951564e-14         , 4.73488555875583756e-15         , 4.56853268565746687e-16         , 3.98338204679200891e-17         , },
+/* x = 30.2        */  {2.16305207837791259e-11         , 8.95176168638203912e-12         , 2.00017344201417279e-12         , 3.19904652041443263e-13         , 4.09945167927052038e-14         , 4.46896296396516806e-15         , 4.29843421441563707e-16         , 3.73647081960221335e-17         , },
+/* x = 30.3        */  {2.07550305000972084e-11         , 8.56116236842333903e-12         , 1.90661766478097598e-12         , 3.0394527387601964e-13          , 3.88232246733799419e-14         , 4.21873913164755892e-15         , 4.04505440432340528e-16         , 3.50552083567161918e-17         , },
+/* x = 30.4        */  {1.99176803351649119e-11         , 8.18880398612714189e-12         , 1.81772188818125214e-12         , 2.8882988895811418e-13          , 3.67733232755048427e-14         , 3.98324369676634655e-15         , 3.80731394001875103e-16         , 3.28946008041502902e-17         , },
+/* x = 30.5        */  {1.91166919634224106e-11         , 7.8337793808726875e-12          , 1.73324005271505111e-12         , 2.74511383074171139e-13         , 3.48376778684900989e-14         , 3.76156885512538676e-15         , 3.58420590601099662e-16         , 3.0872910750998464e-17          , },
+/* x = 30.6        */  {1.8350375360986674e-11          , 7.49522922060379164e-12         , 1.65293981399172853e-12         , 2.60945407101866701e-13         , 3.30095928630394909e-14         , 3.55286517208775526e-15         , 3.37479075868141111e-16         , 2.89808553059591147e-17         , },
+/* x = 30.7        */  {1.76171241574243486e-11         , 7.17233933803194209e-12         , 1.57660173897732058e-12         , 2.48090207058189804e-13         , 3.1282783613175783e-14          , 3.3563376820287392e-15          , 3.17819165853991019e-16         , 2.72097939542385704e-17         , },
+/* x = 30.8        */  {1.69154112458339733e-11         , 6.8643382246022313e-12          , 1.5040185515739315e-12          , 2.35906465045822895e-13         , 2.96513501002240082e-14         , 3.17124225771449266e-15         , 2.99359013619430565e-16         , 2.55516826829189391e-17         , },
+/* x = 30.9        */  {1.62437846361438549e-11         , 6.57049467067527751e-12         , 1.43499442437191158e-12         , 2.24357150371377157e-13         , 2.81097523686703948e-14         , 2.99688223032938661e-15         , 2.82022206749352798e-16         , 2.39990314761472521e-17         , },
+/* x = 31.0        */  {1.56008635374557304e-11         , 6.29011554298884774e-12         , 1.36934431362592088e-12         , 2.13407380159190084e-13         , 2.66527875930945268e-14         , 2.83260524229115127e-15         , 2.65737393515639238e-16         , 2.2544864926305458e-17          , },
+/* x = 31.1        */  {1.49853346561291529e-11         , 6.02254369103286275e-12         , 1.30689333470178887e-12         , 2.03024288830972658e-13         , 2.52755686639711654e-14         , 2.67780031630230497e-15         , 2.50437935590499334e-16         , 2.11826857268735759e-17         , },
+/* x = 31.2        */  {1.43959486971112528e-11         , 5.76715597450363151e-12         , 1.24747617542342418e-12         , 1.93176905864860814e-13         , 2.3973504188107237e-14          , 2.5318951252973048e-15          , 2.36061585369790927e-16         , 1.99064408307149119e-17         , },
+/* x = 31.3        */  {1.38315170567748128e-11         , 5.52336140450012745e-12         , 1.19093654491885861e-12         , 1.83836041287623687e-13         , 2.27422798068661229e-14         , 2.39435344906491302e-15         , 2.22550186111339456e-16         , 1.87104900741155116e-17         , },
+/* x = 31.4        */  {1.32909086962378408e-11         , 5.29059939158929549e-12         , 1.13712665572271271e-12         , 1.74974178391133425e-13         , 2.15778407421792428e-14         , 2.2646728043614249e-15          , 2.098493932276124e-16           , 1.7589577082212782e-17          , },
+/* x = 31.5        */  {1.27730471848031973e-11         , 5.0683380943010075e-12          , 1.0859067370397678e-12          , 1.66565373198915538e-13         , 2.04763754866943325e-14         , 2.14238223628908095e-15         , 1.97908415196156981e-16         , 1.65388022855541781e-17         , },
+/* x = 31.6        */  {1.22769079037802888e-11         , 4.85607286201845036e-12         , 1.03714457721168515e-12         , 1.58585160240866515e-13         , 1.94343005602980059e-14         , 2.02704025960111607e-15         , 1.86679772665777318e-16         , 1.55535978905312919e-17         , },
+/* x = 31.7        */  {1.18015154015351094e-11         , 4.6533247666083705e-12          , 9.90715093556931845e-13         , 1.51010464224224505e-13         , 1.84482462607115619e-14         , 1.91823293941594527e-15         , 1.7611907444225212e-16          , 1.46297046584251888e-17         , },
+/* x = 31.8        */  {1.13459408911625813e-11         , 4.45963921748951372e-12         , 9.46499927873312969e-13         , 1.43819517216773301e-13         , 1.7515043340925297e-14          , 1.81557210158298933e-15         , 1.66184809135156677e-16         , 1.37631503588559239e-17         , },
+/* x = 31.9        */  {1.09092998826885783e-11         , 4.27458465516846243e-12         , 9.0438706600377689e-13          , 1.36991780984201947e-13         , 1.66317105509371785e-14         , 1.71869366364625013e-15         , 1.56838151337680602e-16         , 1.29502297736268375e-17         , },
+/* x = 32.0        */  {1.0490749942190457e-11          , 4.09775131858144266e-12         , 8.64270479969920762e-13         , 1.30507874147672682e-13         , 1.5795442985623714e-14          , 1.62725607800324054e-15         , 1.48042781294802866e-16         , 1.21874861363605351e-17         , },
+/* x = 32.1        */  {1.00894885706764352e-11         , 3.92875008186999779e-12         , 8.26049791274399674e-13         , 1.24349503850099062e-13         , 1.50036011846192908e-14         , 1.54093887946020976e-15         , 1.39764717092329929e-16         , 1.14716939020009611e-17         , },
+/* x = 32.2        */  {9.70475119598768516e-12         , 3.76721135648905303e-12         , 7.8962995406372141e-13          , 1.18499401640524658e-13         , 1.42537009338382972e-14         , 1.45944132994342874e-15         , 1.31972158470610908e-16         , 1.07998427482622267e-17         , },
+/* x = 32.3        */  {9.33580927138435689e-12         , 3.61278405479907776e-12         , 7.54920956927140874e-13         , 1.1294126330543259e-13          , 1.35434037217633921e-14         , 1.38248115364397677e-15         , 1.2463534143266692e-16          , 1.0169122718492764e-17          , },
+/* x = 32.4        */  {8.98196847484960174e-12         , 3.46513461153095944e-12         , 7.21837542185972478e-13         , 1.07659692393910833e-13         , 1.28705078068631322e-14         , 1.309793356353103e-15           , 1.1772640287742543e-16          , 9.57691042224163997e-18         , },
+/* x = 32.5        */  {8.64256700349559457e-12         , 3.32394605973391788e-12         , 6.90298941601004466e-13         , 1.02640147200443736e-13         , 1.22329398555111107e-14         , 1.241129123189692e-15           , 1.11219254545117614e-16         , 9.02075621610723788e-18         , },
+/* x = 32.6        */  {8.31697395778403057e-12         , 3.18891715802432516e-12         , 6.60228627494187234e-13         , 9.78688909847855204e-14         , 1.16287471125737109e-14         , 1.17625478933328413e-15         , 1.05089465614030108e-16         , 8.49837229325822284e-18         , },
+/* x = 32.7        */  {8.00458781058196442e-12         , 3.05976156614759402e-12         , 6.3155407834471389e-13          , 9.33329452229789603e-14         , 1.10560900694301892e-14         , 1.11495087875793173e-15         , 9.93141533360272603e-17         , 8.00762161538063862e-18         , },
+/* x = 32.8        */  {7.70483495636344663e-12         , 2.93620706604723448e-12         , 6.04206557979327344e-13         , 8.90200456971885226e-14         , 1.05132355966015509e-14         , 1.05701120631616423e-15         , 9.38718811428757256e-17         , 7.54650762575803885e-18         , },
+/* x = 32.9        */  {7.41716833613938964e-12         , 2.81799482580557063e-12         , 5.78120907532463625e-13         , 8.49186012446927467e-14         , 9.99855051040695102e-15         , 1.00224203885057135e-15         , 8.87425636966862088e-17         , 7.11316468676583311e-18         , },
+/* x = 33.0        */  {7.14106613395357963e-12         , 2.70487870398021799e-12         , 5.53235349403945321e-13         , 8.10176549981912253e-14         , 9.51049554515054578e-15         , 9.5046131131491526e-16          , 8.3907378395992018e-17          , 6.70584918928608695e-18         , },
+/* x = 33.1        */  {6.87603054102278219e-12         , 2.59662459200995613e-12         , 5.2949130249062203e-13          , 7.73068479605881643e-14         , 9.04761970427929236e-15         , 9.01497894169025766e-16         , 7.93486828843456142e-17         , 6.32293128545205815e-18         , },
+/* x = 33.2        */  {6.6215865838244447e-12          , 2.49300979250375049e-12         , 5.06833208013849233e-13         , 7.37763847676736205e-14         , 8.60855496575377029e-15         , 8.55190908573657253e-16         , 7.50499381410491002e-17         , 5.96288719973782914e-18         , },
+/* x = 33.3        */  {6.37728101264748594e-12         , 2.39382243135799961e-12         , 4.85208365307219335e-13         , 7.04170015016875556e-14         , 8.19201131854949395e-15         , 8.11389086154507633e-16         , 7.09956367639422308e-17         , 5.6242920767405704e-18          , },
+/* x = 33.4        */  {6.14268124732093476e-12         , 2.29886090177018127e-12         , 4.64566776968709833e-13         , 6.72199354276694356e-14         , 7.79677210876450506e-15         , 7.69950170330118201e-16         , 6.7171236082236276e-17          , 5.30581332708248349e-18         , },
+/* x = 33.5        */  {5.91737437702252973e-12         , 2.20793333833247952e-12         , 4.44861002818580831e-13         , 6.41768965328123696e-14         , 7.42168967525869722e-15         , 7.30740356407683158e-16         , 6.35630957633738319e-17         , 5.00620443570588507e-18         , },
+/* x = 33.6        */  {5.70096621124556482e-12         , 2.1208571194971942e-12          , 4.2604602213911141e-13          , 6.12800407567975987e-14         , 7.06568125609913403e-15         , 6.93633767845094763e-16         , 6.01584196019702384e-17         , 4.72429919946622604e-18         , },
+/* x = 33.7        */  {5.49308037916795703e-12         , 2.03745839680722893e-12         , 4.0807910370477363e-13          , 5.85219448083214016e-14         , 6.72772514834080424e-15         , 6.58511966257940306e-16         , 5.69452012011962893e-17         , 4.45900636336069129e-18         , },
+/* x = 33.8        */  {5.29335747482337122e-12         , 1.95757164938015919e-12         , 3.90919683141854872e-13         , 5.58955824697782623e-14         , 6.40685710484050629e-15         , 6.2526349291767278e-16          , 5.39121732776279235e-17         , 4.20930462697969057e-18         , },
+/* x = 33.9        */  {5.10145424562087387e-12         , 1.88103926222370298e-12         , 3.74529247184994068e-13         , 5.33943022983649731e-14         , 6.10216695288907332e-15         , 5.93783439642743509e-16         , 5.10487603397397955e-17         , 3.97423799484912228e-18         , },
+/* x = 34.0        */  {4.91704282189757021e-12         , 1.80771112704423108e-12         , 3.58871224424725714e-13         , 5.10118066377513466e-14         , 5.81279542045968655e-15         , 5.63973047128986487e-16         , 4.83450345079697964e-17         , 3.75291144625575795e-18         , },
+/* x = 34.1        */  {4.7398099853185406e-12          , 1.73744426428861537e-12         , 3.43910882165048889e-13         , 4.87421318599532968e-14         , 5.5379311568129073e-15          , 5.3573932889978935e-16          , 4.57916742607357595e-17         , 3.54448690192842625e-18         , },
+/* x = 34.2        */  {4.56945647406063172e-12         , 1.67010246523355161e-12         , 3.29615229033370105e-13         , 4.65796297621700852e-14         , 5.27680793507722512e-15         , 5.08994719181323002e-16         , 4.33799259060407227e-17         , 3.34817946659490671e-18         , },
+/* x = 34.3        */  {4.40569632283174188e-12         , 1.60555595300581459e-12         , 3.15952923007014049e-13         , 4.45189500481344716e-14         , 5.02870202524194932e-15         , 4.83656743124023022e-16         , 4.11015675924487841e-17         , 3.16325392795874769e-18         , },
+/* x = 34.4        */  {4.24825623588560499e-12         , 1.54368106148199699e-12         , 3.02894184540953391e-13         , 4.25550238279955536e-14         , 4.79292972676141041e-15         , 4.59647707899261741e-16         , 3.89488756863325096e-17         , 2.98902149405098152e-18         , },
+/* x = 34.5        */  {4.0968749912941345e-12          , 1.48435993107741583e-12         , 2.90410714500569255e-13         , 4.06830480749307889e-14         , 4.56884505067962349e-15         , 4.36894413300312993e-16         , 3.69145933544614402e-17         , 2.82483675221757116e-18         , },
+/* x = 34.6        */  {3.95130287483551871e-12         , 1.4274802204912939e-12          , 2.78475616621203073e-13         , 3.8898470980586099e-14          , 4.35583754184645021e-15         , 4.15327880569840877e-16         , 3.49919012022900965e-17         , 2.67009483421236539e-18         , },
+/* x = 34.7        */  {3.8113011419468229e-12          , 1.37293483352927125e-12         , 2.67063324233077635e-13         , 3.71969781550897091e-14         , 4.15333023241326726e-15         , 3.94883098262747324e-16         , 3.31743898287782344e-17         , 2.52422877298472226e-18         , },
+/* x = 34.8        */  {3.67664150627518744e-12         , 1.32062166017499353e-12         , 2.56149531005924488e-13         , 3.55744796207937829e-14         , 3.96077771837135242e-15         , 3.75498784033761323e-16         , 3.14560341682962367e-17         , 2.3867070377875707e-18          , },
+/* x = 34.9        */  {3.54710565344212956e-12         , 1.27044333113016333e-12         , 2.45711125482425296e-13         , 3.40270975520841179e-14         , 3.77766435143254976e-15         , 3.57117161314080806e-16         , 2.98311694991901624e-17         , 2.25703123519178193e-18         , },
+/* x = 35.0        */  {3.42248477871125596e-12         , 1.22230698508721977e-12         , 2.35726129183420852e-13         , 3.25511547165771302e-14         , 3.60350253905198305e-15         , 3.39683749911089985e-16         , 2.82944690069556198e-17         , 2.13473396448209471e-18         , },
+/* x = 35.1        */  {3.30257914732115049e-12         , 1.17612404804090877e-12         , 2.26173638080823149e-13         , 3.11431635758090597e-14         , 3.43783114585916337e-15         , 3.23147169630044008e-16         , 2.68409227977448988e-17         , 2.0193768167338145e-18          , },
+/* x = 35.2        */  {3.1871976763125753e-12          , 1.13181002398458884e-12         , 2.17033767246339281e-13         , 2.97998160061277233e-14         , 3.28021399019911728e-15         , 3.0745895607698543e-16          , 2.54658182651517288e-17         , 1.91054850763301001e-18         , },
+/* x = 35.3        */  {3.07615753674265921e-12         , 1.08928429637434187e-12         , 2.08287598495533189e-13         , 2.85179736029343265e-14         , 3.13023842989131284e-15         , 2.9257338785835405e-16          , 2.41647217199233308e-17         , 1.80786313481050541e-18         , },
+/* x = 35.4        */  {2.96928377523867171e-12         , 1.04846993977897035e-12         , 1.99917130857461209e-13         , 2.72946585337030554e-14         , 2.98751403169319452e-15         , 2.78447324445070372e-16         , 2.29334611984777813e-17         , 1.71095855111580775e-18         , },
+/* x = 35.5        */  {2.86640895390050904e-12         , 1.00929354116690023e-12         , 1.91905233710165468e-13         , 2.61270449073398767e-14         , 2.8516713193089245e-15          , 2.65040054017589024e-16         , 2.1768110371890927e-17          , 1.61949484586509217e-18         , },
+/* x = 35.6        */  {2.76737280761435199e-12         , 9.71685030311998732e-13         , 1.84235602431737892e-13         , 2.50124506294389225e-14         , 2.7223605951142027e-15          , 2.52313150653787281e-16         , 2.06649734823934255e-17         , 1.53315292666106775e-18         , },
+/* x = 35.7        */  {2.67202191789028076e-12         , 9.3557751882947957e-13          , 1.76892716425516601e-13         , 2.39483297148641108e-14         , 2.59925083107641621e-15         , 2.40230340263812307e-16         , 1.96205712394147584e-17         , 1.45163319490527148e-18         , },
+/* x = 35.8        */  {2.5802094023841292e-12          , 9.00907147380516517e-13         , 1.6986179938628281e-13          , 2.29322650308336953e-14         , 2.4820286246373486e-15          , 2.2875737471537856e-16          , 1.86316276118548738e-17         , 1.37465430860813587e-18         , },
+/* x = 35.9        */  {2.49179461930869335e-12         , 8.6761294061002443e-13          , 1.63128781682124511e-13         , 2.19619614453241455e-14         , 2.37039721559465605e-15         , 2.17861913629687537e-16         , 1.76950574575810098e-17         , 1.30195202655187008e-18         , },
+/* x = 36.0        */  {2.406642885981735e-12           , 8.35636669406393757e-13         , 1.56680264733955605e-13         , 2.10352393571444461e-14         , 2.26407556026958485e-15         , 2.07513413362324866e-16         , 1.68079549351608812e-17         , 1.23327812827838822e-18         , },
+/* x = 36.1        */  {2.32462521079818538e-12         , 8.04922720094871956e-13         , 1.50503487281555841e-13         , 2.01500285854694356e-14         , 2.16279745948316927e-15         , 1.9768302271534981e-16          , 1.59675826465756752e-17         , 1.16839940476162083e-18         , },
+/* x = 36.2        */  {2.24561803795169552e-12         , 7.75417970197859521e-13         , 1.44586293431456135e-13         , 1.93043625979675349e-14         , 2.06631073708252924e-15         , 1.88343484956492227e-16         , 1.51713614631274682e-17         , 1.10709671498278157e-18         , },
+/* x = 36.3        */  {2.16950300426632641e-12         , 7.47071670415710292e-13         , 1.38917102388061878e-13         , 1.84963730579201005e-14         , 1.97437646596392649e-15         , 1.79469045749062972e-16         , 1.44168609899845293e-17         , 1.04916410396058719e-18         , },
+/* x = 36.4        */  {2.09616670753284687e-12         , 7.19835332500771108e-13         , 1.33484879775108413e-13         , 1.77242846719122093e-14         , 1.88676823873090428e-15         , 1.71035366622005636e-16         , 1.37017906278119031e-17         , 9.94407978097947572e-19         , },
+/* x = 36.5        */  {2.02550048577592214e-12         , 6.9366262271543574e-13          , 1.28279110459900824e-13         , 1.69864103207831123e-14         , 1.80327148030503098e-15         , 1.63019443633600448e-16         , 1.30239911927297806e-17         , 9.42646333994011577e-19         , },
+},
+/* n = 16 */
+{
+/* x = 0.0         */  {0.030303030303030303            , 0.0285714285714285714           , 0.0135135135135135135           , 0.0042735042735042735           , 0.00101626016260162602          , 0.000193798449612403101         , 0.0000308641975308641975        , 4.2215467747382641e-6           , },
+/* x = 0.1         */  {0.0275768487952278917           , 0.0259929610328042599           , 0.0122905452804738069           , 0.00388577726591844792          , 0.000923846289366091698         , 0.000176138779178110745         , 0.0000280464064103602031        , 3.83546593225298297e-6          , },
+/* x = 0.2         */  {0.0250966630183948392           , 0.0236478163226195912           , 0.0111785227671297902           , 0.00353330487067609132          , 0.000839852777106615753         , 0.000160091241561000891         , 0.0000254862964471622849        , 3.48474792166476729e-6          , },
+/* x = 0.3         */  {0.0228402157184407513           , 0.0215148300447115443           , 0.0101673590693218194           , 0.00321287512447132529          , 0.000763511003095295276         , 0.000145508421722953964         , 0.0000231602671498254309        , 3.1661491311594233e-6           , },
+/* x = 0.4         */  {0.0207872683484018425           , 0.0195747618270268762           , 0.00924788619393835338          , 0.00292156923245809368          , 0.000694122622893469818         , 0.00013225640512015625          , 0.0000210468826117481755        , 2.87672385540713922e-6          , },
+/* x = 0.5         */  {0.0189194175688669391           , 0.017810120059975568            , 0.00841177119325572798          , 0.00265673476471507448          , 0.000631053134612250224         , 0.000120213539548506636         , 0.000019126672718973361         , 2.61379690121100656e-6          , },
+/* x = 0.6         */  {0.0172199284620836816           , 0.0162050026289458826           , 0.00765143996628310709          , 0.0024159613070727072           , 0.000573726033367605978         , 0.00010926931069234618          , 0.0000173819526371294603        , 2.37493871510715647e-6          , },
+/* x = 0.7         */  {0.0156735829346023549           , 0.0147449521789058558           , 0.00696000802510551417          , 0.0021970583412379207           , 0.000521617501734045479         , 0.0000993233209219716495        , 0.0000157966588948057508        , 2.15794280049557981e-6          , },
+/* x = 0.8         */  {0.0142665419227219724           , 0.0134168245828771868           , 0.00633121758858748333          , 0.00199803514981793493          , 0.000474251586983728705         , 0.0000902843618477471562        , 0.0000143562005357237281        , 1.96080521332182531e-6          , },
+/* x = 0.9         */  {0.0129862201416478336           , 0.0122086694076552212           , 0.00575938042425934134          , 0.00181708256061038402          , 0.000431195820422008077         , 0.0000820695720123001665        , 0.000013047323952831595         , 1.7817059447910677e-6           , },
+/* x = 1.0         */  {0.0118211722343218805           , 0.0111096212805898677           , 0.00523932591230076191          , 0.00165255636156783829          , 0.000392057238238163281         , 0.0000746036718954597779        , 0.0000118579901452292584        , 1.61899201726048124e-6          , },
+/* x = 1.1         */  {0.0107609892804094468           , 0.0101098011615600867           , 0.00476635385375533701          , 0.00150296223331934738          , 0.000356478767019843451         , 0.0000678182691266909193        , 0.0000107772632548267615        , 1.47116213548949497e-6          , },
+/* x = 1.2         */  {0.00979620472088357198          , 0.0092002266153982411           , 0.00433619158890340455          , 0.0013669420601840167           , 0.000324135940466281426         , 0.0000616512274535375919        , 9.79520934493742904e-6          , 1.33685274998103541e-6          , },
+/* x = 1.3         */  {0.00891820883991747682          , 0.00837273026279389695          , 0.00394495503149495966          , 0.00124326149337271872          , 0.000294733916910313752         , 0.000056046093608128618         , 8.90280447859565489e-6          , 1.21482540235703719e-6          , },
+/* x = 1.4         */  {0.00811917102417317894          , 0.00761988566289586713          , 0.00358911326066944152          , 0.00113079865166263067          , 0.000268004770051325902         , 0.0000509515767526732455        , 8.09185124116441956e-6          , 1.10395523470243175e-6          , },
+/* x = 1.5         */  {0.0073919690907826239           , 0.00693493994913225328          , 0.00326545634519983932          , 0.00102853385535323782          , 0.000243705027836497524         , 0.0000463210756741214849        , 7.35490293057270059e-6          , 1.00322055569614222e-6          , },
+/* x = 1.6         */  {0.00673012504001383865          , 0.00631175260181289595          , 0.00297106610449936712          , 0.000935540298869674934         , 0.000221613436729798517         , 0.0000421122493423602389        , 6.68519471003620852e-6          , 9.11693366227538918e-7          , },
+/* x = 1.7         */  {0.00612774664739495662          , 0.00574473979744085834          , 0.00270328953789638115          , 0.000850975576058703658         , 0.000201528930698553992         , 0.0000382866268496139165        , 6.07658108303642102e-6          , 8.2853075616511385e-7           , },
+/* x = 1.8         */  {0.00557947436347528534          , 0.00522882382586052163          , 0.00245971467826829428          , 0.000774073980104964749         , 0.000183268786145546446         , 0.0000348092531148869556        , 5.52347910927089219e-6          , 7.52967092085007095e-7          , },
+/* x = 1.9         */  {0.00508043303792696749          , 0.00475938711288286171          , 0.00223814864845593514          , 0.000704139507153690697         , 0.00016666694573825187          , 0.00003164836706974734          , 5.02081683379430616e-6          , 6.84306923156874848e-7          , },
+/* x = 2.0         */  {0.00462618802878018543          , 0.0043322304282833568           , 0.0020365977191630995           , 0.000640539499227361285         , 0.000151572495651977591         , 0.0000287751093436109531        , 4.56398645014577302e-6          , 6.21918539092775487e-7          , },
+/* x = 2.1         */  {0.00421270529764525501          , 0.00394353489745512026          , 0.00185324918546991655          , 0.000582698867928250579         , 0.000137848282164967512         , 0.0000261632567407661145        , 4.14880176235821444e-6          , 5.65228120154206235e-7          , },
+/* x = 2.2         */  {0.00383631512817511006          , 0.00358982746987380654          , 0.00168645489582378925          , 0.000530094845781307619         , 0.000125369654834205488         , 0.0000237889810502354477        , 3.7714595507831524e-6           , 5.13714424740271213e-7          , },
+/* x = 2.3         */  {0.00349367913809655414          , 0.00326794952921359847          , 0.00153471628257306661          , 0.000482252216942144752         , 0.000114023324652700528         , 0.0000216306299555318583        , 3.42850448301348276e-6          , 4.66903965098046399e-7          , },
+/* x = 2.4         */  {0.00318176028519251431          , 0.00297502835873759771          , 0.00139667075691702254          , 0.000438738983418304317         , 0.000103706326653391552         , 0.0000196685280165360827        , 3.1167972441879871e-6           , 4.24366626251582284e-7          , },
+/* x = 2.5         */  {0.00289779559492675356          , 0.00270845120173681446          , 0.00127107934368897109          , 0.000399162426969502177         , 0.0000943250773913726197        , 0.000017884795882019771         , 2.83348559092311756e-6          , 3.85711687381357695e-7          , },
+/* x = 2.6         */  {0.00263927136221814265          , 0.00246584168055092826          , 0.00115681544278352008          , 0.000363165530501493755         , 0.000085794518613907518         , 0.0000162631860604985853        , 2.57597806032019761e-6          , 3.50584208640129813e-7          , },
+/* x = 2.7         */  {0.00240390060242171797          , 0.00224503835929017184          , 0.00105285461438946751          , 0.000330423726082433045         , 0.0000780373392248423408        , 0.000014788933730702312         , 2.34192009019397247e-6          , 3.18661749799196904e-7          , },
+/* x = 2.8         */  {0.00218960254706552837          , 0.00204407525499008413          , 0.000958265294592408892         , 0.000300641939720842054         , 0.0000709832683739514564        , 0.0000134486212124259942        , 2.12917232909230288e-6          , 2.8965139021303317e-7           , },
+/* x = 2.9         */  {0.00199448399851389759          , 0.0018611641197502399           , 0.000872200356452686844         , 0.000273551905778494179         , 0.0000645684331591983394        , 0.0000122300548451780703        , 1.93579093503630601e-6          , 2.63287022399051914e-7          , },
+/* x = 3.0         */  {0.00181682237465016242          , 0.00169467833259856947          , 0.000793889439423832366         , 0.000248909726374990336         , 0.0000587347750269708026        , 0.000011122153137049065         , 1.76000968039565569e-6          , 2.39326894079209705e-7          , },
+/* x = 3.1         */  {0.00165505029005049953          , 0.00154313825453365781          , 0.000722631977025823986         , 0.000226493653396590561         , 0.0000534295194976101159        , 0.0000101148451506593387        , 1.60022369709775575e-6          , 2.17551375845157458e-7          , },
+/* x = 3.2         */  {0.00150774153409621888          , 0.00140519791356390746          , 0.000657790859091448888         , 0.000206102072770859441         , 0.0000486046943360344658        , 9.19897818787981664e-6          , 1.45497471160886256e-6          , 1.97760933710346351e-7          , },
+/* x = 3.3         */  {0.00137359831917305537          , 0.00127963289870770026          , 0.000598786670721932107         , 0.000187551672529872991         , 0.0000442166917345345607        , 8.36623392113889182e-6          , 1.32293763296226354e-6          , 1.79774287720578805e-7          , },
+/* x = 3.4         */  {0.00125143968364898125          , 0.00116532935295445612          , 0.000545092455373520942         , 0.000170675777875354663         , 0.0000402258704810472531        , 7.60905219733384501e-6          , 1.20290836967250016e-6          , 1.63426739526812724e-7          , },
+/* x = 3.5         */  {0.00114019094481268001          , 0.00106127396521427707          , 0.000496228954298656901         , 0.000155322837994812141         , 0.0000365961944551639296        , 6.92056181138429284e-6          , 1.09379276278262903e-6          , 1.48568653396787978e-7          , },
+/* x = 3.6         */  {0.00103887410648918249          , 0.000966544870395897425         , 0.000451760278928045074         , 0.000141355050772749414         , 0.0000332949041292291786        , 6.29451761095943397e-6          , 9.9459653265010002e-7           , 1.35064076569959211e-7          , },
+/* x = 3.7         */  {0.000946599134714586574         , 0.000880303375032698072         , 0.000411289976743583872         , 0.000128647112808239084         , 0.000030292218056241861         , 5.72524335248040544e-6          , 9.04416146482639056e-7          , 1.22789486156641844e-7          , },
+/* x = 3.8         */  {0.000862556022727598351         , 0.000801786433400677604         , 0.000374457454793297393         , 0.000117085083301280949         , 0.0000275610616027091353        , 5.20757978168880849e-6          , 8.22430522176289481e-7          , 1.11632650959330185e-7          , },
+/* x = 3.9         */  {0.000786007573693923507         , 0.000730299805909626573         , 0.000340934728271316769         , 0.000106565351416090863         , 0.0000250768204356884269        , 4.73683746037716197e-6          , 7.47893491763135202e-7          , 1.01491597662830486e-7          , },
+/* x = 4.0         */  {0.000716282836085790765         , 0.000665211837762114368         , 0.000310423464558738911         , 0.0000969936976794270646        , 0.0000228171165013112126        , 4.30875390474588846e-6          , 6.80126954818507668e-7          , 9.22736718101554597e-8          , },
+/* x = 4.1         */  {0.000652771132552606622         , 0.000605947801521313533         , 0.000282652295822239397         , 0.0000882844408350501599        , 0.0000207616044392301315        , 3.9194546406922783e-6           , 6.18514658572308344e-7          , 8.38946848621163085e-8          , },
+/* x = 4.2         */  {0.00059491662849398409          , 0.000551984752359972473         , 0.000257374375721507759         , 0.0000803596623594021412        , 0.000018891786565587276         , 3.56541781752001324e-6          , 5.62496547276051932e-7          , 7.62781394384537127e-8          , },
+/* x = 4.3         */  {0.000542213391432279421         , 0.000502846849426080132         , 0.000234365158006504236         , 0.0000731485015558213509        , 0.0000171908447280100017        , 3.24344205441948635e-6          , 5.11563628650455076e-7          , 6.93545255646413043e-8          , },
+/* x = 4.4         */  {0.00049420089672294268          , 0.000458101100998712188         , 0.000213420376811732124         , 0.0000665865147916616671        , 0.0000156434874913844173        , 2.9506172239146074e-6           , 4.65253310026978062e-7          , 6.30606814079556284e-8          , },
+/* x = 4.5         */  {0.000450459939177995457         , 0.000417353494959060397         , 0.000194354210295822633         , 0.000060615093030529044         , 0.0000142358112541735639        , 2.68429790357822261e-6          , 4.23145161145265768e-7          , 5.73392125851918954e-8          , },
+/* x = 4.6         */  {0.000410608913847642184         , 0.000380245479602022873         , 0.000176997610947674941         , 0.0000551809323459123909        , 0.0000129551740231427438        , 2.44207925193738974e-6          , 3.84857064517413865e-7          , 5.21379646681035968e-8          , },
+/* x = 4.7         */  {0.000374300432540885113         , 0.000346450762995041664         , 0.000161196787400566018         , 0.0000502355525876962456        , 0.0000117900806907141152        , 2.22177508685006406e-6          , 3.50041717856163334e-7          , 4.740954400632968e-8            , },
+/* x = 4.8         */  {0.00034121824569847362          , 0.000315672401982250064         , 0.000146811823977016845         , 0.0000457348598138753065        , 0.000010730078764873233         , 2.02139796494377818e-6          , 3.183834563208719e-7            , 4.31108824358511227e-8          , },
+/* x = 4.9         */  {0.00031107444198822479          , 0.000287640154559905872         , 0.000133715425442467603         , 0.0000416387485003105795        , 9.76566359756945191e-6          , 1.83914107915306137e-6          , 2.89595365292723374e-7          , 3.92028418480704731e-8          , },
+/* x = 5.0         */  {0.000283606900498828687         , 0.000262108071737587959         , 0.000121791775586505573         , 0.0000379107399052657549        , 8.88819224477799814e-6          , 1.6733618081467359e-6           , 2.63416657076623629e-7          , 3.56498549642289384e-8          , },
+/* x = 5.1         */  {0.000258576972686529637         , 0.000238852307170572736         , 0.000110935499286980866         , 0.0000345176532960939208        , 8.08980517063047938e-6          , 1.52256676665421209e-6          , 2.39610287366571118e-7          , 3.24195989955117513e-8          , },
+/* x = 5.2         */  {0.000235767373300301885         , 0.00021766912482203748          , 0.000101050718654352855         , 0.0000314293070458547888        , 7.36335508000500064e-6          , 1.38539821952255466e-6          , 2.17960789526657266e-7          , 2.94826991739721267e-8          , },
+/* x = 5.3         */  {0.000214980261394168761         , 0.000198373086707297443         , 0.0000920501947096789759        , 0.0000286182468805979245        , 6.70234222936202095e-6          , 1.26062173489151919e-6          , 1.98272306751837368e-7          , 2.68124594161671626e-8          , },
+/* x = 5.4         */  {0.000196035494247283338         , 0.000180795404402563164         , 0.000083854546827640869         , 0.0000260594988060610544        , 6.10085562502167728e-6          , 1.14711496327828893e-6          , 1.80366803999910355e-7          , 2.43846176327239035e-8          , },
+/* x = 5.5         */  {0.000178769038568867205         , 0.000164782439482595525         , 0.0000763915428830352899        , 0.0000237303444678870373        , 5.55351957205113534e-6          , 1.04385743972291681e-6          , 1.64082443245730268e-7          , 2.21771234252812717e-8          , },
+/* x = 5.6         */  {0.000163031524780243684         , 0.000150194339398670602         , 0.0000695954536817205474        , 0.0000216101169042319894        , 5.05544508596486122e-6          , 9.49921315555426056e-7          , 1.49272107115955807e-7          , 2.01699361195088813e-8          , },
+/* x = 5.7         */  {0.000148686931452863817         , 0.000136903796532739753         , 0.0000634064658409920441        , 0.0000196800148357037792        , 4.60218572398907735e-6          , 8.6446293489325976e-7           , 1.35802057331621296e-7          , 1.8344841271116284e-8           , },
+/* x = 5.8         */  {0.0001356113881510962           , 0.00012479491927675516          , 0.0000577701478151127515        , 0.0000179229338066455297        , 4.18969743311508333e-6          , 7.8671517874240463e-7           , 1.23550715629189792e-7          , 1.66852839526877139e-8          , },
+/* x = 5.9         */  {0.000123692085992258444         , 0.000113762204997979613         , 0.0000526369642441066621        , 0.0000163233126454170023        , 3.81430204893788598e-6          , 7.15980506628891643e-7          , 1.1240755596006493e-7           , 1.51762172843982799e-8          , },
+/* x = 6.0         */  {0.000112826286203563688         , 0.000103709605670936939         , 0.0000479618342423514347        , 0.0000148669938509395521        , 3.47265411268575263e-6          , 6.51624632094737616e-7          , 1.02272097794269407e-7          , 1.38039648126317849e-8          , },
+/* x = 6.1         */  {0.000102920417835115397         , 0.000094549677792869315         , 0.0000437037296419927686        , 0.0000135410966396401967        , 3.16171070420083184e-6          , 5.93070774212989112e-7          , 9.30529912856581677e-8          , 1.2556095468538937e-8           , },
+/* x = 6.2         */  {0.0000938892565877835269        , 0.0000862028089597679051        , 0.0000398253095683928353        , 0.0000123339015022222506        , 2.87870401621059234e-6          , 5.39794432564172375e-7          , 8.46671859022619952e-8          , 1.14213099548379781e-8          , },
+/* x = 6.3         */  {0.0000856551774419841733        , 0.0000785965141711564201        , 0.0000362925880540304714        , 0.0000112347452244622759        , 2.62111642028857714e-6          , 4.91318637920008649e-7          , 7.70391748939966717e-8          , 1.03893375147484464e-8          , },
+/* x = 6.4         */  {0.0000781474744346524329        , 0.0000716647955601246708        , 0.000033074631696501132         , 0.0000102339254214472561        , 2.38665779767162577e-6          , 4.47209635244104986e-7          , 7.01003086681474857e-8          , 9.45084213284418463e-9          , },
+/* x = 6.5         */  {0.0000713017415330332354        , 0.0000653475598163480246        , 0.0000301432846382541698        , 9.32261372119533481e-6          , 2.17324492878889711e-6          , 4.07072959583783533e-7          , 6.37881707772169428e-8          , 8.59733730470476953e-9          , },
+/* x = 6.6         */  {0.0000650593091007615637        , 0.0000595900880891847109        , 0.0000274729183929383131        , 8.49277681224168876e-6          , 1.97898275415612927e-6          , 3.70549869028874864e-7          , 5.8046010799779133e-8           , 7.82110859134425345e-9          , },
+/* x = 6.7         */  {0.0000593667309490100125        , 0.000054342553630138002         , 0.0000250402042679607793        , 7.73710464123901102e-6          , 1.80214733636955035e-6          , 3.37314102185420623e-7          , 5.28222289182513712e-8          , 7.11514324623701793e-9          , },
+/* x = 6.8         */  {0.0000541753174177462355        , 0.0000495595828632957863        , 0.000022823906337152553         , 7.04894511157458141e-6          , 1.6411703684548069e-6           , 3.07068930585004235e-7          , 4.80699074728164595e-8          , 6.47306626800960273e-9          , },
+/* x = 6.9         */  {0.0000494407103434543198        , 0.000045199855962716072         , 0.0000208046931031359332        , 6.42224469303802293e-6          , 1.49462508792991124e-6          , 2.79544479151281342e-7          , 4.37463852025061357e-8          , 5.88908229113020524e-9          , },
+/* x = 7.0         */  {0.000045122496143749399         , 0.0000412257433706581399        , 0.0000189649661578042388        , 5.85149440622616029e-6          , 1.36121346875715863e-6          , 2.54495290299123742e-7          , 3.9812870276682768e-8           , 5.35792278075404583e-9          , },
+/* x = 7.1         */  {0.0000411838535895327157        , 0.0000376029750132869963        , 0.0000172887043027866408        , 5.33168069413506044e-6          , 1.23975457500498789e-6          , 2.31698109471246369e-7          , 3.62340885764599956e-8          , 4.8747980467722947e-9           , },
+/* x = 7.2         */  {0.0000375912331447664593        , 0.0000343003392639315131        , 0.0000157613217312820692        , 4.8582407377105758e-6           , 1.12917397062382919e-6          , 2.10949871942805879e-7          , 3.29779640092784497e-8          , 4.43535363651816581e-9          , },
+/* x = 7.3         */  {0.000034314065035386372         , 0.0000312894089708154822        , 0.0000143695389994759465        , 4.42702181241296579e-6          , 1.0284940893572767e-6           , 1.92065872564906414e-7          , 3.00153279338920148e-8          , 4.03563070591782239e-9          , },
+/* x = 7.4         */  {0.0000313244934648538592        , 0.0000285442921088246486        , 0.0000131012656310570995        , 4.03424431946681088e-6          , 9.36825477549721821e-7          , 1.74878101790176642e-7          , 2.73196550401406642e-8          , 3.67203000550977271e-9          , },
+/* x = 7.5         */  {0.0000285971346266859757        , 0.000026041404835520241         , 0.0000119454933031791618        , 3.67646815874915985e-6          , 8.5335883055408284e-7           , 1.59233732842991073e-7          , 2.48668232705555884e-8          , 3.34127915103396137e-9          , },
+/* x = 7.6         */  {0.0000261088563760893171        , 0.0000237592649322589979        , 0.0000108921986575149418        , 3.35056214052077852e-6          , 7.77357750661325322e-7          , 1.44993746277485428e-7          , 2.26348955913024594e-8          , 3.04040287851907097e-9          , },
+/* x = 7.7         */  {0.000023838577615470053         , 0.0000216783037937477073        , 9.9322548667004122e-6           , 3.05367616070382516e-6          , 7.08152161033273892e-7          , 1.32031679420965612e-7          , 2.06039216202548252e-8          , 2.76669601125359819e-9          , },
+/* x = 7.8         */  {0.0000217670856238313718        , 0.0000197806952952979846        , 9.05735116524496005e-6          , 2.78321588940534546e-6          , 6.45132316081902053e-7          , 1.20232489340173564e-7          , 1.87557573019505772e-8          , 2.51769889096728724e-9          , },
+/* x = 7.9         */  {0.0000198768697194782564        , 0.000018050200017955322         , 8.25991962561227521e-6          , 2.53681974510780581e-6          , 5.87743354156482558e-7          , 1.0949151900363421e-7           , 1.707390098449931e-8            , 2.29117504820536054e-9          , },
+/* x = 8.0         */  {0.0000181519697904614199        , 0.0000164720234489196887        , 7.53306852530241455e-6          , 2.31233794760277956e-6          , 5.35480343324319213e-7          , 9.97135572544886806e-8          , 1.55433444037022355e-8          , 2.08509090745834067e-9          , },
+/* x = 8.1         */  {0.0000165778383591108983        , 0.0000150326868994933939        , 6.87052170998154713e-6          , 2.10781346152024513e-6          , 4.87883775506354682e-7          , 9.08119840634703429e-8          , 1.41504372161042789e-8          , 1.89759734130550625e-9          , },
+/* x = 8.2         */  {0.000015141214967020453         , 0.0000137199099963129647        , 6.26656341154912915e-6          , 1.9214646593749312e-6           , 4.44535468296726556e-7          , 8.27079933088600627e-8          , 1.288276384667815e-8            , 1.7270129048130775e-9           , },
+/* x = 8.3         */  {0.000013830011776024244         , 0.0000125225037048703634        , 5.71598802899128604e-6          , 1.75166954856830468e-6          , 4.0505483749254838e-7           , 7.53298860365038076e-8          , 1.17290315294852432e-8          , 1.57180859685611325e-9          , },
+/* x = 8.4         */  {0.0000126332093800371224        , 0.0000114302729382367123        , 5.21405442438799579e-6          , 1.59695142089150214e-6          , 3.69095506720642925e-7          , 6.86124277947739909e-8          , 1.06789685220060781e-8          , 1.4305940090484299e-9           , },
+/* x = 8.5         */  {0.0000115407619130004085        , 0.0000104339278893158416        , 4.75644432692383179e-6          , 1.45596579589920959e-6          , 3.36342223602379584e-7          , 6.24962642225967335e-8          , 9.72323156682638649e-9          , 1.30210473569713758e-9          , },
+/* x = 8.6         */  {0.0000105435106203964182        , 9.5250033026455043e-6           , 4.33922447456434668e-6          , 1.32748854118393924e-6          , 3.06508054674085892e-7          , 5.69273895987022252e-8          , 8.85332175886017095e-9          , 1.18519092976525486e-9          , },
+/* x = 8.7         */  {9.63310513660408039e-6          , 8.69578497243110583e-6          , 3.95881215653607163e-6          , 1.21040506318042039e-6          , 2.7933183380408276e-7           , 5.18566635419463719e-8          , 8.06150805306592174e-9          , 1.07880690033413671e-9          , },
+/* x = 8.8         */  {8.80193177843477733e-6          , 7.93924281777676428e-6          , 3.61194385019062924e-6          , 1.1037004717673292e-6           , 2.54575841141284165e-7          , 4.72393714903158229e-8          , 7.34075771737318856e-9          , 9.82001656604152111e-10         , },
+/* x = 8.9         */  {8.04304822712133855e-6          , 7.24896994455015306e-6          , 3.29564667351808733e-6          , 1.00645063069594583e-6          , 2.3202369171544915e-7           , 4.30348249840779568e-8          , 6.68467309892562493e-9          , 8.93910312145296058e-10         , },
+/* x = 9.0         */  {7.35012402738805108e-6          , 6.61912715650700757e-6          , 3.00721239975182543e-6          , 9.17814013842180852e-7          , 2.11478414704608264e-7          , 3.92059981401180473e-8          , 6.08743412934641777e-9          , 8.13746270989245881e-10         , },
+/* x = 9.1         */  {6.7173863835095206e-6           , 6.04439242668678265e-6          , 2.7441738034044686e-6           , 8.37024294522124e-7             , 1.92760706108201191e-7          , 3.5719197033129687e-8           , 5.54374604707222599e-9          , 7.40794124313463571e-10         , },
+/* x = 9.2         */  {6.1395707789295326e-6           , 5.51991488410767528e-6          , 2.50428312789878489e-6          , 7.63383601697615321e-7          , 1.75707339130771364e-7          , 3.25437589980007571e-8          , 5.04879186236341757e-9          , 6.74403192972323355e-10         , },
+/* x = 9.3         */  {5.61187598847451314e-6          , 5.04127291083255892e-6          , 2.28549248389694151e-6          , 6.96256382887099769e-7          , 1.60169718004946255e-7          , 2.96517791391997208e-8          , 4.59818913381849024e-9          , 6.13981657039871843e-10         , },
+/* x = 9.4         */  {5.12992309083885243e-6          , 4.60443598090690784e-6          , 2.08593600465716786e-6          , 6.35063819042536872e-7          , 1.46012562276864728e-7          , 2.70178615796997473e-8          , 4.18795066449604264e-9          , 5.58991218898171214e-10         , },
+/* x = 9.5         */  {4.68971812418600295e-6          , 4.20572990581250031e-6          , 1.90391360041412945e-6          , 5.79278741604780597e-7          , 1.33112709753986992e-7          , 2.46188932062379862e-8          , 3.81444876143913871e-9          , 5.0894225128370408e-10          , },
+/* x = 9.6         */  {4.28761805971347775e-6          , 3.84180518123390066e-6          , 1.7378761680294961e-6           , 5.28421006452507278e-7          , 1.21358027385053885e-7          , 2.24338378715447697e-8          , 3.47438273483196894e-9          , 4.63389386136965945e-10         , },
+/* x = 9.7         */  {3.92029979715687114e-6          , 3.50960815736879649e-6          , 1.58641212512076757e-6          , 4.82053283554250041e-7          , 1.10646420314588518e-7          , 2.04435491994557588e-8          , 3.16474934249496134e-9          , 4.21927504127952175e-10         , },
+/* x = 9.8         */  {3.58473191271723013e-6          , 3.20635477997406186e-6          , 1.44823514966620365e-6          , 4.39777224856480344e-7          , 1.00884930238604207e-7          , 1.86306003072319547e-8          , 2.88281591221229482e-9          , 3.84188088389834085e-10         , },
+/* x = 9.9         */  {3.27814891402349264e-6          , 2.92950667205050277e-6          , 1.32217301680788623e-6          , 4.01229976326669016e-7          , 9.19889149921406727e-8          , 1.69791289124962625e-8          , 2.6260958987307388e-9           , 3.49835909318388598e-10         , },
+/* x = 10.0        */  {2.99802777870192225e-6          , 2.67674934673392913e-6          , 1.2071574343300667e-6           , 3.66081003149500703e-7          , 8.38813020302048185e-8          , 1.54746964313486208e-8          , 2.39232665439402998e-9          , 3.18566010316286904e-10         , },
+/* x = 10.1        */  {2.7420665731127582e-6           , 2.44597236076338179e-6          , 1.10221478716380332e-6          , 3.34029199874758557e-7          , 7.64919091282854661e-8          , 1.41041598007145999e-8          , 2.17944921248532915e-9          , 2.90100967106945979e-10         , },
+/* x = 10.2        */  {2.50816496600827308e-6          , 2.23525123500717191e-6          , 1.00645770934128217e-6          , 3.048002598621583e-7            , 6.97568262328805915e-8          , 1.28555548729688715e-8          , 1.98558990062586278e-9          , 2.64188395737543277e-10         , },
+/* x = 10.3        */  {2.29440646842765791e-6          , 2.04283098409678239e-6          , 9.19077409166708496e-7          , 2.78144280684607079e-7          , 6.36178529419074896e-8          , 1.1717990335403712e-8           , 1.80904361818798275e-9          , 2.40598686657917699e-10         , },
+/* x = 10.4        */  {2.09904224621961507e-6          , 1.86711111138671447e-6          , 8.39336680051234851e-7          , 2.53833584257914603e-7          , 5.80219865944478779e-8          , 1.06815512021366488e-8          , 1.64825862677760892e-9          , 2.19122944322257446e-10         , },
+/* x = 10.5        */  {1.92047636530694522e-6          , 1.70663193835152544e-6          , 7.66563535537053156e-7          , 2.31660732380910918e-7          , 5.2920956403543645e-8           , 9.73721101243642412e-9          , 1.50182271656248615e-9          , 1.99571113632628434e-10         , },
+/* x = 10.6        */  {1.75725234230040883e-6          , 1.56006214926463657e-6          , 7.00145412565072725e-7          , 2.11436720112517181e-7          , 4.82707994788243399e-8          , 8.87675194797954174e-9          , 1.3684506236943946e-9           , 1.81770276244713881e-10         , },
+/* x = 10.7        */  {1.60804088444239543e-6          , 1.42618744268162873e-6          , 6.39523892071140445e-7          , 1.92989330997291266e-7          , 4.40314749613589597e-8          , 8.09269215294588083e-9          , 1.24697258540943345e-9          , 1.65563101302231211e-10         , },
+/* x = 10.8        */  {1.4716287132151288e-6           , 1.30390019096885712e-6          , 5.84189890572640345e-7          , 1.76161639592619206e-7          , 4.01665128346854897e-8          , 7.37821960577105918e-9          , 1.13632392969436272e-9          , 1.50806436571551804e-10         , },
+/* x = 10.9        */  {1.3469083753748817e-6           , 1.19219001796286841e-6          , 5.33679280571555724e-7          , 1.60810648062037911e-7          , 3.66426942865755095e-8          , 6.72713195038598492e-9          , 1.03553560577287955e-9          , 1.37370027224959342e-10         , },
+/* x = 11.0        */  {1.23286895375631469e-6          , 1.09013521289603298e-6          , 4.87568901388988519e-7          , 1.46806044791965842e-7          , 3.34297607785499009e-8          , 6.13378174842706179e-9          , 9.43725570179165374e-10         , 1.25135350681451108e-10         , },
+/* x = 11.1        */  {1.1285875980054261e-6           , 9.96894906050632126e-7          , 4.45472925493628298e-7          , 1.3402907407412512e-7           , 3.05001492370312503e-8          , 5.59302666268157746e-9          , 8.60090950924794274e-10         , 1.13994556968649958e-10         , },
+/* x = 11.2        */  {1.03322180251470509e-6          , 9.11701938272514038e-7          , 4.07039548523594597e-7          , 1.22371506882924456e-7          , 2.78287510136223386e-8          , 5.1001841263852038e-9           , 7.83900919299770477e-10         , 1.03849505027916047e-10         , },
+/* x = 11.3        */  {9.46002365312702495e-7          , 8.33856362545617337e-7          , 3.7194797405549505e-7           , 1.11734703674914478e-7          , 2.53926924744501426e-8          , 4.65099009331515847e-9          , 7.14490205243239134e-10         , 9.46108862559060035e-11         , },
+/* x = 11.4        */  {8.66226967559505455e-7          , 7.62719521354067385e-7          , 3.39905666771960852e-7          , 1.02028760954197072e-7          , 2.31711352717309414e-8          , 4.24156150028958432e-9          , 6.51253198032609127e-10         , 8.61974273675994856e-11         , },
+/* x = 11.5        */  {7.93254318671509047e-7          , 6.9770864858822121e-7           , 3.10645850042544166e-7          , 9.31717340907069386e-8          , 2.11450945264396973e-8          , 3.86836210702389544e-9          , 5.93638579324431747e-10         , 7.85351653854458063e-11         , },
+/* x = 11.6        */  {7.26498816990728727e-7          , 6.38291949329587652e-7          , 2.83925226083792098e-7          , 8.50889295542600632e-8          , 1.92972733107924574e-8          , 3.52817140861069097e-9          , 5.41144440384551659e-10         , 7.15567882133608656e-11         , },
+/* x = 11.7        */  {6.65425680368741738e-7          , 5.83984115017568901e-7          , 2.59521898821742445e-7          , 7.77122603422476912e-8          , 1.76119119646164435e-8          , 3.21805634345627325e-9          , 4.93313839712547773e-10         , 6.52010348488093777e-11         , },
+/* x = 11.8        */  {6.09546505092361802e-7          , 5.34342235295384581e-7          , 2.37233481361474513e-7          , 7.09796589383633516e-8          , 1.60746509119000016e-8          , 2.93534554457370702e-9          , 4.49730761236079617e-10         , 5.94121498265748271e-11         , },
+/* x = 11.9        */  {5.58415215272993341e-7          , 4.88962071286945683e-7          , 2.16875371589571973e-7          , 6.48345426488014914e-8          , 1.46724057640757633e-8          , 2.67760590492684806e-9          , 4.10016436860589577e-10         , 5.41393869789885061e-11         , },
+/* x = 12.0        */  {5.11624368186727782e-7          , 4.47474658201408627e-7          , 1.98279180910856087e-7          , 5.92253266255218105e-8          , 1.33932536059789825e-8          , 2.44262124824830173e-9          , 3.73826000441726108e-10         , 4.93365580438468597e-11         , },
+/* x = 12.1        */  {4.68801784117167108e-7          , 4.09543208025469846e-7          , 1.8129130246366323e-7           , 5.41049803075821953e-8          , 1.22263294599243964e-8          , 2.22837291560449785e-9          , 3.40845443231695628e-10         , 4.49616220570706584e-11         , },
+/* x = 12.2        */  {4.2960747204456693e-7           , 3.74860285670461655e-7          , 1.65771606380219541e-7          , 4.94306233949781535e-8          , 1.11617320138549242e-8          , 2.03302209512356593e-9          , 3.10788843563647306e-10         , 4.09763118360552335e-11         , },
+/* x = 12.3        */  {3.93730825067646671e-7          , 3.43145234315004283e-7          , 1.51592250771177137e-7          , 4.51631578183189255e-8          , 1.01904377818485667e-8          , 1.85489373789151589e-9          , 2.83395846004798285e-10         , 3.73457941949947546e-11         , },
+/* x = 12.4        */  {3.60888061760584622e-7          , 3.14141827845305778e-7          , 1.38636598126007923e-7          , 4.12669324851403027e-8          , 9.3042229401665349e-9           , 1.69246191720032295e-9          , 2.58429367451722511e-10         , 3.40383608382944518e-11         , },
+/* x = 12.5        */  {3.30819891777568402e-7          , 2.87616130263243451e-7          , 1.26798227742696996e-7          , 3.77094378725393778e-8          , 8.49559215015923904e-9          , 1.54433650122600674e-9          , 2.35673509680417988e-10         , 3.10251471552926335e-11         , },
+/* x = 12.6        */  {3.03289385939255056e-7          , 2.63354543724453715e-7          , 1.15980035639220175e-7          , 3.44610277986978158e-8          , 7.75771374132953983e-9          , 1.4092510209421574e-9           , 2.14931659717942514e-10         , 2.82798763914253768e-11         , },
+/* x = 12.7        */  {2.78080032786403191e-7          , 2.41162028500586028e-7          , 1.06093414163072653e-7          , 3.14946659450850136e-8          , 7.08436068424126141e-9          , 1.28605162574047933e-9          , 1.96024761088388733e-10         , 2.5778626899976368e-11          , },
+/* x = 12.8        */  {2.54993965181058823e-7          , 2.20860479646005483e-7          , 9.70575042104099828e-8          , 2.87856949188355334e-8          , 6.46985683426157882e-9          , 1.17368702893105233e-9          , 1.78789740519044555e-10         , 2.34996203867485336e-11         , },
+/* x = 12.9        */  {2.33850341988923359e-7          , 2.02287246502629259e-7          , 8.87985135993292267e-8          , 2.63116258429181318e-8          , 5.90902797379878372e-9          , 1.07119935411865866e-9          , 1.6307807608665174e-10          , 2.14230292492684909e-11         , },
+/* x = 13.0        */  {2.14483871200574935e-7          , 1.85293782409150713e-7          , 8.1249095718061935e-8           , 2.40519466420226209e-8          , 5.39715722316063937e-9          , 9.77715801477248338e-10         , 1.48754494051364695e-10         , 1.95308012842121627e-11         , },
+/* x = 13.1        */  {1.96743462055586515e-7          , 1.69744413103468174e-7          , 7.43477830934713213e-8          , 2.19879473561920415e-8          , 4.92994442879365277e-9          , 8.92441060244740927e-10         , 1.35695782778804831e-10         , 1.78065001931857178e-11         , },
+/* x = 13.2        */  {1.80490994832785987e-7          , 1.55515213329546621e-7          , 6.80384710028830491e-8          , 2.01025609635823162e-8          , 4.50346917281621722e-9          , 8.1465040040064741e-10          , 1.23789713198939072e-10         , 1.62351604592330987e-11         , },
+/* x = 13.3        */  {1.656001979714946e-7            , 1.42492982091167466e-7          , 6.22699466871540253e-8          , 1.83802183296687387e-8          , 4.11415707974344874e-9          , 7.43683382529225057e-10         , 1.12934056203870829e-10         , 1.48031552957628273e-11         , },
+/* x = 13.4        */  {1.51955623101264522e-7          , 1.30574307843226851e-7          , 5.69954601188375031e-8          , 1.68067160239472986e-8          , 3.75874912540487912e-9          , 6.78938130365407786e-10         , 1.03035688253640887e-10         , 1.34980764871676967e-11         , },
+/* x = 13.5        */  {1.39451709389338791e-7          , 1.19664715683855398e-7          , 5.21723326398306401e-8          , 1.53690958577986605e-8          , 3.434273679538275e-9            , 6.19866115519005628e-10         , 9.40097772476329566e-11         , 1.23086250473193962e-11         , },
+/* x = 13.6        */  {1.27991929372993517e-7          , 1.09677889314414452e-7          , 4.77616001111726632e-8          , 1.40555350996940204e-8          , 3.13802103764045314e-9          , 5.65967408419575041e-10         , 8.57790414362895351e-11         , 1.12245117193267681e-11         , },
+/* x = 13.7        */  {1.17488009134663176e-7          , 1.00534961175530709e-7          , 4.37276875165918144e-8          , 1.28552464172351027e-8          , 2.86752021958435319e-9          , 5.16786353660784722e-10         , 7.82730748000459137e-11         , 1.02363664283335088e-11         , },
+/* x = 13.8        */  {1.07859216307278316e-7          , 9.21638647513657068e-8          , 4.0038112233610667e-8           , 1.17583866804631548e-8          , 2.62051783246661732e-9          , 4.71907631686189773e-10         , 7.14277329155720767e-11         , 9.335655879500549e-12           , },
+/* x = 13.9        */  {9.90317099710091219e-8          , 8.4498743566379266e-8           , 3.6663213433908577e-8           , 1.07559738381971059e-8          , 2.39495881330960036e-9          , 4.30952672181861309e-10         , 6.51845738689272046e-11         , 8.51460856639890944e-12         , },
+/* x = 14.0        */  {9.09379470255695017e-8          , 7.74794118835794882e-8          , 3.35759053003877537e-8          , 9.83981114955432075e-9          , 2.1889688837680702e-9           , 3.9357638765601583e-10          , 5.9490349265946121e-11          , 7.76614652149295944e-12         , },
+/* x = 14.1        */  {8.35161400989129496e-8          , 7.10508625548832014e-8          , 3.07514519539803367e-8          , 9.002418116891985e-9            , 2.0008385640311812e-9           , 3.59464198519580745e-10         , 5.42965408365157401e-11         , 7.08382320082382727e-12         , },
+/* x = 14.2        */  {7.67097624876581751e-8          , 6.51628178765875354e-8          , 2.81672621704741191e-8          , 8.23696752475029952e-9          , 1.82900860679861548e-9          , 3.28329323559918974e-10         , 4.95589385353847873e-11         , 6.46176694995552017e-12         , },
+/* x = 14.3        */  {7.04670960206669649e-8          , 5.97693196695789056e-8          , 2.58027021381679818e-8          , 7.53722804249637245e-9          , 1.67205672466797496e-9          , 2.99910312045814167e-10         , 4.52372564114388094e-11         , 5.89462954821958795e-12         , },
+/* x = 14.4        */  {6.47408180982720955e-8          , 5.48283551379694217e-8          , 2.36389246624907978e-8          , 6.89751189672950946e-9          , 1.5286854956094407e-9           , 2.73968795836293356e-10         , 4.1294782853289637e-11          , 5.37753937374010992e-12         , },
+/* x = 14.5        */  {5.94876244888280703e-8          , 5.03015153642564912e-8          , 2.16587133651911916e-8          , 6.31262716354172474e-9          , 1.39771134152424643e-9          , 2.50287441808037474e-10         , 3.76980621245969966e-11         , 4.90605877305045575e-12         , },
+/* x = 14.6        */  {5.46678847643635505e-8          , 4.61536835764930802e-8          , 1.98463405545694963e-8          , 5.77783427082045379e-9          , 1.27805448427737866e-9          , 2.28668086683373681e-10         , 3.44166043805084176e-11         , 4.47614525670032552e-12         , },
+/* x = 14.7        */  {5.02453275307307454e-8          , 4.23527505757410787e-8          , 1.8187437560605627e-8           , 5.28880633728735551e-9          , 1.16872979214557016e-9          , 2.08930037948955258e-10         , 3.14226216094710055e-11         , 4.08411617643568252e-12         , },
+/* x = 14.8        */  {4.6186752857123082e-8           , 3.88693549424505209e-8          , 1.66688764357642221e-8          , 4.84159300820960668e-9          , 1.06883843740501362e-9          , 1.90908526018583085e-10         , 2.86907871747073214e-11         , 3.72661657062413481e-12         , },
+/* x = 14.9        */  {4.2461769537308291e-8           , 3.56766458503590534e-8          , 1.52786620196659909e-8          , 4.43258747799110468e-9          , 9.77560292868351067e-10         , 1.74453294125275067e-10         , 2.6198016838923636e-11          , 3.40058989287480022e-12         , },
+/* x = 15.0        */  {3.90425550223492089e-8          , 3.27500665078566036e-8          , 1.40058334545525889e-8          , 4.05849641741703218e-9          , 8.94147001630221864e-10         , 1.59427313639531257e-10         , 2.39232693462109027e-11         , 3.10325136451989061e-12         , },
+/* x = 15.1        */  {3.59036360537351406e-8          , 3.00671564211648679e-8          , 1.28403743193160555e-8          , 3.71631254842884921e-9          , 8.17915660152138641e-10         , 1.45705613613582725e-10         , 2.18473648083152241e-11         , 2.83206371501716489e-12         , },
+/* x = 15.2        */  {3.30216881983406265e-8          , 2.76073708326473249e-8          , 1.17731306235179996e-8          , 3.40328963216869502e-9          , 7.48243060162709206e-10         , 1.33174214355083295e-10         , 1.9952819300048785e-11          , 2.58471509560893535e-12         , },
+/* x = 15.3        */  {3.03753526439400477e-8          , 2.53519158324656997e-8          , 1.07957359699302014e-8          , 3.11691965685328834e-9          , 6.84560439715547803e-10         , 1.21729155747148114e-10         , 1.82236942119967821e-11         , 2.35909897092621496e-12         , },
+/* x = 15.4        */  {2.79450687574787902e-8          , 2.32835977738833548e-8          , 9.90054325527150432e-9          , 2.85491203100053338e-9          , 6.26348698177667832e-10         , 1.11275611862995778e-10         , 1.66454590391353475e-11         , 2.15329581083019292e-12         , },
+/* x = 15.5        */  {2.57129210391584292e-8          , 2.13866857429235593e-8          , 9.08056233452785083e-9          , 2.61517460480356525e-9          , 5.73134033954887695e-10         , 1.01727084180110664e-10         , 1.52048664026780107e-11         , 1.96555642079601718e-12         , },
+/* x = 15.6        */  {2.36624992247496306e-8          , 1.96467859428580626e-8          , 8.32940312500746693e-9          , 2.3957963581783456e-9           , 5.24483967433449006e-10         , 9.3004666387539414e-11          , 1.38898382104761895e-11         , 1.79428676370995042e-12         , },
+/* x = 15.7        */  {2.17787703974182332e-8          , 1.80507269540734209e-8          , 7.6412236725425709e-9           , 2.19503160833998922e-9          , 4.8000371496106847e-10          , 8.50363744067927538e-11         , 1.26893619595786594e-11         , 1.63803413920137174e-12         , },
+/* x = 15.8        */  {2.00479620696631335e-8          , 1.65864549210994844e-8          , 7.0106827444041496e-9           , 2.01128560281522876e-9          , 4.39332882735527203e-10         , 7.77565358174100921e-11         , 1.15933962739845454e-11         , 1.49547459868494809e-12         , },
+/* x = 15.9        */  {1.84574552865628599e-8          , 1.52429378017700431e-8          , 6.43289655191296385e-9          , 1.84310137568801006e-9          , 4.02142452241492854e-10         , 7.11052333976263003e-11         , 1.05927848520031754e-11         , 1.36540148525391756e-12         , },
+/* x = 16.0        */  {1.6995686884179969e-8           , 1.40100778893337457e-8          , 5.90339924074096851e-9          , 1.68914775570610706e-9          , 3.68132031401002522e-10         , 6.50277979633665019e-11         , 9.67917807168889043e-12         , 1.24671499754130044e-12         , },
+/* x = 16.1        */  {1.56520601123793674e-8          , 1.28786318874943825e-8          , 5.41810681880595309e-9          , 1.54820842474348095e-9          , 3.37027347902140959e-10         , 5.94743461191787513e-11         , 8.84496157021059127e-12         , 1.13841268574154064e-12         , },
+/* x = 16.2        */  {1.44168629001169743e-8          , 1.18401378814258911e-8          , 4.97328422074452019e-9          , 1.4191719341020227e-9           , 3.08577963264161564e-10         , 5.43993589265107248e-11         , 8.08319117434559583e-12         , 1.03958079624201465e-12         , },
+/* x = 16.3        */  {1.32811931040308665e-8          , 1.08868486053187368e-8          , 4.56551523445595109e-9          , 1.30102259432572906e-9          , 2.82555188104029683e-10         , 4.9761297851415499e-11          , 7.38753361510208754e-12         , 9.49386388826077638e-13         , },
+/* x = 16.4        */  {1.22368901384487193e-8          , 1.00116704594623554e-8          , 4.19167503937103592e-9          , 1.1928321616616574e-9           , 2.58750180805875699e-10         , 4.55222546784906519e-11         , 6.75221251027139575e-12         , 8.6707015724418518e-13          , },
+/* x = 16.5        */  {1.12764724371965446e-8          , 9.20810777770112949e-9          , 3.84890512812410356e-9          , 1.09375225110017659e-9          , 2.36972213376379578e-10         , 4.16476323734870724e-11         , 6.17195914494295438e-12         , 7.91939890168368352e-13         , },
+/* x = 16.6        */  {1.03930802452952394e-8          , 8.47021188972708388e-9          , 3.53459040338319608e-9          , 1.00300741212124896e-9          , 2.17047089709548871e-10         , 3.81058541461828246e-11         , 5.64196762209252253e-12         , 7.23364515203636053e-13         , },
+/* x = 16.7        */  {9.58042328216511287e-9          , 7.79253456246305657e-9          , 3.24633825989557402e-9          , 9.19888808917613983e-10         , 1.98815702796331134e-10         , 3.48680982101814372e-11         , 5.15785399365242766e-12         , 6.60768673778371952e-13         , },
+/* x = 16.8        */  {8.83273285769065981e-9          , 7.17008544108442061e-9          , 2.9819594784910637e-9           , 8.4374845200884659e-10          , 1.82132718609517437e-10         , 3.19080559594270627e-11         , 4.71561901733169652e-12         , 6.03627779420538822e-13         , },
+/* x = 16.9        */  {8.14471805876235249e-9          , 6.59829314333430719e-9          , 2.73945077399767311e-9          , 7.73993932846990931e-10         , 1.66865375482911524e-10         , 2.92017114844001209e-11         , 4.31161421618370211e-12         , 5.5146351618938374e-13          , },
+/* x = 17.0        */  {7.51152565701356939e-9          , 6.07296969098812127e-9          , 2.51697885289312615e-9          , 7.1008361728548857e-10          , 1.52892388795285121e-10         , 2.67271405359580619e-11         , 3.94251094680114104e-12         , 5.03839737911445514e-13         , },
+/* x = 17.1        */  {6.9287034186865671e-9           , 5.59027798987439202e-9          , 2.31286584916156746e-9          , 6.51522257675455579e-10         , 1.4010295167288511e-10          , 2.44643272132471836e-11         , 3.6052722083090871e-12          , 4.60358732399644453e-13         , },
+/* x = 17.2        */  {6.39216652514471357e-9          , 5.14670209499437006e-9          , 2.12557601835514149e-9          , 5.97856986900732811e-10         , 1.2839582324709576e-10          , 2.23949968055167177e-11         , 3.29712694825973212e-12         , 4.20657818046592971e-13         , },
+/* x = 17.3        */  {5.89816683772981437e-9          , 4.73902002021526884e-9          , 1.95370358037426065e-9          , 5.48673660896241406e-10         , 1.17678496753474129e-10         , 2.05024633573658407e-11         , 3.0155466433193708e-12          , 3.844062431066614e-13           , },
+/* x = 17.4        */  {5.44326476365371019e-9          , 4.36427887293577332e-9          , 1.7959616110681687e-9           , 5.03593519140981605e-10         , 1.07866440441310071e-10         , 1.87714906541766247e-11         , 2.75822395247221659e-12         , 3.5130236064183254e-13          , },
+/* x = 17.5        */  {5.02430350060429621e-9          , 4.01977211321434163e-9          , 1.6511718915008877e-9           , 4.62270135302980341e-10         , 9.88824048850685498e-11         , 1.71881654403494369e-11         , 2.52305325852235224e-12         , 3.21071054527689311e-13         , },
+/* x = 17.6        */  {4.6383854569127056e-9           , 3.70301875427217888e-9          , 1.51825563170152944e-9          , 4.24386632661811508e-10         , 9.06557908559721883e-11         , 1.57397817884796508e-11         , 2.30811293011428385e-12         , 2.93461394119567374e-13         , },
+/* x = 17.7        */  {4.28285066163020212e-9          , 3.41174433718057066e-9          , 1.39622499299033198e-9          , 3.89653141166102155e-10         , 8.31220724285115766e-11         , 1.44147356337219686e-11         , 2.11164915145954524e-12         , 2.68244497184584326e-13         , },
+/* x = 17.8        */  {3.95525699484589163e-9          , 3.14386352705053091e-9          , 1.28417533960467778e-9          , 3.57804475017933672e-10         , 7.62222704673232157e-11         , 1.32024285751241855e-11         , 1.93206118058385119e-12         , 2.4521158253077211e-13          , },
+/* x = 17.9        */  {3.65336208317244072e-9          , 2.89746419128360253e-9          , 1.18127815639928095e-9          , 3.28598011530769167e-10         , 6.99024720687411685e-11         , 1.20931801254431417e-11         , 1.76788790931676902e-12         , 2.24172195426120329e-13         , },
+/* x = 18.0        */  {3.37510671865766759e-9          , 2.67079283252751116e-9          , 1.08677457491319809e-9          , 3.01811753698444584e-10         , 6.41133919221335696e-11         , 1.10781476635802787e-11         , 1.61779560954327198e-12         , 2.04952590412750131e-13         , },
+/* x = 18.1        */  {3.1185996715555932e-9           , 2.46224126001074138e-9          , 9.99969455130251532e-10         , 2.7724256045438709e-10          , 5.88099719122707662e-11         , 1.01492534099283371e-11         , 1.48056676052349916e-12         , 1.87394257498112533e-13         , },
+/* x = 18.2        */  {2.88210377851205928e-9          , 2.27033439299854329e-9          , 9.20225974851621362e-10         , 2.54704530005810442e-10         , 5.39510156085264003e-11         , 9.29911780518292072e-12         , 1.35508986145424644e-12         , 1.71352578958260316e-13         , },
+/* x = 18.3        */  {2.66402319787924245e-9          , 2.09371909930378109e-9          , 8.46960682788739413e-10         , 2.34027522909244551e-10         , 4.94988545824984197e-11         , 8.52099872806963386e-12         , 1.24035014197566399e-12         , 1.56695605128994819e-13         , },
+/* x = 18.4        */  {2.46289173315416738e-9          , 1.93115398017635598e-9          , 7.79638975306723319e-10         , 2.15055812722372747e-10         , 4.54190437652146734e-11         , 7.80873603744873537e-12         , 1.13542109109442374e-12         , 1.43302938599150847e-13         , },
+/* x = 18.5        */  {2.27736213401514197e-9          , 1.78150002055484027e-9          , 7.17770960235794792e-10         , 1.97646853132784774e-10         , 4.16800833007894619e-11         , 7.15670096982122423e-12         , 1.03945673206857816e-12         , 1.31064717165654962e-13         , },
+/* x = 18.6        */  {2.10619629217669849e-9          , 1.6437120306574309e-9           , 6.60907674349938989e-10         , 1.81670151436025379e-10         , 3.82531645773469064e-11         , 6.55974996477032601e-12         , 9.51684577241646564e-13         , 1.19880686770645204e-13         , },
+/* x = 18.7        */  {1.94825625636180563e-9          , 1.51683081127471796e-9          , 6.08637624015374259e-10         , 1.67006239121535477e-10         , 3.51119383201583862e-11         , 6.01318252869222771e-12         , 8.71399202680732355e-13         , 1.09659356424489613e-13         , },
+/* x = 18.8        */  {1.80249599715792694e-9          , 1.39997598095727651e-9          , 5.605836211607272e-10           , 1.53545731133314807e-10         , 3.22323028180160379e-11         , 5.51270278162894261e-12         , 7.97956387817204181e-13         , 1.00317227831916071e-13         , },
+/* x = 18.9        */  {1.6679538584339624e-9           , 1.29233940861525739e-9          , 5.16399889138491781e-10         , 1.41188466109278492e-10         , 2.95922105234867032e-11         , 5.05438436341421652e-12         , 7.30767770155545538e-13         , 9.17780930879716005e-14         , },
+/* x = 19.0        */  {1.54374563739661198e-9          , 1.19317919990923494e-9          , 4.75769415253762571e-10         , 1.29842720575619135e-10         , 2.71714914223219408e-11         , 4.63463840395340399e-12         , 6.69295969549060565e-13         , 8.39723944019021239e-14         , },
+/* x = 19.1        */  {1.42905824030139975e-9          , 1.10181419025193451e-9          , 4.38401528749939976e-10         , 1.19424490685747228e-10         , 2.49516917082706781e-11         , 4.25018428852880751e-12         , 6.13050140579055889e-13         , 7.68366403455036004e-14         , },
+/* x = 19.2        */  {1.32314386534579879e-9          , 1.01761890129593331e-9          , 4.04029684879038342e-10         , 1.09856835652783491e-10         , 2.29159264280640364e-11         , 3.89802297277940338e-12         , 5.61581915252249727e-13         , 7.03128736127922979e-14         , },
+/* x = 19.3        */  {1.22531466839638394e-9          , 9.4001892148659181e-10          , 3.72409437361819783e-10         , 1.01069277534872356e-10         , 2.10487448785210549e-11         , 3.57541262365425127e-12         , 5.1448170158166776e-13          , 6.43481857242978928e-14         , },
+/* x = 19.4        */  {1.13493787097228715e-9          , 8.68486674642968529e-10         , 3.43316583074298988e-10         , 9.29972524981092271e-11         , 1.93360076445653588e-11         , 3.27984638236984879e-12         , 4.71375306668460865e-13         , 5.88942745158312621e-14         , },
+/* x = 19.5        */  {1.05143127335408622e-9          , 8.02537543620250615e-10         , 3.1654546419504744e-10          , 8.5581609106574527e-11          , 1.77647742643625727e-11         , 3.00903206338412401e-12         , 4.31920855682585778e-13         , 5.39070406217984737e-14         , },
+/* x = 19.6        */  {9.74259138838600019e-10         , 7.41726318930795665e-10         , 2.91907414323867828e-10         , 7.87681495764439145e-11         , 1.6323200596621243e-11          , 2.76087361978926287e-12         , 3.95805980673398025e-13         , 4.93462195002808422e-14         , },
+/* x = 19.7        */  {9.02928418041431476e-10         , 6.85643944780491567e-10         , 2.69229336247478856e-10         , 7.25072102846766682e-11         , 1.50004450461066723e-11         , 2.5334542204638525e-12          , 3.62745255449013251e-13         , 4.51750458541422847e-14         , },
+/* x = 19.8        */  {8.36985284783811946e-10         , 6.3391453733402814e-10          , 2.48352400091574559e-10         , 6.67532781453629525e-11         , 1.37865828772902473e-11         , 2.32502079794093508e-12         , 3.32477854865914182e-13         , 4.13599475820573776e-14         , },
+/* x = 19.9        */  {7.7601195750964627e-10          , 5.86192652176205005e-10         , 2.29130851569871953e-10         , 6.1464639761160623e-11          , 1.26725279134277827e-11         , 2.13396993836004407e-12         , 3.04765418786029441e-13         , 3.78702666480317568e-14         , },
+/* x = 20.0        */  {7.19623782382074977e-10         , 5.42160779904247911e-10         , 2.11430920927626488e-10         , 5.66030605258575095e-11         , 1.16499609798042702e-11         , 1.95883499618517585e-12         , 2.79390102704060748e-13         , 3.46780044899454881e-14         , },
+/* x = 20.1        */  {6.67466556224108694e-10         , 5.01527050584398437e-10         , 1.9512982398695492e-10          , 5.21334910992201258e-11         , 1.07112645059232377e-11         , 1.7982743266844312e-12          , 2.56152798638367029e-13         , 3.17575897989236457e-14         , },
+/* x = 20.2        */  {6.19214069311158108e-10         , 4.64023129449497199e-10         , 1.80114847440889495e-10         , 4.8023798898998729e-11          , 9.8494627525342119e-12          , 1.65106053856954079e-12         , 2.34871511328049359e-13         , 2.90856666937778392e-14         , },
+/* x = 20.3        */  {5.74565849709382721e-10         , 4.29402287716330544e-10         , 1.66282511218533982e-10         , 4.42445224591334357e-11         , 9.05816717601664022e-12         , 1.51607067776555096e-12         , 2.15379876099604311e-13         , 2.66409014900528284e-14         , },
+/* x = 20.4        */  {5.33245092396231421e-10         , 3.97437633774414169e-10         , 1.53537801360599965e-10         , 4.07686466895623309e-11         , 8.33152648516957377e-12         , 1.39227726109626671e-12         , 1.97525805970084335e-13         , 2.44038064228874575e-14         , },
+/* x = 20.5        */  {4.94996757810694253e-10         , 3.67920491252833359e-10         , 1.41793467408078353e-10         , 3.75713972431343719e-11         , 7.66418098425477681e-12         , 1.27874008579673938e-12         , 1.81170256650556659e-13         , 2.23565788283550771e-14         , },
+/* x = 20.6        */  {4.59585825771904966e-10         , 3.40658911618961887e-10         , 1.30969378821505241e-10         , 3.46300523504035344e-11         , 7.05122083153599605e-12         , 1.17459874726128357e-12         , 1.66186099113288466e-13         , 2.04829544204563114e-14         , },
+/* x = 20.7        */  {4.26795691886129091e-10         , 3.15476310011662913e-10         , 1.20991935418463605e-10         , 3.19237706248264548e-11         , 6.48814787484900865e-12         , 1.07906580335990521e-12         , 1.52457090297158329e-13         , 1.87680734216534124e-14         , },
+/* x = 20.8        */  {3.96426694643252646e-10         , 2.92210213970446184e-10         , 1.11793527246500486e-10         , 2.94334334702895027e-11         , 5.97084075519928645e-12         , 9.91420529058357735e-13         , 1.39876933356181553e-13         , 1.71983584148137318e-14         , },
+/* x = 20.9        */  {3.68294762393248654e-10         , 2.70711115598786073e-10         , 1.03312039701071349e-10         , 2.71415008410340195e-11         , 5.49552299626596175e-12         , 9.11003210003540393e-13         , 1.28348419612916025e-13         , 1.57614028846288612e-14         , },
+/* x = 21.0        */  {3.42230170298596546e-10         , 2.50841418501487984e-10         , 9.54904000566772473e-11         , 2.50318792119163715e-11         , 5.05873382221948439e-12         , 8.37209928228726581e-13         , 1.17782645068420585e-13         , 1.44458695078686521e-14         , },
+/* x = 21.1        */  {3.18076398187439178e-10         , 2.32474471569103029e-10         , 8.8276161906981765e-11          , 2.30898007154316966e-11         , 4.65730146864304102e-12         , 7.69487797230530672e-13         , 1.08098294949321788e-13         , 1.3241397335010348e-14          , },
+/* x = 21.2        */  {2.9568908099094057e-10          , 2.15493682352846152e-10         , 8.16211243090713838e-11         , 2.13017124918668256e-11         , 4.28831877177326573e-12         , 7.07330607406551002e-13         , 9.92209903458281314e-14         , 1.21385170815760214e-14         , },
+/* x = 21.3        */  {2.74935044142846104e-10         , 1.99791703386671151e-10         , 7.54809827006075105e-11         , 1.96551753810767816e-11         , 3.94912083991611551e-12         , 6.50274846251120357e-13         , 9.10826915171508427e-14         , 1.11285738165751775e-14         , },
+/* x = 21.4        */  {2.55691416955121311e-10         , 1.85269685374028286e-10         , 6.98150089086495023e-11         , 1.81387711593826735e-11         , 3.63726462790591217e-12         , 5.97896060815581184e-13         , 8.36211529172444929e-14         , 1.0203656398383627e-14          , },
+/* x = 21.5        */  {2.37844817565759518e-10         , 1.71836591669879824e-10         , 6.45857577974483971e-11         , 1.67420175935889524e-11         , 3.35051025100250307e-12         , 5.49805532775432432e-13         , 7.6779425428165364e-14          , 9.35653306574070744e-15         , },
+/* x = 21.6        */  {2.21290603587976008e-10         , 1.59408568957888722e-10         , 5.97587983113852988e-11         , 1.54552906466824716e-11         , 3.08680388879367562e-12         , 5.05647239033673098e-13         , 7.05054016843922877e-14         , 8.5805926438119794e-15          , },
+/* x = 21.7        */  {2.05932183078227329e-10         , 1.47908369452082175e-10         , 5.53024668601583031e-11         , 1.42697532269223464e-11         , 2.84426214260627267e-12         , 4.65095073149661459e-13         , 6.47514007325626502e-14         , 7.86979087289652565e-15         , },
+/* x = 21.8        */  {1.91680380887630142e-10         , 1.37264820345156086e-10         , 5.11876411678609363e-11         , 1.31772899242305808e-11         , 2.62115772173830901e-12         , 4.27850305035838439e-13         , 5.94737886003420295e-14         , 7.21860141076931522e-15         , },
+/* x = 21.9        */  {1.78452855870897678e-10         , 1.27412336585062918e-10         , 4.73875328671613537e-11         , 1.21704472254797284e-11         , 2.41590634460463175e-12         , 3.93639258328974522e-13         , 5.46326316483904421e-14         , 6.6219710992153311e-15          , },
+/* x = 22.0        */  {1.66173564802056899e-10         , 1.18290473390476936e-10         , 4.38774972656795488e-11         , 1.12423787438386141e-11         , 2.22705475073043866e-12         , 3.62211186634821811e-13         , 5.01913798531814413e-14         , 6.07527912137529861e-15         , },
+/* x = 22.1        */  {1.54772269189875698e-10         , 1.09843515216773236e-10         , 4.06348588450513826e-11         , 1.03867950371390697e-11         , 2.05326972851246351e-12         , 3.33336331480343717e-13         , 4.61165774181137681e-14         , 5.57429970939437022e-15         , },
+/* x = 22.2        */  {1.44184081500786368e-10         , 1.02020098159680011e-10         , 3.7638751175142373e-11          , 9.59791762659301029e-12         , 1.89332807187181564e-12         , 3.06804146299870293e-13         , 4.237759833806222e-14           , 5.11516809182869594e-15         , },
+/* x = 22.3        */  {1.34349047585580444e-10         , 9.47728630359505933e-11         , 3.48699700374160604e-11         , 8.87043686041864831e-12         , 1.74610738641368229e-12         , 2.8242167214318109e-13          , 3.89464047501885975e-14         , 4.69434939757879733e-15         , },
+/* x = 22.4        */  {1.25211762370503002e-10         , 8.80581366112480941e-11         , 3.23108386534709691e-11         , 8.19947329729972934e-12         , 1.61057767254971373e-12         , 2.60012052036129808e-13         , 3.57973260932460734e-14         , 4.30861025801838999e-15         , },
+/* x = 22.5        */  {1.16721016115633373e-10         , 8.18356386567641842e-11         , 2.9945084008058149e-11          , 7.58054231235107404e-12         , 1.48579361928577619e-12         , 2.39413172058461248e-13         , 3.29068572703749075e-14         , 3.95499287168709862e-15         , },
+/* x = 22.6        */  {1.08829468765470942e-10         , 7.60682127095706473e-11         , 2.77577233412281507e-11         , 7.00952165362439279e-12         , 1.37088754808274344e-12         , 2.20476418238471924e-13         , 3.02534741679746589e-14         , 3.6307913166106156e-15          , },
+/* x = 22.7        */  {1.01493350120157397e-10         , 7.0721578588850622e-11          , 2.57349599623171354e-11         , 6.48262170036744547e-12         , 1.2650629514084126e-12          , 2.03065539308829317e-13         , 2.78174650269879895e-14         , 3.33352991418010534e-15         , },
+/* x = 22.8        */  {9.4672183742322522e-11          , 6.57641048823675364e-11         , 2.38640876098923268e-11         , 5.99635819543621572e-12         , 1.16758857535763058e-12         , 1.87055606230121515e-13         , 2.55807762940650417e-14         , 3.06094346572605031e-15         , },
+/* x = 22.9        */  {8.83285326855686417e-11         , 6.11665997660757098e-11         , 2.21334026471086482e-11         , 5.54752724362642757e-12         , 1.07779300006467102e-12         , 1.72332060175789413e-13         , 2.35268716997081424e-14         , 2.81095919860784529e-15         , },
+/* x = 23.0        */  {8.24277652874166744e-11         , 5.69021186558202468e-11         , 2.05321234417031493e-11         , 5.13318238539497878e-12         , 9.95059675602722946e-13         , 1.58789841390590666e-13         , 2.16406034196385547e-14         , 2.58168027294371235e-15         , },
+/* x = 23.1        */  {7.69378394133205858e-11         , 5.29457873146781366e-11         , 1.90503163345485428e-11         , 4.75061357162749909e-12         , 9.1882237469280787e-13          , 1.46332591990669827e-13         , 1.99080942752046322e-14         , 2.37137071314840867e-15         , },
+/* x = 23.2        */  {7.18291036702116298e-11         , 4.92746391536291997e-11         , 1.76788276507374254e-11         , 4.39732787990653936e-12         , 8.48561026858424293e-13         , 1.34871926372144502e-13         , 1.83166300195066066e-14         , 2.17844164034031684e-15         , },
+/* x = 23.3        */  {6.70741142289606728e-11         , 4.58674655678031896e-11         , 1.64092212529725115e-11         , 4.07103182626570917e-12         , 7.83797901690005704e-13         , 1.24326763441861954e-13         , 1.68545608388153945e-14         , 2.00143869252650562e-15         , },
+/* x = 23.4        */  {6.26474660060628634e-11         , 4.27046782463403523e-11         , 1.5233721178959042e-11          , 3.76961513878783156e-12         , 7.24094111649756571e-13         , 1.14622715383193458e-13         , 1.55112112745112845e-14         , 1.83903052936685835e-15         , },
+/* x = 23.5        */  {5.85256370565928758e-11         , 3.97681824816699376e-11         , 1.41451589428656381e-11         , 3.49113587071978507e-12         , 6.69046407375311945e-13         , 1.05691528125572539e-13         , 1.42767978398013141e-14         , 1.68999832734078329e-15         , },
+/* x = 23.6        */  {5.46868451238188401e-11         , 3.70412605844338755e-11         , 1.31369251160428268e-11         , 3.23380674112438694e-12         , 6.18284240750674211e-13         , 9.74705691027402234e-14         , 1.31423536684733037e-14         , 1.55322617936925042e-15         , },
+/* x = 23.7        */  {5.11109153765017934e-11         , 3.45084645839823539e-11         , 1.22029248343416327e-11         , 2.99598260055374547e-12         , 5.71467073123928298e-13         , 8.99023582647942752e-14         , 1.20996595904401914e-14         , 1.42769232045101883e-15         , },
+/* x = 23.8        */  {4.77791584434885295e-11         , 3.21555174619125885e-11         , 1.13375369088115372e-11         , 2.77614892788505425e-12         , 5.28281907980585117e-13         , 8.29341386563048839e-14         , 1.11411810813040074e-14         , 1.31246110771878578e-15         , },
+/* x = 23.9        */  {4.4674257927318214e-11          , 2.99692222280313984e-11         , 1.05355762435094009e-11         , 2.57291127237829652e-12         , 4.88441029144805758e-13         , 7.65174831898341432e-14         , 1.02600105810653172e-14         , 1.20667568956679642e-15         , },
+/* x = 24.0        */  {4.17801666447464702e-11         , 2.79373782048717196e-11         , 9.79225928883040841e-12         , 2.38498556225923349e-12         , 4.5167992719259519e-13          , 7.06079345338060225e-14         , 9.449814720823151e-15           , 1.10955130419923576e-15         , },
+/* x = 24.1        */  {3.90820109028387287e-11         , 2.60487039389178313e-11         , 9.10317228137225642e-12         , 2.21118920775832779e-12         , 4.17755398234448588e-13         , 6.51646752982121081e-14         , 8.70478603621876155e-15         , 1.02036915314681427e-15         , },
+/* x = 24.2        */  {3.65660021750497873e-11         , 2.4292766204391729e-11          , 8.46424204204160352e-12         , 2.0504329325998463e-12          , 3.86443800571867026e-13         , 6.01502259432909536e-14         , 8.01959878280813892e-15         , 9.38470800041405965e-16         , },
+/* x = 24.3        */  {3.42193555929029516e-11         , 2.26599146091878212e-11         , 7.87170912306897585e-12         , 1.90171327348365886e-12         , 3.57539455963569e-13            , 5.55301680570786361e-14         , 7.38936850180774097e-15         , 8.63253049265552604e-16         , },
+/* x = 24.4        */  {3.20302147158892269e-11         , 2.11412213526480639e-11         , 7.32210311196273839e-12         , 1.76410569217938412e-12         , 3.30853183363095043e-13         , 5.12728908494136873e-14         , 6.80961501502321426e-15         , 7.94163263041703959e-16         , },
+/* x = 24.5        */  {2.99875820853723148e-11         , 1.97284257216496094e-11         , 6.81221991633959999e-12         , 1.63675824949889412e-12         , 3.06210954018950421e-13         , 4.73493588942502865e-14         , 6.27622855549535005e-15         , 7.30695079128578768e-16         , },
+/* x = 24.6        */  {2.80812551079269761e-11         , 1.84138829452110025e-11         , 6.33910086814203459e-12         , 1.51888579466565608e-12         , 2.83452657769778656e-13         , 4.37328993205036099e-14         , 5.78543876571222171e-15         , 6.72384494579409837e-16         , },
+/* x = 24.7        */  {2.63017668499483065e-11         , 1.7190517058766221e-11          , 5.90001349910500944e-12         , 1.40976462749165957e-12         , 2.62430971227906157e-13         , 4.0399006805502169e-14          , 5.33378631835212526e-15         , 6.18806284016797031e-16         , },
+/* x = 24.8        */  {2.46403313588148391e-11         , 1.60517774576421175e-11         , 5.49243385156888557e-12         , 1.30872759433554055e-12         , 2.43010319331884934e-13         , 3.73251648657147363e-14         , 4.91809693563080688e-15         , 5.69570723616701385e-16         , },
+/* x = 24.9        */  {2.30887931566139894e-11         , 1.49915988453179981e-11         , 5.11403019994683323e-12         , 1.21515958207710949e-12         , 2.25065922468723456e-13         , 3.44906820679047082e-14         , 4.5354576026038306e-15          , 5.24320594492807606e-16         , },
+/* x = 25.0        */  {2.16395805806685697e-11         , 1.40043643059419756e-11         , 4.76264806843005124e-12         , 1.12849337732953257e-12         , 2.08482922025122167e-13         , 3.18765419012926987e-14         , 4.18319478738073069e-15         , 4.82728441453062118e-16         , },
+/* x = 25.1        */  {2.02856626710435422e-11         , 1.30848712525066634e-11         , 4.43629643993158197e-12         , 1.04820586084440464e-12         , 1.93155577829505557e-13         , 2.94652651586372973e-14         , 3.85885449728768438e-15         , 4.44494065181806837e-16         , },
+/* x = 25.2        */  {1.90205093290513376e-11         , 1.22283000222108613e-11         , 4.13313505990191881e-12         , 9.73814509568370573e-13         , 1.78986531497794299e-13         , 2.724078377224915e-14           , 3.56018401470290133e-15         , 4.09342227801033291e-16         , },
+/* x = 25.3        */  {1.78380544926846815e-11         , 1.14301849090044321e-11         , 3.85146274656309187e-12         , 9.04874181102432716e-13         , 1.65886130200098015e-13         , 2.51883251406334357e-14         , 3.28511516970515763e-15         , 3.77020553498795728e-16         , },
+/* x = 25.4        */  {1.67326620950463322e-11         , 1.06863874402682265e-11         , 3.58970662636304007e-12         , 8.4097415741457319e-13          , 1.53771805826859473e-13         , 2.32943060634394135e-14         , 3.03174901893165784e-15         , 3.47297607496260848e-16         , },
+/* x = 25.5        */  {1.56990945903606196e-11         , 9.99307172014572156e-12         , 3.34641222010423144e-12         , 7.81735426579230325e-13         , 1.42567504955123569e-13         , 2.15462354773485204e-14         , 2.79834181123773741e-15         , 3.19961138070471696e-16         , },
+/* x = 25.6        */  {1.47324838491753216e-11         , 9.34668167633345138e-12         , 3.12023431130037009e-12         , 7.26808183078497675e-13         , 1.32203165401900679e-13         , 1.99326252540620715e-14         , 2.58329213098001812e-15         , 2.94816467669734647e-16         , },
+/* x = 25.7        */  {1.38283042400162984e-11         , 8.74392006025907872e-12         , 2.90992853390901318e-12         , 6.75869528813378e-13            , 1.22614235505114504e-13         , 1.84429083842106796e-14         , 2.38512911909062652e-15         , 2.71685020363609023e-16         , },
+/* x = 25.8        */  {1.29823477291533692e-11         , 8.18172906262594533e-12         , 2.7143436217184659e-12          , 6.28621358451563534e-13         , 1.13741232596175275e-13         , 1.7067363928306535e-14          , 2.20250168064974468e-15         , 2.50402973969827894e-16         , },
+/* x = 25.9        */  {1.21907008433768423e-11         , 7.65727241736990025e-12         , 2.53241426637327747e-12         , 5.84788414092495399e-13         , 1.05529337424363707e-13         , 1.57970481682591578e-14         , 2.03416859546713566e-15         , 2.30820026205262275e-16         , },
+/* x = 26.0        */  {1.14497233528640725e-11         , 7.16791887723944361e-12         , 2.36315453533958848e-12         , 5.44116495471366098e-13         , 9.79280215642919409e-14         , 1.46237314408974271e-14         , 1.87898945531430019e-15         , 2.12798265125610506e-16         , },
+/* x = 26.1        */  {1.07560285424208184e-11         , 6.71122695354824402e-12         , 2.20565180507202942e-12         , 5.06370813060860499e-13         , 9.08907050858658109e-14         , 1.35398401787712786e-14         , 1.73591635796591977e-15         , 1.96211134956467537e-16         , },
+/* x = 26.2        */  {1.01064649496922525e-11         , 6.28493082122816017e-12         , 2.05906116827764185e-12         , 4.71334472471554569e-13         , 8.43744419933643678e-14         , 1.25384037235976141e-14         , 1.60398629416547256e-15         , 1.80942489183753524e-16         , },
+/* x = 26.3        */  {9.49809945842597691e-12         , 5.88692729819359085e-12         , 1.92260027750666654e-12         , 4.38807079507030939e-13         , 7.83396311482659064e-14         , 1.16130055143883543e-14         , 1.48231416907397414e-15         , 1.66885723470496117e-16         , },
+/* x = 26.4        */  {8.92820164360102976e-12         , 5.51526381527163626e-12         , 1.79554459035999699e-12         , 4.08603456105265749e-13         , 7.27497505809190324e-14         , 1.07577382858479704e-14         , 1.3700864047370565e-15          , 1.53942981605448244e-16         , },
+/* x = 26.5        */  {8.39422927327388197e-12         , 5.16812729960974112e-12         , 1.67722298441150107e-12         , 3.80552458200406459e-13         , 6.75711132705764827e-14         , 9.96716294332160905e-15         , 1.26655507465455129e-15         , 1.42024428272258297e-16         , },
+/* x = 26.6        */  {7.89381487939101435e-12         , 4.843833900591391e-12           , 1.5670137125212144e-12          , 3.54495887274838325e-13         , 6.2772642633044091e-14          , 9.23627080865819439e-15         , 1.17103252569535324e-15         , 1.31047582960705232e-16         , },
+/* x = 26.7        */  {7.424753316629426e-12           , 4.54081949291522237e-12         , 1.46434067158178464e-12         , 3.30287488046048315e-13         , 5.83256661014958821e-14         , 8.56044895704958875e-15         , 1.08288644640235369e-15         , 1.20936709828258116e-16         , },
+/* x = 26.8        */  {6.98499023459870909e-12         , 4.25763089666408664e-12         , 1.36866995991306601e-12         , 3.0779202535138224e-13          , 5.42037253200101742e-14         , 7.93544838842158819e-15         , 1.0015353442084639e-15          , 1.11622258764924908e-16         , },
+/* x = 26.9        */  {6.57261139451461165e-12         , 3.99291775894531692e-12         , 1.27950670051451634e-12         , 2.86884433861059712e-13         , 5.03824015921343234e-14         , 7.35735479847212517e-15         , 9.2644439726332176e-16          , 1.03040353320674348e-16         , },
+/* x = 27.0        */  {6.18583276677421767e-12         , 3.74542504605574259e-12         , 1.19639210921677692e-12         , 2.67449034770069163e-13         , 4.68391553392415902e-14         , 6.82256173414732121e-15         , 8.57121649476879993e-16         , 9.51323215259840847e-17         , },
+/* x = 27.1        */  {5.82299135076366013e-12         , 3.51398609914611397e-12         , 1.11890078845602013e-12         , 2.49378814096753022e-13         , 4.35531784264750925e-14         , 6.32774593637301417e-15         , 7.93114520044161188e-16         , 8.78442659753317212e-17         , },
+/* x = 27.2        */  {5.48253666274431221e-12         , 3.29751621005818918e-12         , 1.04663822893970413e-12         , 2.32574757653619161e-13         , 4.05052583084789154e-14         , 5.86984468936066806e-15         , 7.34006601146452091e-16         , 8.11266698534818368e-17         , },
+/* x = 27.3        */  {5.16302284182359448e-12         , 3.09500667741007544e-12         , 9.7923850289161302e-13          , 2.16945238157481273e-13         , 3.76776530336249383e-14         , 5.44603501091246042e-15         , 6.79414719747654588e-16         , 7.49340358677666944e-17         , },
+/* x = 27.4        */  {4.86310132785029379e-12         , 2.90551930613561872e-12         , 9.16362133867872869e-13         , 2.02405450314461081e-13         , 3.5053976224723315e-14          , 5.05371453197991986e-15         , 6.28986241438275484e-16         , 6.92245553085257239e-17         , },
+/* x = 27.5        */  {4.58151406860770502e-12         , 2.72818131656381655e-12         , 8.576941293335384e-13           , 1.88876890053446928e-13         , 3.26190912268653226e-14         , 4.69048392639259426e-15         , 5.82396596139935127e-16         , 6.39598046965712221e-17         , },
+/* x = 27.6        */  {4.31708721693495196e-12         , 2.56218063177468716e-12         , 8.0294216329006673e-13          , 1.76286874391830478e-13         , 3.03590136796479834e-14         , 4.35413076326735086e-15         , 5.39347007185206494e-16         , 5.91044676929132407e-17         , },
+/* x = 27.7        */  {4.06872528140954673e-12         , 2.4067615144073876e-12          , 7.51834897255530657e-13         , 1.64568098702056256e-13         , 2.8260821832081374e-14          , 4.04261466522597818e-15         , 4.9956240684467204e-16          , 5.46260801437654182e-17         , },
+/* x = 27.8        */  {3.83540569699285084e-12         , 2.26122052634172849e-12         , 7.04120428829105427e-13         , 1.5365822840884241e-13          , 2.63125739744493032e-14         , 3.75405366527190357e-15         , 4.62789522797738027e-16         , 5.04947963146723277e-17         , },
+/* x = 27.9        */  {3.61617378459321019e-12         , 2.12490278674127223e-12         , 6.59564857925910232e-13         , 1.43499522386811264e-13         , 2.45032324127097444e-14         , 3.48671166408205533e-15         , 4.28795121347333221e-16         , 4.6683174532914641e-17          , },
+/* x = 28.0        */  {3.41013807085625204e-12         , 1.99719850584932673e-12         , 6.17950961553860852e-13         , 1.34038485548487151e-13         , 2.28225934580743847e-14         , 3.23898689762666283e-15         , 3.97364394371516863e-16         , 4.31659806085003049e-17         , },
+/* x = 28.1        */  {3.21646594166387597e-12         , 1.8775397736815796e-12          , 5.79076968726442636e-13         , 1.25225548314809079e-13         , 2.12612229475550051e-14         , 3.00940133250162981e-15         , 3.68299478096710068e-16         , 3.99200075422607489e-17         , },
+/* x = 28.2        */  {3.03437960482729516e-12         , 1.76539758437299605e-12         , 5.42755427769424634e-13         , 1.17014770845962352e-13         , 1.98103968508358653e-14         , 2.7965909132031218e-15          , 3.41418092776407245e-16         , 3.69239101559574176e-17         , },
+/* x = 28.3        */  {2.86315233930838115e-12         , 1.66027907842307572e-12         , 5.08812158890257581e-13         , 1.09363570080826175e-13         , 1.84620465551257603e-14         , 2.59929659184529682e-15         , 3.16552293273734774e-16         , 3.415805339488514e-17           , },
+/* x = 28.4        */  {2.70210501000975433e-12         , 1.56172498645286257e-12         , 4.77085285440588833e-13         , 1.02232467789918647e-13         , 1.72087084529354936e-14         , 2.41635607656825515e-15         , 2.93547321383335728e-16         , 3.16043731591660343e-17         , },
+/* x = 28.5        */  {2.55060282874878585e-12         , 1.4693072593486312e-12          , 4.47424337818983663e-13         , 9.5584857990546306e-14          , 1.6043477488267457e-14          , 2.24669624014871685e-15         , 2.72260551494381688e-16         , 2.92462486166110145e-17         , },
+/* x = 28.6        */  {2.40805234348427244e-12         , 1.38262687082956528e-12         , 4.19689424436231892e-13         , 8.93867922049863158e-14         , 1.49599643447238793e-14         , 2.089326135151288e-15           , 2.52560521898086384e-16         , 2.70683850384620325e-17         , },
+/* x = 28.7        */  {2.27389863920652598e-12         , 1.30131177954793261e-12         , 3.93750464602906061e-13         , 8.36067811639112166e-14         , 1.3952255984749709e-14          , 1.94333056638061675e-15         , 2.3432604468544224e-16          , 2.50567062802261458e-17         , },
+/* x = 28.8        */  {2.147622735140735e-12           , 1.22501503881753317e-12         , 3.6948647860120934e-13          , 7.82156116687938265e-14         , 1.30148792728178607e-14         , 1.80786417544826825e-15         , 2.17445387769066344e-16         , 2.31982561038201499e-17         , },
+/* x = 28.9        */  {2.0287391640577582e-12          , 1.15341304297624769e-12         , 3.46784930573440876e-13         , 7.31861774295147657e-14         , 1.21427674370152474e-14         , 1.68214599598386669e-15         , 2.01815523101639948e-16         , 2.14811076049535559e-17         , },
+/* x = 29.0        */  {1.91679372054340993e-12         , 1.08620390022749716e-12         , 3.25541120200213003e-13         , 6.84933227875806608e-14         , 1.13312291433593264e-14         , 1.56545444142642024e-15         , 1.87341435656672322e-16         , 1.98942800716286636e-17         , },
+/* x = 29.1        */  {1.81136136605361559e-12         , 1.02310592257899286e-12         , 3.05657619455264774e-13         , 6.41136983219291611e-14         , 1.05759199754148722e-14         , 1.45712269045479724e-15         , 1.73935488189070817e-16         , 1.84276626563231748e-17         , },
+/* x = 29.2        */  {1.71204427948482785e-12         , 9.63856224210509744e-13         , 2.87043751012519615e-13         , 6.00256274138724357e-14         , 9.8728161285249714e-15          , 1.35653443797988325e-15         , 1.61516837206779099e-16         , 1.70719442962943465e-17         , },
+/* x = 29.3        */  {1.61847004282258247e-12         , 9.08209420260329747e-13         , 2.69615105146942346e-13         , 5.62089829208869038e-14         , 9.21819014334302993e-15         , 1.26311998224682071e-15         , 1.50010895963777415e-16         , 1.58185493639162808e-17         , },
+/* x = 29.4        */  {1.53028995220135651e-12         , 8.55936418626868496e-13         , 2.53293092215607993e-13         , 5.26450731762190879e-14         , 8.60858851746766528e-15         , 1.17635262100386697e-15         , 1.39348840631969393e-16         , 1.46595785724102115e-17         , },
+/* x = 29.5        */  {1.44717744542087175e-12         , 8.06823297941857271e-13         , 2.38004528030896743e-13         , 4.93165365931275995e-14         , 8.04081104694397563e-15         , 1.0957453319030626e-15          , 1.29467156127603914e-16         , 1.35877547020957022e-17         , },
+/* x = 29.6        */  {1.36882663762217439e-12         , 7.60670265388014271e-13         , 2.23681249645432344e-13         , 4.62072442094613836e-14         , 7.51189176129832049e-15         , 1.02084771432379467e-15         , 1.20307218359362578e-16         , 1.25963727486930151e-17         , },
+/* x = 29.7        */  {1.29495095743537621e-12         , 7.17290688510821054e-13         , 2.10259759259714585e-13         , 4.33022095605898854e-14         , 7.01908132670692272e-15         , 9.51243171668766525e-16         , 1.11814909932337054e-16         , 1.16792541285309323e-17         , },
+/* x = 29.8        */  {1.22528187647368952e-12         , 6.76510195613961591e-13         , 1.97680894139672921e-13         , 4.05875053168236933e-14         , 6.55983080194148544e-15         , 8.86546314886853776e-16         , 1.03940266586887631e-16         , 1.08307046060226769e-17         , },
+/* x = 29.9        */  {1.15956772556885763e-12         , 6.38165839734072124e-13         , 1.85889520593793777e-13         , 3.8050186165735649e-14          , 6.13177664096108781e-15         , 8.26400569541655766e-16         , 9.66371518757003698e-17         , 1.00454756367053649e-17         , },
+/* x = 30.0        */  {1.09757259162452298e-12         , 6.0210532156534761e-13          , 1.74834250209156372e-13         , 3.56782174605254716e-14         , 5.73272684449622125e-15         , 7.70475970179983328e-16         , 8.98629577879701904e-17         , 9.31872884471505431e-18         , },
+/* x = 30.1        */  {1.03907528940948375e-12         , 5.68186267050700507e-13         , 1.64467176683668807e-13         , 3.34604091930528749e-14         , 5.36064817075967565e-15         , 7.18467127071806132e-16         , 8.35783292181092262e-17         , 8.64600337699053942e-18         , },
+/* x = 30.2        */  {9.83868403024924892e-13         , 5.36275555675820167e-13         , 1.54743631718962934e-13         , 3.13863548846585921e-14         , 5.01365432257666059e-15         , 6.70091351602159306e-16         , 7.77469103491574378e-17         , 8.02318589794793184e-18         , },
+/* x = 30.3        */  {9.31757392161118606e-13         , 5.0624869579770707e-13          , 1.4562195855564259e-13          , 2.94463750196416011e-14         , 4.68999503480491552e-15         , 6.2508692770519408e-16          , 7.2335111179476896e-17          , 7.44648300801242177e-18         , },
+/* x = 30.4        */  {8.82559758612116226e-13         , 4.77989243611961586e-13         , 1.37063301840675037e-13         , 2.76314646754862438e-14         , 4.38804599196217792e-15         , 5.83211517749206697e-16         , 6.73118925665509763e-17         , 6.91239588738669792e-18         , },
+/* x = 30.5        */  {8.36104268843762372e-13         , 4.51388262615046411e-13         , 1.29031412616395878e-13         , 2.59332450308387098e-14         , 4.10629951153683802e-15         , 5.44240692216655927e-16         , 6.26485682948911056e-17         , 6.41769698291746226e-18         , },
+/* x = 30.6        */  {7.92230228712947782e-13         , 4.26343820650530631e-13         , 1.214924673125308e-13           , 2.43439184570056564e-14         , 3.84335593356789313e-15         , 5.07966573381808914e-16         , 5.83186227971889031e-17         , 5.95940857102045819e-18         , },
+/* x = 30.7        */  {7.50786806716218792e-13         , 4.02760521843448704e-13         , 1.14414899707436767e-13         , 2.28562269215603991e-14         , 3.59791566177908775e-15         , 4.74196583977083693e-16         , 5.42975432698670412e-17         , 5.53478304345762383e-18         , },
+/* x = 30.8        */  {7.11632402405376197e-13         , 3.80549070925739119e-13         , 1.07769244902995003e-13         , 2.14634134536519088e-14         , 3.36877180587301266e-15         , 4.42752292563198011e-16         , 5.0562665026925888e-17          , 5.14128477543455608e-18         , },
+/* x = 30.9        */  {6.74634056848089476e-13         , 3.59625867639526393e-13         , 1.01527994429767007e-13         , 2.01591864399636917e-14         , 3.15480337856478035e-15         , 4.1346834798321497e-16          , 4.70930290302312028e-17         , 4.77657344710044345e-18         , },
+/* x = 31.0        */  {6.39666902234268643e-13         , 3.39912629074938153e-13         , 9.56654616656301256e-14         , 1.89376865380965848e-14         , 2.95496900458998728e-15         , 3.86191495891377381e-16         , 4.3869250620851423e-17          , 4.43848870017564753e-18         , },
+/* x = 31.1        */  {6.06613647935307969e-13         , 3.21336037956276596e-13         , 9.01576568125797602e-14         , 1.77934560105738037e-14         , 2.76830110228397065e-15         , 3.60779670908717634e-16         , 4.08733985553819288e-17         , 4.1250360211861883e-18          , },
+/* x = 31.2        */  {5.75364100514573688e-13         , 3.03827415035676576e-13         , 8.49821707331247338e-14         , 1.6721410297800526e-14          , 2.59390050142268276e-15         , 3.3710115847291753e-16          , 3.80888835239837314e-17         , 3.83437375172453552e-18         , },
+/* x = 31.3        */  {5.4581471536478695e-13          , 2.87322413887789562e-13         , 8.01180670000822041e-14         , 1.57168116622570297e-14         , 2.43093146386168945e-15         , 3.1503382092353031e-16          , 3.55003553936606689e-17         , 3.56480113435095258e-18         , },
+/* x = 31.4        */  {5.17868177812301828e-13         , 2.71760736523370988e-13         , 7.55457815619404641e-14         , 1.47752447490587369e-14         , 2.27861707612890269e-15         , 2.94464382798908965e-16         , 3.30936084816018216e-17         , 3.31474731026197025e-18         , },
+/* x = 31.5        */  {4.91433011680663979e-13         , 2.57085868354689714e-13         , 7.12470294706165131e-14         , 1.38925939198655096e-14         , 2.13623498553708328e-15         , 2.7528777072116807e-16          , 3.08554942196818321e-17         , 3.08276119173983379e-18         , },
+/* x = 31.6        */  {4.66423213447152141e-13         , 2.43244831152133928e-13         , 6.72047181596798344e-14         , 1.30650222280462852e-14         , 2.00311345360078739e-15         , 2.57406503613135336e-16         , 2.87738406228600106e-17         , 2.86750213871153535e-18         , },
+/* x = 31.7        */  {4.42757910257077485e-13         , 2.30187952729913433e-13         , 6.34028667992107633e-14         , 1.22889519130771586e-14         , 1.87862770258478558e-15         , 2.40730129329177662e-16         , 2.68373780216331794e-17         , 2.66773137453642046e-18         , },
+/* x = 31.8        */  {4.20361040182207128e-13         , 2.1786865218995872e-13          , 5.98265312886564039e-14         , 1.1561046301438976e-14          , 1.76219653289128653e-15         , 2.25174704092448286e-16         , 2.50356705622286105e-17         , 2.48230408145136503e-18         , },
+/* x = 31.9        */  {3.99161053222492284e-13         , 2.06243239637550015e-13         , 5.64617344815650167e-14         , 1.08781930098465435e-14         , 1.6532791907246191e-15          , 2.10662311416728161e-16         , 2.33590530181940724e-17         , 2.31016212097245095e-18         , },
+/* x = 32.0        */  {3.79090631654969137e-13         , 1.95270729360388865e-13         , 5.32954012661290319e-14         , 1.02374883545428494e-14         , 1.55137246706636237e-15         , 1.97120617453672707e-16         , 2.17985724937468966e-17         , 2.15032732901880355e-18         , },
+/* x = 32.1        */  {3.60086428430862979e-13         , 1.84912665535225171e-13         , 5.03152981532387746e-14         , 9.63622287768080736e-15         , 1.45600801046228362e-15         , 1.8448245994780176e-16          , 2.03459346329533306e-17         , 2.00189533962154969e-18         , },
+/* x = 32.2        */  {3.42088822412119134e-13         , 1.75132959593211449e-13         , 4.7509977049419927e-14          , 9.07186790854027042e-15         , 1.36674983747496711e-15         , 1.72685468203707755e-16         , 1.89934539797709176e-17         , 1.86402989483961729e-18         , },
+/* x = 32.3        */  {3.25041689322321411e-13         , 1.65897738437277212e-13         , 4.48687229157600911e-14         , 8.54206308353392179e-15         , 1.28319202590198597e-15         , 1.61671711674284769e-16         , 1.77340081624271318e-17         , 1.73595760195261564e-18         , },
+/* x = 32.4        */  {3.08892187364715173e-13         , 1.5717520276237236e-13          , 4.23815050358731547e-14         , 8.04460475468297757e-15         , 1.20495657700742347e-15         , 1.51387374966748062e-16         , 1.65609956017350016e-17         , 1.6169631021652162e-18          , },
+/* x = 32.5        */  {2.93590556532266658e-13         , 1.4893549478276304e-13          , 4.00389316362423409e-14         , 7.57743522153007982e-15         , 1.13169143407233114e-15         , 1.41782457236150224e-16         , 1.54682964669515612e-17         , 1.50638461796101492e-18         , },
+/* x = 32.6        */  {2.79089930701769062e-13         , 1.41150574719994096e-13         , 3.78322076210508388e-14         , 7.13863272633690718e-15         , 1.06306864554452473e-15         , 1.32810494095226017e-16         , 1.44502366248424137e-17         , 1.40360984890851782e-18         , },
+/* x = 32.7        */  {2.65346161666324541e-13         , 1.33794105450951808e-13         , 3.57530952009698137e-14         , 6.72640215691973644e-15         , 9.98782661966588108e-16         , 1.24428300315833469e-16         , 1.35015543478856411e-17         , 1.30807218816754386e-18         , },
+/* x = 32.8        */  {2.52317654318437221e-13         , 1.26841344757939707e-13         , 3.37938772114352612e-14         , 6.33906640563675264e-15         , 9.38548756689161983e-16         , 1.16595731732031491e-16         , 1.26173695661775704e-17         , 1.21924723418919918e-18         , },
+/* x = 32.9        */  {2.39965212249766825e-13         , 1.20269044662068562e-13         , 3.19473229308070352e-14         , 5.97505833688329982e-15         , 8.82101561140133182e-16         , 1.09275464878887692e-16         , 1.1793155464726162e-17          , 1.13664957416333108e-18         , },
+/* x = 33.0        */  {2.28251893083613099e-13         , 1.14055357357789831e-13         , 3.02066562225571265e-14         , 5.63291331900031303e-15         , 8.29193706124349654e-16         , 1.02432793015310185e-16         , 1.10247122435584418e-17         , 1.0598298176593017e-18          , },
+/* x = 33.1        */  {2.17142872902703017e-13         , 1.08179747300283092e-13         , 2.85655258383644211e-14         , 5.31126227977972885e-15         , 7.79594561277692401e-16         , 9.60354372843391818e-17         , 1.03081428725396802e-17         , 9.88371860643033299e-19         , },
+/* x = 33.2        */  {2.06605319178090487e-13         , 1.0262290902883887e-13          , 2.70179777307776761e-14         , 5.00882524777977648e-15         , 7.3308906539808146e-16          , 9.00533718611479765e-17         , 9.63983068610773256e-18         , 9.2189036164839553e-19          , },
+/* x = 33.3        */  {1.96608271645187855e-13         , 9.73666903385409159e-14         , 2.55584292350192031e-14         , 4.72440534446207913e-15         , 6.89476640928273468e-16         , 8.44586620281590198e-17         , 9.01641867536132665e-18         , 8.60028413345883911e-19         , },
+/* x = 33.4        */  {1.87122530610348121e-13         , 9.23940204396141841e-14         , 2.41816449896050594e-14         , 4.45688319474928613e-15         , 6.48570186374795686e-16         , 7.9225314198794716e-17          , 8.43479034619345108e-18         , 8.0245539409694689e-19          , },
+/* x = 33.5        */  {1.78120552206208733e-13         , 8.76888427689219789e-14         , 2.28827144748145795e-14         , 4.20521172599294346e-15         , 6.10195140917433556e-16         , 7.43291369870197771e-17         , 7.89205202251049832e-18         , 7.48864985318125249e-19         , },
+/* x = 33.6        */  {1.69576350146379217e-13         , 8.32360521414113715e-14         , 2.16570310567092858e-14         , 3.96841132755162987e-15         , 5.74188615897452507e-16         , 6.97476124895118154e-17         , 7.38551648309794519e-18         , 6.98973341614416326e-19         , },
+/* x = 33.7        */  {1.61465403560179302e-13         , 7.90214359509528368e-14         , 2.05002724324306642e-14         , 3.74556534522298068e-15         , 5.40398588273047552e-16         , 6.54597770114964184e-17         , 6.91268782945156939e-18         , 6.52517401684256185e-19         , },
+/* x = 33.8        */  {1.53764570516172151e-13         , 7.50316191501207336e-14         , 1.94083823799460525e-14         , 3.53581588666294008e-15         , 5.08683151500005297e-16         , 6.14461105264405605e-17         , 6.47124748995138698e-18         , 6.0925332895682338e-19          , },
+/* x = 33.9        */  {1.4645200686933776e-13          , 7.12540127571292211e-14         , 1.83775537223063264e-14         , 3.33835991567326272e-15         , 4.78909819636651055e-16         , 5.76884342143165878e-17         , 6.05904127317045053e-18         , 5.68955071802973608e-19         , },
+/* x = 34.0        */  {1.39507090091032477e-13         , 6.76767656554783784e-14         , 1.74042124228691267e-14         , 3.15244561485483668e-15         , 4.50954880787064809e-16         , 5.41698154733982548e-17         , 5.67406738993449718e-18         , 5.31413033970400606e-19         , },
+/* x = 34.1        */  {1.32910347763509775e-13         , 6.42887194679747221e-14         , 1.64850027338648734e-14         , 2.97736899761987805e-15         , 4.24702796287331945e-16         , 5.08744798468704909e-17         , 5.31446537002902405e-18         , 4.96432846637439612e-19         , },
+/* x = 34.2        */  {1.26643390441853403e-13         , 6.10793663017587602e-14         , 1.56167733261746602e-14         , 2.81247075193972163e-15         , 4.00045642308133387e-16         , 4.77877293482383233e-17         , 4.97850580523161657e-18         , 4.63834234163653584e-19         , },
+/* x = 34.3        */  {1.20688848605806784e-13         , 5.80388091748827626e-14         , 1.47965643332815623e-14         , 2.65713329948534806e-15         , 3.76882590795010385e-16         , 4.4895866708895028e-17          , 4.66458085566958205e-18         , 4.33449966243891754e-19         , },
+/* x = 34.4        */  {1.1503031344227385e-13          , 5.51577249479114089e-14         , 1.40215952470797035e-14         , 2.51077805500282448e-15         , 3.55119426896759215e-16         , 4.21861251075192532e-17         , 4.37119546140316607e-18         , 4.05124889750399329e-19         , },
+/* x = 34.5        */  {1.09652281216310964e-13         , 5.24273295960375592e-14         , 1.32892536076061185e-14         , 2.37286287186275977e-15         , 3.34668100244091525e-16         , 3.96466029744584346e-17         , 4.09695920564684582e-18         , 3.78715034078926796e-19         , },
+/* x = 34.6        */  {1.04540101004314805e-13         , 4.98393456683809053e-14         , 1.25970844328244347e-14         , 2.24287966073838692e-15         , 3.15446307636291318e-16         , 3.72662034951445976e-17         , 3.84057878019661618e-18         , 3.54086784303435079e-19         , },
+/* x = 34.7        */  {9.96799255779184141e-14         , 4.73859717915296789e-14         , 1.19427803383601644e-14         , 2.1203521693071667e-15          , 2.97377104874357024e-16         , 3.50345784650839773e-17         , 3.60085100745848091e-18         , 3.31116116893402729e-19         , },
+/* x = 34.8        */  {9.5058665240912458e-14          , 4.50598540840513588e-14         , 1.13241723005866452e-14         , 2.00483391174155939e-15         , 2.80388545646185556e-16         , 3.29420761752526391e-17         , 3.37665637699886401e-18         , 3.09687893161109541e-19         , },
+/* x = 34.9        */  {9.06639444343811942e-14         , 4.28540593576896967e-14         , 1.07392210197084585e-14         , 1.89590623756109682e-15         , 2.64413345523793025e-16         , 3.0979693030990181e-17          , 3.16695305778555305e-18         , 2.89695205986529934e-19         , },
+/* x = 35.0        */  {8.64840609372475931e-14         , 4.07620499893307982e-14         , 1.01860088425040231e-14         , 1.79317653016495955e-15         , 2.49388569275348712e-16         , 2.91390286298724326e-17         , 2.97077135028029868e-18         , 2.71038775717310029e-19         , },
+/* x = 35.1        */  {8.25079475006199208e-14         , 3.87776603556052809e-14         , 9.66273220718816358e-15         , 1.69627652605640418e-15         , 2.3525533982682331e-16          , 2.74122440447088641e-17         , 2.78720854530173854e-18         , 2.53626391463193775e-19         , },
+/* x = 35.2        */  {7.87251357647788148e-14         , 3.68950747292382516e-14         , 9.16769457545462238e-15         , 1.60486074641172841e-15         , 2.2195856733014706e-16          , 2.57920230768864503e-17         , 2.61542415911864956e-18         , 2.37372394300471993e-19         , },
+/* x = 35.3        */  {7.5125722317391508e-14          , 3.5108806543002486e-14          , 8.69929981917239909e-15         , 1.51860503324082454e-15         , 2.09446696907701066e-16         , 2.42715362628934834e-17         , 2.45463551657589938e-18         , 2.2219719917463376e-19          , },
+/* x = 35.4        */  {7.17003367606366684e-14         , 3.34136789334084446e-14         , 8.25604603145200127e-15         , 1.43720518293727851e-15         , 1.97671473747428785e-16         , 2.28444074331188492e-17         , 2.30411365621471047e-18         , 2.08026852540311514e-19         , },
+/* x = 35.5        */  {6.84401116634141879e-14         , 3.18048064821106829e-14         , 7.83651973388073373e-15         , 1.36037567052667742e-15         , 1.86587724319502819e-16         , 2.15046826370400306e-17         , 2.16317953333953138e-18         , 1.94792623008582336e-19         , },
+/* x = 35.6        */  {6.53366542827408648e-14         , 3.02775780784544737e-14         , 7.43939045366163318e-15         , 1.28784845839529691e-15         , 1.76153152574911906e-16         , 2.02468012627836261e-17         , 2.03120049881931759e-18         , 1.82430622484327282e-19         , },
+/* x = 35.7        */  {6.2382019945833989e-14          , 2.88276408316574768e-14         , 7.06340564618931302e-15         , 1.21937188372042804e-15         , 1.66328150069095689e-16         , 1.90655691918548515e-17         , 1.90758703310366565e-18         , 1.70881455472136013e-19         , },
+/* x = 35.8        */  {5.95686869912963663e-14         , 2.74508849658454273e-14         , 6.70738594026775458e-15         , 1.15470961923083413e-15         , 1.57075619030358291e-16         , 1.79561338416695834e-17         , 1.79178971649533583e-18         , 1.60089894409532076e-19         , },
+/* x = 35.9        */  {5.68895331742717451e-14         , 2.61434296355625044e-14         , 6.37022068472916353e-15         , 1.09363970230357087e-15         , 1.48360807463704626e-16         , 1.69139609594597936e-17         , 1.68329641816064616e-18         , 1.50004579052331113e-19         , },
+/* x = 36.0        */  {5.43378134464700364e-14         , 2.49016096034789839e-14         , 6.05086377665791723e-15         , 1.03595362775384611e-15         , 1.40151155446397935e-16         , 1.59348130412304643e-17         , 1.58162968768759334e-18         , 1.40577738089874524e-19         , },
+/* x = 36.1        */  {5.19071390275960625e-14         , 2.37219627258419773e-14         , 5.74832975276724307e-15         , 9.814554999997615e-16           , 1.32416151832331998e-16         , 1.50147292587875555e-17         , 1.48634433422715607e-18         , 1.31764931308755857e-19         , },
+/* x = 36.2        */  {4.95914576899807017e-14         , 2.26012181947790672e-14         , 5.46169012672588856e-15         , 9.2996124058553652e-16          , 1.25127200638614674e-16         , 1.41500067864914998e-17         , 1.39702517938415918e-18         , 1.23524810753442264e-19         , },
+/* x = 36.3        */  {4.73850351831342358e-14         , 2.15362854898875567e-14         , 5.19006995639443057e-15         , 8.8129784732689324e-16          , 1.18257496439910383e-16         , 1.33371834273735825e-17         , 1.31328497106777088e-18         , 1.15818899451775903e-19         , },
+/* x = 36.4        */  {4.52824377295417028e-14         , 2.05242439946406763e-14         , 4.93264462601228511e-15         , 8.3530270160227596e-16          , 1.11781908144401108e-16         , 1.25730214456336689e-17         , 1.23476244647502238e-18         , 1.08611386383535471e-19         , },
+/* x = 36.5        */  {4.32785155273207435e-14         , 1.95623332360320537e-14         , 4.688636829382721e-15           , 7.91822920554969724e-16         , 1.05676870569987615e-16         , 1.18544925193633788e-17         , 1.16112053326998516e-18         , 1.01868936471795239e-19         , },
+},
+/* n = 20 */
+{
+/* x = 0.0         */  {0.0243902439024390244           , 0.0232558139534883721           , 0.0111111111111111111           , 0.00354609929078014184          , 0.000850340136054421769         , 0.000163398692810457516         , 0.0000262054507337526205        , 3.6075036075036075e-6           , },
+/* x = 0.1         */  {0.0221723109447862008           , 0.0211366535013732894           , 0.0100967063077296731           , 0.0032217913830925057           , 0.000772448332526465384         , 0.000148409208965154936         , 0.0000237982002138099524        , 3.27569655062322394e-6          , },
+/* x = 0.2         */  {0.0201564666505587781           , 0.0192109489873201069           , 0.00917506672097842255          , 0.00292718825419840452          , 0.000701701521455022503         , 0.000134796586523429264         , 0.0000216123487687681737        , 2.97444242966847674e-6          , },
+/* x = 0.3         */  {0.0183242640742870866           , 0.0174610106067544756           , 0.00833769617393715513          , 0.00265956527017391557          , 0.00063744343800877257          , 0.000122434200230537176         , 0.0000196275109471519717        , 2.70092495423325873e-6          , },
+/* x = 0.4         */  {0.0166589429494432756           , 0.01587076861441875             , 0.00757687774022934318          , 0.00241644803854199694          , 0.000579078168396033195         , 0.000111207083313497255         , 0.0000178251802829234346        , 2.45258768867037834e-6          , },
+/* x = 0.5         */  {0.0151452752306940054           , 0.0144256247458207964           , 0.00688560217883040996          , 0.00219558939701724551          , 0.000526064593592908763         , 0.000101010852938560684         , 0.0000161885559324416115        , 2.22711005344017269e-6          , },
+/* x = 0.6         */  {0.0137694248008225435           , 0.0131123172830815415           , 0.00625750294936660572          , 0.00199494852069001144          , 0.000477911345158221965         , 0.0000917507348058513804        , 0.0000147023853215092768        , 2.02238554476977012e-6          , },
+/* x = 0.7         */  {0.0125188200416170915           , 0.0119187985106365979           , 0.00568679720213007029          , 0.00181267195241628704          , 0.000434172225892363991         , 0.0000833406777262532062        , 0.0000133528213226786778        , 1.83650196740487982e-6          , },
+/* x = 0.8         */  {0.0113820380876094889           , 0.0108341234217296587           , 0.00516823219286054212          , 0.00164707637919033326          , 0.000394442052459697616         , 0.0000757025498717854409        , 0.0000121272926198830791        , 1.66772349423570278e-6          , },
+/* x = 0.9         */  {0.0103486996901281938           , 0.00984834864147601998          , 0.0046970366230193742           , 0.00149663299362449687          , 0.000358352881053449205         , 0.0000687654091585979299        , 0.0000110143860416822679        , 1.51447438381792655e-6          , },
+/* x = 1.0         */  {0.00940937371771591874          , 0.00895244062745517334          , 0.00426887645228253303          , 0.00135995329449880424          , 0.000325570580775426559         , 0.0000624648409185804662        , 0.0000100037397571320358        , 1.37532420245200032e-6          , },
+/* x = 1.1         */  {0.00855549040847624283          , 0.00813819229520291032          , 0.00387981477173763415          , 0.00123577619381117578          , 0.000295791722664242716         , 0.0000567423566479919741        , 9.08594633057533364e-6          , 1.24897441167705432e-6          , },
+/* x = 1.2         */  {0.00777926257119075422          , 0.00739814729442451102          , 0.00352627536417747446          , 0.00112295630998406974          , 0.00026874075526572172          , 0.0000515448481954397435        , 8.25246472447287828e-6          , 1.1342461949142641e-6           , },
+/* x = 1.3         */  {0.00707361400584753005          , 0.00672553123297543416          , 0.00320500961229443576          , 0.00102045333797991124          , 0.000244167440325678953         , 0.0000468240922723905322        , 7.49554042362043467e-6          , 1.03006940868003539e-6          , },
+/* x = 1.4         */  {0.00643211448123182164          , 0.00611418921032078946          , 0.00291306644681919104          , 0.000927322397150042673         , 0.000221844524623594596         , 0.0000425363006420856195        , 6.80813293053448127e-6          , 9.35472554392667827e-7          , },
+/* x = 1.5         */  {0.00584892066807594057          , 0.00555852908089457819          , 0.00264776505500617221          , 0.000842705266784759463         , 0.000201565626178782496         , 0.0000386417117717177403        , 6.18384995114941737e-6          , 8.49573676417456213e-7          , },
+/* x = 1.6         */  {0.0053187224815151644           , 0.00505346992108322867          , 0.00240667009561303507          , 0.000765822427631132691         , 0.000183143315069323053         , 0.0000351042201220533896        , 5.61688765291290628e-6          , 7.71572100725514339e-7          , },
+/* x = 1.7         */  {0.00483669433676529581          , 0.00459439522195366997          , 0.00218756918989311157          , 0.000695965835178695634         , 0.000166407370927175474         , 0.0000318910396020188891        , 5.1019764344856827e-6           , 7.0074093646352718e-7           , },
+/* x = 1.8         */  {0.00439845086749311471          , 0.00417711037378643467          , 0.00198845247933752119          , 0.00063249235735140596          , 0.000151203200827661371         , 0.0000289723980364426707        , 4.63433169808742521e-6          , 6.36420269920062163e-7          , },
+/* x = 1.9         */  {0.00400000669771804487          , 0.0037978040483696808           , 0.00180749406016595022          , 0.000574817815451774872         , 0.000137390402793480936         , 0.0000263212597861809826        , 4.2096091625703805e-6           , 5.78010986896964658e-7          , },
+/* x = 2.0         */  {0.00363773989564746218          , 0.00345301312123331438          , 0.00164303512205247829          , 0.000522411572837931409         , 0.000124841461496707973         , 0.0000239130739239914265        , 3.82386429799126339e-6          , 5.24969165413388849e-7          , },
+/* x = 2.1         */  {0.00330835877195922029          , 0.00313959080889193374          , 0.0014935686344489572           , 0.000474791620929533237         , 0.000113440563979627606         , 0.000021725545609246339         , 3.47351550119235604e-6          , 4.7680098604111849e-7           , },
+/* x = 2.2         */  {0.0030088717160209317           , 0.00285467772602825372          , 0.00135772543828193486          , 0.000431520116781827819         , 0.000103082524338461759         , 0.0000197384285221536831        , 3.15531066706018229e-6          , 4.33058112043771316e-7          , },
+/* x = 2.3         */  {0.00273655979166481267          , 0.00259567559466382299          , 0.00123426161388485379          , 0.000392199330682358975         , 0.0000936718073335280555        , 0.0000179333364156254702        , 2.86629684203627538e-6          , 3.93333495915309472e-7          , },
+/* x = 2.4         */  {0.00248895183968139724          , 0.00236022336198432993          , 0.00112204700790767536          , 0.000356467966051329119         , 0.0000851216418147769796        , 0.0000162935720221618483        , 2.60379267541030324e-6          , 3.57257572926780271e-7          , },
+/* x = 2.5         */  {0.00226380185739294287          , 0.00214617550584237252          , 0.00102005481273232232          , 0.000323997817400340464         , 0.000077353215691643463         , 0.0000148039717157898622        , 2.36536341020421153e-6          , 3.24494805932298284e-7          , },
+/* x = 2.6         */  {0.00205906844673378043          , 0.00195158232725983024          , 0.00092735210171527114          , 0.000294490735257709043         , 0.0000702949449386223535        , 0.0000134507644767403962        , 2.14879817930484624e-6          , 2.94740548990348452e-7          , },
+/* x = 2.7         */  {0.00187289614139621618          , 0.00177467204768427744          , 0.00084309123246983009          , 0.000267675869831325399         , 0.0000638818098200925726        , 0.000012221443840554167         , 1.95208939414653727e-6          , 2.67718200355750192e-7          , },
+/* x = 2.8         */  {0.00170359844097483495          , 0.00161383454549111931          , 0.000766502038473229036         , 0.000243307167778947863         , 0.0000580547521461706281        , 0.0000111046516349385322        , 1.77341403288835622e-6          , 2.431766181193916e-7            , },
+/* x = 2.9         */  {0.00154964239582076015          , 0.00146760658142136844          , 0.000696884736613070162         , 0.000221161098815203608         , 0.0000527601279416680206        , 0.0000100900724180953494        , 1.61111665285831156e-6          , 2.20887774242814048e-7          , },
+/* x = 3.0         */  {0.00140963460064729926          , 0.0013346583764458878           , 0.00063360348494243605          , 0.000201034591026536152         , 0.0000479492104279114723        , 9.16833763244437287e-6          , 1.46369396821657847e-6          , 2.00644624976213346e-7          , },
+/* x = 3.1         */  {0.00128230846794264278          , 0.00121378141807912065          , 0.00057608053095519207          , 0.000182743155709932265         , 0.0000435777386871175583        , 8.33093857861887432e-6          , 1.32978084847439623e-6          , 1.82259177682576618e-7          , },
+/* x = 3.2         */  {0.00116651266406482718          , 0.001103877382545578            , 0.000523790896179190523         , 0.000166119184316690935         , 0.0000396055078056030494        , 7.57014739716532678e-6          , 1.20813760683280918e-6          , 1.65560735936687228e-7          , },
+/* x = 3.3         */  {0.00106120060162882946          , 0.00100394807053666702          , 0.000476257547866414876         , 0.000151010401685286196         , 0.0000359959966793604922        , 6.8789453203130472e-6           , 1.0976384594014822e-6           , 1.50394306443018136e-7          , },
+/* x = 3.4         */  {0.000965420891545134073         , 0.000913086263680061401         , 0.000433047013082100057         , 0.000137278461202522688         , 0.0000327160300170669026        , 6.25095752419681121e-6          , 9.97261047336275552e-7          , 1.36619152836898797e-7          , },
+/* x = 3.5         */  {0.00087830866692393431          , 0.000830467417366115141         , 0.000393765394601746451         , 0.000124797668853301901         , 0.000029735471394718068         , 5.6803939736546991e-6           , 9.06076923898463841e-7          , 1.24107482813120165e-7          , },
+/* x = 3.6         */  {0.000799077699101500287         , 0.000755342113315132077         , 0.000358054751754036007         , 0.000113453824318765737         , 0.0000270269445057834316        , 5.16199570776476249e-6          , 8.2324291748221173e-7           , 1.12743256278346528e-7          , },
+/* x = 3.7         */  {0.000727013233349804664         , 0.000687029202297648653         , 0.00032558981273375006          , 0.000103143168371579149         , 0.000024565580013772122         , 4.69098606515385621e-6          , 7.47993289865279435e-7          , 1.02421103360137067e-7          , },
+/* x = 3.8         */  {0.000661465478465019247         , 0.000624909573802657019         , 0.000296074987983464213         , 0.0000937714268058373557        , 0.0000223287856528538297        , 4.26302639428783764e-6          , 6.79632616388152512e-7          , 9.30453421367560592e-8          , },
+/* x = 3.9         */  {0.000601843690456522246         , 0.000568420495245259436         , 0.000269241657034728673         , 0.0000852529420367776081        , 0.0000202960374389257319        , 3.87417583586781221e-6          , 6.17529321528956952e-7          , 8.45290868879886247e-8          , },
+/* x = 4.0         */  {0.000547610796031469103         , 0.000517050468569506615         , 0.00024484570373466276          , 0.0000775098843205305862        , 0.000018448690050288776         , 3.52085480250564619e-6          , 5.61109809479231661e-7          , 7.67934385166989063e-8          , },
+/* x = 4.1         */  {0.000498278506541523156         , 0.000470334556883073395         , 0.000222665277086031004         , 0.0000704715352841776991        , 0.0000167698046157360956        , 3.19981181539065129e-6          , 5.09853134896602021e-7          , 6.97667495618729571e-8          , },
+/* x = 4.2         */  {0.000453402877574094623         , 0.000427850138102401588         , 0.000202498757019378695         , 0.0000640736371283011187        , 0.0000152439923100357602        , 2.90809338901224975e-6          , 4.63286164067007648e-7          , 6.33839569236419509e-8          , },
+/* x = 4.3         */  {0.000412580273472240041         , 0.000389213046530338362         , 0.000184162906314163827         , 0.0000582578014742986956        , 0.0000138572723040276183        , 2.64301668346467767e-6          , 4.20979181298917242e-7          , 5.75859760558727893e-8          , },
+/* x = 4.4         */  {0.000375443699793226014         , 0.000354074066869752888         , 0.000167491191609712102         , 0.0000529709723826827278        , 0.0000125969427502276897        , 2.40214466969632759e-6          , 3.82541899538049821e-7          , 5.23191509583229618e-8          , },
+/* x = 4.5         */  {0.000341659470100165535         , 0.000322115748429386713         , 0.000152332258012295676         , 0.0000481649385715611922        , 0.0000114514636061942116        , 2.18326357652045027e-6          , 3.47619837972661906e-7          , 4.75347548235112838e-8          , },
+/* x = 4.6         */  {0.000310924176555425852         , 0.000293049510232486769         , 0.000138548543226268991         , 0.0000437958903212070213        , 0.0000104103502080923839        , 1.98436240949552704e-6          , 3.15891032831981259e-7          , 4.31885366682803484e-8          , },
+/* x = 4.7         */  {0.000282961936577138765         , 0.000266613010422007687         , 0.0001260150184282188           , 0.0000398240169653169312        , 9.46407660693066273e-6          , 1.80361435111227153e-6          , 2.87063050696111797e-7          , 3.9240309710988878e-8           , },
+/* x = 4.8         */  {0.000257521890356957593         , 0.000242567755793253382         , 0.000114618044275513884         , 0.0000362131412461149431        , 8.60398777076556035e-6          , 1.63935986927106783e-6          , 2.60870276463962131e-7          , 3.56535776464278706e-8          , },
+/* x = 4.9         */  {0.000234375926341666846         , 0.000220696929498367364         , 0.000104254331505380415         , 0.0000329303871523791974        , 7.82221983863347426e-6          , 1.49009137696311668e-6          , 2.37071450693017796e-7          , 3.23951953255834664e-8          , },
+/* x = 5.0         */  {0.000213316613874671955         , 0.000200803416977608308         , 0.0000948299965475845066        , 0.0000299458781699523082        , 7.11162768683784926e-6          , 1.35443930052986969e-6          , 2.15447433355185476e-7          , 2.94350606696113231e-8          , },
+/* x = 5.1         */  {0.000194155324095131505         , 0.000182708011998505451         , 0.0000862597034519656024        , 0.0000272324631562298711        , 6.46571913619766152e-6          , 1.23115942700393288e-6          , 1.95799173168359626e-7          , 2.67458349398725338e-8          , },
+/* x = 5.2         */  {0.000176720521920120015         , 0.000166247786342706559         , 0.0000784658842295966157        , 0.0000247654673061365864        , 5.87859519058391404e-6          , 1.11912141295345392e-6          , 1.77945863583649249e-7          , 2.43026887513599456e-8          , },
+/* x = 5.3         */  {0.000160856213504688503         , 0.000151274608186982302         , 0.0000713780304306614523        , 0.0000225224659095804166        , 5.3448957531110899e-6           , 1.01729834807266156e-6          , 1.61723268251372188e-7          , 2.20830714578119663e-8          , },
+/* x = 5.4         */  {0.000146420535000520255         , 0.000137653795593394672         , 0.0000649320494399677277        , 0.0000204830788114880789        , 4.85975031723368159e-6          , 9.24757276584985779e-7          , 1.46982200371327802e-7          , 2.00665017555335269e-8          , },
+/* x = 5.5         */  {0.000133284469729227248         , 0.000125262892766750017         , 0.0000590696795684628967        , 0.0000186287836772362683        , 4.4187331761990934e-6           , 8.4065058844399003e-7           , 1.33587141769337373e-7          , 1.82343775514763194e-8          , },
+/* x = 5.6         */  {0.000121330682063156669         , 0.000113990557866651127         , 0.0000537379585617440906        , 0.0000169427463403874603        , 4.01782273625867923e-6          , 7.64208200414639846e-7          , 1.21414988846064613e-7          , 1.65698033213381308e-8          , },
+/* x = 5.7         */  {0.000110452457375737857         , 0.000103735552187191171         , 0.0000488887406393836664        , 0.0000154096666677376785        , 3.65336455712994363e-6          , 6.9473045446896268e-7           , 1.10353913727921398e-7          , 1.5057433347016983e-8           , },
+/* x = 5.8         */  {0.000100552738394762            , 0.0000944058214490885556        , 0.0000444782576265083251        , 0.0000140156385202576797        , 3.3220377777904128e-6           , 6.31581667604677234e-7          , 1.00302330024522261e-7          , 1.36833293712362264e-8          , },
+/* x = 5.9         */  {0.0000915432491745092634        , 0.0000859176607954669972        , 0.0000404667201456233748        , 0.0000127480225188945551        , 3.02082461709002582e-6          , 5.74184273255297407e-7          , 9.11679535727461041e-8          , 1.24348313419360724e-8          , },
+/* x = 6.0         */  {0.0000833436987044580632        , 0.0000781949558513685139        , 0.0000368179552059369864        , 0.0000115953304426106993        , 2.74698266718700967e-6          , 5.22013499962197882e-7          , 8.28669494331357192e-8          , 1.13004400413707114e-8          , },
+/* x = 6.1         */  {0.0000758810569008199642        , 0.0000711684929055586935        , 0.0000334990768628369404        , 0.0000105471201935727071        , 2.49801972370799499e-6          , 4.74592537974589916e-7          , 7.53231572084116364e-8          , 1.02697105059066089e-8          , },
+/* x = 6.2         */  {0.000069088896389054216         , 0.000064775331907700685         , 0.0000304801869248143183        , 9.59390036206390161e-6          , 2.27167092004800367e-6          , 4.31488148978977116e-7          , 6.84673874838267908e-8          , 9.33315524332910865e-9          , },
+/* x = 6.3         */  {0.0000629067940869258513        , 0.0000589582365504010379        , 0.0000277341029618388018        , 8.72704351238869496e-6          , 2.06587795457905143e-6          , 3.9230667827781591e-7           , 6.22367828517776171e-8          , 8.48215634597705724e-9          , },
+/* x = 6.4         */  {0.0000572797871441190185        , 0.0000536651562292925983        , 0.0000252361111205330949        , 7.93870739158911509e-6          , 1.87877021892641913e-6          , 3.5669043247625937e-7           , 5.6574237584719276e-8           , 7.70888568109736288e-9          , },
+/* x = 6.5         */  {0.0000521578782909335307        , 0.000048848755150054024         , 0.0000229637414797980994        , 7.2217633359520064e-6           , 1.70864765307978641e-6          , 3.24314389130933568e-7          , 5.14278705666389943e-8          , 7.00623241522239892e-9          , },
+/* x = 6.6         */  {0.0000474955860997471025        , 0.0000444659842834649837        , 0.0000208965638879204879        , 6.5697312167291729e-6           , 1.5539651690963805e-6           , 2.94883207897380079e-7          , 4.67505465892332354e-8          , 6.3677371978301895e-9           , },
+/* x = 6.7         */  {0.0000432515360728692084        , 0.0000404776922622504747        , 0.0000190160024105704936        , 5.97672032683909506e-6          , 1.41331849967395405e-6          , 2.68128515511871132e-7          , 4.24994415691511344e-8          , 5.78753239169222496e-9          , },
+/* x = 6.8         */  {0.0000393880888429153656        , 0.0000368482716702005081        , 0.0000173051666902139254        , 5.43737566512806629e-6          , 1.28543134105794e-6             , 2.4380643948488625e-7           , 3.8635647651419605e-8           , 5.26028779372912358e-9          , },
+/* x = 6.9         */  {0.0000358710021103178699        , 0.0000335453374981537611        , 0.0000157486986729022089        , 4.9468291245493724e-6           , 1.16914367172225923e-6          , 2.21695367691344258e-7          , 3.51238145352773851e-8          , 4.78116134140893512e-9          , },
+/* x = 7.0         */  {0.0000326691232501718072        , 0.000030539434835894849         , 0.0000143326332996057965        , 4.5006551358333985e-6           , 1.06340113913839931e-6          , 2.01593913138238919e-7          , 3.19318236955859104e-8          , 4.34575434621658351e-9          , },
+/* x = 7.1         */  {0.0000297541098001197093        , 0.0000278037731365495643        , 0.0000130442718875255984        , 4.09483035928872755e-6          , 9.6724541682369982e-7           , 1.83319065093172956e-7          , 2.90304924789039733e-8          , 3.9500708379313569e-9           , },
+/* x = 7.2         */  {0.0000271001752949719006        , 0.0000253139846331367055        , 0.0000118720670433402419        , 3.72569705467525928e-6          , 8.79805442829119646e-7          , 1.66704509485165125e-7          , 2.63933053310697526e-8          , 3.59048064176783497e-9          , },
+/* x = 7.3         */  {0.0000246838581445746409        , 0.0000230479047077887697        , 0.0000108055180562011253        , 3.38992979297097081e-6          , 8.00289458972515784e-7          , 1.51599103058124614e-7          , 2.39961696653232878e-8          , 3.26368584522304341e-9          , },
+/* x = 7.4         */  {0.0000224838114611933237        , 0.0000209853722148211971        , 9.83507581445063913e-6          , 3.08450520462820907e-6          , 7.27977777521346857e-7          , 1.37865487182168552e-7          , 2.18171941089807602e-8          , 2.96669034305466072e-9          , },
+/* x = 7.5         */  {0.0000204806119332979882        , 0.0000191080479411589288        , 8.95205637740001181e-6          , 2.80667448686852755e-6          , 6.62216208747475517e-7          , 1.25378828521776458e-7          , 1.98364870745776242e-8          , 2.69677217748741477e-9          , },
+/* x = 7.6         */  {0.0000186565860158718077        , 0.0000173992495532982514        , 8.14856241286888538e-6          , 2.55393841795601961e-6          , 6.02410088878801631e-7          , 1.1402567493468203e-7           , 1.80359737901720877e-8          , 2.45145841677574369e-9          , },
+/* x = 7.7         */  {0.0000169956518647985734        , 0.0000158438015305158735        , 7.41741178329173706e-6          , 2.32402464945302248e-6          , 5.48018853514489396e-7          , 1.03702916042339e-7             , 1.63992300949059904e-8          , 2.22850233888393546e-9          , },
+/* x = 7.8         */  {0.0000154831755859656493        , 0.0000144278987208208277        , 6.75207262870220778e-6          , 2.11486706841252128e-6          , 4.98551106604017875e-7          , 9.43168388816978165e-8          , 1.49113314615566176e-8          , 2.02586270850139674e-9          , },
+/* x = 7.9         */  {0.0000141058404997555814        , 0.0000131389822804361052        , 6.14660435441975161e-6          , 1.92458704049250285e-6          , 4.53560139661913052e-7          , 8.57822699279121177e-8          , 1.35587158491327168e-8          , 1.84168495509112037e-9          , },
+/* x = 8.0         */  {0.0000128515282397836611        , 0.0000119656268705386417        , 5.59560398533280478e-6          , 1.75147636226500616e-6          , 4.12639860042239318e-7          , 7.80217955766466662e-8          , 1.23290591168893887e-8          , 1.6742840773559925e-9           , },
+/* x = 8.1         */  {0.0000117092106121525124        , 0.0000108974380876164412        , 5.09415739779754039e-6          , 1.59398176669662525e-6          , 3.75421090868265587e-7          , 7.09650539003156738e-8          , 1.12111618476564869e-8          , 1.52212911556565841e-9          , },
+/* x = 8.2         */  {0.0000106688512391214373        , 9.92495919706320752e-6          , 4.63779498480413401e-6          , 1.4506908400429851e-6           , 3.41568208638159223e-7          , 6.45480911515919301e-8          , 1.01948465341802409e-8          , 1.3838290477663529e-9           , },
+/* x = 8.3         */  {9.72131609982116111e-6          , 9.03958632438045692e-6          , 4.22245135061468755e-6          , 1.32031922135913513e-6          , 3.10776087638865675e-7          , 5.87127770860210909e-8          , 9.27086417825443906e-9          , 1.25811997913364618e-9          , },
+/* x = 8.4         */  {8.85829216129543021e-6          , 8.23349133537287891e-6          , 3.8444286679221881e-6           , 1.20169896760068112e-6          , 2.82767323126348715e-7          , 5.34062737191159804e-8          , 8.43080943966117123e-9          , 1.14385350574714217e-9          , },
+/* x = 8.5         */  {8.07221336645711002e-6          , 7.49955170671160802e-6          , 3.50036336405749914e-6          , 1.09376797798559557e-6          , 2.57289707797288666e-7          , 4.85805526269447533e-8          , 7.66704355116484605e-9          , 1.03998614497906572e-9          , },
+/* x = 8.6         */  {7.35619331217806141e-6          , 6.83128675184426702e-6          , 3.18719583318966154e-6          , 9.95560381002814086e-7          , 2.34113938408949727e-7          , 4.41919563475512374e-8          , 6.9726242877450297e-9           , 9.45569734597305376e-10         , },
+/* x = 8.7         */  {6.70396401129798624e-6          , 6.22279962503356463e-6          , 2.90214289910373183e-6          , 9.06197796280674836e-7          , 2.13031531521831639e-7          , 4.02007998477205918e-8          , 6.34124234358370133e-9          , 8.59742711680357501e-10         , },
+/* x = 8.8         */  {6.10982018739081997e-6          , 5.66872457883789875e-6          , 2.64267277825434788e-6          , 8.24881391547487773e-7          , 1.93852929263529715e-7          , 3.65710083894102006e-8          , 5.76716352964913408e-9          , 7.81722190610731824e-10         , },
+/* x = 8.9         */  {5.5685686011707796e-6           , 5.16417899808935481e-6          , 2.40648231561322498e-6          , 7.50884662202048689e-7          , 1.76405777759752534e-7          , 3.32697884660381704e-8          , 5.24517625859411321e-9          , 7.10796766830969238e-10         , },
+/* x = 9.0         */  {5.07548195291059833e-6          , 4.70471977681416567e-6          , 2.1914762865647104e-6           , 6.8354686763096654e-7           , 1.6053336246586346e-7           , 3.0267328783877722e-8           , 4.77054383261204548e-9          , 6.46319979781703108e-10         , },
+/* x = 9.1         */  {4.62625694659682859e-6          , 4.28630364397556244e-6          , 1.99574857694600136e-6          , 6.222670644233094e-7            , 1.46093186074309787e-7          , 2.75365285408761788e-8          , 4.33896109432596752e-9          , 5.87704374556996608e-10         , },
+/* x = 9.2         */  {4.21697613913851274e-6          , 3.90525107976009085e-6          , 1.81756507045083033e-6          , 5.66498682096751619e-7          , 1.3295567598322148e-7           , 2.50527505068727854e-8          , 3.94651504113587679e-9          , 5.34416107365550678e-10         , },
+/* x = 9.3         */  {3.84407323211871011e-6          , 3.55821349670396649e-6          , 1.65534808817465649e-6          , 5.15744591913492348e-7          , 1.2100300950141466e-7           , 2.27935966377644724e-8          , 3.5896490400944768e-9           , 4.85970044929082361e-10         , },
+/* x = 9.4         */  {3.50430149464475348e-6          , 3.24214338956396967e-6          , 1.50766223921857535e-6          , 4.6955262387446382e-7           , 1.10128046046025121e-7          , 2.0738704163782482e-8           , 3.26513031366109096e-9          , 4.4192531252823126e-10          , },
+/* x = 9.5         */  {3.19470503409568781e-6          , 2.95426718474855835e-6          , 1.37320155411808993e-6          , 4.27511491078311427e-7          , 1.00233356571015857e-7          , 1.88695602806202003e-8          , 2.97002039690753174e-9          , 4.01881249564440473e-10         , },
+/* x = 9.6         */  {2.91259265724129323e-6          , 2.69206054458537236e-6          , 1.25077778453950882e-6          , 3.89247084355051394e-7          , 9.12303413569240886e-8          , 1.71693337434413434e-8          , 2.70164829419901248e-9          , 3.65473735282122635e-10         , },
+/* x = 9.7         */  {2.65551408755012444e-6          , 2.45322590393469106e-6          , 1.13930976329818608e-6          , 3.54419103467479827e-7          , 8.30384281026787279e-8          , 1.56227218193849178e-8          , 2.4575860883028065e-9           , 3.32371850724237036e-10         , },
+/* x = 9.8         */  {2.42123832572650096e-6          , 2.23567203686783456e-6          , 1.03781372839642613e-6          , 3.22717994247460631e-7          , 7.55843429966133423e-8          , 1.42158111955103354e-8          , 2.23562677751886839e-9          , 3.02274846108104914e-10         , },
+/* x = 9.9         */  {2.20773395981137614e-6          , 2.0374954694995515e-6           , 9.45394523543065968e-7          , 2.93862163827446422e-7          , 6.88014481127200945e-8          , 1.29359515675014853e-8          , 2.03376413699030497e-9          , 2.74909385635869963e-10         , },
+/* x = 10.0        */  {2.01315124872491564e-6          , 1.85696357176183449e-6          , 8.61237595581850794e-7          , 2.67595448665680999e-7          , 6.26291390859108129e-8          , 1.17716407510609435e-8          , 1.85017441902834186e-9          , 2.50027044321792398e-10         , },
+/* x = 10.1        */  {1.83580581907885119e-6          , 1.69249917608575199e-6          , 7.84601716494718496e-7          , 2.43684812369834622e-7          , 5.70122975721795689e-8          , 1.0712420263854152e-8           , 1.68319972424963573e-9          , 2.27402033750445851e-10         , },
+/* x = 10.2        */  {1.6741638295891342e-6           , 1.54266658475626458e-6          , 7.14812364225310602e-7          , 2.21918252419536353e-7          , 5.19007935011898427e-8          , 9.74878042208846016e-9          , 1.53133289073084638e-9          , 2.06829135797564516e-10         , },
+/* x = 10.3        */  {1.52682847060577975e-6          , 1.40615884024844544e-6          , 6.51255702547673788e-7          , 2.02102896792650867e-7          , 4.7249032584564221e-8           , 8.87207408322351546e-9          , 1.39320376237924224e-9          , 1.88121825268462881e-10         , },
+/* x = 10.4        */  {1.39252767826674907e-6          , 1.28178614425639785e-6          , 5.93373105639939212e-7          , 1.84063273230696255e-7          , 4.30155449572369937e-8          , 8.0744382457159728e-9           , 1.26756671042856017e-9          , 1.71110564155508046e-10         , },
+/* x = 10.5        */  {1.27010295368504748e-6          , 1.16846532149237089e-6          , 5.40656177962495014e-7          , 1.67639735451407884e-7          , 3.91626112054560824e-8          , 7.34872278883698214e-9          , 1.15328929351423101e-9          , 1.55641251802304397e-10         , },
+/* x = 10.6        */  {1.15849918749178416e-6          , 1.06521023375754501e-6          , 4.92642224529982056e-7          , 1.5268703204555966e-7           , 3.56559223768565801e-8          , 6.68842570113213126e-9          , 1.04934195226843862e-9          , 1.41573816702796697e-10         , },
+/* x = 10.7        */  {1.05675539907261503e-6          , 9.711230583535057e-7            , 4.48910130747396044e-7          , 1.39073005093874217e-7          , 3.24642708786221474e-8          , 6.0876342056259544e-9           , 9.54788643900483288e-10         , 1.28780936971798026e-10         , },
+/* x = 10.8        */  {9.63996308032451752e-7          , 8.85386352692527102e-7          , 4.09076614689970578e-7          , 1.26677406720103515e-7          , 2.95592694519622971e-8          , 5.54097124395668403e-9          , 8.68778330879820593e-10         , 1.17146877711658743e-10         , },
+/* x = 10.9        */  {8.79424662877812227e-7          , 8.07255834046318191e-7          , 3.72792818078236639e-7          , 1.15390822868965847e-7          , 2.69150956675607876e-8          , 5.04354683076105563e-9          , 7.9053724569808204e-10          , 1.06566434578948649e-10         , },
+/* x = 11.0        */  {8.0231425868519762e-7           , 7.36053809811247415e-7          , 3.39741205264499535e-7          , 1.0511369457241893e-7           , 2.45082596196524224e-8          , 4.59091383426726874e-9          , 7.19361860825127864e-10         , 9.69439738351480879e-11         , },
+/* x = 11.1        */  {7.32003581688750008e-7          , 6.71163199521789295e-7          , 3.09632742332925939e-7          , 9.57554278536659647e-8          , 2.23173927081058072e-8          , 4.1790277796086341e-9           , 6.54612499458822115e-10         , 8.81925600555343193e-11         , },
+/* x = 11.2        */  {6.67890024326936127e-7          , 6.12022095166224457e-7          , 2.82204330947917372e-7          , 8.72335842234494798e-8          , 2.03230555902749255e-8          , 3.80421030821516331e-9          , 5.95707528558770218e-10         , 8.02331634789693003e-11         , },
+/* x = 11.3        */  {6.09424619386803422e-7          , 5.58118811197819016e-7          , 2.57216473887566088e-7          , 7.9473144454961043e-8           , 1.85075635592012972e-8          , 3.46311596011522677e-9          , 5.42118081005221073e-10         , 7.29939397156465588e-11         , },
+/* x = 11.4        */  {5.56107246521542593e-7          , 5.08987380034750118e-7          , 2.34451151291739286e-7          , 7.24058389887835679e-8          , 1.68548277636074973e-8          , 3.15270197639308229e-9          , 4.93363258585204676e-10         , 6.64095751968503446e-11         , },
+/* x = 11.5        */  {5.07482268634552735e-7          , 4.64203452842867453e-7          , 2.13709888556795429e-7          , 6.59695389237744773e-8          , 1.53502108294813259e-8          , 2.87020084668091612e-9          , 4.49005771923701445e-10         , 6.04206923566057316e-11         , },
+/* x = 11.6        */  {4.63134559459018979e-7          , 4.23380569033282916e-7          , 1.94811998538438597e-7          , 6.01077020992231271e-8          , 1.39803955742336698e-8          , 2.61309535167068292e-9          , 4.08647977489042444e-10         , 5.4973309085370871e-11          , },
+/* x = 11.7        */  {4.22685887150794643e-7          , 3.8616676121475279e-7           , 1.77592982296517198e-7          , 5.47688692729998772e-8          , 1.2733265623626425e-8           , 2.37909587344277448e-9          , 3.7192827544589356e-10          , 5.00183474957428873e-11         , },
+/* x = 11.8        */  {3.85791621885600039e-7          , 3.52241465348844842e-7          , 1.61903074044988662e-7          , 4.99062058543228548e-8          , 1.15977968500038519e-8          , 2.16611976713547544e-9          , 3.38517835439750844e-10         , 4.55111874941487494e-11         , },
+/* x = 11.9        */  {3.52137738337818319e-7          , 3.21312708591221767e-7          , 1.47605917269812248e-7          , 4.54770850623503451e-8          , 1.05639586488153437e-8          , 1.97227260631210475e-9          , 3.08117620404447251e-10         , 4.14112610648779018e-11         , },
+/* x = 12.0        */  {3.21438086543495579e-7          , 2.93114549789796207e-7          , 1.34577360159021399e-7          , 4.14427087568313622e-8          , 9.62262415989276801e-9          , 1.79583113149502966e-9          , 2.80455681216514569e-10         , 3.76816835474039864e-11         , },
+/* x = 12.1        */  {2.93431907038185513e-7          , 2.67404749872539742e-7          , 1.22704359563410426e-7          , 3.77677625279393531e-8          , 8.76548862126162756e-9          , 1.63522774688482429e-9          , 2.55284697502581518e-10         , 3.42889185282071236e-11         , },
+/* x = 12.2        */  {2.6788156833251818e-7           , 2.43962651414827912e-7          , 1.1188398368291303e-7           , 3.44201019422863962e-8          , 7.9849951171675536e-9           , 1.48903642441174819e-9          , 2.32379742161228062e-10         , 3.120247327739574e-11           , },
+/* x = 12.3        */  {2.44570506764365602e-7          , 2.22587248546981906e-7          , 1.02022504561727382e-7          , 3.13704671237955939e-8          , 7.27426704916518074e-9          , 1.35595988710535833e-9          , 2.11536249209663403e-10         , 2.83946219411982248e-11         , },
+/* x = 12.4        */  {2.23301350563996838e-7          , 2.03095430064038754e-7          , 9.30345722826201041e-8          , 2.85922231041673395e-8          , 6.62704672016041749e-9          , 1.23481795543445622e-9          , 1.92568166427148457e-10         , 2.58401539564474194e-11         , },
+/* x = 12.5        */  {2.03894211603821737e-7          , 1.85320380147120809e-7          , 8.48424634849504757e-8          , 2.60611236104458121e-8          , 6.03763947677841337e-9          , 1.12453695087091438e-9          , 1.75306275958406944e-10         , 2.35161453848741111e-11         , },
+/* x = 12.6        */  {1.86185129791908956e-7          , 1.69110122513058888e-7          , 7.73753974984593052e-8          , 2.37550961687973165e-8          , 5.50086290585591938e-9          , 1.02414006056460912e-9          , 1.59596667576952414e-10         , 2.14017510755017078e-11         , },
+/* x = 12.7        */  {1.70024656421790274e-7          , 1.5432619508885752e-7           , 7.05689139918199438e-8          , 2.16540465959801491e-8          , 5.01200062668960273e-9          , 9.32738575771178672e-10         , 1.45299350704461574e-10         , 1.94780157546387438e-11         , },
+/* x = 12.8        */  {1.55276564022277892e-7          , 1.4084244347172628e-7           , 6.43643065868560399e-8          , 1.97396811248687682e-8          , 4.56676026233039037e-9          , 8.49523924629992929e-10         , 1.32286992550909068e-10         , 1.77277023166658081e-11         , },
+/* x = 12.9        */  {1.41816671371170809e-7          , 1.28543922494239039e-7          , 5.87081073911946264e-8          , 1.79953445693855324e-8          , 4.16123521107894728e-9          , 7.73760427119575592e-10         , 1.20443770892827662e-10         , 1.61351357466136615e-11         , },
+/* x = 13.0        */  {1.29531773355855345e-7          , 1.17325896177269801e-7          , 5.35516178584912903e-8          , 1.64058730787382167e-8          , 3.79186987375500445e-9          , 7.04778706588086831e-10         , 1.09664331054382323e-10         , 1.46860612488871727e-11         , },
+/* x = 13.1        */  {1.18318666291047666e-7          , 1.07092927229368911e-7          , 4.88504818003697391e-8          , 1.4957460162276003e-8           , 3.45542802359787531e-9          , 6.41969698227612121e-10         , 9.98528376075857362e-11         , 1.33675152867289383e-11         , },
+/* x = 13.2        */  {1.08083260147589213e-7          , 9.77580480480776892e-8          , 4.4564296751618066e-8           , 1.36375347857558029e-8          , 3.14896403409284987e-9          , 5.84779200287652995e-10         , 9.09221121726920021e-11         , 1.2167708355339256e-11          , },
+/* x = 13.3        */  {9.87397699138427698e-8          , 8.92420059035070068e-8          , 4.06562602333934984e-8          , 1.24346504484407749e-8          , 2.86979670586784358e-9          , 5.32702918755111802e-10         , 8.27928494855376486e-11         , 1.10759184190673819e-11         , },
+/* x = 13.4        */  {9.02099790097170989e-8          , 8.14725756438489343e-8          , 3.70928477713107194e-8          , 1.13383842492208652e-8          , 2.6154854573026032e-9           , 4.85281960710389224e-10         , 7.53929046125794171e-11         , 1.00823940407544194e-11         , },
+/* x = 13.5        */  {8.24225683089186e-8             , 7.43839338622806754e-8          , 3.38435198091478644e-8          , 1.03392450397482928e-8          , 2.38380866485329352e-9          , 4.42098735643021238e-10         , 6.86566448431690129e-11         , 9.1782663200414842e-12          , },
+/* x = 13.6        */  {7.53125049033708754e-8          , 6.79160890103490049e-8          , 3.08804549170642326e-8          , 9.42858984423448518e-9          , 2.17274395851319219e-9          , 4.02773227712867972e-10         , 6.25243603781678429e-11         , 8.35546883807606741e-12         , },
+/* x = 13.7        */  {6.88204852700244766e-8          , 6.20143624392941666e-8          , 2.81783069280165289e-8          , 8.59854779980014738e-9          , 1.9804502954825094e-9           , 3.66959605308116691e-10         , 5.69417284697552096e-11         , 7.60666487929784658e-12         , },
+/* x = 13.8        */  {6.28924279791988157e-8          , 5.66289158023427727e-8          , 2.57139838496059476e-8          , 7.84195093878046116e-9          , 1.80525165116787308e-9          , 3.3434313731006275e-10          , 5.18593261541411589e-11         , 6.92518126753749501e-12         , },
+/* x = 13.9        */  {5.74790115194304087e-8          , 5.17143206618233571e-8          , 2.34664465928137936e-8          , 7.15227119577508393e-9          , 1.6456221812209476e-9           , 3.04637388254759279e-10         , 4.72321871613294044e-11         , 6.30494821413135665e-12         , },
+/* x = 14.0        */  {5.25352532104336847e-8          , 4.72291665187218996e-8          , 2.14165257357406036e-8          , 6.52356307805408593e-9          , 1.50017272158881599e-9          , 2.77581667108595156e-10         , 4.30193989881465513e-11         , 5.7404446306980195e-12          , },
+/* x = 14.1        */  {4.80201255367483487e-8          , 4.31357038223496894e-8          , 1.95467547011456664e-8          , 5.95041148869201491e-9          , 1.36763850560686635e-9          , 2.52938706671765299e-10         , 3.9183736486149654e-11          , 5.22664840914562747e-12         , },
+/* x = 14.2        */  {4.38962065631667716e-8          , 3.93995188271902768e-8          , 1.78412178727385234e-8          , 5.42788423796263694e-9          , 1.24686798812768463e-9          , 2.30492552711421171e-10         , 3.56913286480958427e-11         , 4.75899121684065213e-12         , },
+/* x = 14.3        */  {4.01293613920313991e-8          , 3.59892374454977001e-8          , 1.62854123081179714e-8          , 4.95148882050445387e-9          , 1.13681267664656593e-9          , 2.10046643824099182e-10         , 3.25113555784495849e-11         , 4.3333173960871283e-12          , },
+/* x = 14.4        */  {3.66884518946265767e-8          , 3.28762555003552027e-8          , 1.48661218271842693e-8          , 4.51713307394169233e-9          , 1.03651787844632152e-9          , 1.91422064752145341e-10         , 2.96157729076808295e-11         , 3.94584659451912926e-12         , },
+/* x = 14.5        */  {3.35450721965819143e-8          , 3.00344930169644968e-8          , 1.35713023648549188e-8          , 4.12108936936238283e-9          , 9.45114281023425119e-10         , 1.74455957447028697e-10         , 2.69790611593835033e-11         , 3.59313978704287362e-12         , },
+/* x = 14.6        */  {3.06733076226570878e-8          , 2.74401704020048417e-8          , 1.23899775769830303e-8          , 3.75996201562827344e-9          , 8.61810290549049495e-10         , 1.59000075597968888e-10         , 2.45779978058014826e-11         , 3.27206838089112684e-12         , },
+/* x = 14.7        */  {2.80495150114936838e-8          , 2.5071604553874631e-8           , 1.1312143779409562e-8           , 3.43065758820597332e-9          , 7.85885059930212002e-10         , 1.44919469640193432e-10         , 2.23914499532623261e-11         , 2.97978612345564381e-12         , },
+/* x = 14.8        */  {2.56521224977203269e-8          , 2.29090231222299702e-8          , 1.03286833828946357e-8          , 3.13035791932427324e-9          , 7.16682144229896915e-10         , 1.32091290435200587e-10         , 2.0400185786172171e-11          , 2.71370355810143018e-12         , },
+/* x = 14.9        */  {2.34614470288404256e-8          , 2.0934395295033008e-8           , 9.43128606201250895e-9          , 2.85649551001483219e-9          , 6.53603726836841254e-10         , 1.2040370088636787e-10          , 1.85867030683304229e-11         , 2.47146479637407537e-12         , },
+/* x = 15.0        */  {2.14595280391253247e-8          , 1.91312776367437509e-8          , 8.61237696463592498e-9          , 2.60673114619670811e-9          , 5.96105364896730416e-10         , 1.09754885726869217e-10         , 1.69350731549358249e-11         , 2.25092639610135774e-12         , },
+/* x = 15.1        */  {1.96299758436513274e-8          , 1.7484673633629927e-8           , 7.86505133099348068e-9          , 2.37893352061441851e-9          , 5.43691207173269029e-10         , 1.00052150602009865e-10         , 1.54307991091896498e-11         , 2.0501381540562678e-12          , },
+/* x = 15.2        */  {1.79578334439050209e-8          , 1.59809057226099954e-8          , 7.18301494801756261e-9          , 2.17116068031150569e-9          , 4.95909641742163662e-10         , 9.12111023728131768e-11         , 1.40606866451413855e-11         , 1.86732563926635124e-12         , },
+/* x = 15.3        */  {1.64294505531731473e-8          , 1.46074986896577737e-8          , 6.56052991631884155e-9          , 1.98164313557802056e-9          , 4.52349334771828206e-10         , 8.31549032993188468e-11         , 1.28127267345343218e-11         , 1.70087430888356258e-12         , },
+/* x = 15.4        */  {1.5032368756264028e-8           , 1.33530734235594934e-8          , 5.99236525408872509e-9          , 1.80876848109736206e-9          , 4.12635625146460159e-10         , 7.58135924272306269e-11         , 1.16759888209532236e-11         , 1.54931506291474864e-12         , },
+/* x = 15.5        */  {1.37552168149173047e-8          , 1.22072501016132796e-8          , 5.47375190496408387e-9          , 1.65106739346865443e-9          , 3.76427242871724093e-10         , 6.91234681063305669e-11         , 1.06405236805172601e-11         , 1.41131110718728124e-12         , },
+/* x = 15.6        */  {1.25876152184027761e-8          , 1.11605599665047297e-8          , 5.00034175577142821e-9          , 1.50720088151635835e-9          , 3.43413322099421473e-10         , 6.30265261189512277e-11         , 9.69727505557404103e-12         , 1.28564600580700009e-12         , },
+/* x = 15.7        */  {1.15200891590656433e-8          , 1.02043649288151305e-8          , 4.56817030544831738e-9          , 1.37594867692915226e-9          , 3.13310682241407456e-10         , 5.74699483967619136e-11         , 8.8379992671305128e-12          , 1.17121281516532763e-12         , },
+/* x = 15.8        */  {1.05439891856526529e-8          , 9.33078429808921105e-9          , 4.17362265863443634e-9          , 1.25619866289535639e-9          , 2.85861353038437242e-10         , 5.24056377587190132e-11         , 8.05519208382650591e-12         , 1.06700420136804154e-12         , },
+/* x = 15.9        */  {9.6514188537958285e-9           , 8.53262800771515604e-9          , 3.81340254672114313e-9          , 1.14693724761329075e-9          , 2.60830321628224562e-10         , 4.77897945163797374e-11         , 7.34202219077380269e-12         , 9.72103451879562893e-13         , },
+/* x = 16.0        */  {8.83516875362406054e-9          , 7.80333575560398023e-9          , 3.48450410580800056e-9          , 1.04724059793469237e-9          , 2.38003481638442883e-10         , 4.35825311686327386e-11         , 6.69227066114467213e-12         , 8.85676300285352021e-13         , },
+/* x = 16.1        */  {8.08865634965138303e-9          , 7.13692153430145016e-9          , 3.18418616527581286e-9          , 9.56266656022894142e-10         , 2.1718576613257782e-10          , 3.97475217496665391e-11         , 6.10027588754137381e-12         , 8.06963490445250515e-13         , },
+/* x = 16.2        */  {7.40587111833987753e-9          , 6.52792307118128698e-9          , 2.9099488227644145e-9           , 8.73247868843292307e-10         , 1.98199447875703639e-10         , 3.62516827047752571e-11         , 5.56088347940514801e-12         , 7.3527401300974407e-13          , },
+/* x = 16.3        */  {6.7813245144967124e-9           , 5.97135574216985988e-9          , 2.65951210143675152e-9          , 7.97484566613905216e-10         , 1.80882591878186982e-10         , 3.30648824512065733e-11         , 5.06940067747769482e-12         , 6.69978953360362853e-13         , },
+/* x = 16.4        */  {6.21000433934101677e-9          , 5.46267056141887822e-9          , 2.43079650369770247e-9          , 7.28338932085115551e-10         , 1.65087646531453384e-10         , 3.01596770382486529e-11         , 4.62155487701724568e-12         , 6.10505895570409973e-13         , },
+/* x = 16.5        */  {5.68733312103310986e-9          , 4.99771588481844869e-9          , 2.22190529217946358e-9          , 6.65229507741429416e-10         , 1.50680160883503027e-10         , 2.75110695544572886e-11         , 4.21345588846506349e-12         , 5.56333832013456741e-13         , },
+/* x = 16.6        */  {5.20913015302917291e-9          , 4.57270249754193895e-9          , 2.03110834395330811e-9          , 6.07626192771054284e-10         , 1.37537616723937741e-10         , 2.50962911424565931e-11         , 3.84156159789284777e-12         , 5.06988532820492414e-13         , },
+/* x = 16.7        */  {4.77157686711194721e-9          , 4.18417178522177246e-9          , 1.85682743771487396e-9          , 5.5504568597383244e-10          , 1.25548365168959721e-10         , 2.28946016750284424e-11         , 3.50264672014269095e-12         , 4.62038333543998023e-13         , },
+/* x = 16.8        */  {4.37118524662841848e-9          , 3.82896671513124752e-9          , 1.69762284623941075e-9          , 5.07047334713252611e-10         , 1.14610658365305054e-10         , 2.08871083219849955e-11         , 3.19377436537669194e-12         , 4.21090303166450086e-13         , },
+/* x = 16.9        */  {4.00476901158987658e-9          , 3.50420537812801451e-9          , 1.55218111782613276e-9          , 4.63229353599082342e-10         , 1.04631767776729747e-10         , 1.90566003971834649e-11         , 2.91227016503553401e-12         , 3.83786758026309807e-13         , },
+/* x = 17.0        */  {3.66941733108684291e-9          , 3.20725686431496743e-9          , 1.41930394084841078e-9          , 4.23225379845614232e-10         , 9.552718128506317e-11           , 1.7387399020436917e-11          , 2.65569872619371999e-12         , 3.49802090357730441e-13         , },
+/* x = 17.1        */  {3.36247084014924265e-9          , 2.93571926558966204e-9          , 1.29789799499127136e-9          , 3.86701335215701341e-10         , 8.72198720368850769e-11         , 1.58652202613119746e-11         , 2.42184220420227329e-12         , 3.1883988297947555e-13          , },
+/* x = 17.2        */  {3.08149975793029825e-9          , 2.68739961666200612e-9          , 1.18696570137350356e-9          , 3.53352567159138096e-10         , 7.96396326028436595e-11         , 1.44770505520772591e-11         , 2.20868080251710304e-12         , 2.90630284249742953e-13         , },
+/* x = 17.3        */  {2.82428392208337909e-9          , 2.46029560288390088e-9          , 1.08559679159497349e-9          , 3.22901244209595576e-10         , 7.27224685952196293e-11         , 1.32110332664601907e-11         , 2.01437502589518283e-12         , 2.64927619750232845e-13         , },
+/* x = 17.4        */  {2.58879457059144169e-9          , 2.25257887850119496e-9          , 9.92960622889997972e-10         , 2.95093982939139333e-10         , 6.64100464157444532e-11         , 1.20563654603706782e-11         , 1.83724952885779958e-12         , 2.41508219296239893e-13         , },
+/* x = 17.5        */  {2.3731777172416452e-9           , 2.06257985284193243e-9          , 9.08299173068046805e-10         , 2.69699685803259021e-10         , 6.06491902846181261e-11         , 1.10032038612550234e-11         , 1.67577841561273512e-12         , 2.20168439809195886e-13         , },
+/* x = 17.6        */  {2.17573898054333252e-9          , 1.8887738146175581e-9           , 8.30920654841142187e-10         , 2.46507571060436594e-10         , 5.53914241374343409e-11         , 1.00425792750672814e-11         , 1.52857186062473067e-12         , 2.00722866351580166e-13         , },
+/* x = 17.7        */  {1.99492973828427784e-9          , 1.72976827604663623e-9          , 7.60193694525436288e-10         , 2.25325377635050834e-10         , 5.05925543732107655e-11         , 9.16631865472961192e-12         , 1.39436393084356388e-12         , 1.83002675227479199e-13         , },
+/* x = 17.8        */  {1.82933449121575718e-9          , 1.58429142901490227e-9          , 6.9554202501018643e-10          , 2.05977729325848572e-10         , 4.62122897974880312e-11         , 8.36697414207172309e-12         , 1.2720015013484481e-12          , 1.66854144509883047e-13         , },
+/* x = 17.9        */  {1.67765932964978804e-9          , 1.451181615053177e-9            , 6.36439647354036846e-10         , 1.88304644157941076e-10         , 4.22138954327302264e-11         , 7.6377584572051148e-12          , 1.16043416594342526e-12         , 1.52137298681295641e-13         , },
+/* x = 18.0        */  {1.53872140613120567e-9          , 1.32937771962963345e-9          , 5.82406419435577913e-10         , 1.7216017594671011e-10          , 3.85638771669671557e-11         , 6.97248606565758025e-12         , 1.05870505312931183e-12         , 1.3872467527944175e-13          , },
+/* x = 18.1        */  {1.41143932589449839e-9          , 1.21791040919140045e-9          , 5.33004033788459698e-10         , 1.57411176298414527e-10         , 3.52316944834336548e-11         , 6.36551960487390438e-12         , 9.6594246596387958e-13          , 1.26500202535713778e-13         , },
+/* x = 18.2        */  {1.29482437460463361e-9          , 1.11589413662195049e-9          , 4.87832350123528719e-10         , 1.43936166324938666e-10         , 3.21894987613114967e-11         , 5.81172109834050822e-12         , 8.81352271676317543e-13         , 1.15358177990457097e-13         , },
+/* x = 18.3        */  {1.18797250997996207e-9          , 1.02251984736835606e-9          , 4.46526051111239038e-10         , 1.31624308308355648e-10         , 2.94118948627728594e-11         , 5.306407528033759e-12           , 8.04210973590998481e-13         , 1.05202338975279127e-13         , },
+/* x = 18.4        */  {1.09005705036515216e-9          , 9.37048324493848245e-10         , 4.08751592793992545e-10         , 1.20374468423286712e-10         , 2.68757239263691457e-11         , 4.84531037450464044e-12         , 7.33859403999500917e-13         , 9.59450166764974326e-14         , },
+/* x = 18.5        */  {1.00032199921894708e-9          , 8.58804116378546907e-10         , 3.74204423544688137e-10         , 1.10094362419150168e-10         , 2.45598654732317034e-11         , 4.42453876904276763e-12         , 6.69696982153571435e-13         , 8.75063662430807114e-14         , },
+/* x = 18.6        */  {9.18075949856325754e-10         , 7.87169995772439121e-10         , 3.42606447806992763e-10         , 1.00699776887341971e-10         , 2.24450571022130548e-11         , 4.04054593432525355e-12         , 6.11176486585122875e-13         , 7.98136660837689254e-14         , },
+/* x = 18.7        */  {8.4268651968380127e-10          , 7.21581903443067325e-10         , 3.13703712965063648e-10         , 9.21138593965712753e-11         , 2.05137302045097655e-11         , 3.69009861903706553e-12         , 5.57799295537793633e-13         , 7.28006801176527401e-14         , },
+/* x = 18.8        */  {7.7357526763238491e-10          , 6.61524333795473113e-10         , 2.87264299614193505e-10         , 8.42664713788094999e-11         , 1.87498602688456191e-11         , 3.37024925840967549e-12         , 5.09111053459264987e-13         , 6.64070773059542787e-14         , },
+/* x = 18.9        */  {7.10213052563680878e-10         , 6.06526123609705982e-10         , 2.63076397255996394e-10         , 7.70935981938961444e-11         , 1.7138830476206661e-11          , 3.07831061670083851e-12         , 4.64697725291927609e-13         , 6.0577903305177247e-14          , },
+/* x = 19.0        */  {6.52115794135726579e-10         , 5.56156608474408479e-10         , 2.40946549037661803e-10         , 7.05368112975977841e-11         , 1.56673073995452934e-11         , 2.81183268954561348e-12         , 4.24182003745683003e-13         , 5.52630995478174387e-14         , },
+/* x = 19.1        */  {5.98840600998496274e-10         , 5.10022114623456902e-10         , 2.2069805060846012e-10          , 6.45427778902230243e-11         , 1.43231277298435856e-11         , 2.56858166404314202e-12         , 3.87220037871645418e-13         , 5.04170654806557775e-14         , },
+/* x = 19.2        */  {5.49982234273536873e-10         , 4.67762756733528406e-10         , 2.02169489490809902e-10         , 5.90628138347455302e-11         , 1.30951950463874984e-11         , 2.34652075258337177e-12         , 3.53498454107447708e-13         , 4.59982600761237368e-14         , },
+/* x = 19.3        */  {5.05169877084505317e-10         , 4.29049514838510152e-10         , 1.85213412569400393e-10         , 5.405247600841023e-11           , 1.19733857369100375e-11         , 2.14379273292486569e-12         , 3.22731643559367871e-13         , 4.1968839082815465e-14          , },
+/* x = 19.4        */  {4.6406418346956861e-10          , 3.93581565884381855e-10         , 1.69695110400645911e-10         , 4.94711905932982602e-11         , 1.09484632531913792e-11         , 1.95870404205643576e-12         , 2.94659291646874634e-13         , 3.82943248000861101e-14         , },
+/* x = 19.5        */  {4.26354582344701746e-10         , 3.61083847606094881e-10         , 1.5549150804573088e-10          , 4.52819141223107179e-11         , 1.00119999604664009e-11         , 1.78971028504560175e-12         , 2.69044128382621492e-13         , 3.49433054516980308e-14         , },
+/* x = 19.6        */  {3.91756814318909832e-10         , 3.31304834374711545e-10         , 1.42490153042423289e-10         , 4.14508243802359074e-11         , 9.15630590522950183e-12         , 1.63540303251770484e-12         , 2.45669879514659264e-13         , 3.1887161497270747e-14          , },
+/* x = 19.7        */  {3.60010681106560136e-10         , 3.040145064556623e-10           , 1.3058829196164477e-10          , 3.79470385174795192e-11         , 8.37436388632968848e-12         , 1.49449779173177721e-12         , 2.24339400535201832e-13         , 2.90998164602340208e-14         , },
+/* x = 19.8        */  {3.30877989054965935e-10         , 2.79002495752912209e-10         , 1.19692027751729105e-10         , 3.47423559689281971e-11         , 7.65977026914927583e-12         , 1.36582304652383597e-12         , 2.04872977177595268e-13         , 2.65575100692377925e-14         , },
+/* x = 19.9        */  {3.04140669922266785e-10         , 2.56076392603205288e-10         , 1.09715550762970599e-10         , 3.18110239843466757e-11         , 7.0066810326427919e-12          , 1.24831027076686674e-12         , 1.871067774946907e-13           , 2.42385917085029782e-14         , },
+/* x = 20.0        */  {2.79599063515302485e-10         , 2.35060199542221102e-10         , 1.00580436973461869e-10         , 2.912952377155421e-11           , 6.40976258452055145e-12         , 1.14098482853283556e-12         , 1.70891441950777632e-13         , 2.21233323531900625e-14         , },
+/* x = 20.1        */  {2.57070348142157704e-10         , 2.15792919202131745e-10         , 9.22150075098121304e-11         , 2.66763754310958624e-11         , 5.86414692129587837e-12         , 1.04295768191152223e-12         , 1.56090799177575536e-13         , 2.01937533301425053e-14         , },
+/* x = 20.2        */  {2.36387106060821086e-10         , 1.98127264628344895e-10         , 8.45537440780977693e-11         , 2.44319600227733849e-11         , 5.36539074764187687e-12         , 9.53417834512854055e-13         , 1.42580696153401268e-13         , 1.84334703938062905e-14         , },
+/* x = 20.3        */  {2.17396012224399365e-10         , 1.81928481331866115e-10         , 7.75367553958575519e-11         , 2.23783572516443758e-11         , 4.90943820385581309e-12         , 8.71625445116548947e-13         , 1.30247932573435613e-13         , 1.68275517430784916e-14         , },
+/* x = 20.4        */  {1.9995663564406977e-10          , 1.67073271331552005e-10         , 7.11092901492303606e-11         , 2.04991973952254643e-11         , 4.49258688150943846e-12         , 7.96905551792393963e-13         , 1.18989290097014987e-13         , 1.5362388728517707e-14          , },
+/* x = 20.5        */  {1.83940343622114644e-10         , 1.53448810295608726e-10         , 6.52212923942003973e-11         , 1.87795262158182647e-11         , 4.11145683584756914e-12         , 7.28642352148373715e-13         , 1.08710647993269123e-13         , 1.40255781118680173e-14         , },
+/* x = 20.6        */  {1.69229299956863905e-10         , 1.40951849671354028e-10         , 5.98269956807838478e-11         , 1.72056817131833016e-11         , 3.76296232943573715e-12         , 6.66273990219416006e-13         , 9.93261774666663904e-14         , 1.28058148422154574e-14         , },
+/* x = 20.7        */  {1.55715548996376208e-10         , 1.29487896403188625e-10         , 5.48845525069769983e-11         , 1.57651816741888664e-11         , 3.44428606517899045e-12         , 6.0928780492976597e-13          , 9.07576076358948038e-14         , 1.16927944062300163e-14         , },
+/* x = 20.8        */  {1.43300178124782875e-10         , 1.18970463487002928e-10         , 5.03556960082253589e-11         , 1.44466210684435347e-11         , 3.15285568834565377e-12         , 5.57215999086080286e-13         , 8.29335567691651743e-14         , 1.06771238946818099e-14         , },
+/* x = 20.9        */  {1.31892551910383082e-10         , 1.09320385200424847e-10         , 4.62054310606497689e-11         , 1.32395784230882434e-11         , 2.88632235682110935e-12         , 5.09631691521865402e-13         , 7.5788922952082287e-14          , 9.75024100451655809e-15         , },
+/* x = 21.0        */  {1.21409611733267625e-10         , 1.0046519138744719e-10          , 4.24017522246314105e-11         , 1.21345303866096678e-11         , 2.64254119665945996e-12         , 4.66145318349272666e-13         , 6.92643288857922633e-14         , 8.90434026592329032e-15         , },
+/* x = 21.1        */  {1.11775235247432985e-10         , 9.23385356676636806e-11         , 3.89153861817558438e-11         , 1.11227737614086923e-11         , 2.4195534762518821e-12          , 4.26401352310992952e-13         , 6.33056159878202943e-14         , 8.13230584765420421e-15         , },
+/* x = 21.2        */  {1.02919650522558377e-10         , 8.48796728887861203e-11         , 3.57195565244981273e-11         , 1.0196354348523858e-11          , 2.21557034723208135e-12         , 3.90075311989891056e-13         , 5.78633834000842271e-14         , 7.42765035193383185e-15         , },
+/* x = 21.3        */  {9.47789001579867723e-11         , 7.80329815501344429e-11         , 3.27897689461743034e-11         , 9.34800200592314908e-12         , 2.02895801372124183e-12         , 3.56871035151496477e-13         , 5.28925679018462455e-14         , 6.7844590631414521e-15          , },
+/* x = 21.4        */  {8.72943510697418921e-11         , 7.17475272978697421e-11         , 3.01036150502080174e-11         , 8.57107137464224671e-12         , 1.85822420379528909e-12         , 3.26518192786734299e-13         , 4.83520610833405144e-14         , 6.19733916253931824e-15         , },
+/* x = 21.5        */  {8.04122460240600738e-11         , 6.59766639330518918e-11         , 2.7640593154139531e-11          , 7.85948777522219425e-12         , 1.70200582824363091e-12         , 2.98770022509550053e-13         , 4.42043604616671397e-14         , 5.66137346507930221e-15         , },
+/* x = 21.6        */  {7.40832933310482149e-11         , 6.06776686840407718e-11         , 2.53819446063812236e-11         , 7.2076978208020627e-12          , 1.55905772187863253e-12         , 2.73401261864748532e-13         , 4.04152515171632441e-14         , 5.17207827414266389e-15         , },
+/* x = 21.7        */  {6.82622914225505442e-11         , 5.58114087779593751e-11         , 2.33105042637225541e-11         , 6.61062433323308155e-12         , 1.42824237193797385e-12         , 2.50206263832166247e-13         , 3.69535178984806068e-14         , 4.72536498630716719e-15         , },
+/* x = 21.8        */  {6.29077853217194162e-11         , 5.13420366043006127e-11         , 2.14105638961231306e-11         , 6.06362518504622478e-12         , 1.30852054657879017e-12         , 2.28997278389462517e-13         , 3.37906772904090612e-14         , 4.3175051112158713e-15          , },
+/* x = 21.9        */  {5.79817522705111619e-11         , 4.72367109994769426e-11         , 1.96677473934205592e-11         , 5.56245572334087813e-12         , 1.19894274416691408e-12         , 2.09602885431206888e-13         , 3.09007406622627665e-14         , 3.94509840163658594e-15         , },
+/* x = 22.0        */  {5.34493140175305278e-11         , 4.34653423961786173e-11         , 1.80688967471453189e-11         , 5.10323446195525083e-12         , 1.09864139108379569e-12         , 1.91866565649176374e-13         , 2.82599928183733248e-14         , 3.60504381611757573e-15         , },
+/* x = 22.1        */  {4.92784734842991243e-11         , 4.0000359777641246e-11          , 1.66019678705209565e-11         , 4.68241175589127099e-12         , 1.00682372216894551e-12         , 1.75645397169336142e-13         , 2.58467923577116694e-14         , 3.29451306150684247e-15         , },
+/* x = 22.2        */  {4.54398737249235753e-11         , 3.68164975559844352e-11         , 1.52559354017023992e-11         , 4.29674119713610459e-12         , 9.22765283742702543e-13         , 1.6080886682531166e-13          , 2.36413893185294575e-14         , 3.01092648523043773e-15         , },
+/* x = 22.3        */  {4.1906577273928375e-11          , 3.38906006571817308e-11         , 1.40207057100678951e-11         , 3.94325349396618976e-12         , 8.45804004463478448e-13         , 1.4723778593577961e-13          , 2.16257589376623392e-14         , 2.75193110782100453e-15         , },
+/* x = 22.4        */  {3.86538641411931295e-11         , 3.12014462443355769e-11         , 1.28870373935685864e-11         , 3.61923261673544759e-12         , 7.75334784111525072e-13         , 1.34823301352765815e-13         , 1.97834500941295363e-14         , 2.5153806049341812e-15          , },
+/* x = 22.5        */  {3.56590468628586286e-11         , 2.87295806470153497e-11         , 1.18464686173349667e-11         , 3.32219401221716284e-12         , 7.10804554799747115e-13         , 1.23465993367220291e-13         , 1.80994471341319489e-14         , 2.29931706515415403e-15         , },
+/* x = 22.6        */  {3.29013011539858425e-11         , 2.64571701886166309e-11         , 1.08912507004708772e-11         , 3.0498647059529171e-12          , 6.51707773129401543e-13         , 1.13075052804614378e-13         , 1.65600438906186137e-14         , 2.10195436542201533e-15         , },
+/* x = 22.7        */  {3.03615108338019023e-11         , 2.4367864717059518e-11          , 1.00142874097156762e-11         , 2.80016512791128848e-12         , 5.97582305469536965e-13         , 1.035675303232011e-13           , 1.51527288162816587e-14         , 1.92166302005948981e-15         , },
+/* x = 22.8        */  {2.8022125808583134e-11          , 2.24466727476145818e-11         , 9.20907946586341503e-12         , 2.57119251120988226e-12         , 5.48005671875459824e-13         , 9.48676515469402754e-14         , 1.38660802450837878e-14         , 1.75695637223141958e-15         , },
+/* x = 22.9        */  {2.58670320015521044e-11         , 2.06798472210947296e-11         , 8.46967381189493126e-12         , 2.36120572683059005e-12         , 5.02591617202264124e-13         , 8.69061922293240432e-14         , 1.26896708850668812e-14         , 1.60647800840721616e-15         , },
+/* x = 23.0        */  {2.38814322144653507e-11         , 1.90547809668708799e-11         , 7.7906172310698797e-12          , 2.16861142927271837e-12         , 4.60986980740840287e-13         , 7.96199081583712455e-14         , 1.16139807250064348e-14         , 1.46899028704807905e-15         , },
+/* x = 23.1        */  {2.20517369926273889e-11         , 1.75599110388803793e-11         , 7.16691393907366761e-12         , 1.99195139904466329e-12         , 4.2286883822974894e-13          , 7.29510149813736168e-14         , 1.06303176101658584e-14         , 1.34336388245756774e-15         , },
+/* x = 23.2        */  {2.0365464644602183e-11          , 1.61846311646573402e-11         , 6.59398680702237837e-12         , 1.82989097788586615e-12         , 3.87941892398729648e-13         , 6.68467135546546602e-14         , 9.73074480860565143e-15         , 1.22856825357400597e-15         , },
+/* x = 23.3        */  {1.88111496405601369e-11         , 1.49192116130234345e-11         , 6.06764190197354202e-12         , 1.68120850172226472e-12         , 3.55936090298287808e-13         , 6.12587568123592446e-14         , 8.90801494979628668e-15         , 1.12366295553236228e-15         , },
+/* x = 23.4        */  {1.73782586795941577e-11         , 1.3754725845983215e-11          , 5.58403605882406241e-12         , 1.54478564466816101e-12         , 3.26604447582866277e-13         , 5.61430545025115274e-14         , 8.15550977219920892e-15         , 1.02778971915181034e-15         , },
+/* x = 23.5        */  {1.60571137770074867e-11         , 1.26829833750687047e-11         , 5.13964722232847309e-12         , 1.41959859496625796e-12         , 2.99721061659048682e-13         , 5.14593124613410316e-14         , 7.46718516649909222e-15         , 9.40165230177843325e-16         , },
+/* x = 23.6        */  {1.48388217780161811e-11         , 1.16964682923288268e-11         , 4.73124732065038935e-12         , 1.30470999067017035e-12         , 2.75079297200075248e-13         , 4.71707033909861746e-14         , 6.83752104673059647e-15         , 8.60074546183484511e-16         , },
+/* x = 23.7        */  {1.37152097549742792e-11         , 1.0788282991775313e-11          , 4.35587745255846891e-12         , 1.19926154917885581e-12         , 2.52490128977357359e-13         , 4.32435663736949098e-14         , 6.26147562304316807e-15         , 7.86865094566387406e-16         , },
+/* x = 23.8        */  {1.26787657915340428e-11         , 9.95209663875658607e-12         , 4.01082518926944268e-12         , 1.10246733048378005e-12         , 2.31780628281113198e-13         , 3.96471325998786524e-14         , 5.73444368765100067e-15         , 7.19941200116212851e-16         , },
+/* x = 23.9        */  {1.17225846994753382e-11         , 9.18209798278009719e-12         , 3.69360380918351421e-12         , 1.01360757923610899e-12         , 2.12792580407062861e-13         , 3.63532750099556666e-14         , 5.25221855995259354e-15         , 6.58759095213981655e-16         , },
+/* x = 24.0        */  {1.08403182526222846e-11         , 8.4729521440567227e-12          , 3.40193329949633436e-12         , 9.32023095527358038e-13         , 1.95381221784656241e-13         , 3.333627975277166e-14           , 4.81095736817626104e-15         , 6.02822369902509688e-16         , },
+/* x = 24.1        */  {1.00261295576267661e-11         , 7.81976103578545298e-12         , 3.13372297303875416e-12         , 8.57110088643323988e-13         , 1.79414086323978897e-13         , 3.05726375482642817e-14         , 4.40714937348832488e-15         , 5.51677822871286556e-16         , },
+/* x = 24.2        */  {9.27465121372480863e-12         , 7.21802711319491443e-12         , 2.88705556181093001e-12         , 7.8831547203478101e-13          , 1.64769951471870652e-13         , 2.80408532105434902e-14         , 4.03758706853887927e-15         , 5.04911677863703337e-16         , },
+/* x = 24.3        */  {8.58094694312565601e-12         , 6.66362016684943634e-12         , 2.66017266065078675e-12         , 7.25132561383064187e-13         , 1.51337875300715715e-13         , 2.57212717411475293e-14         , 3.69933980614293521e-15         , 4.62146133169806638e-16         , },
+/* x = 24.4        */  {7.94047640071428104e-12         , 6.15274690192964247e-12         , 2.45146140540835714e-12         , 6.67097140955031326e-13         , 1.39016316712943873e-13         , 2.35959195422307077e-14         , 3.38972973540906652e-15         , 4.23036214741457718e-16         , },
+/* x = 24.5        */  {7.34906289645481009e-12         , 5.68192306731003438e-12         , 2.25944227997832602e-12         , 6.13783866468006165e-13         , 1.27712331537008682e-13         , 2.16483594270521566e-14         , 3.10630984232153258e-15         , 3.8726690608411951e-16          , },
+/* x = 24.6        */  {6.80286378647468775e-12         , 5.24794791846043319e-12         , 2.08275795565639982e-12         , 5.64802975446704263e-13         , 1.17340837922393053e-13         , 1.986355822146432e-14           , 2.84684390972653436e-15         , 3.54550530463429419e-16         , },
+/* x = 24.7        */  {6.29834330946974777e-12         , 4.84788081666026028e-12         , 1.92016307460676509e-12         , 5.19797278574109506e-13         , 1.0782394501742247e-13          , 1.82277658561481146e-14         , 2.60928822802473181e-15         , 3.24624363136129447e-16         , },
+/* x = 24.8        */  {5.8322476639652384e-12          , 4.47901978388576836e-12         , 1.77051489682709048e-12         , 4.78439407838029163e-13         , 9.90903394392503025e-14         , 1.67284049460211176e-14         , 2.39177490277241755e-15         , 2.972484532928299e-16           , },
+/* x = 24.9        */  {5.40158213924936295e-12         , 4.13888184814856499e-12         , 1.63276473693737901e-12         , 4.40429299373958389e-13         , 9.10747245247916007e-14         , 1.53539699413871449e-14         , 2.19259661897211016e-15         , 2.72203637201784834e-16         , },
+/* x = 25.0        */  {5.00359012860293202e-12         , 3.82518502815512384e-12         , 1.50595012345706305e-12         , 4.05491890820572179e-13         , 8.37173077886977782e-14         , 1.40939350157574278e-14         , 2.01019273420753992e-15         , 2.49289725684109932e-16         , },
+/* x = 25.1        */  {4.63573386790813337e-12         , 3.53583181903647567e-12         , 1.38918761902356638e-12         , 3.73375014752717743e-13         , 7.69633324133997461e-14         , 1.29386699285451049e-14         , 1.84313658405526926e-15         , 2.28323850546017065e-16         , },
+/* x = 25.2        */  {4.29567675594706316e-12         , 3.268894052669898e-12           , 1.28166624529304448e-12         , 3.43847471352867964e-13         , 7.07626489601868679e-14         , 1.18793631676443495e-14         , 1.6901238934831539e-15          , 2.0913895595572886e-16          , },
+/* x = 25.3        */  {3.98126712480235237e-12         , 3.02259901687601229e-12         , 1.18264146109385675e-12         , 3.16697264938988411e-13         , 6.50693238223192576e-14         , 1.09079517378256293e-14         , 1.54996219731342298e-15         , 1.91582421993655481e-16         , },
+/* x = 25.4        */  {3.69052333984462736e-12         , 2.79531672761272962e-12         , 1.09142964681539682e-12         , 2.91729990296859112e-13         , 5.98412812441036851e-14         , 1.00170570164309181e-14         , 1.42156118136631021e-15         , 1.75514808734983678e-16         , },
+/* x = 25.5        */  {3.42162011892296566e-12         , 2.58554825728182244e-12         , 1.00740305204558547e-12         , 2.68767355979196224e-13         , 5.50399760062619999e-14         , 9.19992614851233079e-15         , 1.30392386368264752e-15         , 1.60808710253895044e-16         , },
+/* x = 25.6        */  {3.17287596964561631e-12         , 2.39191503048744858e-12         , 9.29985167152806524e-13         , 2.47645832842577103e-13         , 5.06300941301219418e-14         , 8.45037849975756877e-15         , 1.1961385423178011e-15          , 1.47347708877163896e-16         , },
+/* x = 25.7        */  {2.94274165212274809e-12         , 2.21314900610528155e-12         , 8.58646482872625548e-13         , 2.2821541710543158e-13          , 4.65792791832932112e-14         , 7.76275672768022311e-15         , 1.09737144266595777e-15         , 1.35025420870050292e-16         , },
+/* x = 25.8        */  {2.7297895823082066e-12          , 2.0480836713967842e-12          , 7.92900605033908085e-13         , 2.10338498134655431e-13         , 4.28578819794980826e-14         , 7.13188206998180538e-15         , 1.00686000316877269e-15         , 1.23744625516634211e-16         , },
+/* x = 25.9        */  {2.53270409818472897e-12         , 1.89564578019109894e-12         , 7.32300694368168837e-13         , 1.93888822012420311e-13         , 3.94387316568754543e-14         , 6.55301348404288473e-15         , 9.23906743636515759e-16         , 1.13416470266801796e-16         , },
+/* x = 26.0        */  {2.35027251754300658e-12         , 1.75484777290769125e-12         , 6.76436203913148069e-13         , 1.78750542705512825e-13         , 3.6296926293983407e-14          , 6.02181030347134006e-15         , 8.47873665309328965e-16         , 1.03959745269157008e-16         , },
+/* x = 26.1        */  {2.18137692206077946e-12         , 1.62478082145255343e-12         , 6.24929888867731116e-13         , 1.64817353363432731e-13         , 3.34096413823590049e-14         , 5.53429810679845479e-15         , 7.78177136253136291e-16         , 9.53002211988042478e-17         , },
+/* x = 26.2        */  {2.02498660784074483e-12         , 1.5046084468317137e-12          , 5.77435065899570121e-13         , 1.5199169091435296e-13          , 3.07559546201962424e-14         , 5.08683752001622787e-15         , 7.14283219757489778e-16         , 8.73700448263399283e-17         , },
+/* x = 26.3        */  {1.88015114755838175e-12         , 1.39356066172660252e-12         , 5.33633100866630691e-13         , 1.40184007715216738e-13         , 2.83166856246964201e-14         , 4.67609569891771712e-15         , 6.55703407116129839e-16         , 8.01071872641572934e-17         , },
+/* x = 26.4        */  {1.74599401394205678e-12         , 1.29092859430175645e-12         , 4.93231105705340339e-13         , 1.29312104548576525e-13         , 2.60742492820446595e-14         , 4.29902025934231882e-15         , 6.01990719557118153e-16         , 7.34549402725470525e-17         , },
+/* x = 26.5        */  {1.62170671849383559e-12         , 1.19605955319859309e-12         , 4.55959826875638465e-13         , 1.1930051974869697e-13          , 2.40125215647883019e-14         , 3.95281544362723547e-15         , 5.52736147177066448e-16         , 6.73614564149259891e-17         , },
+/* x = 26.6        */  {1.50654342319305818e-12         , 1.10835249703898333e-12         , 4.21571709250327166e-13         , 1.10079969686992395e-13         , 2.21167167475645228e-14         , 3.63492032999599096e-15         , 5.07565395549655182e-16         , 6.17793292223615929e-17         , },
+/* x = 26.7        */  {1.39981598643590117e-12         , 1.02725387484595065e-12         , 3.89839120704847328e-13         , 1.01586836255736817e-13         , 2.03732750444909482e-14         , 3.34298890843058237e-15         , 4.66135913246384228e-16         , 5.66652098655840872e-17         , },
+/* x = 26.8        */  {1.30088940768024418e-12         , 9.52253806610590582e-13         , 3.60552723915047004e-13         , 9.37626973625369224e-14         , 1.87697597758652487e-14         , 3.07487186191778239e-15         , 4.28134175849255598e-16         , 5.1979457140803562e-17          , },
+/* x = 26.9        */  {1.20917763821122376e-12         , 8.8288257581665502e-13          , 3.33519983014795834e-13         , 8.65538967893664525e-14         , 1.72947632488206362e-14         , 2.82859990596173079e-15         , 3.93273204170840002e-16         , 4.7685817856534786e-17          , },
+/* x = 27.0        */  {1.12413972814179816e-12         , 8.18707408097678545e-13         , 3.08563793811676798e-13         , 7.99111500818266311e-14         , 1.59378206068950823e-14         , 2.60236855203233542e-15         , 3.61290296345133988e-16         , 4.37511349646944066e-17         , },
+/* x = 27.1        */  {1.04527628223540222e-12         , 7.593295123647617e-13           , 2.85521227215898028e-13         , 7.37891834192786458e-14         , 1.46893309676777147e-14         , 2.39452417227976408e-15         , 3.31944955229365244e-16         , 4.01450810126778058e-17         , },
+/* x = 27.2        */  {9.7212619940349397e-13          , 7.04381362723280167e-13         , 2.64242376412722753e-13         , 6.81464026769247429e-14         , 1.35404852263296307e-14         , 2.20355125348756649e-15         , 3.05016994177570854e-16         , 3.6839914705952717e-17          , },
+/* x = 27.3        */  {9.04263672806998519e-13         , 6.5352420130949525e-13          , 2.44589299109155652e-13         , 6.29445901289240233e-14         , 1.24831999563248443e-14         , 2.02806073795017067e-15         , 2.80304805725135986e-16         , 3.38102585647519137e-17         , },
+/* x = 27.4        */  {8.4129542939335956e-13          , 6.06445743837590383e-13         , 2.26435046917779174e-13         , 5.81486264591616081e-14         , 1.15100568876640697e-14         , 1.86677935782621001e-15         , 2.57623779072095912e-16         , 3.10328958353731861e-17         , },
+/* x = 27.5        */  {7.82858189444767742e-13         , 5.62858071167111311e-13         , 2.09662774610376646e-13         , 5.37262359451198266e-14         , 1.0614247487484421e-14          , 1.71853987761171572e-15         , 2.3680485348331679e-16          , 2.84865849779185186e-17         , },
+/* x = 27.6        */  {7.28616328311551602e-13         , 5.22495691592082104e-13         , 1.94164922586674338e-13         , 4.96477528620471222e-14         , 9.78952220879121747e-15         , 1.58227216676446078e-15         , 2.17693195846110518e-16         , 2.61518901994079746e-17         , },
+/* x = 27.7        */  {6.78259723969952976e-13         , 4.85113759827117382e-13         , 1.79842466464081934e-13         , 4.58859073207629513e-14         , 9.03014401031090794e-15         , 1.45699503125449137e-15         , 2.00146991649912709e-16         , 2.40110266353464697e-17         , },
+/* x = 27.8        */  {6.31501775386783276e-13         , 4.50486439832628428e-13         , 1.6660422820718569e-13          , 4.24156289043247552e-14         , 8.33084578451409416e-15         , 1.34180873897251214e-15         , 1.84036339587025394e-16         , 2.20477189051505772e-17         , },
+/* x = 27.9        */  {5.88077577905033866e-13         , 4.18405399689846639e-13         , 1.54366243685039959e-13         , 3.92138666076482984e-14         , 7.68679136196525846e-15         , 1.23588817954871534e-15         , 1.69242240825995417e-16         , 2.02470718784030234e-17         , },
+/* x = 28.0        */  {5.47742242993785233e-13         , 3.8867842771519954e-13          , 1.43051181973746071e-13         , 3.62594237111402561e-14         , 7.09353978857703268e-15         , 1.13847660426675151e-15         , 1.55655674787165152e-16         , 1.85954525906469739e-17         , },
+/* x = 28.1        */  {5.10269350741320123e-13         , 3.61128159900195577e-13         , 1.32587812114815625e-13         , 3.35328063354990291e-14         , 6.54701259831523769e-15         , 1.04887989644359222e-15         , 1.43176753959856929e-16         , 1.70803823402283751e-17         , },
+/* x = 28.2        */  {4.75449524420060766e-13         , 3.35590909584374616e-13         , 1.22910513399506608e-13         , 3.10160845310042307e-14         , 6.04346382762960254e-15         , 9.66461326925036867e-16         , 1.31713950948519074e-16         , 1.56904380823332658e-17         , },
+/* x = 28.3        */  {4.43089117323018247e-13         , 3.11915591021435619e-13         , 1.13958825578544519e-13         , 2.86927648517035176e-14         , 5.57945253956853642e-15         , 8.90636753254138213e-16         , 1.21183391526424072e-16         , 1.44151623135686609e-17         , },
+/* x = 28.4        */  {4.13009002870451846e-13         , 2.89962729188190618e-13         , 1.05677035698000862e-13         , 2.65476734536994688e-14         , 5.15181764535207716e-15         , 8.20870224638313399e-16         , 1.11508208015140341e-16         , 1.32449807108570059e-17         , },
+/* x = 28.5        */  {3.85043459718418968e-13         , 2.69603548817846022e-13         , 9.80137985379774078e-14         , 2.45668488379532522e-14         , 4.75765482928718032e-15         , 7.56669958099966318e-16         , 1.0261794780053215e-16          , 1.21711268526536911e-17         , },
+/* x = 28.6        */  {3.59039144273373103e-13         , 2.5071913621815456e-13          , 9.09217878833110983e-14         , 2.27374434323081073e-14         , 4.39429539946170589e-15         , 6.97584654172073094e-16         , 9.44480322456106964e-17         , 1.11855734091000935e-17         , },
+/* x = 28.7        */  {3.34854143633993017e-13         , 2.3319966796567401e-13          , 8.43573760867592066e-14         , 2.10476332753899625e-14         , 4.05928690178276996e-15         , 6.43200123219005802e-16         , 8.69392616709322975e-17         , 1.02809692411880944e-17         , },
+/* x = 28.8        */  {3.12357102547628657e-13         , 2.1694370105379219e-13          , 7.82803395968638839e-14         , 1.94865351272089259e-14         , 3.7503753487547543e-15          , 5.93136195946360864e-16         , 8.00373624478535814e-17         , 9.45058189778903462e-18         , },
+/* x = 28.9        */  {2.91426418488365937e-13         , 2.01857519518064003e-13         , 7.26535883165903812e-14         , 1.80441303881609869e-14         , 3.46548892703467003e-15         , 5.47043893932218557e-16         , 7.36925725919423665e-17         , 8.68824504390350092e-18         , },
+/* x = 29.0        */  {2.71949499440623833e-13         , 1.87854532971170429e-13         , 6.74429168364020358e-14         , 1.67111952601680774e-14         , 3.20272305936042064e-15         , 5.04602838084793446e-16         , 6.78592625560642624e-17         , 7.98831039409455378e-18         , },
+/* x = 29.1        */  {2.53822079409956932e-13         , 1.74854722854575669e-13         , 6.26167757480654942e-14         , 1.54792366313114669e-14         , 2.96032670701453565e-15         , 4.65518874824908888e-16         , 6.24955882077250894e-17         , 7.34560376211905838e-18         , },
+/* x = 29.2        */  {2.36947587084599314e-13         , 1.6278413255758599e-13          , 5.81460613944404755e-14         , 1.4340433208887251e-14          , 2.73668980864772742e-15         , 4.29521901521714814e-16         , 5.75631732355247486e-17         , 6.75538487158239009e-18         , },
+/* x = 29.3        */  {2.21236563440232718e-13         , 1.51574397869618486e-13         , 5.40039225469598692e-14         , 1.32875814656896759e-14         , 2.53033176012129578e-15         , 3.96363874290777252e-16         , 5.30268184672368834e-17         , 6.2133106032960252e-18          , },
+/* x = 29.4        */  {2.06606124419223967e-13         , 1.41162314520464036e-13         , 5.01655826275089815e-14         , 1.23140460008245777e-14         , 2.33989084810631632e-15         , 3.65816982708068406e-16         , 4.88542357990476503e-17         , 5.71540138317528147e-18         , },
+/* x = 29.5        */  {1.92979465126655415e-13         , 1.31489439828367512e-13         , 4.66081762059374089e-14         , 1.14137139497603899e-14         , 2.16411455756584828e-15         , 3.37671977313311977e-16         , 4.50158046336695036e-17         , 5.25801044021266974e-18         , },
+/* x = 29.6        */  {1.80285402271159692e-13         , 1.22501725718855361e-13         , 4.33105986093705281e-14         , 1.05809531089021327e-14         , 2.00185068000358349e-15         , 3.11736636982390791e-16         , 4.14843489060370131e-17         , 4.83779568751696704e-18         , },
+/* x = 29.7        */  {1.68457951840966145e-13         , 1.14149180600251983e-13         , 4.02533675756413393e-14         , 9.81057346796598309e-15         , 1.8520391555427631e-15          , 2.87834364350960331e-16         , 3.82349329405918693e-17         , 4.45169400081616953e-18         , },
+/* x = 29.8        */  {1.57435939246595651e-13         , 1.06385557786422453e-13         , 3.74184959712795472e-14         , 9.09779186905904861e-15         , 1.71370458755243865e-15         , 2.65802898479030256e-16         , 3.52446745351421911e-17         , 4.09689768836350322e-18         , },
+/* x = 29.9        */  {1.47162639383066108e-13         , 9.91680683449986919e-14         , 3.47893746752521331e-14         , 8.43819953483250655e-15         , 1.58594937370957234e-15         , 2.45493134867289358e-16         , 3.24925738041857637e-17         , 3.77083296402339847e-18         , },
+/* x = 30.0        */  {1.3758544426790931e-13          , 9.24571164215979994e-14         , 3.23506648036692686e-14         , 7.82773222956064562e-15         , 1.46794740211645856e-15         , 2.26768043777854655e-16         , 2.99593564405571468e-17         , 3.47114025159807862e-18         , },
+/* x = 30.1        */  {1.28655556098232216e-13         , 8.62160552486167358e-14         , 3.00881985185193214e-14         , 7.26264283667205312e-15         , 1.35893826542132173e-15         , 2.09501678581766475e-16         , 2.76273301693341059e-17         , 3.19565616332132356e-18         , },
+/* x = 30.2        */  {1.20327703741839854e-13         , 8.04109621922591168e-14         , 2.79888877256966776e-14         , 6.73947615427626275e-15         , 1.25822194985025023e-15         , 1.93578266559176449e-16         , 2.54802532730678924e-17         , 2.94239700901820997e-18         , },
+/* x = 30.3        */  {1.12559880835317972e-13         , 7.50104313246232895e-14         , 2.60406400246116826e-14         , 6.25504572673043429e-15         , 1.16515395968242364e-15         , 1.78891375221488542e-16         , 2.35032141634498615e-17         , 2.70954370482143247e-18         , },
+/* x = 30.4        */  {1.0531310380709227e-13          , 6.99853821299048036e-14         , 2.42322813239583515e-14         , 5.80641254540482626e-15         , 1.07914084101671463e-15         , 1.65343147812922888e-16         , 2.16825210622833758e-17         , 2.49542796164944459e-18         , },
+/* x = 30.5        */  {9.85511882768841124e-14         , 6.53088830659987112e-14         , 2.2553484586160798e-14          , 5.3908654656506683e-15          , 9.99636071712541828e-16         , 1.52843602186833602e-16         , 2.00056009348154467e-17         , 2.29851964398331453e-18         , },
+/* x = 30.6        */  {9.2240542405629435e-14          , 6.09559888058170697e-14         , 2.09947042069880051e-14         , 5.00590319965718488e-15         , 9.26136287165389409e-16         , 1.41309987743967289e-16         , 1.84609068917546668e-17         , 2.11741519891377449e-18         , },
+/* x = 30.7        */  {8.63499758826981059e-14         , 5.69035900772500431e-14         , 1.95471155771521348e-14         , 4.64921775650440402e-15         , 8.58177814119688001e-16         , 1.3066619556966387e-16          , 1.70378333432607942e-17         , 1.95082706404581656e-18         , },
+/* x = 30.8        */  {8.08505233409523038e-14         , 5.31302751075837614e-14         , 1.82025594096933197e-14         , 4.3186792113650271e-15          , 7.95333487048872355e-16         , 1.20842217318396799e-16         , 1.57266382493845521e-17         , 1.7975739707168295e-18          , },
+/* x = 30.9        */  {7.57152810855547284e-14         , 4.96162017579857964e-14         , 1.6953490450883233e-14          , 4.0123216955643725e-15          , 7.37209723762763888e-16         , 1.11773648770332886e-16         , 1.45183718673637095e-17         , 1.65657206617088376e-18         , },
+/* x = 31.0        */  {7.09192561101596947e-14         , 4.63429795069652857e-14         , 1.57929302235065123e-14         , 3.72833050814754393e-15         , 6.83443838852760499e-16         , 1.03401234328783143e-16         , 1.34048114472995759e-17         , 1.5268267848958399e-18          , },
+/* x = 31.1        */  {6.64392264548152955e-14         , 4.32935605090461161e-14         , 1.47144234799374944e-14         , 3.46503025779639817e-15         , 6.3370157537099785e-16          , 9.56704490422742199e-17         , 1.23784013744631907e-17         , 1.40742540532574345e-18         , },
+/* x = 31.2        */  {6.22536120341443863e-14         , 4.04521390167501036e-14         , 1.37119980686341433e-14         , 3.22087395144860984e-15         , 5.87674836774702592e-16         , 8.85311150230150742e-17         , 1.1432198299192906e-17          , 1.29753023358798815e-18         , },
+/* x = 31.3        */  {5.83423551326805468e-14         , 3.78040585108236372e-14         , 1.27801279417178408e-14         , 2.99443295285480017e-15         , 5.45079602664211207e-16         , 8.19370493970673121e-17         , 1.05598208343918446e-17         , 1.19637236097814944e-18         , },
+/* x = 31.4        */  {5.46868098270936646e-14         , 3.53357259358690757e-14         , 1.19136990533766558e-14         , 2.78438774062005501e-15         , 5.05654013214300175e-16         , 7.58457411626532264e-17         , 9.75540343633172892e-18         , 1.10324594641642808e-18         , },
+/* x = 31.5        */  {5.12696396528899986e-14         , 3.30345324865401684e-14         , 1.11079779190854596e-14         , 2.58951940106146038e-15         , 4.69156608454280749e-16         , 7.02180545536739187e-17         , 9.01355411710813596e-18         , 1.01750297931590808e-18         , },
+/* x = 31.6        */  {4.80747228864188975e-14         , 3.08887804335762403e-14         , 1.03585826242296038e-14         , 2.40870179651768969e-15         , 4.35364709702552797e-16         , 6.50179567074163606e-17         , 8.32931566693547196e-18         , 9.38548482108640996e-19         , },
+/* x = 31.7        */  {4.5087064862034854e-14          , 2.88876155195013194e-14         , 9.66145608778794458e-15         , 2.24089435461059319e-15         , 4.04072931514946055e-16         , 6.02122676202065192e-17         , 7.69813009175908111e-18         , 8.65836115162238911e-19         , },
+/* x = 31.8        */  {4.22927167893908768e-14         , 2.70209644910937944e-14         , 9.01284140240229976e-15         , 2.08513542841914662e-15         , 3.75091813471395911e-16         , 5.57704305438811536e-17         , 7.11580599661713906e-18         , 7.98864150005769563e-19         , },
+/* x = 31.9        */  {3.96787005773908585e-14         , 2.52794773700073793e-14         , 8.40925908654986608e-15         , 1.9405361816168588e-15          , 3.48246562009796097e-16         , 5.16643011307426609e-17         , 6.57848866800746008e-18         , 7.37171779695384505e-19         , },
+/* x = 32.0        */  {3.72329392095926968e-14         , 2.36544740944407249e-14         , 7.84748609774888277e-15         , 1.80627495637579498e-15         , 3.23375893326093756e-16         , 4.78679537763531356e-17         , 6.08263262938773902e-18         , 6.8033573781107994e-19          , },
+/* x = 32.1        */  {3.49441922510948068e-14         , 2.21378951937362112e-14         , 7.32453646786319903e-15         , 1.68159208528210174e-15         , 3.00330969102109531e-16         , 4.43575037392339673e-17         , 5.62497646302980174e-18         , 6.27967200008019675e-19         , },
+/* x = 32.2        */  {3.28019960993992107e-14         , 2.07222561844449306e-14         , 6.83764343271753034e-15         , 1.56578511166527853e-15         , 2.78974417502907891e-16         , 4.11109437352879881e-17         , 5.20251970891236152e-18         , 5.79708944268774054e-19         , },
+/* x = 32.3        */  {3.07966086216476632e-14         , 1.94006054009141723e-14         , 6.38424293847376743e-15         , 1.45820438564019714e-15         , 2.59179432509053751e-16         , 3.81079938134866555e-17         , 4.81250166731251448e-18         , 5.35232748034752614e-19         , },
+/* x = 32.4        */  {2.89189578481781634e-14         , 1.81664849960097675e-14         , 5.96195841662460059e-15         , 1.35824900581878161e-15         , 2.4082894522056626e-16          , 3.53299634189190016e-17         , 4.45238194637158189e-18         , 4.94237002252559156e-19         , },
+/* x = 32.5        */  {2.71605944177359474e-14         , 1.70138948683380269e-14         , 5.56858672810256202e-15         , 1.26536307908725253e-15         , 2.23814861293207127e-16         , 3.27596246404627547e-17         , 4.11982260928269154e-18         , 4.56444524069064146e-19         , },
+/* x = 32.6        */  {2.55136474930685936e-14         , 1.59372592914271221e-14         , 5.20208518494326893e-15         , 1.17903227308315497e-15         , 2.08037359147933105e-16         , 3.0381095723824815e-17          , 3.81267178798235959e-18         , 4.21600551461446047e-19         , },
+/* x = 32.7        */  {2.39707838871981146e-14         , 1.49313960379000163e-14         , 4.86055956523883078e-15         , 1.09878063806073684e-15         , 1.93404244034573239e-16         , 2.81797340071606135e-17         , 3.52894864142374535e-18         , 3.89470904507877314e-19         , },
+/* x = 32.8        */  {2.25251701605398876e-14         , 1.3991487807843779e-14          , 4.54225304382392534e-15         , 1.02416767671892731e-15         , 1.79830353434422009e-16         , 2.61420375065163608e-17         , 3.26682954675424791e-18         , 3.59840299302405783e-19         , },
+/* x = 32.9        */  {2.11704374673631964e-14         , 1.3113055785466523e-14          , 4.24553596730141834e-15         , 9.5478564229719811e-16          , 1.67237009656545105e-16         , 2.42555544424902745e-17         , 3.02463542109605377e-18         , 3.32510801704393952e-19         , },
+/* x = 33.0        */  {1.99006489469843917e-14         , 1.22919351618372222e-14         , 3.96889640768103906e-15         , 8.90257046833813429e-16         , 1.55551515821989892e-16         , 2.25088000582773631e-17         , 2.80082008020947107e-18         , 3.07300409198202316e-19         , },
+/* x = 33.1        */  {1.87102694706646176e-14         , 1.15242524741207018e-14         , 3.71093143411428486e-15         , 8.30232362940147971e-16         , 1.44706691741353767e-16         , 2.08911801331033694e-17         , 2.59395954817333329e-18         , 2.84041750131382581e-19         , },
+/* x = 33.2        */  {1.7594137569553955e-14          , 1.08064046233377572e-14         , 3.47033904699878372e-15         , 7.74387903784652245e-16         , 1.34640446476648376e-16         , 1.93929206443842131e-17         , 2.40274223940650736e-18         , 2.62580890507468089e-19         , },
+/* x = 33.3        */  {1.65474393822785632e-14         , 1.01350394433790824e-14         , 3.24591072313007759e-15         , 7.22423867210542485e-16         , 1.25295384640264498e-16         , 1.80050030771492547e-17         , 2.22595994093633701e-18         , 2.42776239339805323e-19         , },
+/* x = 33.4        */  {1.55656844729950965e-14         , 9.50703770385536592e-15         , 3.03652452462964239e-15         , 6.74062531041435388e-16         , 1.16618443724067033e-16         , 1.67191049206889122e-17         , 2.06249952884555121e-18         , 2.24497544332423613e-19         , },
+/* x = 33.5        */  {1.46446833820184053e-14         , 8.91949643844237325e-15         , 2.84113872810377939e-15         , 6.29046587667225209e-16         , 1.08560559972040981e-16         , 1.55275449303488287e-17         , 1.91133535834616958e-18         , 2.07624970348774638e-19         , },
+/* x = 33.6        */  {1.37805267815388602e-14         , 8.36971349874141784e-15         , 2.65878593391526027e-15         , 5.87137606956109714e-16         , 1.01076360512123606e-16         , 1.44232327671859342e-17         , 1.77152227198057064e-18         , 1.92048253764847259e-19         , },
+/* x = 33.7        */  {1.29695661185531412e-14         , 7.85517324137957021e-15         , 2.48856761860256498e-15         , 5.48114617414775195e-16         , 9.41238796484117493e-17         , 1.33996226600935284e-17         , 1.64218917507576316e-18         , 1.77665926384753906e-19         , },
+/* x = 33.8        */  {1.22083956360001271e-14         , 7.37353326317286726e-15         , 2.32964909638249931e-15         , 5.11772796323731639e-16         , 8.76642973852150745e-17         , 1.24506707642373696e-17         , 1.52253313181322561e-18         , 1.64384603129030783e-19         , },
+/* x = 33.9        */  {1.14938356712796253e-14         , 6.92261210571799053e-15         , 2.18125485834136219e-15         , 4.77922260314497831e-16         , 8.16616984107076625e-17         , 1.15707959164463288e-17         , 1.41181393915656041e-18         , 1.52118328192833337e-19         , },
+/* x = 34.0        */  {1.08229171388895554e-14         , 6.50037785680779058e-15         , 2.04266426037641899e-15         , 4.46386948535136509e-16         , 7.60828499113765212e-17         , 1.07548435127741147e-17         , 1.30934913943291603e-18         , 1.40787974816812742e-19         , },
+/* x = 34.1        */  {1.01928671108959667e-14         , 6.10493758162445891e-15         , 1.91320753321044866e-15         , 4.17003591175449274e-16         , 7.08969967201430591e-17         , 9.99805225598016878e-18         , 1.21450943561934052e-18         , 1.30320694221266519e-19         , },
+/* x = 34.2        */  {9.60109541539520128e-15         , 5.73452752178859879e-15         , 1.79226208988338197e-15         , 3.89620756697469011e-16         , 6.607567242191957e-17           , 9.29602354133946385e-18         , 1.12671447636725194e-18         , 1.20649409627399631e-19         , },
+/* x = 34.3        */  {9.04518217908024923e-15         , 5.38750400506740336e-15         , 1.67924910804104954e-15         , 3.64097971644869073e-16         , 6.15925251513524847e-17         , 8.64469326813947693e-18         , 1.04542898053019215e-18         , 1.11712351631165789e-19         , },
+/* x = 34.4        */  {8.52286624552222115e-15         , 5.06233501290231039e-15         , 1.57363036610513978e-15         , 3.40304907390335436e-16         , 5.74231569194176844e-17         , 8.04030588160163329e-18         , 9.70159173463135563e-19         , 1.03452631507882119e-19         , },
+/* x = 34.5        */  {8.03203440585819659e-15         , 4.75759235693501215e-15         , 1.4749053140328645e-15          , 3.18120628626298509e-16         , 5.3544975399121955e-17          , 7.4793904659054586e-18          , 9.00449509655217083e-19         , 9.58178493120912754e-20         , },
+/* x = 34.6        */  {7.57071138327099164e-15         , 4.47194441941735171e-15         , 1.38260836087078183e-15         , 2.97432898814885466e-16         , 4.99370571865172101e-17         , 6.95873872361684974e-18         , 8.35879658359529576e-19         , 8.87597338992388344e-20         , },
+/* x = 34.7        */  {7.13705051698456858e-15         , 4.20414941581007728e-15         , 1.29630636268505313e-15         , 2.78137538190458292e-16         , 4.65800216321813699e-17         , 6.47538469023743303e-18         , 7.76061730809821114e-19         , 8.22338122357017778e-20         , },
+/* x = 34.8        */  {6.72932509550845334e-15         , 3.9530491410303167e-15          , 1.21559629571959104e-15         , 2.60137830255332014e-16         , 4.34559144108399685e-17         , 6.02658604490077326e-18         , 7.2063772937931409e-19          , 7.619910558343049e-20           , },
+/* x = 34.9        */  {6.3459202925710326e-15          , 3.71756316371882172e-15         , 1.1401031008027991e-15          , 2.43343973028685145e-16         , 4.05481000634256392e-17         , 5.60980688953557444e-18         , 6.69277200655028961e-19         , 7.06178503466745266e-20         , },
+/* x = 35.0        */  {5.9853256626083691e-15          , 3.49668343558469191e-15         , 1.06947768610090752e-15         , 2.27672571602540424e-16         , 3.78411628070843457e-17         , 5.22270187918053471e-18         , 6.21675075884328839e-19         , 6.5455241552526331e-20          , },
+/* x = 35.1        */  {5.64612815584375943e-15         , 3.28946928536506369e-15         , 1.00339507630862588e-15         , 2.13046168829082771e-16         , 3.53208149648828797e-17         , 4.86310159564762594e-18         , 5.77549683610256511e-19         , 6.06791971057769265e-20         , },
+/* x = 35.2        */  {5.32700561592352945e-15         , 3.09504276922637404e-15         , 9.41552697282713841e-16         , 1.99392811212396474e-16         , 3.29738124186599377e-17         , 4.52899906546118747e-18         , 5.36640920558998034e-19         , 5.62601411131498862e-20         , },
+/* x = 35.3        */  {5.02672072578482557e-15         , 2.91258435154721801e-15         , 8.83668785967323778e-16         , 1.86645647306692358e-16         , 3.0787876535967297e-17          , 4.21853733101431589e-18         , 4.9870856798598041e-19          , 5.21708047135683805e-20         , },
+/* x = 35.4        */  {4.74411536993829084e-15         , 2.74132889197426191e-15         , 8.2948091623729577e-16          , 1.74742556133861672e-16         , 2.87516220657113997e-17         , 3.92999799124110463e-18         , 4.6353074173539272e-19          , 4.83860429808156362e-20         , },
+/* x = 35.5        */  {4.47810538366806765e-15         , 2.58056191644480367e-15         , 7.78744632002231297e-16         , 1.63625803327209162e-16         , 2.68544905372437032e-17         , 3.66179063485784993e-18         , 4.30902465229270893e-19         , 4.4882666583778403e-20          , },
+/* x = 35.6        */  {4.22767566179788573e-15         , 2.42961615153403513e-15         , 7.31232179574954333e-16         , 1.53241722886834916e-16         , 2.50866887345490595e-17         , 3.41244309542833337e-18         , 4.00634355483992403e-19         , 4.16392869983367232e-20         , },
+/* x = 35.7        */  {3.99187560165829653e-15         , 2.28786830302258218e-15         , 6.86731331917319633e-16         , 1.43540422596594251e-16         , 2.34391318511098206e-17         , 3.18059246320347327e-18         , 3.72551413060758372e-19         , 3.86361741647235267e-20         , },
+/* x = 35.8        */  {3.76981485672859899e-15         , 2.15473606100035001e-15         , 6.45044297938320898e-16         , 1.34475511304006943e-16         , 2.1903390962222102e-17          , 2.96497679391593274e-18         , 3.46491907598502686e-19         , 3.58551255755945857e-20         , },
+/* x = 35.9        */  {3.56065937912891104e-15         , 2.02967531513517523e-15         , 6.05986710537832617e-16         , 1.26003846403958135e-16         , 2.04716444802323718e-17         , 2.76442745951410146e-18         , 3.22306351258250734e-19         , 3.3279345863827754e-20          , },
+/* x = 36.0        */  {3.36362773071355044e-15         , 1.91217756494765571e-15         , 5.69386687567533602e-16         , 1.180852999954946e-16           , 1.91366332845515742e-17         , 2.57786209023244148e-18         , 2.99856553032372394e-19         , 3.08933360358547553e-20         , },
+/* x = 36.1        */  {3.17798764397596795e-15         , 1.80176751105450665e-15         , 5.35083960321776183e-16         , 1.1068254229935492e-16          , 1.78916192425777828e-17         , 2.40427806144877278e-18         , 2.79014747445121271e-19         , 2.86827915667087742e-20         , },
+/* x = 36.2        */  {3.00305281532675217e-15         , 1.69800081437897997e-15         , 5.02929064578297305e-16         , 1.03760841032891502e-16         , 1.67303468599889012e-17         , 2.24274648250325263e-18         , 2.59662791696616351e-19         , 2.66345086374862728e-20         , },
+/* x = 36.3        */  {2.8381799145578492e-15          , 1.6004620112848299e-15          , 4.72782589584397517e-16         , 9.72878755394917589e-17         , 1.56470078194120235e-17         , 2.09240664807568563e-18         , 2.41691425784933229e-19         , 2.47362978550654972e-20         , },
+/* x = 36.4        */  {2.6827657954656266e-15          , 1.50876257347604027e-15         , 4.44514480731008057e-16         , 9.12335645621697953e-17         , 1.46362081853805653e-17         , 1.95246091586224659e-18         , 2.24999590583829185e-19         , 2.29769048481487744e-20         , },
+/* x = 36.5        */  {2.53624489367970275e-15         , 1.42253910232360545e-15         , 4.18003391977194656e-16         , 8.55699066363080009e-17         , 1.36929380708871242e-17         , 1.82216997718249354e-18         , 2.09493799260126441e-19         , 2.13459371834143573e-20         , },
+},
+/* n = 24 */
+{
+/* x = 0.0         */  {0.0204081632653061224           , 0.019607843137254902            , 0.0094339622641509434           , 0.0030303030303030303           , 0.000730994152046783626         , 0.000141242937853107345         , 0.0000227686703096539162        , 3.14940791131267322e-6          , },
+/* x = 0.1         */  {0.0185387599806351692           , 0.0178091050758185923           , 0.00856735207697158286          , 0.00275158510252350811          , 0.000663680374332937893         , 0.000128222252145811021         , 0.0000206675496971003829        , 2.85849668719171065e-6          , },
+/* x = 0.2         */  {0.0168408365149205401           , 0.0161755903828115116           , 0.00778044555675654253          , 0.00249853164092152046          , 0.000602571711054155581         , 0.00011640307591881199          , 0.0000187605014833577515        , 2.59448019399334738e-6          , },
+/* x = 0.3         */  {0.0152986425122105417           , 0.0146921040276644611           , 0.00706590394097470982          , 0.00226877696155593734          , 0.000547095599426489941         , 0.000105674435190560738         , 0.0000170295844153985202        , 2.35486998762736135e-6          , },
+/* x = 0.4         */  {0.0138978760415047967           , 0.0133448499976196706           , 0.00641706490185243647          , 0.00206017365848311781          , 0.000496732357489040413         , 0.0000959356146809165035        , 0.0000154585171966137919        , 2.13740804554524738e-6          , },
+/* x = 0.5         */  {0.0126255502462298103           , 0.012121302352627282            , 0.00582788013567898013          , 0.00187077244488974506          , 0.000451010295874268633         , 0.0000870952086947172204        , 0.0000140325247860618007        , 1.94004541492080642e-6          , },
+/* x = 0.6         */  {0.0114698722837973272           , 0.0110100881767021656           , 0.00529285871574333964          , 0.0016988038576066069           , 0.000409501281810897372         , 0.0000790702598838970309        , 0.0000127381989397737805        , 1.76092284074702506e-6          , },
+/* x = 0.7         */  {0.0104201334214167358           , 0.0100008813271503847           , 0.00480701567616432403          , 0.00154266165262009905          , 0.000371816713488784891         , 0.0000717854777455250991        , 0.0000115633716735200266        , 1.59835319013464507e-6          , },
+/* x = 0.8         */  {0.00946660925903274278          , 0.00908430598461425291          , 0.00436582534315790848          , 0.00140088773515799033          , 0.000337603866794667136         , 0.000065172529468140891         , 0.00001049700044897215          , 1.45080550615516305e-6          , },
+/* x = 0.9         */  {0.00860046914528278091          , 0.00825184909903175159          , 0.00396517897500561643          , 0.0012721584824070583           , 0.000306542579947456649         , 0.0000591693964237110343        , 9.52906399635417498e-6          , 1.31689054004367872e-6          , },
+/* x = 1.0         */  {0.00781369393861023742          , 0.00749578091022965594          , 0.00360134631256753288          , 0.00115527233005968026          , 0.000278342244755253453         , 0.0000537197902239350069        , 8.65046778751217193e-6          , 1.19534762461232835e-6          , },
+/* x = 1.1         */  {0.00709900134394182519          , 0.0068090827977590369           , 0.00327094067900712011          , 0.00104913850580872563          , 0.000252739076113634554         , 0.0000487726228233807452        , 7.8529582648081585e-6           , 1.08503276445659885e-6          , },
+/* x = 1.2         */  {0.00644977812637732128          , 0.00618538178345276922          , 0.00297088730081023618          , 0.000952766803727981846         , 0.000229493633993609594         , 0.0000442815256633882921        , 7.12904501422859477e-6          , 9.84907830085795789e-7          , },
+/* x = 1.3         */  {0.00586001856781629488          , 0.00561889107268686386          , 0.00269839455250335648          , 0.000865258303291229725         , 0.000208388574552775737         , 0.0000402044133146942489        , 6.47193014637963611e-6          , 8.94030753585242265e-7          , },
+/* x = 1.4         */  {0.00532426859096627031          , 0.00510435607705027434          , 0.00245092785499241326          , 0.000785796945689840974         , 0.000189226609167277449         , 0.0000365030874977055769        , 5.87544421733581734e-6          , 8.1154663292110408e-7           , },
+/* x = 1.5         */  {0.00483757502829077991          , 0.00463700541260612883          , 0.00222618598241379025          , 0.000713641888190663219         , 0.000171828652145681017         , 0.0000331428777412827845        , 5.33398808326494697e-6          , 7.36679660619486917e-7          , },
+/* x = 1.6         */  {0.00439543956166375327          , 0.00421250641464640676          , 0.00202207955504864626          , 0.000648120564609432045         , 0.000156032139667411021         , 0.0000300923152874033012        , 4.84248013895831766e-6          , 6.68725800371645769e-7          , },
+/* x = 1.7         */  {0.00399377690225221137          , 0.0038269247522422667           , 0.00183671151641484577          , 0.000588622386629362831         , 0.000141689504104841717         , 0.000027322837163452986         , 4.39630844138582139e-6          , 6.07046142211170941e-7          , },
+/* x = 1.8         */  {0.0036288768198638729           , 0.00347668776437312048          , 0.00166835941131147308          , 0.000534593026732852217         , 0.000128666789354799691         , 0.0000248085176291190731        , 3.99128726565451358e-6          , 5.51060873344339625e-7          , },
+/* x = 1.9         */  {0.00329736966704354246          , 0.00315855117434171792          , 0.00151545929852533698          , 0.000485529228993450313         , 0.000116842394136003843         , 0.0000225258244636364148        , 3.62361768271592244e-6          , 5.00243807552645206e-7          , },
+/* x = 2.0         */  {0.00299619507592099136          , 0.00286956887087897119          , 0.00137659114727685482          , 0.000440974098947246634         , 0.000106105931416444762         , 0.0000204533977939244639        , 3.28985178624045574e-6          , 4.5411742138234742e-7           , },
+/* x = 2.1         */  {0.00272257353551106255          , 0.00260706547310956068          , 0.00125046558042924817          , 0.000400512828274539532         , 0.0000963571932303188015        , 0.000018571849377171052         , 2.98686023061810127e-6          , 4.12248350140074518e-7          , },
+/* x = 2.2         */  {0.0024739805841230822           , 0.00236861142265844198          , 0.00113591184014166562          , 0.000363768814116767906         , 0.0000875052111382530829        , 0.0000168635804446900267        , 2.711802773381157e-6            , 3.74243301071723122e-7          , },
+/* x = 2.3         */  {0.00224812337600467333          , 0.00215200036987505643          , 0.00103186686313305914          , 0.000330400136568859957         , 0.000079467403486594674         , 0.0000153126163892351092        , 2.46210154377440807e-6          , 3.39745345055567152e-7          , },
+/* x = 2.4         */  {0.00204291940355464751          , 0.00195522864265942179          , 0.000937365363147709167         , 0.000300096361258495428         , 0.0000721688014400259352        , 0.0000139044567370537776        , 2.23541678499081086e-6          , 3.08430551727178797e-7          , },
+/* x = 2.5         */  {0.00185647717659944311          , 0.00177647660589478346          , 0.00085153082767351615          , 0.000272575636983130558         , 0.0000655413465044524088        , 0.0000126259389903201668        , 2.02962484099110714e-6          , 2.80004936207564699e-7          , },
+/* x = 2.6         */  {0.00168707867852693648          , 0.00161409173720884754          , 0.000773567344549744648         , 0.000247582061151892699         , 0.0000595232529310153073        , 0.0000114651150565625962        , 1.84279818005590293e-6          , 2.54201688557744814e-7          , },
+/* x = 2.7         */  {0.00153316343568222174          , 0.00146657326086650004          , 0.000702752181892753418         , 0.000224883288298830161         , 0.0000540584290035816987        , 0.0000104111391005401214        , 1.67318726648001402e-6          , 2.30778659760892508e-7          , },
+/* x = 2.8         */  {0.00139331405150809507          , 0.00133255819619262387          , 0.000638429051839808241         , 0.000204268359220288944         , 0.0000490959517669448393        , 9.45416576184907018e-6          , 1.51920410929401088e-6          , 2.09516080462549347e-7          , },
+/* x = 2.9         */  {0.00126624307060003249          , 0.00121080869017144192          , 0.000580001995028992163         , 0.000185545730363963801         , 0.0000445895902564714453        , 8.58525777937601753e-6          , 1.37940733275262814e-6          , 1.90214490903400346e-7          , },
+/* x = 3.0         */  {0.00115078105026987534          , 0.00110020051589332474          , 0.000526929828557968251         , 0.000168541484980019211         , 0.0000404973727468221988        , 7.79630215248447911e-6          , 1.25248862771439099e-6          , 1.7269286247857505e-7           , },
+/* x = 3.1         */  {0.0010458657284908214           , 0.000999712629434264919         , 0.000478721105450782644         , 0.000153097709253364359         , 0.0000367811939519652714        , 7.07993404936920058e-6          , 1.13726045608784364e-6          , 1.56786893171412142e-7          , },
+/* x = 3.2         */  {0.000950532187334473186         , 0.000908417687659839213         , 0.000434929538459811306         , 0.000139071018186817272         , 0.0000334064584849185185        , 6.42946774609676837e-6          , 1.03264489236087346e-6          , 1.42347460755312108e-7          , },
+/* x = 3.3         */  {0.000863903920304651813         , 0.000825473438437565664         , 0.000395149845384533592         , 0.000126331217412135234         , 0.0000303417572270493803        , 5.83883394616609442e-6          , 9.37663496973051981e-7          , 1.29239219150325805e-7          , },
+/* x = 3.4         */  {0.000785184720409605662         , 0.000750114902903617345         , 0.000359013977041059199         , 0.00011476008838299499          , 0.0000275585735665580096        , 5.30252289059470294e-6          , 8.51428126038483934e-7          , 1.17339324675657531e-7          , },
+/* x = 3.5         */  {0.000713651313473233632         , 0.000681647276838563892         , 0.000326187692603446983         , 0.000104250285563020939         , 0.0000250310167468952921        , 4.81553272313602249e-6          , 7.73132590770741758e-7          , 1.06536280168154117e-7          , },
+/* x = 3.6         */  {0.000648646668138802359         , 0.000619439484931771498         , 0.000296367450293596223         , 0.0000947043352738110834        , 0.000022735579820978569         , 4.37332262477560369e-6          , 7.02045087985862908e-7          , 9.67288860517674749e-8          , },
+/* x = 3.7         */  {0.000589573920330530929         , 0.000562918327818462746         , 0.000269277584351500597         , 0.0000860337268225151364        , 0.0000206509199385732196        , 3.97177027660897884e-6          , 6.37501330340123677e-7          , 8.78252884544948707e-8          , },
+/* x = 3.8         */  {0.000535890855668491912         , 0.000511563167314540516         , 0.000244667741899734904         , 0.0000781580873948750898        , 0.0000187576589042937711        , 3.6071332509959244e-6           , 5.78898311565341553e-7          , 7.9742115387014548e-8           , },
+/* x = 3.9         */  {0.000487104898534217565         , 0.000464901100304137465         , 0.000222310555750424503         , 0.0000710044329859104447        , 0.0000170382021343272345        , 3.27601396790092764e-6          , 5.25688647958365243e-7          , 7.24036928298487225e-8          , },
+/* x = 4.0         */  {0.000442768561206930625         , 0.000422502576300677542         , 0.000201999531412523398         , 0.0000645064883540270813        , 0.0000154765743129935236        , 2.97532788691766661e-6          , 4.77375442819947801e-7          , 6.57413333312977958e-8          , },
+/* x = 4.1         */  {0.000402475310777666294         , 0.000383977417846878154         , 0.000183547128562776727         , 0.000058604069631973284         , 0.0000140582702072659358        , 2.70227463595381372e-6          , 4.33507625472857991e-7          , 5.96926904037619875e-8          , },
+/* x = 4.2         */  {0.000365855815440858244         , 0.00034897120668146997          , 0.000166783019064122753         , 0.0000532425238158592387        , 0.0000127701192398603302        , 2.45431180520954912e-6          , 3.9367572096658425e-7           , 5.42011726278976298e-8          , },
+/* x = 4.3         */  {0.000332574535296662839         , 0.00031716200201576132          , 0.000151552505267610207         , 0.000048372219886933143         , 0.0000116001625508091349        , 2.22913116018019837e-6          , 3.57508010638706833e-7          , 4.92154119382399487e-8          , },
+/* x = 4.4         */  {0.000302326626005464553         , 0.000288257360363559311         , 0.000137715083833697936         , 0.0000439480868049912879        , 0.0000105375413947854347        , 2.02463705018753177e-6          , 3.24667047389407162e-7          , 4.46887810758099155e-8          , },
+/* x = 4.5         */  {0.000274835126548661077         , 0.000261991629182454032         , 0.000125143141670158286         , 0.0000399291940517494784        , 9.5723958279399138e-6           , 1.83892680961064406e-6          , 2.94846492870532937e-7          , 4.05789556576609364e-8          , },
+/* x = 4.6         */  {0.000249848404994217214         , 0.000238123489139463245         , 0.000113720771819513253         , 0.0000362783708013554927        , 8.69577273466363653e-6          , 1.67027296774118944e-6          , 2.67768246825790997e-7          , 3.68475167347127102e-8          , },
+/* x = 4.7         */  {0.000227137838566335906         , 0.000216433722133472583         , 0.000103342698250600247         , 0.0000329618601572306575        , 7.89954233240381158e-6          , 1.51710710020620314e-6          , 2.4317984157270998e-7           , 3.34595900915570167e-8          , },
+/* x = 4.8         */  {0.000206495706498373449         , 0.000196723184312528139         , 0.0000939132995270263673        , 0.0000299490052229994113        , 7.17632237226465663e-6          , 1.37800517034550471e-6          , 2.20852077116050996e-7          , 3.03835188888254571e-8          , },
+/* x = 4.9         */  {0.000187733276127203382         , 0.000178810965235574002         , 0.0000853457222494864065        , 0.0000272119640734901117        , 6.51940932537158314e-6          , 1.25167422294556566e-6          , 2.0057687464998078e-7           , 2.75905665634680783e-8          , },
+/* x = 5.0         */  {0.000170679064484108382         , 0.000162532716063584363         , 0.0000775610760078667715        , 0.0000247254509624735114        , 5.92271591054496531e-6          , 1.13694030545003788e-6          , 1.82165328264000148e-7          , 2.50546471878853056e-8          , },
+/* x = 5.1         */  {0.000155177259268743876         , 0.000147739131240471945         , 0.0000704877023406094653        , 0.0000224665013494929284        , 5.38071437833754189e-6          , 1.03273750330892255e-6          , 1.65445936534795142e-7          , 2.27520807479879885e-8          , },
+/* x = 5.2         */  {0.000141086284574013937         , 0.00013429456955441447          , 0.0000640605108901137295        , 0.0000204142585511423543        , 4.88838502049761424e-6          , 9.38097986602535141e-7          , 1.50262997380498982e-7          , 2.06613710353850519e-8          , },
+/* x = 5.3         */  {0.000128277498074666158         , 0.000122075801768719387         , 0.0000582203765704939877        , 0.0000185497800245620517        , 4.44116942293734609e-6          , 8.52142974581818583e-7          , 1.36475151091333773e-7          , 1.87630040622409983e-8          , },
+/* x = 5.4         */  {0.000116634007613608358         , 0.000110970873190198294         , 0.0000529135921336780087        , 0.0000168558614746481626        , 4.03492802477324723e-6          , 7.74074533392850486e-7          , 1.23954057845770764e-7          , 1.70392651009256311e-8          , },
+/* x = 5.5         */  {0.000106049596228778241         , 0.000100878070613278804         , 0.0000480913710369614542        , 0.0000153168771432401083        , 3.66590158638321494e-6          , 7.03168130081947762e-7          , 1.12583197287389288e-7          , 1.54740726262278233e-8          , },
+/* x = 5.6         */  {0.0000964277456702083015        , 0.0000917049840497567816        , 0.0000437093959845832606        , 0.0000139186347899240299        , 3.330676206071425e-6            , 6.38765873082424534e-7          , 1.0225677888648746e-7           , 1.40528275972859698e-8          , },
+/* x = 5.7         */  {0.0000876807493711186472        , 0.0000833676545362755216        , 0.0000397274089420517032        , 0.0000126482440114942657        , 3.02615155819384109e-6          , 5.80270375831799594e-7          , 9.2878752853054137e-8           , 1.27622766610078135e-8          , },
+/* x = 5.8         */  {0.0000797289066669699073        , 0.0000757898001125612681        , 0.000036108838808828014         , 0.0000114939966718384302        , 2.74951205578616095e-6          , 5.27139186019865972e-7          , 8.43619123137974537e-8          , 1.15903879899796357e-8          , },
+/* x = 5.9         */  {0.0000724997908101606196        , 0.0000689021127906356889        , 0.0000328204632861885975        , 0.0000104452583272263008        , 2.498200668136688e-6            , 4.78879728278686406e-7          , 7.66270783244739313e-8          , 1.0526238586940507e-8           , },
+/* x = 6.0         */  {0.0000659275840124882321        , 0.0000626416199954637458        , 0.0000298321017959288589        , 9.49236963475139754e-6          , 2.26989514861667627e-6          , 4.35044712945315775e-7          , 6.9602360067879313e-8           , 9.55991199594743725e-9          , },
+/* x = 6.1         */  {0.0000599524733689918798        , 0.0000569511045569507899        , 0.0000271163365950281891        , 8.62655682496155151e-6          , 2.06248645065406258e-6          , 3.95227967902291764e-7          , 6.32224832949024604e-8          , 8.68240545840348669e-9          , },
+/* x = 6.2         */  {0.000054520102081152088         , 0.000051778577877477254         , 0.0000246482594941776447        , 7.83985040439645127e-6          , 1.87405913022545213e-6          , 3.59060654470889889e-7          , 5.7428180707679889e-8           , 7.88554564109009154e-9          , },
+/* x = 6.3         */  {0.0000495810709098972343        , 0.0000470768013933379092        , 0.0000224052418266399422        , 7.12501133062072809e-6          , 1.70287355183840424e-6          , 3.26207831935205145e-7          , 5.21656385661756612e-8          , 7.16191214407798275e-9          , },
+/* x = 6.4         */  {0.000045090485254234059         , 0.0000428028518971511245        , 0.0000203667255304989394        , 6.47546397212178482e-6          , 1.54734973185629718e-6          , 2.963653385452344e-7            , 4.73859943279432564e-8          , 6.50476806965112419e-9          , },
+/* x = 6.5         */  {0.0000410075436739148737        , 0.0000389177266957120281        , 0.000018514033403990038         , 5.88523522878681509e-6          , 1.40605266833998889e-6          , 2.69256959815084838e-7          , 4.30448806103876291e-8          , 5.90799699985732942e-9          , },
+/* x = 6.6         */  {0.0000372951640583131319        , 0.0000353859849476856095        , 0.0000168301967721239648        , 5.34889924617735918e-6          , 1.27767902048811588e-6          , 2.44631857626167368e-7          , 3.91020112000601374e-8          , 5.36604579062571875e-9          , },
+/* x = 6.7         */  {0.0000339196439921748973        , 0.0000321754218614245359        , 0.0000152997989648944084        , 4.86152720902146897e-6          , 1.16104501338185191e-6          , 2.2226223609010711e-7           , 3.55208052284905841e-8          , 4.87387264513482099e-9          , },
+/* x = 6.8         */  {0.00003085035218539056          , 0.00002925677273818635          , 0.0000139088331545110578        , 4.4186417467324638e-6           , 1.05507545519886635e-6          , 2.01941222345126279e-7          , 3.22680459925133759e-8          , 4.42689997879295624e-9          , },
+/* x = 6.9         */  {0.0000280594481213342215        , 0.000026603444122961311         , 0.0000126445732326998587        , 4.0161755267835055e-6           , 9.5879376446269944e-7           , 1.83480942473708981e-7          , 2.93135712223579734e-8          , 4.02097163327368631e-9          , },
+/* x = 7.0         */  {0.0000255216273393215835        , 0.0000241912695765886703        , 0.0000114954565304109277        , 3.65043365082193015e-6          , 8.71312914335478395e-7          , 1.66710774557391807e-7          , 2.66299918960136693e-8          , 3.65231403795924248e-9          , },
+/* x = 7.1         */  {0.0000232138900037687957        , 0.0000219982878111807548        , 0.0000104509772924054304        , 3.31805950386233979e-6          , 7.91827209532476121e-7          , 1.51475762543734192e-7          , 2.41924369663276417e-8          , 3.31750095427014521e-9          , },
+/* x = 7.2         */  {0.0000211153306278988715        , 0.000020004541138219815         , 9.50158991918511094e-6          , 3.01600373908498138e-6          , 7.1960481921691113e-7           , 1.37635176106513344e-7          , 2.19783216104779232e-8          , 3.01342147205014078e-9          , },
+/* x = 7.3         */  {0.0000192069470153403788        , 0.0000181918923669749537        , 8.63862107951638362e-6          , 2.74149610998735646e-6          , 6.5398099629561471e-7           , 1.25061203047121396e-7          , 1.99671368321704001e-8          , 2.73725095775005075e-9          , },
+/* x = 7.4         */  {0.0000174714666605123246        , 0.0000165438584618602262        , 7.85418987923307366e-6          , 2.492019888165915e-6            , 5.94351919947014061e-7          , 1.13637762025868626e-7          , 1.81402584472200937e-8          , 2.48642468190065906e-9          , },
+/* x = 7.5         */  {0.0000158931890099394124        , 0.000015045459422613175         , 7.14113534684794472e-6          , 2.26528862908942841e-6          , 5.40169104032438312e-7          , 1.03259424538078905e-7          , 1.64807736649782465e-8          , 2.25861387854511906e-9          , },
+/* x = 7.6         */  {0.0000144578421330912391        , 0.0000136830809921618436        , 6.49295056446195158e-6          , 2.0592250700916247e-6           , 4.90934319324631179e-7          , 9.38304360720859418e-8          , 1.49733236430699719e-8          , 2.0517040121530711e-9           , },
+/* x = 7.7         */  {0.0000131524524843477455        , 0.00001244434992508068          , 5.90372283416615654e-6          , 1.87194196466250579e-6          , 4.46194982283089428e-7          , 8.52638273141067527e-8          , 1.36039605426658325e-8          , 1.8637750482772406e-9           , },
+/* x = 7.8         */  {0.000011965226558496429         , 0.000011318020665803738         , 5.36807932616038232e-6          , 1.70172467514117326e-6          , 4.0553996745940296e-7           , 7.74806071071990067e-8          , 1.23600177474343179e-8          , 1.69308354303429657e-9          , },
+/* x = 7.9         */  {0.0000108854433518859133        , 0.0000102938723913494541        , 4.88113770568777804e-6          , 1.54701536227654111e-6          , 3.68595804567959369e-7          , 7.04090296360126803e-8          , 1.12299920326899966e-8          , 1.53804638357263761e-9          , },
+/* x = 8.0         */  {9.90335664101374363e-6          , 9.36261546919759994e-6          , 4.43846128208017994e-6          , 1.4063986249790337e-6           , 3.35023224845232504e-7          , 6.39839290030032427e-8          , 1.02034365832249236e-8          , 1.39722602719155264e-9          , },
+/* x = 8.1         */  {9.0101061808383741e-6           , 8.51580646803788085e-6          , 4.03601826515633527e-6          , 1.27858845707515306e-6          , 3.0451402457801916e-7           , 5.81461149916993572e-8          , 9.27086385994211144e-9          , 1.26931710084497934e-9          , },
+/* x = 8.2         */  {8.19763700731582135e-6          , 7.74577093819103161e-6          , 3.67014475230488673e-6          , 1.16241640012373644e-6          , 2.76788216637933681e-7          , 5.28418243844262948e-8          , 8.42365740765547421e-9          , 1.15313423553143268e-9          , },
+/* x = 8.3         */  {7.4586261033327762e-6           , 7.04553325032253091e-6          , 3.33751110417159806e-6          , 1.05682078247226279e-6          , 2.51591443543912399e-7          , 4.80222227209438461e-8          , 7.65399178014812661e-9          , 1.04760102165989792e-9          , },
+/* x = 8.4         */  {6.78641575503236917e-6          , 6.40875284629391765e-6          , 3.03509139827802164e-6          , 9.60836944827599419e-7          , 2.28692628011556388e-7          , 4.36429518556353501e-8          , 6.95475983457754678e-9          , 9.51739981998743169e-10         , },
+/* x = 8.5         */  {6.17495298713492798e-6          , 5.82966631523337039e-6          , 2.76013567841934458e-6          , 8.73588361782415206e-7          , 2.07881839160668734e-7          , 3.96637190986032617e-8          , 6.31950671629631685e-9          , 8.6466346836006141e-10          , },
+/* x = 8.6         */  {5.61873452181479345e-6          , 5.30303476170614849e-6          , 2.51014474358821069e-6          , 7.94278577061736516e-7          , 1.88968354561031796e-7          , 3.60479241142986298e-8          , 5.74236991776931312e-9          , 7.85565396835191807e-10         , },
+/* x = 8.7         */  {5.11275675652395933e-6          , 4.82409598172647102e-6          , 2.28284724369013248e-6          , 7.22183877811500301e-7          , 1.71778900120118984e-7          , 3.27623201037784287e-8          , 5.21802485210072349e-9          , 7.13713744260061624e-10         , },
+/* x = 8.8         */  {4.65247030232471315e-6          , 4.38852100672922407e-6          , 2.07617887067368827e-6          , 6.56646640113014732e-7          , 1.56156051472107626e-7          , 2.97767061166508671e-8          , 4.74163543327111254e-9          , 6.48443735725453894e-10         , },
+/* x = 8.9         */  {4.23373866623406081e-6          , 3.99237461592458045e-6          , 1.88826345309388076e-6          , 5.9706928413801416e-7           , 1.41956782030742568e-7          , 2.70636476292342625e-8          , 4.30880920201054388e-9          , 5.89151659424509981e-10         , },
+/* x = 9.0         */  {3.85280069918072304e-6          , 3.63207945406532665e-6          , 1.71739577974033637e-6          , 5.42908783016630611e-7          , 1.2905114423335313e-7           , 2.45982227891423759e-8          , 3.91555657873830802e-9          , 5.35289251008674371e-10         , },
+/* x = 9.1         */  {3.5062364657834349e-6           , 3.30438342490514145e-6          , 1.56202599395734831e-6          , 4.9367167462787715e-7           , 1.17321071742410082e-7          , 2.23577919658893118e-8          , 3.55825386358223383e-9          , 4.86358594959194296e-10         , },
+/* x = 9.2         */  {3.19093622359731553e-6          , 3.00633006082473424e-6          , 1.42074541480891565e-6          , 4.48909530187062569e-7          , 1.06659291496008372e-7          , 2.03217884644230536e-8          , 3.23360963851312416e-9          , 4.41907495324394653e-10         , },
+/* x = 9.3         */  {2.90407222803395184e-6          , 2.73523159653173669e-6          , 1.29227365443401165e-6          , 4.08214837740429183e-7          , 9.6968335520090261e-8           , 1.84715284557841125e-8          , 2.93863425842130964e-9          , 4.01525272568810607e-10         , },
+/* x = 9.4         */  {2.6430731051046029e-6           , 2.48864449965389784e-6          , 1.17544691291799275e-6          , 3.71217262523714258e-7          , 8.81596433426273103e-8          , 1.67900383581923306e-8          , 2.67061214682102821e-9          , 3.6483894727021378e-10          , },
+/* x = 9.5         */  {2.40560055770438057e-6          , 2.26434723367442403e-6          , 1.06920734288671143e-6          , 3.37580249634129997e-7          , 8.01527466920226045e-8          , 1.52618980644676892e-8          , 2.42707663806510587e-9          , 3.31509775022126757e-10         , },
+/* x = 9.6         */  {2.18952819256617813e-6          , 2.06032004921296121e-6          , 9.72593385911644492e-7          , 3.06997937636983014e-7          , 7.28745289265419303e-8          , 1.38730985593122777e-8          , 2.2057871317330044e-9           , 3.0123010018662864e-10          , },
+/* x = 9.7         */  {1.99292227446428947e-6          , 1.87472661832619013e-6          , 8.84730991789010339e-7          , 2.7919235460835911e-7           , 6.62585523357740783e-8          , 1.26109126040020806e-8          , 2.00470834644277171e-9          , 2.73720499126006769e-10         , },
+/* x = 9.8         */  {1.81402423191872022e-6          , 1.70589734346124024e-6          , 8.04825639906792619e-7          , 2.53910870730808127e-7          , 6.0244447085437288e-8           , 1.14637772877131072e-8          , 1.8219914799342274e-9           , 2.48727186250144616e-10         , },
+/* x = 9.9         */  {1.65123475470528227e-6          , 1.55231418810017823e-6          , 7.32155089316509788e-7          , 2.30923883934130769e-7          , 5.47773561491747719e-8          , 1.0421187355174994e-8           , 1.6559571000605819e-9           , 2.26019658674898336e-10         , },
+/* x = 10.0        */  {1.50309933806185951e-6          , 1.41259689012731322e-6          , 6.66062790850203069e-7          , 2.10022717230305615e-7          , 4.9807431090658336e-8           , 9.47359832063989669e-9          , 1.50507960747539007e-9          , 2.05388557518197226e-10         , },
+/* x = 10.1        */  {1.36829514173230965e-6          , 1.28549043166249825e-6          , 6.05951900729868864e-7          , 1.91017708350374515e-7          , 4.52893740311940625e-8          , 8.61233846921318854e-9          , 1.36797312546264208e-9          , 1.86643725886163483e-10         , },
+/* x = 10.2        */  {1.24561904402855623e-6          , 1.16985365065061522e-6          , 5.51279840663104697e-7          , 1.73736474069954194e-7          , 4.11820215664995494e-8          , 7.82952892926661725e-9          , 1.24337868566727571e-9          , 1.69612445440204292e-10         , },
+/* x = 10.3        */  {1.13397678202954131e-6          , 1.06464888998682186e-6          , 5.01553354456527206e-7          , 1.5802233322550882e-7           , 3.74479667853942492e-8          , 7.11801107471696569e-9          , 1.13015259056614909e-9          , 1.54137835105045793e-10         , },
+/* x = 10.4        */  {1.03237307897368785e-6          , 9.68932589485916736e-7          , 4.5632401575428166e-7           , 1.43732873890626758e-7          , 3.40532158964406926e-8          , 6.47128058410546114e-9          , 1.02725584448871717e-9          , 1.40077396992719988e-10         , },
+/* x = 10.5        */  {9.39902668930945977e-7          , 8.81846734660437857e-7          , 4.15184145665123163e-7          , 1.30738651513935694e-7          , 3.0966876289388137e-8           , 5.88342754529198949e-9          , 9.33744554955034905e-10         , 1.27301695992800219e-10         , },
+/* x = 10.6        */  {8.55742137044557922e-7          , 8.02611084135855752e-7          , 3.77763102816637903e-7          , 1.18922006030349226e-7          , 2.81608731495912898e-8          , 5.34908205076166991e-9          , 8.48761215139506468e-10         , 1.15693160727612383e-10         , },
+/* x = 10.7        */  {7.79142501086931537e-7          , 7.30516104675114528e-7          , 3.43723911804173984e-7          , 1.08175987056310342e-7          , 2.56096920081195839e-8          , 4.86336477955428209e-9          , 7.71526786476643482e-10         , 1.05144994704439135e-10         , },
+/* x = 10.8        */  {7.09422466847095131e-7          , 6.64916549274802084e-7          , 3.12760199116735413e-7          , 9.84033772777933441e-8          , 2.32901448505012869e-8          , 4.42184210814576545e-9          , 7.01333507876805747e-10         , 9.55601875255123088e-11         , },
+/* x = 10.9        */  {6.45962296021458903e-7          , 6.05225619691326675e-7          , 2.84593408451309535e-7          , 8.95158050463168648e-8          , 2.1181157625198778e-8           , 4.02048533466795243e-9          , 6.37538364785202503e-10         , 8.68506169505017582e-11         , },
+/* x = 11.0        */  {5.88198230871658138e-7          , 5.50909660112072249e-7          , 2.58970269897046031e-7          , 8.14329380215243939e-8          , 1.92635771910177854e-8          , 3.6556336390404057e-9           , 5.79557157459622036e-10         , 7.89362334540128111e-11         , },
+/* x = 11.1        */  {5.35617424994539372e-7          , 5.01483333553036092e-7          , 2.35660499805175961e-7          , 7.40817504466488282e-8          , 1.75199959225583433e-8          , 3.32396043626305768e-9          , 5.26859113418882656e-10         , 7.1744319690246481e-11          , },
+/* x = 11.2        */  {4.87753334166598211e-7          , 4.56505236985819597e-7          , 2.14454710281157278e-7          , 6.73958573223342123e-8          , 1.59345923561929626e-8          , 3.02244281160380187e-9          , 4.78961994077006686e-10         , 6.52088179756694682e-11         , },
+/* x = 11.3        */  {4.44181525420831133e-7          , 4.15573915213827212e-7          , 1.95162509161879586e-7          , 6.13149093611431094e-8          , 1.44929864074280892e-8          , 2.74833375500493935e-9          , 4.35427650174947155e-10         , 5.92697195348315119e-11         , },
+/* x = 11.4        */  {4.04515866326579934e-7          , 3.78324237167169875e-7          , 1.77610773090673683e-7          , 5.57840431653542895e-8          , 1.31821078252484866e-8          , 2.49913693799305047e-9          , 3.95857984795312726e-10         , 5.38725098302978913e-11         , },
+/* x = 11.5        */  {3.68405059907551821e-7          , 3.44424101601709934e-7          , 1.6164207789253252e-7           , 5.07533815795488145e-8          , 1.19900766714137646e-8          , 2.272583799950478e-9            , 3.59891286534944052e-10         , 4.89676648204281575e-11         , },
+/* x = 11.6        */  {3.35529493781608076e-7          , 3.1357144220048195e-7           , 1.4711327189605528e-7           , 4.61775796317115317e-8          , 1.09060947238096102e-8          , 2.06661273201290672e-9          , 3.27198898850800114e-10         , 4.45101934633238108e-11         , },
+/* x = 11.7        */  {3.055983749670342e-7            , 2.85491504813132937e-7          , 1.33894179160521682e-7          , 4.20154118964240253e-8          , 9.9203468038863306e-9           , 1.87935016629598831e-9          , 2.97482194718556037e-10         , 4.04592222161309191e-11         , },
+/* x = 11.8        */  {2.78347124400092445e-7          , 2.59934372056257053e-7          , 1.21866420758310304e-7          , 3.82293974950849495e-8          , 9.02391111988200915e-9          , 1.70909339580569391e-9          , 2.70469828579769865e-10         , 3.67776176700516977e-11         , },
+/* x = 11.9        */  {2.53535007571568249e-7          , 2.3667271275745257e-7           , 1.1092234334560101e-7           , 3.47854592944974375e-8          , 8.20867780077850382e-9          , 1.55429496641649868e-9          , 2.459152401289296e-10           , 3.34316438165525795e-11         , },
+/* x = 12.0        */  {2.30942979837426432e-7          , 2.15499735779403559e-7          , 1.00964045237945245e-7          , 3.16526141798193485e-8          , 7.46727487154891538e-9          , 1.4135484968578842e-9           , 2.23594386830185784e-10         , 3.03906507626781571e-11         , },
+/* x = 12.1        */  {2.10371726910279062e-7          , 1.96227329626178915e-7          , 9.19024911009293465e-8          , 2.88026915636939838e-8          , 6.79300098892711843e-9          , 1.28557579586851024e-9          , 2.03303684176934585e-10         , 2.76267920061067058e-11         , },
+/* x = 12.2        */  {1.91639882812021286e-7          , 1.78684370929409783e-7          , 8.36567071780421024e-8          , 2.62100775530124216e-8          , 6.17976431930098154e-9          , 1.16921515768179591e-9          , 1.84858134635454844e-10         , 2.51147676463515841e-11         , },
+/* x = 12.3        */  {1.74582409179964338e-7          , 1.62715186452642999e-7          , 7.61530497154788252e-8          , 2.38514824306065089e-8          , 5.62202699697986646e-9          , 1.06341072790827322e-9          , 1.6808962796450653e-10          , 2.28315911498087822e-11         , },
+/* x = 12.4        */  {1.5904912128385002e-7           , 1.48178154652134747e-7          , 6.93245399137734443e-8          , 2.17057293234158323e-8          , 5.11475465253950843e-9          , 9.67202841780355605e-10         , 1.52845397192495992e-10         , 2.07563775054300652e-11         , },
+/* x = 12.5        */  {1.44903347442681921e-7          , 1.34944434104509725e-7          , 6.31102593450264999e-8          , 1.97535621232942533e-8          , 4.65337054768072101e-9          , 8.79719245716185115e-10         , 1.38986615977328868e-10         , 1.88701508067112133e-11         , },
+/* x = 12.6        */  {1.32020709740542065e-7          , 1.22896807267753094e-7          , 5.7454800327702869e-8           , 1.79774709034214345e-8          , 4.23371389548592954e-9          , 8.00167121324592725e-10         , 1.26387124384861843e-10         , 1.71556694762845564e-11         , },
+/* x = 12.7        */  {1.20288015040550466e-7          , 1.11928629092541441e-7          , 5.23077662536061665e-8          , 1.63615332338965448e-8          , 3.85200198351286018e-9          , 7.27825838388836123e-10         , 1.14932271312146737e-10         , 1.55972675133816436e-11         , },
+/* x = 12.8        */  {1.09602246295929369e-7          , 1.01942870955599152e-7          , 4.76233173183272643e-8          , 1.48912699459992788e-8          , 3.50479575218515823e-9          , 6.62040370101593641e-10         , 1.0451786286252616e-10          , 1.41807102933171206e-11         , },
+/* x = 12.9        */  {9.98696450658947347e-8          , 9.28512512543490711e-8          , 4.33597575214179585e-8          , 1.35535140271554756e-8          , 3.18896851274979165e-9          , 6.02215309940270998e-10         , 9.50492069611586291e-11         , 1.28930635833291115e-11         , },
+/* x = 13.0        */  {9.10048769701201069e-8          , 8.45734447905704197e-8          , 3.94791591795776361e-8          , 1.2336291449065225e-8           , 2.90167751796549669e-9          , 5.47809435126841393e-10         , 8.64402453908644623e-11         , 1.17225745618567831e-11         , },
+/* x = 13.1        */  {8.29302725663490073e-8          , 7.70363637873134545e-8          , 3.5947021538730865e-8           , 1.12287128408523082e-8          , 2.64033812493284484e-9          , 4.98330766661782091e-10         , 7.86127652375916219e-11         , 1.06585637397880709e-11         , },
+/* x = 13.2        */  {7.55751368182283968e-8          , 7.01735040345183594e-8          , 3.27319603821691208e-8          , 1.0220875018484975e-8           , 2.40260031331776359e-9          , 4.53332080504038461e-10         , 7.14956824698382549e-11         , 9.69132678340991312e-12         , },
+/* x = 13.3        */  {6.88751209408282459e-8          , 6.39243502506134162e-8          , 2.98054258147935535e-8          , 9.30377147201660082e-9          , 2.18632734387721036e-9          , 4.12406828630876125e-10         , 6.50243910438771817e-11         , 8.81204533068399154e-12         , },
+/* x = 13.4        */  {6.27716509752624767e-8          , 5.82338352852467069e-8          , 2.71414456605285902e-8          , 8.46921099423371232e-9          , 1.98957636186858745e-9          , 3.75185432491597644e-10         , 5.91401715328182888e-11         , 8.01270597591010443e-12         , },
+/* x = 13.5        */  {5.72114079564790444e-8          , 5.30518482771625485e-8          , 2.47163921435408447e-8          , 7.70974370883484672e-9          , 1.8105807677953936e-9           , 3.41331914802473483e-10         , 5.37896538280569903e-11         , 7.28602667360507533e-12         , },
+/* x = 13.6        */  {5.21458550043166126e-8          , 4.83327873255441567e-8          , 2.25087697361404234e-8          , 7.01859382398389662e-9          , 1.64773419417581637e-9          , 3.10540838748714412e-10         , 4.8924328961610758e-11          , 6.62538988122396952e-12         , },
+/* x = 13.7        */  {4.75308070915802257e-8          , 4.4035152636974003e-8           , 2.04990222491118755e-8          , 6.38959849861019113e-9          , 1.49957594176858226e-9          , 2.82534526491811788e-10         , 4.4500105551889907e-11          , 6.02478182282369756e-12         , },
+/* x = 13.8        */  {4.3326039628028954e-8           , 4.012117647720753e-8            , 1.86693574154908172e-8          , 5.81715226473149581e-9          , 1.36477774208771543e-9          , 2.57060531453352592e-10         , 4.04769067878042187e-11         , 5.47873731249906809e-12         , },
+/* x = 13.9        */  {3.94949323493027425e-8          , 3.65564865905711135e-8          , 1.70035873780785856e-8          , 5.29615649987033959e-9          , 1.24213172520871498e-9          , 2.33889341183322742e-10         , 3.68183042406058944e-11         , 4.98228962793660395e-12         , },
+/* x = 14.0        */  {3.60041453181315839e-8          , 3.33098000530314188e-8          , 1.54869836357327585e-8          , 4.82197348978633638e-9          , 1.13053948292548083e-9          , 2.12812289743598184e-10         , 3.34911851329914315e-11         , 4.53092497121184655e-12         , },
+/* x = 14.1        */  {3.28233241345647924e-8          , 3.03526448006118359e-8          , 1.41061451350138754e-8          , 4.39038466368232707e-9          , 1.02900212736221465e-9          , 1.93639660465451711e-10         , 3.04654500038897289e-11         , 4.12054109643712595e-12         , },
+/* x = 14.2        */  {2.99248317150644311e-8          , 2.76591063253705405e-8          , 1.28488783133145034e-8          , 3.99755262214614779e-9          , 9.36611254270239138e-10         , 1.76198961691330213e-10         , 2.77137379879198032e-11         , 3.74740972244441637e-12         , },
+/* x = 14.3        */  {2.72835042395175823e-8          , 2.52055972588919018e-8          , 1.17040880082418506e-8          , 3.63998661271318777e-9          , 8.52540728530447006e-10         , 1.60333359702097426e-10         , 2.52111771833137449e-11         , 3.40814238372104655e-12         , },
+/* x = 14.4        */  {2.48764290827117164e-8          , 2.29706477702574409e-8          , 1.06616782467650986e-8          , 3.31451113939606857e-9          , 7.76039216914413809e-10         , 1.45900254476116402e-10         , 2.2935157813534159e-11          , 3.09965940463073509e-12         , },
+/* x = 14.5        */  {2.26827427445622029e-8          , 2.09347148936434436e-8          , 9.71246201737806117e-9          , 3.01823742111601384e-9          , 7.06423400000569672e-10         , 1.32769985239336562e-10         , 2.08651260980179494e-11         , 2.81916171084469253e-12         , },
+/* x = 14.6        */  {2.06834469731771879e-8          , 1.90800090717562666e-8          , 8.84807921008853375e-9          , 2.74853743994854655e-9          , 6.43071801359333815e-10         , 1.208246539580963e-10           , 1.89823969384000467e-11         , 2.56410521814613793e-12         , },
+/* x = 14.7        */  {1.88612414383250881e-8          , 1.73903363568232119e-8          , 8.06092198317443739e-9          , 2.5030203437027408e-9           , 5.85419177770092939e-10         , 1.09957056009682612e-10         , 1.72699836999823321e-11         , 2.33217756260053678e-12         , },
+/* x = 14.8        */  {1.7200371461517526e-8           , 1.58509548522240705e-8          , 7.34406688302198156e-9          , 2.27951098880520135e-9          , 5.32951419365414076e-10         , 1.00069708249819868e-10         , 1.57124435257225214e-11         , 2.12127695772473492e-12         , },
+/* x = 14.9        */  {1.56864894440841901e-8          , 1.44484441063641444e-8          , 6.69121310459895226e-9          , 2.07603042895422331e-9          , 4.85200913261213481e-10         , 9.10739655902869772e-11         , 1.42957367630852902e-11         , 1.92949298394210168e-12         , },
+/* x = 15.0        */  {1.430652875752153e-8            , 1.3170586287224306e-8           , 6.09662633577689697e-9          , 1.8907781727251405e-9           , 4.41742328468709136e-10         , 8.28892180120467529e-11         , 1.30070992140493158e-11         , 1.75508913346045081e-12         , },
+/* x = 15.1        */  {1.30485889721584567e-8          , 1.20062580722411838e-8          , 5.55508767930827393e-9          , 1.72211604940726495e-9          , 4.02188783733880803e-10         , 7.54421606771159798e-11         , 1.18349260366032243e-11         , 1.59648694992072022e-12         , },
+/* x = 15.2        */  {1.19018314018119279e-8          , 1.09453322847375812e-8          , 5.06184719225089876e-9          , 1.56855353698373504e-9          , 3.66188363448287509e-10         , 6.86661304727234966e-11         , 1.07686662332840076e-11         , 1.45225161688773769e-12         , },
+/* x = 15.3        */  {1.08563840345238769e-8          , 9.97858839591826161e-9          , 4.61258162443235585e-9          , 1.42873441946219257e-9          , 3.33420949953638866e-10         , 6.25005029302850773e-11         , 9.79872675970620836e-12         , 1.32107886262660485e-12         , },
+/* x = 15.4        */  {9.90325500351504382e-9          , 9.09763109126767523e-9          , 4.20335597554316049e-9          , 1.30142465284838886e-9          , 3.03595343450724532e-10         , 5.6890144014988747e-11          , 8.91638537450070249e-12         , 1.20178306075344068e-12         , },
+/* x = 15.5        */  {9.03425382892137822e-9          , 8.29481617275966803e-9          , 3.83058852498621364e-9          , 1.18550133003731624e-9          , 2.7644664334773728e-10          , 5.17849117844373051e-11         , 8.11371143244705626e-12         , 1.09328641738016441e-12         , },
+/* x = 15.6        */  {8.24191973038611535e-9          , 7.56318313427414732e-9          , 3.49101902000665477e-9          , 1.07994264487788007e-9          , 2.51733867267807383e-10         , 4.71392033714728217e-11         , 7.38349389558677537e-12         , 9.94609145392023544e-13         , },
+/* x = 15.7        */  {7.51945637379377896e-9          , 6.89639380761142964e-9          , 3.18167973616698461e-9          , 9.83818764738875213e-10         , 2.29237786102617492e-10         , 4.29115431612219881e-11         , 6.71917590342159402e-12         , 9.04860535596629076e-13         , },
+/* x = 15.8        */  {6.86067247292249381e-9          , 6.28867653104628159e-9          , 2.89986915017754213e-9          , 8.9628352914915489e-10          , 2.08758955468198068e-10         , 3.90642084093763869e-11         , 6.11479530354452888e-12         , 8.23230842748744286e-13         , },
+/* x = 15.9        */  {6.25992771907738948e-9          , 5.73477534196556849e-9          , 2.64312798867856897e-9          , 8.1656689957883283e-10          , 1.90115925708500822e-10         , 3.55628888912322112e-11         , 5.5649305987786971e-12          , 7.48983911962622104e-13         , },
+/* x = 16.0        */  {5.7120835593226292e-9           , 5.22990374023592864e-9          , 2.40921743801208197e-9          , 7.43968092239695698e-10         , 1.73143614218542273e-10         , 3.23763774822152904e-11         , 5.06465181661567454e-12         , 6.81450477842890076e-13         , },
+/* x = 16.1        */  {5.21245838718186767e-9          , 4.76970260995998469e-9          , 2.19609931951489457e-9          , 6.77849331974010433e-10         , 1.57691825336728046e-10         , 2.94762888533757655e-11         , 4.60947585191081828e-12         , 6.20022074859035357e-13         , },
+/* x = 16.2        */  {4.75678674901688735e-9          , 4.35020192457303085e-9          , 2.00191805258585328e-9          , 6.17630170928185018e-10         , 1.43623904398970905e-10         , 2.68368037222558944e-11         , 4.19532587482469357e-12         , 5.64145503114829885e-13         , },
+/* x = 16.3        */  {4.34118220507648757e-9          , 3.9677858941447888e-9           , 1.82498424389197013e-9          , 5.62782320822704796e-10         , 1.30815513767720867e-10         , 2.44344363329791336e-11         , 3.81849443327643531e-12         , 5.13317798774669288e-13         , },
+/* x = 16.4        */  {3.96210351675488121e-9          , 3.61916124458983835e-9          , 1.66375975572620845e-9          , 5.12824952279144378e-10         , 1.19153519758225563e-10         , 2.22478230515269533e-11         , 3.47560991304066513e-12         , 4.67081663051100529e-13         , },
+/* x = 16.5        */  {3.61632386120407266e-9          , 3.30132834653487463e-9          , 1.51684411984742286e-9          , 4.67320418891303663e-10         , 1.08534980392400898e-10         , 2.02575301549130633e-11         , 3.16360604938702823e-12         , 4.25021307874756987e-13         , },
+/* x = 16.6        */  {3.30090280137450578e-9          , 3.01155493709479117e-9          , 1.3829621752414252e-9           , 4.25870367569213628e-10         , 9.88662248268533895e-11         , 1.84458790681053515e-11         , 2.87969421211438137e-12         , 3.86758680198531707e-13         , },
+/* x = 16.7        */  {3.01316076405503331e-9          , 2.74735220100341308e-9          , 1.26095281925136874e-9          , 3.8811220017695834e-10          , 9.00620161342485238e-11         , 1.67967874616939484e-11         , 2.62133821122798235e-12         , 3.51950030367540808e-13         , },
+/* x = 16.8        */  {2.75065580076732128e-9          , 2.50645299863819946e-9          , 1.1497587715356091e-9           , 3.53715854659818073e-10         , 8.20447898739889917e-11         , 1.52956247679220485e-11         , 2.38623139358188089e-12         , 3.20282793147445245e-13         , },
+/* x = 16.9        */  {2.51116242664151394e-9          , 2.28679204766201578e-9          , 1.04841725941279224e-9          , 3.22380876742100238e-10         , 7.47439615759800656e-11         , 1.39290808041130869e-11         , 2.17227582177278952e-12         , 2.91472752875239893e-13         , },
+/* x = 17.0        */  {2.29265235084151608e-9          , 2.08648788245243004e-9          , 9.56051541429739197e-10         , 2.9383375590049357e-10          , 6.80952968864107985e-11         , 1.26850463119505651e-11         , 1.97756334561921301e-12         , 2.65261466805229743e-13         , },
+/* x = 17.1        */  {2.09327692888524185e-9          , 1.90382643135743695e-9          , 8.71863193512818383e-10         , 2.67825501702759462e-10         , 6.20403386926877628e-11         , 1.15525043295917038e-11         , 1.80035839386601512e-12         , 2.41413923092702109e-13         , },
+/* x = 17.2        */  {1.91135118246824783e-9          , 1.7372460662492711e-9           , 7.95125088906157094e-10         , 2.4412943876978408e-10          , 5.65258860611186151e-11         , 1.0521431412219246e-11          , 1.63908232947928957e-12         , 2.19716412010665722e-13         , },
+/* x = 17.3        */  {1.7453392462852711e-9           , 1.58532399197522288e-9          , 7.25175009322265819e-10         , 2.2253920059019559e-10          , 5.15035202903768934e-11         , 9.58270780626204669e-12         , 1.49229922618415696e-12         , 1.99974590950847563e-13         , },
+/* x = 17.4        */  {1.59384111397786688e-9          , 1.44676385524448139e-9          , 6.61409830388807848e-10         , 2.0286690420884151e-10          , 4.69291738104767404e-11         , 8.72803576396663224e-12         , 1.35870293688043709e-12         , 1.82011725536975872e-13         , },
+/* x = 17.5        */  {1.45558056683083503e-9          , 1.32038446335060281e-9          , 6.03280229620584645e-10         , 1.84941489439724544e-10         , 4.27627380448443828e-11         , 7.94986525902554706e-12         , 1.23710533636750219e-12         , 1.65667090792635363e-13         , },
+/* x = 17.6        */  {1.32939417929842418e-9          , 1.20510951300807377e-9          , 5.50285869824903041e-10         , 1.68607207735327339e-10         , 3.89677067056337995e-11         , 7.24132643124253065e-12         , 1.12642563152850887e-12         , 1.50794517772555473e-13         , },
+/* x = 17.7        */  {1.21422130495705837e-9          , 1.09995823856755343e-9          , 5.01971015103682997e-10         , 1.53722247191082528e-10         , 3.55108513129152134e-11         , 6.59616814935582465e-12         , 1.02568064186420158e-12         , 1.37261072398614835e-13         , },
+/* x = 17.8        */  {1.10909495513971275e-9          , 1.00403689704860677e-9          , 4.57920540485441316e-10         , 1.4015748138830176e-10          , 3.2361926019691078e-11          , 6.0087021367092395e-12          , 9.33975962117115013e-13         , 1.24945854452404181e-13         , },
+/* x = 17.9        */  {1.01313349038552543e-9          , 9.16531014864613776e-10         , 4.17756299739633095e-10         , 1.27795330892288338e-10         , 2.94933990895223214e-11         , 5.47375215496484234e-12         , 8.50497926769611683e-13         , 1.13738905776047331e-13         , },
+/* x = 18.0        */  {9.25533052007211737e-10         , 8.3669832787890963e-10          , 3.81133819126552259e-10         , 1.1652872723473107e-10          , 2.68802086142923895e-11         , 4.98660778695355566e-12         , 7.7450630350765994e-13          , 1.03540217732274009e-13         , },
+/* x = 18.1        */  {8.45560667602407715e-10         , 7.63862352584868525e-10         , 3.47739287746996649e-10         , 1.06260170129999573e-10         , 2.44995402784923132e-11         , 4.54298240148060476e-12         , 7.05327649383707193e-13         , 9.42588288826771599e-14         , },
+/* x = 18.2        */  {7.7254797027147592e-10          , 6.97406531800860987e-10         , 3.17286817803474315e-10         , 9.69008695119839618e-11         , 2.23306251753705669e-11         , 4.13897492082324984e-12         , 6.42349269447406466e-13         , 8.58120046680354517e-14         , },
+/* x = 18.3        */  {7.05885476706548625e-10         , 6.3676890336405108e-10          , 2.89515950492759453e-10         , 8.83699647392344669e-11         , 2.03545558611688991e-11         , 3.77103504612532807e-12         , 5.85013723097704524e-13         , 7.812449162413571e-14           , },
+/* x = 18.4        */  {6.45017374232859497e-10         , 5.81437244940556852e-10         , 2.6418938543982033e-10          , 8.05938140082578434e-11         , 1.85541189981062785e-11         , 3.43593162722186724e-12         , 5.32813828394217878e-13         , 7.11278393475911514e-14         , },
+/* x = 18.5        */  {5.89436771357560882e-10         , 5.30944652285132116e-10         , 2.41090913575285717e-10         , 7.35053476441877976e-11         , 1.69136430862740747e-11         , 3.13072389190368001e-12         , 4.85288119095625359e-13         , 6.475978404498751e-14           , },
+/* x = 18.6        */  {5.38681370453113315e-10         , 4.84865512119030426e-10         , 2.20023535170644235e-10         , 6.70434795103658973e-11         , 1.54188599205265742e-11         , 2.85273527551651723e-12         , 4.42016713309525142e-13         , 5.89636880609944295e-14         , },
+/* x = 18.7        */  {4.92329524908234372e-10         , 4.42811834284447864e-10         , 2.00807746393605708e-10         , 6.11525712988283017e-11         , 1.40567785320278581e-11         , 2.59952961531839924e-12         , 4.02617556379572656e-13         , 5.36880302920258093e-14         , },
+/* x = 18.8        */  {4.49996646452294859e-10         , 4.04429911009161059e-10         , 1.83279979245335395e-10         , 5.57819449370015941e-11         , 1.28155704864722227e-11         , 2.36888949540691676e-12         , 3.66743004036014272e-13         , 4.88859428563183602e-14         , },
+/* x = 18.9        */  {4.11331931428959864e-10         , 3.69397274004100621e-10         , 1.67291181105093939e-10         , 5.08854387763488875e-11         , 1.16844655131515686e-11         , 2.15879654747074866e-12         , 3.34076714926104888e-13         , 4.45147898131902284e-14         , },
+/* x = 19.0        */  {3.76015377589087041e-10         , 3.37419922745473618e-10         , 1.52705521348445881e-10         , 4.64210036201666485e-11         , 1.06536565319273317e-11         , 1.967413530293711e-12           , 3.04330824449642045e-13         , 4.05357841076180612e-14         , },
+/* x = 19.1        */  {3.43755065516246054e-10         , 3.08229799685177043e-10         , 1.3939921363379235e-10          , 4.23503350037508531e-11         , 9.71421322961986029e-12         , 1.79306802700647366e-12         , 2.7724337437767379e-13          , 3.69136392646531376e-14         , },
+/* x = 19.2        */  {3.14284681113299961e-10         , 2.81582490310004612e-10         , 1.27259443478681175e-10         , 3.8638538463943939e-11          , 8.85800341412107081e-12         , 1.63423761368708851e-12         , 2.52575975052700581e-13         , 3.36162526747844769e-14         , },
+/* x = 19.3        */  {2.87361257685840899e-10         , 2.57255127950983883e-10         , 1.16183391681372434e-10         , 3.52538248295649906e-11         , 8.07762144436336436e-12         , 1.48953636618973581e-12         , 2.30111679077615983e-13         , 3.06144175990555753e-14         , },
+/* x = 19.4        */  {2.62763118076593101e-10         , 2.35044485046772291e-10         , 1.06077344992874868e-10         , 3.21672328320723325e-11         , 7.36632309777230741e-12         , 1.35770258415253855e-12         , 2.09653047317499853e-13         , 2.78815612841919105e-14         , },
+/* x = 19.5        */  {2.40287999051193621e-10         , 2.1476523420547221e-10          , 9.68558862177437373e-11         , 2.93523765794263458e-11         , 6.71796629456797319e-12         , 1.23758762210981113e-12         , 1.91020389780711951e-13         , 2.53935068155972612e-14         , },
+/* x = 19.6        */  {2.19751341725508044e-10         , 1.96248363902124581e-10         , 8.84411566252773351e-11         , 2.67852156577074275e-11         , 6.12695715078320632e-12         , 1.12814572761156796e-12         , 1.74050165529453322e-13         , 2.31282565520073056e-14         , },
+/* x = 19.7        */  {2.00984733271912524e-10         , 1.79339735007813266e-10         , 8.07621841926726594e-11         , 2.44438458265965775e-11         , 5.58820087961188619e-12         , 1.02842479532427862e-12         , 1.58593527209532631e-13         , 2.10657951818286306e-14         , },
+/* x = 19.8        */  {1.8383448645958262e-10          , 1.63898765582860316e-10         , 7.37542717839342964e-11         , 2.23083084581597457e-11         , 5.09705710411872498e-12         , 9.37557954334203687e-13         , 1.44514997097638968e-13         , 1.91879106195387587e-14         , },
+/* x = 19.9        */  {1.68160344783427006e-10         , 1.49797232492024009e-10         , 6.73584398980886522e-11         , 2.03604170351425017e-11         , 4.64929918382711246e-12         , 8.54755913373141148e-13         , 1.31691262753924888e-13         , 1.74780311226121349e-14         , },
+/* x = 20.0        */  {1.53834302028493235e-10         , 1.36918179423940267e-10         , 6.15209191022799474e-11         , 1.85835991766796525e-11         , 4.2410771936101328e-12          , 7.79299995504188301e-13         , 1.20010081448996366e-13         , 1.59210771567527905e-14         , },
+/* x = 20.1        */  {1.40739526111101081e-10         , 1.25154921829382668e-10         , 5.61926877039271929e-11         , 1.69627527973197045e-11         , 3.86888422596676279e-12         , 7.10535800004096551e-13         , 1.09369283517351916e-13         , 1.45033266711054174e-14         , },
+/* x = 20.2        */  {1.28769377943405045e-10         , 1.14410140141542487e-10         , 5.13290506152244564e-11         , 1.5484115130797284e-11          , 3.52952571746552494e-12         , 6.47867434815244922e-13         , 9.96758656828727762e-14         , 1.32122925668083137e-14         , },
+/* x = 20.3        */  {1.17826516892539514e-10         , 1.04595053413985874e-10         , 4.68892557264368206e-11         , 1.4135143464185933e-11          , 3.22009152714978259e-12         , 5.90752268065331049e-13         , 9.08451662142834601e-14         , 1.20366112528575331e-14         , },
+/* x = 20.4        */  {1.07822085156226523e-10         , 9.56286662150872756e-11         , 4.28361444349253954e-11         , 1.29044065319548739e-11         , 2.93793051926630881e-12         , 5.38696151813066109e-13         , 8.28001145069774394e-14         , 1.09659412837832164e-14         , },
+/* x = 20.5        */  {9.86749640603416593e-11         , 8.74370822578048457e-11         , 3.91358332775768842e-11         , 1.17814856139691345e-11         , 2.68062742502344692e-12         , 4.9124907541571804e-13          , 7.54705483589614191e-14         , 9.99087116501569347e-15         , },
+/* x = 20.6        */  {9.03110959064576916e-11         , 7.99528788263299207e-11         , 3.57574238879999005e-11         , 1.07568844674609842e-11         , 2.44598177840866772e-12         , 4.48001209767682704e-13         , 6.87925928190250605e-14         , 9.10283549487568627e-15         , },
+/* x = 20.7        */  {8.26628655642957707e-11         , 7.31145365915719164e-11         , 3.26727387489221294e-11         , 9.82194730123321372e-12         , 2.23198873958086262e-12         , 4.08579307163285958e-13         , 6.27080950401452348e-14         , 8.29403868761867997e-15         , },
+/* x = 20.8        */  {7.56685365202956906e-11         , 6.68659198903296343e-11         , 2.98560804368994627e-11         , 8.96878407153272036e-12         , 2.03682163616688869e-12         , 3.72643424723463076e-13         , 5.71641100756324295e-14         , 7.55738559058779884e-15         , },
+/* x = 20.9        */  {6.92717365637066245e-11         , 6.11558029826238482e-11         , 2.72840122627496233e-11         , 8.1902024437939088e-12          , 1.85881606808616642e-12         , 3.39883942223669841e-13         , 5.2112433014209022e-14          , 6.88641837090886544e-15         , },
+/* x = 21.0        */  {6.3420988719827039e-11          , 5.59374382019127199e-11         , 2.49351583988852148e-11         , 7.47964582337556387e-12         , 1.69645543543923155e-12         , 3.1001884779557105e-13          , 4.75091732672437949e-14         , 6.27525910386506424e-15         , },
+/* x = 21.1        */  {5.80692834300451705e-11         , 5.11681622773191542e-11         , 2.27900217556153059e-11         , 6.83113691202953153e-12         , 1.54835776165126418e-12         , 2.82791267371560891e-13         , 4.33143672005432486e-14         , 5.71855754663410456e-15         , },
+/* x = 21.2        */  {5.31736883335699524e-11         , 4.68090374387869267e-11         , 2.08308180240303218e-11         , 6.23922629562441875e-12         , 1.41326369557360084e-12         , 2.57967215920661157e-13         , 3.9491625647861603e-14          , 5.21144362792808301e-15         , },
+/* x = 21.3        */  {4.86949923293098038e-11         , 4.28245242181795772e-11         , 1.90413244446646484e-11         , 5.69894561303881976e-12         , 1.29002558671858385e-12         , 2.35333550506512579e-13         , 3.60078131567676924e-14         , 4.7494842266725662e-15          , },
+/* x = 21.4        */  {4.45973808910869382e-11         , 3.91821831344081159e-11         , 1.74067419900025852e-11         , 5.20576489653302732e-12         , 1.17759753732993224e-12         , 2.14696107000925758e-13         , 3.28327561025428917e-14         , 4.32864385158494284e-15         , },
+/* x = 21.5        */  {4.08481398778471419e-11         , 3.58524027011460064e-11         , 1.59135697662001703e-11         , 4.75555371066661386e-12         , 1.07502634365770436e-12         , 1.95878003926067419e-13         , 2.99389770649652986e-14         , 3.94524886871559726e-15         , },
+/* x = 21.6        */  {3.74173853250871808e-11         , 3.28081514237698238e-11         , 1.45494905461787679e-11         , 4.34454575027983767e-12         , 9.81443246691677238e-13         , 1.78718098389621719e-13         , 2.7301453098511648e-14          , 3.59595495601951109e-15         , },
+/* x = 21.7        */  {3.42778169265113724e-11         , 3.00247516598599497e-11         , 1.33032664434530184e-11         , 3.96930658849802044e-12         , 8.96056419780348803e-13         , 1.63069580433637045e-13         , 2.48973957408158872e-14         , 3.2777174931218379e-15          , },
+/* x = 21.8        */  {3.14044931178909641e-11         , 2.7479673406735502e-11          , 1.2164643824547262e-11          , 3.62670429342133189e-12         , 8.18144127089115224e-13         , 1.48798693351475587e-13         , 2.27060507991035234e-14         , 2.9877646208935734e-15          , },
+/* x = 21.9        */  {2.87746258600059379e-11         , 2.51523462517448266e-11         , 1.11242666384145959e-11         , 3.31388265737473219e-12         , 7.47048492788997403e-13         , 1.35783568649444615e-13         , 2.07085161315385693e-14         , 2.72357272950327249e-15         , },
+/* x = 22.0        */  {2.63673933860110967e-11         , 2.30239878779011649e-11         , 1.01735974146143969e-11         , 3.02823680553876361e-12         , 6.82169826269791203e-13         , 1.23913165350413236e-13         , 1.88875758015793317e-14         , 2.48284415547651411e-15         , },
+/* x = 22.1        */  {2.41637693320546922e-11         , 2.1077447660320337e-11          , 9.30484524877620099e-12         , 2.76739097166574768e-12         , 6.22961453587081176e-13         , 1.13086304265197215e-13         , 1.72275491299985941e-14         , 2.2634868881752192e-15          , },
+/* x = 22.2        */  {2.2146366809824861e-11          , 1.92970640190373992e-11         , 8.51090015467060469e-12         , 2.52917824759356769e-12         , 5.68925009825187381e-13         , 1.03210788702083084e-13         , 1.57141533025084639e-14         , 2.06359610418460455e-15         , },
+/* x = 22.3        */  {2.02992961071234828e-11         , 1.76685343122935532e-11         , 7.7852732175584421e-12          , 2.3116221305696438e-12          , 5.19606151127825369e-13         , 9.42026038531589917e-14         , 1.43343783121452255e-14         , 1.88143736453066109e-15         , },
+/* x = 22.4        */  {1.86080348186766017e-11         , 1.61787961623318978e-11         , 7.12204203388663306e-12         , 2.1129197081447122e-12          , 4.74590648851442116e-13         , 8.59851877950313152e-14         , 1.30763731258103065e-14         , 1.71543132459477837e-15         , },
+/* x = 22.5        */  {1.70593093151939308e-11         , 1.48159192040664349e-11         , 6.51580096828750161e-12         , 1.93142633472948939e-12         , 4.3350083166594302e-13          , 7.84887676773142621e-14         , 1.19293420646256772e-14         , 1.56413982018010011e-15         , },
+/* x = 22.6        */  {1.5640986555105637e-11          , 1.35690063365537253e-11         , 5.96161580062270092e-12         , 1.76564166695449288e-12         , 3.95992344493948028e-13         , 7.16497552506956257e-14         , 1.08834504789508727e-14         , 1.42625320553964083e-15         , },
+/* x = 22.7        */  {1.43419753312688872e-11         , 1.24281036387841321e-11         , 5.45498237386139713e-12         , 1.61419693684997144e-12         , 3.61751195970186031e-13         , 6.54101964125988648e-14         , 9.92973888184728608e-15         , 1.30057883041114664e-15         , },
+/* x = 22.8        */  {1.31521361250110358e-11         , 1.13841181856328331e-11         , 4.99178888823016359e-12         , 1.47584335267439245e-12         , 3.30491068642055869e-13         , 5.9717269927201912e-14          , 9.060044780211561e-15           , 1.18603055331996742e-15         , },
+/* x = 22.9        */  {1.2062198812854339e-11          , 1.04287430675188852e-11         , 4.56828151862407725e-12         , 1.34944152706206157e-12         , 3.01950868443397608e-13         , 5.45228309121306876e-14         , 8.26693151141398592e-15         , 1.08161919770137846e-15         , },
+/* x = 23.0        */  {1.10636875377801669e-11         , 9.55438897900454946e-12         , 4.18103306100231651e-12         , 1.2339518411203864e-12          , 2.75892492076728814e-13         , 4.97829950804250206e-14         , 7.5436234556881112e-15          , 9.86443865841972658e-16         , },
+/* x = 23.1        */  {1.01488521175139746e-11         , 8.75412179776483402e-12         , 3.82691433965970902e-12         , 1.12842566126435691e-12         , 2.52098792853344478e-13         , 4.54577600869274574e-14         , 6.88394705128658539e-15         , 8.996840333224138e-16           , },
+/* x = 23.2        */  {9.31060541756951155e-12         , 8.02160562655855923e-12         , 3.50306813109803452e-12         , 1.03199733300216502e-12         , 2.30371727282799513e-13         , 4.1510660656300434e-14          , 6.28227709105657792e-15         , 8.20592353630507598e-16         , },
+/* x = 23.3        */  {8.54246616715890739e-12         , 7.35105081748310935e-12         , 3.20688538192666321e-12         , 9.43876882647184312e-13         , 2.10530666288892397e-13         , 3.79084544683711074e-14         , 5.733487826060857e-15           , 7.48488108967399316e-16         , },
+/* x = 23.4        */  {7.83850674198879064e-12         , 6.73716654030138329e-12         , 2.93598351799171521e-12         , 8.63343364087520686e-13         , 1.92410856372449984e-13         , 3.46208360481064058e-14         , 5.23290844460017062e-15         , 6.82751249048184989e-16         , },
+/* x = 23.5        */  {7.19330547981716837e-12         , 6.17511749536092379e-12         , 2.6881866599396732e-12          , 7.89738793349388393e-13         , 1.75862017354805264e-13         , 3.16201761546623703e-14         , 4.77628253386323136e-15         , 6.22816964953543098e-16         , },
+/* x = 23.6        */  {6.60190313280180594e-12         , 5.66048440691834096e-12         , 2.46150757682301473e-12         , 7.22462618794126989e-13         , 1.60747064531531699e-13         , 2.88812843888404953e-14         , 4.35973116679166398e-15         , 5.68170749868623403e-16         , },
+/* x = 23.7        */  {6.05976309545657662e-12         , 5.18922796484338917e-12         , 2.25413122429554051e-12         , 6.60966679435765421e-13         , 1.46940944154366193e-13         , 2.63811929429285064e-14         , 3.97971928891638002e-15         , 5.18343902892521443e-16         , },
+/* x = 23.8        */  {5.56273507874671675e-12         , 4.75765591198543829e-12         , 2.06439972755436024e-12         , 6.04750608097618795e-13         , 1.34329572149975441e-13         , 2.40989596031309779e-14         , 3.63302510918782289e-15         , 4.72909436055451027e-16         , },
+/* x = 23.9        */  {5.10702192976950866e-12         , 4.36239300119468e-12            , 1.89079868158293367e-12         , 5.53357639979744591e-13         , 1.22808866886083938e-13         , 2.20154882842682369e-14         , 3.31671222544801536e-15         , 4.3147834827686713e-16          , },
+/* x = 24.0        */  {4.68914932283174977e-12         , 4.0003535703325992e-12          , 1.73194465254345397e-12         , 5.06370790718108138e-13         , 1.12283867616479781e-13         , 2.01133655306516256e-14         , 3.02810423941616121e-15         , 3.93696233268712065e-16         , },
+/* x = 24.1        */  {4.30593807177549352e-12         , 3.6687165057917138e-12          , 1.58657377445579696e-12         , 4.63409371211880707e-13         , 1.02667930983819205e-13         , 1.8376711557404235e-14          , 2.76476163809887641e-15         , 3.5924019136313671e-16          , },
+/* x = 24.2        */  {3.95447883532489565e-12         , 3.36490238526521883e-12         , 1.45353134467399654e-12         , 4.24125809405510803e-13         , 9.3881998639579261e-14          , 1.67910445342391759e-14         , 2.52446073858844323e-15         , 3.27816017950286678e-16         , },
+/* x = 24.3        */  {3.63210900721717717e-12         , 3.08655260893770351e-12         , 1.33176233021145667e-12         , 3.88202751862637576e-13         , 8.58539296599803751e-14         , 1.53431569299697981e-14         , 2.30517451145738684e-15         , 2.99155643673407552e-16         , },
+/* x = 24.4        */  {3.33639160111065295e-12         , 2.83151034506768493e-12         , 1.22030270474726395e-12         , 3.55350420382824483e-13         , 7.85178920006942532e-14         , 1.40210028418426859e-14         , 2.10505511455849402e-15         , 2.7301480376776805e-16          , },
+/* x = 24.5        */  {3.06509595688820836e-12         , 2.59780313124625879e-12         , 1.11827154323575173e-12         , 3.25304201110660388e-13         , 7.18138077466517e-14            , 1.28135953300959178e-14         , 1.92241798414465899e-15         , 2.49170915966868699e-16         , },
+/* x = 24.6        */  {2.81618011013743327e-12         , 2.3836269865757184e-12          , 1.02486380750155237e-12         , 2.97822445589280712e-13         , 6.56868473808043274e-14         , 1.17109128658081698e-14         , 1.75572734396773254e-15         , 2.2742114825241131e-16          , },
+/* x = 24.7        */  {2.58777468041813927e-12         , 2.18733190273777376e-12         , 9.39343762088903451e-13         , 2.72684465034348735e-13         , 6.00869687214003727e-14         , 1.07038140798975893e-14         , 1.60358300552272074e-15         , 2.07580659410204574e-16         , },
+/* x = 24.8        */  {2.37816814654200726e-12         , 2.00740859352253411e-12         , 8.61038964998070318e-13         , 2.49688700765977116e-13         , 5.49684965649628564e-14         , 9.7839600737615127e-15          , 1.46470834398495872e-15         , 1.89480996887715706e-16         , },
+/* x = 24.9        */  {2.18579338859499842e-12         , 1.84247639296645738e-12         , 7.89334782829959658e-13         , 2.28651055249499261e-13         , 5.02897394251250095e-14         , 8.94374361816359913e-15         , 1.3379393447448945e-15          , 1.72968637844116234e-16         , },
+/* x = 25.0        */  {2.00921538692874668e-12         , 1.69127220189089133e-12         , 7.23669384314714373e-13         , 2.09403369574652343e-13         , 4.60126400788927105e-14         , 8.17622462716020123e-15         , 1.22221462487028345e-15         , 1.57903660552931859e-16         , },
+/* x = 25.1        */  {1.84711997792159391e-12         , 1.55264039142541259e-12         , 6.63529170259896935e-13         , 1.91792034458654334e-13         , 4.21024569245962324e-14         , 7.47507134864629088e-15         , 1.11656634240298113e-15         , 1.44158534472176933e-16         , },
+/* x = 25.2        */  {1.69830357504448483e-12         , 1.42552358011732195e-12         , 6.08444601653935403e-13         , 1.75676723002812243e-13         , 3.85274734223390456e-14         , 6.83450676297835379e-15         , 1.02011191420359387e-15         , 1.31617018347486426e-16         , },
+/* x = 25.3        */  {1.56166377173566218e-12         , 1.30895420853907552e-12         , 5.57986391032832273e-13         , 1.60929234474670604e-13         , 3.52587331304933084e-14         , 6.24925972653896909e-15         , 9.32046470161552362e-16         , 1.20173156669666989e-16         , },
+/* x = 25.4        */  {1.43619074985848844e-12         , 1.20204684197171018e-12         , 5.11762025291871677e-13         , 1.4743243933738629e-13          , 3.22697980728628764e-14         , 5.7145204384470732e-15          , 8.51635978053975874e-16         , 1.09730365677835441e-16         , },
+/* x = 25.5        */  {1.320959424150288e-12           , 1.10399113782147969e-12         , 4.69412590925753108e-13         , 1.35079316613271837e-13         , 2.95365283724763552e-14         , 5.22589984625473962e-15         , 7.78210979221538919e-16         , 1.00200600890683714e-16         , },
+/* x = 25.6        */  {1.2151222591229266e-12          , 1.01404541997090825e-12         , 4.30609875234408397e-13         , 1.23772075456817673e-13         , 2.7036881271351669e-14          , 4.7793926407383109e-15          , 7.11160880585783967e-16         , 9.15035988684846648e-17         , },
+/* x = 25.7        */  {1.11790270039903707e-12         , 9.31530807321626773e-13         , 3.95053719359744798e-13         , 1.13421353530842245e-13         , 2.47507278225978768e-14         , 4.37134352109155241e-15         , 6.49928753407560282e-16         , 8.35661865636729025e-17         , },
+/* x = 25.8        */  {1.02858916750795398e-12         , 8.55825848397816646e-13         , 3.62469601140758167e-13         , 1.03945485433972737e-13         , 2.26596856933531954e-14         , 3.99841644023655768e-15         , 5.94006593623827042e-16         , 7.63216522140552999e-17         , },
+/* x = 25.9        */  {9.46529559765010903e-13         , 7.86361618085146167e-13         , 3.32606427709145673e-13         , 9.52698350241135089e-14         , 2.07469666556326377e-14         , 3.6575665658350202e-15          , 5.42931002639344171e-16         , 6.9709172275253697e-17          , },
+/* x = 26.0        */  {8.71126231055601769e-13         , 7.22617236416560807e-13         , 3.05234519511358427e-13         , 8.73261860260918865e-14         , 1.89972374683870175e-14         , 3.34601471613623641e-15         , 4.96279251126635391e-16         , 6.36732893827018531e-17         , },
+/* x = 26.1        */  {8.01831393176616117e-13         , 6.64115772815814575e-13         , 2.80143769051129065e-13         , 8.00521858069955681e-14         , 1.73964929690611978e-14         , 3.06122405124633614e-15         , 4.53665691734658124e-16         , 5.81634367828160762e-17         , },
+/* x = 26.2        */  {7.38142910884709819e-13         , 6.10420502401947345e-13         , 2.5714195911269632e-13          , 7.33908376541255397e-14         , 1.5931940297688206e-14          , 2.80087881993459376e-15         , 4.14738489653524799e-16         , 5.31335050818417126e-17         , },
+/* x = 26.3        */  {6.79600454992714082e-13         , 5.61131483870126055e-13         , 2.36053226561806742e-13         , 6.72900373018921265e-14         , 1.45918932719819726e-14         , 2.56286497987911581e-15         , 3.79176642756384146e-16         , 4.85414475329909475e-17         , },
+/* x = 26.4        */  {6.25781982769071827e-13         , 5.15882431121078259e-13         , 2.16716659040562535e-13         , 6.17021498289395241e-14         , 1.33656760188276953e-14         , 2.34525252545213063e-15         , 3.46687265564748985e-16         , 4.43489204211466899e-17         , },
+/* x = 26.5        */  {5.76300517554919246e-13         , 4.74337853235268257e-13         , 1.98985012983743921e-13         , 5.65836233885378309e-14         , 1.22435350467733166e-14         , 2.14627937189686662e-15         , 3.17003113582494503e-16         , 4.05209554126285307e-17         , },
+/* x = 26.6        */  {5.30801201941548548e-13         , 4.36190439599518915e-13         , 1.82723542397875865e-13         , 5.1894636546783738e-14          , 1.12165590162885033e-14         , 1.96433665818314535e-15         , 2.89880326636779357e-16         , 3.70256610180431615e-17         , },
+/* x = 26.7        */  {4.88958601067782757e-13         , 4.01158669011669884e-13         , 1.67808928768698322e-13         , 4.75987762870906332e-14         , 1.02766055303072142e-14         , 1.79795534306524434e-15         , 2.65096371769760368e-16         , 3.38339505715686199e-17         , },
+/* x = 26.8        */  {4.50474234620765969e-13         , 3.68984623430133886e-13         , 1.54128303305732015e-13         , 4.36627439982749921e-14         , 9.41623432747853794e-15         , 1.64579398001061625e-15         , 2.42448167960012617e-16         , 3.09192943624192947e-17         , },
+/* x = 26.9        */  {4.15074317971695269e-13         , 3.39431988715407695e-13         , 1.41578353501502401e-13         , 4.00560869994892203e-14         , 8.62864631513886968e-15         , 1.50662756681936796e-15         , 2.21750376532346939e-16         , 2.82574937657717567e-17         , },
+/* x = 27.0        */  {3.82507694565481976e-13         , 3.1228422624388025e-13          , 1.30064506684248236e-13         , 3.67509533703433015e-14         , 7.90762792876096158e-15         , 1.37933737500091237e-15         , 2.02833842553173258e-16         , 2.58264754129787118e-17         , },
+/* x = 27.1        */  {3.52543943224265152e-13         , 2.8734290067357169e-13          , 1.19500183882571488e-13         , 3.37218680506493568e-14         , 7.24750034996377681e-15         , 1.26290167239683884e-15         , 1.85544173818373619e-16         , 2.36061036161686671e-17         , },
+/* x = 27.2        */  {3.24971645431911137e-13         , 2.64426150418507978e-13         , 1.09806117903925508e-13         , 3.09455283530002823e-14         , 6.64307315647463348e-15         , 1.15638726021147165e-15         , 1.69740445233364165e-16         , 2.15780094218769785e-17         , },
+/* x = 27.3        */  {2.99596798951796263e-13         , 2.43367288554020481e-13         , 1.00909730061048955e-13         , 2.84006171943916075e-14         , 6.08960201507992358e-15         , 1.05894175260086032e-15         , 1.55294017471143479e-16         , 1.97254348135942605e-17         , },
+/* x = 27.4        */  {2.76241365303937673e-13         , 2.24013522939145201e-13         , 9.27445604659545283e-14         , 2.60676325017134764e-14         , 5.5827500629088034e-15          , 9.69786533338116497e-16         , 1.42087459783203463e-16         , 1.80330907153375446e-17         , },
+/* x = 27.5        */  {2.54741939699626104e-13         , 2.06224785313405887e-13         , 8.52497472539940443e-14         , 2.39287313814515556e-14         , 5.1185526536626197e-15          , 8.88210329873652789e-16         , 1.30013567738916828e-16         , 1.64870275687188736e-17         , },
+/* x = 27.6        */  {2.34948533010989219e-13         , 1.89872660011735293e-13         , 7.83695505045997863e-14         , 2.19675877675026987e-14         , 4.69338517390187727e-15         , 8.13563350393581606e-16         , 1.18974467489328558e-16         , 1.50745173655704607e-17         , },
+/* x = 27.7        */  {2.1672345624746179e-13          , 1.74839403750538965e-13         , 7.20529169939685752e-14         , 2.01692623736910346e-14         , 4.30393366047854417e-15         , 7.452519342943561e-16           , 1.08880798898372245e-16         , 1.37839461179543433e-17         , },
+/* x = 27.8        */  {1.9994029882833826e-13          , 1.61017048676701457e-13         , 6.6253082251329142e-14          , 1.85200838803264848e-14         , 3.94716797387872172e-15         , 6.82733670878614747e-16         , 9.96509705649634964e-17         , 1.26047158382195067e-17         , },
+/* x = 27.9        */  {1.84482992687166203e-13         , 1.48306581545845841e-13         , 6.092720669735835e-14           , 1.70075403778585396e-14         , 3.62031730382345584e-15         , 6.25512945074304294e-16         , 9.12104803791599058e-17         , 1.15271551844731646e-17         , },
+/* x = 28.0        */  {1.70244954925848784e-13         , 1.36617192512010181e-13         , 5.60360429233794547e-14         , 1.5620180176143458e-14          , 3.3208478031497923e-15          , 5.73136872621264221e-16         , 8.34912958200528369e-17         , 1.05424380021354177e-17         , },
+/* x = 28.1        */  {1.57128302359565705e-13         , 1.25865587573231066e-13         , 5.15436314255484944e-14         , 1.43475211657918351e-14         , 3.04644216392954625e-15         , 5.25191590488209619e-16         , 7.64312887172150676e-17         , 9.64250906081226404e-18         , },
+/* x = 28.2        */  {1.45043131863110461e-13         , 1.15975359231004424e-13         , 4.74170223414668666e-14         , 1.31799679891599432e-14         , 2.79498096613402645e-15         , 4.81298871307267303e-16         , 6.99737196658709967e-17         , 8.82001634815550457e-18         , },
+/* x = 28.3        */  {1.33906860949644874e-13         , 1.06876410390496586e-13         , 4.36260209495126658e-14         , 1.21087363433976752e-14         , 2.56452564405973256e-15         , 4.41113033369143411e-16         , 6.40667677125795853e-17         , 8.06824933922963743e-18         , },
+/* x = 28.4        */  {1.23643623488449852e-13         , 9.85044269565976079e-14         , 4.01429548854505227e-14         , 1.11257837971198849e-14         , 2.35330292932090919e-15         , 4.04318120233524818e-16         , 5.86631013168539e-17            , 7.3810827116760447e-18          , },
+/* x = 28.5        */  {1.14183715902892328e-13         , 9.08003949719959582e-14         , 3.69424612081915739e-14         , 1.02237465562291006e-14         , 2.15969064160646838e-15         , 3.70625326298200921e-16         , 5.37194869481800214e-17         , 6.75292502410927353e-18         , },
+/* x = 28.6        */  {1.05463089587080941e-13         , 8.37101585006487713e-14         , 3.40012916084198507e-14         , 9.39588166364407856e-15         , 1.98220470969747196e-15         , 3.39770646756451811e-16         , 4.91964320004327507e-17         , 6.17867191811365717e-18         , },
+/* x = 28.7        */  {9.74228856427864791e-14         , 7.71840147862806962e-14         , 3.12981342015356271e-14         , 8.6360141625979993e-15          , 1.8194873155439273e-15          , 3.11512732273528896e-16         , 4.50578589995295942e-17         , 5.65366344330828724e-18         , },
+/* x = 28.8        */  {9.00090083701141032e-14         , 7.11763435135633037e-14         , 2.88134504812272893e-14         , 7.93848879414278908e-15         , 1.67029606359431108e-15         , 2.85630930445988541e-16         , 4.12708083478793911e-17         , 5.17364514055789137e-18         , },
+/* x = 28.9        */  {8.31717342488320808e-14         , 6.56452672718662269e-14         , 2.65293261330992519e-14         , 7.29812583687894078e-15         , 1.53349408613836967e-15         , 2.61923497687195166e-16         , 3.78051670930997147e-17         , 4.73473255083908464e-18         , },
+/* x = 29.0        */  {7.68653534246500954e-14         , 6.05523405701752135e-14         , 2.44293345201831345e-14         , 6.71018073103942518e-15         , 1.40804100323657904e-15         , 2.40205966622118941e-16         , 3.46334214307210204e-17         , 4.33337884681025905e-18         , },
+/* x = 29.1        */  {7.10478409683488557e-14         , 5.58622649789890666e-14         , 2.24984117547810322e-14         , 6.17030716018000904e-15         , 1.29298466293490316e-15         , 2.20309655387029964e-16         , 3.1730430853098556e-17          , 3.96634531103801317e-18         , },
+/* x = 29.2        */  {6.56805554075454582e-14         , 5.15426281826057777e-14         , 2.07227423647889095e-14         , 5.67452329212920768e-15         , 1.18745359396196383e-15         , 2.02080306426143904e-16         , 2.90732220412754187e-17         , 3.63067440933921218e-18         , },
+/* x = 29.3        */  {6.07279622429110988e-14         , 4.75636649148932703e-14         , 1.9089654648205278e-14          , 5.21918090676866117e-15         , 1.09065010903282138e-15         , 1.85376843468003618e-16         , 2.66408007646844761e-17         , 3.32366523002005792e-18         , },
+/* x = 29.4        */  {5.61573803545515917e-14         , 4.38980379249682087e-14         , 1.75875248876571541e-14         , 4.80093716186723643e-15         , 1.00184400228974681e-15         , 1.7007023635876932e-16          , 2.44139802068024722e-17         , 3.04285108012723807e-18         , },
+/* x = 29.5        */  {5.19387493815803587e-14         , 4.05206372775974372e-14         , 1.62056896681210213e-14         , 4.41672876977864258e-15         , 9.20366789341640727e-16         , 1.56042464336183013e-16         , 2.23752242745053425e-17         , 2.78597904834909153e-18         , },
+/* x = 29.6        */  {4.80444163200860037e-14         , 3.7408396437886895e-14          , 1.49343656061733247e-14         , 4.06374837751425231e-15         , 8.4560644286204481e-16          , 1.43185569154556208e-16         , 2.05085045761295973e-17         , 2.55099136107860734e-18         , },
+/* x = 29.7        */  {4.44489397330263143e-14         , 3.45401237221152397e-14         , 1.37645758586130729e-14         , 3.73942296068558241e-15         , 7.77002580809201763e-16         , 1.31400790224795714e-16         , 1.87991698692225378e-17         , 2.33600837352229202e-18         , },
+/* x = 29.8        */  {4.11289101012585276e-14         , 3.18963478174836307e-14         , 1.26880828326511888e-14         , 3.4413940582253427e-15          , 7.14042068075167526e-16         , 1.20597774620691515e-16         , 1.72338268846675163e-17         , 2.13931305174361436e-18         , },
+/* x = 29.9        */  {3.80627849690297361e-14         , 2.9459176184074723e-14          , 1.16973265695068749e-14         , 3.16749968977965472e-15         , 6.56254995786299767e-16         , 1.10693855429329633e-16         , 1.58002315302133309e-17         , 1.95933681428896872e-18         , },
+/* x = 30.0        */  {3.52307376507950053e-14         , 2.72121652533425586e-14         , 1.07853683186005728e-14         , 2.91575781134238604e-15         , 6.03211005593462256e-16         , 1.01613392494924253e-16         , 1.44871895642514343e-17         , 1.79464661366905175e-18         , },
+/* x = 30.1        */  {3.26145183701117215e-14         , 2.5140201429811977e-14          , 9.94583886096027811e-15         , 2.68435117718991179e-15         , 5.54515929133359322e-16         , 9.32871701264731742e-17         , 1.32844659107289759e-17         , 1.6439331485604311e-18          , },
+/* x = 30.2        */  {3.01973267964060055e-14         , 2.32293919871011739e-14         , 9.17289117830444125e-15         , 2.47161348757529638e-15         , 5.09808715436578669e-16         , 8.56518468148808298e-17         , 1.21827018590501497e-17         , 1.50600010724304639e-18         , },
+/* x = 30.3        */  {2.79636950323781674e-14         , 2.14669650265786251e-14         , 8.46115709884195012e-15         , 2.27601671205000327e-15         , 4.68758621425079453e-16         , 7.86494524386197975e-17         , 1.11733394593317437e-17         , 1.3797543515833224e-18          , },
+/* x = 30.4        */  {2.58993801844011511e-14         , 1.98411777375507465e-14         , 7.80570758242201528e-15         , 2.09615948778553346e-15         , 4.31062642801983981e-16         , 7.22269288323112761e-17         , 1.02485524840139076e-17         , 1.26419695888588596e-18         , },
+/* x = 30.5        */  {2.39912657211010039e-14         , 1.83412322624200322e-14         , 7.2020163365335608e-15          , 1.93075650094598421e-15         , 3.96443164607819375e-16         , 6.63357099531652568e-17         , 9.40118338210571024e-18         , 1.15841504623912168e-18         , },
+/* x = 30.6        */  {2.22272708919693458e-14         , 1.69571985292760747e-14         , 6.64592648103168007e-15         , 1.77862876708757058e-15         , 3.64645812516405309e-16         , 6.09313382091013469e-17         , 8.62468570274226953e-18         , 1.06157430863431861e-18         , },
+/* x = 30.7        */  {2.0596267538872512e-14          , 1.56799434683596644e-14         , 6.13362000357388591e-15         , 1.63869473379848591e-15         , 3.3543748758552569e-16          , 5.59731138123682748e-17         , 7.91307151067901036e-18         , 9.72912208202627967e-19         , },
+/* x = 30.8        */  {1.90880036891729365e-14         , 1.45010660782076158e-14         , 5.66158976977843875e-15         , 1.50996213540213678e-15         , 3.08604568676150151e-16         , 5.14237742961429454e-17         , 7.26086335824331032e-18         , 8.91731757440996171e-19         , },
+/* x = 30.9        */  {1.76930333703063333e-14         , 1.34128378524399464e-14         , 5.22661387225093542e-15         , 1.39152053558354236e-15         , 2.83951268121863088e-16         , 4.72492015812415127e-17         , 6.66305041646368804e-18         , 8.17395844335489328e-19         , },
+/* x = 31.0        */  {1.6402652132466252e-14          , 1.24081481194539771e-14         , 4.82573212102784733e-15         , 1.28253449931250552e-15         , 2.61298127478781624e-16         , 4.34181542078324593e-17         , 6.11504840292907811e-18         , 7.49322051881545527e-19         , },
+/* x = 31.1        */  {1.52088378089039484e-14         , 1.14804538850729064e-14         , 4.45622449480674864e-15         , 1.1822373404736245e-15          , 2.40480641326056665e-16         , 3.99020225548347834e-17         , 5.61266297569380966e-18         , 6.86977928685351357e-19         , },
+/* x = 31.2        */  {1.41041960825928622e-14         , 1.06237338027618089e-14         , 4.11559138770944617e-15         , 1.08992539621391005e-15         , 2.2134799812758877e-16          , 3.66746050592719104e-17         , 5.15205629150934279e-18         , 6.29876671144869768e-19         , },
+/* x = 31.3        */  {1.3081910463941069e-14          , 9.83244592764807745e-15         , 3.80153550038106406e-15         , 1.00495278322164553e-15         , 2.03761928115548651e-16         , 3.37119036208370373e-17         , 4.729716453079151e-18           , 5.77573181185955112e-19         , },
+/* x = 31.4        */  {1.21356963171432042e-14         , 9.10148893951838717e-15         , 3.51194523707942241e-15         , 9.26726594989799588e-16         , 1.87595649023601097e-16         , 3.09919365347696403e-17         , 4.34242959412391107e-18         , 5.29660466698450243e-19         , },
+/* x = 31.5        */  {1.1259758602902738e-14          , 8.42616654644087025e-15         , 3.24487948215892894e-15         , 8.54702502625362785e-16         , 1.72732901289623269e-16         , 2.84945674401779494e-17         , 3.98725437301588505e-18         , 4.85766354706469942e-19         , },
+/* x = 31.6        */  {1.04487530328612671e-14         , 7.80215480488996327e-15         , 2.9985536400967699e-15          , 7.88380724971258436e-16         , 1.59067065070779848e-16         , 2.62013489023827032e-17         , 3.66149866578131874e-18         , 4.45550489941101279e-19         , },
+/* x = 31.7        */  {9.69775035635870532e-15         , 7.2254721144247823e-15          , 2.7713268330332692e-15          , 7.27302336736280685e-16         , 1.46500352074084689e-16         , 2.40953793678105274e-17         , 3.36269826754848343e-18         , 4.08701593885146054e-19         , },
+/* x = 31.8        */  {9.00220352331350188e-15         , 6.69245166526573843e-15         , 2.56169015878217006e-15         , 6.71045886004846433e-16         , 1.34943065808529019e-16         , 2.21611723394401298e-17         , 3.08859742819216218e-18         , 3.74934961548926622e-19         , },
+/* x = 31.9        */  {8.35791748823510632e-15         , 6.1997161356891193e-15          , 2.36825592048268563e-15         , 6.19224294944122984e-16         , 1.24312924415495158e-16         , 2.03845367207213922e-17         , 2.83713106313464512e-18         , 3.43990175232370551e-19         , },
+/* x = 32.0        */  {7.76102143982625015e-15         , 5.74415445316237627e-15         , 2.18974774657958605e-15         , 5.7148201976130715e-16          , 1.14534440737068479e-16         , 1.8752467367085352e-17          , 2.60640849413780635e-18         , 3.15629016348704982e-19         , },
+/* x = 32.1        */  {7.20794325845062874e-15         , 5.32290044870807608e-15         , 2.02499152669072863e-15         , 5.27492448006736527e-16         , 1.0553835474117389e-16          , 1.72530449674070038e-17         , 2.39469858757829835e-18         , 2.89633558044727968e-19         , },
+/* x = 32.2        */  {6.69538602006978938e-15         , 4.93331324823455857e-15         , 1.87290709520845015e-15         , 4.86955513185770205e-16         , 9.72611138419966742e-17         , 1.587534445377036e-17           , 2.20041616924560129e-18         , 2.65804422865993483e-19         , },
+/* x = 32.3        */  {6.22030638021729002e-15         , 4.57295925761839866e-15         , 1.73250060023250521e-15         , 4.49595508349192195e-16         , 8.96443970373676256e-17         , 1.46093512072523547e-17         , 2.02210960523839039e-18         , 2.43959191095297828e-19         , },
+/* x = 32.4        */  {5.77989468529359024e-15         , 4.2395956102702802e-15          , 1.60285750069376948e-15         , 4.15159081892149691e-16         , 8.26346791348621611e-17         , 1.34458843907689906e-17         , 1.85844944814756277e-18         , 2.23930946651385189e-19         , },
+/* x = 32.5        */  {5.37155667103697106e-15         , 3.93115495685553057e-15         , 1.48313613934176895e-15         , 3.83413400218013883e-16         , 7.61828316581682605e-17         , 1.23765267978425751e-17         , 1.70821805648554138e-18         , 2.05566948582548481e-19         , },
+/* x = 32.6        */  {4.99289661955039452e-15         , 3.6457314868589778e-15          , 1.37256184367364945e-15         , 3.5414446322761468e-16          , 7.02437573174519843e-17         , 1.13935606589353701e-17         , 1.57030010332520537e-18         , 1.88727417236582921e-19         , },
+/* x = 32.7        */  {4.64170185682975773e-15         , 3.38156808085927362e-15         , 1.27042151091254833e-15         , 3.27155559786616944e-16         , 6.47760551943947234e-17         , 1.048990889519245e-17           , 1.44367389741549678e-18         , 1.732844251432788e-19           , },
+/* x = 32.8        */  {4.31592848242612822e-15         , 3.13704450078196329e-15         , 1.17605863683152925e-15         , 3.02265851414020857e-16         , 5.97417140364858944e-17         , 9.65908135344629228e-18         , 1.32740344670596753e-18         , 1.59120883516449512e-19         , },
+/* x = 32.9        */  {4.01368823175708253e-15         , 2.91066653309883294e-15         , 1.08886875159457936e-15         , 2.7930907343169092e-16          , 5.51058312780294878e-17         , 8.8951255965236199e-18          , 1.2206312002953688e-18          , 1.46129616076792231e-19         , },
+/* x = 33.0        */  {3.73323637972775742e-15         , 2.70105600699328358e-15         , 1.00829522887540958e-15         , 2.58132343726489946e-16         , 5.08363556089888161e-17         , 8.19258185959511403e-18         , 1.12257141037100189e-18         , 1.34212512621425582e-19         , },
+/* x = 33.1        */  {3.47296060179249041e-15         , 2.50694161597240433e-15         , 9.33825437342399985e-16         , 2.38595070110361368e-16         , 4.69038510989176665e-17         , 7.54644181682534049e-18         , 1.03250406077258618e-18         , 1.23279755426896376e-19         , },
+/* x = 33.2        */  {3.23137071543956104e-15         , 2.32715047732610558e-15         , 8.64987206186342651e-16         , 2.20567948026273194e-16         , 4.3281281053328987e-17          , 6.95211083319138728e-18         , 9.49769313439381308e-19         , 1.1324911217540563e-19          , },
+/* x = 33.3        */  {3.00708923136634796e-15         , 2.16060036925791057e-15         , 8.01345578737081324e-16         , 2.03932041045436471e-16         , 3.99438099353227159e-17         , 6.40537340429770631e-18         , 8.73762428221003382e-19         , 1.04045289644085342e-19         , },
+/* x = 33.4        */  {2.7988426493776088e-15          , 2.00629259048266946e-15         , 7.42499830384398435e-16         , 1.88577937239235835e-16         , 3.68686218273997718e-17         , 5.90236151255269166e-18         , 8.0392911538615572e-19          , 9.55993428990217416e-20         , },
+/* x = 33.5        */  {2.60545343932898355e-15         , 1.86330539164185944e-15         , 6.88080729004621048e-16         , 1.74404975092970696e-16         , 3.40347540382865165e-17         , 5.43952565140054022e-18         , 7.39761283681596467e-19         , 8.78481351936155698e-20         , },
+/* x = 33.6        */  {2.42583265229096655e-15         , 1.73078793206231211e-15         , 6.37748017913005432e-16         , 1.61320533162471698e-16         , 3.14229445783393309e-17         , 5.01360829061237814e-18         , 6.80793150005490449e-19         , 8.07338441886667174e-20         , },
+/* x = 33.7        */  {2.25897311156188198e-15         , 1.60795471921122341e-15         , 5.91188103027274737e-16         , 1.49239378163193281e-16         , 2.90154923356565426e-17         , 4.62161957510909877e-18         , 6.26597679691655538e-19         , 7.42035104927987137e-20         , },
+/* x = 33.8        */  {2.10394313724516179e-15         , 1.49408049170848435e-15         , 5.48111927452761219e-16         , 1.38083066628385858e-16         , 2.67961288842751158e-17         , 4.26081506757507065e-18         , 5.76783329078569095e-19         , 6.82086248697149707e-20         , },
+/* x = 33.9        */  {1.9598807618569839e-15          , 1.38849550997355946e-15         , 5.08253018096361746e-16         , 1.27779395681980003e-16         , 2.47499009465760333e-17         , 3.92867536137304988e-18         , 5.30991064481651782e-19         , 6.27047507762363234e-20         , },
+/* x = 34.0        */  {1.82598839787303651e-15         , 1.29058122153289376e-15         , 4.71365690195849772e-16         , 1.18261898846122703e-16         , 2.28630626149990681e-17         , 3.62288740511969511e-18         , 4.88891633919637019e-19         , 5.76511791847818771e-20         , },
+/* x = 34.1        */  {1.70152792128343342e-15         , 1.19976627071762025e-15         , 4.37223396822962586e-16         , 1.09469383145863876e-16         , 2.11229765140448086e-17         , 3.34132739384979986e-18         , 4.5018306998431995e-19          , 5.30106129083600871e-20         , },
+/* x = 34.2        */  {1.58581613812606968e-15         , 1.11552282496073566e-15         , 4.056172114922107e-16           , 1.0134550408701569e-16          , 1.9518023152931337e-17          , 3.08204509409685355e-18         , 4.1458840410458553e-19          , 4.87488778874567828e-20         , },
+/* x = 34.3        */  {1.47822060363245963e-15         , 1.03736319217673723e-15         , 3.76354432990869176e-16         , 9.38383753701792632e-17         , 1.80375177827337275e-17         , 2.84324948154924579e-18         , 3.81853574155780537e-19         , 4.48346591184678064e-20         , },
+/* x = 34.4        */  {1.37815576606602443e-15         , 9.64836705792195994e-16         , 3.49257302446728803e-16         , 8.69002104666209801e-17         , 1.66716341298769446e-17         , 2.62329558029791034e-18         , 3.51745508918303713e-19         , 4.12392591043736924e-20         , },
+/* x = 34.5        */  {1.28507940957892692e-15         , 8.97526855908655032e-16         , 3.2416182347587815e-16          , 8.04869934221566713e-17         , 1.54113344309429225e-17         , 2.42067240215696811e-18         , 3.24050374307590827e-19         , 3.79363768918770623e-20         , },
+/* x = 34.6        */  {1.19848937247641304e-15         , 8.35048646834021969e-16         , 3.00916677009430647e-16         , 7.45581764753606209e-17         , 1.42483052423164054e-17         , 2.23399189319110353e-18         , 2.98571967593189912e-19         , 3.49019059267564171e-20         , },
+/* x = 34.7        */  {1.11792051917235288e-15         , 7.77046162828491964e-16         , 2.79382223091535601e-16         , 6.90764022779894933e-17         , 1.31748985426204275e-17         , 2.06197880249241068e-18         , 2.75130247008051531e-19         , 3.21137491121336928e-20         , },
+/* x = 34.8        */  {1.04294194586015924e-15         , 7.23190325388092791e-16         , 2.59429582576553072e-16         , 6.40072486900816116e-17         , 1.21840776865363908e-17         , 1.90346139547955434e-18         , 2.53559985230258223e-19         , 2.95516495939848923e-20         , },
+/* x = 34.9        */  {9.7315440152221534e-16          , 6.73176826744268933e-16         , 2.40939792235810426e-16         , 5.93189942912066023e-17         , 1.12693678057901138e-17         , 1.75736294060199326e-18         , 2.33709536207090341e-19         , 2.71970359257084518e-20         , },
+/* x = 35.0        */  {9.08187907370024296e-16         , 6.26724225501664165e-16         , 2.23803027318358382e-16         , 5.4982402904122118e-17          , 1.04248102871104762e-17         , 1.62269390437528958e-18         , 2.15439705693697447e-19         , 2.50328803799673835e-20         , },
+/* x = 35.1        */  {8.47699559157189114e-16         , 5.83572191477715113e-16         , 2.07917886099692344e-16         , 5.09705255688526183e-17         , 9.64492098810226638e-18         , 1.49854479519910194e-18         , 1.98622716703129473e-19         , 2.30435692823078642e-20         , },
+/* x = 35.2        */  {7.91371498047838505e-16         , 5.43479887855342497e-16         , 1.93190731401239292e-16         , 4.72585185350459044e-17         , 8.9246518804670771e-18          , 1.38407960146200124e-18         , 1.83141261817846311e-19         , 2.12147843381128106e-20         , },
+/* x = 35.3        */  {7.38909036863215127e-16         , 5.06224479721717907e-16         , 1.79535084474952948e-16         , 4.38234759593974396e-17         , 8.25935583608173868e-18         , 1.27852977405754975e-18         , 1.68887635001243217e-19         , 1.95333940130804697e-20         , },
+/* x = 35.4        */  {6.90038929577073593e-16         , 4.71599758948932556e-16         , 1.66871067024741379e-16         , 4.06442761038851344e-17         , 7.6447542953095064e-18          , 1.18118870766139638e-18         , 1.55762936176838224e-19         , 1.79873541083606675e-20         , },
+/* x = 35.5        */  {6.44507772893848877e-16         , 4.39414876182941992e-16         , 1.55124887482537521e-16         , 3.77014399303738585e-17         , 7.07690757876388485e-18         , 1.09140667898348368e-18         , 1.43676342417710307e-19         , 1.65656167454061121e-20         , },
+/* x = 35.6        */  {6.02080529629177427e-16         , 4.09493171451400004e-16         , 1.44228367974237265e-16         , 3.49770010786028475e-17         , 6.55218762374117862e-18         , 1.00858620374390434e-18         , 1.32544440114248383e-19         , 1.52580470431151221e-20         , },
+/* x = 35.7        */  {5.62539164426635695e-16         , 3.81671095584416793e-16         , 1.34118508701873014e-16         , 3.24543862983677624e-17         , 6.06725294484335409e-18         , 9.32177777353865353e-19         , 1.22290612968556969e-19         , 1.40553468315138056e-20         , },
+/* x = 35.8        */  {5.25681383093330449e-16         , 3.55797215269911929e-16         , 1.24737086735460967e-16         , 3.0118305483499452e-17          , 5.61902563507176517e-18         , 8.61675967240535014e-19         , 1.12844481102876513e-19         , 1.29489848025595198e-20         , },
+/* x = 35.9        */  {4.91319467525576923e-16         , 3.31731295141692175e-16         , 1.16030286452970264e-16         , 2.79546505256153133e-17         , 5.20467023901652878e-18         , 7.96615827459939688e-19         , 1.04141386970686358e-19         , 1.19311325501082533e-20         , },
+/* x = 36.0        */  {4.59279198829237782e-16         , 3.09343450827892977e-16         , 1.07948359091654062e-16         , 2.59504022701179945e-17         , 4.82157434381630859e-18         , 7.3656960871717051e-19          , 9.61219241260264328e-20         , 1.09946059981005401e-20         , },
+/* x = 36.1        */  {4.29398861821866788e-16         , 2.88513367373852733e-16         , 1.00445309080243657e-16         , 2.40935449160353703e-17         , 4.46733074642911296e-18         , 6.81143739177714827e-19         , 8.87315052419766795e-20         , 1.01328117589706462e-20         , },
+/* x = 36.2        */  {4.01528324639733628e-16         , 2.69129577900390315e-16         , 9.34786050107818863e-17         , 2.23729872554884692e-17         , 4.13972106753712355e-18         , 6.29976053525793746e-19         , 8.19199660758887888e-20         , 9.33969800352524187e-21         , },
+/* x = 36.3        */  {3.75528187665888563e-16         , 2.51088797769082276e-16         , 8.70089132825759624e-17         , 2.07784901982550176e-17         , 3.83670069319960369e-18         , 5.82733249621658805e-19         , 7.56412023593544919e-20         , 8.60970945939285426e-21         , },
+/* x = 36.4        */  {3.51268996449133567e-16         , 2.34295309903469591e-16         , 8.09998526101785065e-17         , 1.93006000724449705e-17         , 3.55638493525176378e-18         , 5.39108553844946689e-19         , 6.98528368472844929e-20         , 7.93774618790820782e-21         , },
+/* x = 36.5        */  {3.2863051370129098e-16          , 2.18660397261899224e-16         , 7.54177677336455189e-17         , 1.79305872340680601e-17         , 3.29703631050105317e-18         , 4.98819577799181057e-19         , 6.45159139949312635e-20         , 7.31912581923452494e-21         , },
+},
+};
@@ -0,0 +1,12 @@
+#pragma once
+
+#define BOYS_BLOCKED_K 4
+#define BOYS_BLOCKED_NBLOCK 7
+#define BOYS_BLOCKED_MAXN 24
+#define BOYS_BLOCKED_NTERM 8
+#define BOYS_BLOCKED_MAXX 36.5
+#define BOYS_BLOCKED_SPACE 0.1
+#define BOYS_BLOCKED_NPOINT 366
+#define BOYS_BLOCKED_LOOKUPFAC 10.0
+#define BOYS_BLOCKED_LOOKUPFAC2 0.05
+
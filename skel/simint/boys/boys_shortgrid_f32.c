@@ -0,0 +1,382 @@
+/*
+ Generated with:
+   ../../../python/boys/gen_boys_shortgrid.py --filename boys_shortgrid_f32 --max-n 31 --max-x 36.5 --spacing 0.1 --layout single
+------------------------------------
+Options for Boys function Fn(x):
+    Max n: 31
+    Max x: 36.5
+  Spacing: 0.1
+  npoints: 366
+      DPS: 256
+------------------------------------
+*/
+
+const float boys_shortgrid_f32[366][32] = 
+{
+/* x = 0.0         */  {1.0f              , 0.333333333f      , 0.2f              , 0.142857143f      , 0.111111111f      , 0.0909090909f     , 0.0769230769f     , 0.0666666667f     , 0.0588235294f     , 0.0526315789f     , 0.0476190476f     , 0.0434782609f     , 0.04f             , 0.037037037f      , 0.0344827586f     , 0.0322580645f     , 0.0303030303f     , 0.0285714286f     , 0.027027027f      , 0.0256410256f     , 0.0243902439f     , 0.023255814f      , 0.0222222222f     , 0.0212765957f     , 0.0204081633f     , 0.0196078431f     , 0.0188679245f     , 0.0181818182f     , 0.0175438596f     , 0.0169491525f     , 0.0163934426f     , 0.0158730159f     , },
+/* x = 0.1         */  {0.967643313f      , 0.314029473f      , 0.186255005f      , 0.13218803f       , 0.102393947f      , 0.083540528f      , 0.0705419508f     , 0.061039713f      , 0.053791384f      , 0.0480805503f     , 0.0434651897f     , 0.0396578309f     , 0.0364634577f     , 0.0337451178f     , 0.0314038159f     , 0.029366219f      , 0.0275768488f     , 0.025992961f      , 0.0245810906f     , 0.0233146636f     , 0.0221723109f     , 0.0211366535f     , 0.0201934126f     , 0.0193307483f     , 0.01853876f       , 0.0178091051f     , 0.0171347042f     , 0.0165095106f     , 0.015928329f      , 0.0153866703f     , 0.0148806358f     , 0.0144068233f     , },
+/* x = 0.2         */  {0.937150029f      , 0.296048189f      , 0.173534537f      , 0.12235483f       , 0.0943826509f     , 0.076782763f      , 0.0646991009f     , 0.0558938954f     , 0.0491941944f     , 0.0439263813f     , 0.0396762282f     , 0.0361750968f     , 0.0332411834f     , 0.0307470775f     , 0.0286008466f     , 0.0267344974f     , 0.025096663f      , 0.0236478163f     , 0.0223570455f     , 0.0211998292f     , 0.0201564667f     , 0.019210949f      , 0.0183501334f     , 0.0175631295f     , 0.0168408365f     , 0.0161755904f     , 0.0155608911f     , 0.0149911898f     , 0.0144617211f     , 0.0139683691f     , 0.0135075611f     , 0.0130761802f     , },
+/* x = 0.3         */  {0.908392877f      , 0.279291094f      , 0.161758435f      , 0.113289925f      , 0.0870187558f     , 0.0705843032f     , 0.0593485236f     , 0.0511876431f     , 0.0449940443f     , 0.0401342195f     , 0.0362199169f     , 0.0330000564f     , 0.0303051267f     , 0.0280165792f     , 0.0260490303f     , 0.0243394306f     , 0.0228402157f     , 0.02151483f       , 0.0203347181f     , 0.0192772507f     , 0.0183242641f     , 0.0174610106f     , 0.0166753923f     , 0.0159573916f     , 0.0152986425f     , 0.014692104f      , 0.0141318079f     , 0.0136126618f     , 0.0131302944f     , 0.0126809322f     , 0.0122613008f     , 0.0118685447f     , },
+/* x = 0.4         */  {0.881254035f      , 0.263667486f      , 0.150853015f      , 0.104931289f      , 0.0802487211f     , 0.0648980543f     , 0.0544481887f     , 0.0468830082f     , 0.0411563459f     , 0.0366722919f     , 0.033066874f      , 0.0301053846f     , 0.0276297508f     , 0.0255296546f     , 0.0237257857f     , 0.0221596729f     , 0.0207872683f     , 0.0195747618f     , 0.0184957724f     , 0.0175294154f     , 0.0166589429f     , 0.0158707686f     , 0.0151537555f     , 0.0144986882f     , 0.013897876f      , 0.01334485f       , 0.0128341298f     , 0.012361042f      , 0.0119215766f     , 0.0115122738f     , 0.0111301324f     , 0.0107725365f     , },
+/* x = 0.5         */  {0.855624392f      , 0.249093732f      , 0.140750537f      , 0.0972220244f     , 0.0740235112f     , 0.0596809411f     , 0.0499596928f     , 0.0429453471f     , 0.0376495465f     , 0.0335116308f     , 0.0301903264f     , 0.0274661942f     , 0.025191806f      , 0.0232644899f     , 0.0216105679f     , 0.0201758089f     , 0.0189194176f     , 0.0178101201f     , 0.0168235424f     , 0.0159404086f     , 0.0151452752f     , 0.0144256247f     , 0.0137712044f     , 0.0131735364f     , 0.0126255502f     , 0.0121213024f     , 0.0116557603f     , 0.0112246347f     , 0.0108242471f     , 0.010451425f      , 0.0101034178f     , 0.00977782889f    , },
+/* x = 0.6         */  {0.831402871f      , 0.235492696f      , 0.13138871f       , 0.0901099272f     , 0.0682982121f     , 0.0548935608f     , 0.0458479441f     , 0.0393430312f     , 0.0344448604f     , 0.0306258257f     , 0.027565877f      , 0.0250598168f     , 0.0229701246f     , 0.0212012318f     , 0.0196846845f     , 0.018370179f      , 0.0172199285f     , 0.0162050026f     , 0.0153028799f     , 0.0144957678f     , 0.0137694248f     , 0.0131123173f     , 0.0125150059f     , 0.0119696911f     , 0.0114698723f     , 0.0110100882f     , 0.0105857174f     , 0.0101928231f     , 0.00982803076f    , 0.00948843119f    , 0.00917150324f    , 0.00887505112f    , },
+/* x = 0.7         */  {0.808495807f      , 0.222793217f      , 0.122710247f      , 0.0835470936f     , 0.0630316796f     , 0.0504998661f     , 0.0420808738f     , 0.0360471825f     , 0.0315160246f     , 0.0279907955f     , 0.0251712929f     , 0.0228656048f     , 0.0209454335f     , 0.0193218105f     , 0.017931128f      , 0.01672672f       , 0.0156735829f     , 0.0147449522f     , 0.0139200161f     , 0.01318235f       , 0.01251882f       , 0.0119187985f     , 0.0113735944f     , 0.0108760317f     , 0.0104201334f     , 0.0100008813f     , 0.00961403135f    , 0.00925596992f    , 0.00892360112f    , 0.00861425733f    , 0.0083256276f     , 0.00805570008f    , },
+/* x = 0.8         */  {0.78681637f       , 0.210929629f      , 0.114662452f      , 0.0774895591f     , 0.0581862185f     , 0.0464668765f     , 0.0386291735f     , 0.0330314324f     , 0.0288390762f     , 0.0255845823f     , 0.0229863126f     , 0.0208647504f     , 0.0191001844f     , 0.0176097793f     , 0.0163344233f     , 0.0152308204f     , 0.0142665419f     , 0.0134168246f     , 0.0126624352f     , 0.0119882109f     , 0.0113820381f     , 0.0108341234f     , 0.0103364644f     , 0.00988245828f    , 0.00946660926f    , 0.00908430598f    , 0.00873165069f    , 0.00840532641f    , 0.0081024928f     , 0.00782070354f    , 0.00755784032f    , 0.00731205975f    , },
+/* x = 0.9         */  {0.766284044f      , 0.199841324f      , 0.107196841f      , 0.0718969687f     , 0.0537272895f     , 0.0427644145f     , 0.0354660556f     , 0.030271702f      , 0.0263921502f     , 0.0233871635f     , 0.0209924703f     , 0.0190401207f     , 0.0174183985f     , 0.0160501682f     , 0.0148804896f     , 0.0138691889f     , 0.0129862201f     , 0.0122086694f     , 0.0115187608f     , 0.0109024954f     , 0.0103486997f     , 0.00984834864f    , 0.00939407325f    , 0.00897979796f    , 0.00860046915f    , 0.0082518491f     , 0.00793035795f    , 0.00763295089f    , 0.00735702192f    , 0.00710032757f    , 0.00686092608f    , 0.00663712832f    , },
+/* x = 1.0         */  {0.746824133f      , 0.189472346f      , 0.100268798f      , 0.0667322748f     , 0.0496232411f     , 0.0393648645f     , 0.0325670342f     , 0.027746002f      , 0.0241552941f     , 0.0213802797f     , 0.0191729361f     , 0.0173761084f     , 0.0158855257f     , 0.0146293507f     , 0.0135565142f     , 0.012629735f      , 0.0118211722f     , 0.0111096213f     , 0.0104786518f     , 0.00991533817f    , 0.00940937372f    , 0.00895244063f    , 0.0085377529f     , 0.00815971977f    , 0.00781369394f    , 0.00749578091f    , 0.00720269263f    , 0.00693163398f    , 0.00668021387f    , 0.00644637483f    , 0.00622833681f    , 0.00602455203f    , },
+/* x = 1.1         */  {0.728367324f      , 0.179771018f      , 0.0938372595f     , 0.0619614608f     , 0.0458450644f     , 0.0362429527f     , 0.0299097256f     , 0.0254342496f     , 0.0221102998f     , 0.0195472788f     , 0.0175123701f     , 0.0158584948f     , 0.0144883166f     , 0.0133349232f     , 0.0123508378f     , 0.01150146f       , 0.0107609893f     , 0.0101098012f     , 0.00953270771f    , 0.0090177734f     , 0.00855549041f    , 0.0081381923f     , 0.00775962954f    , 0.00741465716f    , 0.00709900134f    , 0.0068090828f     , 0.00654188136f    , 0.00629483103f    , 0.00606573783f    , 0.00585271474f    , 0.00565412995f    , 0.00546856513f    , },
+/* x = 1.2         */  {0.710849269f      , 0.170689607f      , 0.0878644208f     , 0.0575532883f     , 0.0423661692f     , 0.0333755464f     , 0.0274736659f     , 0.0233181021f     , 0.02024055f       , 0.0178729741f     , 0.0159967902f     , 0.0144743263f     , 0.0132147056f     , 0.0121555946f     , 0.0112528507f     , 0.0104743582f     , 0.00979620472f    , 0.00920022662f    , 0.00867238318f    , 0.00820165236f    , 0.00777926257f    , 0.00739814729f    , 0.00705255073f    , 0.00673773786f    , 0.00644977813f    , 0.00618538178f    , 0.0059417746f     , 0.00571660082f    , 0.00550784722f    , 0.00531378308f    , 0.00513291241f    , 0.00496393546f    , },
+/* x = 1.3         */  {0.694210212f      , 0.162184007f      , 0.0823154727f     , 0.0534790657f     , 0.0391621795f     , 0.03074147f       , 0.0252401451f     , 0.0213808051f     , 0.0185308782f     , 0.016343514f      , 0.0146134512f     , 0.0132118011f     , 0.0120537047f     , 0.0110810862f     , 0.010252898f      , 0.00953932697f    , 0.00891820884f    , 0.00837273026f    , 0.00788991006f    , 0.00745956896f    , 0.00707361401f    , 0.00672553123f    , 0.00641001922f    , 0.00612272003f    , 0.00586001857f    , 0.00561889107f    , 0.00539678911f    , 0.00519154982f    , 0.00500132579f    , 0.0048245296f     , 0.00465978971f    , 0.004505915f      , },
+/* x = 1.4         */  {0.678394636f      , 0.154213454f      , 0.0771583569f     , 0.0497124359f     , 0.0362107456f     , 0.028321338f      , 0.0231920549f     , 0.0196070533f     , 0.0169674414f     , 0.0149462643f     , 0.0133507347f     , 0.0120601663f     , 0.0109953071f     , 0.0101020409f     , 0.00934219319f    , 0.00868808525f    , 0.00811917102f    , 0.00761988566f    , 0.00717822652f    , 0.00678479191f    , 0.00643211448f    , 0.00611418921f    , 0.00582613289f    , 0.00556393438f    , 0.00532426859f    , 0.00510435608f    , 0.00490185571f    , 0.00471478167f    , 0.00454143862f    , 0.0043803705f     , 0.00423031984f    , 0.00409019503f    , },
+/* x = 1.5         */  {0.663350946f      , 0.146740262f      , 0.0723635418f     , 0.046229183f      , 0.0334913737f     , 0.026097401f      , 0.0213137503f     , 0.0179828647f     , 0.0155376036f     , 0.0136697004f     , 0.0121980492f     , 0.0110096243f     , 0.0100303992f     , 0.00920993999f    , 0.0085127399f     , 0.00791309895f    , 0.00739196909f    , 0.00693493995f    , 0.00653091269f    , 0.00617120313f    , 0.00584892067f    , 0.00555852908f    , 0.00529553011f    , 0.0050562316f     , 0.00483757503f    , 0.00463700541f    , 0.00445237196f    , 0.00428185133f    , 0.00412388765f    , 0.00397714533f    , 0.00384047142f    , 0.00371286549f    , },
+/* x = 1.6         */  {0.64903117f       , 0.139729579f      , 0.0679038182f     , 0.043007054f      , 0.0309852688f     , 0.0240534067f     , 0.0195909235f     , 0.0164954649f     , 0.0142298299f     , 0.0125033096f     , 0.0111457386f     , 0.0100512476f     , 0.00915068029f    , 0.00839702786f    , 0.00775726073f    , 0.00720751349f    , 0.00673012504f    , 0.0063117526f     , 0.00594213221f    , 0.00561324179f    , 0.00531872248f    , 0.00505346992f    , 0.00481334019f    , 0.00459493457f    , 0.00439543956f    , 0.00421250641f    , 0.00404415911f    , 0.00388872339f    , 0.00374477135f    , 0.00361107783f    , 0.0034865857f     , 0.00337037803f    , },
+/* x = 1.7         */  {0.63539069f       , 0.133149167f      , 0.0637541105f     , 0.0400255966f     , 0.0286751918f     , 0.0221744712f     , 0.0180104879f     , 0.015133182f      , 0.0130335899f     , 0.0114375012f     , 0.0101849995f     , 0.00917690132f    , 0.00834859008f    , 0.00765624348f    , 0.00706913235f    , 0.00656509234f    , 0.00612774665f    , 0.0057447398f     , 0.00540657908f    , 0.00510585346f    , 0.00483669434f    , 0.00459439522f    , 0.00437513838f    , 0.00417579501f    , 0.0039937769f     , 0.00382692475f    , 0.00367342303f    , 0.00353173432f    , 0.0034005481f     , 0.00327874046f    , 0.00316534208f    , 0.00305951256f    , },
+/* x = 1.8         */  {0.622387991f      , 0.126969195f      , 0.0598913048f     , 0.03726601f       , 0.0265453283f     , 0.0204469629f     , 0.0165604731f     , 0.0138853505f     , 0.0119392694f     , 0.0104635256f     , 0.00930780515f    , 0.00837917219f    , 0.00761724227f    , 0.00698115791f    , 0.0064423265f     , 0.00598016116f    , 0.00557947436f    , 0.00522882383f    , 0.00491942936f    , 0.00464444388f    , 0.00439845087f    , 0.00417711037f    , 0.00397690496f    , 0.00379495414f    , 0.00362887682f    , 0.00347668776f    , 0.00333671882f    , 0.00320755816f    , 0.00308800294f    , 0.00297702212f    , 0.00287372683f    , 0.0027773468f     , },
+/* x = 1.9         */  {0.609984426f      , 0.121162054f      , 0.0562940905f     , 0.0347110088f     , 0.024581169f      , 0.0188583952f     , 0.0152299286f     , 0.0127422242f     , 0.0109380905f     , 0.00957339998f    , 0.00850683697f    , 0.00765130449f    , 0.00695036423f    , 0.00636591754f    , 0.0058713564f     , 0.00544755693f    , 0.00508043304f    , 0.00475938711f    , 0.0044762973f     , 0.00422483704f    , 0.0040000067f     , 0.00379780405f    , 0.00361498812f    , 0.00344890689f    , 0.00329736967f    , 0.00315855117f    , 0.0030309186f     , 0.00291317537f    , 0.00280421746f    , 0.00270309894f    , 0.00260900473f    , 0.00252122879f    , },
+/* x = 2.0         */  {0.598144007f      , 0.115702181f      , 0.0529428148f     , 0.0323446977f     , 0.0227694002f     , 0.0173973297f     , 0.0140088358f     , 0.0116948957f     , 0.0100220379f     , 0.00875984046f    , 0.00777542137f    , 0.00698714138f    , 0.00634224211f    , 0.00580519241f    , 0.00535122794f    , 0.00496258179f    , 0.00462618803f    , 0.00433223043f    , 0.00407319544f    , 0.003843237f      , 0.0036377399f     , 0.00345301312f    , 0.00328607024f    , 0.00313446944f    , 0.00299619508f    , 0.00286956887f    , 0.00275318229f    , 0.00264584459f    , 0.00254654235f    , 0.00245440774f    , 0.00236869329f    , 0.0022887518f     , },
+/* x = 2.1         */  {0.586833205f      , 0.110565899f      , 0.0498193499f     , 0.0301524575f     , 0.0210978033f     , 0.0160532861f     , 0.0128880283f     , 0.0107352238f     , 0.00918379243f    , 0.00801620074f    , 0.0071074728f     , 0.00638107156f    , 0.00578767084f    , 0.00529412921f    , 0.00487739532f    , 0.00452096098f    , 0.0042127053f     , 0.0039435349f     , 0.00370649837f    , 0.00349619321f    , 0.00330835877f    , 0.00313959081f    , 0.00298713727f    , 0.00284874973f    , 0.00272257354f    , 0.00260706547f    , 0.00250093116f    , 0.00240307697f    , 0.00231257264f    , 0.00222862193f    , 0.00215053937f    , 0.00207773168f    , },
+/* x = 2.2         */  {0.576020773f      , 0.105731276f      , 0.0469069705f     , 0.0281208395f     , 0.0195551633f     , 0.0148166616f     , 0.011859118f      , 0.00985576706f    , 0.00841666989f    , 0.00733641586f    , 0.00649744159f    , 0.00582798071f    , 0.00528190863f    , 0.00482830849f    , 0.00444572065f    , 0.00411880468f    , 0.00383631513f    , 0.00358982747f    , 0.00337290979f    , 0.00318056907f    , 0.00300887172f    , 0.00285467773f    , 0.00271545088f    , 0.0025891207f     , 0.00247398058f    , 0.00236861142f    , 0.00227182368f    , 0.00218261288f    , 0.00210012507f    , 0.00202362965f    , 0.001952498f      , 0.00188618624f    , },
+/* x = 2.3         */  {0.565677574f      , 0.101177985f      , 0.0441902415f     , 0.0262374704f     , 0.0181311845f     , 0.0136786559f     , 0.0109144285f     , 0.00904972309f    , 0.00771456579f    , 0.00671495104f    , 0.00594026653f    , 0.00532320728f    , 0.00482063561f    , 0.00440370574f    , 0.00405243725f    , 0.00375257315f    , 0.00349367914f    , 0.00326794953f    , 0.00306943257f    , 0.0028935133f     , 0.00273655979f    , 0.00259567559f    , 0.00246852323f    , 0.00235319598f    , 0.00224812338f    , 0.00215200037f    , 0.00206373373f    , 0.00198240082f    , 0.00190721768f    , 0.00183751397f    , 0.00177271311f    , 0.00171231654f    , },
+/* x = 2.4         */  {0.555776428f      , 0.0968871823f     , 0.0416549153f     , 0.0244909632f     , 0.0168164144f     , 0.0126312034f     , 0.0100469341f     , 0.00831087301f    , 0.00707190455f    , 0.006146755f      , 0.00543133161f    , 0.00486250219f    , 0.00439991608f    , 0.00401665597f    , 0.00369411622f    , 0.00341904525f    , 0.00318176029f    , 0.00297502836f    , 0.00279334151f    , 0.0026324339f     , 0.00248895184f    , 0.00236022336f    , 0.00224409402f    , 0.0021388078f     , 0.0020429194f     , 0.00195522864f    , 0.00187473073f    , 0.00180057817f    , 0.00173205123f    , 0.00166853481f    , 0.00160950009f    , 0.00155448998f    , },
+/* x = 2.5         */  {0.546291972f      , 0.0928413946f     , 0.0392878371f     , 0.0228708373f     , 0.0156021725f     , 0.0116669108f     , 0.00925020413f    , 0.00763353101f    , 0.00648359329f    , 0.00562721746f    , 0.00496642664f    , 0.00444199216f    , 0.00401616423f    , 0.00366382145f    , 0.00336763608f    , 0.00311528957f    , 0.00289779559f    , 0.0027084512f     , 0.00254215869f    , 0.00239497456f    , 0.00226380186f    , 0.00214617551f    , 0.00204010963f    , 0.0019439869f     , 0.00185647718f    , 0.00177647661f    , 0.00170306166f    , 0.00163545382f    , 0.00157299232f    , 0.00151511268f    , 0.00146132989f    , 0.00141122488f    , },
+/* x = 2.6         */  {0.537200524f      , 0.0890244126f     , 0.0370768576f     , 0.0213674442f     , 0.0144804868f     , 0.0107790005f     , 0.00851835145f    , 0.0070124982f     , 0.00594497978f    , 0.00515213039f    , 0.00454171138f    , 0.00405814632f    , 0.00366611291f    , 0.0033421624f     , 0.00307015509f    , 0.00283863836f    , 0.00263927136f    , 0.00246584168f    , 0.00231363089f    , 0.00217899318f    , 0.00205906845f    , 0.00195158233f    , 0.0018547042f     , 0.00176694441f    , 0.00168707868f    , 0.00161409174f    , 0.00154713469f    , 0.00148549237f    , 0.00142855807f    , 0.00137581381f    , 0.00132681469f    , 0.00128117651f    , },
+/* x = 2.7         */  {0.528479965f      , 0.0854211949f     , 0.035010754f      , 0.0199718995f     , 0.0134440341f     , 0.00996125813f    , 0.00784598643f    , 0.00644302053f    , 0.00545181394f    , 0.00471765264f    , 0.00415368285f    , 0.00370774576f    , 0.00334678513f    , 0.00304891028f    , 0.0027990861f     , 0.00258666374f    , 0.0024039006f     , 0.00224503836f    , 0.00210570923f    , 0.00198254236f    , 0.00187289614f    , 0.00177467205f    , 0.00168618246f    , 0.00160605522f    , 0.00153316344f    , 0.00146657326f    , 0.00140550436f    , 0.00134929973f    , 0.0012974023f     , 0.00124933669f    , 0.00120469483f    , 0.00116312445f    , },
+/* x = 2.8         */  {0.520109626f      , 0.0820177791f     , 0.0330791562f     , 0.0186760212f     , 0.0124860867f     , 0.00920798527f    , 0.00722817418f    , 0.0059207503f     , 0.00500021283f    , 0.00432027776f    , 0.0037991455f     , 0.00338785586f    , 0.00305546825f    , 0.00278154352f    , 0.00255207367f    , 0.00235715603f    , 0.00218960255f    , 0.00204407525f    , 0.00191653059f    , 0.00180385164f    , 0.00170359844f    , 0.00161383455f    , 0.00153300408f    , 0.00145984301f    , 0.00139331405f    , 0.0013325582f     , 0.0012768581f     , 0.00122561016f    , 0.00117830284f    , 0.00113449989f    , 0.00109382696f    , 0.00105596105f    , },
+/* x = 2.9         */  {0.512070182f      , 0.0788012004f     , 0.0312724795f     , 0.017472272f      , 0.0116004627f     , 0.00851395593f    , 0.00666039572f    , 0.00544171108f    , 0.00458662864f    , 0.00395680462f    , 0.0034751841f     , 0.00309580105f    , 0.00278969037f    , 0.00253776536f    , 0.00232697324f    , 0.0021481041f     , 0.001994484f      , 0.00186116412f    , 0.00174440071f    , 0.00164131143f    , 0.0015496424f     , 0.00146760658f    , 0.00139376947f    , 0.00132696659f    , 0.00126624307f    , 0.00121080869f    , 0.00116000399f    , 0.00111327438f    , 0.00107015017f    , 0.00103023093f    , 0.00099317328f    , 0.000958681034f   , },
+/* x = 3.0         */  {0.50434356f       , 0.0757594153f     , 0.0295818629f     , 0.0163537077f     , 0.0107814809f     , 0.00787437668f    , 0.00613851251f    , 0.00500226571f    , 0.00420781955f    , 0.00362431065f    , 0.00317913901f    , 0.0028291418f     , 0.00254719884f    , 0.00231548376f    , 0.00212183219f    , 0.0019576775f     , 0.00181682237f    , 0.00169467833f    , 0.00158777888f    , 0.00149345836f    , 0.0014096346f     , 0.00133465838f    , 0.00126720697f    , 0.00120620755f    , 0.00115078105f    , 0.00110020052f    , 0.00105385966f    , 0.00101124891f    , 0.000971936946f   , 0.000935556258f   , 0.000901791812f   , 0.000870372027f   , },
+/* x = 3.1         */  {0.496912847f      , 0.0728812329f     , 0.0279991123f     , 0.0153139289f     , 0.0100239194f     , 0.00728485029f    , 0.005658734f      , 0.00459908703f    , 0.00386082308f    , 0.0033201274f     , 0.00290858359f    , 0.0025856537f     , 0.00232594077f    , 0.00211279305f    , 0.00193487259f    , 0.00178421014f    , 0.00165505029f    , 0.00154313825f    , 0.00144526395f    , 0.00135896192f    , 0.00128230847f    , 0.00121378142f    , 0.00115216106f    , 0.00109645893f    , 0.00104586573f    , 0.000999712629f   , 0.000957442211f   , 0.000918586256f   , 0.000882748655f   , 0.000849592086f   , 0.000818827528f   , 0.000790205942f   , },
+/* x = 3.2         */  {0.489762208f      , 0.0701562506f     , 0.0265166481f     , 0.014347037f      , 0.00932297729f    , 0.00674134245f    , 0.00521758796f    , 0.00422913118f    , 0.00354293183f    , 0.0030418183f     , 0.00266130371f    , 0.00236330841f    , 0.00212404523f    , 0.00192795732f    , 0.00176447555f    , 0.00162618548f    , 0.00150774153f    , 0.00140519791f    , 0.00131558172f    , 0.00123661244f    , 0.00116651266f    , 0.00110387738f    , 0.00104758179f    , 0.000996715106f   , 0.000950532187f   , 0.000908417688f   , 0.000869859077f   , 0.000834426109f   , 0.000801755004f   , 0.00077153613f    , 0.000743504322f   , 0.000717431202f   , },
+/* x = 3.3         */  {0.482876813f      , 0.0675747948f     , 0.0251274571f     , 0.0134475937f     , 0.00867424065f    , 0.00624015128f    , 0.00481189343f    , 0.00388961321f    , 0.00325167132f    , 0.00278715835f    , 0.00243527898f    , 0.00216025625f    , 0.00193980701f    , 0.00175939514f    , 0.00160916689f    , 0.00148222311f    , 0.00137359832f    , 0.0012796329f     , 0.00119757334f    , 0.00112531004f    , 0.0010612006f     , 0.00100394807f    , 0.000952515096f   , 0.00090606241f    , 0.00086390392f    , 0.000825473438f   , 0.000790299691f   , 0.000757987304f   , 0.000728202173f   , 0.000700660074f   , 0.000675117718f   , 0.000651365665f   , },
+/* x = 3.4         */  {0.476242765f      , 0.065127867f      , 0.0238250487f     , 0.0126105843f     , 0.00807365004f    , 0.00577787947f    , 0.00443873591f    , 0.00357798483f    , 0.00298477978f    , 0.00255411563f    , 0.00222866574f    , 0.00197481039f    , 0.00177167192f    , 0.00160566587f    , 0.0014676042f     , 0.00135106645f    , 0.00125143968f    , 0.00116532935f    , 0.00109018491f    , 0.00102405467f    , 0.000965420892f   , 0.000913086264f   , 0.000866094026f   , 0.000823670767f   , 0.00078518472f    , 0.000750114903f   , 0.000718027954f   , 0.00068856053f    , 0.000661405766f   , 0.000636302747f   , 0.000613028251f   , 0.000591390196f   , },
+/* x = 3.5         */  {0.469847035f      , 0.0628070931f     , 0.0226034137f     , 0.0118313836f     , 0.00751747167f    , 0.0053514088f     , 0.00409544476f    , 0.00329191407f    , 0.00274018966f    , 0.0023408344f     , 0.00203978146f    , 0.00180543245f    , 0.00161822329f    , 0.00146545698f    , 0.00133856499f    , 0.00123157161f    , 0.00114019094f    , 0.00106127397f    , 0.000992457909f   , 0.000931937028f   , 0.000878308667f   , 0.000830467417f   , 0.000787530789f   , 0.000748786013f   , 0.000713651313f   , 0.000681647277f   , 0.000652375385f   , 0.000625501713f   , 0.000600744402f   , 0.000577863927f   , 0.000556655465f   , 0.000536942852f   , },
+/* x = 3.6         */  {0.463677402f      , 0.0606046777f     , 0.0214569876f     , 0.0111057244f     , 0.00700227058f    , 0.00495787678f    , 0.00377957252f    , 0.0030292667f     , 0.00251601084f    , 0.00214561971f    , 0.00186709056f    , 0.00165071935f    , 0.00147816982f    , 0.00133757264f    , 0.00122093596f    , 0.00112269729f    , 0.00103887411f    , 0.00096654487f    , 0.000903520558f   , 0.000848130305f   , 0.000799077699f   , 0.000755342113f   , 0.000716109504f   , 0.000680722946f   , 0.000648646668f   , 0.000619439485f   , 0.000592734901f   , 0.000568226012f   , 0.000545653916f   , 0.000524798715f   , 0.000505472463f   , 0.000487513586f   , },
+/* x = 3.7         */  {0.457722397f      , 0.0585133609f     , 0.0203806157f     , 0.0104296692f     , 0.0065248862f     , 0.00459465531f    , 0.00348887594f    , 0.00278808929f    , 0.00231051526f    , 0.00196692336f    , 0.00170919154f    , 0.00150939134f    , 0.00135033437f    , 0.00122092334f    , 0.00111370321f    , 0.00102349549f    , 0.000946599135f   , 0.000880303375f   , 0.000822579953f   , 0.000771882677f   , 0.000727013233f   , 0.000687029202f   , 0.000651179625f   , 0.00061885901f    , 0.00058957392f    , 0.000562918328f   , 0.000538555169f   , 0.000516202361f   , 0.000495622079f   , 0.000476612433f   , 0.000459000958f   , 0.000442639454f   , },
+/* x = 3.8         */  {0.451971252f      , 0.056526379f      , 0.0193695217f     , 0.00979958379f    , 0.00608240983f    , 0.00425933113f    , 0.00322129876f    , 0.0025665937f     , 0.00212212284f    , 0.0018033311f     , 0.00156480515f    , 0.00138028109f    , 0.00123364384f    , 0.00111451633f    , 0.0010159433f     , 0.000933103149f   , 0.000862556023f   , 0.000801786433f   , 0.00074891491f    , 0.0007025105f     , 0.000661465478f   , 0.000624909574f   , 0.000592149976f   , 0.000562628561f   , 0.000535890856f   , 0.000511563167f   , 0.000489335484f   , 0.000468948524f   , 0.000450183814f   , 0.00043285599f    , 0.000416806784f   , 0.000401900262f   , },
+/* x = 3.9         */  {0.446413854f      , 0.0546374285f     , 0.0184192787f     , 0.0092121131f     , 0.00567216414f    , 0.00394968792f    , 0.00297495586f    , 0.00236314292f    , 0.00194938876f    , 0.00165355095f    , 0.00143276366f    , 0.00126232378f    , 0.00112711993f    , 0.00101744704f    , 0.0009268152f     , 0.000850734533f   , 0.000786007574f   , 0.000730299806f   , 0.000681869457f   , 0.000639392108f   , 0.00060184369f    , 0.000568420495f   , 0.000538483314f   , 0.000511517652f   , 0.000487104899f   , 0.0004649011f     , 0.000444621112f   , 0.000426026598f   , 0.000408916851f   , 0.000393121676f   , 0.000378495827f   , 0.000364914612f   , },
+/* x = 4.0         */  {0.441040695f      , 0.0528406321f     , 0.0175257822f     , 0.00866415899f    , 0.00529168426f    , 0.00366368993f    , 0.00274811879f    , 0.00217623817f    , 0.0017909917f     , 0.00151640251f    , 0.0013120011f     , 0.00115454803f    , 0.00102987073f    , 0.000928891176f   , 0.000845552857f   , 0.000775674244f   , 0.000716282836f   , 0.000665211838f   , 0.000620846929f   , 0.000581962186f   , 0.000547610796f   , 0.000517050469f   , 0.000489691407f   , 0.000465059306f   , 0.000442768561f   , 0.000422502576f   , 0.000403999063f   , 0.00038703893f    , 0.000371437784f   , 0.000357039346f   , 0.000343710319f   , 0.00033133632f    , },
+/* x = 4.1         */  {0.435842839f      , 0.0511305077f     , 0.0166852253f     , 0.00815285991f    , 0.00493870049f    , 0.00339946695f    , 0.00253920257f    , 0.00200450707f    , 0.00164572325f    , 0.0013908073f     , 0.0012015443f     , 0.00105606766f    , 0.000941083029f   , 0.000848097601f   , 0.000771458517f   , 0.000707270925f   , 0.000652771133f   , 0.000605947802f   , 0.000565304592f   , 0.000529706645f   , 0.000498278507f   , 0.000470334557f   , 0.000445330554f   , 0.000422829212f   , 0.000402475311f   , 0.000383977418f   , 0.000367094257f   , 0.000351624418f   , 0.000337398485f   , 0.000324272956f   , 0.00031212549f    , 0.00030085116f    , },
+/* x = 4.2         */  {0.430811876f      , 0.0495019403f     , 0.0158940767f     , 0.00767557222f    , 0.00461112246f    , 0.00315530064f    , 0.00234675359f    , 0.00184669285f    , 0.00151247808f    , 0.00127577983f    , 0.00110050475f    , 0.000966074165f   , 0.000860015353f   , 0.000774381788f   , 0.000703896601f   , 0.0006449315f     , 0.000594916628f   , 0.000551984752f   , 0.000514748751f   , 0.000482157974f   , 0.000453402878f   , 0.000427850138f   , 0.000404997514f   , 0.000384441823f   , 0.000365855815f   , 0.000348971207f   , 0.000333566038f   , 0.000319455143f   , 0.000306482862f   , 0.000294517417f   , 0.000283446519f   , 0.00027317391f    , },
+/* x = 4.3         */  {0.425939892f      , 0.047950155f      , 0.0151490588f     , 0.00722985292f    , 0.00430702458f    , 0.00292961189f    , 0.00216943858f    , 0.00170164448f    , 0.00139024513f    , 0.00117041956f    , 0.00100807123f    , 0.000883829861f   , 0.000785991603f   , 0.00070711989f    , 0.000642288142f   , 0.000588115941f   , 0.000542213391f   , 0.000502846849f   , 0.000468730316f   , 0.000438891009f   , 0.000412580273f   , 0.000389213047f   , 0.000368325813f   , 0.000349546809f   , 0.000332574535f   , 0.000317162002f   , 0.000303105011f   , 0.000290233319f   , 0.000278403901f   , 0.000267495739f   , 0.000257405768f   , 0.000248045676f   , },
+/* x = 4.4         */  {0.421219434f      , 0.0464706925f     , 0.0144471293f     , 0.00681344392f    , 0.00402463268f    , 0.00272094934f    , 0.00200603441f    , 0.00156830767f    , 0.00127809944f    , 0.00107390348f    , 0.000923502976f   , 0.000808661658f   , 0.000718395253f   , 0.000645743343f   , 0.000586105724f   , 0.000536332509f   , 0.000494200897f   , 0.000458101101f   , 0.000426840754f   , 0.000399519089f   , 0.0003754437f     , 0.000354074067f   , 0.000334982383f   , 0.000317825834f   , 0.000302326626f   , 0.00028825736f    , 0.000275430168f   , 0.000263688521f   , 0.000252900993f   , 0.000242956446f   , 0.000233760274f   , 0.000225231457f   , },
+/* x = 4.5         */  {0.416643482f      , 0.0450593872f     , 0.0137854628f     , 0.00642425749f    , 0.00376231177f    , 0.00252797882f    , 0.00185541894f    , 0.00144571663f    , 0.00117519477f    , 0.000985479399f   , 0.00084612356f    , 0.000739955359f   , 0.00065666408f    , 0.00058973394f    , 0.000534868873f   , 0.000489133419f   , 0.000450459939f   , 0.000417353495f   , 0.000388708421f   , 0.000363690558f   , 0.00034165947f    , 0.000322115748f   , 0.000304664516f   , 0.000288989631f   , 0.000274835127f   , 0.000261991629f   , 0.000250286283f   , 0.000239575164f   , 0.0002297375f     , 0.000220671217f   , 0.000212289475f   , 0.000204517937f   , },
+/* x = 4.6         */  {0.412205415f      , 0.0437123456f     , 0.0131614349f     , 0.0060603629f     , 0.00351855484f    , 0.00234947368f    , 0.00171656247f    , 0.00133298656f    , 0.00108075681f    , 0.000904459789f   , 0.000775315244f   , 0.000677150477f   , 0.000600285351f   , 0.000538619351f   , 0.000488139861f   , 0.000446110895f   , 0.000410608914f   , 0.00038024548f    , 0.000353995222f   , 0.000331085594f   , 0.000310924177f   , 0.00029304951f    , 0.000277097086f   , 0.000262775342f   , 0.000249848405f   , 0.000238123489f   , 0.000227441544f   , 0.000217670225f   , 0.000208698546f   , 0.000200432756f   , 0.000192793138f   , 0.000185711484f   , },
+/* x = 4.7         */  {0.407898992f      , 0.0424259271f     , 0.0125726068f     , 0.00571997416f    , 0.00329197255f    , 0.00218430594f    , 0.00158852003f    , 0.00122930673f    , 0.000994077008f   , 0.000830216174f   , 0.000710513851f   , 0.000619735507f   , 0.000548791443f   , 0.00049196904f    , 0.00044551989f    , 0.000406893586f   , 0.000374300433f   , 0.000346450763f   , 0.000322393575f   , 0.000301413316f   , 0.000282961937f   , 0.00026661301f    , 0.000252030037f   , 0.000238944102f   , 0.000227137839f   , 0.000216433722f   , 0.000206685397f   , 0.000197771161f   , 0.000189589016f   , 0.000182052852f   , 0.000175089486f   , 0.000168636334f   , },
+/* x = 4.8         */  {0.403718322f      , 0.0411967266f     , 0.0120167117f     , 0.00540143872f    , 0.00308128375f    , 0.0020314382f     , 0.00147042428f    , 0.00113393423f    , 0.000914506917f   , 0.000762174014f   , 0.000651204086f   , 0.000567243619f   , 0.000501755854f   , 0.000449390552f   , 0.00040664561f    , 0.000371143297f   , 0.000341218246f   , 0.000315672402f   , 0.000293623648f   , 0.000274409159f   , 0.00025752189f    , 0.000242567756f   , 0.000229236089f   , 0.000217278847f   , 0.000206495706f   , 0.000196723184f   , 0.000187826599f   , 0.000179694031f   , 0.000172231737f   , 0.00016536062f    , 0.000159013496f   , 0.000153132935f   , },
+/* x = 4.9         */  {0.399657846f      , 0.0400215574f     , 0.0114916418f     , 0.00510322711f    , 0.00288530681f    , 0.00188991614f    , 0.00136147903f    , 0.0010461882f     , 0.000841453049f   , 0.000699808037f   , 0.000596915268f   , 0.000519248731f   , 0.000458789565f   , 0.000410526129f   , 0.000371185961f   , 0.000338552019f   , 0.000311074442f   , 0.000287640155f   , 0.000267430851f   , 0.000249832491f   , 0.000234375926f   , 0.000220696929f   , 0.000208508663f   , 0.000197582323f   , 0.000187733276f   , 0.000178810965f   , 0.000170691444f   , 0.000163271784f   , 0.000156465824f   , 0.000150200907f   , 0.00014441535f    , 0.000139056455f   , },
+/* x = 5.0         */  {0.39571231f       , 0.0388974363f     , 0.0109954362f     , 0.00482392339f    , 0.00270295167f    , 0.00175886181f    , 0.00126095329f    , 0.000965444572f   , 0.000774372158f   , 0.000642637969f   , 0.000547217441f   , 0.000475361926f   , 0.00041953773f    , 0.000375049624f   , 0.000338839285f   , 0.000308839226f   , 0.0002836069f     , 0.000262108072f   , 0.000243583551f   , 0.000227464439f   , 0.000213316614f   , 0.000200803417f   , 0.000189659993f   , 0.000179675269f   , 0.000170679064f   , 0.000162532716f   , 0.000155122152f   , 0.000148352706f   , 0.000142145182f   , 0.000136432837f   , 0.000131159036f   , 0.000126275422f   , },
+/* x = 5.1         */  {0.39187675f       , 0.037821569f      , 0.0105262706f     , 0.00456221633f    , 0.00253321252f    , 0.00163746727f    , 0.00116817582f    , 0.000891131289f   , 0.000712766939f   , 0.000590224646f   , 0.000501717815f   , 0.000435228191f   , 0.000383676651f   , 0.000342663696f   , 0.000309330708f   , 0.000281749409f   , 0.000258576973f   , 0.000238852307f   , 0.000221870999f   , 0.00020710592f    , 0.000194155324f   , 0.000182708012f   , 0.000172519407f   , 0.000163394779f   , 0.000155177259f   , 0.000147739131f   , 0.000140975405f   , 0.000134799008f   , 0.000129137145f   , 0.0001239285f     , 0.000119121074f   , 0.000114670487f   , },
+/* x = 5.2         */  {0.388146475f      , 0.0367913375f     , 0.0100824469f     , 0.00431689137f    , 0.00237516108f    , 0.00152498897f    , 0.00108253021f    , 0.000822723881f   , 0.000656182096f   , 0.000542166462f   , 0.000460057534f   , 0.000398523442f   , 0.000350911034f   , 0.000313097253f   , 0.000282409751f   , 0.000257049842f   , 0.000235767373f   , 0.000217669125f   , 0.000202101437f   , 0.000188575842f   , 0.000176720522f   , 0.000166247786f   , 0.000156931768f   , 0.000148592804f   , 0.000141086285f   , 0.00013429457f    , 0.000128121022f   , 0.000122485551f   , 0.00011732124f    , 0.000112571758f   , 0.000108189358f   , 0.00010413331f    , },
+/* x = 5.3         */  {0.384517044f      , 0.0358042877f     , 0.00966238389f    , 0.00408682316f    , 0.0022279404f     , 0.00142074242f    , 0.00100345026f    , 0.000759741459f   , 0.000604200753f   , 0.000498096122f   , 0.000421908718f   , 0.000364951809f   , 0.00032097148f    , 0.000286103123f   , 0.000257848152f   , 0.000234528538f   , 0.000214980261f   , 0.000198373087f   , 0.000184100389f   , 0.000171709481f   , 0.000160856214f   , 0.000151274608f   , 0.000142756061f   , 0.000135134795f   , 0.000128277498f   , 0.000122075802f   , 0.000116440753f   , 0.00011129868f    , 0.000106588066f   , 0.000102257157f   , 9.82621088e-5f    , 9.45655405e-5f    , },
+/* x = 5.4         */  {0.380984255f      , 0.0348581179f     , 0.0092646086f     , 0.00387096871f    , 0.00209075926f    , 0.00132409745f    , 0.000930415829f   , 0.000701743041f   , 0.000556441173f   , 0.000457677685f   , 0.000386971766f   , 0.000334243161f   , 0.0002936122f     , 0.000261455932f   , 0.00023543789f    , 0.000213992396f   , 0.000196035494f   , 0.000180795404f   , 0.000167709094f   , 0.000156356993f   , 0.000146420535f   , 0.000137653796f   , 0.000129864099f   , 0.000122898473f   , 0.000116634008f   , 0.000110970873f   , 0.000105827184f   , 0.000101135169f   , 9.68382726e-5f    , 9.2888944e-5f     , 8.92469216e-5f    , 8.58778961e-5f    , },
+/* x = 5.5         */  {0.377544129f      , 0.0339506689f     , 0.00888774866f    , 0.00366836108f    , 0.00196288692f    , 0.00123447371f    , 0.000862949036f   , 0.000648324185f   , 0.000512553758f   , 0.000420603859f   , 0.000354972898f   , 0.000306150857f   , 0.000268608933f   , 0.000238950172f   , 0.000214989382f   , 0.000195265512f   , 0.000178769039f   , 0.000164782439f   , 0.000152783086f   , 0.000142382067f   , 0.00013328447f    , 0.000125262893f   , 0.000118139359f   , 0.000111772702f   , 0.000106049596f   , 0.000100878071f   , 9.61827421e-5f    , 9.19012629e-5f    , 8.79816381e-5f    , 8.43801756e-5f    , 8.1059902e-5f     , 7.7989326e-5f     , },
+/* x = 5.6         */  {0.374192898f      , 0.0330799138f     , 0.00853052479f    , 0.00347810359f    , 0.00184364834f    , 0.00115133673f    , 0.00080061074f    , 0.00059911392f    , 0.000472218311f   , 0.000386593533f   , 0.000325661912f   , 0.000280449682f   , 0.00024575705f    , 0.00021839844f    , 0.000196329837f   , 0.000178187639f   , 0.000163031525f   , 0.000150194339f   , 0.000139190907f   , 0.000129660701f   , 0.000121330682f   , 0.000113990558f   , 0.000107475917f   , 0.000101656478f   , 9.64277457e-5f    , 9.1704984e-5f     , 8.7418792e-5f     , 8.35118087e-5f    , 7.99362289e-5f    , 7.66519048e-5f    , 7.36248808e-5f    , 7.08262511e-5f    , },
+/* x = 5.7         */  {0.370926987f      , 0.0322439493f     , 0.00819174407f    , 0.00329936446f    , 0.00173241981f    , 0.0010741941f     , 0.000742997341f   , 0.000553771928f   , 0.000435141532f   , 0.000355389525f   , 0.000298810133f   , 0.000256933976f   , 0.000224869824f   , 0.000199629837f   , 0.000179301768f   , 0.00016261279f    , 0.000148686931f   , 0.000136903797f   , 0.000126812932f   , 0.000118080089f   , 0.000110452457f   , 0.000103735552f   , 9.77774813e-5f    , 9.2458e-5f        , 8.76807494e-5f    , 8.33676545e-5f    , 7.94548179e-5f    , 7.58894641e-5f    , 7.26276374e-5f    , 6.96324451e-5f    , 6.68727021e-5f    , 6.43218744e-5f    , },
+/* x = 5.8         */  {0.367743008f      , 0.0314409874f     , 0.00787029374f    , 0.00313137189f    , 0.00162862487f    , 0.00100259216f    , 0.000689737848f   , 0.000511985973f   , 0.000401054728f   , 0.00032675652f    , 0.000274208546f   , 0.000235415925f   , 0.000205776855f   , 0.000182488503f   , 0.000163761625f   , 0.000148407963f   , 0.000135611388f   , 0.000124794919f   , 0.000115540296f   , 0.000107537603f   , 0.000100552738f   , 9.44058214e-5f    , 8.89565153e-5f    , 8.40938311e-5f    , 7.97289067e-5f    , 7.57898001e-5f    , 7.22176776e-5f    , 6.896398e-5f      , 6.59882893e-5f    , 6.32567023e-5f    , 6.07405769e-5f    , 5.84155555e-5f    , },
+/* x = 5.9         */  {0.364637746f      , 0.0306693475f     , 0.0075651354f     , 0.00297340951f    , 0.00153173066f    , 0.000936112804f   , 0.000640491189f   , 0.000473469545f   , 0.000369711725f   , 0.000300479196f   , 0.000251666093f   , 0.000215723995f   , 0.000188322633f   , 0.000166832289f   , 0.000149578559f   , 0.000135451982f   , 0.000123692086f   , 0.000113762205f   , 0.000105273928f   , 9.79398759e-5f    , 9.15432492e-5f    , 8.59176608e-5f    , 8.09334403e-5f    , 7.64881351e-5f    , 7.24997908e-5f    , 6.89021128e-5f    , 6.56409266e-5f    , 6.267155e-5f      , 5.9956816e-5f     , 5.74655674e-5f    , 5.51714964e-5f    , 5.30522425e-5f    , },
+/* x = 6.0         */  {0.361608147f      , 0.0299274496f     , 0.00727529972f    , 0.0028248122f     , 0.00144124444f    , 0.000874370646f   , 0.000594943744f   , 0.000437959708f   , 0.000340886953f   , 0.000276360502f   , 0.000231008114f   , 0.000197701518f   , 0.000172365228f   , 0.000152531543f   , 0.000136633291f   , 0.000123634439f   , 0.000112826286f   , 0.000103709606f   , 9.59236685e-5f    , 8.92019631e-5f    , 8.33436987e-5f    , 7.81949559e-5f    , 7.36359104e-5f    , 6.95719827e-5f    , 6.5927584e-5f     , 6.264162e-5f      , 5.96642036e-5f    , 5.69542178e-5f    , 5.44774836e-5f    , 5.22053656e-5f    , 5.01136992e-5f    , 4.81819565e-5f    , },
+/* x = 6.1         */  {0.358651314f      , 0.0292138071f     , 0.00699988143f    , 0.00268496225f    , 0.00135671049f    , 0.000817010388f   , 0.000552807094f   , 0.000405215123f   , 0.000314373699f   , 0.000254220095f   , 0.000212074925f   , 0.000181205386f   , 0.000157775096f   , 0.000139468006f   , 0.000124817086f   , 0.000112854736f   , 0.000102920418f   , 9.45496778e-5f    , 8.74074593e-5f    , 8.12465798e-5f    , 7.58810569e-5f    , 7.11684929e-5f    , 6.69981537e-5f    , 6.32827212e-5f    , 5.99524734e-5f    , 5.69511046e-5f    , 5.42326732e-5f    , 5.17593409e-5f    , 4.94996748e-5f    , 4.74273561e-5f    , 4.5520188e-5f     , 4.37593235e-5f    , },
+/* x = 6.2         */  {0.355764491f      , 0.028527021f      , 0.00673803486f    , 0.00255328578f    , 0.00127770724f    , 0.0007637044f     , 0.000513815949f   , 0.00037501425f    , 0.000289982509f   , 0.000233892905f   , 0.000194720528f   , 0.000166104876f   , 0.000144433993f   , 0.000127533805f   , 0.000114030814f   , 0.000103021207f   , 9.38892566e-5f    , 8.6202809e-5f     , 7.96506191e-5f    , 7.4003409e-5f     , 6.90888964e-5f    , 6.47753319e-5f    , 6.09603738e-5f    , 5.75634022e-5f    , 5.45201021e-5f    , 5.17785779e-5f    , 4.9296519e-5f     , 4.70391024e-5f    , 4.49774191e-5f    , 4.30872785e-5f    , 4.13482901e-5f    , 3.974315e-5f      , },
+/* x = 6.3         */  {0.352945059f      , 0.0278657741f     , 0.00648896965f    , 0.00242924948f    , 0.00120384457f    , 0.000714150505f   , 0.000477726252f   , 0.00034715369f    , 0.000267539728f   , 0.000215227826f   , 0.000178811422f   , 0.000152280562f   , 0.00013223398f    , 0.000116630534f   , 0.000104184098f   , 9.4050323e-5f     , 8.56551774e-5f    , 7.85965142e-5f    , 7.25851761e-5f    , 6.74084713e-5f    , 6.29067941e-5f    , 5.89582366e-5f    , 5.54682059e-5f    , 5.23622611e-5f    , 4.95810709e-5f    , 4.70768014e-5f    , 4.48104837e-5f    , 4.2750068e-5f     , 4.08689652e-5f    , 3.91449398e-5f    , 3.75592598e-5f    , 3.60960372e-5f    , },
+/* x = 6.4         */  {0.350190526f      , 0.0272288257f     , 0.00625194686f    , 0.00231235758f    , 0.00113476139f    , 0.00066806994f    , 0.000444313443f   , 0.000321446678f   , 0.000246886164f   , 0.000198086525f   , 0.000164225523f   , 0.000139623338f   , 0.000121076523f   , 0.000106668421f   , 9.51945392e-5f    , 8.5865966e-5f     , 7.81474744e-5f    , 7.16647956e-5f    , 6.61492634e-5f    , 6.14035525e-5f    , 5.72797871e-5f    , 5.36651562e-5f    , 5.04722222e-5f    , 4.76322443e-5f    , 4.50904853e-5f    , 4.28028519e-5f    , 4.07334511e-5f    , 3.88527838e-5f    , 3.71363936e-5f    , 3.55638406e-5f    , 3.41179159e-5f    , 3.27840311e-5f    , },
+/* x = 6.5         */  {0.347498523f      , 0.0266150064f     , 0.00602627539f    , 0.00220214906f    , 0.0010701234f     , 0.000625205493f   , 0.000413370864f   , 0.000297721695f   , 0.000227875865f   , 0.000182342346f   , 0.000150851184f   , 0.000128033513f   , 0.000110871662f   , 9.75655658e-5f    , 8.69870065e-5f    , 7.83987688e-5f    , 7.13017415e-5f    , 6.53475598e-5f    , 6.02865693e-5f    , 5.59356823e-5f    , 5.21578783e-5f    , 4.88487552e-5f    , 4.5927483e-5f     , 4.333058e-5f      , 4.10075437e-5f    , 3.89177267e-5f    , 3.70280668e-5f    , 3.53114114e-5f    , 3.3745264e-5f     , 3.23108352e-5f    , 3.0992314e-5f     , 2.97763049e-5f    , },
+/* x = 6.6         */  {0.344866791f      , 0.0260232138f     , 0.0058113086f     , 0.00209819507f    , 0.00100962102f    , 0.000585319783f   , 0.000384708302f   , 0.000275821203f   , 0.000210375001f   , 0.000167879316f   , 0.000138586286f   , 0.000117419998f   , 0.000101537266f   , 8.92472427e-5f    , 7.94929936e-5f    , 7.15855135e-5f    , 6.50593091e-5f    , 5.95900881e-5f    , 5.49458368e-5f    , 5.09566609e-5f    , 4.74955861e-5f    , 4.44659843e-5f    , 4.17931278e-5f    , 3.94183873e-5f    , 3.72951641e-5f    , 3.53859849e-5f    , 3.36603935e-5f    , 3.20933955e-5f    , 3.06642965e-5f    , 2.93558229e-5f    , 2.81534481e-5f    , 2.70448708e-5f    , },
+/* x = 6.7         */  {0.34229318f       , 0.0254524081f     , 0.00560644122f    , 0.00200009658f    , 0.000952967476f   , 0.000548193685f   , 0.000358150644f   , 0.000255600483f   , 0.000194260846f   , 0.00015459123f    , 0.000127337423f   , 0.000107699551f   , 9.29983416e-5f    , 8.16452715e-5f    , 7.26500319e-5f    , 6.53685838e-5f    , 5.93667309e-5f    , 5.43425536e-5f    , 5.00804085e-5f    , 4.64226278e-5f    , 4.32515361e-5f    , 4.04776923e-5f    , 3.80320048e-5f    , 3.5860322e-5f     , 3.3919644e-5f     , 3.21754219e-5f    , 3.05995979e-5f    , 2.91691633e-5f    , 2.78650803e-5f    , 2.66714683e-5f    , 2.55749798e-5f    , 2.45643181e-5f    , },
+/* x = 6.8         */  {0.339775642f      , 0.0249016079f     , 0.00541110651f    , 0.00190748216f    , 0.000899897057f   , 0.00051362488f    , 0.000333536657f   , 0.000236926573f   , 0.000179420841f   , 0.00014238082f    , 0.00011701915f    , 9.87961027e-5f    , 8.51864128e-5f    , 7.46974391e-5f    , 6.6401155e-5f     , 5.96954666e-5f    , 5.41753174e-5f    , 4.95595829e-5f    , 4.56478127e-5f    , 4.22936707e-5f    , 3.93880888e-5f    , 3.68482717e-5f    , 3.46103334e-5f    , 3.2624254e-5f     , 3.08503522e-5f    , 2.92567727e-5f    , 2.78176663e-5f    , 2.65118505e-5f    , 2.53218109e-5f    , 2.42329467e-5f    , 2.32329931e-5f    , 2.23115759e-5f    , },
+/* x = 6.9         */  {0.337312223f      , 0.0243698868f     , 0.00522477354f    , 0.00182000596f    , 0.0008501635f     , 0.000481426527f   , 0.000310717853f   , 0.000219677294f   , 0.000165751738f   , 0.000131158994f   , 0.000107553294f   , 9.0640126e-5f     , 7.80389471e-5f    , 6.83469745e-5f    , 6.06944117e-5f    , 5.45182978e-5f    , 4.94407103e-5f    , 4.5199856e-5f     , 4.16093862e-5f    , 3.85334682e-5f    , 3.58710021e-5f    , 3.35453375e-5f    , 3.14973973e-5f    , 2.96809747e-5f    , 2.80594481e-5f    , 2.66034441e-5f    , 2.52891465e-5f    , 2.40970532e-5f    , 2.30110503e-5f    , 2.20177131e-5f    , 2.11057713e-5f    , 2.0265697e-5f     , },
+/* x = 7.0         */  {0.334901058f      , 0.0238563697f     , 0.0050469448f     , 0.00173734586f    , 0.000803538504f   , 0.000451426041f   , 0.000289557463f   , 0.000203740361f   , 0.000153158818f   , 0.000120844138f   , 9.88683331e-5f    , 8.31680736e-5f    , 7.14988376e-5f    , 6.25420696e-5f    , 5.54824224e-5f    , 4.97934488e-5f    , 4.51224961e-5f    , 4.12257434e-5f    , 3.79299323e-5f    , 3.51089664e-5f    , 3.26691233e-5f    , 3.05394348e-5f    , 2.86652666e-5f    , 2.70039308e-5f    , 2.55216273e-5f    , 2.41912696e-5f    , 2.29909131e-5f    , 2.19026019e-5f    , 2.09115099e-5f    , 2.00052929e-5f    , 1.91735942e-5f    , 1.84076628e-5f    , },
+/* x = 7.1         */  {0.33254037f       , 0.0233602299f     , 0.00487715386f    , 0.00165920172f    , 0.000759810359f   , 0.000423463965f   , 0.000269929485f   , 0.000189012563f   , 0.000141555177f   , 0.000111361485f   , 9.08988234e-5f    , 7.63218568e-5f    , 6.55139285e-5f    , 5.72354428e-5f    , 5.07219742e-5f    , 4.54811498e-5f    , 4.11838536e-5f    , 3.7602975e-5f     , 3.45774086e-5f    , 3.19900842e-5f    , 2.97541098e-5f    , 2.78037731e-5f    , 2.60885438e-5f    , 2.45689822e-5f    , 2.321389e-5f      , 2.19982878e-5f    , 2.09019546e-5f    , 1.9908357e-5f     , 1.9003853e-5f     , 1.81770915e-5f    , 1.74185546e-5f    , 1.67202048e-5f    , },
+/* x = 7.2         */  {0.330228459f      , 0.0228806856f     , 0.00471496327f    , 0.00158529379f    , 0.000718782688f   , 0.000397392943f   , 0.000251717817f   , 0.000175399015f   , 0.000130861071f   , 0.000102642527f   , 8.35848757e-5f    , 7.00483737e-5f    , 6.00365824e-5f    , 5.2383941e-5f     , 4.63736527e-5f    , 4.15451473e-5f    , 3.75912331e-5f    , 3.43003393e-5f    , 3.15226435e-5f    , 2.91494444e-5f    , 2.71001753e-5f    , 2.53139846e-5f    , 2.37441341e-5f    , 2.23541823e-5f    , 2.11153306e-5f    , 2.00045411e-5f    , 1.90031798e-5f    , 1.80960224e-5f    , 1.72705157e-5f    , 1.65162211e-5f    , 1.58243916e-5f    , 1.51876442e-5f    , },
+/* x = 7.3         */  {0.327963704f      , 0.0224169976f     , 0.00455996261f    , 0.00151536125f    , 0.000680273287f   , 0.000373076767f   , 0.000234815457f   , 0.000162812477f   , 0.000121003313f   , 9.46244899e-5f    , 7.68716804e-5f    , 6.42990762e-5f    , 5.50232862e-5f    , 4.79481766e-5f    , 4.24015064e-5f    , 3.79523911e-5f    , 3.4314065e-5f     , 3.1289409e-5f     , 2.8739078e-5f     , 2.65621309e-5f    , 2.46838581e-5f    , 2.30479047e-5f    , 2.16110361e-5f    , 2.03395788e-5f    , 1.9206947e-5f     , 1.81918924e-5f    , 1.72772422e-5f    , 1.64489767e-5f    , 1.56955439e-5f    , 1.50073444e-5f    , 1.43763385e-5f    , 1.37957448e-5f    , },
+/* x = 7.4         */  {0.325744554f      , 0.0219684663f     , 0.00441176664f    , 0.00144916084f    , 0.000644113048f   , 0.000350389505f   , 0.00021912377f    , 0.000151172719f   , 0.000111914732f   , 8.7249843e-5f     , 7.07090714e-5f    , 5.90295769e-5f    , 5.0434291e-5f     , 4.38921969e-5f    , 3.87727403e-5f    , 3.46727505e-5f    , 3.13244935e-5f    , 2.85442921e-5f    , 2.62025313e-5f    , 2.42054659e-5f    , 2.24838115e-5f    , 2.09853722e-5f    , 1.96701516e-5f    , 1.85070312e-5f    , 1.74714667e-5f    , 1.65438585e-5f    , 1.57083798e-5f    , 1.49521193e-5f    , 1.42644461e-5f    , 1.36365314e-5f    , 1.30609861e-5f    , 1.25315804e-5f    , },
+/* x = 7.5         */  {0.323569528f      , 0.0215344296f     , 0.00427001362f    , 0.00138646558f    , 0.00061014498f    , 0.000329214697f   , 0.00020455182f    , 0.000140405952f   , 0.000103533661f   , 8.04658578e-5f    , 6.50511285e-5f    , 5.41992885e-5f    , 4.62332844e-5f    , 4.01831827e-5f    , 3.54574375e-5f    , 3.16787545e-5f    , 2.85971346e-5f    , 2.60414048e-5f    , 2.38909866e-5f    , 2.2058809e-5f     , 2.04806119e-5f    , 1.91080479e-5f    , 1.79041128e-5f    , 1.68400469e-5f    , 1.5893189e-5f     , 1.50454594e-5f    , 1.42822707e-5f    , 1.35917318e-5f    , 1.29640585e-5f    , 1.23911309e-5f    , 1.1866157e-5f     , 1.13834139e-5f    , },
+/* x = 7.6         */  {0.321437206f      , 0.0211142602f     , 0.00413436376f    , 0.00132706364f    , 0.000578223293f   , 0.000309444619f   , 0.000191015748f   , 0.000130444296f   , 9.5803487e-5f     , 7.42242003e-5f    , 5.9855814e-5f     , 4.97710961e-5f    , 4.23870906e-5f    , 3.67911731e-5f    , 3.24283052e-5f    , 2.89453565e-5f    , 2.61088564e-5f    , 2.37592649e-5f    , 2.17843973e-5f    , 2.01033728e-5f    , 1.8656586e-5f     , 1.73992496e-5f    , 1.62971248e-5f    , 1.53236305e-5f    , 1.44578421e-5f    , 1.3683081e-5f     , 1.29859011e-5f    , 1.23553504e-5f    , 1.17824237e-5f    , 1.12596523e-5f    , 1.0780793e-5f     , 1.03405882e-5f    , },
+/* x = 7.7         */  {0.319346233f      , 0.020707364f      , 0.00400449772f    , 0.00127075724f    , 0.000548212563f   , 0.000290979603f   , 0.000178438211f   , 0.000121225296f   , 8.86722244e-5f    , 6.84805605e-5f    , 5.50846407e-5f    , 4.57110566e-5f    , 3.88653974e-5f    , 3.36888151e-5f    , 2.96604431e-5f    , 2.64497187e-5f    , 2.38385776e-5f    , 2.16783038e-5f    , 1.98645097e-5f    , 1.8322057e-5f     , 1.69956519e-5f    , 1.58438015e-5f    , 1.48348236e-5f    , 1.39441479e-5f    , 1.31524525e-5f    , 1.24443499e-5f    , 1.18074457e-5f    , 1.12316518e-5f    , 1.07086796e-5f    , 1.02316593e-5f    , 9.79485159e-6f    , 9.39342624e-6f    , },
+/* x = 7.8         */  {0.31729531f       , 0.0203131779f     , 0.0038801153f     , 0.00121736164f    , 0.000519986953f   , 0.00027372741f    , 0.000166747855f   , 0.000112691483f   , 8.20921322e-5f    , 6.31943121e-5f    , 5.07023687e-5f    , 4.19881258e-5f    , 3.56405074e-5f    , 3.08511349e-5f    , 2.71311323e-5f    , 2.41710166e-5f    , 2.17670856e-5f    , 1.97806953e-5f    , 1.81147023e-5f    , 1.66992953e-5f    , 1.54831756e-5f    , 1.44278987e-5f    , 1.35041453e-5f    , 1.26892024e-5f    , 1.19652266e-5f    , 1.13180207e-5f    , 1.07361587e-5f    , 1.02103481e-5f    , 9.73295922e-6f    , 9.29767285e-6f    , 8.89921278e-6f    , 8.53314106e-6f    , },
+/* x = 7.9         */  {0.315283192f      , 0.0199311676f     , 0.00376093413f    , 0.00116670425f    , 0.000493429506f   , 0.000257602659f   , 0.000155878842f   , 0.000104789963f   , 7.60193608e-5f    , 5.83282021e-5f    , 4.66767278e-5f    , 3.85739078e-5f    , 3.26871101e-5f    , 2.82553299e-5f    , 2.48196434e-5f    , 2.20902607e-5f    , 1.98768697e-5f    , 1.80502e-5f       , 1.65198393e-5f    , 1.52209185e-5f    , 1.41058405e-5f    , 1.31389823e-5f    , 1.22932087e-5f    , 1.15475222e-5f    , 1.08854434e-5f    , 1.02938724e-5f    , 9.76227541e-6f    , 9.28209217e-6f    , 8.84629931e-6f    , 8.44908356e-6f    , 8.08559426e-6f    , 7.75175377e-6f    , },
+/* x = 8.0         */  {0.313308687f      , 0.0195608265f     , 0.00364668856f    , 0.00111862376f    , 0.000468431481f   , 0.000242526294f   , 0.000145770413f   , 9.74720463e-5f    , 7.04136291e-5f    , 5.38480667e-5f    , 4.2978165e-5f     , 3.54424273e-5f    , 2.9982075e-5f     , 2.58805779e-5f    , 2.27070609e-5f    , 2.01901337e-5f    , 1.81519698e-5f    , 1.64720234e-5f    , 1.50661371e-5f    , 1.38740277e-5f    , 1.28515282e-5f    , 1.19656269e-5f    , 1.1191208e-5f     , 1.05088582e-5f    , 9.90335664e-6f    , 9.36261547e-6f    , 8.87692256e-6f    , 8.43839175e-6f    , 8.0405574e-6f     , 7.67807148e-6f    , 7.34647434e-6f    , 7.04201918e-6f    , },
+/* x = 8.1         */  {0.311370654f      , 0.0192016737f     , 0.00353712852f    , 0.00107296935f    , 0.000444891748f   , 0.000228425098f   , 0.000136366478f   , 9.06929059e-5f    , 6.5237929e-5f     , 4.97225713e-5f    , 3.95796121e-5f    , 3.25699208e-5f    , 2.75042617e-5f    , 2.37078645e-5f    , 2.07761237e-5f    , 1.84548426e-5f    , 1.65778384e-5f    , 1.50326869e-5f    , 1.37410434e-5f    , 1.26468808e-5f    , 1.17092106e-5f    , 1.08974381e-5f    , 1.01883148e-5f    , 9.5638906e-6f     , 9.01010618e-6f    , 8.51580647e-6f    , 8.07203653e-6f    , 7.67153074e-6f    , 7.30833659e-6f    , 6.9775338e-6f     , 6.67502198e-6f    , 6.39735819e-6f    , },
+/* x = 8.2         */  {0.309467995f      , 0.0188532525f     , 0.00343201854f    , 0.00102959995f    , 0.000422716223f   , 0.000215231246f   , 0.000127615252f   , 8.44112627e-5f    , 6.04582543e-5f    , 4.59229727e-5f    , 3.64562751e-5f    , 2.99346468e-5f    , 2.52343479e-5f    , 2.17198249e-5f    , 1.90110794e-5f    , 1.68699837e-5f    , 1.5141215e-5f     , 1.371991e-5f      , 1.25331268e-5f    , 1.1528788e-5f     , 1.06688512e-5f    , 9.9249592e-6f     , 9.27558997e-6f    , 8.70414504e-6f    , 8.19763701e-6f    , 7.74577094e-6f    , 7.3402895e-6f     , 6.9744984e-6f     , 6.6429172e-6f     , 6.34101893e-6f    , 6.06503333e-6f    , 5.81179655e-6f    , },
+/* x = 8.3         */  {0.30759966f       , 0.0185151291f     , 0.00333113678f    , 0.000988383557f   , 0.000401817354f   , 0.000202881889f   , 0.000119468913f   , 7.85890987e-5f    , 5.60433526e-5f    , 4.24229017e-5f    , 3.358544e-5f      , 2.75167117e-5f    , 2.31546711e-5f    , 1.99005995e-5f    , 1.73975517e-5f    , 1.54224201e-5f    , 1.38300118e-5f    , 1.25225037e-5f    , 1.14319761e-5f    , 1.05100173e-5f    , 9.7213161e-6f     , 9.03958632e-6f    , 8.4449027e-6f     , 7.92191533e-6f    , 7.4586261e-6f     , 7.04553325e-6f    , 6.67502221e-6f    , 6.34092469e-6f    , 6.03819465e-6f    , 5.76266673e-6f    , 5.51087408e-6f    , 5.27990915e-6f    , },
+/* x = 8.4         */  {0.30576464f       , 0.0181868912f     , 0.00323427418f    , 0.000949196643f   , 0.000382113641f   , 0.000191318777f   , 0.000111883287f   , 7.31913931e-5f    , 5.19644984e-5f    , 3.91981636e-5f    , 3.09462967e-5f    , 2.52979111e-5f    , 2.12490851e-5f    , 1.82357026e-5f    , 1.59224195e-5f    , 1.41001691e-5f    , 1.26332094e-5f    , 1.14302729e-5f    , 1.04281088e-5f    , 9.58170853e-6f    , 8.85829216e-6f    , 8.23349134e-6f    , 7.68885734e-6f    , 7.21019381e-6f    , 6.78641576e-6f    , 6.40875285e-6f    , 6.0701828e-6f     , 5.76502167e-6f    , 5.48862307e-6f    , 5.23715422e-6f    , 5.00742708e-6f    , 4.79676951e-6f    , },
+/* x = 8.5         */  {0.303961965f      , 0.0178681469f     , 0.00314123366f    , 0.000911923526f   , 0.000363529195f   , 0.000180487905f   , 0.000104817564f   , 6.81858801e-5f    , 4.81952842e-5f    , 3.62265566e-5f    , 2.85197769e-5f    , 2.3261585e-5f     , 1.95028286e-5f    , 1.67119028e-5f    , 1.45737062e-5f    , 1.28923007e-5f    , 1.15407619e-5f    , 1.04339279e-5f    , 9.51288865e-6f    , 8.73579478e-6f    , 8.07221337e-6f    , 7.49955171e-6f    , 7.00072673e-6f    , 6.56260787e-6f    , 6.17495299e-6f    , 5.82966632e-6f    , 5.52027136e-6f    , 5.24153017e-6f    , 4.98916414e-6f    , 4.75964629e-6f    , 4.55004484e-6f    , 4.35790388e-6f    , },
+/* x = 8.6         */  {0.302190706f      , 0.0175585233f     , 0.0030518293f     , 0.000876455856f   , 0.000345993326f   , 0.000170339194f   , 9.82340314e-5f    , 6.35428264e-5f    , 4.47114304e-5f    , 3.34877048e-5f    , 2.62884069e-5f    , 2.13924855e-5f    , 1.79024054e-5f    , 1.53171129e-5f    , 1.33404799e-5f    , 1.17888444e-5f    , 1.05435106e-5f    , 9.5250033e-6f     , 8.67844895e-6f    , 7.96493125e-6f    , 7.35619331e-6f    , 6.83128675e-6f    , 6.37439167e-6f    , 5.97336229e-6f    , 5.61873452e-6f    , 5.30303476e-6f    , 5.02028949e-6f    , 4.76567146e-6f    , 4.53524051e-6f    , 4.32575089e-6f    , 4.13450634e-6f    , 3.9592496e-6f     , },
+/* x = 8.7         */  {0.300449968f      , 0.0172576657f     , 0.0029658857f     , 0.000842692109f   , 0.000329440169f   , 0.00016082619f    , 9.20978324e-5f    , 5.92348282e-5f    , 4.14906099e-5f    , 3.09629056e-5f    , 2.42361721e-5f    , 1.96766554e-5f    , 1.64354749e-5f    , 1.40402908e-5f    , 1.2212761e-5f     , 1.07807045e-5f    , 9.63310514e-6f    , 8.69578497e-6f    , 7.91762431e-6f    , 7.26243038e-6f    , 6.70396401e-6f    , 6.22279963e-6f    , 5.8042858e-6f     , 5.43718678e-6f    , 5.11275676e-6f    , 4.82409598e-6f    , 4.56569449e-6f    , 4.33310327e-6f    , 4.1226936e-6f     , 3.93147841e-6f    , 3.75697789e-6f    , 3.59711727e-6f    , },
+/* x = 8.8         */  {0.298738892f      , 0.0169652363f     , 0.00288323726f    , 0.000810537116f   , 0.000313808337f   , 0.000151905793f   , 8.63767415e-5f    , 5.5236623e-5f     , 3.85122881e-5f    , 2.86349899e-5f    , 2.23483939e-5f    , 1.8101318e-5f     , 1.50907522e-5f    , 1.28713483e-5f    , 1.11814392e-5f    , 9.85958305e-6f    , 8.80193178e-6f    , 7.93924282e-6f    , 7.2238877e-6f     , 6.62220283e-6f    , 6.10982019e-6f    , 5.66872458e-6f    , 5.28534556e-6f    , 4.94928835e-6f    , 4.6524703e-6f     , 4.38852101e-6f    , 4.15235774e-6f    , 3.93987984e-6f    , 3.74774524e-6f    , 3.57320473e-6f    , 3.41397751e-6f    , 3.26815643e-6f    , },
+/* x = 8.9         */  {0.297056651f      , 0.0166809136f     , 0.00280372763f    , 0.000779901642f   , 0.000299040594f   , 0.000143538001f   , 8.10409598e-5f    , 5.15249186e-5f    , 3.5757576e-5f     , 2.64881947e-5f    , 2.06116164e-5f    , 1.66547763e-5f    , 1.38579174e-5f    , 1.18010678e-5f    , 1.02381969e-5f    , 9.01790919e-6f    , 8.04304823e-6f    , 7.24896994e-6f    , 6.59129335e-6f    , 6.03870378e-6f    , 5.5685686e-6f     , 5.164179e-6f      , 4.81296463e-6f    , 4.50530797e-6f    , 4.23373867e-6f    , 3.99237462e-6f    , 3.77652691e-6f    , 3.5824157e-6f     , 3.40696277e-6f    , 3.24763772e-6f    , 3.10234263e-6f    , 2.96932436e-6f    , },
+/* x = 9.0         */  {0.295402449f      , 0.0164043911f     , 0.00272720908f    , 0.000750701978f   , 0.000285083558f   , 0.000135685679f   , 7.60629256e-5f    , 4.8078235e-5f     , 3.32090956e-5f    , 2.45080456e-5f    , 1.90135035e-5f    , 1.53263205e-5f    , 1.27275315e-5f    , 1.08210268e-5f    , 9.37544003e-6f    , 8.24877537e-6f    , 7.35012403e-6f    , 6.61912716e-6f    , 6.0144248e-6f     , 5.50688408e-6f    , 5.07548195e-6f    , 4.70471978e-6f    , 4.38295257e-6f    , 4.10128121e-6f    , 3.8528007e-6f     , 3.63207945e-6f    , 3.43479156e-6f    , 3.2574527e-6f     , 3.09722746e-6f    , 2.95178673e-6f    , 2.81920074e-6f    , 2.69785783e-6f    , },
+/* x = 9.1         */  {0.293775522f      , 0.0161353767f     , 0.002653542f      , 0.000722859571f   , 0.000271887428f   , 0.000128314343f   , 7.14171409e-5f    , 4.48767595e-5f    , 3.08508563e-5f    , 2.26812499e-5f    , 1.75427439e-5f    , 1.41061436e-5f    , 1.16909613e-5f    , 9.92352878e-6f    , 8.58623453e-6f    , 7.54587873e-6f    , 6.71738638e-6f    , 6.04439243e-6f    , 5.48834761e-6f    , 5.02214577e-6f    , 4.62625695e-6f    , 4.28630364e-6f    , 3.99149715e-6f    , 3.73360239e-6f    , 3.50623647e-6f    , 3.30438342e-6f    , 3.12405199e-6f    , 2.96203005e-6f    , 2.81570572e-6f    , 2.68293504e-6f    , 2.56194278e-6f    , 2.45124732e-6f    , },
+/* x = 9.2         */  {0.292175133f      , 0.015873592f      , 0.00258259439f    , 0.000696300681f   , 0.000259405727f   , 0.000121391964f   , 6.7080011e-5f     , 4.19022142e-5f    , 2.86681419e-5f    , 2.09955984e-5f    , 1.61889656e-5f    , 1.2985265e-5f     , 1.07403094e-5f    , 9.10153989e-6f    , 7.86424865e-6f    , 6.90346788e-6f    , 6.13957078e-6f    , 5.51991488e-6f    , 5.00856626e-6f    , 4.58030161e-6f    , 4.21697614e-6f    , 3.90525108e-6f    , 3.63513014e-6f    , 3.39899209e-6f    , 3.19093622e-6f    , 3.00633006e-6f    , 2.84149083e-6f    , 2.69345718e-6f    , 2.559823e-6f      , 2.43861462e-6f    , 2.32819894e-6f    , 2.22721378e-6f    , },
+/* x = 9.3         */  {0.290600572f      , 0.0156187714f     , 0.00251424139f    , 0.000670956061f   , 0.000247595064f   , 0.000114888782f   , 6.30296974e-5f    , 3.9137733e-5f     , 2.66474067e-5f    , 1.94398754e-5f    , 1.49426559e-5f    , 1.19554593e-5f    , 9.86835124e-6f    , 8.34863169e-6f    , 7.20370022e-6f    , 6.31629435e-6f    , 5.61187599e-6f    , 5.04127291e-6f    , 4.57098497e-6f    , 4.1775383e-6f     , 3.84407323e-6f    , 3.5582135e-6f     , 3.31069618e-6f    , 3.09446755e-6f    , 2.90407223e-6f    , 2.7352316e-6f     , 2.58454731e-6f    , 2.44928903e-6f    , 2.32724005e-6f    , 2.21658341e-6f    , 2.11581667e-6f    , 2.02368737e-6f    , },
+/* x = 9.4         */  {0.289051155f      , 0.0153706612f     , 0.00244836487f    , 0.000646760654f   , 0.000236414921f   , 0.00010877714f    , 5.92459824e-5f    , 3.65677503e-5f    , 2.47761803e-5f    , 1.80037765e-5f    , 1.37950898e-5f    , 1.10091926e-5f    , 9.06847682e-6f    , 7.65892846e-6f    , 6.59930866e-6f    , 5.77956838e-6f    , 5.12992309e-6f    , 4.60443598e-6f    , 4.17187201e-6f    , 3.81038291e-6f    , 3.50430149e-6f    , 3.24214339e-6f    , 3.01532448e-6f    , 2.81731574e-6f    , 2.64307311e-6f    , 2.4886445e-6f     , 2.35089383e-6f    , 2.22730358e-6f    , 2.11583144e-6f    , 2.0148046e-6f     , 1.92284075e-6f    , 1.83878829e-6f    , },
+/* x = 9.5         */  {0.287526224f      , 0.0151290196f     , 0.002384853f      , 0.000623653324f   , 0.000225827444f   , 0.000103031325f   , 5.57101442e-5f    , 3.41778971e-5f    , 2.30429804e-5f    , 1.66778335e-5f    , 1.27382635e-5f    , 1.01395633e-5f    , 8.33463825e-6f    , 7.02705929e-6f    , 6.0462511e-6f     , 5.28891852e-6f    , 4.68971812e-6f    , 4.20572991e-6f    , 3.8078272e-6f     , 3.47567245e-6f    , 3.19470503e-6f    , 2.95426718e-6f    , 2.74640311e-6f    , 2.56506895e-6f    , 2.40560056e-6f    , 2.26434723e-6f    , 2.13841469e-6f    , 2.0254815e-6f     , 1.92366592e-6f    , 1.83142777e-6f    , 1.74749518e-6f    , 1.67080927e-6f    , },
+/* x = 9.6         */  {0.286025143f      , 0.0148936153f     , 0.00232359986f    , 0.000601576592f   , 0.000215797261f   , 9.76274276e-5f    , 5.2404842e-5f     , 3.19549068e-5f    , 2.14372325e-5f    , 1.54533446e-5f    , 1.17648339e-5f    , 9.34024875e-6f    , 7.66130129e-6f    , 6.44811436e-6f    , 5.54012246e-6f    , 4.84035494e-6f    , 4.28761806e-6f    , 3.84180518e-6f    , 3.47575234e-6f    , 3.17052604e-6f    , 2.91259266e-6f    , 2.69206054e-6f    , 2.50155557e-6f    , 2.33548251e-6f    , 2.18952819e-6f    , 2.06032005e-6f    , 1.94518677e-6f    , 1.84198763e-6f    , 1.74898869e-6f    , 1.66477183e-6f    , 1.58816673e-6f    , 1.5181997e-6f     , },
+/* x = 9.7         */  {0.2845473f        , 0.0146642277f     , 0.00226450513f    , 0.0005804764f     , 0.000206291304f   , 9.25432085e-5f    , 4.93140102e-5f    , 2.98865277e-5f    , 1.99491969e-5f    , 1.4322312e-5f     , 1.08680636e-5f    , 8.60545566e-6f    , 7.04340129e-6f    , 5.91760501e-6f    , 5.07689898e-6f    , 4.43023584e-6f    , 3.9202998e-6f     , 3.50960816e-6f    , 3.17282425e-6f    , 2.8923197e-6f     , 2.65551409e-6f    , 2.4532259e-6f     , 2.27861953e-6f    , 2.12651462e-6f    , 1.99292227e-6f    , 1.87472662e-6f    , 1.76946198e-6f    , 1.67515413e-6f    , 1.59020526e-6f    , 1.51330951e-6f    , 1.44339001e-6f    , 1.37955132e-6f    , },
+/* x = 9.8         */  {0.283092104f      , 0.0144406455f     , 0.00220747373f    , 0.000560301889f   , 0.000197278654f   , 8.7757974e-5f     , 4.64227609e-5f    , 2.79614435e-5f    , 1.85699007e-5f    , 1.32773833e-5f    , 1.00417695e-5f    , 7.92987554e-6f    , 6.47630296e-6f    , 5.43142727e-6f    , 4.65290494e-6f    , 4.05523693e-6f    , 3.58473191e-6f    , 3.20635478e-6f    , 2.8964703e-6f     , 2.63866335e-6f    , 2.42123833e-6f    , 2.23567204e-6f    , 2.07562746e-6f    , 1.93630797e-6f    , 1.81402423e-6f    , 1.70589734e-6f    , 1.60965128e-6f    , 1.52346522e-6f    , 1.44586673e-6f    , 1.37565327e-6f    , 1.31183387e-6f    , 1.25358502e-6f    , },
+/* x = 9.9         */  {0.281658985f      , 0.0142226672f     , 0.0021524155f     , 0.000541005192f   , 0.000188730387f   , 8.32524646e-5f    , 4.37172944e-5f    , 2.61691992e-5f    , 1.72910761e-5f    , 1.23117986e-5f    , 9.2802773e-6f     , 7.3086435e-6f     , 5.95576356e-6f    , 4.98582863e-6f    , 4.26478237e-6f    , 3.71232357e-6f    , 3.27814891e-6f    , 2.92950667e-6f    , 2.64434603e-6f    , 2.40737986e-6f    , 2.20773396e-6f    , 2.03749547e-6f    , 1.89078905e-6f    , 1.76317298e-6f    , 1.65123475e-6f    , 1.55231419e-6f    , 1.46431018e-6f    , 1.3855433e-6f     , 1.31465655e-6f    , 1.25054248e-6f    , 1.19228911e-6f    , 1.13913908e-6f    , },
+/* x = 10.0        */  {0.280247391f      , 0.0140100995f     , 0.00209924493f    , 0.000522541237f   , 0.000180619436f   , 7.90087499e-5f    , 4.11848159e-5f    , 2.45001339e-5f    , 1.61051039e-5f    , 1.14193418e-5f    , 8.57837826e-6f    , 6.73730069e-6f    , 5.4778993e-6f     , 4.57737764e-6f    , 3.90946333e-6f    , 3.39872533e-6f    , 2.99802778e-6f    , 2.67674935e-6f    , 2.41431487e-6f    , 2.19648602e-6f    , 2.01315125e-6f    , 1.85696357e-6f    , 1.72247519e-6f    , 1.60557269e-6f    , 1.50309934e-6f    , 1.41259689e-6f    , 1.33212558e-6f    , 1.2601363e-6f     , 1.19537835e-6f    , 1.1368318e-6f     , 1.08365732e-6f    , 1.03515833e-6f    , },
+/* x = 10.1        */  {0.27885679f       , 0.013802758f      , 0.00204788091f    , 0.000504867573f   , 0.000172920468f   , 7.50101316e-5f    , 3.881346e-5f      , 2.29453181e-5f    , 1.50049612e-5f    , 1.05942963e-5f    , 7.9312908e-6f     , 6.21175998e-6f    , 5.03915467e-6f    , 4.20293622e-6f    , 3.58414469e-6f    , 3.1119129e-6f     , 2.74206657e-6f    , 2.44597236e-6f    , 2.20442957e-6f    , 2.0041752e-6f     , 1.83580582e-6f    , 1.69249918e-6f    , 1.56920343e-6f    , 1.46210887e-6f    , 1.36829514e-6f    , 1.28549043e-6f    , 1.2119038e-6f     , 1.14610625e-6f    , 1.08694498e-6f    , 1.03348062e-6f    , 9.8494065e-7f     , 9.40684378e-7f    , },
+/* x = 10.2        */  {0.277486671f      , 0.0136004657f     , 0.00199824641f    , 0.000487944203f   , 0.00016560976f    , 7.12410549e-5f    , 3.65922199e-5f    , 2.1496497e-5f     , 1.39841734e-5f    , 9.83140337e-6f    , 7.33462477e-6f    , 5.72827458e-6f    , 4.63627435e-6f    , 3.85963431e-6f    , 3.28626509e-6f    , 2.8495769e-6f     , 2.50816497e-6f    , 2.23525124e-6f    , 2.01291542e-6f    , 1.82880156e-6f    , 1.67416383e-6f    , 1.54266658e-6f    , 1.42962473e-6f    , 1.33150951e-6f    , 1.24561904e-6f    , 1.16985365e-6f    , 1.10255968e-6f    , 1.04241884e-6f    , 9.88368518e-7f    , 9.39543472e-7f    , 8.95232654e-7f    , 8.54846725e-7f    , },
+/* x = 10.3        */  {0.276136535f      , 0.0134030535f     , 0.00195026832f    , 0.000471733422f   , 0.00015866509f    , 6.76870251e-5f    , 3.45108825e-5f    , 2.01460378e-5f    , 1.30367704e-5f    , 9.12582536e-6f    , 6.78434887e-6f    , 5.28340927e-6f    , 4.26627758e-6f    , 3.54484681e-6f    , 3.01348392e-6f    , 2.60960866e-6f    , 2.29440647e-6f    , 2.04283098e-6f    , 1.83815482e-6f    , 1.66886568e-6f    , 1.52682847e-6f    , 1.40615884e-6f    , 1.30251141e-6f    , 1.21261738e-6f    , 1.13397678e-6f    , 1.06464889e-6f    , 1.00310671e-6f    , 9.48133999e-7f    , 8.98751203e-7f    , 8.54161329e-7f    , 8.13709865e-7f    , 7.76854689e-7f    , },
+/* x = 10.4        */  {0.274805903f      , 0.0132103591f     , 0.00190387716f    , 0.000456199679f   , 0.000152065638f   , 6.43345317e-5f    , 3.25599695e-5f    , 1.88868808e-5f    , 1.21572466e-5f    , 8.473111e-6f      , 6.27676086e-6f    , 4.87401419e-6f    , 3.92643477e-6f    , 3.25617242e-6f    , 2.76366213e-6f    , 2.39008264e-6f    , 2.09904225e-6f    , 1.86711111e-6f    , 1.67867336e-6f    , 1.52300151e-6f    , 1.39252768e-6f    , 1.28178614e-6f    , 1.18674621e-6f    , 1.10437964e-6f    , 1.03237308e-6f    , 9.68932589e-7f    , 9.12648032e-7f    , 8.62397243e-7f    , 8.17277182e-7f    , 7.7655367e-7f     , 7.39624208e-7f    , 7.05990081e-7f    , },
+/* x = 10.5        */  {0.273494311f      , 0.0130222273f     , 0.00185900693f    , 0.000441309439f   , 0.000145791887f   , 6.11709777e-5f    , 3.07306812e-5f    , 1.77124955e-5f    , 1.1340523e-5f     , 7.86916392e-6f    , 5.80846024e-6f    , 4.49720075e-6f    , 3.61424609e-6f    , 2.99141442e-6f    , 2.53484476e-6f    , 2.18924042e-6f    , 1.92047637e-6f    , 1.70663194e-6f    , 1.53312707e-6f    , 1.38996439e-6f    , 1.27010295e-6f    , 1.16846532e-6f    , 1.08131236e-6f    , 1.00583841e-6f    , 9.39902669e-7f    , 8.81846735e-7f    , 8.30368291e-7f    , 7.84431909e-7f    , 7.43205031e-7f    , 7.06011305e-7f    , 6.7229608e-7f     , 6.41600548e-7f    , },
+/* x = 10.6        */  {0.27220131f       , 0.0128385092f     , 0.00181559488f    , 0.000427031056f   , 0.000139825537f   , 5.81846143e-5f    , 2.90148466e-5f    , 1.66168394e-5f    , 1.05819142e-5f    , 7.31021378e-6f    , 5.37632321e-6f    , 4.1503197e-6f     , 3.32742186e-6f    , 2.74856305e-6f    , 2.32524494e-6f    , 2.00547611e-6f    , 1.75725234e-6f    , 1.56006215e-6f    , 1.40029083e-6f    , 1.26862032e-6f    , 1.15849919e-6f    , 1.06521023e-6f    , 9.85284449e-7f    , 9.16122192e-7f    , 8.55742137e-7f    , 8.02611084e-7f    , 7.55526206e-7f    , 7.13532036e-7f    , 6.75860956e-7f    , 6.41889846e-7f    , 6.11108075e-7f    , 5.8309353e-7f     , },
+/* x = 10.7        */  {0.270926467f      , 0.0126590618f     , 0.00177358132f    , 0.000413334658f   , 0.000134149424f   , 5.53644802e-5f    , 2.74048759e-5f    , 1.559432e-5f      , 9.87709638e-6f    , 6.79278975e-6f    , 4.97747978e-6f    , 3.830941e-6f      , 3.06386473e-6f    , 2.52577945e-6f    , 2.13322931e-6f    , 1.83732299e-6f    , 1.60804088e-6f    , 1.42618744e-6f    , 1.27904778e-6f    , 1.15793599e-6f    , 1.0567554e-6f     , 9.71123058e-7f    , 8.97820261e-7f    , 8.34438031e-7f    , 7.79142501e-7f    , 7.30516105e-7f    , 6.87447824e-7f    , 6.49055922e-7f    , 6.14632608e-7f    , 5.83603774e-7f    , 5.55499286e-7f    , 5.29930773e-7f    , },
+/* x = 10.8        */  {0.26966936f       , 0.0124837482f     , 0.00173290949f    , 0.000400192035f   , 0.000128747442f   , 5.27003459e-5f    , 2.58937177e-5f    , 1.46397605e-5f    , 9.22207887e-6f    , 6.31369618e-6f    , 4.60929278e-6f    , 3.53683541e-6f    , 2.82165329e-6f    , 2.32138096e-6f    , 1.95730475e-6f    , 1.68344141e-6f    , 1.47162871e-6f    , 1.30390019e-6f    , 1.16837978e-6f    , 1.05696984e-6f    , 9.63996308e-7f    , 8.85386353e-7f    , 8.18153229e-7f    , 7.6006444e-7f     , 7.09422467e-7f    , 6.64916549e-7f    , 6.25520398e-7f    , 5.90420264e-7f    , 5.58963476e-7f    , 5.30621053e-7f    , 5.04960126e-7f    , 4.81623345e-7f    , },
+/* x = 10.9        */  {0.268429584f      , 0.0123124369f     , 0.00169352535f    , 0.000387576537f   , 0.000123604474f   , 5.01826619e-5f    , 2.44748186e-5f    , 1.37483674e-5f    , 8.61317781e-6f    , 5.86999031e-6f    , 4.26933862e-6f    , 3.26595766e-6f    , 2.59902717e-6f    , 2.13382776e-6f    , 1.79610622e-6f    , 1.54260763e-6f    , 1.34690838e-6f    , 1.19219002e-6f    , 1.06735856e-6f    , 9.64863888e-7f    , 8.79424663e-7f    , 8.07255834e-7f    , 7.45585636e-7f    , 6.92344937e-7f    , 6.45962296e-7f    , 6.0522562e-7f     , 5.69186817e-7f    , 5.3709483e-7f     , 5.08347783e-7f    , 4.8245824e-7f     , 4.59027623e-7f    , 4.37727109e-7f    , },
+/* x = 11.0        */  {0.267206743f      , 0.0121450019f     , 0.00165537745f    , 0.00037546298f    , 0.000118706326f   , 4.78025104e-5f    , 2.3142087e-5f     , 1.29157014e-5f    , 8.0469918e-6f     , 5.45896181e-6f    , 3.95538971e-6f    , 3.01643105e-6f    , 2.39437334e-6f    , 1.96171057e-6f    , 1.64838567e-6f    , 1.4137038e-6f     , 1.23286895e-6f    , 1.09013521e-6f    , 9.75137803e-7f    , 8.80836269e-7f    , 8.02314259e-7f    , 7.3605381e-7f     , 6.79482411e-7f    , 6.30682167e-7f    , 5.88198231e-7f    , 5.5090966e-7f     , 5.1794054e-7f     , 4.88597628e-7f    , 4.62325853e-7f    , 4.38676037e-7f    , 4.17281153e-7f    , 3.97838617e-7f    , },
+/* x = 11.1        */  {0.266000458f      , 0.0119813219f     , 0.00161841682f    , 0.000363827556f   , 0.000114039665f   , 4.55515615e-5f    , 2.18898582e-5f    , 1.21376501e-5f    , 7.52037965e-6f    , 5.07811397e-6f    , 3.66539827e-6f    , 2.78653333e-6f    , 2.20621364e-6f    , 1.80373951e-6f    , 1.51300193e-6f    , 1.29570866e-6f    , 1.1285876e-6f     , 9.96894906e-7f    , 8.90945851e-7f    , 8.04174444e-7f    , 7.32003582e-7f    , 6.711632e-7f      , 6.19265485e-7f    , 5.74532567e-7f    , 5.35617425e-7f    , 5.01483334e-7f    , 4.71321e-7f       , 4.44490503e-7f    , 4.20479902e-7f    , 3.98875252e-7f    , 3.79338562e-7f    , 3.61591371e-7f    , },
+/* x = 11.2        */  {0.264810358f      , 0.0118212805f     , 0.00158259676f    , 0.000352647749f   , 0.000109591966f   , 4.34220314e-5f    , 2.07128638e-5f    , 1.14104033e-5f    , 7.03043986e-6f    , 4.7251465e-6f     , 3.39748158e-6f    , 2.5746838e-6f     , 2.03319337e-6f    , 1.65873384e-6f    , 1.3889115e-6f     , 1.18768918e-6f    , 1.0332218e-6f     , 9.11701938e-7f    , 8.14079097e-7f    , 7.34229041e-7f    , 6.67890024e-7f    , 6.12022095e-7f    , 5.64408662e-7f    , 5.23401505e-7f    , 4.87753334e-7f    , 4.56505237e-7f    , 4.28909421e-7f    , 4.04375144e-7f    , 3.82430217e-7f    , 3.62693137e-7f    , 3.44852636e-7f    , 3.28652443e-7f    , },
+/* x = 11.3        */  {0.263636084f      , 0.011664766f      , 0.00154787279f    , 0.000341902258f   , 0.000105351455f   , 4.14066447e-5f    , 1.96062021e-5f    , 1.07304293e-5f    , 6.57449184e-6f    , 4.39793969e-6f    , 3.1499084e-6f     , 2.37943151e-6f    , 1.87407082e-6f    , 1.52561267e-6f    , 1.27516008e-6f    , 1.08879283e-6f    , 9.46002365e-7f    , 8.33856363e-7f    , 7.43895948e-7f    , 6.70408222e-7f    , 6.09424619e-7f    , 5.58118811e-7f    , 5.14432948e-7f    , 4.76838867e-7f    , 4.44181525e-7f    , 4.15573915e-7f    , 3.90325018e-7f    , 3.67889456e-7f    , 3.47831674e-7f    , 3.29800051e-7f    , 3.13507908e-7f    , 2.98719386e-7f    , },
+/* x = 11.4        */  {0.262477291f      , 0.0115116708f     , 0.0015142025f     , 0.000331570922f   , 0.00010130706f    , 3.94985989e-5f    , 1.85653115e-5f    , 1.00944546e-5f    , 6.15005853e-6f    , 4.09453992e-6f    , 2.92108656e-6f    , 2.19944443e-6f    , 1.72770776e-6f    , 1.40338637e-6f    , 1.17087487e-6f    , 9.98240636e-7f    , 8.66226968e-7f    , 7.62719521e-7f    , 6.79811334e-7f    , 6.12172566e-7f    , 5.56107247e-7f    , 5.0898738e-7f     , 4.68902303e-7f    , 4.34435034e-7f    , 4.04515866e-7f    , 3.78324237e-7f    , 3.55221546e-7f    , 3.34704259e-7f    , 3.16370588e-7f    , 2.99896433e-7f    , 2.85017749e-7f    , 2.7151745e-7f     , },
+/* x = 11.5        */  {0.26133364f       , 0.0113618917f     , 0.00148154544f    , 0.000321634656f   , 9.74483696e-5f    , 3.76915318e-5f    , 1.75859459e-5f    , 9.49944364e-6f    , 5.75485048e-6f    , 3.81314628e-6f    , 2.70955156e-6f    , 2.03349952e-6f    , 1.59306067e-6f    , 1.29114884e-6f    , 1.07525761e-6f    , 9.1532074e-7f     , 7.93254319e-7f    , 6.97708649e-7f    , 6.212917e-7f      , 5.59030405e-7f    , 5.07482269e-7f    , 4.64203453e-7f    , 4.27419777e-7f    , 3.95817234e-7f    , 3.6840506e-7f     , 3.44424102e-7f    , 3.23284156e-7f    , 3.04520289e-7f    , 2.8776184e-7f     , 2.72710056e-7f    , 2.59121726e-7f    , 2.46797031e-7f    , },
+/* x = 11.6        */  {0.260204805f      , 0.0112153293f     , 0.001449863f      , 0.000312075385f   , 9.37655865e-5f    , 3.5979491e-5f     , 1.66641514e-5f    , 8.94258107e-6f    , 5.38675122e-6f    , 3.55209841e-6f    , 2.51395612e-6f    , 1.88047374e-6f    , 1.46917277e-6f    , 1.18807033e-6f    , 9.87578063e-7f    , 8.3938259e-7f     , 7.26498817e-7f    , 6.38291949e-7f    , 5.67850452e-7f    , 5.10533577e-7f    , 4.63134559e-7f    , 4.23380569e-7f    , 3.89623997e-7f    , 3.60646213e-7f    , 3.35529494e-7f    , 3.13571442e-7f    , 2.94226544e-7f    , 2.77065478e-7f    , 2.61746273e-7f    , 2.47993528e-7f    , 2.35583207e-7f    , 2.24331375e-7f    , },
+/* x = 11.7        */  {0.25909047f       , 0.0110718879f     , 0.00141911837f    , 0.000302875983f   , 9.02494899e-5f    , 3.43569056e-5f    , 1.57962454e-5f    , 8.42125516e-6f    , 5.04380377e-6f    , 3.30986517e-6f    , 2.33306064e-6f    , 1.73933566e-6f    , 1.35516671e-6f    , 1.09339096e-6f    , 9.0716824e-7f     , 7.69831616e-7f    , 6.6542568e-7f     , 5.83984115e-7f    , 5.19043798e-7f    , 4.66273562e-7f    , 4.22685887e-7f    , 3.86166761e-7f    , 3.55185965e-7f    , 3.28613216e-7f    , 3.05598375e-7f    , 2.85491505e-7f    , 2.67788358e-7f    , 2.52092471e-7f    , 2.38088323e-7f    , 2.2552202e-7f     , 2.1418718e-7f     , 2.0391448e-7f     , },
+/* x = 11.8        */  {0.257990326f      , 0.0109314755f     , 0.00138927635f    , 0.000294020221f   , 8.68913978e-5f    , 3.28185603e-5f    , 1.49787968e-5f    , 7.9330424e-6f     , 4.72419823e-6f    , 3.0850344e-6f     , 2.1657244e-6f     , 1.6091379e-6f     , 1.25023787e-6f    , 1.00641478e-6f    , 8.33417001e-7f    , 7.06124369e-7f    , 6.09546505e-7f    , 5.34342235e-7f    , 4.74466963e-7f    , 4.25877954e-7f    , 3.85791622e-7f    , 3.52241465e-7f    , 3.23806148e-7f    , 2.99437235e-7f    , 2.78347124e-7f    , 2.59934372e-7f    , 2.43732842e-7f    , 2.29376385e-7f    , 2.16573867e-7f    , 2.05091207e-7f    , 1.94738277e-7f    , 1.85359193e-7f    , },
+/* x = 11.9        */  {0.256904077f      , 0.0107940036f     , 0.00136030338f    , 0.00028549271f    , 8.3683133e-5f     , 3.13595711e-5f    , 1.42086083e-5f    , 7.4756934e-6f     , 4.42626035e-6f    , 2.87630341e-6f    , 2.01089748e-6f    , 1.48901018e-6f    , 1.15364829e-6f    , 9.26504301e-7f    , 7.65765181e-7f    , 6.47764095e-7f    , 5.58415215e-7f    , 4.88962071e-7f    , 4.33750743e-7f    , 3.89007256e-7f    , 3.52137738e-7f    , 3.21312709e-7f    , 2.95211835e-7f    , 2.7286251e-7f     , 2.53535008e-7f    , 2.36672713e-7f    , 2.21844687e-7f    , 2.08712756e-7f    , 1.97008267e-7f    , 1.86515396e-7f    , 1.77058973e-7f    , 1.68495485e-7f    , },
+/* x = 12.0        */  {0.255831431f      , 0.0106593869f     , 0.00133216736f    , 0.000277278857f   , 8.06169912e-5f    , 2.99753628e-5f    , 1.34826991e-5f    , 7.04711984e-6f    , 4.14844105e-6f    , 2.68247023e-6f    , 1.86761342e-6f    , 1.37815289e-6f    , 1.06472101e-6f    , 8.53075536e-7f    , 7.0370113e-7f     , 5.94296684e-7f    , 5.11624368e-7f    , 4.47474658e-7f    , 3.96558362e-7f    , 3.5535196e-7f     , 3.21438087e-7f    , 2.9311455e-7f     , 2.6915472e-7f     , 2.48656253e-7f    , 2.3094298e-7f     , 2.15499736e-7f    , 2.0192809e-7f     , 1.89915685e-7f    , 1.79214597e-7f    , 1.6962582e-7f     , 1.60987959e-7f    , 1.5316888e-7f     , },
+/* x = 12.1        */  {0.254772107f      , 0.0105275433f     , 0.00130483762f    , 0.000269364817f   , 7.76857109e-5f    , 2.86616482e-5f    , 1.27982899e-5f    , 6.64538248e-6f    , 3.88930677e-6f    , 2.5024257e-6f     , 1.73498244e-6f    , 1.27583132e-6f    , 9.82835006e-7f    , 7.85593467e-7f    , 6.46756627e-7f    , 5.45306981e-7f    , 4.68801784e-7f    , 4.09543208e-7f    , 3.62582605e-7f    , 3.24629882e-7f    , 2.93431907e-7f    , 2.6740475e-7f     , 2.45408719e-7f    , 2.26606575e-7f    , 2.10371727e-7f    , 1.9622733e-7f     , 1.83804982e-7f    , 1.72816149e-7f    , 1.63032024e-7f    , 1.54269096e-7f    , 1.46378653e-7f    , 1.39239032e-7f    , },
+/* x = 12.2        */  {0.253725832f      , 0.0103983935f     , 0.00127828484f    , 0.000261737448f   , 7.4882446e-5f     , 2.74144081e-5f    , 1.21527883e-5f    , 6.26868e-6f       , 3.64753051e-6f    , 2.33514602e-6f    , 1.6121852e-6f     , 1.18137023e-6f    , 9.07420478e-7f    , 7.23567883e-7f    , 5.94503165e-7f    , 5.00415417e-7f    , 4.29607472e-7f    , 3.74860286e-7f    , 3.31543213e-7f    , 2.9658374e-7f     , 2.67881568e-7f    , 2.43962651e-7f    , 2.23767967e-7f    , 2.06520612e-7f    , 1.91639883e-7f    , 1.78684371e-7f    , 1.67313414e-7f    , 1.57260465e-7f    , 1.48314344e-7f    , 1.40305819e-7f    , 1.33097857e-7f    , 1.26578429e-7f    , },
+/* x = 12.3        */  {0.252692341f      , 0.0102718613f     , 0.00125248099f    , 0.000254384276f   , 7.22007394e-5f    , 2.62298744e-5f    , 1.15437754e-5f    , 5.91533883e-6f    , 3.42188366e-6f    , 2.17968609e-6f    , 1.49846712e-6f    , 1.09414899e-6f    , 8.37954562e-7f    , 6.66549577e-7f    , 5.46548541e-7f    , 4.59274928e-7f    , 3.93730825e-7f    , 3.43145234e-7f    , 3.03184502e-7f    , 2.70978947e-7f    , 2.44570507e-7f    , 2.22587249e-7f    , 2.04045009e-7f    , 1.88222803e-7f    , 1.74582409e-7f    , 1.62715186e-7f    , 1.52306099e-7f    , 1.43108895e-7f    , 1.34928648e-7f    , 1.27609287e-7f    , 1.21024532e-7f    , 1.15071219e-7f    , },
+/* x = 12.4        */  {0.251671375f      , 0.0101478732f     , 0.00122739924f    , 0.000247293452f   , 6.9634499e-5f     , 2.51045122e-5f    , 1.09689938e-5f    , 5.58380364e-6f    , 3.21122846e-6f    , 2.03517319e-6f    , 1.39313314e-6f    , 1.01359707e-6f    , 7.73957413e-7f    , 6.1412688e-7f     , 5.02533752e-7f    , 4.2156815e-7f     , 3.60888062e-7f    , 3.14141828e-7f    , 2.77273196e-7f    , 2.47601595e-7f    , 2.23301351e-7f    , 2.0309543e-7f     , 1.86069145e-7f    , 1.71553339e-7f    , 1.59049121e-7f    , 1.48178155e-7f    , 1.3864908e-7f     , 1.30234376e-7f    , 1.22754112e-7f    , 1.16064341e-7f    , 1.10048686e-7f    , 1.04612143e-7f    , },
+/* x = 12.5        */  {0.250662684f      , 0.0100263583f     , 0.00120301393f    , 0.000240453719f   , 6.71779753e-5f    , 2.4035005e-5f     , 1.04263361e-5f    , 5.27262863e-6f    , 3.01451105e-6f    , 1.90080139e-6f    , 1.29554293e-6f    , 9.39189932e-7f    , 7.14988611e-7f    , 5.65922484e-7f    , 4.62130156e-7f    , 3.87004854e-7f    , 3.30819892e-7f    , 2.8761613e-7f     , 2.53596455e-7f    , 2.26256627e-7f    , 2.03894212e-7f    , 1.8532038e-7f     , 1.69684927e-7f    , 1.56366742e-7f    , 1.44903347e-7f    , 1.34944434e-7f    , 1.26220519e-7f    , 1.18521373e-7f    , 1.11680893e-7f    , 1.05566309e-7f    , 1.00070364e-7f    , 9.51055601e-8f    , },
+/* x = 12.6        */  {0.249666023f      , 0.00990724806f    , 0.00117930048f    , 0.000233854381f   , 6.48257401e-5f    , 2.30182399e-5f    , 9.91383428e-6f    , 4.98046946e-6f    , 2.83075503e-6f    , 1.7758262e-6f     , 1.20510645e-6f    , 8.70445247e-7f    , 6.60643867e-7f    , 5.21590534e-7f    , 4.25036872e-7f    , 3.55319605e-7f    , 3.03289386e-7f    , 2.63354544e-7f    , 2.31960071e-7f    , 2.06766167e-7f    , 1.8618513e-7f     , 1.69110123e-7f    , 1.54750795e-7f    , 1.42530577e-7f    , 1.3202071e-7f     , 1.22896807e-7f    , 1.14909601e-7f    , 1.07864825e-7f    , 1.01609133e-7f    , 9.60200546e-8f    , 9.09987296e-8f    , 8.64645742e-8f    , },
+/* x = 12.7        */  {0.248681156f      , 0.00979047658f    , 0.00115623538f    , 0.000227485266f   , 6.25726669e-5f    , 2.20512943e-5f    , 9.42965009e-6f    , 4.70607581e-6f    , 2.65905558e-6f    , 1.65955981e-6f    , 1.12127996e-6f    , 8.06919429e-7f    , 6.1055202e-7f     , 4.80813974e-7f    , 3.90978415e-7f    , 3.26269626e-7f    , 2.78080033e-7f    , 2.41162029e-7f    , 2.12186828e-7f    , 1.88967996e-7f    , 1.70024656e-7f    , 1.54326195e-7f    , 1.41137828e-7f    , 1.2992428e-7f     , 1.20288015e-7f    , 1.11928629e-7f    , 1.04615533e-7f    , 9.81691994e-8f    , 9.24480476e-8f    , 8.73391006e-8f    , 8.27512353e-8f    , 7.86102283e-8f    , },
+/* x = 12.8        */  {0.247707852f      , 0.00967598013f    , 0.00113379608f    , 0.000221336704f   , 6.04139123e-5f    , 2.11314234e-5f    , 8.9720658e-6f     , 4.44828448e-6f    , 2.49857401e-6f    , 1.55136663e-6f    , 1.04356224e-6f    , 7.48204471e-7f    , 5.64372276e-7f    , 4.43302122e-7f    , 3.59702528e-7f    , 2.99632841e-7f    , 2.54993965e-7f    , 2.2086048e-7f     , 1.94115008e-7f    , 1.7271417e-7f     , 1.55276564e-7f    , 1.40842443e-7f    , 1.28728613e-7f    , 1.18438087e-7f    , 1.09602246e-7f    , 1.01942871e-7f    , 9.52466346e-8f    , 8.93476197e-8f    , 8.41150981e-8f    , 7.94448444e-8f    , 7.52528613e-8f    , 7.14707799e-8f    , },
+/* x = 12.9        */  {0.246745886f      , 0.00956369722f    , 0.00111196099f    , 0.000215399493f   , 5.83448992e-5f    , 2.02560482e-5f    , 8.53947595e-6f    , 4.20601306e-6f    , 2.34853277e-6f    , 1.45065918e-6f    , 9.71491244e-7f    , 6.93925031e-7f    , 5.21791682e-7f    , 4.08788438e-7f    , 3.30978198e-7f    , 2.75206102e-7f    , 2.33850342e-7f    , 2.02287247e-7f    , 1.77597027e-7f    , 1.57869755e-7f    , 1.41816671e-7f    , 1.28543922e-7f    , 1.17416215e-7f    , 1.07972067e-7f    , 9.98696451e-8f    , 9.28512513e-8f    , 8.6719515e-8f     , 8.13210842e-8f    , 7.65352443e-8f    , 7.22658372e-8f    , 6.8435429e-8f     , 6.49810405e-8f    , },
+/* x = 13.0        */  {0.245795041f      , 0.00945356848f    , 0.00109070943f    , 0.000209664877f   , 5.63613004e-5f    , 1.94227452e-5f    , 8.13037952e-6f    , 3.97825401e-6f    , 2.2082108e-6f     , 1.35689439e-6f    , 9.04640924e-7f    , 6.43735769e-7f    , 4.82522819e-7f    , 3.77028502e-7f    , 3.04593852e-7f    , 2.5280355e-7f     , 2.14483871e-7f    , 1.85293782e-7f    , 1.62498191e-7f    , 1.4431168e-7f     , 1.29531773e-7f    , 1.17325896e-7f    , 1.07103236e-7f    , 9.84352385e-8f    , 9.1004877e-8f     , 8.45734448e-8f    , 7.89583184e-8f    , 7.40177487e-8f    , 6.96402604e-8f    , 6.57371322e-8f    , 6.22369767e-8f    , 5.90817758e-8f    , },
+/* x = 13.1        */  {0.244855103f      , 0.00934553655f    , 0.00107002154f    , 0.000204124522f   , 5.44590238e-5f    , 1.8629236e-5f     , 7.74337274e-6f    , 3.76406927e-6f    , 2.07693925e-6f    , 1.2695701e-6f     , 8.42618372e-7f    , 5.973189e-7f      , 4.46301682e-7f    , 3.47798146e-7f    , 2.80355699e-7f    , 2.3225514e-7f     , 1.96743462e-7f    , 1.69744413e-7f    , 1.48695566e-7f    , 1.31927684e-7f    , 1.18318666e-7f    , 1.07092927e-7f    , 9.77009636e-8f    , 8.9744761e-8f     , 8.29302726e-8f    , 7.70363638e-8f    , 7.18940431e-8f    , 6.7372277e-8f     , 6.3368115e-8f     , 5.9799692e-8f     , 5.6601191e-8f     , 5.37191612e-8f    , },
+/* x = 13.2        */  {0.243925865f      , 0.00923954602f    , 0.00104987831f    , 0.000198770491f   , 5.26341983e-5f    , 1.78733782e-5f    , 7.37714237e-6f    , 3.56258521e-6f    , 1.95409761e-6f    , 1.1882219e-6f     , 7.85061173e-7f    , 5.54381948e-7f    , 4.12885743e-7f    , 3.20891757e-7f    , 2.58086221e-7f    , 2.13405273e-7f    , 1.80490995e-7f    , 1.55515213e-7f    , 1.36076942e-7f    , 1.20615366e-7f    , 1.0808326e-7f     , 9.7758048e-8f     , 8.91285935e-8f    , 8.18252087e-8f    , 7.55751368e-8f    , 7.0173504e-8f     , 6.54639208e-8f    , 6.13252501e-8f    , 5.76624075e-8f    , 5.43998497e-8f    , 5.14768914e-8f    , 4.8844287e-8f     , },
+/* x = 13.3        */  {0.243007127f      , 0.00913554334f    , 0.00103026149f    , 0.000193595223f   , 5.08831605e-5f    , 1.71531561e-5f    , 7.03045953e-6f    , 3.37298799e-6f    , 1.83911003e-6f    , 1.1124202e-6f     , 7.31634983e-7f    , 5.14655693e-7f    , 3.8205217e-7f     , 2.96120716e-7f    , 2.37622786e-7f    , 1.96111564e-7f    , 1.65600198e-7f    , 1.42492982e-7f    , 1.24539893e-7f    , 1.1028131e-7f     , 9.87397699e-8f    , 8.92420059e-8f    , 8.13125205e-8f    , 7.46079027e-8f    , 6.88751209e-8f    , 6.39243503e-8f    , 5.96108516e-8f    , 5.58226288e-8f    , 5.24718563e-8f    , 4.94888194e-8f    , 4.68175616e-8f    , 4.44127085e-8f    , },
+/* x = 13.4        */  {0.242098692f      , 0.00903347676f    , 0.00101115355f    , 0.000188591515f   , 4.92024426e-5f    , 1.64666731e-5f    , 6.70217388e-6f    , 3.19451927e-6f    , 1.73144197e-6f    , 1.04176752e-6f    , 6.82031295e-7f    , 4.77892279e-7f    , 3.53596205e-7f    , 2.73311978e-7f    , 2.18816392e-7f    , 1.80243704e-7f    , 1.51955623e-7f    , 1.30574308e-7f    , 1.1399092e-7f     , 1.00840296e-7f    , 9.0209979e-8f     , 8.14725756e-8f    , 7.41856955e-8f    , 6.80303055e-8f    , 6.2771651e-8f     , 5.82338353e-8f    , 5.42828913e-8f    , 5.0815266e-8f     , 4.77498327e-8f    , 4.50222519e-8f    , 4.25809235e-8f    , 4.03840381e-8f    , },
+/* x = 13.5        */  {0.241200369f      , 0.00893329623f    , 0.000992537694f   , 0.0001837525f     , 4.75887609e-5f    , 1.5812144e-5f     , 6.39120834e-6f    , 3.0264722e-6f     , 1.63059718e-6f    , 9.75896036e-7f    , 6.35965393e-7f    , 4.43863487e-7f    , 3.27329671e-7f    , 2.52306767e-7f    , 2.01530504e-7f    , 1.65682427e-7f    , 1.39451709e-7f    , 1.19664716e-7f    , 1.04344665e-7f    , 9.22145751e-8f    , 8.24225683e-8f    , 7.43839339e-8f    , 6.76870396e-8f    , 6.20354702e-8f    , 5.7211408e-8f     , 5.30518483e-8f    , 4.94327843e-8f    , 4.62584623e-8f    , 4.34539384e-8f    , 4.09598298e-8f    , 3.87285508e-8f    , 3.67215744e-8f    , },
+/* x = 13.6        */  {0.240311972f      , 0.00883495335f    , 0.000974397778f   , 0.000179071632f   , 4.60390048e-5f    , 1.51878878e-5f    , 6.09655407e-6f    , 2.86818779e-6f    , 1.53611477e-6f    , 9.14465294e-7f    , 5.93174467e-7f    , 4.12359145e-7f    , 3.03079605e-7f    , 2.32959376e-7f    , 1.85640003e-7f    , 1.52318566e-7f    , 1.27991929e-7f    , 1.09677889e-7f    , 9.55232002e-8f    , 8.43332106e-8f    , 7.53125049e-8f    , 6.7916089e-8f     , 6.17609098e-8f    , 5.65715391e-8f    , 5.2145855e-8f     , 4.83327873e-8f    , 4.50175395e-8f    , 4.21115629e-8f    , 3.95456207e-8f    , 3.72649006e-8f    , 3.52255169e-8f    , 3.3391965e-8f     , },
+/* x = 13.7        */  {0.239433319f      , 0.00873840132f    , 0.000956718304f   , 0.000174542667f   , 4.45502271e-5f    , 1.45923211e-5f    , 5.81726589e-6f    , 2.71905147e-6f    , 1.44756663e-6f    , 8.57160085e-7f    , 5.53415885e-7f    , 3.83185665e-7f    , 2.80687005e-7f    , 2.15136086e-7f    , 1.71030217e-7f    , 1.40052188e-7f    , 1.17488009e-7f    , 1.00534961e-7f    , 8.7455375e-8f     , 7.71314785e-8f    , 6.88204853e-8f    , 6.20143624e-8f    , 5.63566139e-8f    , 5.15912868e-8f    , 4.75308071e-8f    , 4.40351526e-8f    , 4.09980445e-8f    , 3.8337591e-8f     , 3.59898226e-8f    , 3.39041432e-8f    , 3.2040076e-8f     , 3.03649004e-8f    , },
+/* x = 13.8        */  {0.238564233f      , 0.00864359484f    , 0.00093948438f    , 0.000170159647f   , 4.31196341e-5f    , 1.4023952e-5f     , 5.55245799e-6f    , 2.57848994e-6f    , 1.36455499e-6f    , 8.03688526e-7f    , 5.16465599e-7f    , 3.56164714e-7f    , 2.60005687e-7f    , 1.98714156e-7f    , 1.57596041e-7f    , 1.28791801e-7f    , 1.07859216e-7f    , 9.21638648e-8f    , 8.00762245e-8f    , 7.05503201e-8f    , 6.2892428e-8f     , 5.66289158e-8f    , 5.14279677e-8f    , 4.70517056e-8f    , 4.33260396e-8f    , 4.01211765e-8f    , 3.73387148e-8f    , 3.49029136e-8f    , 3.27546658e-8f    , 3.08472638e-8f    , 2.91433729e-8f    , 2.76128361e-8f    , },
+/* x = 13.9        */  {0.237704543f      , 0.00855049007f    , 0.000922681699f   , 0.000165916889f   , 4.1744577e-5f     , 1.34813745e-5f    , 5.30129995e-6f    , 2.44596827e-6f    , 1.28671017e-6f    , 7.53780271e-7f    , 4.82116683e-7f    , 3.31131978e-7f    , 2.40901228e-7f    , 1.83580911e-7f    , 1.45241124e-7f    , 1.18453642e-7f    , 9.903171e-8f      , 8.44987436e-8f    , 7.33264269e-8f    , 6.4535843e-8f     , 5.74790115e-8f    , 5.17143207e-8f    , 4.69328932e-8f    , 4.29136272e-8f    , 3.94949323e-8f    , 3.65564866e-8f    , 3.40071748e-8f    , 3.1776939e-8f     , 2.98111614e-8f    , 2.80667209e-8f    , 2.65091791e-8f    , 2.51107397e-8f    , },
+/* x = 14.0        */  {0.23685408f       , 0.00845904459f    , 0.000906296508f   , 0.000161808965f   , 4.04225437e-5f    , 1.2963263e-5f     , 5.06301302e-6f    , 2.32098716e-6f    , 1.21368853e-6f    , 7.07184865e-7f    , 4.5017799e-7f     , 3.07936038e-7f    , 2.23250006e-7f    , 1.69632908e-7f    , 1.33877136e-7f    , 1.08961008e-7f    , 9.0937947e-8f     , 7.74794119e-8f    , 6.71518106e-8f    , 5.90388669e-8f    , 5.25352532e-8f    , 4.72291665e-8f    , 4.28330515e-8f    , 3.91413785e-8f    , 3.60041453e-8f    , 3.33098001e-8f    , 3.09739673e-8f    , 2.89318409e-8f    , 2.71329476e-8f    , 2.55374748e-8f    , 2.41136533e-8f    , 2.28358619e-8f    , },
+/* x = 14.1        */  {0.23601268f       , 0.0083692173f     , 0.000890315585f   , 0.000157830692f   , 3.91511507e-5f    , 1.24683673e-5f    , 4.83686673e-6f    , 2.20308047e-6f    , 1.14517052e-6f    , 6.63670234e-7f    , 4.20472913e-7f    , 2.86437336e-7f    , 2.06938313e-7f    , 1.5677516e-7f     , 1.23423086e-7f    , 1.0024366e-7f     , 8.35161401e-8f    , 7.10508626e-8f    , 6.15029039e-8f    , 5.40145087e-8f    , 4.80201255e-8f    , 4.31357038e-8f    , 3.90935094e-8f    , 3.57024689e-8f    , 3.28233241e-8f    , 3.03526448e-8f    , 2.82122903e-8f    , 2.6342308e-8f     , 2.46960511e-8f    , 2.32367593e-8f    , 2.1935124e-8f     , 2.07675271e-8f    , },
+/* x = 14.2        */  {0.235180184f      , 0.00828096842f    , 0.000874726213f   , 0.000153977122f   , 3.79281358e-5f    , 1.19955079e-5f    , 4.62217566e-6f    , 2.09181287e-6f    , 1.08085897e-6f    , 6.23021283e-7f    , 3.92838248e-7f    , 2.66507221e-7f    , 1.91861547e-7f    , 1.44920442e-7f    , 1.13804711e-7f    , 9.22372706e-8f    , 7.67097625e-8f    , 6.51628179e-8f    , 5.63345243e-8f    , 4.94218051e-8f    , 4.38962066e-8f    , 3.93995188e-8f    , 3.56824357e-8f    , 3.25673054e-8f    , 2.99248317e-8f    , 2.76591063e-8f    , 2.56977566e-8f    , 2.39853157e-8f    , 2.24786701e-8f    , 2.11438754e-8f    , 1.99538914e-8f    , 1.8886945e-8f     , },
+/* x = 14.3        */  {0.234356435f      , 0.00819425941f    , 0.000859516162f   , 0.000150243524f   , 3.67513517e-5f    , 1.15435718e-5f    , 4.41829644e-6f    , 1.9867777e-6f     , 1.02047741e-6f    , 5.85038611e-7f    , 3.67123147e-7f    , 2.48027079e-7f    , 1.77923468e-7f    , 1.33988639e-7f    , 1.04953903e-7f    , 8.48829217e-8f    , 7.0467096e-8f     , 5.97693197e-8f    , 5.16054043e-8f    , 4.52233683e-8f    , 4.01293614e-8f    , 3.59892374e-8f    , 3.25708246e-8f    , 2.97089329e-8f    , 2.72835042e-8f    , 2.52055973e-8f    , 2.3408176e-8f     , 2.18399197e-8f    , 2.04609775e-8f    , 1.92400032e-8f    , 1.81520476e-8f    , 1.71770376e-8f    , },
+/* x = 14.4        */  {0.233541282f      , 0.00810905294f    , 0.00084467366f    , 0.000146625379f   , 3.56187591e-5f    , 1.11115084e-5f    , 4.22462506e-6f    , 1.88759498e-6f    , 9.63768554e-7f    , 5.49537328e-7f    , 3.43188155e-7f    , 2.30887531e-7f    , 1.65035515e-7f    , 1.23906164e-7f    , 9.6808196e-8f     , 7.81266429e-8f    , 6.47408181e-8f    , 5.48283551e-8f    , 4.72778493e-8f    , 4.13850714e-8f    , 3.66884519e-8f    , 3.28762555e-8f    , 2.97322437e-8f    , 2.71027984e-8f    , 2.48764291e-8f    , 2.29706478e-8f    , 2.13233565e-8f    , 1.98870668e-8f    , 1.86249412e-8f    , 1.75080305e-8f    , 1.65133136e-8f    , 1.56222834e-8f    , },
+/* x = 14.5        */  {0.232734576f      , 0.00802531281f    , 0.000830187382f   , 0.000143118364f   , 3.45284207e-5f    , 1.06983255e-5f    , 4.04059423e-6f    , 1.79390956e-6f    , 9.10492958e-7f    , 5.16345952e-7f    , 3.20904325e-7f    , 2.14987696e-7f    , 1.53116184e-7f    , 1.14605412e-7f    , 8.93102914e-8f    , 7.19189927e-8f    , 5.94876245e-8f    , 5.03015154e-8f    , 4.33174267e-8f    , 3.7875763e-8f     , 3.35450722e-8f    , 3.0034493e-8f     , 2.71426047e-8f    , 2.47265362e-8f    , 2.26827427e-8f    , 2.09347149e-8f    , 1.9424924e-8f     , 1.81094245e-8f    , 1.69541616e-8f    , 1.59323982e-8f    , 1.50228908e-8f    , 1.4208575e-8f     , },
+/* x = 14.6        */  {0.231936172f      , 0.00794300395f    , 0.000816046421f   , 0.000139718348f   , 3.34784959e-5f    , 1.0303086e-5f     , 3.865671e-6f      , 1.7053894e-6f     , 8.60427682e-7f    , 4.85305409e-7f    , 3.00152402e-7f    , 2.00234514e-7f    , 1.42090451e-7f    , 1.06024269e-7f    , 8.2407624e-8f     , 6.62146733e-8f    , 5.46678848e-8f    , 4.61536836e-8f    , 3.96926811e-8f    , 3.46670056e-8f    , 3.06733076e-8f    , 2.74401704e-8f    , 2.47799552e-8f    , 2.25597721e-8f    , 2.0683447e-8f     , 1.90800091e-8f    , 1.76961584e-8f    , 1.64912246e-8f    , 1.54337232e-8f    , 1.44989585e-8f    , 1.36673258e-8f    , 1.29230903e-8f    , },
+/* x = 14.7        */  {0.231145928f      , 0.00786209236f    , 0.000802240278f   , 0.000136421376f   , 3.2467235e-5f     , 9.92490442e-6f    , 3.69935455e-6f    , 1.62172395e-6f    , 8.13365114e-7f    , 4.56268095e-7f    , 2.8082207e-7f     , 1.86542127e-7f    , 1.31889251e-7f    , 9.81056575e-8f    , 7.60519664e-8f    , 6.09721797e-8f    , 5.02453275e-8f    , 4.23527506e-8f    , 3.63748751e-8f    , 3.1732838e-8f     , 2.8049515e-8f     , 2.50716046e-8f    , 2.26242876e-8f    , 2.05839455e-8f    , 1.88612414e-8f    , 1.73903364e-8f    , 1.6121844e-8f     , 1.50181221e-8f    , 1.40500603e-8f    , 1.31948467e-8f    , 1.24343883e-8f    , 1.17541749e-8f    , },
+/* x = 14.8        */  {0.230363708f      , 0.00778254507f    , 0.000788758837f   , 0.000133223667f   , 3.14929744e-5f    , 9.56294391e-6f    , 3.54117409e-6f    , 1.54262274e-6f    , 7.69111866e-7f    , 4.29097019e-7f    , 2.62811265e-7f    , 1.73831305e-7f    , 1.22448989e-7f    , 9.0797121e-8f     , 7.01990652e-8f    , 5.61534781e-8f    , 4.61867529e-8f    , 3.88693549e-8f    , 3.33377529e-8f    , 2.9049558e-8f     , 2.56521225e-8f    , 2.29090231e-8f    , 2.06573668e-8f    , 1.87821475e-8f    , 1.72003715e-8f    , 1.58509549e-8f    , 1.46881338e-8f    , 1.36770659e-8f    , 1.27908341e-8f    , 1.2008365e-8f     , 1.13129593e-8f    , 1.06912359e-8f    , },
+/* x = 14.9        */  {0.229589375f      , 0.0077043301f     , 0.000775592356f   , 0.000130121601f   , 3.05541319e-5f    , 9.21641319e-6f    , 3.39068694e-6f    , 1.46781395e-6f    , 7.27487751e-7f    , 4.03665014e-7f    , 2.46025534e-7f    , 1.62028922e-7f    , 1.13711102e-7f    , 8.40504433e-8f    , 6.48083095e-8f    , 5.17237123e-8f    , 4.24617695e-8f    , 3.56766459e-8f    , 3.0557324e-8f     , 2.65955249e-8f    , 2.3461447e-8f     , 2.09343953e-8f    , 1.88625721e-8f    , 1.71389731e-8f    , 1.56864894e-8f    , 1.44484441e-8f    , 1.33824262e-8f    , 1.24561826e-8f    , 1.16448219e-8f    , 1.09288759e-8f    , 1.02929305e-8f    , 9.72464464e-9f    , },
+/* x = 15.0        */  {0.228822798f      , 0.00762741641f    , 0.000762731445f   , 0.000127111711f   , 2.96492024e-5f    , 8.88456398e-6f    , 3.24747672e-6f    , 1.39704317e-6f    , 6.88324839e-7f    , 3.79853998e-7f    , 2.30377455e-7f    , 1.51067474e-7f    , 1.05621653e-7f    , 7.78213001e-8f    , 5.98424261e-8f    , 4.76509346e-8f    , 3.9042555e-8f     , 3.27500665e-8f    , 2.80116669e-8f    , 2.43509785e-8f    , 2.1459528e-8f     , 1.91312776e-8f    , 1.72247539e-8f    , 1.56403869e-8f    , 1.43065288e-8f    , 1.31705863e-8f    , 1.21932527e-8f    , 1.1344669e-8f     , 1.06018159e-8f    , 9.94670616e-9f    , 9.36511143e-9f    , 8.84564923e-9f    , },
+/* x = 15.1        */  {0.228063849f      , 0.00755177392f    , 0.000750167052f   , 0.000124190678f   , 2.87767534e-5f    , 8.56668837e-6f    , 3.11115166e-6f    , 1.33007218e-6f    , 6.51466582e-7f    , 3.57554306e-7f    , 2.15786091e-7f    , 1.40884637e-7f    , 9.81309533e-8f    , 7.20689393e-8f    , 5.52672018e-8f    , 4.39058605e-8f    , 3.59036361e-8f    , 3.00671564e-8f    , 2.56807486e-8f    , 2.22978753e-8f    , 1.96299758e-8f    , 1.74846736e-8f    , 1.57301027e-8f    , 1.42736011e-8f    , 1.3048589e-8f     , 1.20062581e-8f    , 1.11101754e-8f    , 1.03326963e-8f    , 9.65253081e-9f    , 9.05305928e-9f    , 8.52114675e-9f    , 8.04629423e-9f    , },
+/* x = 15.2        */  {0.227312402f      , 0.00747737341f    , 0.000737890453f   , 0.000121355323f   , 2.79354213e-5f    , 8.26211646e-6f    , 2.98134307e-6f    , 1.2666779e-6f     , 6.16767004e-7f    , 3.3666406e-7f     , 2.02176497e-7f    , 1.31422855e-7f    , 9.11932248e-8f    , 6.67558876e-8f    , 5.10512279e-8f    , 4.04616438e-8f    , 3.30216882e-8f    , 2.76073708e-8f    , 2.35462612e-8f    , 2.04197378e-8f    , 1.79578334e-8f    , 1.59809057e-8f    , 1.43660299e-8f    , 1.30269641e-8f    , 1.19018314e-8f    , 1.09453323e-8f    , 1.01236944e-8f    , 9.41132122e-9f    , 8.78852072e-9f    , 8.23993566e-9f    , 7.75343969e-9f    , 7.31934815e-9f    , },
+/* x = 15.3        */  {0.226568334f      , 0.00740418652f    , 0.000725893233f   , 0.0001186026f     , 2.71239078e-5f    , 7.97021413e-6f    , 2.85770384e-6f    , 1.20665137e-6f    , 5.84089952e-7f    , 3.170886e-7f      , 1.89479261e-7f    , 1.2262897e-7f     , 8.47662839e-8f    , 6.18476825e-8f    , 4.71656672e-8f    , 3.72936711e-8f    , 3.03753526e-8f    , 2.53519158e-8f    , 2.15914719e-8f    , 1.87015179e-8f    , 1.64294506e-8f    , 1.46074987e-8f    , 1.31210598e-8f    , 1.18898588e-8f    , 1.0856384e-8f     , 9.9785884e-9f     , 9.22516325e-9f    , 8.57240652e-9f    , 8.0021028e-9f     , 7.50006035e-9f    , 7.05508327e-9f    , 6.65823747e-9f    , },
+/* x = 15.4        */  {0.225831525f      , 0.00733218572f    , 0.000714167276f   , 0.000115929589f   , 2.63409762e-5f    , 7.69038096e-6f    , 2.73990708e-6f    , 1.14979674e-6f    , 5.53308398e-7f    , 2.98739945e-7f    , 1.77630081e-7f    , 1.14453872e-7f    , 7.88112529e-8f    , 5.73126255e-8f    , 4.35840399e-8f    , 3.43793734e-8f    , 2.79450688e-8f    , 2.32835978e-8f    , 1.98010865e-8f    , 1.71294722e-8f    , 1.50323688e-8f    , 1.33530734e-8f    , 1.19847305e-8f    , 1.08526109e-8f    , 9.903255e-9f      , 9.09763109e-9f    , 8.40671195e-9f    , 7.80854792e-9f    , 7.28628824e-9f    , 6.82681728e-9f    , 6.41979747e-9f    , 6.05698663e-9f    , },
+/* x = 15.5        */  {0.225101858f      , 0.00726134428f    , 0.000702704752f   , 0.000113333491f   , 2.55854483e-5f    , 7.42204825e-6f    , 2.62764489e-6f    , 1.09593047e-6f    , 5.24303802e-7f    , 2.81536306e-7f    , 1.66569377e-7f    , 1.06852186e-7f    , 7.32922952e-8f    , 5.31215562e-8f    , 4.02820284e-8f    , 3.16980545e-8f    , 2.5712921e-8f     , 2.13866857e-8f    , 1.81611247e-8f    , 1.56910476e-8f    , 1.37552168e-8f    , 1.22072501e-8f    , 1.09475038e-8f    , 9.90640436e-9f    , 9.03425383e-9f    , 8.29481617e-9f    , 7.66117705e-9f    , 7.11300798e-9f    , 6.63471944e-9f    , 6.21418941e-9f    , 5.84187223e-9f    , 5.51016354e-9f    , },
+/* x = 15.6        */  {0.224379219f      , 0.00719163624f    , 0.000691498104f   , 0.000110811623f   , 2.48562012e-5f    , 7.16467719e-6f    , 2.52062713e-6f    , 1.04488044e-6f    , 4.9696551e-7f     , 2.65401632e-7f    , 1.56241931e-7f    , 9.97819809e-8f    , 6.81763721e-8f    , 4.92476458e-8f    , 3.72372975e-8f    , 2.92307332e-8f    , 2.36624992e-8f    , 1.96467859e-8f    , 1.66588063e-8f    , 1.43747781e-8f    , 1.25876152e-8f    , 1.116056e-8f      , 1.00006835e-8f    , 9.04320529e-9f    , 8.24191973e-9f    , 7.56318313e-9f    , 6.98203804e-9f    , 6.47965587e-9f    , 6.04161281e-9f    , 5.6567044e-9f     , 5.3161156e-9f     , 5.01283009e-9f    , },
+/* x = 15.7        */  {0.223663494f      , 0.00712303638f    , 0.000680540039f   , 0.00010836141f    , 2.41521645e-5f    , 6.91775714e-6f    , 2.41858032e-6f    , 9.96485272e-7f    , 4.71190206e-7f    , 2.50265188e-7f    , 1.4659656e-7f     , 9.32044956e-8f    , 6.34330192e-8f    , 4.56662064e-8f    , 3.44293305e-8f    , 2.69599996e-8f    , 2.17787704e-8f    , 1.8050727e-8f     , 1.52824473e-8f    , 1.31701897e-8f    , 1.15200892e-8f    , 1.02043649e-8f    , 9.13634061e-9f    , 8.25569206e-9f    , 7.51945637e-9f    , 6.89639381e-9f    , 6.36335947e-9f    , 5.90291259e-9f    , 5.50170687e-9f    , 5.14938518e-9f    , 4.83780665e-9f    , 4.5604971e-9f     , },
+/* x = 15.8        */  {0.222954575f      , 0.00705552018f    , 0.000669823516f   , 0.000105980384f   , 2.34723176e-5f    , 6.68080404e-6f    , 2.32124663e-6f    , 9.50593528e-7f    , 4.46881397e-7f    , 2.3606117e-7f     , 1.37585806e-7f    , 8.7083897e-8f     , 5.90341411e-8f    , 4.23545175e-8f    , 3.18392785e-8f    , 2.4869883e-8f     , 2.00479621e-8f    , 1.65864549e-8f    , 1.40213655e-8f    , 1.20677136e-8f    , 1.05439892e-8f    , 9.3307843e-9f     , 8.34724532e-9f    , 7.53719198e-9f    , 6.86067247e-9f    , 6.28867653e-9f    , 5.7997383e-9f     , 5.37770117e-9f    , 5.01021493e-9f    , 4.68770501e-9f    , 4.40265262e-9f    , 4.14908345e-9f    , },
+/* x = 15.9        */  {0.222252355f      , 0.00698906385f    , 0.000659341735f   , 0.000103666173f   , 2.28156868e-5f    , 6.45335883e-6f    , 2.22838291e-6f    , 9.07063121e-7f    , 4.23948937e-7f    , 2.22728344e-7f    , 1.29165658e-7f    , 8.13870509e-8f    , 5.49538229e-8f    , 3.92916657e-8f    , 2.9449823e-8f     , 2.29457316e-8f    , 1.84574553e-8f    , 1.52429378e-8f    , 1.28657931e-8f    , 1.10586083e-8f    , 9.65141885e-9f    , 8.53262801e-9f    , 7.62680509e-9f    , 6.88162349e-9f    , 6.25992772e-9f    , 5.73477534e-9f    , 5.28625598e-9f    , 4.8994014e-9f     , 4.56278222e-9f    , 4.26754667e-9f    , 4.00675003e-9f    , 3.77487892e-9f    , },
+/* x = 16.0        */  {0.221556728f      , 0.00692364423f    , 0.00064908813f    , 0.000101416504f   , 2.21813434e-5f    , 6.23498612e-6f    , 2.13975975e-6f    , 8.65760676e-7f    , 4.02308593e-7f    , 2.10209716e-7f    , 1.21295294e-7f    , 7.60833127e-8f    , 5.11681568e-8f    , 3.64583983e-8f    , 2.72450494e-8f    , 2.11741018e-8f    , 1.69956869e-8f    , 1.40100779e-8f    , 1.18067985e-8f    , 1.01348865e-8f    , 8.83516875e-9f    , 7.80333576e-9f    , 6.96900821e-9f    , 6.28344359e-9f    , 5.71208356e-9f    , 5.22990374e-9f    , 4.81843488e-9f    , 4.46380855e-9f    , 4.15544674e-9f    , 3.8851653e-9f     , 3.64654931e-9f    , 3.43451041e-9f    , },
+/* x = 16.1        */  {0.220867592f      , 0.00685923883f    , 0.000639056356f   , 9.92291911e-5f    , 2.1568401e-5f     , 6.02527276e-6f    , 2.05516069e-6f    , 8.26560962e-7f    , 3.81881627e-7f    , 1.98452224e-7f    , 1.13936839e-7f    , 7.1144335e-8f     , 4.76550829e-8f    , 3.38369887e-8f    , 2.5210331e-8f     , 1.95426572e-8f    , 1.56520601e-8f    , 1.28786319e-8f    , 1.08362136e-8f    , 9.28925055e-9f    , 8.08865635e-9f    , 7.13692153e-9f    , 6.36837233e-9f    , 5.73759994e-9f    , 5.21245839e-9f    , 4.76970261e-9f    , 4.39219864e-9f    , 4.06709599e-9f    , 3.78460381e-9f    , 3.53715466e-9f    , 3.31882261e-9f    , 3.12491126e-9f    , },
+/* x = 16.2        */  {0.220184847f      , 0.00679582577f    , 0.000629240283f   , 9.71021383e-5f    , 2.09760133e-5f    , 5.82382667e-6f    , 1.9743814e-6f     , 7.89346363e-7f    , 3.62594427e-7f    , 1.87406458e-7f    , 1.07055145e-7f    , 6.65438901e-8f    , 4.43942427e-8f    , 3.1411113e-8f     , 2.33322235e-8f    , 1.80400763e-8f    , 1.44168629e-8f    , 1.18401379e-8f    , 9.94656844e-9f    , 8.5150316e-9f     , 7.40587112e-9f    , 6.52792307e-9f    , 5.81989765e-9f    , 5.23948721e-9f    , 4.75678675e-9f    , 4.35020192e-9f    , 4.00383611e-9f    , 3.70578103e-9f    , 3.44697371e-9f    , 3.22041645e-9f    , 3.02063463e-9f    , 2.84329334e-9f    , },
+/* x = 16.3        */  {0.219508395f      , 0.00673338378f    , 0.000619633987f   , 9.50333303e-5f    , 2.04033725e-5f    , 5.6302756e-6f     , 1.89722894e-6f    , 7.54006384e-7f    , 3.44378149e-7f    , 1.77026393e-7f    , 1.00617588e-7f    , 6.22577067e-8f    , 4.1366845e-8f     , 2.91657367e-8f    , 2.15983676e-8f    , 1.66559678e-8f    , 1.32811931e-8f    , 1.08868486e-8f    , 9.13103047e-9f    , 7.80613557e-9f    , 6.78132451e-9f    , 5.97135574e-9f    , 5.3190242e-9f     , 4.7849074e-9f     , 4.34118221e-9f    , 3.96778589e-9f    , 3.64996849e-9f    , 3.37669392e-9f    , 3.13957233e-9f    , 2.93213236e-9f    , 2.74931599e-9f    , 2.58712171e-9f    , },
+/* x = 16.4        */  {0.218838139f      , 0.00667189217f    , 0.00061023174f    , 9.30208313e-5f    , 1.98497068e-5f    , 5.44426607e-6f    , 1.8235211e-6f     , 7.20437187e-7f    , 3.27168391e-7f    , 1.67269148e-7f    , 9.45938791e-8f    , 5.82633194e-8f    , 3.85555416e-8f    , 2.70870109e-8f    , 1.99973997e-8f    , 1.53807929e-8f    , 1.22368901e-8f    , 1.00116705e-8f    , 8.38335008e-9f    , 7.15699297e-9f    , 6.21000434e-9f    , 5.46267056e-9f    , 4.86159301e-9f    , 4.37003359e-9f    , 3.96210352e-9f    , 3.61916124e-9f    , 3.32751951e-9f    , 3.07694971e-9f    , 2.85968447e-9f    , 2.66973877e-9f    , 2.50243914e-9f    , 2.35409158e-9f    , },
+/* x = 16.5        */  {0.218173985f      , 0.00661133082f    , 0.000601028006f   , 9.1062781e-5f     , 1.93142791e-5f    , 5.2654623e-6f     , 1.75308574e-6f    , 6.88541168e-7f    , 3.10904894e-7f    , 1.58094762e-7f    , 8.89558924e-8f    , 5.45399305e-8f    , 3.59443142e-8f    , 2.51621764e-8f    , 1.85188706e-8f    , 1.42057943e-8f    , 1.12764724e-8f    , 9.20810778e-9f    , 7.69781026e-9f    , 6.56251351e-9f    , 5.68733312e-9f    , 4.99771588e-9f    , 4.44381058e-9f    , 3.99137705e-9f    , 3.61632386e-9f    , 3.30132835e-9f    , 3.03368824e-9f    , 2.80392251e-9f    , 2.60483953e-9f    , 2.43090362e-9f    , 2.27779636e-9f    , 2.14210739e-9f    , },
+/* x = 16.6        */  {0.217515842f      , 0.00655168013f    , 0.000592017429f   , 8.91573911e-5f    , 1.87963848e-5f    , 5.09354527e-6f    , 1.68576016e-6f    , 6.58226551e-7f    , 2.95531254e-7f    , 1.49465985e-7f    , 8.36775033e-8f    , 5.10682818e-8f    , 3.35183695e-8f    , 2.33794766e-8f    , 1.71531704e-8f    , 1.31229315e-8f    , 1.03930802e-8f    , 8.47021189e-9f    , 7.06918081e-9f    , 6.01804447e-9f    , 5.20913015e-9f    , 4.5727025e-9f     , 4.06221669e-9f    , 3.64575716e-9f    , 3.3009028e-9f     , 3.01155494e-9f    , 2.76592435e-9f    , 2.55522221e-9f    , 2.3727894e-9f     , 2.21350549e-9f    , 2.07337983e-9f    , 1.94926375e-9f    , },
+/* x = 16.7        */  {0.216863619f      , 0.00649292106f    , 0.00058319483f    , 8.73029421e-5f    , 1.82953506e-5f    , 4.92821175e-6f    , 1.6213906e-6f     , 6.29407019e-7f    , 2.8099467e-7f     , 1.41348086e-7f    , 7.87344407e-8f    , 4.78305372e-8f    , 3.12640431e-8f    , 2.17280768e-8f    , 1.58914599e-8f    , 1.2124821e-8f     , 9.58042328e-9f    , 7.79253456e-9f    , 6.49267652e-9f    , 5.51933285e-9f    , 4.77157687e-9f    , 4.18417179e-9f    , 3.71365488e-9f    , 3.33027412e-9f    , 3.01316076e-9f    , 2.7473522e-9f     , 2.52190564e-9f    , 2.3286732e-9f     , 2.16148839e-9f    , 2.0156145e-9f     , 1.88736351e-9f    , 1.77382815e-9f    , },
+/* x = 16.8        */  {0.216217229f      , 0.00643503507f    , 0.000574555198f   , 8.54977804e-5f    , 1.78105327e-5f    , 4.76917347e-6f    , 1.55983163e-6f    , 6.02001367e-7f    , 2.6724569e-7f     , 1.33708673e-7f    , 7.41041511e-8f    , 4.48101744e-8f    , 2.91687112e-8f    , 2.01979901e-8f    , 1.47256077e-8f    , 1.12046819e-8f    , 8.83273286e-9f    , 7.17008544e-9f    , 5.96391896e-9f    , 5.06249071e-9f    , 4.37118525e-9f    , 3.82896672e-9f    , 3.39524569e-9f    , 3.04228401e-9f    , 2.7506558e-9f     , 2.506453e-9f      , 2.29951754e-9f    , 2.12229513e-9f    , 1.96907496e-9f    , 1.83547497e-9f    , 1.7180866e-9f     , 1.61422528e-9f    , },
+/* x = 16.9        */  {0.215576584f      , 0.00637800409f    , 0.000566093684f   , 8.37403155e-5f    , 1.73413152e-5f    , 4.61615633e-6f    , 1.50094575e-6f    , 5.75933175e-7f    , 2.54237995e-7f    , 1.2651753e-7f     , 6.97656713e-8f    , 4.19918849e-8f    , 2.7220709e-8f     , 1.878001e-8f      , 1.36481326e-8f    , 1.03562857e-8f    , 8.14471806e-9f    , 6.59829314e-9f    , 5.47890155e-9f    , 4.6439636e-9f     , 4.00476901e-9f    , 3.50420538e-9f    , 3.10436224e-9f    , 2.77937612e-9f    , 2.51116243e-9f    , 2.28679205e-9f    , 2.09683452e-9f    , 1.93428526e-9f    , 1.79385508e-9f    , 1.6714897e-9f     , 1.56403859e-9f    , 1.46902267e-9f    , },
+/* x = 17.0        */  {0.2149416f        , 0.00632181055f    , 0.000557805596f   , 8.2029017e-5f     , 1.68871094e-5f    , 4.46889957e-6f    , 1.44460282e-6f    , 5.51130508e-7f    , 2.41928184e-7f    , 1.19746463e-7f    , 6.56995124e-8f    , 3.93614819e-8f    , 2.5409256e-8f     , 1.74656478e-8f    , 1.26521504e-8f    , 9.57391128e-9f    , 7.51152566e-9f    , 6.07296969e-9f    , 5.03395771e-9f    , 4.2605017e-9f     , 3.66941733e-9f    , 3.20725686e-9f    , 2.83860788e-9f    , 2.53935228e-9f    , 2.29265235e-9f    , 2.08648788e-9f    , 1.91210308e-9f    , 1.76300254e-9f    , 1.63428713e-9f    , 1.52220556e-9f    , 1.42384561e-9f    , 1.33691779e-9f    , },
+/* x = 17.1        */  {0.214312194f      , 0.00626643734f    , 0.000549686391f   , 8.03624121e-5f    , 1.64473516e-5f    , 4.32715511e-6f    , 1.39067972e-6f    , 5.27525634e-7f    , 2.30275579e-7f    , 1.13369156e-7f    , 6.18875515e-8f    , 3.69058151e-8f    , 2.37243872e-8f    , 1.62470753e-8f    , 1.17313253e-8f    , 8.85230202e-9f    , 6.92870342e-9f    , 5.59027799e-9f    , 4.6257317e-9f     , 3.90913355e-9f    , 3.36247084e-9f    , 2.93571927e-9f    , 2.59579599e-9f    , 2.32020801e-9f    , 2.09327693e-9f    , 1.90382643e-9f    , 1.74372639e-9f    , 1.60695301e-9f    , 1.48896813e-9f    , 1.38630052e-9f    , 1.29625804e-9f    , 1.21672617e-9f    , },
+/* x = 17.2        */  {0.213688286f      , 0.00621186779f    , 0.000541731671f   , 7.87390831e-5f    , 1.60215025e-5f    , 4.19068685e-6f    , 1.3390599e-6f     , 5.05054759e-7f    , 2.19242048e-7f    , 1.07361043e-7f    , 5.83129322e-8f    , 3.46126928e-8f    , 2.21568893e-8f    , 1.51170724e-8f    , 1.08798259e-8f    , 8.18662812e-9f    , 6.39216653e-9f    , 5.14670209e-9f    , 4.25115204e-9f    , 3.58714192e-9f    , 3.08149976e-9f    , 2.68739962e-9f    , 2.3739314e-9f     , 2.1201154e-9f     , 1.91135118e-9f    , 1.73724607e-9f    , 1.59025018e-9f    , 1.46477663e-9f    , 1.35662127e-9f    , 1.26257177e-9f    , 1.18013928e-9f    , 1.10737072e-9f    , },
+/* x = 17.3        */  {0.213069795f      , 0.00615808566f    , 0.000533937177f   , 7.71576652e-5f    , 1.56090459e-5f    , 4.05927004e-6f    , 1.28963298e-6f    , 4.83657783e-7f    , 2.0879183e-7f     , 1.01699182e-7f    , 5.49599725e-8f    , 3.24708095e-8f    , 2.0698243e-8f     , 1.40689786e-8f    , 1.00922835e-8f    , 7.57245115e-9f    , 5.89816684e-9f    , 4.73902002e-9f    , 3.90740716e-9f    , 3.29204197e-9f    , 2.82428392e-9f    , 2.4602956e-9f     , 2.17119358e-9f    , 1.93740747e-9f    , 1.74533925e-9f    , 1.58532399e-9f    , 1.45035002e-9f    , 1.3352352e-9f     , 1.23608449e-9f    , 1.14992494e-9f    , 1.07445544e-9f    , 1.00787194e-9f    , },
+/* x = 17.4        */  {0.212456643f      , 0.00610507515f    , 0.000526298785f   , 7.5616844e-5f     , 1.52094873e-5f    , 3.93269065e-6f    , 1.24229443e-6f    , 4.6327807e-7f     , 1.98891385e-7f    , 9.63621471e-8f    , 5.18140794e-8f    , 3.04696792e-8f    , 1.93405686e-8f    , 1.30966489e-8f    , 9.36375543e-9f    , 7.00569181e-9f    , 5.44326476e-9f    , 4.36427887e-9f    , 3.59192322e-9f    , 3.02156111e-9f    , 2.58879457e-9f    , 2.25257888e-9f    , 1.98592125e-9f    , 1.7705639e-9f     , 1.59384111e-9f    , 1.44676386e-9f    , 1.32281966e-9f    , 1.21720143e-9f    , 1.12630017e-9f    , 1.04736429e-9f    , 9.78266115e-10f   , 9.17339097e-10f   , },
+/* x = 17.5        */  {0.211848754f      , 0.00605282084f    , 0.000518812497f   , 7.41153536e-5f    , 1.48223533e-5f    , 3.81074485e-6f    , 1.19694524e-6f    , 4.43862231e-7f    , 1.89509242e-7f    , 9.13299179e-8f    , 4.886167e-8f      , 2.85995737e-8f    , 1.80765772e-8f    , 1.21944125e-8f    , 8.68968991e-9f    , 6.48260045e-9f    , 5.0243035e-9f     , 4.01977211e-9f    , 3.30234378e-9f    , 2.77362081e-9f    , 2.37317772e-9f    , 2.06257985e-9f    , 1.81659835e-9f    , 1.61819811e-9f    , 1.45558057e-9f    , 1.32038446e-9f    , 1.20656046e-9f    , 1.10964894e-9f    , 1.02630571e-9f    , 9.53983831e-10f   , 8.90715842e-10f   , 8.34962138e-10f   , },
+/* x = 17.6        */  {0.211246054f      , 0.00600130771f    , 0.000511474443f   , 7.26519743e-5f    , 1.44471903e-5f    , 3.69323843e-6f    , 1.15349154e-6f    , 4.25359931e-7f    , 1.80615867e-7f    , 8.65837861e-8f    , 4.60900988e-8f    , 2.68514663e-8f    , 1.68995246e-8f    , 1.13570356e-8f    , 8.06589495e-9f    , 5.99972994e-9f    , 4.63838546e-9f    , 3.70301875e-9f    , 3.03651126e-9f    , 2.5463198e-9f     , 2.17573898e-9f    , 1.88877381e-9f    , 1.66184131e-9f    , 1.47904543e-9f    , 1.32939418e-9f    , 1.20510951e-9f    , 1.10057174e-9f    , 1.01164325e-9f    , 9.35224961e-10f   , 8.68959172e-10f   , 8.11026455e-10f   , 7.6000437e-10f    , },
+/* x = 17.7        */  {0.210648469f      , 0.00595052113f    , 0.000504280871f   , 7.1225531e-5f     , 1.40835638e-5f    , 3.57998633e-6f    , 1.11184439e-6f    , 4.07723692e-7f    , 1.72183533e-7f    , 8.21062637e-8f    , 4.348759e-8f      , 2.52169793e-8f    , 1.58031696e-8f    , 1.05796869e-8f    , 7.48850916e-9f    , 5.55391083e-9f    , 4.28285066e-9f    , 3.41174434e-9f    , 2.79244999e-9f    , 2.33791885e-9f    , 1.99492974e-9f    , 1.72976828e-9f    , 1.52038739e-9f    , 1.35195227e-9f    , 1.2142213e-9f     , 1.09995824e-9f    , 1.00394203e-9f    , 9.22333483e-10f   , 8.52260432e-10f   , 7.91540178e-10f   , 7.38490062e-10f   , 6.91795805e-10f   , },
+/* x = 17.8        */  {0.210055926f      , 0.00590044684f    , 0.000497228144f   , 6.98348909e-5f    , 1.37310572e-5f    , 3.47081215e-6f    , 1.07191943e-6f    , 3.90908726e-7f    , 1.64186206e-7f    , 7.78809992e-8f    , 4.10431754e-8f    , 2.36883355e-8f    , 1.47817353e-8f    , 9.85790573e-9f    , 6.95397515e-9f    , 5.14222865e-9f    , 3.95525699e-9f    , 3.14386353e-9f    , 2.56835068e-9f    , 2.14682685e-9f    , 1.82933449e-9f    , 1.58429143e-9f    , 1.39108405e-9f    , 1.23586638e-9f    , 1.10909496e-9f    , 1.0040369e-9f     , 9.15841081e-10f   , 8.40944888e-10f   , 7.76686224e-10f   , 7.21044256e-10f   , 6.72462693e-10f   , 6.29727106e-10f   , },
+/* x = 17.9        */  {0.209468356f      , 0.00585107093f    , 0.000490312736f   , 6.84789622e-5f    , 1.33892711e-5f    , 3.3655477e-6f     , 1.03363668e-6f    , 3.74872767e-7f    , 1.56599435e-7f    , 7.38927002e-8f    , 3.87466361e-8f    , 2.22583136e-8f    , 1.38298738e-8f    , 9.18757303e-9f    , 6.45901512e-9f    , 4.76200301e-9f    , 3.65336208e-9f    , 2.89746419e-9f    , 2.36255631e-9f    , 1.97158807e-9f    , 1.67765933e-9f    , 1.45118162e-9f    , 1.27287929e-9f    , 1.12982786e-9f    , 1.01313349e-9f    , 9.16531015e-10f   , 8.35512599e-10f   , 7.66771985e-10f   , 7.07841578e-10f   , 6.56850259e-10f   , 6.12358507e-10f   , 5.73244085e-10f   , },
+/* x = 18.0        */  {0.208885689f      , 0.00580237983f    , 0.00048353123f    , 6.71566922e-5f    , 1.30578226e-5f    , 3.26403261e-6f    , 9.96920241e-7f    , 3.59575921e-7f    , 1.49400245e-7f    , 7.01270609e-8f    , 3.65884494e-8f    , 2.09202071e-8f    , 1.29426329e-8f    , 8.56488452e-9f    , 6.0006084e-9f     , 4.41076844e-9f    , 3.37510672e-9f    , 2.67079283e-9f    , 2.17354915e-9f    , 1.81087052e-9f    , 1.53872141e-9f    , 1.32937772e-9f    , 1.16481284e-9f    , 1.03296106e-9f    , 9.25533052e-10f   , 8.36698328e-10f   , 7.62267638e-10f   , 6.99172363e-10f   , 6.45125007e-10f   , 5.98392934e-10f   , 5.57644539e-10f   , 5.21842697e-10f   , },
+/* x = 18.1        */  {0.208307858f      , 0.00575436033f    , 0.00047688031f    , 6.58670654e-5f    , 1.27363447e-5f    , 3.16611385e-6f    , 9.61698113e-7f    , 3.4498052e-7f     , 1.42567048e-7f    , 6.65706951e-8f    , 3.4559739e-8f     , 1.96677863e-8f    , 1.21154262e-8f    , 7.98632596e-9f    , 5.57597086e-9f    , 4.08625689e-9f    , 3.11859967e-9f    , 2.46224126e-9f    , 1.99993891e-9f    , 1.66345536e-9f    , 1.41143933e-9f    , 1.21791041e-9f    , 1.06600807e-9f    , 9.44467058e-10f   , 8.45560668e-10f   , 7.63862353e-10f   , 6.95478575e-10f   , 6.37561021e-10f   , 5.87988967e-10f   , 5.45157888e-10f   , 5.07835908e-10f   , 4.75064498e-10f   , },
+/* x = 18.2        */  {0.207734795f      , 0.00570699952f    , 0.000470356761f   , 6.46091026e-5f    , 1.24244849e-5f    , 3.07164545e-6f    , 9.27901944e-7f    , 3.31050989e-7f    , 1.36079549e-7f    , 6.32110737e-8f    , 3.26522293e-8f    , 1.84952627e-8f    , 1.13440052e-8f    , 7.44865048e-9f    , 5.182536e-9f      , 3.78638162e-9f    , 2.88210378e-9f    , 2.27033439e-9f    , 1.84045195e-9f    , 1.52822718e-9f    , 1.29482437e-9f    , 1.11589414e-9f    , 9.756647e-10f     , 8.63616998e-10f   , 7.7254797e-10f    , 6.97406532e-10f   , 6.34573636e-10f   , 5.81405217e-10f   , 5.35935004e-10f   , 4.9667699e-10f    , 4.62491474e-10f   , 4.32492504e-10f   , },
+/* x = 18.3        */  {0.207166436f      , 0.00566028483f    , 0.000463957465f   , 6.33818591e-5f    , 1.21219052e-5f    , 2.9804881e-6f     , 8.95466842e-7f    , 3.17753724e-7f    , 1.29918667e-7f    , 6.0036467e-8f     , 3.08582029e-8f    , 1.73972572e-8f    , 1.06244336e-8f    , 6.94885775e-9f    , 4.81793751e-9f    , 3.50922244e-9f    , 2.6640232e-9f     , 2.0937191e-9f     , 1.69392137e-9f    , 1.40416514e-9f    , 1.18797251e-9f    , 1.02251985e-9f    , 8.93052102e-10f   , 7.8974585e-10f    , 7.05885477e-10f   , 6.36768903e-10f   , 5.79031901e-10f   , 5.30219788e-10f   , 4.88509341e-10f   , 4.52524206e-10f   , 4.21209881e-10f   , 3.93747438e-10f   , },
+/* x = 18.4        */  {0.206602717f      , 0.00561420399f    , 0.000457679396f   , 6.21844231e-5f    , 1.18282813e-5f    , 2.89250878e-6f    , 8.64331184e-7f    , 3.05056968e-7f    , 1.24066455e-7f    , 5.70358908e-8f    , 2.9170461e-8f     , 1.63687696e-8f    , 9.95306357e-9f    , 6.48417469e-9f    , 4.47999337e-9f    , 3.25301215e-9f    , 2.46289173e-9f    , 1.93115398e-9f    , 1.55927795e-9f    , 1.29033488e-9f    , 1.09005705e-9f    , 9.37048324e-10f   , 8.17503186e-10f   , 7.22246811e-10f   , 6.45017374e-10f   , 5.81437245e-10f   , 5.28378771e-10f   , 4.83562884e-10f   , 4.45298856e-10f   , 4.12311795e-10f   , 3.83625956e-10f   , 3.5848431e-10f    , },
+/* x = 18.5        */  {0.206043575f      , 0.00556874501f    , 0.000451519616f   , 6.10159147e-5f    , 1.15433018e-5f    , 2.8075805e-6f     , 8.34436433e-7f    , 2.92930708e-7f    , 1.18506032e-7f    , 5.41990564e-8f    , 2.75822871e-8f    , 1.54051508e-8f    , 9.32651401e-9f    , 6.05203785e-9f    , 4.16669114e-9f    , 3.01612415e-9f    , 2.27736213e-9f    , 1.78150002e-9f    , 1.43554192e-9f    , 1.18588112e-9f    , 1.000322e-9f      , 8.58804116e-10f   , 7.48408847e-10f   , 6.60566175e-10f   , 5.89436771e-10f   , 5.30944652e-10f   , 4.82181827e-10f   , 4.41032086e-10f   , 4.05927434e-10f   , 3.75686867e-10f   , 3.49407446e-10f   , 3.26389312e-10f   , },
+/* x = 18.6        */  {0.205488948f      , 0.00552389622f    , 0.000445475277f   , 5.98754846e-5f    , 1.12666676e-5f    , 2.72558198e-6f    , 8.05726973e-7f    , 2.81346566e-7f    , 1.13221508e-7f    , 5.15163239e-8f    , 2.6087413e-8f     , 1.45020775e-8f    , 8.74165033e-9f    , 5.6500771e-9f     , 3.87617451e-9f    , 2.79706104e-9f    , 2.10619629e-9f    , 1.64371203e-9f    , 1.32181535e-9f    , 1.09002091e-9f    , 9.1807595e-10f    , 7.87169996e-10f   , 6.85212896e-10f   , 6.04198661e-10f   , 5.3868137e-10f    , 4.84865512e-10f   , 4.4004707e-10f    , 4.02260877e-10f   , 3.70052638e-10f   , 3.42328233e-10f   , 3.18252034e-10f   , 2.97176988e-10f   , },
+/* x = 18.7        */  {0.204938776f      , 0.0054796462f     , 0.000439543611f   , 5.87623126e-5f    , 1.09980916e-5f    , 2.64639736e-6f    , 7.78149946e-7f    , 2.70277709e-7f    , 1.08197932e-7f    , 4.89786593e-8f    , 2.46799877e-8f    , 1.36555283e-8f    , 8.19556596e-9f    , 5.27610066e-9f    , 3.60673085e-9f    , 2.59444413e-9f    , 1.94825626e-9f    , 1.51683081e-9f    , 1.21727525e-9f    , 1.00203743e-9f    , 8.4268652e-10f    , 7.21581903e-10f   , 6.27407426e-10f   , 5.52683156e-10f   , 4.92329525e-10f   , 4.42811834e-10f   , 4.01615493e-10f   , 3.66915428e-10f   , 3.37362685e-10f   , 3.11943554e-10f   , 2.89884641e-10f   , 2.70587673e-10f   , },
+/* x = 18.8        */  {0.204392999f      , 0.00543598383f    , 0.000433721932f   , 5.76756068e-5f    , 1.0737298e-5f     , 2.56991592e-6f    , 7.51655103e-7f    , 2.59698752e-7f    , 1.03421224e-7f    , 4.65775939e-8f    , 2.33545482e-8f    , 1.28617617e-8f    , 7.68556513e-9f    , 4.92808131e-9f    , 3.3567799e-9f     , 2.40700389e-9f    , 1.802496e-9f      , 1.39997598e-9f    , 1.12116724e-9f    , 9.21274387e-10f   , 7.73575268e-10f   , 6.61524334e-10f   , 5.74528599e-10f   , 5.05598828e-10f   , 4.49996646e-10f   , 4.04429911e-10f   , 3.66559958e-10f   , 3.3469167e-10f    , 3.07573692e-10f   , 2.84266739e-10f   , 2.64054963e-10f   , 2.46385152e-10f   , },
+/* x = 18.9        */  {0.20385156f       , 0.00539289824f    , 0.000428007633f   , 5.66146024e-5f    , 1.04840218e-5f    , 2.49603186e-6f    , 7.26194667e-7f    , 2.49585678e-7f    , 9.88781249e-8f    , 4.43051872e-8f    , 2.21059923e-8f    , 1.2117296e-8f     , 7.20914713e-9f    , 4.60414366e-9f    , 3.12486326e-9f    , 2.23357108e-9f    , 1.66795386e-9f    , 1.29233941e-9f    , 1.03279978e-9f    , 8.47130797e-10f   , 7.10213053e-10f   , 6.06526124e-10f   , 5.26152795e-10f   , 4.62561589e-10f   , 4.11331931e-10f   , 3.69397274e-10f   , 3.34582362e-10f   , 3.05312633e-10f   , 2.80427172e-10f   , 2.59055586e-10f   , 2.40535235e-10f   , 2.24354541e-10f   , },
+/* x = 19.0        */  {0.2033144f        , 0.00535037881f    , 0.00042239818f    , 5.55785604e-5f    , 1.02380084e-5f    , 2.42464403e-6f    , 7.01723197e-7f    , 2.39915757e-7f    , 9.45561463e-8f    , 4.21539918e-8f    , 2.09295539e-8f    , 1.14188904e-8f    , 6.76399166e-9f    , 4.3025525e-9f     , 2.90963477e-9f    , 2.07306873e-9f    , 1.54374564e-9f    , 1.1931792e-9f     , 9.51538831e-10f   , 7.79056323e-10f   , 6.52115794e-10f   , 5.56156608e-10f   , 4.81893098e-10f   , 4.23220868e-10f   , 3.76015378e-10f   , 3.37419923e-10f   , 3.05411043e-10f   , 2.78526022e-10f   , 2.55687757e-10f   , 2.36089624e-10f   , 2.19118194e-10f   , 2.04300352e-10f   , },
+/* x = 19.1        */  {0.202781465f      , 0.00530841519f    , 0.000416891112f   , 5.45667668e-5f    , 9.99901304e-6f    , 2.3556557e-6f     , 6.78197463e-7f    , 2.30667471e-7f    , 9.04435195e-8f    , 4.01170213e-8f    , 1.98207797e-8f    , 1.07635276e-8f    , 6.34794541e-9f    , 4.02170197e-9f    , 2.70985166e-9f    , 1.92450467e-9f    , 1.42905824e-9f    , 1.10181419e-9f    , 8.76803057e-10f   , 7.16546944e-10f   , 5.98840601e-10f   , 5.10022115e-10f   , 4.41396101e-10f   , 3.87256667e-10f   , 3.43755066e-10f   , 3.082298e-10f     , 2.78798427e-10f   , 2.5410201e-10f    , 2.33141118e-10f   , 2.15168163e-10f   , 1.9961523e-10f    , 1.86044742e-10f   , },
+/* x = 19.2        */  {0.202252699f      , 0.00526699725f    , 0.000411484041f   , 5.35785317e-5f    , 9.76680038e-6f    , 2.28897438e-6f    , 6.55576329e-7f    , 2.21820445e-7f    , 8.65291535e-8f    , 3.81877195e-8f    , 1.87755075e-8f    , 1.01483978e-8f    , 5.95900958e-9f    , 3.76010567e-9f    , 2.52436644e-9f    , 1.78696472e-9f    , 1.32314387e-9f    , 1.0176189e-9f     , 8.0805937e-10f    , 6.59141014e-10f   , 5.49982234e-10f   , 4.67762757e-10f   , 4.04338979e-10f   , 3.54376883e-10f   , 3.14284681e-10f   , 2.8158249e-10f    , 2.54518887e-10f   , 2.31831231e-10f   , 2.12592082e-10f   , 1.96108514e-10f   , 1.81854702e-10f   , 1.69425913e-10f   , },
+/* x = 19.3        */  {0.201728048f      , 0.00522611512f    , 0.000406174643f   , 5.26131882e-5f    , 9.54114422e-6f    , 2.22451159e-6f    , 6.33820643e-7f    , 2.13355381e-7f    , 8.28025922e-8f    , 3.6359933e-8f     , 1.77898465e-8f    , 9.57088399e-9f    , 5.59532845e-9f    , 3.5163875e-9f     , 2.3521194e-9f     , 1.65960645e-9f    , 1.22531467e-9f    , 9.40018921e-10f   , 7.44818875e-10f   , 6.06415665e-10f   , 5.05169877e-10f   , 4.29049515e-10f   , 3.70426825e-10f   , 3.24314856e-10f   , 2.87361258e-10f   , 2.57255128e-10f   , 2.32366783e-10f   , 2.11522949e-10f   , 1.93862915e-10f   , 1.78744364e-10f   , 1.65680409e-10f   , 1.54296665e-10f   , },
+/* x = 19.4        */  {0.201207459f      , 0.00518575914f    , 0.000400960662f   , 5.16700916e-5f    , 9.32182694e-6f    , 2.16218265e-6f    , 6.12893131e-7f    , 2.05253996e-7f    , 7.9253976e-8f     , 3.46278847e-8f    , 1.68601583e-8f    , 9.02854788e-9f    , 5.25517872e-9f    , 3.28927323e-9f    , 2.19213171e-9f    , 1.54165342e-9f    , 1.13493787e-9f    , 8.68486675e-10f   , 6.86633166e-10f   , 5.57983515e-10f   , 4.64064183e-10f   , 3.93581566e-10f   , 3.39390221e-10f   , 2.96827144e-10f   , 2.62763118e-10f   , 2.35044485e-10f   , 2.1215469e-10f    , 1.93003397e-10f   , 1.76791754e-10f   , 1.6292431e-10f    , 1.50950194e-10f   , 1.40523069e-10f   , },
+/* x = 19.5        */  {0.200690879f      , 0.00514591988f    , 0.000395839904f   , 5.07486185e-5f    , 9.10863926e-6f    , 2.10190654e-6f    , 5.92758299e-7f    , 1.97498965e-7f    , 7.58740052e-8f    , 3.29861493e-8f    , 1.59830402e-8f    , 8.51911735e-9f    , 4.93695977e-9f    , 3.07758273e-9f    , 2.04349913e-9f    , 1.43238992e-9f    , 1.05143127e-9f    , 8.02537544e-10f   , 6.33090928e-10f   , 5.13489655e-10f   , 4.26354582e-10f   , 3.61083848e-10f   , 3.10983016e-10f   , 2.71691485e-10f   , 2.40287999e-10f   , 2.14765234e-10f   , 1.93711772e-10f   , 1.76114259e-10f   , 1.61231191e-10f   , 1.48510515e-10f   , 1.37534681e-10f   , 1.27983274e-10f   , },
+/* x = 19.6        */  {0.200178258f      , 0.00510658813f    , 0.000390810237f   , 4.98481661e-5f    , 8.9013798e-6f     , 2.0436057e-6f     , 5.73382341e-7f    , 1.90073866e-7f    , 7.2653906e-8f     , 3.14296306e-8f    , 1.51553087e-8f    , 8.04047458e-9f    , 4.63918458e-9f    , 2.88022282e-9f    , 1.90538613e-9f    , 1.33115607e-9f    , 9.74259139e-10f   , 7.41726319e-10f   , 5.83814829e-10f   , 4.72608897e-10f   , 3.91756814e-10f   , 3.31304834e-10f   , 2.84980306e-10f   , 2.48704946e-10f   , 2.19751342e-10f   , 1.96248364e-10f   , 1.76882313e-10f   , 1.60711294e-10f   , 1.47046972e-10f   , 1.35377487e-10f   , 1.25316119e-10f   , 1.16566413e-10f   , },
+/* x = 19.7        */  {0.199669545f      , 0.00506775487f    , 0.000385869589f   , 4.89681514e-5f    , 8.69985476e-6f    , 1.98720585e-6f    , 5.54733048e-7f    , 1.82963131e-7f    , 6.95853984e-8f    , 2.99535408e-8f    , 1.4373985e-8f     , 7.59064514e-9f    , 4.36047137e-9f    , 2.69618065e-9f    , 1.77702059e-9f    , 1.23734342e-9f    , 9.02928418e-10f   , 6.85643945e-10f   , 5.38458672e-10f   , 4.35043262e-10f   , 3.60010681e-10f   , 3.04014506e-10f   , 2.61176584e-10f   , 2.27682231e-10f   , 2.00984733e-10f   , 1.79339735e-10f   , 1.61524368e-10f   , 1.46663075e-10f   , 1.34116821e-10f   , 1.23410975e-10f   , 1.1418734e-10f    , 1.06171608e-10f   , },
+/* x = 19.8        */  {0.19916469f       , 0.00502941131f    , 0.000381015945f   , 4.81080103e-5f    , 8.50387763e-6f    , 1.93263589e-6f    , 5.36779729e-7f    , 1.76151994e-7f    , 6.66606671e-8f    , 2.85533799e-8f    , 1.36362808e-8f    , 7.16778782e-9f    , 4.09953589e-9f    , 2.52451764e-9f    , 1.65768883e-9f    , 1.15039084e-9f    , 8.36985285e-10f   , 6.33914537e-10f   , 4.967048e-10f     , 4.00519669e-10f   , 3.30877989e-10f   , 2.79002496e-10f   , 2.39384056e-10f   , 2.08454136e-10f   , 1.83834486e-10f   , 1.63898766e-10f   , 1.47508544e-10f   , 1.33849851e-10f   , 1.2232937e-10f    , 1.12506955e-10f   , 1.04050798e-10f   , 9.67070695e-11f   , },
+/* x = 19.9        */  {0.198663646f      , 0.00499154885f    , 0.000376247343f   , 4.72671969e-5f    , 8.31326886e-6f    , 1.87982768e-6f    , 5.1949313e-7f     , 1.69626451e-7f    , 6.38723328e-8f    , 2.72249179e-8f    , 1.29395857e-8f    , 6.77018526e-9f    , 3.85518427e-9f    , 2.36436381e-9f    , 1.54673105e-9f    , 1.06978074e-9f    , 7.76011958e-10f   , 5.86192652e-10f   , 4.58261703e-10f   , 3.68787839e-10f   , 3.0414067e-10f    , 2.56076393e-10f   , 2.19431102e-10f   , 1.90866144e-10f   , 1.68160345e-10f   , 1.49797232e-10f   , 1.3471688e-10f    , 1.22162502e-10f   , 1.1158318e-10f    , 1.0257071e-10f    , 9.48177092e-11f   , 8.80892769e-11f   , },
+/* x = 20.0        */  {0.198166365f      , 0.00495415907f    , 0.000371561879f   , 4.64451833e-5f    , 8.12785555e-6f    , 1.82871597e-6f    , 5.02845363e-7f    , 1.63373214e-7f    , 6.12134264e-8f    , 2.59641774e-8f    , 1.22814554e-8f    , 6.39623526e-9f    , 3.62630643e-9f    , 2.21491268e-9f    , 1.44353722e-9f    , 9.95035643e-10f   , 7.19623782e-10f   , 5.4216078e-10f    , 4.22861842e-10f   , 3.39618363e-10f   , 2.79599064e-10f   , 2.350602e-10f     , 2.01160874e-10f   , 1.74777143e-10f   , 1.53834302e-10f   , 1.36918179e-10f   , 1.23041838e-10f   , 1.11501595e-10f   , 1.01785853e-10f   , 9.35159995e-11f   , 8.64072586e-11f   , 8.02422289e-11f   , },
+/* x = 20.1        */  {0.197672799f      , 0.00491723376f    , 0.000366957697f   , 4.56414582e-5f    , 7.9474712e-6f     , 1.7792382e-6f     , 4.86809832e-7f    , 1.57379672e-7f    , 5.86773649e-8f    , 2.47674178e-8f    , 1.16596002e-8f    , 6.04444267e-9f    , 3.41186996e-9f    , 2.07541642e-9f    , 1.34754315e-9f    , 9.25714983e-10f   , 6.67466556e-10f   , 5.01527051e-10f   , 3.90259648e-10f   , 3.12800947e-10f   , 2.57070348e-10f   , 2.15792919e-10f   , 1.84430015e-10f   , 1.60058253e-10f   , 1.40739526e-10f   , 1.25154922e-10f   , 1.12385375e-10f   , 1.01776517e-10f   , 9.28532214e-11f   , 8.5264296e-11f    , 7.87458841e-11f   , 7.30967664e-11f   , },
+/* x = 20.2        */  {0.197182903f      , 0.00488076488f    , 0.000362432994f   , 4.48555268e-5f    , 7.77195544e-6f    , 1.73133444e-6f    , 4.71361172e-7f    , 1.51633854e-7f    , 5.62579277e-8f    , 2.36311198e-8f    , 1.10718749e-8f    , 5.71341197e-9f    , 3.21091449e-9f    , 1.9451815e-9f     , 1.25822699e-9f    , 8.61412202e-10f   , 6.19214069e-10f   , 4.64023129e-10f   , 3.60229695e-10f   , 2.88142793e-10f   , 2.36387106e-10f   , 1.98127265e-10f   , 1.69107488e-10f   , 1.4659176e-10f    , 1.28769378e-10f   , 1.1441014e-10f    , 1.02658101e-10f   , 9.29046908e-11f   , 8.47086172e-11f   , 7.77440922e-11f   , 7.17666233e-11f   , 6.65899545e-11f   , },
+/* x = 20.3        */  {0.196696631f      , 0.00484474457f    , 0.000357986014f   , 4.408691e-5f      , 7.60115377e-6f    , 1.68494722e-6f    , 4.56475183e-7f    , 1.46124395e-7f    , 5.39492361e-8f    , 2.25519723e-8f    , 1.05162693e-8f    , 5.40184026e-9f    , 3.02254645e-9f    , 1.82356456e-9f    , 1.17510598e-9f    , 8.01752053e-10f   , 5.7456585e-10f    , 4.29402288e-10f   , 3.32565022e-10f   , 2.65467135e-10f   , 2.17396012e-10f   , 1.81928481e-10f   , 1.55073511e-10f   , 1.34270144e-10f   , 1.17826517e-10f   , 1.04595053e-10f   , 9.37785115e-11f   , 8.48108608e-11f   , 7.72821967e-11f   , 7.08902722e-11f   , 6.54085197e-11f   , 6.06645207e-11f   , },
+/* x = 20.4        */  {0.196213939f      , 0.00480916514f    , 0.00035361505f    , 4.33351439e-5f    , 7.43491729e-6f    , 1.64002142e-6f    , 4.42128774e-7f    , 1.40840501e-7f    , 5.17457324e-8f    , 2.15268583e-8f    , 9.99089889e-9f    , 5.10851088e-9f    , 2.84593426e-9f    , 1.70996872e-9f    , 1.0977334e-9f     , 7.46388141e-10f   , 5.33245092e-10f   , 3.97437634e-10f   , 3.07075603e-10f   , 2.4461188e-10f    , 1.99956636e-10f   , 1.67073271e-10f   , 1.4221858e-10f    , 1.22995184e-10f   , 1.07822085e-10f   , 9.56286662e-11f   , 8.56722889e-11f   , 7.74264392e-11f   , 7.05103325e-11f   , 6.46435382e-11f   , 5.96160824e-11f   , 5.52683441e-11f   , },
+/* x = 20.5        */  {0.195734784f      , 0.00477401908f    , 0.000349318439f   , 4.25997791e-5f    , 7.27310253e-6f    , 1.59650421e-6f    , 4.28299906e-7f    , 1.35771918e-7f    , 4.96421613e-8f    , 2.05528437e-8f    , 9.49399699e-9f    , 4.83228741e-9f    , 2.68030384e-9f    , 1.60384008e-9f    , 1.02569584e-9f    , 6.95000643e-10f   , 4.94996758e-10f   , 3.67920491e-10f   , 2.83586935e-10f   , 2.25428383e-10f   , 1.83940344e-10f   , 1.5344881e-10f    , 1.30442585e-10f   , 1.12677157e-10f   , 9.86749641e-11f   , 8.74370823e-11f   , 7.82716666e-11f   , 7.06889137e-11f   , 6.43350582e-11f   , 5.8949889e-11f    , 5.43387948e-11f   , 5.03539907e-11f   , },
+/* x = 20.6        */  {0.195259121f      , 0.00473929903f    , 0.000345094562f   , 4.18803806e-5f    , 7.11557119e-6f    , 1.55434489e-6f    , 4.14967539e-7f    , 1.30908903e-7f    , 4.76335526e-8f    , 1.96271653e-8f    , 9.02390668e-9f    , 4.57210813e-9f    , 2.52493451e-9f    , 1.50466451e-9f    , 9.58610598e-10f   , 6.47294229e-10f   , 4.59585826e-10f   , 3.40658912e-10f   , 2.61938758e-10f   , 2.07780314e-10f   , 1.692293e-10f     , 1.4095185e-10f    , 1.19653991e-10f   , 1.0323409e-10f    , 9.03110959e-11f   , 7.99528788e-11f   , 7.15148478e-11f   , 6.45413068e-11f   , 5.87035627e-11f   , 5.37601452e-11f   , 4.95306668e-11f   , 4.58782909e-11f   , },
+/* x = 20.7        */  {0.19478691f       , 0.0047049978f     , 0.000340941845f   , 4.11765266e-5f    , 6.96218991e-6f    , 1.51349482e-6f    , 4.02111583e-7f    , 1.26242199e-7f    , 4.5715204e-8f     , 1.87472205e-8f    , 8.5790737e-9f     , 4.3269809e-9f     , 2.37915512e-9f    , 1.41196472e-9f    , 8.96123402e-10f   , 6.02996137e-10f   , 4.26795692e-10f   , 3.1547631e-10f    , 2.41983871e-10f   , 1.91542624e-10f   , 1.55715549e-10f   , 1.29487896e-10f   , 1.09769105e-10f   , 9.459109e-11f     , 8.26628656e-11f   , 7.31145366e-11f   , 6.53454775e-11f   , 5.89316838e-11f   , 5.35677297e-11f   , 4.90295169e-11f   , 4.51498284e-11f   , 4.1801955e-11f    , },
+/* x = 20.8        */  {0.194318108f      , 0.00467110834f    , 0.000336858752f   , 4.04878086e-5f    , 6.81283014e-6f    , 1.47390733e-6f    , 3.8971285e-7f     , 1.21763003e-7f    , 4.38826659e-8f    , 1.79105573e-8f    , 8.15803974e-9f    , 4.09597833e-9f    , 2.24234052e-9f    , 1.32529752e-9f    , 8.3790618e-10f    , 5.61854404e-10f   , 3.96426695e-10f   , 2.92210214e-10f   , 2.23587054e-10f   , 1.76600601e-10f   , 1.43300178e-10f   , 1.18970463e-10f   , 1.00711392e-10f   , 8.66797264e-11f   , 7.56685365e-11f   , 6.68659199e-11f   , 5.97121609e-11f   , 5.38127044e-11f   , 4.88837193e-11f   , 4.4717211e-11f    , 4.11581593e-11f   , 3.80892234e-11f   , },
+/* x = 20.9        */  {0.193852675f      , 0.00463762378f    , 0.000332843792f   , 3.98138306e-5f    , 6.66736786e-6f    , 1.43553762e-6f    , 3.77753011e-7f    , 1.17462946e-7f    , 4.2131727e-8f     , 1.7114865e-8f     , 7.75943617e-9f    , 3.87823342e-9f    , 2.11390828e-9f    , 1.2442513e-9f     , 7.83655089e-10f   , 5.23636245e-10f   , 3.68294762e-10f   , 2.70711116e-10f   , 2.06624079e-10f   , 1.62849005e-10f   , 1.31892552e-10f   , 1.09320385e-10f   , 9.24108621e-11f   , 7.94374705e-11f   , 6.92717366e-11f   , 6.1155803e-11f    , 5.45680245e-11f   , 4.91412147e-11f   , 4.46115856e-11f   , 4.07860731e-11f   , 3.75209518e-11f   , 3.47075486e-11f   , },
+/* x = 21.0        */  {0.19339057f       , 0.00460453736f    , 0.000328895508f   , 3.91542091e-5f    , 6.52568346e-6f    , 1.39834269e-6f    , 3.66214555e-7f    , 1.1333407e-7f     , 4.04584e-8f       , 1.63579653e-8f    , 7.38197822e-9f    , 3.67293539e-9f    , 1.99331567e-9f    , 1.16844371e-9f    , 7.33088667e-10f   , 4.88126555e-10f   , 3.4223017e-10f    , 2.50841419e-10f   , 1.909808e-10f     , 1.50191275e-10f   , 1.21409612e-10f   , 1.00465191e-10f   , 8.48035044e-11f   , 7.28071823e-11f   , 6.34209887e-11f   , 5.59374382e-11f   , 4.98703168e-11f   , 4.48778749e-11f   , 4.07149305e-11f   , 3.72022617e-11f   , 3.42066048e-11f   , 3.16273059e-11f   , },
+/* x = 21.1        */  {0.192931754f      , 0.0045718425f     , 0.000325012484f   , 3.85085719e-5f    , 6.38766154e-6f    , 1.36228123e-6f    , 3.55080744e-7f    , 1.09368805e-7f    , 3.88589094e-8f    , 1.56378048e-8f    , 7.02445953e-9f    , 3.47932587e-9f    , 1.88005679e-9f    , 1.09751946e-9f    , 6.85946139e-10f   , 4.5512653e-10f    , 3.18076398e-10f   , 2.32474472e-10f   , 1.76552324e-10f   , 1.38538804e-10f   , 1.11775235e-10f   , 9.23385357e-11f   , 7.78307724e-11f   , 6.67366426e-11f   , 5.80692834e-11f   , 5.11681623e-11f   , 4.55800435e-11f   , 4.09868215e-11f   , 3.71605863e-11f   , 3.39349521e-11f   , 3.11863444e-11f   , 2.882153e-11f     , },
+/* x = 21.2        */  {0.192476189f      , 0.00453953274f    , 0.000321193339f   , 3.78765584e-5f    , 6.25319075e-6f    , 1.32731358e-6f    , 3.44335581e-7f    , 1.05559947e-7f    , 3.73296791e-8f    , 1.49524466e-8f    , 6.68574713e-9f    , 3.29669533e-9f    , 1.77366003e-9f    , 1.03114842e-9f    , 6.41985846e-10f   , 4.24452406e-10f   , 2.95689081e-10f   , 2.15493682e-10f   , 1.63242249e-10f   , 1.27810275e-10f   , 1.02919651e-10f   , 8.48796729e-11f   , 7.1439113e-11f    , 6.11781261e-11f   , 5.31736883e-11f   , 4.68090374e-11f   , 4.1661636e-11f    , 3.74353578e-11f   , 3.39183287e-11f   , 3.09560659e-11f   , 2.84339705e-11f   , 2.62656759e-11f   , },
+/* x = 21.3        */  {0.192023835f      , 0.00450760175f    , 0.00031743673f    , 3.72578189e-5f    , 6.12216363e-6f    , 1.29340167e-6f    , 3.3396377e-7f     , 1.0190064e-7f     , 3.5867321e-8f     , 1.4300064e-8f     , 6.36477668e-9f    , 3.12437982e-9f    , 1.67368559e-9f    , 9.69023703e-10f   , 6.00983805e-10f   , 3.95934283e-10f   , 2.74935044e-10f   , 1.99791703e-10f   , 1.50961965e-10f   , 1.17931052e-10f   , 9.47789002e-11f   , 7.80329816e-11f   , 6.55795379e-11f   , 5.6088012e-11f    , 4.86949923e-11f   , 4.28245242e-11f   , 3.80826489e-11f   , 3.41936737e-11f   , 3.09606141e-11f   , 2.82400261e-11f   , 2.59256255e-11f   , 2.39374005e-11f   , },
+/* x = 21.4        */  {0.191574656f      , 0.00447604335f    , 0.000313741344f   , 3.66520143e-5f    , 5.99447645e-6f    , 1.26050887e-6f    , 3.23950685e-7f    , 9.83843606e-8f    , 3.44686247e-8f    , 1.36789333e-8f    , 6.06054809e-9f    , 2.96175784e-9f    , 1.57972327e-9f    , 9.10859992e-10f   , 5.62732373e-10f   , 3.6941506e-10f    , 2.55691417e-10f   , 1.85269685e-10f   , 1.39630018e-10f   , 1.08832627e-10f   , 8.72943511e-11f   , 7.17475273e-11f   , 6.02072301e-11f   , 5.14264282e-11f   , 4.45973809e-11f   , 3.91821831e-11f   , 3.4813484e-11f    , 3.12345894e-11f   , 2.82623409e-11f   , 2.57635328e-11f   , 2.36395844e-11f   , 2.1816365e-11f    , },
+/* x = 21.5        */  {0.191128614f      , 0.00444485148f    , 0.000310105907f   , 3.60588156e-5f    , 5.87002906e-6f    , 1.22860004e-6f    , 3.14282338e-7f    , 9.50048949e-8f    , 3.31305469e-8f    , 1.30874277e-8f    , 5.77212143e-9f    , 2.80824755e-9f    , 1.49139042e-9f    , 8.56391975e-10f   , 5.27039018e-10f   , 3.44749442e-10f   , 2.37844818e-10f   , 1.71836592e-10f   , 1.29171516e-10f   , 1.00452106e-10f   , 8.0412246e-11f    , 6.59766639e-11f   , 5.52811863e-11f   , 4.71569267e-11f   , 4.08481399e-11f   , 3.58524027e-11f   , 3.18271395e-11f   , 2.85333223e-11f   , 2.58006322e-11f   , 2.35053605e-11f   , 2.15560635e-11f   , 1.98840543e-11f   , },
+/* x = 21.6        */  {0.190685674f      , 0.00441402021f    , 0.000306529172f   , 3.54779038e-5f    , 5.74872477e-6f    , 1.19764136e-6f    , 3.04945343e-7f    , 9.17563269e-8f    , 3.18502029e-8f    , 1.25240118e-8f    , 5.49861306e-9f    , 2.66330404e-9f    , 1.40832993e-9f    , 8.05372885e-10f   , 4.93725189e-10f   , 3.21803026e-10f   , 2.21290604e-10f   , 1.59408569e-10f   , 1.19517597e-10f   , 9.27317439e-11f   , 7.40832933e-11f   , 6.06776687e-11f   , 5.07638892e-11f   , 4.32461869e-11f   , 3.74173853e-11f   , 3.28081514e-11f   , 2.90989811e-11f   , 2.60672745e-11f   , 2.35546379e-11f   , 2.14461718e-11f   , 1.96570462e-11f   , 1.8123613e-11f    , },
+/* x = 21.7        */  {0.190245798f      , 0.00438354373f    , 0.000303009927f   , 3.4908969e-5f     , 5.6304702e-6f     , 1.16760035e-6f    , 2.95926897e-7f    , 8.86330213e-8f    , 3.06248567e-8f    , 1.19872356e-8f    , 5.23919211e-9f    , 2.52641695e-9f    , 1.33020855e-9f    , 7.57573154e-10f   , 4.62625261e-10f   , 3.00451469e-10f   , 2.05932183e-10f   , 1.47908369e-10f   , 1.10604934e-10f   , 8.56185194e-11f   , 6.82622914e-11f   , 5.58114088e-11f   , 4.66210085e-11f   , 3.9663746e-11f    , 3.42778169e-11f   , 3.00247517e-11f   , 2.66065329e-11f   , 2.38158395e-11f   , 2.15053541e-11f   , 1.95683497e-11f   , 1.79261249e-11f   , 1.65196962e-11f   , },
+/* x = 21.8        */  {0.189808953f      , 0.00435341635f    , 0.000299546989f   , 3.43517111e-5f    , 5.51517515e-6f    , 1.13844577e-6f    , 2.87214743e-7f    , 8.5629609e-8f     , 2.94519135e-8f    , 1.14757299e-8f    , 4.9930771e-9f     , 2.39710809e-9f    , 1.25671513e-9f    , 7.1277917e-10f    , 4.33585578e-10f   , 2.8057971e-10f    , 1.91680381e-10f   , 1.3726482e-10f    , 1.02375282e-10f   , 7.90637395e-11f   , 6.29077853e-11f   , 5.13420366e-11f   , 4.28211278e-11f   , 3.63817511e-11f   , 3.14044931e-11f   , 2.74796734e-11f   , 2.43292876e-11f   , 2.17602258e-11f   , 1.96354591e-11f   , 1.78558432e-11f   , 1.63483566e-11f   , 1.50583337e-11f   , },
+/* x = 21.9        */  {0.189375104f      , 0.00432363249f    , 0.000296139205f   , 3.38058383e-5f    , 5.4027525e-6f     , 1.11014759e-6f    , 2.7879715e-7f     , 8.2740974e-8f     , 2.83289116e-8f    , 1.09882012e-8f    , 4.75953285e-9f    , 2.27492936e-9f    , 1.18755916e-9f    , 6.70792128e-10f   , 4.06463551e-10f   , 2.62081258e-10f   , 1.78452856e-10f   , 1.27412337e-10f   , 9.47750657e-11f   , 7.30226834e-11f   , 5.79817523e-11f   , 4.7236711e-11f    , 3.93354948e-11f   , 3.33747343e-11f   , 2.87746259e-11f   , 2.51523463e-11f   , 2.22485333e-11f   , 1.98832959e-11f   , 1.79291638e-11f   , 1.62940282e-11f   , 1.49101316e-11f   , 1.37268066e-11f   , },
+/* x = 22.0        */  {0.188944215f      , 0.00429418671f    , 0.000292785451f   , 3.32710676e-5f    , 5.29311806e-6f    , 1.0826769e-6f     , 2.70662885e-7f    , 7.996224e-8f      , 2.72535148e-8f    , 1.05234274e-8f    , 4.53786758e-9f    , 2.15946074e-9f    , 1.12246932e-9f    , 6.3142696e-10f    , 3.81126843e-10f   , 2.44857537e-10f   , 1.66173565e-10f   , 1.18290473e-10f   , 8.77549945e-11f   , 6.74542725e-11f   , 5.3449314e-11f    , 4.34653424e-11f   , 3.61377935e-11f   , 3.06194068e-11f   , 2.63673934e-11f   , 2.30239879e-11f   , 2.03471948e-11f   , 1.81694208e-11f   , 1.63720758e-11f   , 1.48695798e-11f   , 1.35990546e-11f   , 1.25135345e-11f   , },
+/* x = 22.1        */  {0.188516255f      , 0.00426507364f    , 0.00028948463f    , 3.27471244e-5f    , 5.18619047e-6f    , 1.05600592e-6f    , 2.62801193e-7f    , 7.72887582e-8f    , 2.62235061e-8f    , 1.00802535e-8f    , 4.32743019e-9f    , 2.05030843e-9f    , 1.06119213e-9f    , 5.94511353e-10f   , 3.57452602e-10f   , 2.28817284e-10f   , 1.54772269e-10f   , 1.09843515e-10f   , 8.12697177e-11f   , 6.23207702e-11f   , 4.92784735e-11f   , 4.00003598e-11f   , 3.32039357e-11f   , 2.80944705e-11f   , 2.41637693e-11f   , 2.10774477e-11f   , 1.86096905e-11f   , 1.66043458e-11f   , 1.49510749e-11f   , 1.35703565e-11f   , 1.24038354e-11f   , 1.14079739e-11f   , },
+/* x = 22.2        */  {0.18809119f       , 0.00423628805f    , 0.000286235674f   , 3.22337419e-5f    , 5.08189111e-6f    , 1.03010792e-6f    , 2.55201773e-7f    , 7.47160961e-8f    , 2.52367806e-8f    , 9.65758757e-9f    , 4.12760769e-9f    , 1.94710313e-9f    , 1.00349076e-9f    , 5.59884835e-10f   , 3.35326762e-10f   , 2.13875985e-10f   , 1.44184082e-10f   , 1.02020098e-10f   , 7.52775024e-11f   , 5.75875058e-11f   , 4.54398737e-11f   , 3.68164976e-11f   , 3.05118708e-11f   , 2.57804472e-11f   , 2.21463668e-11f   , 1.9297064e-11f    , 1.70218003e-11f   , 1.51750695e-11f   , 1.36542002e-11f   , 1.23852946e-11f   , 1.13141904e-11f   , 1.04005244e-11f   , },
+/* x = 22.3        */  {0.187668987f      , 0.00420782481f    , 0.000283037539f   , 3.17306611e-5f    , 4.98014397e-6f    , 1.00495716e-6f    , 2.47854755e-7f    , 7.22400261e-8f    , 2.42913395e-8f    , 9.25439737e-9f    , 3.9378229e-9f     , 1.84949847e-9f    , 9.49143857e-10f   , 5.27397927e-10f   , 3.14643389e-10f   , 1.99955368e-10f   , 1.34349048e-10f   , 9.4772863e-11f    , 6.97399401e-11f   , 5.32226212e-11f   , 4.19065773e-11f   , 3.38906007e-11f   , 2.80414114e-11f   , 2.3659521e-11f    , 2.02992961e-11f   , 1.76685343e-11f   , 1.55705464e-11f   , 1.38697328e-11f   , 1.24705476e-11f   , 1.13043125e-11f   , 1.03207524e-11f   , 9.48244432e-12f   , },
+/* x = 22.4        */  {0.187249614f      , 0.00417967888f    , 0.000279889207f   , 3.12376305e-5f    , 4.88087559e-6f    , 9.8052887e-7f     , 2.40750683e-7f    , 6.98565154e-8f    , 2.33852845e-8f    , 8.86970655e-9f    , 3.75753216e-9f    , 1.75716946e-9f    , 8.97944507e-10f   , 4.96911363e-10f   , 2.95304088e-10f   , 1.86982922e-10f   , 1.25211762e-10f   , 8.80581366e-11f   , 6.46216773e-11f   , 4.91968398e-11f   , 3.86538641e-11f   , 3.12014462e-11f   , 2.57740748e-11f   , 2.17153957e-11f   , 1.86080348e-11f   , 1.61787962e-11f   , 1.42440841e-11f   , 1.26775182e-11f   , 1.13901756e-11f   , 1.03182225e-11f   , 9.41498865e-12f   , 8.64577388e-12f   , },
+/* x = 22.5        */  {0.186833041f      , 0.00415184534f    , 0.000276789686f   , 3.07544058e-5f    , 4.78401491e-6f    , 9.56799223e-7f    , 2.33880495e-7f    , 6.75617165e-8f    , 2.25168124e-8f    , 8.50259157e-9f    , 3.58622334e-9f    , 1.66981112e-9f    , 8.49699242e-10f   , 4.68295361e-10f   , 2.77217444e-10f   , 1.74891468e-10f   , 1.16721016e-10f   , 8.18356387e-11f   , 5.9890168e-11f    , 4.54832539e-11f   , 3.56590469e-11f   , 2.87295806e-11f   , 2.36929372e-11f   , 1.99331641e-11f   , 1.70593093e-11f   , 1.48159192e-11f   , 1.30316019e-11f   , 1.1588558e-11f    , 1.040402e-11f     , 9.41865212e-12f   , 8.58912629e-12f   , 7.88326469e-12f   , },
+/* x = 22.6        */  {0.186419235f      , 0.00412431935f    , 0.000273738007f   , 3.02807496e-5f    , 4.68949323e-6f    , 9.33745264e-7f    , 2.27235505e-7f    , 6.53519574e-8f    , 2.16842095e-8f    , 8.15217861e-9f    , 3.42341381e-9f    , 1.58713719e-9f    , 8.04227124e-10f   , 4.41428957e-10f   , 2.60298508e-10f   , 1.6361875e-10f    , 1.08829469e-10f   , 7.60682127e-11f   , 5.55154467e-11f   , 4.20571299e-11f   , 3.29013012e-11f   , 2.64571702e-11f   , 2.17825014e-11f   , 1.82991882e-11f   , 1.56409866e-11f   , 1.35690063e-11f   , 1.19232316e-11f   , 1.059385e-11f     , 9.50381627e-12f   , 8.59797063e-12f   , 7.83608434e-12f   , 7.18831616e-12f   , },
+/* x = 22.7        */  {0.186008167f      , 0.00409709618f    , 0.000270733225f   , 2.98164314e-5f    , 4.59724408e-6f    , 9.11344893e-7f    , 2.20807386e-7f    , 6.32237333e-8f    , 2.08858475e-8f    , 7.81764069e-9f    , 3.26864873e-9f    , 1.50887891e-9f    , 7.61358898e-10f   , 4.16199374e-10f   , 2.44468331e-10f   , 1.53107064e-10f   , 1.0149335e-10f    , 7.07215786e-11f   , 5.14699199e-11f   , 3.88957302e-11f   , 3.03615108e-11f   , 2.43678647e-11f   , 2.00285748e-11f   , 1.68009908e-11f   , 1.43419753e-11f   , 1.24281036e-11f   , 1.09099647e-11f   , 9.68518162e-12f   , 8.6820287e-12f    , 7.84922357e-12f   , 7.14941199e-12f   , 6.55491731e-12f   , },
+/* x = 22.8        */  {0.185599806f      , 0.00407017117f    , 0.000267774417f   , 2.93612271e-5f    , 4.50720317e-6f    , 8.89576825e-7f    , 2.14588152e-7f    , 6.11736982e-8f    , 2.01201784e-8f    , 7.49819504e-9f    , 3.12149927e-9f    , 1.4347839e-9f     , 7.20936202e-10f   , 3.92501451e-10f   , 2.29653515e-10f   , 1.43302918e-10f   , 9.46721837e-11f   , 6.57641049e-11f   , 4.77281752e-11f   , 3.59781492e-11f   , 2.80221258e-11f   , 2.24466727e-11f   , 1.84181589e-11f   , 1.54271551e-11f   , 1.31521361e-11f   , 1.13841182e-11f   , 9.98357778e-12f   , 8.85506012e-12f   , 7.93178565e-12f   , 7.16607239e-12f   , 6.52323224e-12f   , 5.97759399e-12f   , },
+/* x = 22.9        */  {0.185194123f      , 0.00404353979f    , 0.000264860683f   , 2.89149192e-5f    , 4.41930832e-6f    , 8.68420556e-7f    , 2.08570146e-7f    , 5.9198657e-8f     , 1.93857302e-8f    , 7.19310049e-9f    , 2.98156109e-9f    , 1.3646151e-9f     , 6.8281083e-10f    , 3.70237106e-10f   , 2.1578582e-10f    , 1.34156713e-10f   , 8.83285327e-11f   , 6.11665998e-11f   , 4.42668053e-11f   , 3.32851635e-11f   , 2.5867032e-11f    , 2.06798472e-11f   , 1.69393476e-11f   , 1.41672344e-11f   , 1.20621988e-11f   , 1.04287431e-11f   , 9.13656304e-12f   , 8.09664916e-12f   , 7.24682084e-12f   , 6.54273971e-12f   , 5.95219069e-12f   , 5.45136076e-12f   , },
+/* x = 23.0        */  {0.184791088f      , 0.00401719756f    , 0.000261991143f   , 2.8477296e-5f     , 4.33349933e-6f    , 8.47856333e-7f    , 2.02746023e-7f    , 5.72955582e-8f    , 1.86811034e-8f    , 6.90165518e-9f    , 2.84845282e-9f    , 1.29814979e-9f    , 6.46844052e-10f   , 3.49314837e-10f   , 2.02801778e-10f   , 1.25622452e-10f   , 8.24277653e-11f   , 5.69021187e-11f   , 4.10642469e-11f   , 3.07990943e-11f   , 2.38814322e-11f   , 1.9054781e-11f    , 1.55812345e-11f   , 1.30116686e-11f   , 1.10636875e-11f   , 9.55438898e-12f   , 8.36206612e-12f   , 7.40371105e-12f   , 6.62141981e-12f   , 5.97395941e-12f   , 5.43140889e-12f   , 4.97167708e-12f   , },
+/* x = 23.1        */  {0.184390674f      , 0.00399114012f    , 0.000259164941f   , 2.80481517e-5f    , 4.24971795e-6f    , 8.27865124e-7f    , 1.97108734e-7f    , 5.54614867e-8f    , 1.80049664e-8f    , 6.62319428e-9f    , 2.72181467e-9f    , 1.23517868e-9f    , 6.12905979e-10f   , 3.29649267e-10f   , 1.90642357e-10f   , 1.17657468e-10f   , 7.69378394e-11f   , 5.29457873e-11f   , 3.81006327e-11f   , 2.85036814e-11f   , 2.2051737e-11f    , 1.7559911e-11f    , 1.43338279e-11f   , 1.19517084e-11f   , 1.01488521e-11f   , 8.7541218e-12f    , 7.65382868e-12f   , 6.77055397e-12f   , 6.05037103e-12f   , 5.45493121e-12f   , 4.95644188e-12f   , 4.53440753e-12f   , },
+/* x = 23.2        */  {0.183992851f      , 0.00396536316f    , 0.000256381237f   , 2.76272867e-5f    , 4.16790781e-6f    , 8.08428584e-7f    , 1.91651517e-7f    , 5.36936575e-8f    , 1.73560527e-8f    , 6.35708791e-9f    , 2.60130718e-9f    , 1.17550503e-9f    , 5.8087497e-10f    , 3.11160713e-10f   , 1.79252631e-10f   , 1.1022218e-10f    , 7.18291037e-11f   , 4.92746392e-11f   , 3.53576553e-11f   , 2.63839673e-11f   , 2.03654646e-11f   , 1.61846312e-11f   , 1.31879736e-11f   , 1.09793459e-11f   , 9.31060542e-12f   , 8.02160563e-12f   , 7.00613626e-12f   , 6.191984e-12f     , 5.52892145e-12f   , 4.98127928e-12f   , 4.52323951e-12f   , 4.13578546e-12f   , },
+/* x = 23.3        */  {0.183597592f      , 0.00393986248f    , 0.000253639214f   , 2.72145063e-5f    , 4.08801434e-6f    , 7.89529034e-7f    , 1.86367883e-7f    , 5.1989409e-8f     , 1.67331569e-8f    , 6.10273919e-9f    , 2.48660993e-9f    , 1.11894392e-9f    , 5.50637087e-10f   , 2.93774792e-10f   , 1.68581492e-10f   , 1.03279858e-10f   , 6.70741142e-11f   , 4.58674656e-11f   , 3.28184425e-11f   , 2.4426191e-11f    , 1.88111496e-11f   , 1.49192116e-11f   , 1.21352838e-11f   , 1.0087251e-11f    , 8.54246617e-12f   , 7.35105082e-12f   , 6.41377076e-12f   , 5.6632613e-12f    , 5.05273599e-12f   , 4.54901454e-12f   , 4.12811123e-12f   , 3.77238007e-12f   , },
+/* x = 23.4        */  {0.183204869f      , 0.00391463395f    , 0.000250938073f   , 2.68096217e-5f    , 4.00998468e-6f    , 7.7114943e-7f     , 1.81251601e-7f    , 5.03461972e-8f    , 1.61351318e-8f    , 5.85958235e-9f    , 2.37742045e-9f    , 1.06532141e-9f    , 5.22085578e-10f   , 2.77422051e-10f   , 1.58581367e-10f   , 9.67964144e-11f   , 6.2647466e-11f    , 4.27046782e-11f   , 3.04674424e-11f   , 2.26176908e-11f   , 1.73782587e-11f   , 1.37547258e-11f   , 1.11680721e-11f   , 9.26871387e-12f   , 7.83850674e-12f   , 6.73716654e-12f   , 5.87196704e-12f   , 5.18006018e-12f   , 4.61786055e-12f   , 4.15450033e-12f   , 3.76769408e-12f   , 3.4410663e-12f    , },
+/* x = 23.5        */  {0.182814656f      , 0.00388967353f    , 0.000248277033f   , 2.64124489e-5f    , 3.93376767e-6f    , 7.53273335e-7f    , 1.7629669e-7f     , 4.87615901e-8f    , 1.55608853e-8f    , 5.62708104e-9f    , 2.27345316e-9f    , 1.01447393e-9f    , 4.95120404e-10f   , 2.62037631e-10f   , 1.4920797e-10f    , 9.07402061e-11f   , 5.85256371e-11f   , 3.97681825e-11f   , 2.82903179e-11f   , 2.09468152e-11f   , 1.60571138e-11f   , 1.26829834e-11f   , 1.02792944e-11f   , 8.51759157e-12f   , 7.19330548e-12f   , 6.1751175e-12f    , 5.37637332e-12f   , 4.73843276e-12f   , 4.22068842e-12f   , 3.79442114e-12f   , 3.43892342e-12f   , 3.1389975e-12f    , },
+/* x = 23.6        */  {0.182426926f      , 0.00386497724f    , 0.000245655332f   , 2.60228094e-5f    , 3.85931375e-6f    , 7.35884904e-7f    , 1.71497407e-7f    , 4.72332622e-8f    , 1.50093774e-8f    , 5.40472665e-9f    , 2.17443831e-9f    , 9.66247585e-10f   , 4.69647798e-10f   , 2.47560944e-10f   , 1.40420066e-10f   , 8.50818542e-11f   , 5.46868451e-11f   , 3.70412606e-11f   , 2.62738502e-11f   , 1.94028404e-11f   , 1.48388218e-11f   , 1.16964683e-11f   , 9.46249464e-12f   , 7.82825994e-12f   , 6.60190313e-12f   , 5.66048441e-12f   , 4.92301515e-12f   , 4.33477571e-12f   , 3.85792955e-12f   , 3.46575413e-12f   , 3.13900644e-12f   , 2.86358058e-12f   , },
+/* x = 23.7        */  {0.182041652f      , 0.00384054118f    , 0.000243072225f   , 2.5640529e-5f     , 3.78657494e-6f    , 7.1896885e-7f     , 1.66848236e-7f    , 4.57589897e-8f    , 1.44796179e-8f    , 5.19203681e-9f    , 2.0801211e-9f     , 9.20497557e-10f   , 4.45579849e-10f   , 2.33935385e-10f   , 1.32179249e-10f   , 7.97940766e-11f   , 5.11109154e-11f   , 3.45084646e-11f   , 2.44058497e-11f   , 1.79758956e-11f   , 1.37152098e-11f   , 1.0788283e-11f    , 8.71175491e-12f   , 7.1955693e-12f    , 6.0597631e-12f    , 5.18922796e-12f   , 4.50826245e-12f   , 3.96580008e-12f   , 3.52658266e-12f   , 3.16574315e-12f   , 2.86539789e-12f   , 2.61245327e-12f   , },
+/* x = 23.8        */  {0.181658809f      , 0.00381636153f    , 0.000240526986f   , 2.52654388e-5f    , 3.71550473e-6f    , 7.0251043e-7f     , 1.62343879e-7f    , 4.43366452e-8f    , 1.39706632e-8f    , 4.98855388e-9f    , 1.9902608e-9f     , 8.77087547e-10f   , 4.22834117e-10f   , 2.21108053e-10f   , 1.24449745e-10f   , 7.48515335e-11f   , 4.77791584e-11f   , 3.21555175e-11f   , 2.26750738e-11f   , 1.66568936e-11f   , 1.26787658e-11f   , 9.95209664e-12f   , 8.02165038e-12f   , 6.61480398e-12f   , 5.56273508e-12f   , 4.75765591e-12f   , 4.12879946e-12f   , 3.62850365e-12f   , 3.22390973e-12f   , 2.89187515e-12f   , 2.61577808e-12f   , 2.38346356e-12f   , },
+/* x = 23.9        */  {0.181278371f      , 0.00379243454f    , 0.000238018903f   , 2.4897374e-5f     , 3.64605808e-6f    , 6.86495418e-7f    , 1.57979244e-7f    , 4.29641936e-8f    , 1.34816147e-8f    , 4.79384368e-9f    , 1.90462988e-9f    , 8.35889242e-10f   , 4.01333282e-10f   , 2.09029505e-10f   , 1.17198221e-10f   , 7.02306845e-11f   , 4.46742579e-11f   , 2.99692222e-11f   , 2.10711525e-11f   , 1.54374676e-11f   , 1.17225847e-11f   , 9.18209798e-12f   , 7.38720762e-12f   , 6.08164548e-12f   , 5.10702193e-12f   , 4.362393e-12f     , 3.78159736e-12f   , 3.32014584e-12f   , 2.94741281e-12f   , 2.64185859e-12f   , 2.3880328e-12f    , 2.17465088e-12f   , },
+/* x = 24.0        */  {0.180900314f      , 0.00376875653f    , 0.000235547283f   , 2.45361745e-5f    , 3.57819133e-6f    , 6.70910087e-7f    , 1.53749442e-7f    , 4.16396873e-8f    , 1.30116158e-8f    , 4.60749411e-9f    , 1.82301327e-9f    , 7.96781817e-10f   , 3.81004801e-10f   , 1.97653514e-10f   , 1.10393615e-10f   , 6.59096563e-11f   , 4.17801666e-11f   , 2.79373782e-11f   , 1.95845186e-11f   , 1.43099134e-11f   , 1.08403183e-11f   , 8.47295214e-12f   , 6.8038666e-12f    , 5.59213857e-12f   , 4.68914932e-12f   , 4.00035357e-12f   , 3.46388931e-12f   , 3.03822474e-12f   , 2.69481282e-12f   , 2.41360386e-12f   , 2.18023505e-12f   , 1.98422902e-12f   , },
+/* x = 24.1        */  {0.180524612f      , 0.00374532389f    , 0.000233111445f   , 2.41816844e-5f    , 3.51186218e-6f    , 6.55741192e-7f    , 1.49649771e-7f    , 4.03612627e-8f    , 1.25598502e-8f    , 4.42911401e-9f    , 1.74520762e-9f    , 7.59651477e-10f   , 3.61780605e-10f   , 1.86936852e-10f   , 1.04006975e-10f   , 6.18681211e-11f   , 3.90820109e-11f   , 2.60487039e-11f   , 1.82063446e-11f   , 1.32671352e-11f   , 1.00261296e-11f   , 7.81976104e-12f   , 6.26744595e-12f   , 5.14266053e-12f   , 4.30593807e-12f   , 3.66871651e-12f   , 3.17314755e-12f   , 2.78045623e-12f   , 2.46403034e-12f   , 2.20520539e-12f   , 1.99062838e-12f   , 1.81057056e-12f   , },
+/* x = 24.2        */  {0.180151241f      , 0.00372213307f    , 0.000230710727f   , 2.38337522e-5f    , 3.44702963e-6f    , 6.40975946e-7f    , 1.45675713e-7f    , 3.91271355e-8f    , 1.21255398e-8f    , 4.25833198e-9f    , 1.67102065e-9f    , 7.24391021e-10f   , 3.43596804e-10f   , 1.76839089e-10f   , 9.80113061e-11f   , 5.80871836e-11f   , 3.65660022e-11f   , 2.42927662e-11f   , 1.69284841e-11f   , 1.23025976e-11f   , 9.27465121e-12f   , 7.21802711e-12f   , 5.77411112e-12f   , 4.72989283e-12f   , 3.95447884e-12f   , 3.36490239e-12f   , 2.90706269e-12f   , 2.54475486e-12f   , 2.25316797e-12f   , 2.01492534e-12f   , 1.81761173e-12f   , 1.65219273e-12f   , },
+/* x = 24.3        */  {0.179780177f      , 0.0036991806f     , 0.000228344481f   , 2.349223e-5f      , 3.38365395e-6f    , 6.26602007e-7f    , 1.41822924e-7f    , 3.79355977e-8f    , 1.17079423e-8f    , 4.09479533e-9f    , 1.60027046e-9f    , 6.9089944e-10f    , 3.2639342e-10f    , 1.673224e-10f     , 9.23814384e-11f   , 5.45492763e-11f   , 3.42193556e-11f   , 2.26599146e-11f   , 1.57434182e-11f   , 1.14102796e-11f   , 8.58094694e-12f   , 6.66362017e-12f   , 5.32034532e-12f   , 4.35079537e-12f   , 3.63210901e-12f   , 3.08655261e-12f   , 2.66352466e-12f   , 2.32921651e-12f   , 2.06049431e-12f   , 1.84117883e-12f   , 1.65972565e-12f   , 1.50774444e-12f   , },
+/* x = 24.4        */  {0.179411397f      , 0.00367646305f    , 0.000226012072f   , 2.31569741e-5f    , 3.32169658e-6f    , 6.12607458e-7f    , 1.38087228e-7f    , 3.67850135e-8f    , 1.13063504e-8f    , 3.93816907e-9f    , 1.53278498e-9f    , 6.59081537e-10f   , 3.10114137e-10f   , 1.58351392e-10f   , 8.70938956e-11f   , 5.12380633e-11f   , 3.20302147e-11f   , 2.11412214e-11f   , 1.46442062e-11f   , 1.05846342e-11f   , 7.9404764e-12f    , 6.1527469e-12f    , 4.90292281e-12f   , 4.00258285e-12f   , 3.3363916e-12f    , 2.83151035e-12f   , 2.44060541e-12f   , 2.13210252e-12f   , 1.88442941e-12f   , 1.68252034e-12f   , 1.51563968e-12f   , 1.37599461e-12f   , },
+/* x = 24.5        */  {0.179044877f      , 0.00365397708f    , 0.000223712882f   , 2.28278446e-5f    , 3.26112019e-6f    , 5.98980792e-7f    , 1.34464609e-7f    , 3.56738166e-8f    , 1.09200888e-8f    , 3.78813495e-9f    , 1.46840136e-9f    , 6.28847576e-10f   , 2.94706059e-10f   , 1.49892941e-10f   , 8.21267769e-11f   , 4.81383507e-11f   , 2.99875821e-11f   , 1.97284257e-11f   , 1.36244398e-11f   , 9.8205495e-12f    , 7.3490629e-12f    , 5.68192307e-12f   , 4.51888456e-12f   , 3.6827032e-12f    , 3.06509596e-12f   , 2.59780313e-12f   , 2.23654309e-12f   , 1.95182521e-12f   , 1.72353139e-12f   , 1.53763144e-12f   , 1.38414095e-12f   , 1.25582142e-12f   , },
+/* x = 24.6        */  {0.178680594f      , 0.00363171939f    , 0.000221446304f   , 2.25047052e-5f    , 3.20188853e-6f    , 5.85710896e-7f    , 1.30951202e-7f    , 3.46005063e-8f    , 1.05485137e-8f    , 3.64439055e-9f    , 1.40696549e-9f    , 6.00112945e-10f   , 2.80119499e-10f   , 1.41916039e-10f   , 7.74596477e-11f   , 4.52360042e-11f   , 2.80812551e-11f   , 1.84138829e-11f   , 1.26782017e-11f   , 9.11331477e-12f   , 6.80286379e-12f   , 5.24794792e-12f   , 4.16551591e-12f   , 3.38881785e-12f   , 2.81618011e-12f   , 2.38362699e-12f   , 2.04972762e-12f   , 1.78693467e-12f   , 1.57648434e-12f   , 1.40530954e-12f   , 1.26412369e-12f   , 1.14620259e-12f   , },
+/* x = 24.7        */  {0.178318525f      , 0.00360968675f    , 0.000219211745f   , 2.21874233e-5f    , 3.14396648e-6f    , 5.72787036e-7f    , 1.27543292e-7f    , 3.35636448e-8f    , 1.01910106e-8f    , 3.50664846e-9f    , 1.34833146e-9f    , 5.72797851e-10f   , 2.6630777e-10f    , 1.34391649e-10f   , 7.30734366e-11f   , 4.25178724e-11f   , 2.63017668e-11f   , 1.71905171e-11f   , 1.1800027e-11f    , 8.45858776e-12f   , 6.29834331e-12f   , 4.84788082e-12f   , 3.84032615e-12f   , 3.11878367e-12f   , 2.58777468e-12f   , 2.1873319e-12f    , 1.87868752e-12f   , 1.63610679e-12f   , 1.44208725e-12f   , 1.28445769e-12f   , 1.15457976e-12f   , 1.04620652e-12f   , },
+/* x = 24.8        */  {0.177958649f      , 0.00358787599f    , 0.000217008628f   , 2.18758694e-5f    , 3.08731994e-6f    , 5.6019884e-7f     , 1.24237304e-7f    , 3.25618546e-8f    , 9.84699308e-9f    , 3.37463548e-9f    , 1.29236111e-9f    , 5.46827029e-10f   , 2.53226994e-10f   , 1.27292582e-10f   , 6.89503416e-11f   , 3.99717164e-11f   , 2.46403314e-11f   , 1.60517775e-11f   , 1.09848677e-11f   , 7.85236557e-12f   , 5.83224766e-12f   , 4.47901978e-12f   , 3.54102979e-12f   , 2.87063645e-12f   , 2.37816815e-12f   , 2.00740859e-12f   , 1.72207793e-12f   , 1.4981322e-12f    , 1.31924392e-12f   , 1.17407521e-12f   , 1.05459001e-12f   , 9.54984224e-13f   , },
+/* x = 24.9        */  {0.177600943f      , 0.00356628399f    , 0.000214836385f   , 2.15699178e-5f    , 3.03191586e-6f    , 5.47936292e-7f    , 1.21029796e-7f    , 3.15938154e-8f    , 9.51590125e-9f    , 3.24809182e-9f    , 1.23892362e-9f    , 5.22129465e-10f   , 2.40835927e-10f   , 1.20593366e-10f   , 6.50737414e-11f   , 3.75861436e-11f   , 2.30887932e-11f   , 1.49915988e-11f   , 1.02280604e-11f   , 7.29095749e-12f   , 5.40158214e-12f   , 4.13888185e-12f   , 3.26552947e-12f   , 2.6425758e-12f    , 2.18579339e-12f   , 1.84247639e-12f   , 1.57866957e-12f   , 1.37190633e-12f   , 1.20695375e-12f   , 1.07324923e-12f   , 9.63316328e-13f   , 8.71761935e-13f   , },
+/* x = 25.0        */  {0.177245385f      , 0.0035449077f     , 0.000212694462f   , 2.12694459e-5f    , 2.97772215e-6f    , 5.35989709e-7f    , 1.17917458e-7f    , 3.06582614e-8f    , 9.19720065e-9f    , 3.12677046e-9f    , 1.18789502e-9f    , 4.98638148e-10f   , 2.29095789e-10f   , 1.14270136e-10f   , 6.14281145e-11f   , 3.53505475e-11f   , 2.16395806e-11f   , 1.40043643e-11f   , 9.52529614e-12f   , 6.77096026e-12f   , 5.00359013e-12f   , 3.82518503e-12f   , 3.01190025e-12f   , 2.43295134e-12f   , 2.00921539e-12f   , 1.6912722e-12f    , 1.44733877e-12f   , 1.25642022e-12f   , 1.10430336e-12f   , 9.81146955e-13f   , 8.7999453e-13f    , 7.95834449e-13f   , },
+/* x = 25.1        */  {0.176891954f      , 0.00352374411f    , 0.000210582317f   , 2.09743341e-5f    , 2.92470769e-6f    , 5.24349735e-7f    , 1.14897102e-7f    , 2.97539792e-8f    , 8.89038092e-9f    , 3.01043644e-9f    , 1.13915789e-9f    , 4.76289828e-10f   , 2.17970114e-10f   , 1.08300528e-10f   , 5.79989627e-11f   , 3.32550515e-11f   , 2.02856627e-11f   , 1.30848713e-11f   , 8.87259288e-12f   , 6.28923517e-12f   , 4.63573387e-12f   , 3.53583182e-12f   , 2.77837524e-12f   , 2.24025009e-12f   , 1.84711998e-12f   , 1.55264039e-12f   , 1.32705834e-12f   , 1.15075221e-12f   , 1.01045897e-12f   , 8.97008562e-13f   , 8.03927767e-13f   , 7.26559014e-13f   , },
+/* x = 25.2        */  {0.176540629f      , 0.00350279026f    , 0.00020849942f    , 2.06844661e-5f    , 2.87284228e-6f    , 5.13007325e-7f    , 1.11965659e-7f    , 2.88798054e-8f    , 8.59495459e-9f    , 2.89886622e-9f    , 1.09260095e-9f    , 4.55024789e-10f   , 2.07424597e-10f   , 1.0266358e-10f    , 5.47727415e-11f   , 3.12904567e-11f   , 1.90205093e-11f   , 1.22283e-11f      , 8.26627012e-12f   , 5.84288706e-12f   , 4.29567676e-12f   , 3.26889405e-12f   , 2.56333249e-12f   , 2.06308483e-12f   , 1.69830358e-12f   , 1.42552358e-12f   , 1.2168892e-12f    , 1.05406034e-12f   , 9.24659362e-13f   , 8.20140812e-13f   , 7.34480578e-13f   , 6.63349772e-13f   , },
+/* x = 25.3        */  {0.176191389f      , 0.00348204327f    , 0.000206445253f   , 2.03997283e-5f    , 2.8220966e-6f     , 5.01953738e-7f    , 1.09120174e-7f    , 2.80346241e-8f    , 8.31045599e-9f    , 2.7918471e-9f     , 1.04811871e-9f    , 4.34786648e-10f   , 1.97426965e-10f   , 9.73396382e-11f   , 5.17367943e-11f   , 2.94481935e-11f   , 1.78380545e-11f   , 1.14301849e-11f   , 7.70292549e-12f   , 5.42924509e-12f   , 3.98126712e-12f   , 3.02259902e-12f   , 2.36528292e-12f   , 1.90018359e-12f   , 1.56166377e-12f   , 1.30895421e-12f   , 1.11597278e-12f   , 9.65575407e-13f   , 8.46209595e-13f   , 7.49911167e-13f   , 6.71073459e-13f   , 6.0567271e-13f    , },
+/* x = 25.4        */  {0.175844214f      , 0.00346150027f    , 0.000204419307f   , 2.01200104e-5f    , 2.77244219e-6f    , 4.9118052e-7f     , 1.06357803e-7f    , 2.72173648e-8f    , 8.03644022e-9f    , 2.68917666e-9f    , 1.00561117e-9f    , 4.15522148e-10f   , 1.87946851e-10f   , 9.23102738e-11f   , 4.88792918e-11f   , 2.77202775e-11f   , 1.67326621e-11f   , 1.06863874e-11f   , 7.17941325e-12f   , 5.04584494e-12f   , 3.69052334e-12f   , 2.79531673e-12f   , 2.18285929e-12f   , 1.75037994e-12f   , 1.43619075e-12f   , 1.20204684e-12f   , 1.02352405e-12f   , 8.84594636e-13f   , 7.74475154e-13f   , 6.85742453e-13f   , 6.13177904e-13f   , 5.53041043e-13f   , },
+/* x = 25.5        */  {0.175499083f      , 0.00344115848f    , 0.000202421087f   , 1.98452044e-5f    , 2.72385142e-6f    , 4.80679498e-7f    , 1.03675805e-7f    , 2.64270008e-8f    , 7.77248213e-9f    , 2.59066221e-9f    , 9.64983501e-10f   , 3.97180982e-10f   , 1.78955669e-10f   , 8.75582011e-11f   , 4.61891758e-11f   , 2.60992674e-11f   , 1.56990946e-11f   , 9.99307172e-12f   , 6.69282444e-12f   , 4.69041256e-12f   , 3.42162012e-12f   , 2.58554826e-12f   , 2.0148061e-12f    , 1.61260414e-12f   , 1.32095942e-12f   , 1.10399114e-12f   , 9.38825182e-13f   , 8.104759e-13f     , 7.08876681e-13f   , 6.27107982e-13f   , 5.60311905e-13f   , 5.05011028e-13f   , },
+/* x = 25.6        */  {0.175155976f      , 0.00342101515f    , 0.000200450106f   , 1.95752055e-5f    , 2.67629748e-6f    , 4.70442768e-7f    , 1.0107154e-7f     , 2.56625467e-8f    , 7.51817537e-9f    , 2.4961203e-9f     , 9.26145778e-10f   , 3.79715615e-10f   , 1.70426509e-10f   , 8.30672044e-11f   , 4.36561065e-11f   , 2.4578227e-11f    , 1.47324838e-11f   , 9.34668168e-12f   , 6.24046862e-12f   , 4.3608491e-12f    , 3.17287597e-12f   , 2.39191503e-12f   , 1.85997033e-12f   , 1.485875e-12f     , 1.21512226e-12f   , 1.01404542e-12f   , 8.6121975e-13f    , 7.42632453e-13f   , 6.48885151e-13f   , 5.73527117e-13f   , 5.12035834e-13f   , 4.61178138e-13f   , },
+/* x = 25.7        */  {0.174814873f      , 0.00340106757f    , 0.000198505889f   , 1.93099113e-5f    , 2.62975432e-6f    , 4.60462684e-7f    , 9.85424635e-8f    , 2.4923057e-8f     , 7.27313149e-9f    , 2.40537624e-9f    , 8.89012685e-10f   , 3.63081125e-10f   , 1.62334034e-10f   , 7.88220679e-11f   , 4.12704141e-11f   , 2.31506899e-11f   , 1.38283042e-11f   , 8.74392006e-12f   , 5.81985707e-12f   , 4.05521717e-12f   , 2.94274165e-12f   , 2.21314901e-12f   , 1.71729297e-12f   , 1.3692925e-12f    , 1.1179027e-12f    , 9.31530807e-13f   , 7.90107439e-13f   , 6.80528121e-13f   , 5.94017468e-13f   , 5.24561223e-13f   , 4.67948702e-13f   , 4.2117358e-13f    , },
+/* x = 25.8        */  {0.174475756f      , 0.00338131309f    , 0.00019658797f    , 1.90492218e-5f    , 2.58419664e-6f    , 4.50731851e-7f    , 9.60861263e-8f    , 2.42076241e-8f    , 7.03697908e-9f    , 2.31826365e-9f    , 8.53503276e-10f   , 3.47235049e-10f   , 1.54654377e-10f   , 7.48085112e-11f   , 3.90230532e-11f   , 2.18106258e-11f   , 1.29823477e-11f   , 8.18172906e-12f   , 5.42868724e-12f   , 3.77172815e-12f   , 2.72978958e-12f   , 2.04808367e-12f   , 1.58580121e-12f   , 1.26203099e-12f   , 1.02858917e-12f   , 8.55825848e-13f   , 7.24939202e-13f   , 6.23672913e-13f   , 5.43832457e-13f   , 4.79809973e-13f   , 4.27684747e-13f   , 3.84661127e-13f   , },
+/* x = 25.9        */  {0.174138604f      , 0.00336174911f    , 0.000194695894f   , 1.87930399e-5f    , 2.53959988e-6f    , 4.41243113e-7f    , 9.37001659e-8f    , 2.35153767e-8f    , 6.809363e-9f      , 2.23462403e-9f    , 8.19540735e-10f   , 3.3213724e-10f    , 1.4736506e-10f    , 7.10131289e-11f   , 3.69055611e-11f   , 2.05524103e-11f   , 1.21907008e-11f   , 7.65727242e-12f   , 5.06482853e-12f   , 3.50873048e-12f   , 2.5327041e-12f    , 1.89564578e-12f   , 1.46460139e-12f   , 1.16333293e-12f   , 9.4652956e-13f    , 7.86361618e-13f   , 6.65212855e-13f   , 5.7161901e-13f    , 4.979272e-13f     , 4.38907988e-13f   , 3.90910322e-13f   , 3.51334228e-13f   , },
+/* x = 26.0        */  {0.173803399f      , 0.00334237307f    , 0.000192829215f   , 1.85412706e-5f    , 2.49594018e-6f    , 4.31989547e-7f    , 9.1382306e-8f     , 2.28454783e-8f    , 6.58994355e-9f    , 2.15430637e-9f    , 7.87052153e-10f   , 3.17749733e-10f   , 1.404449e-10f     , 6.74233346e-11f   , 3.49100182e-11f   , 1.93707969e-11f   , 1.14497234e-11f   , 7.16791888e-12f   , 4.72630907e-12f   , 3.26469897e-12f   , 2.35027252e-12f   , 1.75484777e-12f   , 1.35287241e-12f   , 1.07250326e-12f   , 8.71126231e-13f   , 7.22617236e-13f   , 6.10469039e-13f   , 5.23957116e-13f   , 4.55933699e-13f   , 4.01521766e-13f   , 3.57321061e-13f   , 3.20913378e-13f   , },
+/* x = 26.1        */  {0.173470123f      , 0.00332318244f    , 0.000190987496f   , 1.82938214e-5f    , 2.45319435e-6f    , 4.22964455e-7f    , 8.91303521e-8f    , 2.21971256e-8f    , 6.3783958e-9f     , 2.07716677e-9f    , 7.55968311e-10f   , 3.04036621e-10f   , 1.33873935e-10f   , 6.40273079e-11f   , 3.30290119e-11f   , 1.82608898e-11f   , 1.07560285e-11f   , 6.71122695e-12f   , 4.41130361e-12f   , 3.03822488e-12f   , 2.18137692e-12f   , 1.62478082e-12f   , 1.24985978e-12f   , 9.8890412e-13f    , 8.01831393e-13f   , 6.64115773e-13f   , 5.60287538e-13f   , 4.80313115e-13f   , 4.17515831e-13f   , 3.67346886e-13f   , 3.26639298e-13f   , 2.93143721e-13f   , },
+/* x = 26.2        */  {0.173138757f      , 0.00330417475f    , 0.00018917031f    , 1.8050602e-5f     , 2.41133988e-6f    , 4.14161351e-7f    , 8.69421885e-8f    , 2.15695471e-8f    , 6.17440884e-9f    , 2.00306808e-9f    , 7.26223483e-10f   , 2.90963935e-10f   , 1.2763335e-10f    , 6.08139461e-11f   , 3.12556026e-11f   , 1.72181204e-11f   , 1.01064649e-11f   , 6.28493082e-12f   , 4.11812234e-12f   , 2.82800683e-12f   , 2.02498661e-12f   , 1.50460845e-12f   , 1.15487013e-12f   , 9.11950145e-13f   , 7.38142911e-13f   , 6.10420502e-13f   , 5.14283918e-13f   , 4.40345026e-13f   , 3.82366567e-13f   , 3.36105458e-13f   , 2.98611713e-13f   , 2.67792866e-13f   , },
+/* x = 26.3        */  {0.172809282f      , 0.00328534757f    , 0.000187377238f   , 1.78115244e-5f    , 2.37035489e-6f    , 4.05573959e-7f    , 8.4815775e-8f     , 2.09620017e-8f    , 5.97768518e-9f    , 1.93187953e-9f    , 6.9775525e-10f    , 2.78499531e-10f   , 1.21705405e-10f   , 5.77728179e-11f   , 2.95832923e-11f   , 1.62382238e-11f   , 9.49809946e-12f   , 5.8869273e-12f    , 3.84520056e-12f   , 2.63284248e-12f   , 1.88015115e-12f   , 1.39356066e-12f   , 1.0672662e-12f    , 8.41104046e-13f   , 6.79600455e-13f   , 5.61131484e-13f   , 4.72106453e-13f   , 4.03740224e-13f   , 3.50205439e-13f   , 3.07543798e-13f   , 2.73007183e-13f   , 2.44648896e-13f   , },
+/* x = 26.4        */  {0.172481681f      , 0.00326669851f    , 0.00018560787f    , 1.75765028e-5f    , 2.33021811e-6f    , 3.97196203e-7f    , 8.27491441e-8f    , 2.03737774e-8f    , 5.78794009e-9f    , 1.86347646e-9f    , 6.70504317e-10f   , 2.66612991e-10f   , 1.16073373e-10f   , 5.4894121e-11f    , 2.80059951e-11f   , 1.53172184e-11f   , 8.92820164e-12f   , 5.51526382e-12f   , 3.59108918e-12f   , 2.45162074e-12f   , 1.74599401e-12f   , 1.29092859e-12f   , 9.86462211e-13f   , 7.75872627e-13f   , 6.25781983e-13f   , 5.15882431e-13f   , 4.33433318e-13f   , 3.70212899e-13f   , 3.20776224e-13f   , 2.81430303e-13f   , 2.49614831e-13f   , 2.23518559e-13f   , },
+/* x = 26.5        */  {0.172155937f      , 0.00324822522f    , 0.000183861805f   , 1.73454532e-5f    , 2.29090886e-6f    , 3.89022201e-7f    , 8.07403983e-8f    , 1.98041902e-8f    , 5.60490101e-9f    , 1.79773997e-9f    , 6.44414351e-10f   , 2.5527552e-10f    , 1.10721474e-10f   , 5.21686422e-11f   , 2.65180098e-11f   , 1.44513861e-11f   , 8.39422927e-12f   , 5.1681273e-12f    , 3.35444597e-12f   , 2.28331475e-12f   , 1.62170672e-12f   , 1.19605955e-12f   , 9.11919654e-13f   , 7.15803118e-13f   , 5.76300518e-13f   , 4.74337853e-13f   , 3.97970026e-13f   , 3.3950174e-13f    , 2.93844841e-13f   , 2.57553525e-13f   , 2.28242242e-13f   , 2.04225615e-13f   , },
+/* x = 26.6        */  {0.171832031f      , 0.00322992539f    , 0.00018213865f    , 1.71182941e-5f    , 2.25240706e-6f    , 3.81046255e-7f    , 7.87877068e-8f    , 1.92525824e-8f    , 5.428307e-9f      , 1.73455667e-9f    , 6.19431821e-10f   , 2.44459855e-10f   , 1.05634826e-10f   , 4.95877204e-11f   , 2.51139948e-11f   , 1.36372542e-11f   , 7.89381488e-12f   , 4.8438339e-12f    , 3.13402743e-12f   , 2.12697532e-12f   , 1.50654342e-12f   , 1.1083525e-12f    , 8.43143419e-13f   , 6.60479818e-13f   , 5.30801202e-13f   , 4.3619044e-13f    , 3.65447085e-13f   , 3.11367819e-13f   , 2.69197416e-13f   , 2.35720399e-13f   , 2.08713835e-13f   , 1.86609332e-13f   , },
+/* x = 26.7        */  {0.171509946f      , 0.00321179674f    , 0.000180438019f   , 1.68949456e-5f    , 2.21469319e-6f    , 3.7326285e-7f     , 7.68893036e-8f    , 1.87183223e-8f    , 5.25790818e-9f    , 1.67381839e-9f    , 5.95505848e-10f   , 2.34140182e-10f   , 1.00799384e-10f   , 4.71432115e-11f   , 2.3788944e-11f    , 1.28715782e-11f   , 7.42475332e-12f   , 4.54081949e-12f   , 2.92868134e-12f   , 1.98172493e-12f   , 1.39981599e-12f   , 1.02725387e-12f   , 7.79678241e-13f   , 6.09521018e-13f   , 4.88958601e-13f   , 4.01158669e-13f   , 3.35617858e-13f   , 2.85592658e-13f   , 2.46638533e-13f   , 2.15754641e-13f   , 1.90869388e-13f   , 1.70523111e-13f   , },
+/* x = 26.8        */  {0.171189666f      , 0.00319383705f    , 0.000178759536f   , 1.66753298e-5f    , 2.17774825e-6f    , 3.65666642e-7f    , 7.50434844e-8f    , 1.82008023e-8f    , 5.09346527e-9f    , 1.6154219e-9f     , 5.72588068e-10f   , 2.24292048e-10f   , 9.62018925e-11f   , 4.48274562e-11f   , 2.25381652e-11f   , 1.2151327e-11f    , 6.98499023e-12f   , 4.2576309e-12f    , 2.73733992e-12f   , 1.84675215e-12f   , 1.30088941e-12f   , 9.52253807e-13f   , 7.21105448e-13f   , 5.62576184e-13f   , 4.50474235e-13f   , 3.68984623e-13f   , 3.08256607e-13f   , 2.61976464e-13f   , 2.25989624e-13f   , 1.97495278e-13f   , 1.74562681e-13f   , 1.55833244e-13f   , },
+/* x = 26.9        */  {0.170871173f      , 0.00317604411f    , 0.000177102831f   , 1.64593709e-5f    , 2.14155379e-6f    , 3.58252455e-7f    , 7.32486046e-8f    , 1.76994383e-8f    , 4.93474903e-9f    , 1.5592687e-9f     , 5.50632494e-10f   , 2.1489229e-10f    , 9.18298413e-11f   , 4.26332496e-11f   , 2.13572591e-11f   , 1.14736675e-11f   , 6.57261139e-12f   , 3.99291776e-12f   , 2.5590134e-12f    , 1.7213066e-12f    , 1.20917764e-12f   , 8.82882576e-13f   , 6.67039966e-13f   , 5.19323381e-13f   , 4.15074318e-13f   , 3.39431989e-13f   , 2.83156707e-13f   , 2.40336522e-13f   , 2.07087512e-13f   , 1.80795308e-13f   , 1.59660271e-13f   , 1.42417769e-13f   , },
+/* x = 27.0        */  {0.170554451f      , 0.00315841577f    , 0.000175467542f   , 1.62469946e-5f    , 2.10609186e-6f    , 3.51015276e-7f    , 7.15030769e-8f    , 1.72136689e-8f    , 4.78153989e-9f    , 1.50526479e-9f    , 5.29595397e-10f   , 2.05918959e-10f   , 8.76714174e-11f   , 4.05538131e-11f   , 2.02421004e-11f   , 1.08359516e-11f   , 6.18583277e-12f   , 3.74542505e-12f   , 2.39278422e-12f   , 1.60469421e-12f   , 1.12413973e-12f   , 8.18707408e-13f   , 6.17127588e-13f   , 4.794669e-13f     , 3.82507695e-13f   , 3.12284226e-13f   , 2.60129013e-13f   , 2.2050572e-13f    , 1.8978307e-13f    , 1.65520485e-13f   , 1.46040367e-13f   , 1.30165436e-13f   , },
+/* x = 27.1        */  {0.170239484f      , 0.0031409499f     , 0.000173853315f   , 1.60381287e-5f    , 2.071345e-6f      , 3.43950246e-7f    , 6.9805369e-8f     , 1.67429538e-8f    , 4.63362743e-9f    , 1.4533204e-9f     , 5.09435183e-10f   , 1.97351258e-10f   , 8.3715466e-11f    , 3.85827672e-11f   , 1.91888201e-11f   , 1.02357032e-11f   , 5.82299135e-12f   , 3.5139861e-12f    , 2.23780158e-12f   , 1.49627288e-12f   , 1.04527628e-12f   , 7.59329512e-13f   , 5.71042454e-13f   , 4.42735101e-13f   , 3.52543943e-13f   , 2.87342901e-13f   , 2.39000368e-13f   , 2.02331208e-13f   , 1.73940008e-13f   , 1.51548201e-13f   , 1.33591805e-13f   , 1.18974762e-13f   , },
+/* x = 27.2        */  {0.169926256f      , 0.00312364441f    , 0.000172259802f   , 1.58327024e-5f    , 2.03729623e-6f    , 3.37052657e-7f    , 6.81540017e-8f    , 1.62867736e-8f    , 4.49081002e-9f    , 1.40334984e-9f    , 4.90112283e-10f   , 1.89169469e-10f   , 7.99514514e-11f   , 3.67141077e-11f   , 1.81937882e-11f   , 9.67060718e-12f   , 5.48253666e-12f   , 3.29751621e-12f   , 2.09327646e-12f   , 1.39544855e-12f   , 9.72126199e-13f   , 7.04381363e-13f   , 5.28484753e-13f   , 4.08878416e-13f   , 3.24971645e-13f   , 2.6442615e-13f    , 2.19612236e-13f   , 1.8567317e-13f    , 1.59433756e-13f   , 1.38766471e-13f   , 1.22213121e-13f   , 1.08753167e-13f   , },
+/* x = 27.3        */  {0.16961475f       , 0.00310649726f    , 0.000170686662f   , 1.56306467e-5f    , 2.00392904e-6f    , 3.30317948e-7f    , 6.65475465e-8f    , 1.58446284e-8f    , 4.3528944e-9f     , 1.35527129e-9f    , 4.71589049e-10f   , 1.81354902e-10f   , 7.63694204e-11f   , 3.49421817e-11f   , 1.72535992e-11f   , 9.13849795e-12f   , 5.16302284e-12f   , 3.09500668e-12f   , 1.95847701e-12f   , 1.30167143e-12f   , 9.04263673e-13f   , 6.53524201e-13f   , 4.89178598e-13f   , 3.77667541e-13f   , 2.99596799e-13f   , 2.43367289e-13f   , 2.0181946e-13f    , 1.70403703e-13f   , 1.46150448e-13f   , 1.2707301e-13f    , 1.11811693e-13f   , 9.94161915e-14f   , },
+/* x = 27.4        */  {0.169304951f      , 0.00308950641f    , 0.000169133563f   , 1.54318944e-5f    , 1.97122736e-6f    , 3.23741697e-7f    , 6.49846242e-8f    , 1.54160375e-8f    , 4.2196953e-9f     , 1.30900657e-9f    , 4.53829654e-10f   , 1.73889833e-10f   , 7.29599684e-11f   , 3.32616665e-11f   , 1.63650567e-11f   , 8.63734963e-12f   , 4.86310133e-12f   , 2.90551931e-12f   , 1.83272427e-12f   , 1.2144327e-12f    , 8.41295429e-13f   , 6.06445744e-13f   , 4.52870094e-13f   , 3.48891759e-13f   , 2.76241365e-13f   , 2.24013523e-13f   , 1.85489121e-13f   , 1.56405795e-13f   , 1.33986002e-13f   , 1.16374384e-13f   , 1.02302971e-13f   , 9.08867772e-14f   , },
+/* x = 27.5        */  {0.168996844f      , 0.00307266989f    , 0.000167600176f   , 1.52363796e-5f    , 1.93917556e-6f    , 3.17319617e-7f    , 6.34639026e-8f    , 1.50005381e-8f    , 4.09103511e-9f    , 1.26448103e-9f    , 4.36799994e-10f   , 1.66757452e-10f   , 6.97142075e-11f   , 3.1667549e-11f    , 1.55251606e-11f   , 8.16526663e-12f   , 4.58151407e-12f   , 2.72818132e-12f   , 1.71538826e-12f   , 1.13326134e-12f   , 7.82858189e-13f   , 5.62858071e-13f   , 4.19325549e-13f   , 3.22357416e-13f   , 2.5474194e-13f    , 2.06224785e-13f   , 1.70499495e-13f   , 1.43572388e-13f   , 1.22845264e-13f   , 1.0658524e-13f    , 9.36097688e-14f   , 8.30946189e-14f   , },
+/* x = 27.6        */  {0.168690412f      , 0.00305598573f    , 0.000166086181f   , 1.50440381e-5f    , 1.90775844e-6f    , 3.11047553e-7f    , 6.19840951e-8f    , 1.45976849e-8f    , 3.9667435e-9f     , 1.22162333e-9f    , 4.20467606e-10f   , 1.59941816e-10f   , 6.66237364e-11f   , 3.01551069e-11f   , 1.47310938e-11f   , 7.72047489e-12f   , 4.31708722e-12f   , 2.56218063e-12f   , 1.60588433e-12f   , 1.05772125e-12f   , 7.28616328e-13f   , 5.22495692e-13f   , 3.88329845e-13f   , 2.97886517e-13f   , 2.34948533e-13f   , 1.8987266e-13f    , 1.56739101e-13f   , 1.31805527e-13f   , 1.12641244e-13f   , 9.7627602e-14f    , 8.56616166e-14f   , 7.59755675e-14f   , },
+/* x = 27.7        */  {0.168385642f      , 0.00303945202f    , 0.000164591264f   , 1.48548072e-5f    , 1.87696119e-6f    , 3.04921475e-7f    , 6.05439584e-8f    , 1.42070492e-8f    , 3.84665713e-9f    , 1.1803653e-9f     , 4.04801578e-10f   , 1.53427794e-10f   , 6.36806122e-11f   , 2.8719891e-11f    , 1.39802114e-11f   , 7.30131377e-12f   , 4.06872528e-12f   , 2.40676151e-12f   , 1.50366979e-12f   , 9.87408592e-13f   , 6.78259724e-13f   , 4.8511376e-13f    , 3.59684933e-13f   , 2.75315444e-13f   , 2.16723456e-13f   , 1.74839404e-13f   , 1.44105834e-13f   , 1.21015574e-13f   , 1.03294408e-13f   , 8.94302321e-14f   , 7.83941752e-14f   , 6.94710884e-14f   , },
+/* x = 27.8        */  {0.168082517f      , 0.00302306685f    , 0.000163115118f   , 1.46686257e-5f    , 1.84676941e-6f    , 2.98937479e-7f    , 5.91422917e-8f    , 1.38282185e-8f    , 3.7306193e-9f     , 1.14064179e-9f    , 3.89772473e-10f   , 1.47201032e-10f   , 6.0877324e-11f    , 2.73577082e-11f   , 1.32700287e-11f   , 6.9062285e-12f    , 3.8354057e-12f    , 2.26122053e-12f   , 1.40824086e-12f   , 9.2194937e-13f    , 6.31501775e-13f   , 4.5048644e-13f    , 3.33208456e-13f   , 2.54493773e-13f   , 1.99940299e-13f   , 1.61017049e-13f   , 1.32506165e-13f   , 1.11120503e-13f   , 9.47320314e-14f   , 8.19280405e-14f   , 7.17486988e-14f   , 6.35277678e-14f   , },
+/* x = 27.9        */  {0.167781023f      , 0.00300682838f    , 0.00016165744f    , 1.44854336e-5f    , 1.81716908e-6f    , 2.93091774e-7f    , 5.77779345e-8f    , 1.34607954e-8f    , 3.6184797e-9f     , 1.10239051e-9f    , 3.75352251e-10f   , 1.41247905e-10f   , 5.82067681e-11f   , 2.60646065e-11f   , 1.25982118e-11f   , 6.53376312e-12f   , 3.61617378e-12f   , 2.12490279e-12f   , 1.31912972e-12f   , 8.60997134e-13f   , 5.88077578e-13f   , 4.184054e-13f     , 3.08732487e-13f   , 2.352832e-13f     , 1.84482993e-13f   , 1.48306582e-13f   , 1.21854413e-13f   , 1.02045242e-13f   , 8.68876153e-14f   , 7.50615534e-14f   , 6.56715459e-14f   , 5.80968621e-14f   , },
+/* x = 28.0        */  {0.167481146f      , 0.00299073476f    , 0.000160217933f   , 1.43051726e-5f    , 1.78814656e-6f    , 2.87380686e-7f    , 5.64497652e-8f    , 1.31043974e-8f    , 3.51009411e-9f    , 1.06555193e-9f    , 3.61514202e-10f   , 1.35555479e-10f   , 5.56622245e-11f   , 2.48368602e-11f   , 1.19625676e-11f   , 6.18255393e-12f   , 3.41013807e-12f   , 1.99719851e-12f   , 1.23590192e-12f   , 8.04230913e-13f   , 5.47742243e-13f   , 3.88678428e-13f   , 2.86102364e-13f   , 2.17556542e-13f   , 1.70244955e-13f   , 1.36617193e-13f   , 1.12072086e-13f   , 9.37210811e-14f   , 7.97003473e-14f   , 6.87764247e-14f   , 6.0113733e-14f    , 5.31338875e-14f   , },
+/* x = 28.1        */  {0.167182872f      , 0.00297478419f    , 0.000158796309f   , 1.41277855e-5f    , 1.75968858e-6f    , 2.8180065e-7f     , 5.51566998e-8f    , 1.27586561e-8f    , 3.40532412e-9f    , 1.03006912e-9f    , 3.48232875e-10f   , 1.30111472e-10f   , 5.32373349e-11f   , 2.36709561e-11f   , 1.13610351e-11f   , 5.85132344e-12f   , 3.21646594e-12f   , 1.87753977e-12f   , 1.15815394e-12f   , 7.5135329e-13f    , 5.10269351e-13f   , 3.6112816e-13f    , 2.65175624e-13f   , 2.01196838e-13f   , 1.57128302e-13f   , 1.25865588e-13f   , 1.03087263e-13f   , 8.6085127e-14f    , 7.31146119e-14f   , 6.30229909e-14f   , 5.50305279e-14f   , 4.85982457e-14f   , },
+/* x = 28.2        */  {0.166886185f      , 0.00295897491f    , 0.000157392282f   , 1.39532165e-5f    , 1.73178218e-6f    , 2.7634821e-7f     , 5.38976906e-8f    , 1.24232165e-8f    , 3.30403691e-9f    , 9.95887612e-10f   , 3.35484016e-10f   , 1.24904224e-10f   , 5.09260825e-11f   , 2.25635808e-11f   , 1.07916769e-11f   , 5.53887461e-12f   , 3.0343796e-12f    , 1.76539758e-12f   , 1.08551086e-12f   , 7.02088625e-13f   , 4.75449524e-13f   , 3.3559091e-13f    , 2.45821027e-13f   , 1.86096507e-13f   , 1.45043132e-13f   , 1.15975359e-13f   , 9.48340447e-14f   , 7.90798079e-14f   , 6.70795432e-14f   , 5.77558646e-14f   , 5.03810782e-14f   , 4.44528824e-14f   , },
+/* x = 28.3        */  {0.166591072f      , 0.00294330516f    , 0.000156005574f   , 1.37814111e-5f    , 1.70441479e-6f    , 2.71020011e-7f    , 5.26717245e-8f    , 1.20977369e-8f    , 3.20610496e-9f    , 9.62955337e-10f   , 3.23244508e-10f   , 1.19922658e-10f   , 4.87227721e-11f   , 2.1511609e-11f    , 1.02526716e-11f   , 5.24408561e-12f   , 2.86315234e-12f   , 1.66027908e-12f   , 1.01762432e-12f   , 6.5618142e-13f    , 4.43089117e-13f   , 3.11915591e-13f   , 2.27917651e-13f   , 1.72156589e-13f   , 1.33906861e-13f   , 1.0687641e-13f    , 8.72520419e-14f   , 7.26524181e-14f   , 6.15486155e-14f   , 5.2933564e-14f    , 4.61280728e-14f   , 4.06639767e-14f   , },
+/* x = 28.4        */  {0.166297519f      , 0.00292777323f    , 0.00015463591f    , 1.3612316e-5f     , 1.67757415e-6f    , 2.65812797e-7f    , 5.14778222e-8f    , 1.17818878e-8f    , 3.11140586e-9f    , 9.31222468e-10f   , 3.11492313e-10f   , 1.15156252e-10f   , 4.66220124e-11f   , 2.0512092e-11f    , 9.74230628e-12f   , 4.96590486e-12f   , 2.70210501e-12f   , 1.56172499e-12f   , 9.54170571e-13f   , 6.13394807e-13f   , 4.13009003e-13f   , 2.89962729e-13f   , 2.11354071e-13f   , 1.59286041e-13f   , 1.23643623e-13f   , 9.8504427e-14f    , 8.02859098e-14f   , 6.67547028e-14f   , 5.64792703e-14f   , 4.85181744e-14f   , 4.22374329e-14f   , 3.72006569e-14f   , },
+/* x = 28.5        */  {0.166005513f      , 0.00291237742f    , 0.000153283022f   , 1.34458791e-5f    , 1.65124831e-6f    , 2.60723409e-7f    , 5.03150365e-8f    , 1.14753519e-8f    , 3.01982208e-9f    , 9.00641332e-10f   , 3.0020642e-10f    , 1.10595008e-10f   , 4.46186982e-11f   , 1.95622469e-11f   , 9.25896996e-12f   , 4.70334648e-12f   , 2.55060283e-12f   , 1.46930726e-12f   , 8.94848676e-13f   , 5.73509148e-13f   , 3.8504346e-13f    , 2.69603549e-13f   , 1.96027597e-13f   , 1.47401093e-13f   , 1.14183716e-13f   , 9.0800395e-14f    , 7.38849224e-14f   , 6.13424793e-14f   , 5.18325754e-14f   , 4.44750392e-14f   , 3.86780306e-14f   , 3.40347421e-14f   , },
+/* x = 28.6        */  {0.165715039f      , 0.00289711607f    , 0.000151946647f   , 1.32820496e-5f    , 1.62542564e-6f    , 2.55748783e-7f    , 4.91824516e-8f    , 1.11778233e-8f    , 2.93124073e-9f    , 8.71166309e-10f   , 2.8936679e-10f    , 1.06229425e-10f   , 4.2707995e-11f    , 1.86594476e-11f   , 8.80114712e-12f   , 4.45548595e-12f   , 2.40805234e-12f   , 1.38262687e-12f   , 8.39378849e-13f   , 5.36320753e-13f   , 3.59039144e-13f   , 2.50719136e-13f   , 1.81843576e-13f   , 1.36424661e-13f   , 1.0546309e-13f    , 8.37101585e-14f   , 6.80025832e-14f   , 5.637529e-14f     , 4.7572913e-14f    , 4.07724776e-14f   , 3.5421431e-14f    , 3.11405065e-14f   , },
+/* x = 28.7        */  {0.165426085f      , 0.00288198755f    , 0.000150626527f   , 1.31207776e-5f    , 1.60009482e-6f    , 2.50885942e-7f    , 4.80791815e-8f    , 1.08890072e-8f    , 2.8455534e-9f     , 8.42753737e-10f   , 2.78954314e-10f   , 1.02050475e-10f   , 4.08853233e-11f   , 1.78012147e-11f   , 8.3674118e-12f    , 4.22145616e-12f   , 2.27389864e-12f   , 1.30131178e-12f   , 7.87500929e-13f   , 5.01640687e-13f   , 3.34854144e-13f   , 2.33199668e-13f   , 1.68714752e-13f   , 1.262858e-13f     , 9.74228856e-14f   , 7.71840148e-14f   , 6.25962684e-14f   , 5.1816085e-14f    , 4.36676956e-14f   , 3.73815279e-14f   , 3.24416585e-14f   , 2.84944638e-14f   , },
+/* x = 28.8        */  {0.165138637f      , 0.00286699023f    , 0.000149322408f   , 1.29620146e-5f    , 1.57524482e-6f    , 2.46131998e-7f    , 4.70043692e-8f    , 1.06086196e-8f    , 2.76265596e-9f    , 8.15361817e-10f   , 2.68950761e-10f   , 9.80495711e-11f   , 3.91463447e-11f   , 1.69852072e-11f   , 7.95642204e-12f   , 4.00044366e-12f   , 2.14762274e-12f   , 1.22501504e-12f   , 7.38972957e-13f   , 4.6929367e-13f    , 3.12357103e-13f   , 2.16943701e-13f   , 1.56560679e-13f   , 1.16919211e-13f   , 9.00090084e-14f   , 7.11763435e-14f   , 5.7626901e-14f    , 4.76309328e-14f   , 4.00871055e-14f   , 3.42757117e-14f   , 2.9714982e-14f    , 2.60751715e-14f   , },
+/* x = 28.9        */  {0.164852683f      , 0.00285212254f    , 0.000148034042f   , 1.2805713e-5f     , 1.55086489e-6f    , 2.41484147e-7f    , 4.59571857e-8f    , 1.03363864e-8f    , 2.68244835e-9f    , 7.88950534e-10f   , 2.59338738e-10f   , 9.42185531e-11f   , 3.74869482e-11f   , 1.62092143e-11f   , 7.56691465e-12f   , 3.79168523e-12f   , 2.02873916e-12f   , 1.15341304e-12f   , 6.93569861e-13f   , 4.39117065e-13f   , 2.91426418e-13f   , 2.0185752e-13f    , 1.45307177e-13f   , 1.08264782e-13f   , 8.31717342e-14f   , 6.56452673e-14f   , 5.30586523e-14f   , 4.3788755e-14f    , 3.68038581e-14f   , 3.14308197e-14f   , 2.72197203e-14f   , 2.38630521e-14f   , },
+/* x = 29.0        */  {0.164568209f      , 0.00283738291f    , 0.000146761185f   , 1.26518263e-5f    , 1.52694455e-6f    , 2.36939667e-7f    , 4.49368289e-8f    , 1.00720435e-8f    , 2.60483444e-9f    , 7.63481572e-10f   , 2.50101647e-10f   , 9.05496589e-11f   , 3.59032377e-11f   , 1.54711479e-11f   , 7.19770045e-12f   , 3.59446459e-12f   , 1.91679372e-12f   , 1.0862039e-12f    , 6.5108224e-13f    , 4.10959937e-13f   , 2.71949499e-13f   , 1.87854533e-13f   , 1.34885834e-13f   , 1.00267172e-13f   , 7.68653534e-14f   , 6.05523406e-14f   , 4.8858669e-14f    , 4.02610844e-14f   , 3.37929841e-14f   , 2.8824716e-14f    , 2.49360634e-14f   , 2.18402294e-14f   , },
+/* x = 29.1        */  {0.164285202f      , 0.00282276979f    , 0.000145503598f   , 1.25003091e-5f    , 1.5034736e-6f     , 2.32495913e-7f    , 4.39425225e-8f    , 9.81533613e-9f    , 2.52972185e-9f    , 7.38918236e-10f   , 2.41223648e-10f   , 8.7035506e-11f    , 3.43915202e-11f   , 1.47690352e-11f   , 6.8476596e-12f    , 3.40810942e-12f   , 1.81136137e-12f   , 1.02310592e-12f   , 6.11315239e-13f   , 3.8468219e-13f    , 2.53822079e-13f   , 1.74854723e-13f   , 1.25233551e-13f   , 9.28754198e-14f   , 7.1047841e-14f    , 5.5862265e-14f    , 4.49968235e-14f   , 3.7021843e-14f    , 3.10316319e-14f   , 2.64371586e-14f   , 2.28459102e-14f   , 1.99903804e-14f   , },
+/* x = 29.2        */  {0.16400365f       , 0.00280828169f    , 0.000144261046f   , 1.23511169e-5f    , 1.48044209e-6f    , 2.28150319e-7f    , 4.29735154e-8f    , 9.56601869e-9f    , 2.45702178e-9f    , 7.15225378e-10f   , 2.32689622e-10f   , 8.3669072e-11f    , 3.29482945e-11f   , 1.41010121e-11f   , 6.51573746e-12f   , 3.2319885e-12f    , 1.71204428e-12f   , 9.63856224e-13f   , 5.74087502e-13f   , 3.60153764e-13f   , 2.36947587e-13f   , 1.62784133e-13f   , 1.16292123e-13f   , 8.60425993e-14f   , 6.56805554e-14f   , 5.15426282e-14f   , 4.14454847e-14f   , 3.40471398e-14f   , 2.84988863e-14f   , 2.42496368e-14f   , 2.09327199e-14f   , 1.8298599e-14f    , },
+/* x = 29.3        */  {0.163723542f      , 0.00279391709f    , 0.000143033298f   , 1.22042063e-5f    , 1.45784034e-6f    , 2.23900391e-7f    , 4.20290804e-8f    , 9.32385421e-9f    , 2.38664889e-9f    , 6.92369328e-10f   , 2.24485133e-10f   , 8.04436749e-11f   , 3.15702403e-11f   , 1.34653169e-11f   , 6.20094055e-12f   , 3.06550916e-12f   , 1.61847004e-12f   , 9.0820942e-13f    , 5.3923021e-13f    , 3.37253898e-13f   , 2.21236563e-13f   , 1.51574398e-13f   , 1.08007845e-13f   , 7.97254888e-14f   , 6.07279622e-14f   , 4.75636649e-14f   , 3.81793093e-14f   , 3.13150854e-14f   , 2.61756026e-14f   , 2.22452212e-14f   , 1.91813766e-14f   , 1.67512728e-14f   , },
+/* x = 29.4        */  {0.163444863f      , 0.00277967454f    , 0.00014182013f    , 1.20595348e-5f    , 1.43565891e-6f    , 2.19743707e-7f    , 4.11085137e-8f    , 9.08861408e-9f    , 2.3185211e-9f     , 6.70317827e-10f   , 2.16596398e-10f   , 7.73529566e-11f   , 3.02542091e-11f   , 1.28602844e-11f   , 5.90233284e-12f   , 2.90811472e-12f   , 1.53028995e-12f   , 8.55936419e-13f   , 5.06586184e-13f   , 3.15870439e-13f   , 2.06606124e-13f   , 1.41162315e-13f   , 1.00331165e-13f   , 7.3884276e-14f    , 5.61573804e-14f   , 4.38980379e-14f   , 3.51750498e-14f   , 2.8805623e-14f    , 2.40442561e-14f   , 2.04084284e-14f   , 1.75780657e-14f   , 1.53359694e-14f   , },
+/* x = 29.5        */  {0.163167603f      , 0.00276555259f    , 0.000140621318f   , 1.19170608e-5f    , 1.41388857e-6f    , 2.15677915e-7f    , 4.02111341e-8f    , 8.86007778e-9f    , 2.25255953e-9f    , 6.49039962e-10f   , 2.09010254e-10f   , 7.43908654e-11f   , 2.8997214e-11f    , 1.22843401e-11f   , 5.61903225e-12f   , 2.75928227e-12f   , 1.44717745e-12f   , 8.06823298e-13f   , 4.76009056e-13f   , 2.9589922e-13f    , 1.92979465e-13f   , 1.3148944e-13f    , 9.32163524e-14f   , 6.84822837e-14f   , 5.19387494e-14f   , 4.05206373e-14f   , 3.24113793e-14f   , 2.65003726e-14f   , 2.20888029e-14f   , 1.87250957e-14f   , 1.61101615e-14f   , 1.40413344e-14f   , },
+/* x = 29.6        */  {0.162891749f      , 0.00275154981f    , 0.000139436646f   , 1.17767437e-5f    , 1.39252037e-6f    , 2.11700729e-7f    , 3.93362818e-8f    , 8.6380325e-9f     , 2.18868831e-9f    , 6.28506109e-10f   , 2.0171413e-10f    , 7.15516406e-11f   , 2.77964212e-11f   , 1.17359954e-11f   , 5.35020739e-12f   , 2.61852053e-12f   , 1.36882664e-12f   , 7.60670265e-13f   , 4.47362499e-13f   , 2.77243465e-13f   , 1.80285402e-13f   , 1.22501726e-13f   , 8.66211972e-14f   , 6.34857187e-14f   , 4.80444163e-14f   , 3.74083964e-14f   , 2.98687312e-14f   , 2.43824903e-14f   , 2.02945546e-14f   , 1.71822683e-14f   , 1.47661233e-14f   , 1.28569965e-14f   , },
+/* x = 29.7        */  {0.162617289f      , 0.00273766479f    , 0.000138265899f   , 1.16385437e-5f    , 1.37154555e-6f    , 2.07809929e-7f    , 3.84833181e-8f    , 8.42227288e-9f    , 2.12683446e-9f    , 6.0868787e-10f    , 1.94696014e-10f   , 6.88297976e-11f   , 2.66491419e-11f   , 1.12138423e-11f   , 5.09507454e-12f   , 2.48536779e-12f   , 1.29495096e-12f   , 7.17290689e-13f   , 4.20519519e-13f   , 2.59813257e-13f   , 1.68457952e-13f   , 1.14149181e-13f   , 8.05067352e-14f   , 5.88634408e-14f   , 4.44489397e-14f   , 3.45401237e-14f   , 2.75291517e-14f   , 2.24365378e-14f   , 1.86480619e-14f   , 1.57680948e-14f   , 1.35354023e-14f   , 1.17734822e-14f   , },
+/* x = 29.8        */  {0.162344212f      , 0.00272389617f    , 0.000137108868f   , 1.15024218e-5f    , 1.35095558e-6f    , 2.04003357e-7f    , 3.76516243e-8f    , 8.21260071e-9f    , 2.06692779e-9f    , 5.89558023e-10f   , 1.87944432e-10f   , 6.62201136e-11f   , 2.55528242e-11f   , 1.07165488e-11f   , 4.85289469e-12f   , 2.35939013e-12f   , 1.22528188e-12f   , 6.76510196e-13f   , 3.95361788e-13f   , 2.43525032e-13f   , 1.57435939e-13f   , 1.06385558e-13f   , 7.48369919e-14f   , 5.45867512e-14f   , 4.11289101e-14f   , 3.18963478e-14f   , 2.53761657e-14f   , 2.06483643e-14f   , 1.71370096e-14f   , 1.4471733e-14f    , 1.24083554e-14f   , 1.07821378e-14f   , },
+/* x = 29.9        */  {0.162072506f      , 0.00271024257f    , 0.000135965346f   , 1.136834e-5f      , 1.33074214e-6f    , 2.00278915e-7f    , 3.68406014e-8f    , 8.00882467e-9f    , 2.00890078e-9f    , 5.71090465e-10f   , 1.81448418e-10f   , 6.37176149e-11f   , 2.45050456e-11f   , 1.02428549e-11f   , 4.62297097e-12f   , 2.2401796e-12f    , 1.15956773e-12f   , 6.3816584e-13f    , 3.71779041e-13f   , 2.28301117e-13f   , 1.47162639e-13f   , 9.91680683e-14f   , 6.95787494e-14f   , 5.06291972e-14f   , 3.8062785e-14f    , 2.94591762e-14f   , 2.33946531e-14f   , 1.90049981e-14f   , 1.57501199e-14f   , 1.32832627e-14f   , 1.13761667e-14f   , 9.87505754e-15f   , },
+/* x = 30.0        */  {0.161802159f      , 0.00269670266f    , 0.000134835133f   , 1.12362611e-5f    , 1.31089712e-6f    , 1.96634567e-7f    , 3.6049669e-8f     , 7.81076006e-9f    , 1.95268846e-9f    , 5.5326017e-10f    , 1.75197494e-10f   , 6.13175633e-11f   , 2.35035063e-11f   , 9.79156804e-12f   , 4.40464601e-12f   , 2.12735264e-12f   , 1.09757259e-12f   , 6.02105322e-13f   , 3.496685e-13f     , 2.14069305e-13f   , 1.37585444e-13f   , 9.24571164e-14f   , 6.47013296e-14f   , 4.69663934e-14f   , 3.52307377e-14f   , 2.72121653e-14f   , 2.15707366e-14f   , 1.74945469e-14f   , 1.44770641e-14f   , 1.21936071e-14f   , 1.04307765e-14f   , 9.04501893e-15f   , },
+/* x = 30.1        */  {0.161533161f      , 0.00268327511f    , 0.000133718029f   , 1.11061486e-5f    , 1.29141262e-6f    , 1.93068331e-7f    , 3.5278265e-8f     , 7.61822857e-9f    , 1.8982283e-9f     , 5.36043131e-10f   , 1.69181642e-10f   , 5.90154452e-11f   , 2.25460227e-11f   , 9.36155975e-12f   , 4.1972997e-12f    , 2.02054851e-12f   , 1.03907529e-12f   , 5.68186267e-13f   , 3.28934353e-13f   , 2.00762455e-13f   , 1.28655556e-13f   , 8.62160552e-14f   , 6.0176397e-14f    , 4.3575857e-14f    , 3.26145184e-14f   , 2.51402014e-14f   , 1.98916777e-14f   , 1.61061071e-14f   , 1.33083823e-14f   , 1.11944604e-14f   , 9.56481546e-15f   , 8.28542307e-15f   , },
+/* x = 30.2        */  {0.161265501f      , 0.00266995862f    , 0.000132613839f   , 1.09779668e-5f    , 1.27228092e-6f    , 1.89578281e-7f    , 3.45258446e-8f    , 7.43105801e-9f    , 1.84546016e-9f    , 5.19416325e-10f   , 1.63391284e-10f   , 5.68069595e-11f   , 2.16305208e-11f   , 8.95176169e-12f   , 4.00034688e-12f   , 1.91942791e-12f   , 9.83868403e-13f   , 5.36275556e-13f   , 3.09487263e-13f   , 1.88318129e-13f   , 1.20327704e-13f   , 8.04109622e-14f   , 5.59777755e-14f   , 4.04368569e-14f   , 3.01973268e-14f   , 2.3229392e-14f    , 1.83457824e-14f   , 1.48296809e-14f   , 1.22354092e-14f   , 1.02782216e-14f   , 8.77154534e-15f   , 7.59024054e-15f   , },
+/* x = 30.3        */  {0.160999166f      , 0.00265675191f    , 0.000131522372f   , 1.08516809e-5f    , 1.25349449e-6f    , 1.86162547e-7f    , 3.37918802e-8f    , 7.24908207e-9f    , 1.7943261e-9f     , 5.03357664e-10f   , 1.57817265e-10f   , 5.46880074e-11f   , 2.07550305e-11f   , 8.56116237e-12f   , 3.81323533e-12f   , 1.82367164e-12f   , 9.31757392e-13f   , 5.06248696e-13f   , 2.91243917e-13f   , 1.7667825e-13f    , 1.12559881e-13f   , 7.50104313e-14f   , 5.208128e-14f     , 3.75302744e-14f   , 2.7963695e-14f    , 2.1466965e-14f    , 1.69223142e-14f   , 1.36561003e-14f   , 1.12502069e-14f   , 9.43793429e-15f   , 8.04480441e-15f   , 6.95396193e-15f   , },
+/* x = 30.4        */  {0.160734147f      , 0.00264365373f    , 0.000130443441f   , 1.07272566e-5f    , 1.23504599e-6f    , 1.82819307e-7f    , 3.30758604e-8f    , 7.07214018e-9f    , 1.74477039e-9f    , 4.87845953e-10f   , 1.52450829e-10f   , 5.26546822e-11f   , 1.99176803e-11f   , 8.18880399e-12f   , 3.63544378e-12f   , 1.73297933e-12f   , 8.82559759e-13f   , 4.77989244e-13f   , 2.74126604e-13f   , 1.65788788e-13f   , 1.05313104e-13f   , 6.99853821e-14f   , 4.84645626e-14f   , 3.48384753e-14f   , 2.58993802e-14f   , 1.98411777e-14f   , 1.56114152e-14f   , 1.25769569e-14f   , 1.03455034e-14f   , 8.66723146e-15f   , 7.37895779e-15f   , 6.37155267e-15f   , },
+/* x = 30.5        */  {0.160470432f      , 0.00263066282f    , 0.00012937686f    , 1.06046606e-5f    , 1.21692827e-6f    , 1.79546793e-7f    , 3.23772896e-8f    , 6.90007718e-9f    , 1.69673936e-9f    , 4.72860858e-10f   , 1.47283599e-10f   , 5.07032594e-11f   , 1.9116692e-11f    , 7.83377938e-12f   , 3.46648011e-12f   , 1.6470683e-12f    , 8.36104269e-13f   , 4.51388263e-13f   , 2.58062825e-13f   , 1.5559947e-13f    , 9.85511883e-14f   , 6.53088831e-14f   , 4.51069692e-14f   , 3.23451928e-14f   , 2.39912657e-14f   , 1.83412323e-14f   , 1.44040327e-14f   , 1.1584539e-14f    , 9.51463595e-15f   , 7.96028519e-15f   , 6.76885204e-15f   , 5.83841183e-15f   , },
+/* x = 30.6        */  {0.160208011f      , 0.00261777795f    , 0.000128322449f   , 1.04838602e-5f    , 1.19913433e-6f    , 1.76343283e-7f    , 3.16956874e-8f    , 6.73274321e-9f    , 1.65018132e-9f    , 4.58382861e-10f   , 1.42307565e-10f   , 4.88301882e-11f   , 1.83503754e-11f   , 7.49522922e-12f   , 3.30587963e-12f   , 1.56567244e-12f   , 7.92230229e-13f   , 4.26343821e-13f   , 2.42984935e-13f   , 1.46063511e-13f   , 9.22405424e-14f   , 6.09559888e-14f   , 4.19894084e-14f   , 3.00354192e-14f   , 2.22272709e-14f   , 1.69571985e-14f   , 1.3291853e-14f    , 1.06717726e-14f   , 8.7514995e-15f    , 7.31176059e-15f   , 6.20977371e-15f   , 5.35033452e-15f   , },
+/* x = 30.7        */  {0.159946873f      , 0.00260499793f    , 0.000127280029f   , 1.03648232e-5f    , 1.18165737e-6f    , 1.73207105e-7f    , 3.10305881e-8f    , 6.56999347e-9f    , 1.60504651e-9f    , 4.44393228e-10f   , 1.37515063e-10f   , 4.70320823e-11f   , 1.76171242e-11f   , 7.17233934e-12f   , 3.15320348e-12f   , 1.48854124e-12f   , 7.50786807e-13f   , 4.02760522e-13f   , 2.28829799e-13f   , 1.37137362e-13f   , 8.63499759e-14f   , 5.69035901e-14f   , 3.90942312e-14f   , 2.78953065e-14f   , 2.05962675e-14f   , 1.56799435e-14f   , 1.226724e-14f     , 9.8321684e-15f    , 8.0504997e-15f    , 6.71677366e-15f   , 5.69741149e-15f   , 4.90347753e-15f   , },
+/* x = 30.8        */  {0.159687008f      , 0.00259232155f    , 0.000126249426f   , 1.02475184e-5f    , 1.16449072e-6f    , 1.70136631e-7f    , 3.03815405e-8f    , 6.41168806e-9f    , 1.561287e-9f      , 4.30873975e-10f   , 1.32898758e-10f   , 4.53057121e-11f   , 1.69154112e-11f   , 6.86433822e-12f   , 3.0080371e-12f    , 1.41543879e-12f   , 7.11632402e-13f   , 3.80549071e-13f   , 2.1553849e-13f    , 1.28780481e-13f   , 8.08505233e-14f   , 5.31302751e-14f   , 3.64051188e-14f   , 2.59120753e-14f   , 1.90880037e-14f   , 1.45010661e-14f   , 1.13231795e-14f   , 9.05977281e-15f   , 7.40650965e-15f   , 6.17085292e-15f   , 5.22782162e-15f   , 4.49432806e-15f   , },
+/* x = 30.9        */  {0.159428405f      , 0.00257974765f    , 0.000125230469f   , 1.01319149e-5f    , 1.1476279e-6f     , 1.67130277e-7f    , 2.97481069e-8f    , 6.25769177e-9f    , 1.51885661e-9f    , 4.17807837e-10f   , 1.28451632e-10f   , 4.36479972e-11f   , 1.62437846e-11f   , 6.57049467e-12f   , 2.86998885e-12f   , 1.3461429e-12f    , 6.74634057e-13f   , 3.59625868e-13f   , 2.03055989e-13f   , 1.20955119e-13f   , 7.57152811e-14f   , 4.96162018e-14f   , 3.39069809e-14f   , 2.40739302e-14f   , 1.76930334e-14f   , 1.34128379e-14f   , 1.04532277e-14f   , 8.34912321e-15f   , 6.81483043e-15f   , 5.66990419e-15f   , 4.7973963e-15f    , 4.11967506e-15f   , },
+/* x = 31.0        */  {0.159171055f      , 0.00256727507f    , 0.000124222987f   , 1.00179829e-5f    , 1.13106258e-6f    , 1.64186503e-7f    , 2.91298629e-8f    , 6.10787392e-9f    , 1.47771088e-9f    , 4.05178234e-10f   , 1.24166968e-10f   , 4.20559984e-11f   , 1.56008635e-11f   , 6.29011554e-12f   , 2.73868863e-12f   , 1.28044428e-12f   , 6.39666902e-13f   , 3.39912629e-13f   , 1.91330923e-13f   , 1.13626119e-13f   , 7.09192561e-14f   , 4.63429795e-14f   , 3.15858604e-14f   , 2.2369983e-14f    , 1.64026521e-14f   , 1.24081481e-14f   , 9.65146424e-15f   , 7.695207e-15f     , 6.27115506e-15f   , 5.2101785e-15f    , 4.40283485e-15f   , 3.77658314e-15f   , },
+/* x = 31.1        */  {0.158914947f      , 0.00255490268f    , 0.000123226817f   , 9.9056927e-6f     , 1.11478857e-6f    , 1.61303812e-7f    , 2.8526397e-8f     , 5.9621082e-9f     , 1.43780694e-9f    , 3.92969243e-10f   , 1.20038335e-10f   , 4.05269115e-11f   , 1.49853347e-11f   , 6.02254369e-12f   , 2.61378667e-12f   , 1.21814573e-12f   , 6.06613648e-13f   , 3.21336038e-13f   , 1.80315314e-13f   , 1.06760736e-13f   , 6.64392265e-14f   , 4.32935605e-14f   , 2.9428847e-14f    , 2.07901815e-14f   , 1.52088378e-14f   , 1.14804539e-14f   , 8.91244899e-15f   , 7.09342404e-15f   , 5.77153539e-15f   , 4.78824271e-15f   , 4.04111734e-15f   , 3.46236876e-15f   , },
+/* x = 31.2        */  {0.158660071f      , 0.00254262934f    , 0.000122241795f   , 9.79501564e-6f    , 1.09879983e-6f    , 1.58480744e-7f    , 2.79373103e-8f    , 5.82027252e-9f    , 1.39910352e-9f    , 3.81165571e-10f   , 1.16059578e-10f   , 3.90580601e-11f   , 1.43959487e-11f   , 5.76715597e-12f   , 2.49495235e-12f   , 1.15906144e-12f   , 5.75364101e-13f   , 3.03827415e-13f   , 1.69964341e-13f   , 1.00328462e-13f   , 6.2253612e-14f    , 4.0452139e-14f    , 2.74239961e-14f   , 1.93252437e-14f   , 1.41041961e-14f   , 1.06237338e-14f   , 8.23118278e-15f   , 6.53955238e-15f   , 5.31235196e-15f   , 4.40095261e-15f   , 3.70948053e-15f   , 3.17457842e-15f   , },
+/* x = 31.3        */  {0.158406417f      , 0.00253045395f    , 0.000121267761f   , 9.68592343e-6f    , 1.08309048e-6f    , 1.55715883e-7f    , 2.73622155e-8f    , 5.68224881e-9f    , 1.36156081e-9f    , 3.69752528e-10f   , 1.12224801e-10f   , 3.764689e-11f     , 1.38315171e-11f   , 5.5233614e-12f    , 2.38187309e-12f   , 1.10301625e-12f   , 5.45814715e-13f   , 2.87322414e-13f   , 1.60236134e-13f   , 9.430087e-14f     , 5.83423551e-14f   , 3.78040585e-14f   , 2.55602559e-14f   , 1.79665977e-14f   , 1.30819105e-14f   , 9.83244593e-15f   , 7.603071e-15f     , 6.0297167e-15f    , 4.89028627e-15f   , 4.04542843e-15f   , 3.40539585e-15f   , 2.91096883e-15f   , },
+/* x = 31.4        */  {0.158153977f      , 0.00251837543f    , 0.000120304559f   , 9.57838842e-6f    , 1.06765476e-6f    , 1.53007847e-7f    , 2.68007372e-8f    , 5.54792294e-9f    , 1.32514046e-9f    , 3.58716e-10f      , 1.08528359e-10f   , 3.62909627e-11f   , 1.32909087e-11f   , 5.29059939e-12f   , 2.27425331e-12f   , 1.04984507e-12f   , 5.17868178e-13f   , 2.71760737e-13f   , 1.51091563e-13f   , 8.86514685e-14f   , 5.46868098e-14f   , 3.53357259e-14f   , 2.38273981e-14f   , 1.67063264e-14f   , 1.21356963e-14f   , 9.10148894e-15f   , 7.02389047e-15f   , 5.56035957e-15f   , 4.50229558e-15f   , 3.71903238e-15f   , 3.12654931e-15f   , 2.66948875e-15f   , },
+/* x = 31.5        */  {0.157902739f      , 0.00250639268f    , 0.000119352033f   , 9.47238354e-6f    , 1.05248706e-6f    , 1.50355294e-7f    , 2.62525113e-8f    , 5.41718454e-9f    , 1.28980551e-9f    , 3.48042426e-10f   , 1.04964845e-10f   , 3.49879501e-11f   , 1.27730472e-11f   , 5.06833809e-12f   , 2.17181347e-12f   , 9.99392239e-13f   , 4.91433012e-13f   , 2.57085868e-13f   , 1.42494059e-13f   , 8.33555635e-14f   , 5.12696397e-14f   , 3.30345325e-14f   , 2.22159558e-14f   , 1.55371164e-14f   , 1.12597586e-14f   , 8.42616655e-15f   , 6.48975896e-15f   , 5.12821502e-15f   , 4.14558963e-15f   , 3.41934809e-15f   , 2.87082315e-15f   , 2.44826243e-15f   , },
+/* x = 31.6        */  {0.157652695f      , 0.00249450467f    , 0.000118410032f   , 9.36788226e-6f    , 1.0375819e-6f     , 1.47756915e-7f    , 2.57171843e-8f    , 5.28992685e-9f    , 1.25552031e-9f    , 3.37718773e-10f   , 1.01529079e-10f   , 3.37356292e-11f   , 1.22769079e-11f   , 4.85607286e-12f   , 2.07428915e-12f   , 9.51510961e-13f   , 4.66423213e-13f   , 2.43244831e-13f   , 1.34409436e-13f   , 7.83901334e-14f   , 4.80747229e-14f   , 3.08887804e-14f   , 2.07171652e-14f   , 1.44522108e-14f   , 1.0448753e-14f    , 7.8021548e-15f    , 5.99710728e-15f   , 4.73028435e-15f   , 3.81760956e-15f   , 3.14416187e-15f   , 2.63627904e-15f   , 2.24557447e-15f   , },
+/* x = 31.7        */  {0.157403835f      , 0.00248271033f    , 0.000117478407f   , 9.26485859e-6f    , 1.02293391e-6f    , 1.45211439e-7f    , 2.51944134e-8f    , 5.16604663e-9f    , 1.22225051e-9f    , 3.27732517e-10f   , 9.82160999e-11f   , 3.2531877e-11f    , 1.18015154e-11f   , 4.65332477e-12f   , 1.98143019e-12f   , 9.06062785e-13f   , 4.4275791e-13f    , 2.30187953e-13f   , 1.26805734e-13f   , 7.37337115e-14f   , 4.50870649e-14f   , 2.88876155e-14f   , 1.93229122e-14f   , 1.34453661e-14f   , 9.69775036e-15f   , 7.22547211e-15f   , 5.54265367e-15f   , 4.36381402e-15f   , 3.51600845e-15f   , 2.89144552e-15f   , 2.42114275e-15f   , 2.05985603e-15f   , },
+/* x = 31.8        */  {0.15715615f       , 0.00247100865f    , 0.000116557012f   , 9.16328708e-6f    , 1.00853789e-6f    , 1.42717625e-7f    , 2.46838657e-8f    , 5.04544401e-9f    , 1.18996297e-9f    , 3.18071619e-10f   , 9.50211524e-11f   , 3.13746656e-11f   , 1.13459409e-11f   , 4.45963922e-12f   , 1.89299986e-12f   , 8.62917103e-13f   , 4.2036104e-13f    , 2.17868652e-13f   , 1.19653063e-13f   , 6.93662778e-14f   , 4.22927168e-14f   , 2.70209645e-14f   , 1.80256828e-14f   , 1.25108126e-14f   , 9.00220352e-15f   , 6.69245167e-15f   , 5.12338032e-15f   , 4.02627532e-15f   , 3.23863358e-15f   , 2.65934068e-15f   , 2.22379015e-15f   , 1.88967221e-15f   , },
+/* x = 31.9        */  {0.15690963f       , 0.00245939859f    , 0.000115645702f   , 9.06314278e-6f    , 9.94388706e-7f    , 1.40274269e-7f    , 2.41852185e-8f    , 4.92802236e-9f    , 1.15862573e-9f    , 3.08724504e-10f   , 9.19396801e-11f   , 3.02620578e-11f   , 1.09092999e-11f   , 4.27458466e-12f   , 1.80877413e-12f   , 8.21950686e-13f   , 3.99161053e-13f   , 2.0624324e-13f    , 1.12923469e-13f   , 6.52691581e-14f   , 3.96787006e-14f   , 2.52794774e-14f   , 1.68185182e-14f   , 1.16432171e-14f   , 8.35791749e-15f   , 6.19971614e-15f   , 4.73651184e-15f   , 3.71534577e-15f   , 2.98351019e-15f   , 2.44614441e-15f   , 2.04273437e-15f   , 1.73371048e-15f   , },
+/* x = 32.0        */  {0.156664267f      , 0.00244787917f    , 0.000114744336f   , 8.96440127e-6f    , 9.80481389e-7f    , 1.37880195e-7f    , 2.36981583e-8f    , 4.81368822e-9f    , 1.12820798e-9f    , 2.99680046e-10f   , 8.89673158e-11f   , 2.91922026e-11f   , 1.04907499e-11f   , 4.09775132e-12f   , 1.72854096e-12f   , 7.83047245e-13f   , 3.79090632e-13f   , 1.95270729e-13f   , 1.06590803e-13f   , 6.14249301e-14f   , 3.72329392e-14f   , 2.36544741e-14f   , 1.56949722e-14f   , 1.08376497e-14f   , 7.76102144e-15f   , 5.74415445e-15f   , 4.37949549e-15f   , 3.42889212e-15f   , 2.74882658e-15f   , 2.25029608e-15f   , 1.87661412e-15f   , 1.59077024e-15f   , },
+/* x = 32.1        */  {0.156420051f      , 0.0024364494f     , 0.000113852776f   , 8.86703861e-6f    , 9.66811063e-7f    , 1.35534261e-7f    , 2.3222381e-8f     , 4.70235111e-9f    , 1.09867999e-9f    , 2.90927544e-10f   , 8.60998735e-11f   , 2.81633315e-11f   , 1.00894886e-11f   , 3.92875008e-12f   , 1.65209958e-12f   , 7.46097023e-13f   , 3.60086428e-13f   , 1.84912666e-13f   , 1.00630596e-13f   , 5.78173373e-14f   , 3.49441923e-14f   , 2.21378952e-14f   , 1.46490729e-14f   , 1.00895525e-14f   , 7.20794326e-15f   , 5.32290045e-15f   , 4.04998305e-15f   , 3.16495469e-15f   , 2.53292051e-15f   , 2.0703654e-15f    , 1.72418298e-15f   , 1.45975313e-15f   , },
+/* x = 32.2        */  {0.156176974f      , 0.0024251083f     , 0.000112970883f   , 8.77103132e-6f    , 9.53372969e-7f    , 1.33235353e-7f    , 2.27575911e-8f    , 4.59392352e-9f    , 1.07001308e-9f    , 2.82456708e-10f   , 8.33333398e-11f   , 2.71737542e-11f   , 9.7047512e-12f    , 3.76721136e-12f   , 1.57925991e-12f   , 7.1099641e-13f    , 3.42088822e-13f   , 1.7513296e-13f    , 9.50199541e-14f   , 5.44312075e-14f   , 3.28019961e-14f   , 2.07222562e-14f   , 1.36752869e-14f   , 9.39471067e-15f   , 6.69538602e-15f   , 4.93331325e-15f   , 3.74581419e-15f   , 2.92173308e-15f   , 2.33426673e-15f   , 1.90504133e-15f   , 1.58429964e-15f   , 1.33965429e-15f   , },
+/* x = 32.3        */  {0.155935027f      , 0.00241385491f    , 0.000112098525f   , 8.67635643e-6f    , 9.40162461e-7f    , 1.30982386e-7f    , 2.23035021e-8f    , 4.48832072e-9f    , 1.04217959e-9f    , 2.74257641e-10f   , 8.06638668e-11f   , 2.62218548e-11f   , 9.33580927e-12f   , 3.61278405e-12f   , 1.50984191e-12f   , 6.7764758e-13f    , 3.25041689e-13f   , 1.65897738e-13f   , 8.97374458e-14f   , 5.12523785e-14f   , 3.07966086e-14f   , 1.94006054e-14f   , 1.27684859e-14f   , 8.74922631e-15f   , 6.22030638e-15f   , 4.57295926e-15f   , 3.4650012e-15f    , 2.69757305e-15f   , 2.15146553e-15f   , 1.75312214e-15f   , 1.45591892e-15f   , 1.22955432e-15f   , },
+/* x = 32.4        */  {0.1556942f        , 0.00240268828f    , 0.000111235568f   , 8.58299139e-6f    , 9.27174996e-7f    , 1.28774305e-7f    , 2.18598356e-8f    , 4.38546071e-9f    , 1.01515281e-9f    , 2.66320822e-10f   , 7.80877645e-11f   , 2.5306089e-11f    , 8.98196847e-12f   , 3.46513461e-12f   , 1.44367508e-12f   , 6.45958154e-13f   , 3.08892187e-13f   , 1.57175203e-13f   , 8.47630101e-14f   , 4.82676285e-14f   , 2.89189578e-14f   , 1.8166485e-14f    , 1.19239168e-14f   , 8.14949403e-15f   , 5.77989469e-15f   , 4.23959561e-15f   , 3.205715e-15f     , 2.49095449e-15f   , 1.9832323e-15f    , 1.61350613e-15f   , 1.3380836e-15f    , 1.12861197e-15f   , },
+/* x = 32.5        */  {0.155454486f      , 0.00239160748f    , 0.000110381884f   , 8.49091414e-6f    , 9.14406138e-7f    , 1.26610081e-7f    , 2.14263212e-8f    , 4.28526412e-9f    , 9.88906987e-10f   , 2.58637094e-10f   , 7.56014939e-11f   , 2.44249798e-11f   , 8.642567e-12f     , 3.32394606e-12f   , 1.38059788e-12f   , 6.15840883e-13f   , 2.93590557e-13f   , 1.48935495e-13f   , 8.00778633e-14f   , 4.54646113e-14f   , 2.71605944e-14f   , 1.70138949e-14f   , 1.11371735e-14f   , 7.59217847e-15f   , 5.37155667e-15f   , 3.93115496e-15f   , 2.96627228e-15f   , 2.3004804e-15f    , 1.82838796e-15f   , 1.48518322e-15f   , 1.229917e-15f     , 1.03605742e-15f   , },
+/* x = 32.6        */  {0.155215876f      , 0.0023806116f     , 0.000109537343f   , 8.40010302e-6f    , 9.01851551e-7f    , 1.24488711e-7f    , 2.10026965e-8f    , 4.18765411e-9f    , 9.6341725e-10f    , 2.51197643e-10f   , 7.32016604e-11f   , 2.35771153e-11f   , 8.31697396e-12f   , 3.18891716e-12f   , 1.32045725e-12f   , 5.87213346e-13f   , 2.79089931e-13f   , 1.41150575e-13f   , 7.56644152e-14f   , 4.28317964e-14f   , 2.55136475e-14f   , 1.59372593e-14f   , 1.04041704e-14f   , 7.07419364e-15f   , 4.99289662e-15f   , 3.64573149e-15f   , 2.74512369e-15f   , 2.12486678e-15f   , 1.68585018e-15f   , 1.36722728e-15f   , 1.13061607e-15f   , 9.51186183e-16f   , },
+/* x = 32.7        */  {0.154978361f      , 0.00236969971f    , 0.000108701822f   , 8.31053683e-6f    , 8.89507e-7f       , 1.2240922e-7f     , 2.05887066e-8f    , 4.09255627e-9f    , 9.38659599e-10f   , 2.43993989e-10f   , 7.08850077e-11f   , 2.27611449e-11f   , 8.00458781e-12f   , 3.05976157e-12f   , 1.26310816e-12f   , 5.59997671e-13f   , 2.65346162e-13f   , 1.33794105e-13f   , 7.15061904e-14f   , 4.03584129e-14f   , 2.39707839e-14f   , 1.4931396e-14f    , 9.72111913e-15f   , 6.59268383e-15f   , 4.64170186e-15f   , 3.38156808e-15f   , 2.54084302e-15f   , 1.96293336e-15f   , 1.55462532e-15f   , 1.25878907e-15f   , 1.03944521e-15f   , 8.73353503e-16f   , },
+/* x = 32.8        */  {0.154741933f      , 0.00235887094f    , 0.000107875195f   , 8.22219476e-6f    , 8.77368343e-7f    , 1.20370657e-7f    , 2.01841039e-8f    , 3.99989856e-9f    , 9.14610865e-10f   , 2.37017973e-10f   , 6.86484114e-11f   , 2.19757767e-11f   , 7.70483496e-12f   , 2.93620707e-12f   , 1.20841312e-12f   , 5.34120274e-13f   , 2.52317654e-13f   , 1.26841345e-13f   , 6.75877544e-14f   , 3.80343984e-14f   , 2.25251702e-14f   , 1.39914878e-14f   , 9.08450609e-15f   , 6.14500606e-15f   , 4.31592848e-15f   , 3.1370445e-15f    , 2.35211727e-15f   , 1.81359511e-15f   , 1.43380114e-15f   , 1.15908976e-15f   , 9.55730482e-16f   , 8.01969253e-16f   , },
+/* x = 32.9        */  {0.154506584f      , 0.00234812438f    , 0.000107057343f   , 8.13505643e-6f    , 8.65431535e-7f    , 1.18372094e-7f    , 1.97886479e-8f    , 3.90961121e-9f    , 8.91248679e-10f   , 2.30261738e-10f   , 6.64888736e-11f   , 2.1219775e-11f    , 7.41716834e-12f   , 2.81799483e-12f   , 1.15624182e-12f   , 5.09511607e-13f   , 2.39965212e-13f   , 1.20269045e-13f   , 6.38946459e-14f   , 3.585035e-14f     , 2.11704375e-14f   , 1.31130558e-14f   , 8.49107193e-15f   , 5.72871385e-15f   , 4.01368823e-15f   , 2.91066653e-15f   , 2.1777375e-15f    , 1.67585444e-15f   , 1.32253995e-15f   , 1.06741507e-15f   , 8.78854464e-16f   , 7.36493265e-16f   , },
+/* x = 33.0        */  {0.154272306f      , 0.00233745918f    , 0.000106248145f   , 8.04910186e-6f    , 8.53692621e-7f    , 1.1641263e-7f     , 1.94021049e-8f    , 3.82162666e-9f    , 8.68551443e-10f   , 2.23717725e-10f   , 6.4403517e-11f    , 2.04919576e-11f   , 7.14106613e-12f   , 2.7048787e-12f    , 1.1064707e-12f    , 4.8610593e-13f    , 2.28251893e-13f   , 1.14055357e-13f   , 6.04133124e-14f   , 3.37974799e-14f   , 1.99006489e-14f   , 1.22919352e-14f   , 7.93779282e-15f   , 5.34154228e-15f   , 3.73323638e-15f   , 2.70105601e-15f   , 2.01659046e-15f   , 1.54879406e-15f   , 1.22007253e-15f   , 9.83109823e-16f   , 8.08251415e-16f   , 6.76431064e-16f   , },
+/* x = 33.1        */  {0.15403909f       , 0.00232687447f    , 0.000105447483f   , 7.96431144e-6f    , 8.42147735e-7f    , 1.14491384e-7f    , 1.9024248e-8f     , 3.73587946e-9f    , 8.46498302e-10f   , 2.17378654e-10f   , 6.23895804e-11f   , 1.97911929e-11f   , 6.87603054e-12f   , 2.59662459e-12f   , 1.0589826e-12f    , 4.63841088e-13f   , 2.17142873e-13f   , 1.08179747e-13f   , 5.71310517e-14f   , 3.18675737e-14f   , 1.87102695e-14f   , 1.15242525e-14f   , 7.42186287e-15f   , 4.98139418e-15f   , 3.4729606e-15f    , 2.50694162e-15f   , 1.86765087e-15f   , 1.43157042e-15f   , 1.12569243e-15f   , 9.05573018e-16f   , 7.43402924e-16f   , 6.21329967e-16f   , },
+/* x = 33.2        */  {0.153806928f      , 0.0023163694f     , 0.000104655244f   , 7.88066597e-6f    , 8.30793099e-7f    , 1.12607498e-7f    , 1.86548566e-8f    , 3.6523062e-9f     , 8.25069115e-10f   , 2.11237517e-10f   , 6.04444128e-11f   , 1.91163984e-11f   , 6.62158658e-12f   , 2.49300979e-12f   , 1.01366642e-12f   , 4.42658309e-13f   , 2.06605319e-13f   , 1.02622909e-13f   , 5.40359555e-14f   , 3.00529515e-14f   , 1.75941376e-14f   , 1.08064046e-14f   , 6.94067809e-15f   , 4.64632742e-15f   , 3.23137072e-15f   , 2.32715048e-15f   , 1.72997441e-15f   , 1.32340769e-15f   , 1.03875075e-15f   , 8.342533e-16f     , 6.83833906e-16f   , 5.70775525e-16f   , },
+/* x = 33.3        */  {0.153575813f      , 0.00230594314f    , 0.000103871313f   , 7.7981466e-6f     , 8.19625018e-7f    , 1.10760138e-7f    , 1.82937164e-8f    , 3.57084548e-9f    , 8.04244426e-10f   , 2.05287565e-10f   , 5.85654696e-11f   , 1.84665377e-11f   , 6.37728101e-12f   , 2.39382243e-12f   , 9.70416731e-13f   , 4.22502009e-13f   , 1.96608272e-13f   , 9.73666903e-14f   , 5.11168585e-14f   , 2.83464321e-14f   , 1.65474394e-14f   , 1.01350394e-14f   , 6.49182145e-15f   , 4.3345432e-15f    , 3.00708923e-15f   , 2.16060037e-15f   , 1.60269116e-15f   , 1.22359225e-15f   , 9.58651438e-16f   , 7.68644809e-16f   , 6.29108948e-16f   , 5.2438826e-16f    , },
+/* x = 33.4        */  {0.153345737f      , 0.00229559487f    , 0.000103095578f   , 7.71673487e-6f    , 8.08639881e-7f    , 1.08948487e-7f    , 1.79406191e-8f    , 3.49143779e-9f    , 7.84005446e-10f   , 1.99522297e-10f   , 5.67503073e-11f   , 1.78406187e-11f   , 6.14268125e-12f   , 2.2988609e-12f    , 9.29133554e-13f   , 4.03319613e-13f   , 1.87122531e-13f   , 9.23940204e-14f   , 4.836329e-14f     , 2.67412992e-14f   , 1.55656845e-14f   , 9.5070377e-15f    , 6.07304905e-15f   , 4.04437519e-15f   , 2.79884265e-15f   , 2.00629259e-15f   , 1.48499966e-15f   , 1.13146762e-15f   , 8.84846924e-16f   , 7.08283382e-16f   , 5.78828963e-16f   , 4.81820688e-16f   , },
+/* x = 33.5        */  {0.153116692f      , 0.00228532376f    , 0.000102327929f   , 7.63641265e-6f    , 7.97834157e-7f    , 1.07171752e-7f    , 1.75953623e-8f    , 3.41402548e-9f    , 7.6433402e-10f    , 1.93935455e-10f   , 5.49965795e-11f   , 1.72376917e-11f   , 5.91737438e-12f   , 2.20793334e-12f   , 8.89722006e-13f   , 3.85061379e-13f   , 1.78120552e-13f   , 8.76888428e-14f   , 4.57654289e-14f   , 2.52312704e-14f   , 1.46446834e-14f   , 8.91949644e-15f   , 5.68227746e-15f   , 3.77427953e-15f   , 2.60545344e-15f   , 1.86330539e-15f   , 1.37616146e-15f   , 1.04642985e-15f   , 8.16834097e-16f   , 6.52743078e-16f   , 5.32628124e-16f   , 4.42754601e-16f   , },
+/* x = 33.6        */  {0.15288867f       , 0.00227512901f    , 0.00010156826f    , 7.55716217e-6f    , 7.87204393e-7f    , 1.0542916e-7f     , 1.72577493e-8f    , 3.33855266e-9f    , 7.45212609e-10f   , 1.88521009e-10f   , 5.33020329e-11f   , 1.66568472e-11f   , 5.70096621e-12f   , 2.12085712e-12f   , 8.52092044e-13f   , 3.67680245e-13f   , 1.6957635e-13f    , 8.32360521e-14f   , 4.33140621e-14f   , 2.3810468e-14f    , 1.37805268e-14f   , 8.3697135e-15f    , 5.31757187e-15f   , 3.52282564e-15f   , 2.42583265e-15f   , 1.73078793e-15f   , 1.27549604e-15f   , 9.67923199e-16f   , 7.5415067e-16f    , 6.01632995e-16f   , 4.90171068e-16f   , 4.06898575e-16f   , },
+/* x = 33.7        */  {0.152661663f      , 0.00226500984f    , 0.000100816462f   , 7.47896601e-6f    , 7.76747212e-7f    , 1.03719954e-7f    , 1.69275889e-8f    , 3.26496519e-9f    , 7.26624265e-10f   , 1.83273148e-10f   , 5.1664503e-11f    , 1.60972144e-11f   , 5.49308038e-12f   , 2.0374584e-12f    , 8.16158207e-13f   , 3.51131669e-13f   , 1.61465404e-13f   , 7.9021436e-14f    , 4.10005449e-14f   , 2.24733921e-14f   , 1.29695661e-14f   , 7.85517324e-15f   , 4.97713524e-15f   , 3.2886877e-15f    , 2.25897311e-15f   , 1.60795472e-15f   , 1.18237621e-15f   , 8.95436269e-16f   , 6.96371816e-16f   , 5.54594349e-16f   , 4.51150329e-16f   , 3.73985693e-16f   , },
+/* x = 33.8        */  {0.152435665f      , 0.00225496546f    , 0.000100072432f   , 7.40180708e-6f    , 7.66459313e-7f    , 1.020434e-7f      , 1.66046952e-8f    , 3.19321058e-9f    , 7.08552613e-10f   , 1.78186277e-10f   , 5.00819108e-11f   , 1.55579591e-11f   , 5.29335747e-12f   , 1.95757165e-12f   , 7.81839366e-13f   , 3.35373495e-13f   , 1.53764571e-13f   , 7.50316192e-14f   , 3.88167648e-14f   , 2.12148953e-14f   , 1.22083956e-14f   , 7.37353326e-15f   , 4.65929819e-15f   , 3.07063678e-15f   , 2.10394314e-15f   , 1.49408049e-15f   , 1.09622385e-15f   , 8.284984e-16f     , 6.43107093e-16f   , 5.11297808e-16f   , 4.15283997e-16f   , 3.43771469e-16f   , },
+/* x = 33.9        */  {0.152210668f      , 0.0022449951f     , 9.93360664e-5f    , 7.32566862e-6f    , 7.56337468e-7f    , 1.00398779e-7f    , 1.62888874e-8f    , 3.12323797e-9f    , 6.90981824e-10f   , 1.73255002e-10f   , 4.85522586e-11f   , 1.50382823e-11f   , 5.10145425e-12f   , 1.88103926e-12f   , 7.49058494e-13f   , 3.20365814e-13f   , 1.46452007e-13f   , 7.12540128e-14f   , 3.67551074e-14f   , 2.00301595e-14f   , 1.14938357e-14f   , 6.92261211e-15f   , 4.36250972e-15f   , 2.86753356e-15f   , 1.95988076e-15f   , 1.38849551e-15f   , 1.01650604e-15f   , 7.66676374e-16f   , 5.93997623e-16f   , 4.71441043e-16f   , 3.82313566e-16f   , 3.16031944e-16f   , },
+/* x = 34.0        */  {0.151986664f      , 0.002235098f      , 9.86072646e-5f    , 7.25053416e-6f    , 7.46378517e-7f    , 9.87853919e-8f    , 1.59799898e-8f    , 3.05499803e-9f    , 6.73896599e-10f   , 1.68474125e-10f   , 4.70736273e-11f   , 1.45374185e-11f   , 4.91704282e-12f   , 1.80771113e-12f   , 7.17742449e-13f   , 3.0607084e-13f    , 1.3950709e-13f    , 6.76767657e-14f   , 3.48084248e-14f   , 1.89146737e-14f   , 1.08229171e-14f   , 6.50037786e-15f   , 4.08532852e-15f   , 2.67832169e-15f   , 1.8259884e-15f    , 1.29058122e-15f   , 9.4273138e-16f    , 7.09571393e-16f   , 5.48713503e-16f   , 4.34746489e-16f   , 3.52001976e-16f   , 2.90561943e-16f   , },
+/* x = 34.1        */  {0.151763646f      , 0.0022252734f     , 9.78859267e-5f    , 7.17638759e-6f    , 7.36579371e-7f    , 9.72025563e-8f    , 1.56778316e-8f    , 2.98844296e-9f    , 6.57282153e-10f   , 1.63838637e-10f   , 4.56441723e-11f   , 1.40546344e-11f   , 4.73980999e-12f   , 1.73744426e-12f   , 6.87821764e-13f   , 2.92452791e-13f   , 1.32910348e-13f   , 6.42887195e-14f   , 3.29700055e-14f   , 1.7864214e-14f    , 1.01928671e-14f   , 6.10493758e-15f   , 3.82641507e-15f   , 2.50202155e-15f   , 1.70152792e-15f   , 1.19976627e-15f   , 8.74446794e-16f   , 6.56816299e-16f   , 5.06951436e-16f   , 4.00959287e-16f   , 3.2413181e-16f    , 2.67173489e-16f   , },
+/* x = 34.2        */  {0.151541607f      , 0.00221552057f    , 9.71719547e-5f    , 7.10321306e-6f    , 7.26937009e-7f    , 9.56496064e-8f    , 1.53822466e-8f    , 2.92352639e-9f    , 6.41124187e-10f   , 1.5934371e-10f    , 4.42621212e-11f   , 1.35892272e-11f   , 4.56945647e-12f   , 1.67010247e-12f   , 6.59230458e-13f   , 2.79477779e-13f   , 1.2664339e-13f    , 6.10793663e-14f   , 3.12335467e-14f   , 1.68748245e-14f   , 9.60109542e-15f   , 5.73452752e-15f   , 3.58452418e-15f   , 2.33772454e-15f   , 1.58581614e-15f   , 1.11552282e-15f   , 8.11234423e-16f   , 6.08073025e-16f   , 4.68432556e-16f   , 3.69845411e-16f   , 2.98503651e-16f   , 2.45694345e-16f   , },
+/* x = 34.3        */  {0.151320539f      , 0.00220583877f    , 9.64652522e-5f    , 7.03099506e-6f    , 7.17448475e-7f    , 9.41258932e-8f    , 1.50930732e-8f    , 2.86020336e-9f    , 6.25408881e-10f   , 1.54984689e-10f   , 4.29257701e-11f   , 1.31405234e-11f   , 4.40569632e-12f   , 1.60555595e-12f   , 6.31905846e-13f   , 2.671137e-13f     , 1.20688849e-13f   , 5.80388092e-14f   , 2.95931287e-14f   , 1.59427998e-14f   , 9.04518218e-15f   , 5.38750401e-15f   , 3.35849822e-15f   , 2.18458783e-15f   , 1.4782206e-15f    , 1.03736319e-15f   , 7.52708866e-16f   , 5.63030252e-16f   , 4.32900427e-16f   , 3.41189938e-16f   , 2.74934573e-16f   , 2.25966682e-16f   , },
+/* x = 34.4        */  {0.151100437f      , 0.00219622728f    , 9.57657243e-5f    , 6.95971834e-6f    , 7.08110877e-7f    , 9.26307833e-8f    , 1.48101543e-8f    , 2.7984303e-9f     , 6.10122869e-10f   , 1.50757087e-10f   , 4.16334813e-11f   , 1.27078773e-11f   , 4.24825624e-12f   , 1.54368106e-12f   , 6.05788369e-13f   , 2.55330143e-13f   , 1.15030313e-13f   , 5.51577249e-14f   , 2.80431905e-14f   , 1.50646683e-14f   , 8.52286625e-15f   , 5.06233501e-15f   , 3.14726073e-15f   , 2.04182944e-15f   , 1.37815577e-15f   , 9.64836706e-16f   , 6.98514605e-16f   , 5.21401263e-16f   , 4.00119219e-16f   , 3.1479547e-16f    , 2.53256766e-16f   , 2.07845866e-16f   , },
+/* x = 34.5        */  {0.150881292f      , 0.00218668539f    , 9.50732776e-5f    , 6.88936794e-6f    , 6.98921386e-7f    , 9.1163659e-8f     , 1.45333369e-8f    , 2.73816491e-9f    , 5.95253227e-10f   , 1.46656577e-10f   , 4.03836801e-11f   , 1.22906702e-11f   , 4.09687499e-12f   , 1.48435993e-12f   , 5.80821429e-13f   , 2.44098288e-13f   , 1.09652281e-13f   , 5.24273296e-14f   , 2.65785072e-14f   , 1.42371772e-14f   , 8.03203441e-15f   , 4.75759236e-15f   , 2.94981063e-15f   , 1.90872377e-15f   , 1.28507941e-15f   , 8.97526856e-16f   , 6.48323647e-16f   , 4.82921961e-16f   , 3.69872026e-16f   , 2.90480688e-16f   , 2.3331627e-16f    , 1.9119934e-16f    , },
+/* x = 34.6        */  {0.150663097f      , 0.00217721239f    , 9.43878203e-5f    , 6.81992921e-6f    , 6.89877233e-7f    , 8.97239175e-8f    , 1.42624724e-8f    , 2.67936619e-9f    , 5.80787456e-10f   , 1.42678986e-10f   , 3.91748524e-11f   , 1.18883087e-11f   , 3.95130287e-12f   , 1.42748022e-12f   , 5.56951233e-13f   , 2.33390826e-13f   , 1.04540101e-13f   , 4.98393457e-14f   , 2.51941689e-14f   , 1.3457278e-14f    , 7.57071138e-15f   , 4.47194442e-15f   , 2.76521672e-15f   , 1.78459739e-15f   , 1.19848937e-15f   , 8.35048647e-16f   , 6.01833354e-16f   , 4.47349059e-16f   , 3.41959326e-16f   , 2.68079027e-16f   , 2.14971817e-16f   , 1.75905606e-16f   , },
+/* x = 34.7        */  {0.150445847f      , 0.00216780759f    , 9.37092619e-5f    , 6.75138774e-6f    , 6.80975709e-7f    , 8.83109709e-8f    , 1.39974161e-8f    , 2.62199436e-9f    , 5.66713467e-10f   , 1.38820289e-10f   , 3.80055425e-11f   , 1.15002239e-11f   , 3.81130114e-12f   , 1.37293483e-12f   , 5.34126648e-13f   , 2.23181869e-13f   , 9.96799256e-14f   , 4.73859718e-14f   , 2.38855607e-14f   , 1.2722113e-14f    , 7.13705052e-15f   , 4.20414942e-15f   , 2.59261273e-15f   , 1.66882523e-15f   , 1.11792052e-15f   , 7.77046163e-16f   , 5.58764446e-16f   , 4.14458414e-16f   , 3.16197565e-16f   , 2.47437456e-16f   , 1.98093778e-16f   , 1.61853296e-16f   , },
+/* x = 34.8        */  {0.150229534f      , 0.00215847031f    , 9.30375133e-5f    , 6.68372941e-6f    , 6.72214164e-7f    , 8.69242454e-8f    , 1.37380273e-8f    , 2.56601083e-9f    , 5.53019565e-10f   , 1.35076607e-10f   , 3.687435e-11f     , 1.11258704e-11f   , 3.67664151e-12f   , 1.32062166e-12f   , 5.12299062e-13f   , 2.13446878e-13f   , 9.50586652e-14f   , 4.50598541e-14f   , 2.26483446e-14f   , 1.20290035e-14f   , 6.7293251e-15f    , 3.95304914e-15f   , 2.43119259e-15f   , 1.56082698e-15f   , 1.04294195e-15f   , 7.23190325e-16f   , 5.18859165e-16f   , 3.84043492e-16f   , 2.92417864e-16f   , 2.28415367e-16f   , 1.82563189e-16f   , 1.48940314e-16f   , },
+/* x = 34.9        */  {0.150014151f      , 0.00214919986f    , 9.2372487e-5f     , 6.61694033e-6f    , 6.63590005e-7f    , 8.55631811e-8f    , 1.34841689e-8f    , 2.51137816e-9f    , 5.39694436e-10f   , 1.31444194e-10f   , 3.57799281e-11f   , 1.07647248e-11f   , 3.54710565e-12f   , 1.27044333e-12f   , 4.91422251e-13f   , 2.04162585e-13f   , 9.06639444e-14f   , 4.28540594e-14f   , 2.1478442e-14f    , 1.13754374e-14f   , 6.34592029e-15f   , 3.71756316e-15f   , 2.2802062e-15f    , 1.46006384e-15f   , 9.73154402e-16f   , 6.73176827e-16f   , 4.81879584e-16f   , 3.55913966e-16f   , 2.70464827e-16f   , 2.10883553e-16f   , 1.68270866e-16f   , 1.37073061e-16f   , },
+/* x = 35.0        */  {0.149799691f      , 0.00213999559f    , 9.17140967e-5f    , 6.55100691e-6f    , 6.55100691e-7f    , 8.42272317e-8f    , 1.32357078e-8f    , 2.45806002e-9f    , 5.26727137e-10f   , 1.27919439e-10f   , 3.47209815e-11f   , 1.04162854e-11f   , 3.42248478e-12f   , 1.22230699e-12f   , 4.71452258e-13f   , 1.95306928e-13f   , 8.64840609e-14f   , 4.076205e-14f     , 2.03720177e-14f   , 1.07590592e-14f   , 5.98532566e-15f   , 3.49668344e-15f   , 2.13895537e-15f   , 1.36603543e-15f   , 9.08187907e-16f   , 6.26724226e-16f   , 4.47606055e-16f   , 3.29894417e-16f   , 2.50195447e-16f   , 1.94723269e-16f   , 1.55116588e-16f   , 1.26165717e-16f   , },
+/* x = 35.1        */  {0.149586149f      , 0.00213085683f    , 9.10622576e-5f    , 6.48591578e-6f    , 6.46743739e-7f    , 8.29158639e-8f    , 1.29925143e-8f    , 2.40602116e-9f    , 5.14107076e-10f   , 1.24498857e-10f   , 3.36962636e-11f   , 1.00800707e-11f   , 3.30257915e-12f   , 1.17612405e-12f   , 4.52347276e-13f   , 1.86858981e-13f   , 8.25079475e-14f   , 3.87776604e-14f   , 1.93254644e-14f   , 1.01776592e-14f   , 5.64612816e-15f   , 3.28946929e-15f   , 2.00679015e-15f   , 1.27827701e-15f   , 8.47699559e-16f   , 5.83572191e-16f   , 4.15835772e-16f   , 3.05823153e-16f   , 2.31478104e-16f   , 1.79825375e-16f   , 1.43008356e-16f   , 1.16139589e-16f   , },
+/* x = 35.2        */  {0.149373518f      , 0.00212178292f    , 9.04168859e-5f    , 6.42165383e-6f    , 6.38516716e-7f    , 8.16285575e-8f    , 1.27544621e-8f    , 2.35522737e-9f    , 5.01824006e-10f   , 1.21179085e-10f   , 3.27045753e-11f   , 9.75561881e-12f   , 3.18719768e-12f   , 1.13181002e-12f   , 4.34067534e-13f   , 1.78798896e-13f   , 7.87251358e-14f   , 3.68950747e-14f   , 1.83353892e-14f   , 9.62916448e-15f   , 5.32700562e-15f   , 3.09504277e-15f   , 1.88310539e-15f   , 1.19635687e-15f   , 7.91371498e-16f   , 5.43479888e-16f   , 3.86381463e-16f   , 2.83551111e-16f   , 2.14191645e-16f   , 1.66089552e-16f   , 1.31861709e-16f   , 1.06922513e-16f   , },
+/* x = 35.3        */  {0.149161791f      , 0.00211277324f    , 8.97778996e-5f    , 6.35820819e-6f    , 6.30417242e-7f    , 8.03648042e-8f    , 1.25214284e-8f    , 2.30564545e-9f    , 4.89868007e-10f   , 1.17956879e-10f   , 3.17447625e-11f   , 9.44248649e-12f   , 3.07615754e-12f   , 1.0892843e-12f    , 4.16575197e-13f   , 1.71107842e-13f   , 7.51257223e-14f   , 3.51088065e-14f   , 1.73985996e-14f   , 9.1116302e-15f    , 5.02672073e-15f   , 2.91258435e-15f   , 1.76733757e-15f   , 1.11987388e-15f   , 7.38909037e-16f   , 5.0622448e-16f    , 3.59070169e-16f   , 2.62940856e-16f   , 1.9822454e-16f    , 1.53423573e-16f   , 1.21599097e-16f   , 9.84483058e-17f   , },
+/* x = 35.4        */  {0.148950961f      , 0.00210382713f    , 8.91452175e-5f    , 6.29556621e-6f    , 6.22442987e-7f    , 7.91241085e-8f    , 1.22932937e-8f    , 2.25724318e-9f    , 4.78229482e-10f   , 1.14829107e-10f   , 3.08157148e-11f   , 9.14024843e-12f   , 2.96928378e-12f   , 1.04846994e-12f   , 3.99834262e-13f   , 1.63767951e-13f   , 7.17003368e-14f   , 3.34136789e-14f   , 1.65120921e-14f   , 8.6232311e-15f    , 4.74411537e-15f   , 2.74132889e-15f   , 1.65896183e-15f   , 1.04845534e-15f   , 6.9003893e-16f    , 4.71599759e-16f   , 3.33742134e-16f   , 2.43865657e-16f   , 1.83474103e-16f   , 1.41742645e-16f   , 1.12149314e-16f   , 9.06562647e-17f   , },
+/* x = 35.5        */  {0.148741023f      , 0.00209494399f    , 8.851876e-5f      , 6.23371549e-6f    , 6.14591668e-7f    , 7.79059861e-8f    , 1.20699415e-8f    , 2.20998928e-9f    , 4.66899139e-10f   , 1.11792746e-10f   , 2.99163633e-11f   , 8.84849644e-12f   , 2.86640895e-12f   , 1.00929354e-12f   , 3.83810467e-13f   , 1.56762269e-13f   , 6.84401117e-14f   , 3.18048065e-14f   , 1.56730395e-14f   , 8.16225402e-15f   , 4.47810538e-15f   , 2.58056192e-15f   , 1.55748926e-15f   , 9.8175482e-16f    , 6.44507773e-16f   , 4.39414876e-16f   , 3.10249775e-16f   , 2.2620864e-16f    , 1.69845782e-16f   , 1.30968801e-16f   , 1.03446967e-16f   , 8.34907084e-17f   , },
+/* x = 35.6        */  {0.14853197f       , 0.00208612318f    , 8.78984485e-5f    , 6.17264385e-6f    , 6.06861053e-7f    , 7.67099645e-8f    , 1.18512586e-8f    , 2.16385338e-9f    , 4.55867983e-10f   , 1.08844879e-10f   , 2.90456791e-11f   , 8.56683869e-12f   , 2.76737281e-12f   , 9.7168503e-13f    , 3.68471205e-13f   , 1.50074704e-13f   , 6.53366543e-14f   , 3.02775781e-14f   , 1.48787809e-14f   , 7.72709075e-15f   , 4.22767566e-15f   , 2.42961615e-15f   , 1.46246436e-15f   , 9.19450337e-16f   , 6.0208053e-16f    , 4.09493171e-16f   , 2.88456736e-16f   , 2.09862006e-16f   , 1.57252503e-16f   , 1.21030344e-16f   , 9.54319969e-17f   , 7.69005571e-17f   , },
+/* x = 35.7        */  {0.148323796f      , 0.00207736409f    , 8.72842056e-5f    , 6.11233933e-6f    , 5.99248954e-7f    , 7.55355824e-8f    , 1.16371345e-8f    , 2.118806e-9f      , 4.45127308e-10f   , 1.05982688e-10f   , 2.82026717e-11f   , 8.29489905e-12f   , 2.67202192e-12f   , 9.35577519e-13f   , 3.53785433e-13f   , 1.43689978e-13f   , 6.23820199e-14f   , 2.88276408e-14f   , 1.41268113e-14f   , 7.3162313e-15f    , 3.9918756e-15f    , 2.2878683e-15f    , 1.37346266e-15f   , 8.61242536e-16f   , 5.62539164e-16f   , 3.81671096e-16f   , 2.68237017e-16f   , 1.94726318e-16f   , 1.45614071e-16f   , 1.11861333e-16f   , 8.80492413e-17f   , 7.0838948e-17f    , },
+/* x = 35.8        */  {0.148116495f      , 0.00206866614f    , 8.66759554e-5f    , 6.05279018e-6f    , 5.9175323e-7f     , 7.43823893e-8f    , 1.1427462e-8f     , 2.07481852e-9f    , 4.34668681e-10f   , 1.03203454e-10f   , 2.73863874e-11f   , 8.03231637e-12f   , 2.5802094e-12f    , 9.00907147e-13f   , 3.39723599e-13f   , 1.3759359e-13f    , 5.9568687e-14f    , 2.7450885e-14f    , 1.34147719e-14f   , 6.92825772e-15f   , 3.76981486e-15f   , 2.15473606e-15f   , 1.2900886e-15f    , 8.06853068e-16f   , 5.25681383e-16f   , 3.55797215e-16f   , 2.49474173e-16f   , 1.80709833e-16f   , 1.34856615e-16f   , 1.03401116e-16f   , 8.12480264e-17f   , 6.52628834e-17f   , },
+/* x = 35.9        */  {0.147910061f      , 0.00206002871f    , 8.60736228e-5f    , 5.99398487e-6f    , 5.84371784e-7f    , 7.32499451e-8f    , 1.12221364e-8f    , 2.03186314e-9f    , 4.24483939e-10f   , 1.0050455e-10f    , 2.65959081e-11f   , 7.77874391e-12f   , 2.49179462e-12f   , 8.67612941e-13f   , 3.26257563e-13f   , 1.31771769e-13f   , 5.68895332e-14f   , 2.61434296e-14f   , 1.27404414e-14f   , 6.56183821e-15f   , 3.56065938e-15f   , 2.02967532e-15f   , 1.21197342e-15f   , 7.56023078e-16f   , 4.91319468e-16f   , 3.31731295e-16f   , 2.32060573e-16f   , 1.67727903e-16f   , 1.24912086e-16f   , 9.55938993e-17f   , 7.49817986e-17f   , 6.01329081e-17f   , },
+/* x = 36.0        */  {0.147704488f      , 0.00205145122f    , 8.5477134e-5f     , 5.93591208e-6f    , 5.77102564e-7f    , 7.21378205e-8f    , 1.10210559e-8f    , 1.98991287e-9f    , 4.14565178e-10f   , 9.78834415e-11f   , 2.58303494e-11f   , 7.53384868e-12f   , 2.40664289e-12f   , 8.35636669e-13f   , 3.13360529e-13f   , 1.26211436e-13f   , 5.43378134e-14f   , 2.49016096e-14f   , 1.21017276e-14f   , 6.21572177e-15f   , 3.36362773e-15f   , 1.91217756e-15f   , 1.13877338e-15f   , 7.085118e-16f     , 4.59279199e-16f   , 3.09343451e-16f   , 2.15896718e-16f   , 1.55702414e-16f   , 1.15717784e-16f   , 8.8388353e-17f    , 6.92077854e-17f   , 5.54128142e-17f   , },
+/* x = 36.1        */  {0.147499769f      , 0.00204293309f    , 8.48864163e-5f    , 5.87856069e-6f    , 5.69943557e-7f    , 7.10455958e-8f    , 1.08241212e-8f    , 1.94894149e-9f    , 4.04904739e-10f   , 9.53376781e-11f   , 2.50888598e-11f   , 7.29731087e-12f   , 2.32462521e-12f   , 8.0492272e-13f    , 3.01006975e-13f   , 1.20900172e-13f   , 5.1907139e-14f    , 2.37219627e-14f   , 1.14966595e-14f   , 5.888733e-15f     , 3.17798764e-15f   , 1.80176751e-15f   , 1.07016792e-15f   , 6.64095254e-16f   , 4.29398862e-16f   , 2.88513367e-16f   , 2.00890618e-16f   , 1.44561269e-16f   , 1.07215938e-16f   , 8.17372487e-17f   , 6.38866838e-17f   , 5.10693713e-17f   , },
+/* x = 36.2        */  {0.147295899f      , 0.00203447374f    , 8.43013982e-5f    , 5.82191976e-6f    , 5.62892795e-7f    , 6.99728612e-8f    , 1.06312358e-8f    , 1.90892356e-9f    , 3.95495209e-10f   , 9.28648946e-11f   , 2.43706189e-11f   , 7.0688233e-12f    , 2.24561804e-12f   , 7.7541797e-13f    , 2.89172587e-13f   , 1.15826176e-13f   , 4.95914577e-14f   , 2.26012182e-14f   , 1.09233803e-14f   , 5.57976744e-15f   , 3.00305282e-15f   , 1.69800081e-15f   , 1.00585813e-15f   , 6.22565046e-16f   , 4.01528325e-16f   , 2.69129578e-16f   , 1.8695721e-16f    , 1.34237924e-16f   , 9.93533056e-17f   , 7.55971264e-17f   , 5.89823756e-17f   , 4.70720779e-17f   , },
+/* x = 36.3        */  {0.147092872f      , 0.00202607262f    , 8.37220091e-5f    , 5.76597859e-6f    , 5.55948348e-7f    , 6.89192168e-8f    , 1.04423056e-8f    , 1.86983433e-9f    , 3.86329404e-10f   , 9.04628058e-11f   , 2.36748366e-11f   , 6.84809087e-12f   , 2.169503e-12f     , 7.4707167e-13f    , 2.77834205e-13f   , 1.10978238e-13f   , 4.73850352e-14f   , 2.15362855e-14f   , 1.03801399e-14f   , 5.28778708e-15f   , 2.83817991e-15f   , 1.60046201e-15f   , 9.45565179e-16f   , 5.83727253e-16f   , 3.75528188e-16f   , 2.51088798e-16f   , 1.74017827e-16f   , 1.24670941e-16f   , 9.20808166e-17f   , 6.992799e-17f     , 5.44616657e-17f   , 4.33929357e-17f   , },
+/* x = 36.4        */  {0.146890683f      , 0.00201772916f    , 8.31481795e-5f    , 5.71072661e-6f    , 5.49108328e-7f    , 6.78842714e-8f    , 1.02572388e-8f    , 1.83164978e-9f    , 3.77400365e-10f   , 8.81292041e-11f   , 2.30007517e-11f   , 6.63483008e-12f   , 2.09616671e-12f   , 7.19835333e-13f   , 2.6696976e-13f    , 1.06345708e-13f   , 4.52824377e-14f   , 2.0524244e-14f    , 9.86528925e-15f   , 5.01181621e-15f   , 2.6827658e-15f    , 1.50876257e-15f   , 8.89028961e-16f   , 5.47401387e-16f   , 3.51268996e-16f   , 2.3429531e-16f    , 1.61999705e-16f   , 1.158036e-16f     , 8.53532384e-17f   , 6.46930265e-17f   , 5.02940425e-17f   , 4.00062408e-17f   , },
+/* x = 36.5        */  {0.146689324f      , 0.0020094428f     , 8.25798411e-5f    , 5.6561535e-6f     , 5.42370884e-7f    , 6.68676432e-8f    , 1.00759462e-8f    , 1.79434659e-9f    , 3.68701352e-10f   , 8.58619567e-11f   , 2.23476306e-11f   , 6.42876853e-12f   , 2.02550049e-12f   , 6.93662623e-13f   , 2.56558221e-13f   , 1.01918462e-13f   , 4.32785155e-14f   , 1.95623332e-14f   , 9.37727366e-15f   , 4.75093752e-15f   , 2.53624489e-15f   , 1.4225391e-15f    , 8.36006784e-16f   , 5.1341944e-16f    , 3.28630514e-16f   , 2.18660397e-16f   , 1.50835535e-16f   , 1.07583523e-16f   , 7.91288715e-17f   , 5.98583493e-17f   , 4.64514581e-17f   , 3.68883941e-17f   , },
+};
@@ -136,6 +136,80 @@ SIMINT_DBLTYPE boys_F_taylor_single_vec(SIMINT_DBLTYPE x, int n)
 }
 
 
+// Only the first four terms of the Taylor series. Since F[n+4] <= F[n] and
+// |dx| <= BOYS_SHORTGRID_SPACE/2, the relative error is at most
+// (BOYS_SHORTGRID_SPACE/2)**4 / 4! (2.6e-7), plus rounding
+#define BOYS_REDUCED_RELERR 2.7e-7
+
+static inline
+void boys_F_taylor_reduced_vec(SIMINT_DBLTYPE * restrict F, SIMINT_DBLTYPE x, int n)
+{
+    double * restrict Fd = (double *)F;
+    double * restrict xd = (double *)&x;
+
+    #ifndef SIMINT_SCALAR
+      // workaround for GCC missing simdlen??
+      #if defined __clang__ || defined __INTEL_COMPILER
+        #pragma omp simd simdlen(SIMINT_SIMD_LEN)
+      #else
+        #pragma omp simd
+      #endif
+    #endif
+    for(int v = 0; v < SIMINT_SIMD_LEN; v++)
+    {
+        const int lookup_idx = (int)(BOYS_SHORTGRID_LOOKUPFAC*(xd[v]+BOYS_SHORTGRID_LOOKUPFAC2));
+        const double xi = ((double)lookup_idx * BOYS_SHORTGRID_SPACE);
+        const double dx = xi-xd[v];   // -delta x
+
+        double const * restrict gridpts = &(boys_shortgrid[lookup_idx][0]);
+
+        for(int i = 0; i <= n; ++i)
+        {
+            double const * restrict gridpts2 = gridpts + i;
+
+            Fd[i*SIMINT_SIMD_LEN + v] = gridpts2[0]
+                   + dx * (                  gridpts2[1]
+                   + dx * ( (1.0/2.0   )   * gridpts2[2]
+                   + dx * ( (1.0/6.0   )   * gridpts2[3]
+                   )));
+        }
+    }
+}
+
+static inline
+SIMINT_DBLTYPE boys_F_taylor_reduced_single_vec(SIMINT_DBLTYPE x, int n)
+{
+    SIMINT_DBLTYPE ret;
+    double * retd = (double *)&ret;
+    double * restrict xd = (double *)&x;
+
+    #ifndef SIMINT_SCALAR
+      // workaround for GCC missing simdlen??
+      #if defined __clang__ || defined __INTEL_COMPILER
+        #pragma omp simd simdlen(SIMINT_SIMD_LEN)
+      #else
+        #pragma omp simd
+      #endif
+    #endif
+    for(int v = 0; v < SIMINT_SIMD_LEN; v++)
+    {
+        const int lookup_idx = (int)(BOYS_SHORTGRID_LOOKUPFAC*(xd[v]+BOYS_SHORTGRID_LOOKUPFAC2));
+        const double xi = ((double)lookup_idx * BOYS_SHORTGRID_SPACE);
+        const double dx = xi-xd[v];   // -delta x
+
+        double const * restrict gridpts = &(boys_shortgrid[lookup_idx][n]);
+
+        retd[v] = gridpts[0]
+               + dx * (                  gridpts[1]
+               + dx * ( (1.0/2.0   )   * gridpts[2]
+               + dx * ( (1.0/6.0   )   * gridpts[3]
+               )));
+    }
+
+    return ret;
+}
+
+
 #ifdef __cplusplus
 }
 #endif
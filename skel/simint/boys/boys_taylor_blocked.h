@@ -0,0 +1,66 @@
+#pragma once
+
+#include "simint/boys/boys_shortgrid_blocked.h"
+#include "simint/vectorization/vectorization.h"
+
+#ifdef __cplusplus
+#include "simint/cpp_restrict.hpp"
+extern "C" {
+#endif
+
+// Taylor coefficients of F[m] (m = BOYS_BLOCKED_K * block) at each grid point,
+// already divided by j!. Each point is one 64-byte block
+// (8 doubles), aligned to the vector width
+extern const double boys_shortgrid_blocked[BOYS_BLOCKED_NBLOCK][BOYS_BLOCKED_NPOINT][BOYS_BLOCKED_NTERM];
+
+
+// Lowest order in the blocked table that is >= n
+#define BOYS_BLOCKED_ORDER(n) ((((n) + BOYS_BLOCKED_K - 1) / BOYS_BLOCKED_K) * BOYS_BLOCKED_K)
+
+
+// F[m] for m = BOYS_BLOCKED_ORDER(n). Lower orders down to n
+// must then be recurred down
+static inline
+SIMINT_DBLTYPE boys_F_taylor_blocked_single_vec(SIMINT_DBLTYPE x, int m)
+{
+    SIMINT_DBLTYPE ret;
+    double * retd = (double *)&ret;
+    double * restrict xd = (double *)&x;
+
+    double const * restrict block = &(boys_shortgrid_blocked[m / BOYS_BLOCKED_K][0][0]);
+
+    #ifndef SIMINT_SCALAR
+      // workaround for GCC missing simdlen??
+      #if defined __clang__ || defined __INTEL_COMPILER
+        #pragma omp simd simdlen(SIMINT_SIMD_LEN)
+      #else
+        #pragma omp simd
+      #endif
+    #endif
+    for(int v = 0; v < SIMINT_SIMD_LEN; v++)
+    {
+        const int lookup_idx = (int)(BOYS_BLOCKED_LOOKUPFAC*(xd[v]+BOYS_BLOCKED_LOOKUPFAC2));
+        const double xi = ((double)lookup_idx * BOYS_BLOCKED_SPACE);
+        const double dx = xi-xd[v];   // -delta x
+
+        double const * restrict gridpts = block + lookup_idx * BOYS_BLOCKED_NTERM;
+
+        retd[v] = gridpts[0]
+               + dx * ( gridpts[1]
+               + dx * ( gridpts[2]
+               + dx * ( gridpts[3]
+               + dx * ( gridpts[4]
+               + dx * ( gridpts[5]
+               + dx * ( gridpts[6]
+               + dx * ( gridpts[7]
+               )))))));
+    }
+
+    return ret;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -10,3 +10,9 @@
 
 // pi**2.5 * sqrt(2)
 #define SQRT_TWO_TIMES_PI_52 24.739429451193148050228357586821944304008810699990039583
+
+// pi**0.25 / sqrt(2)
+#define PI_14_OVER_SQRT_TWO 0.9413962637767148
+
+// sqrt(2) / pi**0.25
+#define SQRT_TWO_OVER_PI_14 1.062251932027197
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <stddef.h>
 #include "simint/shell/shell.h"
+#include "simint/vectorization/vectorization.h"
 
 #ifdef __cplusplus
 #include "simint/cpp_restrict.hpp"
@@ -15,6 +17,29 @@ void simint_osoei_overlap_terms(const double alpha1, const double * xyz1,
                                 double * restrict terms);
 
 
+/*! \brief Layout of the workspace of simint_osoei_potential_vrr
+ *
+ * \param [out] offsets Where each (i,j) block starts (in vectors), or NULL
+ * \return Size of the workspace (in vectors)
+ */
+int simint_osoei_potential_blocks(int am1, int am2, int * restrict offsets);
+
+
+/*! \brief Recurrence for the nuclear attraction integrals of a vector of
+ *         primitive pairs and/or point charges
+ *
+ * The Boys function values (times the prefactor) must be at the beginning of
+ * \p amwork. The integrals are left in block (am1, am2) of \p amwork.
+ */
+void simint_osoei_potential_vrr(int am1, int am2,
+                                SIMINT_DBLTYPE oo2p,
+                                SIMINT_DBLTYPE const * PA,
+                                SIMINT_DBLTYPE const * PB,
+                                SIMINT_DBLTYPE const * PC,
+                                int const * restrict offsets,
+                                SIMINT_DBLTYPE * restrict amwork);
+
+
 void simint_osoei_ke_terms(const double alpha1, const double * xyz1,
                            const double alpha2, const double * xyz2,
                            int nam1, int nam2,
@@ -35,6 +60,53 @@ int simint_compute_osoei_potential(int ncenter,
                                    struct simint_shell const * sh2,
                                    double * restrict integrals);
 
+int simint_compute_osoei_potential_centers(int ncenter,
+                                           double const * Z, double const * x,
+                                           double const * y, double const * z,
+                                           double cutoff, int nthread,
+                                           struct simint_shell const * sh1,
+                                           struct simint_shell const * sh2,
+                                           double * restrict integrals);
+
+
+/*! \brief Workspace needed by the multi shell pair one electron integrals
+ *
+ * \param [in] maxam Maximum angular momentum of the shells
+ * \return Size of the workspace (number of doubles)
+ */
+size_t simint_osoei_worksize(int maxam);
+
+
+/*! \brief Workspace needed by the multi shell pair one electron integrals (in bytes) */
+size_t simint_osoei_workmem(int maxam);
+
+
+/*! \brief One electron integrals of all the shell pairs in a multi shell pair
+ *
+ * These use the primitive pair data of \p P (from the gaussian product
+ * theorem) and are vectorized over the primitive pairs. The integrals of
+ * each shell pair follow each other in \p integrals, as for the ERIs.
+ *
+ * \param [in] P The shell pairs
+ * \param [in] work Workspace (aligned, at least simint_osoei_workmem(max(P->am1, P->am2)) bytes)
+ * \param [out] integrals Storage for the integrals (P->nshell12_clip * ncart1 * ncart2)
+ * \return The number of shell pairs computed
+ */
+int simint_compute_osoei_overlap_multi(struct simint_multi_shellpair const * P,
+                                       double * restrict work,
+                                       double * restrict integrals);
+
+int simint_compute_osoei_ke_multi(struct simint_multi_shellpair const * P,
+                                  double * restrict work,
+                                  double * restrict integrals);
+
+int simint_compute_osoei_potential_multi(int ncenter,
+                                         double const * Z, double const * x,
+                                         double const * y, double const * z,
+                                         struct simint_multi_shellpair const * P,
+                                         double * restrict work,
+                                         double * restrict integrals);
+
 #ifdef __cplusplus
 }
 #endif
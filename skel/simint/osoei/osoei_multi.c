@@ -0,0 +1,469 @@
+#include <string.h>
+
+#include "simint/boys/boys.h"
+#include "simint/constants.h"
+#include "simint/recur_lookup.h"
+#include "simint/osoei/osoei.h"
+
+#define NCART(am) ((am>=0)?((((am)+2)*((am)+1))>>1):0)
+#define S_IJ(i,j) (s_ij[((i)*(nam2) + j)])
+#define T_IJ(i,j) (t_ij[((i)*(nam2) + j)])
+
+
+/////////////////////////////////////////////////////////
+// General notes about the following
+//
+// These work on a multi shell pair the same way the ERI
+// kernels work on the ket: the primitive pairs of a batch of
+// (up to SIMINT_NSHELL_SIMD) shell pairs are stored one after
+// the other, with padding only at the end of the batch. A
+// vector of primitive pairs can therefore contain primitive
+// pairs of several shell pairs, and the lanes are contracted
+// into the integrals of their shell pair through shelloffsets.
+//
+// The terms are computed with an (s|s) value of one for each
+// direction, and everything that is common to all the terms
+// (the coefficients, exp(-mu*AB2), ...) is applied at the end
+// from P->prefac.
+/////////////////////////////////////////////////////////
+
+
+// Where we are within a batch of shell pairs
+struct osoei_batch
+{
+    int const * nprim12;  // number of primitive pairs of each shell pair in the batch
+    int nshellbatch;      // number of shell pairs in the batch
+    int ishell;           // shell pair of the first lane of the current vector
+    int iprim;            // primitive pairs handled so far
+    int nprim_ishell;     // primitive pairs up to the end of shell pair ishell
+};
+
+
+static void osoei_batch_start(struct simint_multi_shellpair const * P, int ab,
+                              struct osoei_batch * batch)
+{
+    batch->nprim12 = P->nprim12 + ab;
+    batch->nshellbatch = ((ab + SIMINT_NSHELL_SIMD) > P->nshell12_clip) ? P->nshell12_clip - ab : SIMINT_NSHELL_SIMD;
+    batch->ishell = 0;
+    batch->iprim = 0;
+    batch->nprim_ishell = batch->nprim12[0];
+}
+
+
+// Figure out the shell pair of each lane of the next vector, as an offset
+// from the shell pair of its first lane. \p dest is moved to the integrals
+// of the shell pair of the first lane. Returns the offset of the last lane.
+static int osoei_batch_offsets(struct osoei_batch * batch, int ncart12,
+                               int * restrict shelloffsets, double ** dest)
+{
+    int lastoffset = 0;
+
+    for(int n = 0; n < SIMINT_SIMD_LEN; n++)
+        shelloffsets[n] = 0;
+
+    if((batch->iprim + SIMINT_SIMD_LEN) >= batch->nprim_ishell)
+    {
+        // Handle if the first element of the vector is a new shell
+        if(batch->iprim >= batch->nprim_ishell && ((batch->ishell+1) < batch->nshellbatch))
+        {
+            batch->nprim_ishell += batch->nprim12[++batch->ishell];
+            *dest += ncart12;
+        }
+        batch->iprim++;
+        for(int n = 1; n < SIMINT_SIMD_LEN; ++n)
+        {
+            if(batch->iprim >= batch->nprim_ishell && ((batch->ishell+1) < batch->nshellbatch))
+            {
+                shelloffsets[n] = shelloffsets[n-1] + 1;
+                lastoffset++;
+                batch->nprim_ishell += batch->nprim12[++batch->ishell];
+            }
+            else
+                shelloffsets[n] = shelloffsets[n-1];
+            batch->iprim++;
+        }
+    }
+    else
+        batch->iprim += SIMINT_SIMD_LEN;
+
+    return lastoffset;
+}
+
+
+// Number of primitive pairs in a batch
+static int osoei_batch_nprim(struct osoei_batch const * batch)
+{
+    int nprim = 0;
+    for(int i = 0; i < batch->nshellbatch; i++)
+        nprim += batch->nprim12[i];
+    return nprim;
+}
+
+
+// Vectorized simint_osoei_overlap_terms (with (s|s) = 1)
+static void osoei_overlap_terms_vec(SIMINT_DBLTYPE oo2p,
+                                    SIMINT_DBLTYPE const * PA,
+                                    SIMINT_DBLTYPE const * PB,
+                                    int nam1, int nam2,
+                                    SIMINT_DBLTYPE * restrict terms)
+{
+    for(int d = 0; d < 3; d++)
+    {
+        SIMINT_DBLTYPE * const restrict s_ij = terms + d*nam1*nam2;
+
+        S_IJ(0,0) = SIMINT_DBLSET1(1.0);
+
+        for(int i = 1; i < nam1; i++)
+        {
+            S_IJ(i,0) = SIMINT_MUL(PA[d], S_IJ(i-1,0));
+            if(i > 1)
+                S_IJ(i,0) = SIMINT_FMADD(SIMINT_MUL(SIMINT_DBLSET1(i-1), oo2p), S_IJ(i-2,0), S_IJ(i,0));
+        }
+
+        for(int j = 1; j < nam2; j++)
+        {
+            S_IJ(0,j) = SIMINT_MUL(PB[d], S_IJ(0,j-1));
+            if(j > 1)
+                S_IJ(0,j) = SIMINT_FMADD(SIMINT_MUL(SIMINT_DBLSET1(j-1), oo2p), S_IJ(0,j-2), S_IJ(0,j));
+        }
+
+        for(int i = 1; i < nam1; i++)
+        for(int j = 1; j < nam2; j++)
+        {
+            S_IJ(i,j) = SIMINT_MUL(PB[d], S_IJ(i,j-1));
+            S_IJ(i,j) = SIMINT_FMADD(SIMINT_MUL(SIMINT_DBLSET1(i), oo2p), S_IJ(i-1,j-1), S_IJ(i,j));
+            if(j > 1)
+                S_IJ(i,j) = SIMINT_FMADD(SIMINT_MUL(SIMINT_DBLSET1(j-1), oo2p), S_IJ(i,j-2), S_IJ(i,j));
+        }
+    }
+}
+
+
+// Vectorized simint_osoei_ke_terms (with (s|s) = 1)
+static void osoei_ke_terms_vec(SIMINT_DBLTYPE alpha1, SIMINT_DBLTYPE alpha2,
+                               SIMINT_DBLTYPE oop,
+                               SIMINT_DBLTYPE const * PA,
+                               SIMINT_DBLTYPE const * PB,
+                               int nam1, int nam2,
+                               SIMINT_DBLTYPE * restrict terms)
+{
+    const SIMINT_DBLTYPE oo2p = SIMINT_MUL(SIMINT_DBLSET1(0.5), oop);
+    const SIMINT_DBLTYPE twomu = SIMINT_MUL(SIMINT_DBLSET1(2.0), SIMINT_MUL(SIMINT_MUL(alpha1, alpha2), oop));
+    const SIMINT_DBLTYPE a1sq = SIMINT_MUL(SIMINT_DBLSET1(2.0), SIMINT_MUL(alpha1, alpha1));
+    const SIMINT_DBLTYPE a1oop = SIMINT_MUL(alpha1, oop);
+    const SIMINT_DBLTYPE a2oop = SIMINT_MUL(alpha2, oop);
+
+    for(int d = 0; d < 3; d++)
+    {
+        SIMINT_DBLTYPE * const restrict s_ij = terms + d*nam1*nam2;
+        SIMINT_DBLTYPE * const restrict t_ij = terms + (d+3)*nam1*nam2;
+
+        S_IJ(0,0) = SIMINT_DBLSET1(1.0);
+        T_IJ(0,0) = SIMINT_SUB(alpha1, SIMINT_MUL(a1sq, SIMINT_FMADD(PA[d], PA[d], oo2p)));
+
+        for(int i = 1; i < nam1; i++)
+        {
+            S_IJ(i,0) = SIMINT_MUL(PA[d], S_IJ(i-1,0));
+            T_IJ(i,0) = SIMINT_MUL(PA[d], T_IJ(i-1,0));
+            if(i > 1)
+            {
+                const SIMINT_DBLTYPE im1 = SIMINT_DBLSET1(i-1);
+                S_IJ(i,0) = SIMINT_FMADD(SIMINT_MUL(im1, oo2p), S_IJ(i-2,0), S_IJ(i,0));
+                T_IJ(i,0) = SIMINT_FMADD(SIMINT_MUL(im1, oo2p), T_IJ(i-2,0), T_IJ(i,0));
+                T_IJ(i,0) = SIMINT_SUB(T_IJ(i,0), SIMINT_MUL(SIMINT_MUL(im1, a2oop), S_IJ(i-2,0)));
+            }
+            T_IJ(i,0) = SIMINT_FMADD(twomu, S_IJ(i,0), T_IJ(i,0));
+        }
+
+        for(int j = 1; j < nam2; j++)
+        {
+            S_IJ(0,j) = SIMINT_MUL(PB[d], S_IJ(0,j-1));
+            T_IJ(0,j) = SIMINT_MUL(PB[d], T_IJ(0,j-1));
+            if(j > 1)
+            {
+                const SIMINT_DBLTYPE jm1 = SIMINT_DBLSET1(j-1);
+                S_IJ(0,j) = SIMINT_FMADD(SIMINT_MUL(jm1, oo2p), S_IJ(0,j-2), S_IJ(0,j));
+                T_IJ(0,j) = SIMINT_FMADD(SIMINT_MUL(jm1, oo2p), T_IJ(0,j-2), T_IJ(0,j));
+                T_IJ(0,j) = SIMINT_SUB(T_IJ(0,j), SIMINT_MUL(SIMINT_MUL(jm1, a1oop), S_IJ(0,j-2)));
+            }
+            T_IJ(0,j) = SIMINT_FMADD(twomu, S_IJ(0,j), T_IJ(0,j));
+        }
+
+        for(int i = 1; i < nam1; i++)
+        for(int j = 1; j < nam2; j++)
+        {
+            const SIMINT_DBLTYPE ioo2p = SIMINT_MUL(SIMINT_DBLSET1(i), oo2p);
+            S_IJ(i,j) = SIMINT_MUL(PB[d], S_IJ(i,j-1));
+            S_IJ(i,j) = SIMINT_FMADD(ioo2p, S_IJ(i-1,j-1), S_IJ(i,j));
+            T_IJ(i,j) = SIMINT_MUL(PB[d], T_IJ(i,j-1));
+            T_IJ(i,j) = SIMINT_FMADD(ioo2p, T_IJ(i-1,j-1), T_IJ(i,j));
+            if(j > 1)
+            {
+                const SIMINT_DBLTYPE jm1 = SIMINT_DBLSET1(j-1);
+                S_IJ(i,j) = SIMINT_FMADD(SIMINT_MUL(jm1, oo2p), S_IJ(i,j-2), S_IJ(i,j));
+                T_IJ(i,j) = SIMINT_FMADD(SIMINT_MUL(jm1, oo2p), T_IJ(i,j-2), T_IJ(i,j));
+                T_IJ(i,j) = SIMINT_SUB(T_IJ(i,j), SIMINT_MUL(SIMINT_MUL(jm1, a1oop), S_IJ(i,j-2)));
+            }
+            T_IJ(i,j) = SIMINT_FMADD(twomu, S_IJ(i,j), T_IJ(i,j));
+        }
+    }
+}
+
+
+size_t simint_osoei_worksize(int maxam)
+{
+    const int nam = maxam + 1;
+    const int ncart = NCART(maxam);
+
+    size_t nterms = 6*nam*nam;
+    const size_t npot = simint_osoei_potential_blocks(maxam, maxam, NULL);
+    if(npot > nterms)
+        nterms = npot;
+
+    return SIMINT_SIMD_LEN * (ncart*ncart + nterms);
+}
+
+
+size_t simint_osoei_workmem(int maxam)
+{
+    return simint_osoei_worksize(maxam) * sizeof(double);
+}
+
+
+int simint_compute_osoei_overlap_multi(struct simint_multi_shellpair const * P,
+                                       double * restrict work,
+                                       double * restrict integrals)
+{
+    const int am1 = P->am1;
+    const int am2 = P->am2;
+    const int nam1 = am1 + 1;
+    const int nam2 = am2 + 1;
+    const int nam12 = nam1*nam2;
+    const int ncart1 = NCART(am1);
+    const int ncart2 = NCART(am2);
+    const int ncart12 = ncart1*ncart2;
+
+    struct RecurInfo const * aminfo1 = &recurinfo_array[am_recur_map[am1]];
+    struct RecurInfo const * aminfo2 = &recurinfo_array[am_recur_map[am2]];
+
+    SIMINT_DBLTYPE * restrict prim = (SIMINT_DBLTYPE *)work;
+    SIMINT_DBLTYPE * restrict terms = prim + ncart12;
+
+    memset(integrals, 0, P->nshell12_clip * ncart12 * sizeof(double));
+
+    int jstart = 0;
+    for(int ab = 0; ab < P->nshell12_clip; ab += SIMINT_NSHELL_SIMD)
+    {
+        struct osoei_batch batch;
+        osoei_batch_start(P, ab, &batch);
+        const int jend = jstart + osoei_batch_nprim(&batch);
+
+        double * dest = integrals + ab*ncart12;
+
+        for(int j = jstart; j < jend; j += SIMINT_SIMD_LEN)
+        {
+            int shelloffsets[SIMINT_SIMD_LEN];
+            const int lastoffset = osoei_batch_offsets(&batch, ncart12, shelloffsets, &dest);
+            const int nlane = ( ((j + SIMINT_SIMD_LEN) < jend) ? SIMINT_SIMD_LEN : (jend - j));
+
+            const SIMINT_DBLTYPE oop = SIMINT_DIV(SIMINT_DBLSET1(1.0), SIMINT_DBLLOAD(P->alpha, j));
+            const SIMINT_DBLTYPE oo2p = SIMINT_MUL(SIMINT_DBLSET1(0.5), oop);
+            const SIMINT_DBLTYPE PA[3] = { SIMINT_DBLLOAD(P->PA_x, j), SIMINT_DBLLOAD(P->PA_y, j), SIMINT_DBLLOAD(P->PA_z, j) };
+            const SIMINT_DBLTYPE PB[3] = { SIMINT_DBLLOAD(P->PB_x, j), SIMINT_DBLLOAD(P->PB_y, j), SIMINT_DBLLOAD(P->PB_z, j) };
+
+            // (pi/p)**1.5 * exp(-mu*AB2) * coefficients
+            const SIMINT_DBLTYPE fac = SIMINT_MUL(SIMINT_MUL(mask_load(nlane, P->prefac + j), SIMINT_SQRT(oop)),
+                                                  SIMINT_DBLSET1(PI_14_OVER_SQRT_TWO));
+
+            osoei_overlap_terms_vec(oo2p, PA, PB, nam1, nam2, terms);
+
+            int outidx = 0;
+            for(int n = 0; n < ncart1; n++)
+            for(int m = 0; m < ncart2; m++)
+            {
+                const int8_t * ijk1 = aminfo1[n].ijk;
+                const int8_t * ijk2 = aminfo2[m].ijk;
+                const int xidx = ijk1[0]*nam2 + ijk2[0];
+                const int yidx = ijk1[1]*nam2 + ijk2[1];
+                const int zidx = ijk1[2]*nam2 + ijk2[2];
+
+                SIMINT_DBLTYPE val = SIMINT_MUL(terms[0*nam12 + xidx], terms[1*nam12 + yidx]);
+                val = SIMINT_MUL(val, terms[2*nam12 + zidx]);
+                prim[outidx++] = SIMINT_MUL(val, fac);
+            }
+
+            contract(ncart12, shelloffsets, prim, dest);
+            dest += lastoffset*ncart12;
+        }
+
+        jstart = SIMINT_SIMD_ROUND(jend);
+    }
+
+    return P->nshell12_clip;
+}
+
+
+int simint_compute_osoei_ke_multi(struct simint_multi_shellpair const * P,
+                                  double * restrict work,
+                                  double * restrict integrals)
+{
+    const int am1 = P->am1;
+    const int am2 = P->am2;
+    const int nam1 = am1 + 1;
+    const int nam2 = am2 + 1;
+    const int nam12 = nam1*nam2;
+    const int ncart1 = NCART(am1);
+    const int ncart2 = NCART(am2);
+    const int ncart12 = ncart1*ncart2;
+
+    struct RecurInfo const * aminfo1 = &recurinfo_array[am_recur_map[am1]];
+    struct RecurInfo const * aminfo2 = &recurinfo_array[am_recur_map[am2]];
+
+    SIMINT_DBLTYPE * restrict prim = (SIMINT_DBLTYPE *)work;
+    SIMINT_DBLTYPE * restrict terms = prim + ncart12;
+
+    memset(integrals, 0, P->nshell12_clip * ncart12 * sizeof(double));
+
+    int jstart = 0;
+    for(int ab = 0; ab < P->nshell12_clip; ab += SIMINT_NSHELL_SIMD)
+    {
+        struct osoei_batch batch;
+        osoei_batch_start(P, ab, &batch);
+        const int jend = jstart + osoei_batch_nprim(&batch);
+
+        double * dest = integrals + ab*ncart12;
+
+        for(int j = jstart; j < jend; j += SIMINT_SIMD_LEN)
+        {
+            int shelloffsets[SIMINT_SIMD_LEN];
+            const int lastoffset = osoei_batch_offsets(&batch, ncart12, shelloffsets, &dest);
+            const int nlane = ( ((j + SIMINT_SIMD_LEN) < jend) ? SIMINT_SIMD_LEN : (jend - j));
+
+            const SIMINT_DBLTYPE p = SIMINT_DBLLOAD(P->alpha, j);
+            const SIMINT_DBLTYPE alpha1 = SIMINT_DBLLOAD(P->alpha1, j);
+            const SIMINT_DBLTYPE alpha2 = SIMINT_DBLLOAD(P->beta, j);
+            const SIMINT_DBLTYPE oop = SIMINT_DIV(SIMINT_DBLSET1(1.0), p);
+            const SIMINT_DBLTYPE PA[3] = { SIMINT_DBLLOAD(P->PA_x, j), SIMINT_DBLLOAD(P->PA_y, j), SIMINT_DBLLOAD(P->PA_z, j) };
+            const SIMINT_DBLTYPE PB[3] = { SIMINT_DBLLOAD(P->PB_x, j), SIMINT_DBLLOAD(P->PB_y, j), SIMINT_DBLLOAD(P->PB_z, j) };
+
+            // (pi/p)**1.5 * exp(-mu*AB2) * coefficients
+            const SIMINT_DBLTYPE fac = SIMINT_MUL(SIMINT_MUL(mask_load(nlane, P->prefac + j), SIMINT_SQRT(oop)),
+                                                  SIMINT_DBLSET1(PI_14_OVER_SQRT_TWO));
+
+            osoei_ke_terms_vec(alpha1, alpha2, oop, PA, PB, nam1, nam2, terms);
+
+            int outidx = 0;
+            for(int n = 0; n < ncart1; n++)
+            for(int m = 0; m < ncart2; m++)
+            {
+                const int8_t * ijk1 = aminfo1[n].ijk;
+                const int8_t * ijk2 = aminfo2[m].ijk;
+                const int xidx = ijk1[0]*nam2 + ijk2[0];
+                const int yidx = ijk1[1]*nam2 + ijk2[1];
+                const int zidx = ijk1[2]*nam2 + ijk2[2];
+
+                const SIMINT_DBLTYPE Sx = terms[0*nam12 + xidx];
+                const SIMINT_DBLTYPE Sy = terms[1*nam12 + yidx];
+                const SIMINT_DBLTYPE Sz = terms[2*nam12 + zidx];
+                const SIMINT_DBLTYPE Tx = terms[3*nam12 + xidx];
+                const SIMINT_DBLTYPE Ty = terms[4*nam12 + yidx];
+                const SIMINT_DBLTYPE Tz = terms[5*nam12 + zidx];
+
+                // Tij*Skl*Smn + Sij*Tkl*Smn + Sij*Skl*Tmn
+                SIMINT_DBLTYPE val = SIMINT_MUL(SIMINT_MUL(Tx, Sy), Sz);
+                val = SIMINT_FMADD(SIMINT_MUL(Sx, Ty), Sz, val);
+                val = SIMINT_FMADD(SIMINT_MUL(Sx, Sy), Tz, val);
+                prim[outidx++] = SIMINT_MUL(val, fac);
+            }
+
+            contract(ncart12, shelloffsets, prim, dest);
+            dest += lastoffset*ncart12;
+        }
+
+        jstart = SIMINT_SIMD_ROUND(jend);
+    }
+
+    return P->nshell12_clip;
+}
+
+
+int simint_compute_osoei_potential_multi(int ncenter,
+                                         double const * Z, double const * x,
+                                         double const * y, double const * z,
+                                         struct simint_multi_shellpair const * P,
+                                         double * restrict work,
+                                         double * restrict integrals)
+{
+    const int am1 = P->am1;
+    const int am2 = P->am2;
+    const int am12 = am1 + am2;
+    const int ncart12 = NCART(am1)*NCART(am2);
+
+    // offsets of the blocks of the recurrence
+    int offsets[(am1+1)*(am2+1)];
+    simint_osoei_potential_blocks(am1, am2, offsets);
+
+    SIMINT_DBLTYPE * restrict prim = (SIMINT_DBLTYPE *)work;
+    SIMINT_DBLTYPE * restrict amwork = prim + ncart12;
+    SIMINT_DBLTYPE const * restrict amintegrals = amwork + offsets[am1*(am2+1) + am2];
+
+    memset(integrals, 0, P->nshell12_clip * ncart12 * sizeof(double));
+
+    int jstart = 0;
+    for(int ab = 0; ab < P->nshell12_clip; ab += SIMINT_NSHELL_SIMD)
+    {
+        struct osoei_batch batch;
+        osoei_batch_start(P, ab, &batch);
+        const int jend = jstart + osoei_batch_nprim(&batch);
+
+        double * dest = integrals + ab*ncart12;
+
+        for(int j = jstart; j < jend; j += SIMINT_SIMD_LEN)
+        {
+            int shelloffsets[SIMINT_SIMD_LEN];
+            const int lastoffset = osoei_batch_offsets(&batch, ncart12, shelloffsets, &dest);
+            const int nlane = ( ((j + SIMINT_SIMD_LEN) < jend) ? SIMINT_SIMD_LEN : (jend - j));
+
+            const SIMINT_DBLTYPE p = SIMINT_DBLLOAD(P->alpha, j);
+            const SIMINT_DBLTYPE oo2p = SIMINT_DIV(SIMINT_DBLSET1(0.5), p);
+            const SIMINT_DBLTYPE Pxyz[3] = { SIMINT_DBLLOAD(P->x, j), SIMINT_DBLLOAD(P->y, j), SIMINT_DBLLOAD(P->z, j) };
+            const SIMINT_DBLTYPE PA[3] = { SIMINT_DBLLOAD(P->PA_x, j), SIMINT_DBLLOAD(P->PA_y, j), SIMINT_DBLLOAD(P->PA_z, j) };
+            const SIMINT_DBLTYPE PB[3] = { SIMINT_DBLLOAD(P->PB_x, j), SIMINT_DBLLOAD(P->PB_y, j), SIMINT_DBLLOAD(P->PB_z, j) };
+
+            for(int n = 0; n < ncart12; n++)
+                prim[n] = SIMINT_DBLSET1(0.0);
+
+            for(int c = 0; c < ncenter; c++)
+            {
+                const SIMINT_DBLTYPE PC[3] = { SIMINT_SUB(Pxyz[0], SIMINT_DBLSET1(x[c])),
+                                               SIMINT_SUB(Pxyz[1], SIMINT_DBLSET1(y[c])),
+                                               SIMINT_SUB(Pxyz[2], SIMINT_DBLSET1(z[c])) };
+                SIMINT_DBLTYPE PC2 = SIMINT_MUL(PC[0], PC[0]);
+                PC2 = SIMINT_FMADD(PC[1], PC[1], PC2);
+                PC2 = SIMINT_FMADD(PC[2], PC[2], PC2);
+
+                // (s|s) for all m goes at the beginning of the (0,0) block
+                boys_F_split(amwork, SIMINT_MUL(PC2, p), am12);
+
+                simint_osoei_potential_vrr(am1, am2, oo2p, PA, PB, PC, offsets, amwork);
+
+                const SIMINT_DBLTYPE Zc = SIMINT_DBLSET1(Z[c]);
+                for(int n = 0; n < ncart12; n++)
+                    prim[n] = SIMINT_FMADD(Zc, amintegrals[n], prim[n]);
+            }
+
+            // -2*pi/p * exp(-mu*AB2) * coefficients
+            const SIMINT_DBLTYPE fac = SIMINT_MUL(mask_load(nlane, P->prefac + j),
+                                                  SIMINT_DBLSET1(-SQRT_TWO_OVER_PI_14));
+            for(int n = 0; n < ncart12; n++)
+                prim[n] = SIMINT_MUL(prim[n], fac);
+
+            contract(ncart12, shelloffsets, prim, dest);
+            dest += lastoffset*ncart12;
+        }
+
+        jstart = SIMINT_SIMD_ROUND(jend);
+    }
+
+    return P->nshell12_clip;
+}
@@ -216,3 +216,194 @@ int simint_compute_osoei_potential(int ncenter,
     return 1;
 }
 
+
+
+// Squared distance from (x,y,z) to the segment between A and B. The
+// centers P of all the primitive pairs lie on this segment.
+static double dist2_segment(double const * A, double const * AB, double AB2,
+                            double x, double y, double z)
+{
+    const double AC[3] = { x - A[0], y - A[1], z - A[2] };
+
+    double t = 0.0;
+    if(AB2 > 0.0)
+    {
+        t = -(AC[0]*AB[0] + AC[1]*AB[1] + AC[2]*AB[2]) / AB2;  // AB = A - B
+        t = (t < 0.0) ? 0.0 : ((t > 1.0) ? 1.0 : t);
+    }
+
+    const double d[3] = { AC[0] + t*AB[0], AC[1] + t*AB[1], AC[2] + t*AB[2] };
+    return d[0]*d[0] + d[1]*d[1] + d[2]*d[2];
+}
+
+
+int simint_compute_osoei_potential_centers(int ncenter,
+                                           double const * Z, double const * x,
+                                           double const * y, double const * z,
+                                           double cutoff, int nthread,
+                                           struct simint_shell const * sh1,
+                                           struct simint_shell const * sh2,
+                                           double * restrict integrals)
+{
+    const int am1 = sh1->am;
+    const int am2 = sh2->am;
+    const int am12 = am1 + am2;
+    const int ncart12 = NCART(am1)*NCART(am2);
+
+    const double A[3] = { sh1->x, sh1->y, sh1->z };
+    const double B[3] = { sh2->x, sh2->y, sh2->z };
+    const double AB[3] = { A[0] - B[0], A[1] - B[1], A[2] - B[2] };
+    const double AB2 = AB[0]*AB[0] + AB[1]*AB[1] + AB[2]*AB[2];
+
+    memset(integrals, 0, ncart12*sizeof(double));
+
+    ////////////////////////////////////////////
+    // Pack the charges that contribute, padded
+    // to a whole number of vectors with Z = 0
+    ////////////////////////////////////////////
+    const int ncenter_pad = ((ncenter + SIMINT_SIMD_LEN - 1) / SIMINT_SIMD_LEN) * SIMINT_SIMD_LEN;
+    double * cZ = (double *)SIMINT_ALLOC(4 * (ncenter_pad + SIMINT_SIMD_LEN) * sizeof(double));
+    if(cZ == NULL)
+        return -1;
+
+    double * cx = cZ + ncenter_pad + SIMINT_SIMD_LEN;
+    double * cy = cx + ncenter_pad + SIMINT_SIMD_LEN;
+    double * cz = cy + ncenter_pad + SIMINT_SIMD_LEN;
+
+    const double cutoff2 = cutoff*cutoff;
+    int nkeep = 0;
+    for(int c = 0; c < ncenter; c++)
+    {
+        if(Z[c] == 0.0)
+            continue;
+        if(cutoff > 0.0 && dist2_segment(A, AB, AB2, x[c], y[c], z[c]) > cutoff2)
+            continue;
+
+        cZ[nkeep] = Z[c];
+        cx[nkeep] = x[c];
+        cy[nkeep] = y[c];
+        cz[nkeep] = z[c];
+        nkeep++;
+    }
+
+    const int nvec = (nkeep + SIMINT_SIMD_LEN - 1) / SIMINT_SIMD_LEN;
+    for(int c = nkeep; c < nvec*SIMINT_SIMD_LEN; c++)
+    {
+        cZ[c] = 0.0;
+        cx[c] = A[0];
+        cy[c] = A[1];
+        cz[c] = A[2];
+    }
+
+    ////////////////////////////////////////////
+    // Primitive pairs. Everything but the Boys
+    // function and the charge goes into K
+    ////////////////////////////////////////////
+    const int nprim12 = sh1->nprim * sh2->nprim;
+    double pp[nprim12], K[nprim12];
+    double PA[nprim12][3], PB[nprim12][3], Pxyz[nprim12][3];
+
+    for(int a = 0, ab = 0; a < sh1->nprim; a++)
+    for(int b = 0; b < sh2->nprim; b++, ab++)
+    {
+        const double a1 = sh1->alpha[a];
+        const double a2 = sh2->alpha[b];
+        const double p = a1 + a2;
+        const double oop = 1.0/p;
+        const double mu = a1*a2*oop;
+
+        pp[ab] = p;
+        K[ab] = -sh1->coef[a] * sh2->coef[b] * 2*PI*oop*exp(-mu*AB2);
+
+        for(int d = 0; d < 3; d++)
+        {
+            Pxyz[ab][d] = (a1*A[d] + a2*B[d])*oop;
+            PA[ab][d] = Pxyz[ab][d] - A[d];
+            PB[ab][d] = Pxyz[ab][d] - B[d];
+        }
+    }
+
+    const int nblock = simint_osoei_potential_blocks(am1, am2, NULL);
+
+    if(nthread < 1)
+        nthread = 1;
+
+    int ret = 1;
+
+    #pragma omp parallel num_threads(nthread) if(nthread > 1 && nvec > 1) reduction(min:ret)
+    {
+        // offsets of the blocks of the recurrence
+        int offsets[(am1+1)*(am2+1)];
+        simint_osoei_potential_blocks(am1, am2, offsets);
+
+        // each thread accumulates over its own charges
+        SIMINT_DBLTYPE * amwork = (SIMINT_DBLTYPE *)SIMINT_ALLOC((nblock + ncart12) * sizeof(SIMINT_DBLTYPE));
+        if(amwork == NULL)
+            ret = -1;
+        else
+        {
+            for(int n = 0; n < ncart12; n++)
+                amwork[nblock+n] = SIMINT_DBLSET1(0.0);
+        }
+
+        #pragma omp for schedule(static)
+        for(int v = 0; v < nvec; v++)
+        {
+            // (every thread must still get to the end of the loop)
+            if(ret == -1)
+                continue;
+
+            SIMINT_DBLTYPE * prim = amwork + nblock;
+            SIMINT_DBLTYPE const * amintegrals = amwork + offsets[am1*(am2+1) + am2];
+
+            const int c = v*SIMINT_SIMD_LEN;
+            const SIMINT_DBLTYPE Zc = SIMINT_DBLLOAD(cZ, c);
+            const SIMINT_DBLTYPE C[3] = { SIMINT_DBLLOAD(cx, c), SIMINT_DBLLOAD(cy, c), SIMINT_DBLLOAD(cz, c) };
+
+            for(int ab = 0; ab < nprim12; ab++)
+            {
+                const SIMINT_DBLTYPE p = SIMINT_DBLSET1(pp[ab]);
+                const SIMINT_DBLTYPE oo2p = SIMINT_DBLSET1(0.5/pp[ab]);
+                const SIMINT_DBLTYPE vPA[3] = { SIMINT_DBLSET1(PA[ab][0]), SIMINT_DBLSET1(PA[ab][1]), SIMINT_DBLSET1(PA[ab][2]) };
+                const SIMINT_DBLTYPE vPB[3] = { SIMINT_DBLSET1(PB[ab][0]), SIMINT_DBLSET1(PB[ab][1]), SIMINT_DBLSET1(PB[ab][2]) };
+                const SIMINT_DBLTYPE PC[3] = { SIMINT_SUB(SIMINT_DBLSET1(Pxyz[ab][0]), C[0]),
+                                               SIMINT_SUB(SIMINT_DBLSET1(Pxyz[ab][1]), C[1]),
+                                               SIMINT_SUB(SIMINT_DBLSET1(Pxyz[ab][2]), C[2]) };
+                SIMINT_DBLTYPE PC2 = SIMINT_MUL(PC[0], PC[0]);
+                PC2 = SIMINT_FMADD(PC[1], PC[1], PC2);
+                PC2 = SIMINT_FMADD(PC[2], PC[2], PC2);
+
+                // one value of T for each charge
+                boys_F_split(amwork, SIMINT_MUL(PC2, p), am12);
+
+                // the recurrence is linear in (s|s), so the
+                // charges and prefactor can be applied here
+                const SIMINT_DBLTYPE fac = SIMINT_MUL(Zc, SIMINT_DBLSET1(K[ab]));
+                for(int m = 0; m <= am12; m++)
+                    amwork[m] = SIMINT_MUL(amwork[m], fac);
+
+                simint_osoei_potential_vrr(am1, am2, oo2p, vPA, vPB, PC, offsets, amwork);
+
+                for(int n = 0; n < ncart12; n++)
+                    prim[n] = SIMINT_ADD(prim[n], amintegrals[n]);
+            }
+        }
+
+        if(amwork != NULL)
+        {
+            double sum[ncart12];
+            memset(sum, 0, ncart12*sizeof(double));
+            contract_all(ncart12, amwork + nblock, sum);
+
+            #pragma omp critical
+            for(int n = 0; n < ncart12; n++)
+                integrals[n] += sum[n];
+
+            SIMINT_FREE(amwork);
+        }
+    }
+
+    SIMINT_FREE(cZ);
+
+    return ret;
+}
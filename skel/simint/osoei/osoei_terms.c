@@ -1,7 +1,9 @@
 #include <math.h>
 #include "simint/constants.h"
+#include "simint/recur_lookup.h"
 #include "simint/osoei/osoei.h"
 
+#define NCART(am) ((am>=0)?((((am)+2)*((am)+1))>>1):0)
 #define S_IJ(i,j) (s_ij[((i)*(nam2) + j)])
 #define T_IJ(i,j) (t_ij[((i)*(nam2) + j)])
 
@@ -164,3 +166,153 @@ void simint_osoei_ke_terms(const double alpha1, const double * xyz1,
         }
     }
 }
+
+
+// Offsets (in vectors) of the blocks of the nested recurrence of the
+// potential integrals, and the total size. Block (i,0) holds
+// m = [0, am1+am2-i], block (i,j>0) holds m = [0, am2-j]
+int simint_osoei_potential_blocks(int am1, int am2, int * restrict offsets)
+{
+    const int nam2 = am2 + 1;
+    int size = 0;
+
+    for(int i = 0; i <= am1; i++)
+    for(int j = 0; j <= am2; j++)
+    {
+        const int nm = (j == 0) ? (am1 + am2 - i + 1) : (am2 - j + 1);
+        if(offsets != NULL)
+            offsets[i*nam2 + j] = size;
+        size += NCART(i) * NCART(j) * nm;
+    }
+
+    return size;
+}
+
+
+// Nested vertical recurrence of simint_compute_osoei_potential, for
+// a vector of primitive pairs (or of point charges). The (m) values of
+// (s|s) must already be in the (0,0) block. The result is in block
+// (am1,am2) (m = 0)
+void simint_osoei_potential_vrr(int am1, int am2,
+                                SIMINT_DBLTYPE oo2p,
+                                SIMINT_DBLTYPE const * PA,
+                                SIMINT_DBLTYPE const * PB,
+                                SIMINT_DBLTYPE const * PC,
+                                int const * restrict offsets,
+                                SIMINT_DBLTYPE * restrict amwork)
+{
+    const int am12 = am1 + am2;
+    const int nam2 = am2 + 1;
+
+    #define AMWORK(i,j) (amwork + offsets[(i)*nam2 + (j)])
+
+    for(int i = 0; i <= am1; i++)
+    {
+        const int arrstart1 = am_recur_map[i];
+        struct RecurInfo const * aminfo1 =  &recurinfo_array[arrstart1];
+
+        // number of cartesians in the previous two shells
+        const int incart   = NCART(i);
+        const int incart_1 = (i > 0) ? NCART(i-1) : 0;
+        const int incart_2 = (i > 1) ? NCART(i-2) : 0;
+
+        // form (i,0), except for (0,0)
+        if(i > 0)
+        {
+            SIMINT_DBLTYPE * iwork = AMWORK(i,0);
+            SIMINT_DBLTYPE const * iwork14 = AMWORK(i-1,0);                  // 1st and 4th terms
+            SIMINT_DBLTYPE const * iwork25 = (i > 1) ? AMWORK(i-2,0) : NULL; // 2nd and 5th terms
+
+            int idx = 0;
+            for(int m = 0; m <= am12 - i; m++)
+            {
+                const int offset_1 = m*incart_1;
+                const int offset_4 = offset_1 + incart_1;
+                const int offset_2 = m*incart_2;
+                const int offset_5 = offset_2 + incart_2;
+
+                for(int n = 0; n < incart; n++)
+                {
+                    const int8_t d = aminfo1[n].dir;
+                    const int8_t i_ijk = aminfo1[n].ijk[d];
+                    const int idx1 = offset_1 + aminfo1[n].idx[d][0];
+                    const int idx4 = offset_4 + aminfo1[n].idx[d][0];
+
+                    SIMINT_DBLTYPE val = SIMINT_MUL(PA[d], iwork14[idx1]);
+                    val = SIMINT_SUB(val, SIMINT_MUL(PC[d], iwork14[idx4]));
+
+                    if(i_ijk > 1)
+                    {
+                        const int idx2 = offset_2 + aminfo1[n].idx[d][1];
+                        const int idx5 = offset_5 + aminfo1[n].idx[d][1];
+                        const SIMINT_DBLTYPE fac = SIMINT_MUL(oo2p, SIMINT_DBLSET1(i_ijk-1));
+                        val = SIMINT_FMADD(fac, SIMINT_SUB(iwork25[idx2], iwork25[idx5]), val);
+                    }
+
+                    iwork[idx++] = val;
+                }
+            }
+        }
+
+        // now (i,j) via the second vertical recurrence
+        for(int j = 1; j <= am2; j++)
+        {
+            const int arrstart2 = am_recur_map[j];
+            struct RecurInfo const * aminfo2 =  &recurinfo_array[arrstart2];
+
+            const int jncart   = NCART(j);
+            const int jncart_1 = NCART(j-1);
+            const int jncart_2 = (j > 1) ? NCART(j-2) : 0;
+
+            SIMINT_DBLTYPE * jwork = AMWORK(i,j);
+            SIMINT_DBLTYPE const * jwork14 = AMWORK(i,j-1);                          // 1st and 4th terms
+            SIMINT_DBLTYPE const * jwork36 = (j > 1) ? AMWORK(i,j-2) : NULL;         // 3rd and 6th terms
+            SIMINT_DBLTYPE const * jwork25 = (i > 0) ? AMWORK(i-1,j-1) : NULL;       // 2nd and 5th terms
+
+            int cartidx = 0;
+            for(int m = 0; m <= am2 - j; m++)
+            {
+                for(int n = 0; n < incart; n++)
+                {
+                    // storage is m, cart1, cart2
+                    const int offset1 = jncart_1*(m*incart + n);
+                    const int offset4 = jncart_1*((m+1)*incart + n);
+                    const int offset3 = jncart_2*(m*incart + n);
+                    const int offset6 = jncart_2*((m+1)*incart + n);
+
+                    for(int o = 0; o < jncart; o++)
+                    {
+                        const int8_t d = aminfo2[o].dir;
+                        const int8_t i_ijk = aminfo1[n].ijk[d];
+                        const int8_t j_ijk = aminfo2[o].ijk[d];
+                        const int idx1 = offset1 + aminfo2[o].idx[d][0];
+                        const int idx4 = offset4 + aminfo2[o].idx[d][0];
+
+                        SIMINT_DBLTYPE val = SIMINT_MUL(PB[d], jwork14[idx1]);
+                        val = SIMINT_SUB(val, SIMINT_MUL(PC[d], jwork14[idx4]));
+
+                        if(i_ijk > 0)
+                        {
+                            const int idx2 = jncart_1*(m*incart_1 + aminfo1[n].idx[d][0]) + aminfo2[o].idx[d][0];
+                            const int idx5 = jncart_1*((m+1)*incart_1 + aminfo1[n].idx[d][0]) + aminfo2[o].idx[d][0];
+                            const SIMINT_DBLTYPE fac = SIMINT_MUL(oo2p, SIMINT_DBLSET1(i_ijk));
+                            val = SIMINT_FMADD(fac, SIMINT_SUB(jwork25[idx2], jwork25[idx5]), val);
+                        }
+
+                        if(j_ijk > 1)
+                        {
+                            const int idx3 = offset3 + aminfo2[o].idx[d][1];
+                            const int idx6 = offset6 + aminfo2[o].idx[d][1];
+                            const SIMINT_DBLTYPE fac = SIMINT_MUL(oo2p, SIMINT_DBLSET1(j_ijk-1));
+                            val = SIMINT_FMADD(fac, SIMINT_SUB(jwork36[idx3], jwork36[idx6]), val);
+                        }
+
+                        jwork[cartidx++] = val;
+                    }
+                }
+            }
+        }
+    }
+
+    #undef AMWORK
+}
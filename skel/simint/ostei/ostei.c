@@ -1,11 +1,73 @@
+#include <math.h>
+
+#ifdef __SSE__
+#include <xmmintrin.h>
+#include <pmmintrin.h>
+#endif
+
 #include "simint/ostei/ostei.h"
 #include "simint/ostei/ostei_config.h"
+#include "simint/simint_stats.h"
 
 // This is the actual storage for this array
 #define AMSIZE   SIMINT_OSTEI_MAXAM+1
 #define DERSIZE  SIMINT_OSTEI_MAXDER+1
 simint_osteifunc simint_osteifunc_array[DERSIZE][AMSIZE][AMSIZE][AMSIZE][AMSIZE];
 
+// Single precision kernels (NULL if not generated)
+simint_osteifunc simint_osteifunc_f32_array[AMSIZE][AMSIZE][AMSIZE][AMSIZE];
+
+// Fused J/K kernels (NULL if not generated)
+simint_osteifunc_jk simint_osteifunc_jk_array[AMSIZE][AMSIZE][AMSIZE][AMSIZE];
+
+// Diagonal (ab|ab) kernels, for am1 >= am2 only
+simint_osteifunc_schwarz simint_osteifunc_schwarz_array[AMSIZE][AMSIZE];
+
+
+// Square of the largest density bound of the shell pairs in P and Q,
+// which scales the screening estimate (1.0 if the bounds were not given)
+static double simint_density_weight(struct simint_multi_shellpair const * P,
+                                    struct simint_multi_shellpair const * Q)
+{
+    if(P->density_max == NULL || Q->density_max == NULL)
+        return 1.0;
+
+    double dmax = 0.0;
+    for(int ab = 0; ab < P->nshell12_clip; ab++)
+        dmax = (P->density_max[ab] > dmax ? P->density_max[ab] : dmax);
+    for(int cd = 0; cd < Q->nshell12_clip; cd++)
+        dmax = (Q->density_max[cd] > dmax ? Q->density_max[cd] : dmax);
+
+    return dmax*dmax;
+}
+
+
+// For SIMINT_SCREEN_QQR, 1/R**2, where R is the distance between the
+// spheres containing all the charge distributions of P and Q (once it
+// is larger than one bohr). 1.0 if P or Q were not created for QQR.
+// The kernels check each shell pair and primitive pair themselves.
+static double simint_qqr_weight(struct simint_multi_shellpair const * P,
+                                struct simint_multi_shellpair const * Q)
+{
+    if(P->extent12 == NULL || Q->extent12 == NULL)
+        return 1.0;
+
+    const double dx = P->C_all_x - Q->C_all_x;
+    const double dy = P->C_all_y - Q->C_all_y;
+    const double dz = P->C_all_z - Q->C_all_z;
+    const double r = sqrt(dx*dx + dy*dy + dz*dz) - P->extent_all - Q->extent_all;
+
+    return (r > 1.0 ? 1.0/(r*r) : 1.0);
+}
+
+
+// Everything that multiplies screen_max of P and Q in the screening estimate
+static double simint_screen_weight(struct simint_multi_shellpair const * P,
+                                   struct simint_multi_shellpair const * Q)
+{
+    return simint_density_weight(P, Q) * simint_qqr_weight(P, Q);
+}
+
 
 int simint_compute_ostei(struct simint_multi_shellpair const * P,
                          struct simint_multi_shellpair const * Q,
@@ -16,14 +78,120 @@ int simint_compute_ostei(struct simint_multi_shellpair const * P,
     // don't forget that we don't include the square root in the screen values
     // stored in the shell pair
     double screen_tol2 = screen_tol * screen_tol;
-    if(screen_tol > 0.0 && (P->screen_max * Q->screen_max) < screen_tol2 )
+    if(screen_tol > 0.0 && (P->screen_max * Q->screen_max * simint_screen_weight(P, Q)) < screen_tol2 )
+    {
+        simint_stats_add_skipped((long)P->nshell12_clip * Q->nshell12_clip);
+        return -1;
+    }
+
+    return simint_osteifunc_array[0][P->am1][P->am2][Q->am1][Q->am2](*P, *Q,
+                                                screen_tol2, work, integrals);
+}
+
+
+int simint_compute_ostei_density(struct simint_multi_shellpair const * P,
+                                 struct simint_multi_shellpair const * Q,
+                                 double screen_tol,
+                                 double const * P_density_max,
+                                 double const * Q_density_max,
+                                 double * restrict work,
+                                 double * restrict integrals)
+{
+    // the kernels take the shell pairs by value, so the
+    // bounds are only attached to these copies
+    struct simint_multi_shellpair Pd = *P;
+    struct simint_multi_shellpair Qd = *Q;
+    Pd.density_max = P_density_max;
+    Qd.density_max = Q_density_max;
+
+    return simint_compute_ostei(&Pd, &Qd, screen_tol, work, integrals);
+}
+
+
+int simint_compute_ostei_mixed(struct simint_multi_shellpair const * P,
+                               struct simint_multi_shellpair const * Q,
+                               double screen_tol,
+                               double single_tol,
+                               double * restrict work,
+                               double * restrict integrals)
+{
+    // don't forget that we don't include the square root in the screen values
+    // stored in the shell pair
+    const double screen_pq = P->screen_max * Q->screen_max;
+
+    double screen_tol2 = screen_tol * screen_tol;
+    if(screen_tol > 0.0 && (screen_pq * simint_screen_weight(P, Q)) < screen_tol2 )
+    {
+        simint_stats_add_skipped((long)P->nshell12_clip * Q->nshell12_clip);
         return -1;
+    }
+
+    // screen_max is zero if there is no screening information,
+    // in which case nothing is known about the magnitude
+    simint_osteifunc f32func = simint_osteifunc_f32_array[P->am1][P->am2][Q->am1][Q->am2];
+    if(f32func != NULL && screen_pq > 0.0 && screen_pq < (single_tol * single_tol))
+    {
+        // The smallest primitive integrals are denormal in single precision,
+        // which is very slow. They can't matter, so flush them to zero
+        // (FTZ and DAZ) while in the kernel. The saved MXCSR is
+        // restored before returning, whatever the kernel returned
+        #ifdef __SSE__
+        const unsigned int csr = _mm_getcsr();
+        _mm_setcsr(csr | _MM_FLUSH_ZERO_ON | _MM_DENORMALS_ZERO_ON);
+        #endif
+
+        const int ret = f32func(*P, *Q, screen_tol2, work, integrals);
+
+        #ifdef __SSE__
+        _mm_setcsr(csr);
+        #endif
+
+        return ret;
+    }
 
     return simint_osteifunc_array[0][P->am1][P->am2][Q->am1][Q->am2](*P, *Q,
                                                 screen_tol2, work, integrals);
 }
 
 
+int simint_compute_ostei_jk(struct simint_multi_shellpair const * P,
+                            struct simint_multi_shellpair const * Q,
+                            double screen_tol,
+                            struct simint_jk const * jk,
+                            double * restrict work)
+{
+    // don't forget that we don't include the square root in the screen values
+    // stored in the shell pair
+    double screen_tol2 = screen_tol * screen_tol;
+    if(screen_tol > 0.0 && (P->screen_max * Q->screen_max * simint_screen_weight(P, Q)) < screen_tol2 )
+    {
+        simint_stats_add_skipped((long)P->nshell12_clip * Q->nshell12_clip);
+        return -1;
+    }
+
+    simint_osteifunc_jk jkfunc = simint_osteifunc_jk_array[P->am1][P->am2][Q->am1][Q->am2];
+    if(jkfunc == NULL)
+        return -2;
+
+    return jkfunc(*P, *Q, screen_tol2, work, jk);
+}
+
+
+int simint_compute_ostei_schwarz(struct simint_multi_shellpair const * P,
+                                 double * restrict work,
+                                 double * restrict diag)
+{
+    if(P->am1 > SIMINT_OSTEI_MAXAM || P->am2 > SIMINT_OSTEI_MAXAM)
+        return -2;
+
+    simint_osteifunc_schwarz sfunc = simint_osteifunc_schwarz_array[P->am1][P->am2];
+    if(sfunc == NULL)
+        return -2;
+
+    return sfunc(*P, work, diag);
+}
+
+
 int simint_compute_ostei_deriv(int deriv,
                                struct simint_multi_shellpair const * P,
                                struct simint_multi_shellpair const * Q,
@@ -34,8 +202,11 @@ int simint_compute_ostei_deriv(int deriv,
     // don't forget that we don't include the square root in the screen values
     // stored in the shell pair
     double screen_tol2 = screen_tol * screen_tol;
-    if(screen_tol > 0.0 && (P->screen_max * Q->screen_max) < screen_tol2 )
+    if(screen_tol > 0.0 && (P->screen_max * Q->screen_max * simint_screen_weight(P, Q)) < screen_tol2 )
+    {
+        simint_stats_add_skipped((long)P->nshell12_clip * Q->nshell12_clip);
         return -1;
+    }
 
     return simint_osteifunc_array[deriv][P->am1][P->am2][Q->am1][Q->am2](*P, *Q,
                                                   screen_tol2, work, integrals);
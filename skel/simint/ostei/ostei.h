@@ -1,6 +1,7 @@
 #pragma once
 
 #include "simint/shell/shell.h"
+#include "simint/ostei/ostei_isa.h"
 
 #ifdef __cplusplus
 #include "simint/cpp_restrict.hpp"
@@ -15,6 +16,36 @@ typedef int (*simint_osteifunc)(struct simint_multi_shellpair const,
                                 double * restrict);
 
 
+/*! \brief Density and Fock contributions for fused J/K digestion
+ *
+ * Matrices are square (nbf x nbf), row major, and indexed by cartesian
+ * basis functions.
+ */
+struct simint_jk
+{
+    int nbf;              //!< Number of basis functions (rows of D, J, and K)
+    int const * P_bf;     //!< First basis function of both shells of each bra shell pair (2*nshell12)
+    int const * Q_bf;     //!< First basis function of both shells of each ket shell pair (2*nshell12)
+    double const * D;     //!< Density matrix
+    double * J;           //!< Coulomb matrix to add to (may be NULL)
+    double * K;           //!< Exchange matrix to add to (may be NULL)
+};
+
+
+//! A pointer to a function that calculates TEI and digests them into J and K
+typedef int (*simint_osteifunc_jk)(struct simint_multi_shellpair const,
+                                   struct simint_multi_shellpair const,
+                                   double,
+                                   double * restrict,
+                                   struct simint_jk const * restrict);
+
+
+//! A pointer to a function that calculates only the diagonal (ab|ab) TEI
+typedef int (*simint_osteifunc_schwarz)(struct simint_multi_shellpair const,
+                                        double * restrict,
+                                        double * restrict);
+
+
 /*! \brief Compute an ostei given shell pair information
  *
  * \param [in] P The shell pairs for the bra side of the integral 
@@ -31,6 +62,113 @@ int simint_compute_ostei(struct simint_multi_shellpair const * P,
                          double * restrict work,
                          double * restrict integrals);
 
+/*! \brief Compute an ostei, screening with bounds on the density
+ *
+ * In direct SCF, an integral only matters through its product with the
+ * density. Given a bound on the density for each shell pair, a quartet
+ * (ab|cd) is screened if its Schwarz estimate times max(\p P_density_max[ab],
+ * \p Q_density_max[cd]) is below \p screen_tol. This is used for the
+ * whole call (returning -1) and for the primitives inside the kernels.
+ *
+ * For the Coulomb and exchange matrices, a suitable bound for a pair of
+ * shells a and b is the largest |D| in the rows of D for a and b, which
+ * also covers the D(a,c), D(b,d), etc. used in exchange. With difference
+ * densities, this is the bound on the change in the density.
+ *
+ * The bounds may also be set in the density_max member of the shell pairs
+ * directly, which is what this function does on copies of \p P and \p Q.
+ * The other simint_compute_ostei functions use them if they are set in both.
+ *
+ * \param [in] P The shell pairs for the bra side of the integral
+ * \param [in] Q The shell pairs for the ket side of the integral
+ * \param [in] screen_tol Tolerance for screening (set to zero to disable)
+ * \param [in] P_density_max Bound on the density for each shell pair in \p P
+ * \param [in] Q_density_max Bound on the density for each shell pair in \p Q
+ * \param [in] work Workspace to use in calculating the integrals
+ * \param [inout] integrals Storage for the final integrals. Since size information
+ *                          is not passed, you are expected to ensure that this buffer
+ *                          is large enough
+ */
+int simint_compute_ostei_density(struct simint_multi_shellpair const * P,
+                                 struct simint_multi_shellpair const * Q,
+                                 double screen_tol,
+                                 double const * P_density_max,
+                                 double const * Q_density_max,
+                                 double * restrict work,
+                                 double * restrict integrals);
+
+/*! \brief Compute an ostei, using single precision kernels for small integrals
+ *
+ * Shell quartets whose screening estimate is below \p single_tol are computed
+ * with the single precision kernels (Boys function and VRR in single precision,
+ * accumulated in double precision). All others use the double precision kernels,
+ * as do all quartets if the library was not generated with single precision
+ * kernels or if the shell pairs do not contain screening information.
+ *
+ * \param [in] P The shell pairs for the bra side of the integral 
+ * \param [in] Q The shell pairs for the ket side of the integral
+ * \param [in] screen_tol Tolerance for screening (set to zero to disable)
+ * \param [in] single_tol Magnitude below which single precision is used
+ *                        (set to zero to disable)
+ * \param [in] work Workspace to use in calculating the integrals
+ * \param [inout] integrals Storage for the final integrals. Since size information
+ *                          is not passed, you are expected to ensure that this buffer
+ *                          is large enough
+ */
+int simint_compute_ostei_mixed(struct simint_multi_shellpair const * P,
+                               struct simint_multi_shellpair const * Q,
+                               double screen_tol,
+                               double single_tol,
+                               double * restrict work,
+                               double * restrict integrals);
+
+/*! \brief Compute an ostei and contract it with a density into J and K
+ *
+ * For each shell quartet (12|34) of the shell pairs, in the order they were
+ * given, this adds
+ *
+ *    J(1,2) += (12|34) D(3,4)
+ *    K(1,3) += (12|34) D(2,4)
+ *
+ * The integrals are digested in batches as they are computed, so the full
+ * block of integrals is never stored. Only the terms of the quartet as given
+ * are added; the caller is responsible for any permutational symmetry,
+ * and for synchronizing updates to J and K between threads.
+ *
+ * \param [in] P The shell pairs for the bra side of the integral 
+ * \param [in] Q The shell pairs for the ket side of the integral
+ * \param [in] screen_tol Tolerance for screening (set to zero to disable)
+ * \param [in] jk The density and the J and K matrices to add to
+ * \param [in] work Workspace to use in calculating the integrals
+ * \return The number of shell quartets computed, -1 if they were all
+ *         screened, or -2 if the library was not generated with fused
+ *         J/K kernels
+ */
+int simint_compute_ostei_jk(struct simint_multi_shellpair const * P,
+                            struct simint_multi_shellpair const * Q,
+                            double screen_tol,
+                            struct simint_jk const * jk,
+                            double * restrict work);
+
+/*! \brief Compute only the diagonal (ab|ab) integrals of a shell pair
+ *
+ * For Schwarz screening, only the integrals (ab|ab) with the same cartesian
+ * functions on both sides are needed. These are computed by dedicated kernels
+ * that skip the rest of the HRR. \p P must contain a single shell pair,
+ * with am1 >= am2 (the integrals are symmetric, so the caller can swap
+ * the shells).
+ *
+ * \param [in] P The shell pair (used for both the bra and the ket)
+ * \param [in] work Workspace to use in calculating the integrals
+ *                  (simint_ostei_workmem(0, am) is enough)
+ * \param [inout] diag Storage for the ncart1*ncart2 diagonal integrals
+ * \return The number of shell pairs computed, or -2 if there is
+ *         no kernel for these angular momenta
+ */
+int simint_compute_ostei_schwarz(struct simint_multi_shellpair const * P,
+                                 double * restrict work,
+                                 double * restrict diag);
+
 /*! \brief Compute an ostei derivative given shell pair information
  *
  * \param [in] deriv Order of the derivative to compute
@@ -0,0 +1,67 @@
+#pragma once
+
+// Switches the vector types and functions used by a generated
+// ostei kernel to single precision.
+//
+// The generated primitive code (Boys function, VRR) is written in terms
+// of SIMINT_DBLTYPE and friends. After this header, those names refer
+// to the single precision vector type, and SIMINT_SIMD_LEN is its number
+// of lanes (SIMINT_FLT_LEN, twice that of double precision). The ket
+// primitives are always gathered into these lanes (generator option -c),
+// so the padding of the shell pairs (SIMINT_SIMD_ROUND) is unaffected,
+// and SIMINT_FLTLOAD converts each gathered vector to single precision.
+// Contraction converts back and accumulates into double precision, and
+// the HRR (which only uses double) is unaffected.
+//
+// This must be the last header included, and only from the
+// generated ostei_f32_* sources.
+
+#include "simint/vectorization/vectorization.h"
+#include "simint/vectorization/vectorization_f32.h"
+#include "simint/boys/boys.h"
+#include "simint/boys/boys_f32.h"
+
+// The shell pairs (and so SIMINT_SIMD_ROUND and SIMINT_NSHELL_SIMD)
+// stay laid out for double precision. Except with several instruction
+// sets, the layout length is defined as SIMINT_SIMD_LEN, which changes below
+#ifndef SIMINT_MULTI_ISA
+  #undef SIMINT_LAYOUT_LEN
+  #define SIMINT_LAYOUT_LEN ((SIMINT_FLT_LEN+1)/2)
+#endif
+
+#undef SIMINT_SIMD_LEN
+#undef SIMINT_DBLTYPE
+#undef SIMINT_DBLLOAD
+#undef SIMINT_DBLSET1
+#undef SIMINT_NEG
+#undef SIMINT_ADD
+#undef SIMINT_SUB
+#undef SIMINT_MUL
+#undef SIMINT_DIV
+#undef SIMINT_SQRT
+#undef SIMINT_MAX
+#undef SIMINT_FMADD
+#undef SIMINT_FMSUB
+#undef SIMINT_EXP
+#undef SIMINT_POW
+
+#define SIMINT_SIMD_LEN             SIMINT_FLT_LEN
+#define SIMINT_DBLTYPE              SIMINT_FLTTYPE
+#define SIMINT_DBLLOAD(p,i)         SIMINT_FLTLOAD(p,i)
+#define SIMINT_DBLSET1(a)           SIMINT_FLTSET1(a)
+#define SIMINT_NEG(a)               SIMINT_FLT_NEG(a)
+#define SIMINT_ADD(a,b)             SIMINT_FLT_ADD(a,b)
+#define SIMINT_SUB(a,b)             SIMINT_FLT_SUB(a,b)
+#define SIMINT_MUL(a,b)             SIMINT_FLT_MUL(a,b)
+#define SIMINT_DIV(a,b)             SIMINT_FLT_DIV(a,b)
+#define SIMINT_SQRT(a)              SIMINT_FLT_SQRT(a)
+#define SIMINT_MAX(a,b)             SIMINT_FLT_MAX(a,b)
+#define SIMINT_FMADD(a,b,c)         SIMINT_FLT_FMADD(a,b,c)
+#define SIMINT_FMSUB(a,b,c)         SIMINT_FLT_FMSUB(a,b,c)
+#define SIMINT_EXP(a)               SIMINT_FLT_EXP(a)
+#define SIMINT_POW(a,p)             SIMINT_FLT_POW(a,p)
+
+#define boys_F_split                boys_F_split_f32
+#define contract                    contract_f32
+#define contract_all                contract_all_f32
+
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "simint/ostei/ostei.h"
+#include "simint/simint_stats.h"
 #include "simint/vectorization/vectorization.h"
 
 
@@ -20,6 +20,30 @@ void simint_ostei_init(void);
 void simint_ostei_deriv1_init(void);
 
 
+/*! \brief Initializes the single precision OSTEI functionality
+ *
+ * \warning This is not expected to be called directly from
+ *          outside the library
+ */
+void simint_ostei_f32_init(void);
+
+
+/*! \brief Initializes the fused J/K OSTEI functionality
+ *
+ * \warning This is not expected to be called directly from
+ *          outside the library
+ */
+void simint_ostei_jk_init(void);
+
+
+/*! \brief Initializes the diagonal (Schwarz) OSTEI functionality
+ *
+ * \warning This is not expected to be called directly from
+ *          outside the library
+ */
+void simint_ostei_schwarz_init(void);
+
+
 /*! \brief Finalizes the OSTEI functionality
  *
  * \warning This is not expected to be called directly from
@@ -36,6 +60,52 @@ void simint_ostei_finalize(void);
 void simint_ostei_deriv1_finalize(void);
 
 
+/*! \brief Finalizes the single precision OSTEI functionality
+ *
+ * \warning This is not expected to be called directly from
+ *          outside the library
+ */
+void simint_ostei_f32_finalize(void);
+
+
+/*! \brief Finalizes the fused J/K OSTEI functionality
+ *
+ * \warning This is not expected to be called directly from
+ *          outside the library
+ */
+void simint_ostei_jk_finalize(void);
+
+
+/*! \brief Finalizes the diagonal (Schwarz) OSTEI functionality
+ *
+ * \warning This is not expected to be called directly from
+ *          outside the library
+ */
+void simint_ostei_schwarz_finalize(void);
+
+
+/*! \brief Initializes the OSTEI functionality with the kernels of
+ *         the best vectorization type the cpu supports
+ *
+ * Only used in a library built with several vectorization types
+ * (SIMINT_MULTI_ISA). The environment variable SIMINT_VECTOR may be
+ * set to choose a lower one.
+ *
+ * \warning This is not expected to be called directly from
+ *          outside the library
+ */
+void simint_ostei_isa_init(void);
+
+
+/*! \brief Finalizes the OSTEI functionality of a library built with
+ *         several vectorization types
+ *
+ * \warning This is not expected to be called directly from
+ *          outside the library
+ */
+void simint_ostei_isa_finalize(void);
+
+
 #ifdef __cplusplus
 }
 #endif
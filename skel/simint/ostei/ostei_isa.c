@@ -0,0 +1,177 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "simint/simint_init.h"
+#include "simint/ostei/ostei_init.h"
+#include "simint/vectorization/vectorization.h"
+
+
+#ifdef SIMINT_MULTI_ISA
+
+// The init/finalize functions of each instruction set
+// (see ostei_isa.h for how they get their names)
+#define SIMINT_ISA_DECLARE(isa) \
+    void simint_ostei_init_ ## isa(void); \
+    void simint_ostei_deriv1_init_ ## isa(void); \
+    void simint_ostei_f32_init_ ## isa(void); \
+    void simint_ostei_jk_init_ ## isa(void); \
+    void simint_ostei_schwarz_init_ ## isa(void); \
+    void simint_ostei_finalize_ ## isa(void); \
+    void simint_ostei_deriv1_finalize_ ## isa(void); \
+    void simint_ostei_f32_finalize_ ## isa(void); \
+    void simint_ostei_jk_finalize_ ## isa(void); \
+    void simint_ostei_schwarz_finalize_ ## isa(void);
+
+#define SIMINT_ISA_NFUNC 5
+
+#define SIMINT_ISA_ENTRY(isa, supported) \
+    { #isa, supported, \
+      { simint_ostei_init_ ## isa, simint_ostei_deriv1_init_ ## isa, \
+        simint_ostei_f32_init_ ## isa, simint_ostei_jk_init_ ## isa, \
+        simint_ostei_schwarz_init_ ## isa }, \
+      { simint_ostei_finalize_ ## isa, simint_ostei_deriv1_finalize_ ## isa, \
+        simint_ostei_f32_finalize_ ## isa, simint_ostei_jk_finalize_ ## isa, \
+        simint_ostei_schwarz_finalize_ ## isa } },
+
+
+// Checks of the CPU (cpuid, and whether the OS saves the registers).
+// These must cover the flags the kernels are compiled with
+// (cmake/DefaultFlags_*.cmake)
+static int simint_cpu_scalar(void) { return 1; }
+static int simint_cpu_sse(void)    { return __builtin_cpu_supports("ssse3"); }
+static int simint_cpu_avx(void)    { return __builtin_cpu_supports("avx"); }
+
+static int simint_cpu_avx2(void)
+{
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+
+static int simint_cpu_avx512(void)
+{
+    return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512cd") &&
+           __builtin_cpu_supports("fma");
+}
+
+
+#ifdef SIMINT_MULTI_ISA_SCALAR
+SIMINT_ISA_DECLARE(scalar)
+#endif
+#ifdef SIMINT_MULTI_ISA_SSE
+SIMINT_ISA_DECLARE(sse)
+#endif
+#ifdef SIMINT_MULTI_ISA_AVX
+SIMINT_ISA_DECLARE(avx)
+#endif
+#ifdef SIMINT_MULTI_ISA_AVX2
+SIMINT_ISA_DECLARE(avx2)
+#endif
+#ifdef SIMINT_MULTI_ISA_AVX512
+SIMINT_ISA_DECLARE(avx512)
+#endif
+
+
+struct simint_isa_entry
+{
+    char const * name;
+    int (*supported)(void);
+    void (*init[SIMINT_ISA_NFUNC])(void);
+    void (*finalize[SIMINT_ISA_NFUNC])(void);
+};
+
+
+// All the instruction sets compiled into the library, best first
+static const struct simint_isa_entry simint_isa_list[] = {
+#ifdef SIMINT_MULTI_ISA_AVX512
+    SIMINT_ISA_ENTRY(avx512, simint_cpu_avx512)
+#endif
+#ifdef SIMINT_MULTI_ISA_AVX2
+    SIMINT_ISA_ENTRY(avx2, simint_cpu_avx2)
+#endif
+#ifdef SIMINT_MULTI_ISA_AVX
+    SIMINT_ISA_ENTRY(avx, simint_cpu_avx)
+#endif
+#ifdef SIMINT_MULTI_ISA_SSE
+    SIMINT_ISA_ENTRY(sse, simint_cpu_sse)
+#endif
+#ifdef SIMINT_MULTI_ISA_SCALAR
+    SIMINT_ISA_ENTRY(scalar, simint_cpu_scalar)
+#endif
+};
+
+#define SIMINT_NISA ((int)(sizeof(simint_isa_list)/sizeof(simint_isa_list[0])))
+
+
+// Index into simint_isa_list of the kernels in use (-1 if none)
+static int simint_isa_idx = -1;
+
+
+void simint_ostei_isa_init(void)
+{
+    __builtin_cpu_init();
+
+    // The best instruction set the cpu supports
+    int idx = 0;
+    while(idx < SIMINT_NISA && !simint_isa_list[idx].supported())
+        idx++;
+
+    if(idx == SIMINT_NISA)
+    {
+        printf("[ERROR] simint_init: this cpu supports none of the vectorization types in the library\n");
+        return;
+    }
+
+    // A lower one can be picked via the environment. Ones that are not
+    // in the library or not supported by the cpu are ignored
+    char const * env = getenv("SIMINT_VECTOR");
+    if(env != NULL)
+    {
+        for(int i = idx; i < SIMINT_NISA; i++)
+        {
+            if(strcmp(env, simint_isa_list[i].name) == 0 && simint_isa_list[i].supported())
+                idx = i;
+        }
+    }
+
+    for(int i = 0; i < SIMINT_ISA_NFUNC; i++)
+        simint_isa_list[idx].init[i]();
+
+    simint_isa_idx = idx;
+}
+
+
+void simint_ostei_isa_finalize(void)
+{
+    if(simint_isa_idx < 0)
+        return;
+
+    for(int i = 0; i < SIMINT_ISA_NFUNC; i++)
+        simint_isa_list[simint_isa_idx].finalize[i]();
+}
+
+
+char const * simint_vector_isa(void)
+{
+    return (simint_isa_idx < 0 ? "none" : simint_isa_list[simint_isa_idx].name);
+}
+
+#else
+
+char const * simint_vector_isa(void)
+{
+    #if defined SIMINT_MICAVX512
+        return "micavx512";
+    #elif defined SIMINT_AVX512
+        return "avx512";
+    #elif defined SIMINT_AVX2
+        return "avx2";
+    #elif defined SIMINT_AVX
+        return "avx";
+    #elif defined SIMINT_SSE
+        return "sse";
+    #else
+        return "scalar";
+    #endif
+}
+
+#endif
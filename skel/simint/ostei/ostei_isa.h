@@ -0,0 +1,45 @@
+#pragma once
+
+// Renaming of the kernels for a library with several instruction sets
+//
+// With SIMINT_VECTOR=multi, the kernels (and the functions only they use)
+// are compiled once for each instruction set, with SIMINT_ISA_SUFFIX
+// set to the name of that instruction set (sse, avx2, ...). Each copy then
+// gets its own names (for example, ostei_p_s_p_s_avx2) so that they can all
+// be linked into the same library. The rest of the library never refers
+// to them by name, except for the suffixed init/finalize functions
+// (see ostei_isa.c).
+
+#ifdef SIMINT_ISA_SUFFIX
+
+#define SIMINT_ISA_CAT2(x, isa) x ## _ ## isa
+#define SIMINT_ISA_CAT(x, isa) SIMINT_ISA_CAT2(x, isa)
+#define SIMINT_ISA_NAME(x) SIMINT_ISA_CAT(x, SIMINT_ISA_SUFFIX)
+
+// General recurrence functions
+#define ostei_general_vrr1          SIMINT_ISA_NAME(ostei_general_vrr1)
+#define ostei_general_vrr_I         SIMINT_ISA_NAME(ostei_general_vrr_I)
+#define ostei_general_vrr_J         SIMINT_ISA_NAME(ostei_general_vrr_J)
+#define ostei_general_vrr_K         SIMINT_ISA_NAME(ostei_general_vrr_K)
+#define ostei_general_vrr_L         SIMINT_ISA_NAME(ostei_general_vrr_L)
+#define ostei_general_hrr_I         SIMINT_ISA_NAME(ostei_general_hrr_I)
+#define ostei_general_hrr_J         SIMINT_ISA_NAME(ostei_general_hrr_J)
+#define ostei_general_hrr_K         SIMINT_ISA_NAME(ostei_general_hrr_K)
+#define ostei_general_hrr_L         SIMINT_ISA_NAME(ostei_general_hrr_L)
+
+// Filling of the function pointer arrays
+#define simint_ostei_init            SIMINT_ISA_NAME(simint_ostei_init)
+#define simint_ostei_deriv1_init     SIMINT_ISA_NAME(simint_ostei_deriv1_init)
+#define simint_ostei_f32_init        SIMINT_ISA_NAME(simint_ostei_f32_init)
+#define simint_ostei_jk_init         SIMINT_ISA_NAME(simint_ostei_jk_init)
+#define simint_ostei_schwarz_init    SIMINT_ISA_NAME(simint_ostei_schwarz_init)
+#define simint_ostei_finalize        SIMINT_ISA_NAME(simint_ostei_finalize)
+#define simint_ostei_deriv1_finalize SIMINT_ISA_NAME(simint_ostei_deriv1_finalize)
+#define simint_ostei_f32_finalize    SIMINT_ISA_NAME(simint_ostei_f32_finalize)
+#define simint_ostei_jk_finalize     SIMINT_ISA_NAME(simint_ostei_jk_finalize)
+#define simint_ostei_schwarz_finalize SIMINT_ISA_NAME(simint_ostei_schwarz_finalize)
+
+// Generated kernels, VRR, and HRR
+#include "simint/ostei/gen/ostei_isa_names.h"
+
+#endif
@@ -0,0 +1,114 @@
+#pragma once
+
+// Digestion of the final integrals of a batch into J and K.
+//
+// This is only used from the generated ostei_jk_* sources, which call it
+// for each batch of (up to SIMINT_NSHELL_SIMD) shell quartets while the
+// integrals are still in cache.
+
+#include "simint/ostei/ostei.h"
+
+#ifdef __cplusplus
+#include "simint/cpp_restrict.hpp"
+extern "C" {
+#endif
+
+
+/*! \brief Contract a batch of final integrals with the density
+ *
+ * The integrals are for shell pair \p ab of the bra and shell pairs
+ * cd, cd+1, ... of the ket, and are stored as for the kernel that computed
+ * them ([n1][n2][n3][n4] for each quartet). If the caller asked for the
+ * shells of a pair in the opposite order, \p swap12 and/or \p swap34 are set,
+ * and the basis function indices of that pair are swapped here.
+ *
+ * \param [in] n1,n2,n3,n4 Number of cartesian functions in each shell
+ * \param [in] ab Index of the shell pair in the bra
+ * \param [in] cd Index of the first shell pair of the batch in the ket
+ * \param [in] nshellbatch Number of ket shell pairs in the batch
+ * \param [in] swap12 Nonzero if the bra shells were swapped
+ * \param [in] swap34 Nonzero if the ket shells were swapped
+ * \param [in] integrals The final integrals of the batch
+ * \param [in] jk Density and J/K matrices
+ */
+static inline
+void simint_ostei_jk_digest(int n1, int n2, int n3, int n4,
+                            int ab, int cd, int nshellbatch,
+                            int swap12, int swap34,
+                            double const * restrict integrals,
+                            struct simint_jk const * restrict jk)
+{
+    const int nbf = jk->nbf;
+    double const * restrict D = jk->D;
+    double * restrict J = jk->J;
+    double * restrict K = jk->K;
+
+    // With the shells in the order requested by the caller (1234),
+    //   J(1,2) += (12|34) D(3,4)
+    //   K(1,3) += (12|34) D(2,4)
+    // Below, a, b, c, d are the basis functions of the shells in the
+    // order of the integrals. These are the strides of each of them
+    // into J and D(3,4), into K, and into D(2,4)
+    const int ja = (swap12 ? 1 : nbf);
+    const int jb = (swap12 ? nbf : 1);
+    const int jc = (swap34 ? 1 : nbf);
+    const int jd = (swap34 ? nbf : 1);
+
+    const int ka = (swap12 ? 0 : nbf);
+    const int kb = (swap12 ? nbf : 0);
+    const int kc = (swap34 ? 0 : 1);
+    const int kd = (swap34 ? 1 : 0);
+
+    const int da = (swap12 ? nbf : 0);
+    const int db = (swap12 ? 0 : nbf);
+    const int dc = (swap34 ? 1 : 0);
+    const int dd = (swap34 ? 0 : 1);
+
+    // starting basis functions of the bra shells
+    const int a0 = jk->P_bf[2*ab + swap12];
+    const int b0 = jk->P_bf[2*ab + 1 - swap12];
+
+    for(int q = 0; q < nshellbatch; q++)
+    {
+        const int c0 = jk->Q_bf[2*(cd+q) + swap34];
+        const int d0 = jk->Q_bf[2*(cd+q) + 1 - swap34];
+
+        double const * restrict ints = integrals + q*n1*n2*n3*n4;
+
+        for(int i = 0; i < n1; i++)
+        for(int j = 0; j < n2; j++)
+        {
+            const int a = a0 + i;
+            const int b = b0 + j;
+            double jval = 0.0;
+
+            for(int k = 0; k < n3; k++)
+            {
+                const int c = c0 + k;
+                double const * restrict D34 = D + c*jc + d0*jd;
+                double const * restrict D24 = D + a*da + b*db + c*dc + d0*dd;
+
+                if(K)
+                {
+                    double * restrict K13 = K + a*ka + b*kb + c*kc + d0*kd;
+                    for(int l = 0; l < n4; l++)
+                        K13[l*kd] += ints[l] * D24[l*dd];
+                }
+
+                for(int l = 0; l < n4; l++)
+                    jval += ints[l] * D34[l*jd];
+
+                ints += n4;
+            }
+
+            if(J)
+                J[a*ja + b*jb] += jval;
+        }
+    }
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -0,0 +1,68 @@
+/*
+ Generated with:
+   ../../../python/gen_fill.py -l 5 -schwarz ostei_schwarz_init.c
+*/
+
+
+
+#include "simint/ostei/ostei.h"
+#include "simint/ostei/ostei_init.h"
+#include "simint/ostei/ostei_config.h"
+#include "simint/ostei/gen/ostei_generated.h"
+
+
+// Stores pointers to the ostei functions
+#define AMSIZE   SIMINT_OSTEI_MAXAM+1
+extern simint_osteifunc_schwarz simint_osteifunc_schwarz_array[AMSIZE][AMSIZE];
+
+
+
+void simint_ostei_schwarz_finalize(void)
+{
+    // nothing to do
+}
+
+
+void simint_ostei_schwarz_init(void)
+{
+    #if SIMINT_OSTEI_MAXAM >= 0
+    simint_osteifunc_schwarz_array[0][0] = ostei_schwarz_s_s_s_s;
+    #endif
+
+    #if SIMINT_OSTEI_MAXAM >= 1
+    simint_osteifunc_schwarz_array[1][0] = ostei_schwarz_p_s_p_s;
+    simint_osteifunc_schwarz_array[1][1] = ostei_schwarz_p_p_p_p;
+    #endif
+
+    #if SIMINT_OSTEI_MAXAM >= 2
+    simint_osteifunc_schwarz_array[2][0] = ostei_schwarz_d_s_d_s;
+    simint_osteifunc_schwarz_array[2][1] = ostei_schwarz_d_p_d_p;
+    simint_osteifunc_schwarz_array[2][2] = ostei_schwarz_d_d_d_d;
+    #endif
+
+    #if SIMINT_OSTEI_MAXAM >= 3
+    simint_osteifunc_schwarz_array[3][0] = ostei_schwarz_f_s_f_s;
+    simint_osteifunc_schwarz_array[3][1] = ostei_schwarz_f_p_f_p;
+    simint_osteifunc_schwarz_array[3][2] = ostei_schwarz_f_d_f_d;
+    simint_osteifunc_schwarz_array[3][3] = ostei_schwarz_f_f_f_f;
+    #endif
+
+    #if SIMINT_OSTEI_MAXAM >= 4
+    simint_osteifunc_schwarz_array[4][0] = ostei_schwarz_g_s_g_s;
+    simint_osteifunc_schwarz_array[4][1] = ostei_schwarz_g_p_g_p;
+    simint_osteifunc_schwarz_array[4][2] = ostei_schwarz_g_d_g_d;
+    simint_osteifunc_schwarz_array[4][3] = ostei_schwarz_g_f_g_f;
+    simint_osteifunc_schwarz_array[4][4] = ostei_schwarz_g_g_g_g;
+    #endif
+
+    #if SIMINT_OSTEI_MAXAM >= 5
+    simint_osteifunc_schwarz_array[5][0] = ostei_schwarz_h_s_h_s;
+    simint_osteifunc_schwarz_array[5][1] = ostei_schwarz_h_p_h_p;
+    simint_osteifunc_schwarz_array[5][2] = ostei_schwarz_h_d_h_d;
+    simint_osteifunc_schwarz_array[5][3] = ostei_schwarz_h_f_h_f;
+    simint_osteifunc_schwarz_array[5][4] = ostei_schwarz_h_g_h_g;
+    simint_osteifunc_schwarz_array[5][5] = ostei_schwarz_h_h_h_h;
+    #endif
+
+}
+
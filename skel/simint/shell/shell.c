@@ -4,10 +4,15 @@
 #include <stdio.h>
 #include <assert.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "simint/constants.h"
 #include "simint/shell/shell.h"
 #include "simint/shell/shell_screen.h"
 #include "simint/shell/shell_constants.h"
+#include "simint/ostei/ostei.h"
 #include "simint/vectorization/vectorization.h"
 
 
@@ -23,6 +28,17 @@
 extern double const norm_fac[SHELL_PRIM_NORMFAC_MAXL+1];
 
 
+// Radius (times 1/sqrt(exponent)) outside of which a gaussian charge
+// distribution is considered negligible, for SIMINT_SCREEN_QQR.
+// This is sqrt(2) * erfc^-1(0.01)
+#define SIMINT_QQR_EXTENT_FAC 2.5758293035489004
+
+
+// Smallest number of shell pairs that simint_fill_multi_shellpair2
+// fills in parallel (when not already in a parallel region)
+#define SIMINT_FILL_PARALLEL_NPAIR 256
+
+
 #define SWAP_D(a) tmp_d = ((a)[idxi]); ((a)[idxi]) = ((a)[idxi+1]); ((a)[idxi+1]) = tmp_d;
 
 
@@ -33,19 +49,25 @@ extern double const norm_fac[SHELL_PRIM_NORMFAC_MAXL+1];
 // Use a quick sort to replace it.
 
 #define SWAP_DOUBLE(a, b) tmp_dbl = (a); (a) = (b); (b) = tmp_dbl;
+#define SWAP_INT(a, b) tmp_int = (a); (a) = (b); (b) = tmp_int;
 
+// Sorts the primitive pairs from left to right (inclusive) by
+// decreasing key. The key must be one of the arrays of P
+// (screen or alpha), so it is swapped along with the rest
 static void 
-simint_shellpair_screenval_quicksort(
+simint_shellpair_quicksort(
     struct simint_multi_shellpair *P,
+    double const * key,
     int left, int right
 )
 {
     int i = left, j = right;
-    double mid = P->screen[(i + j) / 2], tmp_dbl;
+    double mid = key[(i + j) / 2], tmp_dbl;
+    int tmp_int;
     while (i <= j)
     {
-        while (P->screen[i] > mid) i++;
-        while (P->screen[j] < mid) j--;
+        while (key[i] > mid) i++;
+        while (key[j] < mid) j--;
         if (i <= j)
         {
             SWAP_DOUBLE(P->x[i], P->x[j]);
@@ -59,7 +81,13 @@ simint_shellpair_screenval_quicksort(
             SWAP_DOUBLE(P->PB_z[i], P->PB_z[j]);
             SWAP_DOUBLE(P->alpha[i], P->alpha[j]);
             SWAP_DOUBLE(P->prefac[i], P->prefac[j]);
-            SWAP_DOUBLE(P->screen[i], P->screen[j]);
+            SWAP_DOUBLE(P->beta[i], P->beta[j]);
+            SWAP_DOUBLE(P->alpha1[i], P->alpha1[j]);
+            if(P->screen)
+            {
+                SWAP_DOUBLE(P->screen[i], P->screen[j]);
+            }
+            SWAP_INT(P->primidx[i], P->primidx[j]);
             
             #if SIMINT_OSTEI_MAXDER > 0
             SWAP_DOUBLE(P->alpha2[i], P->alpha2[j]);
@@ -69,16 +97,19 @@ simint_shellpair_screenval_quicksort(
             i++; j--;
         }
     }
-    if (i < right) simint_shellpair_screenval_quicksort(P, i, right);
-    if (j > left)  simint_shellpair_screenval_quicksort(P, left, j);
+    if (i < right) simint_shellpair_quicksort(P, key, i, right);
+    if (j > left)  simint_shellpair_quicksort(P, key, left, j);
 }
 
+// Sorts the primitive pairs within each shell pair, by the screening
+// value or the exponent (see simint_order_multi_shellpair)
 static void
-simint_sort_multi_shellpair(struct simint_multi_shellpair * P)
+simint_sort_multi_shellpair(struct simint_multi_shellpair * P, int order)
 {
     if(P->nprim == 1)
         return;
 
+    double const * key = (order == SIMINT_PRIM_ORDER_EXPONENT) ? P->alpha : P->screen;
     int idx = 0;
     double tmp_d;
 
@@ -104,6 +135,8 @@ simint_sort_multi_shellpair(struct simint_multi_shellpair * P)
                     SWAP_D(P->PB_z)
                     SWAP_D(P->alpha)
                     SWAP_D(P->prefac)
+                    SWAP_D(P->beta)
+                    SWAP_D(P->alpha1)
                     SWAP_D(P->screen)
 
                     #if SIMINT_OSTEI_MAXDER > 0
@@ -116,7 +149,7 @@ simint_sort_multi_shellpair(struct simint_multi_shellpair * P)
             }
         } while(swapped);
         */
-        simint_shellpair_screenval_quicksort(P, idx, idx + P->nprim12[ab] - 1);
+        simint_shellpair_quicksort(P, key, idx, idx + P->nprim12[ab] - 1);
 
         idx += P->nprim12[ab];
 
@@ -128,32 +161,40 @@ simint_sort_multi_shellpair(struct simint_multi_shellpair * P)
 }
 
 
-static void simint_allocate_multi_shellpair_base(int npair, int nprim,
-                                                 struct simint_multi_shellpair * P,
-                                                 int screen_method)
+// Memory needed by a multi shellpair with npair shell pairs
+// and nprim primitive pairs (including padding)
+static size_t simint_multi_shellpair_memsize(int npair, int nprim,
+                                             int screen_method)
 {
-    const size_t dprim_size = nprim * sizeof(double);
-    const size_t ishell12_size = npair * sizeof(int);
-    const size_t dshell12_size = npair * sizeof(double);
-
-    int nprim_arr = 11;
+    int nprim_arr = 13;
+    int nshell12_arr = 3;
     if(screen_method)
         nprim_arr++;
+
+    if(screen_method == SIMINT_SCREEN_QQR)
+    {
+        nprim_arr++;
+        nshell12_arr += 4;
+    }
         
     #if SIMINT_OSTEI_MAXDER > 0
     nprim_arr += 2;
     #endif
 
-    const size_t memsize = dprim_size*nprim_arr + dshell12_size*3 + ishell12_size;
+    return nprim * (sizeof(double)*nprim_arr + sizeof(int))
+         + npair * (sizeof(double)*nshell12_arr + sizeof(int));
+}
+
 
-    // Allocate one large space.
-    // Only allocate if the currently allocated memory is too small
-    if(P->memsize < memsize)
-    {
-        simint_free_multi_shellpair(P);
-        P->ptr = SIMINT_ALLOC(memsize);
-        P->memsize = memsize;
-    }
+// Sets up the pointers of P into P->ptr, which must hold at least
+// simint_multi_shellpair_memsize(npair, nprim, screen_method) bytes
+static void simint_multi_shellpair_set_ptrs(int npair, int nprim,
+                                            struct simint_multi_shellpair * P,
+                                            int screen_method)
+{
+    const size_t dprim_size = nprim * sizeof(double);
+    const size_t ishell12_size = npair * sizeof(int);
+    const size_t dshell12_size = npair * sizeof(double);
 
     int dcount = 0;
     P->x          = P->ptr + dprim_size*(dcount++);
@@ -167,6 +208,8 @@ static void simint_allocate_multi_shellpair_base(int npair, int nprim,
     P->PB_z       = P->ptr + dprim_size*(dcount++);
     P->alpha      = P->ptr + dprim_size*(dcount++);
     P->prefac     = P->ptr + dprim_size*(dcount++);
+    P->beta       = P->ptr + dprim_size*(dcount++);
+    P->alpha1     = P->ptr + dprim_size*(dcount++);
 
     if(screen_method)
         P->screen = P->ptr + dprim_size*(dcount++);
@@ -178,10 +221,144 @@ static void simint_allocate_multi_shellpair_base(int npair, int nprim,
     P->beta2      = P->ptr + dprim_size*(dcount++);
     #endif
 
-    P->AB_x       = P->ptr + dcount*dprim_size;
-    P->AB_y       = P->ptr + dcount*dprim_size +   dshell12_size;
-    P->AB_z       = P->ptr + dcount*dprim_size + 2*dshell12_size;
-    P->nprim12    = P->ptr + dcount*dprim_size + 3*dshell12_size;
+    if(screen_method == SIMINT_SCREEN_QQR)
+        P->extent = P->ptr + dprim_size*(dcount++);
+    else
+        P->extent = NULL;
+
+    int scount = 0;
+    void * shell12_ptr = P->ptr + dcount*dprim_size;
+    P->AB_x       = shell12_ptr + dshell12_size*(scount++);
+    P->AB_y       = shell12_ptr + dshell12_size*(scount++);
+    P->AB_z       = shell12_ptr + dshell12_size*(scount++);
+
+    if(screen_method == SIMINT_SCREEN_QQR)
+    {
+        P->C_x      = shell12_ptr + dshell12_size*(scount++);
+        P->C_y      = shell12_ptr + dshell12_size*(scount++);
+        P->C_z      = shell12_ptr + dshell12_size*(scount++);
+        P->extent12 = shell12_ptr + dshell12_size*(scount++);
+    }
+    else
+        P->C_x = P->C_y = P->C_z = P->extent12 = NULL;
+
+    P->nprim12    = shell12_ptr + dshell12_size*scount;
+    P->primidx    = shell12_ptr + dshell12_size*scount + ishell12_size;
+
+    P->density_max = NULL;
+}
+
+
+static void simint_allocate_multi_shellpair_base(int npair, int nprim,
+                                                 struct simint_multi_shellpair * P,
+                                                 int screen_method)
+{
+    const size_t memsize = simint_multi_shellpair_memsize(npair, nprim, screen_method);
+
+    // Allocate one large space.
+    // Only allocate if the currently allocated memory is too small
+    if(P->memsize < memsize)
+    {
+        simint_free_multi_shellpair(P);
+        P->ptr = SIMINT_ALLOC(memsize);
+        P->memsize = memsize;
+    }
+
+    simint_multi_shellpair_set_ptrs(npair, nprim, P, screen_method);
+}
+
+
+// Fills in the extents and centers used by SIMINT_SCREEN_QQR from
+// the (already computed) primitive pair data, and the sphere containing
+// all of the shell pairs. Does nothing if the shell pair was not
+// allocated for SIMINT_SCREEN_QQR.
+static void simint_fill_qqr_extents(struct simint_multi_shellpair * P)
+{
+    if(P->extent == NULL || P->nshell12 <= 0)
+        return;
+
+    int idx = 0;
+    for(int ab = 0; ab < P->nshell12; ab++)
+    {
+        const int end = idx + P->nprim12[ab];
+
+        for(int i = idx; i < end; i++)
+            P->extent[i] = SIMINT_QQR_EXTENT_FAC / sqrt(P->alpha[i]);
+
+        // The shell pair is centered on its most diffuse primitive pair.
+        // Primitive pairs with a prefactor of zero (from pruning)
+        // don't contribute and are skipped
+        int diffuse = idx;
+        for(int i = idx; i < end; i++)
+        {
+            if(P->prefac[i] != 0.0 &&
+               (P->prefac[diffuse] == 0.0 || P->alpha[i] < P->alpha[diffuse]))
+                diffuse = i;
+        }
+
+        const double Cx = P->x[diffuse];
+        const double Cy = P->y[diffuse];
+        const double Cz = P->z[diffuse];
+
+        double extent12 = 0.0;
+        for(int i = idx; i < end; i++)
+        {
+            if(P->prefac[i] == 0.0)
+                continue;
+
+            const double dx = P->x[i] - Cx;
+            const double dy = P->y[i] - Cy;
+            const double dz = P->z[i] - Cz;
+            const double ext = sqrt(dx*dx + dy*dy + dz*dz) + P->extent[i];
+            extent12 = (ext > extent12 ? ext : extent12);
+        }
+
+        P->C_x[ab] = Cx;
+        P->C_y[ab] = Cy;
+        P->C_z[ab] = Cz;
+        P->extent12[ab] = extent12;
+
+        idx = end;
+
+        int ab1 = ab+1;
+        if((ab1 % SIMINT_NSHELL_SIMD) == 0 || ab1 >= P->nshell12)
+        {
+            // padding (alpha = 1.0)
+            while(idx < SIMINT_SIMD_ROUND(idx))
+                P->extent[idx++] = SIMINT_QQR_EXTENT_FAC;
+        }
+    }
+
+    // The sphere is centered on the middle of the box containing the
+    // centers of the shell pairs. It is used to estimate the smallest
+    // distance between two multi shellpairs without looping over both
+    double min[3] = { P->C_x[0], P->C_y[0], P->C_z[0] };
+    double max[3] = { P->C_x[0], P->C_y[0], P->C_z[0] };
+    for(int ab = 1; ab < P->nshell12; ab++)
+    {
+        const double C[3] = { P->C_x[ab], P->C_y[ab], P->C_z[ab] };
+        for(int m = 0; m < 3; m++)
+        {
+            min[m] = (C[m] < min[m] ? C[m] : min[m]);
+            max[m] = (C[m] > max[m] ? C[m] : max[m]);
+        }
+    }
+
+    P->C_all_x = 0.5 * (min[0] + max[0]);
+    P->C_all_y = 0.5 * (min[1] + max[1]);
+    P->C_all_z = 0.5 * (min[2] + max[2]);
+
+    double extent_all = 0.0;
+    for(int ab = 0; ab < P->nshell12; ab++)
+    {
+        const double dx = P->C_x[ab] - P->C_all_x;
+        const double dy = P->C_y[ab] - P->C_all_y;
+        const double dz = P->C_z[ab] - P->C_all_z;
+        const double ext = sqrt(dx*dx + dy*dy + dz*dz) + P->extent12[ab];
+        extent_all = (ext > extent_all ? ext : extent_all);
+    }
+
+    P->extent_all = extent_all;
 }
 
 
@@ -306,6 +483,10 @@ void simint_initialize_multi_shellpair(struct simint_multi_shellpair * P)
 {
     P->ptr = NULL;
     P->memsize = 0;
+    P->density_max = NULL;
+    P->extent = NULL;
+    P->C_x = P->C_y = P->C_z = P->extent12 = NULL;
+    P->C_all_x = P->C_all_y = P->C_all_z = P->extent_all = 0.0;
 }
 
 
@@ -422,16 +603,146 @@ void simint_fill_multi_shellpair(int na, struct simint_shell const * A,
 }
 
 
+// Computes the primitive pair data for a vector of (up to SIMINT_SIMD_LEN)
+// primitive pairs of shells A and B, and stores the first nlane of them
+// starting at idx. The order of operations is the same as for the
+// scalar code this replaced, so that the results do not change.
+static void simint_fill_prim_vector(struct simint_shell const * A,
+                                    struct simint_shell const * B,
+                                    double Xab, int nlane,
+                                    double const * restrict alpha_i,
+                                    double const * restrict alpha_j,
+                                    double const * restrict coef_ij,
+                                    struct simint_multi_shellpair * P,
+                                    int idx)
+{
+    const SIMINT_DBLTYPE a_i = SIMINT_DBLLOAD(alpha_i, 0);
+    const SIMINT_DBLTYPE a_j = SIMINT_DBLLOAD(alpha_j, 0);
+    const SIMINT_DBLTYPE ab_sum = SIMINT_ADD(a_i, a_j);
+    const SIMINT_DBLTYPE ab_mul = SIMINT_MUL(a_i, a_j);
+
+    const SIMINT_DBLTYPE Ax = SIMINT_DBLSET1(A->x);
+    const SIMINT_DBLTYPE Ay = SIMINT_DBLSET1(A->y);
+    const SIMINT_DBLTYPE Az = SIMINT_DBLSET1(A->z);
+    const SIMINT_DBLTYPE Bx = SIMINT_DBLSET1(B->x);
+    const SIMINT_DBLTYPE By = SIMINT_DBLSET1(B->y);
+    const SIMINT_DBLTYPE Bz = SIMINT_DBLSET1(B->z);
+
+    // multiplying by reciprocal of ab_sum resulted
+    // in small numerical differences
+    SIMINT_DBLTYPE v[13];
+    v[0] = SIMINT_EXP(SIMINT_DIV(SIMINT_MUL(SIMINT_DBLSET1(-Xab), ab_mul), ab_sum));
+    v[0] = SIMINT_DIV(SIMINT_MUL(SIMINT_MUL(SIMINT_DBLLOAD(coef_ij, 0), v[0]),
+                                 SIMINT_DBLSET1(SQRT_TWO_PI_52)), ab_sum);
+    v[1] = ab_sum;
+    v[2] = SIMINT_DIV(SIMINT_ADD(SIMINT_MUL(Ax, a_i), SIMINT_MUL(a_j, Bx)), ab_sum);
+    v[3] = SIMINT_DIV(SIMINT_ADD(SIMINT_MUL(Ay, a_i), SIMINT_MUL(a_j, By)), ab_sum);
+    v[4] = SIMINT_DIV(SIMINT_ADD(SIMINT_MUL(Az, a_i), SIMINT_MUL(a_j, Bz)), ab_sum);
+    v[5] = SIMINT_SUB(v[2], Ax);
+    v[6] = SIMINT_SUB(v[3], Ay);
+    v[7] = SIMINT_SUB(v[4], Az);
+    v[8] = SIMINT_SUB(v[2], Bx);
+    v[9] = SIMINT_SUB(v[3], By);
+    v[10] = SIMINT_SUB(v[4], Bz);
+    v[11] = a_j;
+    v[12] = a_i;
+
+    double * const dest[13] = { P->prefac, P->alpha, P->x, P->y, P->z,
+                                P->PA_x, P->PA_y, P->PA_z,
+                                P->PB_x, P->PB_y, P->PB_z, P->beta, P->alpha1 };
+
+    for(int m = 0; m < 13; m++)
+    {
+        double const * vd = (double const *)(v + m);
+        for(int n = 0; n < nlane; n++)
+            dest[m][idx+n] = vd[n];
+    }
+}
+
+
+// Fills in the primitive pairs of one shell pair, starting at idx
+static void simint_fill_shellpair_prims(struct simint_shell const * A,
+                                        struct simint_shell const * B,
+                                        int same_shell, double Xab,
+                                        struct simint_multi_shellpair * P,
+                                        int idx)
+{
+    double alpha_i[SIMINT_SIMD_LEN] SIMINT_ALIGN_ARRAY_DBL;
+    double alpha_j[SIMINT_SIMD_LEN] SIMINT_ALIGN_ARRAY_DBL;
+    double coef_ij[SIMINT_SIMD_LEN] SIMINT_ALIGN_ARRAY_DBL;
+    int nlane = 0;
+
+    for(int i = 0; i < A->nprim; ++i)
+    {
+        int jend = B->nprim;
+        if(same_shell)
+            jend = (i+1);
+
+        for(int j = 0; j < jend; ++j)
+        {
+            alpha_i[nlane] = A->alpha[i];
+            alpha_j[nlane] = B->alpha[j];
+            P->primidx[idx+nlane] = i*B->nprim + j;
+
+            // The factor of 2.0 is exact, so it can go in here
+            coef_ij[nlane] = A->coef[i] * B->coef[j];
+            if(same_shell && (i != j))
+                coef_ij[nlane] *= 2.0;
+
+            #if SIMINT_OSTEI_MAXDER > 0
+            if(same_shell && (i != j))
+            {
+                // there is already a factor of 2.0 in the prefac,
+                // so we don't need it here (work it out and see
+                // for yourself why we don't need it)
+                P->alpha2[idx+nlane] = (A->alpha[i] + B->alpha[j]);
+                P->beta2[idx+nlane] = (A->alpha[i] + B->alpha[j]);
+            }
+            else
+            {
+                P->alpha2[idx+nlane] = 2.0 * A->alpha[i];
+                P->beta2[idx+nlane] = 2.0 * B->alpha[j];
+            }
+            #endif
+
+            if(++nlane == SIMINT_SIMD_LEN)
+            {
+                simint_fill_prim_vector(A, B, Xab, nlane, alpha_i, alpha_j, coef_ij, P, idx);
+                idx += nlane;
+                nlane = 0;
+            }
+        }
+    }
+
+    if(nlane > 0)
+    {
+        // unused lanes are just kept finite
+        for(int n = nlane; n < SIMINT_SIMD_LEN; n++)
+        {
+            alpha_i[n] = alpha_j[n] = 1.0;
+            coef_ij[n] = 0.0;
+        }
+
+        simint_fill_prim_vector(A, B, Xab, nlane, alpha_i, alpha_j, coef_ij, P, idx);
+    }
+}
+
+
 void simint_fill_multi_shellpair2(int npair, struct simint_shell const * AB,
                                   struct simint_multi_shellpair * P,
                                   int screen_method)
 {
-    int i, j, ij, sasb, idx;
-
     P->nshell12 = npair;
     P->nshell12_clip = npair; // by default, it's the same
     P->nprim = 0;
 
+    if(npair <= 0)
+        return;
+
+    // all shell pairs have the same AM
+    P->am1 = AB[0].am;
+    P->am2 = AB[1].am;
+
     // zero out
     // This is not really needed, and can be expensive in
     // direct code
@@ -439,141 +750,350 @@ void simint_fill_multi_shellpair2(int npair, struct simint_shell const * AB,
     // with a prefactor of 0.0
     //memset(P->ptr, 0, P->memsize);
 
-    sasb = 0;
-    idx = 0;
-
-    ij = 0;
-    for(sasb = 0; sasb < npair; sasb++)
+    for(int sasb = 0; sasb < npair; sasb++)
     {
-        struct simint_shell const * A = &AB[ij];
-        struct simint_shell const * B = &AB[ij+1];
+        struct simint_shell const * A = &AB[2*sasb];
+        struct simint_shell const * B = &AB[2*sasb+1];
+        P->nprim12[sasb] = (compare_shell(A, B) ? (A->nprim * (A->nprim+1))/2 : A->nprim * B->nprim);
+        P->nprim += P->nprim12[sasb];
+    }
 
-        // compute the screening information
-        if(screen_method)
-        {
-            double m = simint_primscreen(A, B, P->screen + idx, screen_method);
-            P->screen_max = (m > P->screen_max ? m : P->screen_max);
-        }
-        else
-            P->screen_max = 0.0;
+    // (not started from P->screen_max, which may be left over from
+    // a previous use of P, or uninitialized)
+    double screen_max = 0.0;
 
-        // are these the same shells?
-        const int same_shell = compare_shell(A, B);
+    // Each thread fills a contiguous range of batches of SIMINT_NSHELL_SIMD
+    // shell pairs. Where its first shell pair starts is the sum of the
+    // (padded) primitives of the batches before it
+    const int nbatch = (npair + SIMINT_NSHELL_SIMD - 1) / SIMINT_NSHELL_SIMD;
 
-        P->am1 = A->am;
-        P->am2 = B->am;
+    #ifdef _OPENMP
+    #pragma omp parallel reduction(max:screen_max) \
+                         if(npair >= SIMINT_FILL_PARALLEL_NPAIR && !omp_in_parallel())
+    #endif
+    {
+        #ifdef _OPENMP
+        const int ithread = omp_get_thread_num();
+        const int nthread = omp_get_num_threads();
+        #else
+        const int ithread = 0;
+        const int nthread = 1;
+        #endif
 
-        // do Xab = (Xab_x **2 + Xab_y ** 2 + Xab_z **2)
-        const double Xab_x = A->x - B->x;
-        const double Xab_y = A->y - B->y;
-        const double Xab_z = A->z - B->z;
-        const double Xab = Xab_x*Xab_x + Xab_y*Xab_y + Xab_z*Xab_z;
+        const int sasb_start = SIMINT_NSHELL_SIMD * (int)(((long)nbatch * ithread) / nthread);
+        const int sasb_end_batch = SIMINT_NSHELL_SIMD * (int)(((long)nbatch * (ithread+1)) / nthread);
+        const int sasb_end = (sasb_end_batch < npair ? sasb_end_batch : npair);
 
+        int idx = 0;
+        for(int sasb = 0; sasb < sasb_start; sasb++)
+        {
+            idx += P->nprim12[sasb];
+            if(((sasb+1) % SIMINT_NSHELL_SIMD) == 0)
+                idx = SIMINT_SIMD_ROUND(idx);
+        }
 
-        for(i = 0; i < A->nprim; ++i)
+        for(int sasb = sasb_start; sasb < sasb_end; sasb++)
         {
-            const double alpha_i = A->alpha[i];
-            const double AxAa = A->x * alpha_i;
-            const double AyAa = A->y * alpha_i;
-            const double AzAa = A->z * alpha_i;
+            struct simint_shell const * A = &AB[2*sasb];
+            struct simint_shell const * B = &AB[2*sasb+1];
 
-            int jend = B->nprim;
-            if(same_shell)
-                jend = (i+1);
+            // are these the same shells?
+            const int same_shell = compare_shell(A, B);
 
-            for(j = 0; j < jend; ++j)
+            // compute the screening information
+            if(screen_method)
             {
-                const double alpha_j = B->alpha[j];
-                const double ab_sum = alpha_i + alpha_j;
-                const double ab_mul = alpha_i * alpha_j;
-
-                // multiplying by reciprocal of ab_sum resulted
-                // in small numerical differences
-                //const double oo_ab_sum = 1.0 / ab_sum;
+                double m = simint_primscreen(A, B, P->screen + idx, screen_method);
+                screen_max = (m > screen_max ? m : screen_max);
+            }
 
-                P->prefac[idx] = A->coef[i] * B->coef[j]
-                                 * exp(-Xab * ab_mul / ab_sum)
-                                 * SQRT_TWO_PI_52 / ab_sum;
+            // do Xab = (Xab_x **2 + Xab_y ** 2 + Xab_z **2)
+            const double Xab_x = A->x - B->x;
+            const double Xab_y = A->y - B->y;
+            const double Xab_z = A->z - B->z;
+            const double Xab = Xab_x*Xab_x + Xab_y*Xab_y + Xab_z*Xab_z;
 
-                if(same_shell && (i != j))
-                    P->prefac[idx] *= 2.0;
+            simint_fill_shellpair_prims(A, B, same_shell, Xab, P, idx);
 
-                P->x[idx] = (AxAa + alpha_j * B->x) / ab_sum;
-                P->y[idx] = (AyAa + alpha_j * B->y) / ab_sum;
-                P->z[idx] = (AzAa + alpha_j * B->z) / ab_sum;
-                P->PA_x[idx] = P->x[idx] - A->x;
-                P->PA_y[idx] = P->y[idx] - A->y;
-                P->PA_z[idx] = P->z[idx] - A->z;
-                P->PB_x[idx] = P->x[idx] - B->x;
-                P->PB_y[idx] = P->y[idx] - B->y;
-                P->PB_z[idx] = P->z[idx] - B->z;
+            P->AB_x[sasb] = Xab_x;
+            P->AB_y[sasb] = Xab_y;
+            P->AB_z[sasb] = Xab_z;
 
-                P->alpha[idx] = ab_sum;
+            idx += P->nprim12[sasb];
 
-                #if SIMINT_OSTEI_MAXDER > 0
-                if(same_shell && (i != j))
-                {
-                    // there is already a factor of 2.0 in the prefac,
-                    // so we don't need it here (work it out and see
-                    // for yourself why we don't need it)
-                    P->alpha2[idx] = (alpha_i + alpha_j);
-                    P->beta2[idx] = (alpha_i + alpha_j);
-                }
-                else
+            // fill in some members until next boundary
+            int sasbp1 = sasb + 1;
+            if((sasbp1 % SIMINT_NSHELL_SIMD) == 0 || sasbp1 >= npair)
+            {
+                for(; idx < SIMINT_SIMD_ROUND(idx); idx++)
                 {
-                    P->alpha2[idx] = 2.0 * alpha_i;
-                    P->beta2[idx] = 2.0 * alpha_j;
-                }
-                #endif
+                    P->alpha[idx] = 1.0;
+                    P->prefac[idx] = 0.0;
+                    P->beta[idx] = 0.5;
+                    P->alpha1[idx] = 0.5;
+                    P->x[idx] = 0.0;
+                    P->y[idx] = 0.0;
+                    P->z[idx] = 0.0;
+                    P->PA_x[idx] = 0.0;
+                    P->PA_y[idx] = 0.0;
+                    P->PA_z[idx] = 0.0;
+                    P->PB_x[idx] = 0.0;
+                    P->PB_y[idx] = 0.0;
+                    P->PB_z[idx] = 0.0;
+
+                    #if SIMINT_OSTEI_MAXDER > 0
+                    P->alpha2[idx] = 1.0;
+                    P->beta2[idx] = 1.0;
+                    #endif
 
-                ++idx;
+                    // the kernels screen whole vectors, including these
+                    if(screen_method)
+                        P->screen[idx] = 0.0;
+                }
             }
         }
+    }
 
-        int nprim = (same_shell ? (A->nprim * (A->nprim+1))/2 : A->nprim * B->nprim);
+    P->screen_max = screen_max;
+
+    // If we are screening, sort the primitives within each shell
+    if(screen_method)
+        simint_sort_multi_shellpair(P, SIMINT_PRIM_ORDER_SCREEN);
 
-        P->AB_x[sasb] = Xab_x;
-        P->AB_y[sasb] = Xab_y;
-        P->AB_z[sasb] = Xab_z;
+    simint_fill_qqr_extents(P);
+}
 
-        int sasbp1 = sasb + 1;
 
-        if((sasbp1 % SIMINT_NSHELL_SIMD) == 0 || sasbp1 >= npair)
+// Largest (ij|ij) integral of primitive i of A and primitive j of B, as
+// computed by simint_primscreen_schwarz (negative if there is no kernel).
+// The shell pair is kept on the stack and work comes from the caller,
+// so nothing is allocated
+static double simint_prim_schwarz(struct simint_shell const * A, int i,
+                                  struct simint_shell const * B, int j,
+                                  double * restrict work)
+{
+    // The diagonal kernels only exist for am1 >= am2
+    if(A->am < B->am)
+    {
+        struct simint_shell const * tmp = A;
+        A = B;
+        B = tmp;
+
+        const int itmp = i;
+        i = j;
+        j = itmp;
+    }
+
+    struct simint_shell AB[2] = { *A, *B };
+    AB[0].nprim = AB[1].nprim = 1;
+    AB[0].alpha = A->alpha + i;
+    AB[0].coef = A->coef + i;
+    AB[1].alpha = B->alpha + j;
+    AB[1].coef = B->coef + j;
+
+    // never the same shell (simint_primscreen_schwarz makes copies)
+    AB[0].ptr = &AB[0];
+    AB[1].ptr = &AB[1];
+
+    // One primitive pair (padded to SIMINT_LAYOUT_LEN), without
+    // screening. At most 14 arrays of doubles and one of ints
+    // per primitive, and 3 doubles and an int for the shell pair
+    double mem[16*SIMINT_LAYOUT_LEN + 4] SIMINT_ALIGN_ARRAY_DBL;
+
+    struct simint_multi_shellpair P;
+    simint_initialize_multi_shellpair(&P);
+    P.ptr = mem;
+    simint_multi_shellpair_set_ptrs(1, SIMINT_SIMD_ROUND(1), &P, 0);
+    simint_fill_multi_shellpair2(1, AB, &P, 0);
+
+    const int ncart12 = (((A->am+1) * (A->am+2))/2) * (((B->am+1) * (B->am+2))/2);
+
+    // holds the calculated (ab|ab) integrals
+    double diag[ncart12] SIMINT_ALIGN_ARRAY_DBL;
+    if(simint_compute_ostei_schwarz(&P, work, diag) < 0)
+        return -1.0;
+
+    double max = 0.0;
+    for(int n = 0; n < ncart12; n++)
+    {
+        double abint = fabs(diag[n]);
+        max = ( abint > max ? abint : max );
+    }
+
+    return max;
+}
+
+
+// Recomputes the primitive pairs of one shell pair (starting at idx)
+// after the shells have moved, keeping their order. Returns the
+// largest screening value (0.0 if not screening), or a negative
+// value if the Schwarz integrals could not be computed
+static double simint_update_shellpair_prims(struct simint_shell const * A,
+                                            struct simint_shell const * B,
+                                            int nprim, int idx,
+                                            struct simint_multi_shellpair * P,
+                                            int screen_method,
+                                            double * restrict work)
+{
+    double alpha_i[SIMINT_SIMD_LEN] SIMINT_ALIGN_ARRAY_DBL;
+    double alpha_j[SIMINT_SIMD_LEN] SIMINT_ALIGN_ARRAY_DBL;
+    double coef_ij[SIMINT_SIMD_LEN] SIMINT_ALIGN_ARRAY_DBL;
+    double coef2_ij[SIMINT_SIMD_LEN] SIMINT_ALIGN_ARRAY_DBL;
+
+    const int same_shell = compare_shell(A, B);
+
+    const double Xab_x = A->x - B->x;
+    const double Xab_y = A->y - B->y;
+    const double Xab_z = A->z - B->z;
+    const double Xab = Xab_x*Xab_x + Xab_y*Xab_y + Xab_z*Xab_z;
+
+    double screen_max = 0.0;
+
+    for(int start = 0; start < nprim; start += SIMINT_SIMD_LEN)
+    {
+        const int nlane = (nprim - start < SIMINT_SIMD_LEN ? nprim - start : SIMINT_SIMD_LEN);
+
+        for(int n = 0; n < SIMINT_SIMD_LEN; n++)
         {
-            // fill in some members until next boundary
-            while(idx < SIMINT_SIMD_ROUND(idx))
+            // unused lanes, and the placeholder of a shell pair that
+            // was pruned entirely, are just kept finite (with a
+            // prefactor and screening value of zero)
+            if(n >= nlane || P->primidx[idx+start+n] < 0)
             {
-                P->alpha[idx] = 1.0;
-                P->prefac[idx] = 0.0;
-                P->x[idx] = 0.0;
-                P->y[idx] = 0.0;
-                P->z[idx] = 0.0;
-                P->PA_x[idx] = 0.0;
-                P->PA_y[idx] = 0.0;
-                P->PA_z[idx] = 0.0;
-                P->PB_x[idx] = 0.0;
-                P->PB_y[idx] = 0.0;
-                P->PB_z[idx] = 0.0;
+                alpha_i[n] = alpha_j[n] = 1.0;
+                coef_ij[n] = coef2_ij[n] = 0.0;
 
-                #if SIMINT_OSTEI_MAXDER > 0
-                P->alpha2[idx] = 1.0;
-                P->beta2[idx] = 1.0;
-                #endif
+                if(n < nlane && screen_method)
+                    P->screen[idx+start+n] = 0.0;
+                continue;
+            }
 
-                idx++;
+            const int i = P->primidx[idx+start+n] / B->nprim;
+            const int j = P->primidx[idx+start+n] % B->nprim;
+
+            alpha_i[n] = A->alpha[i];
+            alpha_j[n] = B->alpha[j];
+
+            coef_ij[n] = A->coef[i] * B->coef[j];
+            if(same_shell && (i != j))
+                coef_ij[n] *= 2.0;
+
+            coef2_ij[n] = A->coef[i] * A->coef[i] * B->coef[j] * B->coef[j];
+
+            if(screen_method == SIMINT_SCREEN_SCHWARZ || screen_method == SIMINT_SCREEN_QQR)
+            {
+                P->screen[idx+start+n] = simint_prim_schwarz(A, i, B, j, work);
+                if(P->screen[idx+start+n] < 0.0)
+                    return -1.0;
             }
         }
 
-        P->nprim12[sasb] = nprim;
-        P->nprim += nprim;
+        simint_fill_prim_vector(A, B, Xab, nlane, alpha_i, alpha_j, coef_ij, P, idx+start);
 
-        ij += 2;
+        if(screen_method == SIMINT_SCREEN_FASTSCHWARZ)
+        {
+            // Same as simint_primscreen_fastschwarz
+            const SIMINT_DBLTYPE a = SIMINT_DBLLOAD(alpha_i, 0);
+            const SIMINT_DBLTYPE b = SIMINT_DBLLOAD(alpha_j, 0);
+            const SIMINT_DBLTYPE p = SIMINT_ADD(a, b);
+            const SIMINT_DBLTYPE oop = SIMINT_DIV(SIMINT_DBLSET1(1.0), p);
+            const SIMINT_DBLTYPE rho = SIMINT_DIV(SIMINT_MUL(a, b), p);
+
+            SIMINT_DBLTYPE Gab = SIMINT_MUL(SIMINT_DBLSET1(SQRT_TWO_TIMES_PI_52),
+                                            SIMINT_POW(oop, SIMINT_DBLSET1(2.5)));
+            Gab = SIMINT_MUL(Gab, SIMINT_EXP(SIMINT_MUL(SIMINT_MUL(SIMINT_DBLSET1(-2.0), rho),
+                                                        SIMINT_DBLSET1(Xab))));
+            Gab = SIMINT_MUL(Gab, SIMINT_DBLLOAD(coef2_ij, 0));
+
+            double const * Gd = (double const *)(&Gab);
+            for(int n = 0; n < nlane; n++)
+                P->screen[idx+start+n] = Gd[n];
+        }
+
+        if(screen_method)
+        {
+            for(int n = 0; n < nlane; n++)
+                screen_max = (P->screen[idx+start+n] > screen_max ? P->screen[idx+start+n] : screen_max);
+        }
     }
 
+    return screen_max;
+}
 
-    // If we are screening, sort the primitives within each shell
-    if(screen_method)
-        simint_sort_multi_shellpair(P);
+
+int simint_update_multi_shellpair_coords(int na, struct simint_shell const * A,
+                                         int nb, struct simint_shell const * B,
+                                         struct simint_multi_shellpair * P,
+                                         int screen_method,
+                                         double * work)
+{
+    int sasb = 0;
+    int idx = 0;
+
+    P->screen_max = 0.0;
+
+    for(int i = 0; i < na; ++i)
+    for(int j = 0; j < nb; ++j)
+    {
+        double m = simint_update_shellpair_prims(A+i, B+j, P->nprim12[sasb], idx,
+                                                 P, screen_method, work);
+        if(m < 0.0)
+            return -2;
+
+        P->screen_max = (m > P->screen_max ? m : P->screen_max);
+
+        P->AB_x[sasb] = A[i].x - B[j].x;
+        P->AB_y[sasb] = A[i].y - B[j].y;
+        P->AB_z[sasb] = A[i].z - B[j].z;
+
+        idx += P->nprim12[sasb];
+
+        int sasbp1 = sasb + 1;
+        if((sasbp1 % SIMINT_NSHELL_SIMD) == 0 || sasbp1 >= P->nshell12)
+            idx = SIMINT_SIMD_ROUND(idx);
+
+        sasb++;
+    }
+
+    simint_fill_qqr_extents(P);
+    return 0;
+}
+
+
+int simint_update_multi_shellpair_coords2(int npair, struct simint_shell const * AB,
+                                          struct simint_multi_shellpair * P,
+                                          int screen_method,
+                                          double * work)
+{
+    int idx = 0;
+
+    P->screen_max = 0.0;
+
+    for(int sasb = 0; sasb < npair; sasb++)
+    {
+        struct simint_shell const * A = &AB[2*sasb];
+        struct simint_shell const * B = &AB[2*sasb+1];
+
+        double m = simint_update_shellpair_prims(A, B, P->nprim12[sasb], idx,
+                                                 P, screen_method, work);
+        if(m < 0.0)
+            return -2;
+
+        P->screen_max = (m > P->screen_max ? m : P->screen_max);
+
+        P->AB_x[sasb] = A->x - B->x;
+        P->AB_y[sasb] = A->y - B->y;
+        P->AB_z[sasb] = A->z - B->z;
+
+        idx += P->nprim12[sasb];
+
+        int sasbp1 = sasb + 1;
+        if((sasbp1 % SIMINT_NSHELL_SIMD) == 0 || sasbp1 >= npair)
+            idx = SIMINT_SIMD_ROUND(idx);
+    }
+
+    simint_fill_qqr_extents(P);
+    return 0;
 }
 
 
@@ -597,6 +1117,18 @@ void simint_create_multi_shellpair2(int nshell12,
 }
 
 
+void simint_order_multi_shellpair(struct simint_multi_shellpair * P, int order)
+{
+    if(order == SIMINT_PRIM_ORDER_SCREEN && P->screen == NULL)
+        return;
+
+    simint_sort_multi_shellpair(P, order);
+
+    // the extents are not swapped with the rest
+    simint_fill_qqr_extents(P);
+}
+
+
 void simint_cat_multi_shellpair(int nmpair,
                                 struct simint_multi_shellpair const ** Pin,
                                 struct simint_multi_shellpair * Pout,
@@ -662,6 +1194,8 @@ void simint_cat_multi_shellpair(int nmpair,
 
                 Pout->alpha[idx] = Pin[i]->alpha[p];
                 Pout->prefac[idx] = Pin[i]->prefac[p];
+                Pout->beta[idx] = Pin[i]->beta[p];
+                Pout->alpha1[idx] = Pin[i]->alpha1[p];
 
                 #if SIMINT_OSTEI_MAXDER > 0
                 Pout->alpha2[idx] = Pin[i]->alpha2[p];
@@ -671,6 +1205,8 @@ void simint_cat_multi_shellpair(int nmpair,
                 if(screen_method)
                     Pout->screen[idx] = Pin[i]->screen[p];
 
+                Pout->primidx[idx] = Pin[i]->primidx[p];
+
                 if(Pin[i]->screen_max > Pout->screen_max)
                     Pout->screen_max = Pin[i]->screen_max;
 
@@ -692,6 +1228,8 @@ void simint_cat_multi_shellpair(int nmpair,
                 {
                     Pout->alpha[idx] = 1.0;
                     Pout->prefac[idx] = 0.0;
+                    Pout->beta[idx] = 0.5;
+                    Pout->alpha1[idx] = 0.5;
                     Pout->x[idx] = 0.0;
                     Pout->y[idx] = 0.0;
                     Pout->z[idx] = 0.0;
@@ -707,6 +1245,9 @@ void simint_cat_multi_shellpair(int nmpair,
                     Pout->beta2[idx] = 1.0;
                     #endif
 
+                    if(screen_method)
+                        Pout->screen[idx] = 0.0;
+
                     idx++;
                 }
             }
@@ -721,6 +1262,7 @@ void simint_cat_multi_shellpair(int nmpair,
     Pout->nshell12 = nshell12;
     Pout->nshell12_clip = nshell12;
 
+    simint_fill_qqr_extents(Pout);
 }
 
 // All multi_shellpairs in Pin have 1 shell pair
@@ -775,6 +1317,8 @@ void simint_cat_shellpairs(
 
             Pout->alpha[idx] = Pin[i]->alpha[p];
             Pout->prefac[idx] = Pin[i]->prefac[p];
+            Pout->beta[idx] = Pin[i]->beta[p];
+            Pout->alpha1[idx] = Pin[i]->alpha1[p];
 
             #if SIMINT_OSTEI_MAXDER > 0
             Pout->alpha2[idx] = Pin[i]->alpha2[p];
@@ -803,18 +1347,20 @@ void simint_cat_shellpairs(
         memcpy(&Pout->PB_z[idx], Pin[i]->PB_z, copy_size);
         memcpy(&Pout->alpha[idx],  Pin[i]->alpha,  copy_size);
         memcpy(&Pout->prefac[idx], Pin[i]->prefac, copy_size);
+        memcpy(&Pout->beta[idx],   Pin[i]->beta,   copy_size);
+        memcpy(&Pout->alpha1[idx], Pin[i]->alpha1, copy_size);
 
         #if SIMINT_OSTEI_MAXDER > 0
         memcpy(&Pout->alpha2[idx], Pin[i]->alpha2, copy_size);
         memcpy(&Pout->beta2[idx],  Pin[i]->beta2,  copy_size);
         #endif
 
+        memcpy(&Pout->primidx[idx], Pin[i]->primidx, sizeof(int) * Pin[i]->nprim12[0]);
+
         if (screen_method)
-            for (int p = 0; p < Pin[i]->nprim12[0]; p++)
-            {
-                Pout->screen[idx] = Pin[i]->screen[p];
-                idx++;
-            }
+            memcpy(&Pout->screen[idx], Pin[i]->screen, copy_size);
+
+        idx += Pin[i]->nprim12[0];
 
         if (Pin[i]->screen_max > Pout->screen_max)
             Pout->screen_max = Pin[i]->screen_max;
@@ -833,6 +1379,8 @@ void simint_cat_shellpairs(
             {
                 Pout->alpha[idx] = 1.0;
                 Pout->prefac[idx] = 0.0;
+                Pout->beta[idx] = 0.5;
+                Pout->alpha1[idx] = 0.5;
                 Pout->x[idx] = 0.0;
                 Pout->y[idx] = 0.0;
                 Pout->z[idx] = 0.0;
@@ -848,6 +1396,9 @@ void simint_cat_shellpairs(
                 Pout->beta2[idx] = 1.0;
                 #endif
 
+                if(screen_method)
+                    Pout->screen[idx] = 0.0;
+
                 idx++;
             }
         }
@@ -861,27 +1412,65 @@ void simint_cat_shellpairs(
     Pout->nshell12 = nshell12;
     Pout->nshell12_clip = nshell12;
 
+    simint_fill_qqr_extents(Pout);
 }
 
-/*
-void
-simint_prune_multi_shellpair(struct simint_multi_shellpair const * P,
-                             struct simint_multi_shellpair * out,
-                             double screen_max, double screen_tol)
+int simint_prune_multi_shellpair(struct simint_multi_shellpair const * P,
+                                 struct simint_multi_shellpair * out,
+                                 double screen_max, double screen_tol)
 {
+    const int screen_method = (P->screen != NULL);
+
+    // The kernels skip a primitive quartet if
+    // P->screen[i] * Q->screen[j] < screen_tol**2
+    // so a primitive pair can be removed if that is true for all
+    // screen values on the other side
     const double screen_tol2 = screen_tol * screen_tol;
-    const double screen_val = screen_tol2 / screen_max;
+    const double screen_val = (screen_method && screen_max > 0.0 && screen_tol > 0.0 ?
+                               screen_tol2 / screen_max : 0.0);
+
+    // Can't prune without screening information
+    #define SIMINT_PRUNE_KEEP(i) (!screen_method || P->screen[i] >= screen_val)
+
+    // How many primitives are there going to be
+    int nprim = 0;
+    int batchprim = 0;
+    int read_idx = 0;
+    for(int ab = 0; ab < P->nshell12; ab++)
+    {
+        int shell_nprim = 0;
+        for(int i = 0; i < P->nprim12[ab]; i++)
+        {
+            if(SIMINT_PRUNE_KEEP(read_idx + i))
+                shell_nprim++;
+        }
+
+        // each shell pair keeps at least one primitive, since
+        // the kernels do not handle empty shell pairs
+        batchprim += (shell_nprim > 0 ? shell_nprim : 1);
+        read_idx += P->nprim12[ab];
+
+        int ab1 = ab+1;
+        if((ab1 % SIMINT_NSHELL_SIMD) == 0 || ab1 >= P->nshell12)
+        {
+            nprim += SIMINT_SIMD_ROUND(batchprim);
+            batchprim = 0;
+            read_idx = SIMINT_SIMD_ROUND(read_idx);
+        }
+    }
 
-    simint_allocate_multi_shellpair_base(P->nshell12, P->nprim, out);
-    memset(out->ptr, 0, out->memsize);
+    simint_allocate_multi_shellpair_base(P->nshell12, nprim, out,
+                                         (P->extent != NULL ? SIMINT_SCREEN_QQR : screen_method));
     out->am1 = P->am1;
     out->am2 = P->am2;
     out->nshell12 = P->nshell12;
     out->nshell12_clip = P->nshell12_clip;
-    out->screen_max = P->screen_max;
+    out->nprim = 0;
+    out->screen_max = 0.0;
 
-    int read_idx = 0;  // index we are currently reading from
+    int ndropped = 0;
     int write_idx = 0; // index we are currently writing to
+    read_idx = 0;      // index we are currently reading from
 
     for(int ab = 0; ab < P->nshell12; ab++)
     {
@@ -892,7 +1481,7 @@ simint_prune_multi_shellpair(struct simint_multi_shellpair const * P,
         int shell_nprim = 0;
         for(int i = 0; i < P->nprim12[ab]; i++)
         {
-            if(P->screen[read_idx] > screen_val)
+            if(SIMINT_PRUNE_KEEP(read_idx))
             {
                 out->x[write_idx] = P->x[read_idx];
                 out->y[write_idx] = P->y[read_idx];
@@ -905,27 +1494,104 @@ simint_prune_multi_shellpair(struct simint_multi_shellpair const * P,
                 out->PB_z[write_idx] = P->PB_z[read_idx];
                 out->alpha[write_idx] = P->alpha[read_idx];
                 out->prefac[write_idx] = P->prefac[read_idx];
-                out->screen[write_idx] = P->screen[read_idx];
+                out->beta[write_idx] = P->beta[read_idx];
+                out->alpha1[write_idx] = P->alpha1[read_idx];
+                out->primidx[write_idx] = P->primidx[read_idx];
+
+                #if SIMINT_OSTEI_MAXDER > 0
+                out->alpha2[write_idx] = P->alpha2[read_idx];
+                out->beta2[write_idx] = P->beta2[read_idx];
+                #endif
+
+                if(screen_method)
+                {
+                    out->screen[write_idx] = P->screen[read_idx];
+                    if(P->screen[read_idx] > out->screen_max)
+                        out->screen_max = P->screen[read_idx];
+                }
+
                 write_idx++;
                 shell_nprim++;
             }
+            else
+                ndropped++;
+
             read_idx++;
         }
 
+        // Everything was dropped. Keep a primitive that
+        // does not contribute anything
+        if(shell_nprim == 0)
+        {
+            out->alpha[write_idx] = 1.0;
+            out->prefac[write_idx] = 0.0;
+            out->beta[write_idx] = 0.5;
+            out->alpha1[write_idx] = 0.5;
+            out->x[write_idx] = 0.0;
+            out->y[write_idx] = 0.0;
+            out->z[write_idx] = 0.0;
+            out->PA_x[write_idx] = 0.0;
+            out->PA_y[write_idx] = 0.0;
+            out->PA_z[write_idx] = 0.0;
+            out->PB_x[write_idx] = 0.0;
+            out->PB_y[write_idx] = 0.0;
+            out->PB_z[write_idx] = 0.0;
+            out->primidx[write_idx] = -1; // (see simint_update_shellpair_prims)
+
+            #if SIMINT_OSTEI_MAXDER > 0
+            out->alpha2[write_idx] = 1.0;
+            out->beta2[write_idx] = 1.0;
+            #endif
+
+            if(screen_method)
+                out->screen[write_idx] = 0.0;
+
+            write_idx++;
+            shell_nprim++;
+            ndropped--;
+        }
+
+        out->nprim12[ab] = shell_nprim;
+        out->nprim += shell_nprim;
+
         int ab1 = ab+1;
         if((ab1 % SIMINT_NSHELL_SIMD) == 0 || ab1 >= P->nshell12)
         {
-            // coefficients should be zero due to the memset above
+            // fill in some members until next boundary
             while(write_idx < SIMINT_SIMD_ROUND(write_idx))
             {
-                out->alpha[write_idx++] = 1.0;
-                shell_nprim++;
+                out->alpha[write_idx] = 1.0;
+                out->prefac[write_idx] = 0.0;
+                out->beta[write_idx] = 0.5;
+                out->alpha1[write_idx] = 0.5;
+                out->x[write_idx] = 0.0;
+                out->y[write_idx] = 0.0;
+                out->z[write_idx] = 0.0;
+                out->PA_x[write_idx] = 0.0;
+                out->PA_y[write_idx] = 0.0;
+                out->PA_z[write_idx] = 0.0;
+                out->PB_x[write_idx] = 0.0;
+                out->PB_y[write_idx] = 0.0;
+                out->PB_z[write_idx] = 0.0;
+
+                #if SIMINT_OSTEI_MAXDER > 0
+                out->alpha2[write_idx] = 1.0;
+                out->beta2[write_idx] = 1.0;
+                #endif
+
+                if(screen_method)
+                    out->screen[write_idx] = 0.0;
+
+                write_idx++;
             }
-        }
 
-        out->nprim12[ab] = shell_nprim;
+            read_idx = SIMINT_SIMD_ROUND(read_idx);
+        }
     }
 
-    out->nprim = write_idx;
+    #undef SIMINT_PRUNE_KEEP
+
+    simint_fill_qqr_extents(out);
+
+    return ndropped;
 }
-*/
@@ -7,6 +7,10 @@
 #define SIMINT_SCREEN_NONE         0
 #define SIMINT_SCREEN_SCHWARZ      1
 #define SIMINT_SCREEN_FASTSCHWARZ  2
+#define SIMINT_SCREEN_QQR          3  //!< Schwarz, plus the distance between shell pairs (QQR)
+
+#define SIMINT_PRIM_ORDER_SCREEN    0  //!< Decreasing screening value (the default with screening)
+#define SIMINT_PRIM_ORDER_EXPONENT  1  //!< Decreasing exponent of the primitive pair
 
 
 #ifdef __cplusplus
@@ -76,9 +80,30 @@ struct simint_multi_shellpair
     #endif
 
     double * prefac;    //!< Prefactors for each primitive pair, including coefficients and other factors
+    double * beta;      //!< Exponent of the second shell of each primitive pair
+    double * alpha1;    //!< Exponent of the first shell of each primitive pair
     double * screen;    //!< Screening information (value of g_{abab} for all primitive shell pair)
     double screen_max;  //!< Maximum value in the screen array
 
+    int * primidx;      //!< Which primitives of the two shells (i*nprim2 + j) form each primitive pair (-1 if none, see simint_prune_multi_shellpair)
+
+    double const * density_max; //!< Optional bound on the density for each shell pair (length nshell12, or NULL).
+                                //!< Not owned by this structure (see simint_compute_eri_density)
+
+    /* Only with SIMINT_SCREEN_QQR (NULL otherwise). The magnitude of an integral
+     * is estimated as the Schwarz bound divided by the distance between the two
+     * charge distributions (minus their extents), once that is larger than one bohr.
+     */
+    double * extent;    //!< Extent of each primitive pair (radius outside of which it is negligible)
+    double * C_x;       //!< X coordinate of the center of each shell pair (length nshell12)
+    double * C_y;       //!< Y coordinate of the center of each shell pair (length nshell12)
+    double * C_z;       //!< Z coordinate of the center of each shell pair (length nshell12)
+    double * extent12;  //!< Extent of each shell pair around (C_x, C_y, C_z) (length nshell12)
+    double C_all_x;     //!< X coordinate of the center of a sphere containing all the shell pairs
+    double C_all_y;     //!< Y coordinate of the center of a sphere containing all the shell pairs
+    double C_all_z;     //!< Z coordinate of the center of a sphere containing all the shell pairs
+    double extent_all;  //!< Radius of that sphere (including the extents of the shell pairs)
+
 
     size_t memsize;     //!< Total memory for storing various data in this structure (in bytes)
     void * ptr;         //!< Pointer to all the allocated memory within this structure (length memsize)
@@ -345,6 +370,72 @@ simint_create_multi_shellpair2(int npair,
                                int screen_method);
 
 
+/*! \brief Updates a multi shellpair for new positions of the shells
+ *
+ * Only the centers of the shells may have changed since the shell pair was
+ * created (with the same \p A, \p B, and \p screen_method). The primitive
+ * pairs are kept in the same order, and only the data that depends on the
+ * centers is recomputed.
+ *
+ * This does not allocate memory. SIMINT_SCREEN_SCHWARZ and SIMINT_SCREEN_QQR
+ * compute integrals to get the screening values, using \p work.
+ *
+ * \param [in] na Number of shells in the first position
+ * \param [in] A Shells in the first position of this multi_shellpair
+ * \param [in] nb Number of shells in the second position
+ * \param [in] B Shells in the second position of this multi_shellpair
+ * \param [inout] P The shell pair data to update
+ * \param [in] screen_method Screening method for primitives
+ * \param [in] work Workspace for SIMINT_SCREEN_SCHWARZ and SIMINT_SCREEN_QQR
+ *                  (simint_ostei_workmem(0, am) is enough, where am is the
+ *                  largest AM of the shells). May be NULL otherwise.
+ * \return 0, or -2 if there is no kernel to compute the Schwarz
+ *         screening values (\p P is then incomplete)
+ */
+int simint_update_multi_shellpair_coords(int na, struct simint_shell const * A,
+                                         int nb, struct simint_shell const * B,
+                                         struct simint_multi_shellpair * P,
+                                         int screen_method,
+                                         double * work);
+
+
+/*! \brief Updates a multi shellpair for new positions of the shells
+ *
+ * As for simint_update_multi_shellpair_coords, but for a multi shellpair
+ * created from an array of pairs (see simint_fill_multi_shellpair2)
+ *
+ * \param [in] npair Number of shell pairs in the array
+ * \param [in] AB Pairs of shells in the shell pair
+ * \param [inout] P The shell pair data to update
+ * \param [in] screen_method Screening method for primitives
+ * \param [in] work Workspace for SIMINT_SCREEN_SCHWARZ and SIMINT_SCREEN_QQR
+ * \return 0, or -2 if there is no kernel to compute the Schwarz
+ *         screening values (\p P is then incomplete)
+ */
+int simint_update_multi_shellpair_coords2(int npair, struct simint_shell const * AB,
+                                          struct simint_multi_shellpair * P,
+                                          int screen_method,
+                                          double * work);
+
+
+/*! \brief Reorders the primitive pairs within each shell pair
+ *
+ * With SIMINT_PRIM_ORDER_EXPONENT, primitive pairs with similar exponents
+ * end up next to each other. When used as the ket, the vectors in the
+ * kernels then tend to have their Boys function arguments all in the
+ * short range or all in the long range, rather than a mix of both (see
+ * the boys_mixed member of simint_screen_stats).
+ *
+ * Primitive pairs are only moved within a shell pair, so the padding is
+ * not changed. The order is kept by simint_update_multi_shellpair_coords.
+ * SIMINT_PRIM_ORDER_SCREEN does nothing if \p P was created without screening.
+ *
+ * \param [inout] P The shell pair data to reorder
+ * \param [in] order How to order the primitive pairs (SIMINT_PRIM_ORDER_*)
+ */
+void simint_order_multi_shellpair(struct simint_multi_shellpair * P, int order);
+
+
 /*! \brief Combine existing multi shellpair structures into a new one
  *
  * Existing information in \Pout will be erased
@@ -376,17 +467,27 @@ void simint_cat_shellpairs(
 
 /*! \brief Remove all insignificant primitive pairs
  *
- *
- * \param [in] npair Number of shell pairs in the array
- * \param [in] AB Pairs of shells to place in the shell pair
- * \param [inout] P The structure that will hold the shell pair data
+ * Primitive pairs of \p P are removed if they would be screened out
+ * by the kernels for all primitive pairs of the other shell pair(s)
+ * they are used with. That is, if their screen value is less than
+ * screen_tol**2 / \p screen_max. The remaining primitives are copied
+ * into \p out (with the usual padding of each batch of shell pairs).
+ * A shell pair that loses all of its primitives keeps one with a
+ * prefactor of zero. It stays zero when \p out is passed to
+ * simint_update_multi_shellpair_coords.
+ *
+ * Existing information in \p out will be erased. \p P must have been
+ * created with screening. Otherwise, nothing is removed.
+ *
+ * \param [in] P The shell pair to prune
+ * \param [inout] out The structure that will hold the pruned shell pair data
+ * \param [in] screen_max The largest screen_max of the shell pairs \p P will be used with
+ * \param [in] screen_tol The screening tolerance that will be passed to the integral functions
+ * \return The number of primitive pairs removed
  */
-/*
-void
-simint_prune_multi_shellpair(struct simint_multi_shellpair const * P,
-                             struct simint_multi_shellpair * out,
-                             double screen_max, double screen_tol);
-*/
+int simint_prune_multi_shellpair(struct simint_multi_shellpair const * P,
+                                 struct simint_multi_shellpair * out,
+                                 double screen_max, double screen_tol);
 
 #ifdef __cplusplus
 }
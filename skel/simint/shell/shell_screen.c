@@ -1,6 +1,7 @@
 #include <math.h> // for fabs()
 
 #include "simint/simint_eri.h"
+#include "simint/ostei/ostei.h"
 #include "simint/ostei/ostei_config.h"
 #include "simint/constants.h"
 #include "simint/shell/shell_screen.h"
@@ -14,6 +15,7 @@ simint_shellscreen(struct simint_shell const * A,
     switch(screen_method)
     {
         case SIMINT_SCREEN_SCHWARZ:
+        case SIMINT_SCREEN_QQR:  // QQR uses Schwarz values for the pairs
             return simint_shellscreen_schwarz(A, B);
         case SIMINT_SCREEN_FASTSCHWARZ:
             return simint_shellscreen_fastschwarz(A, B);
@@ -32,6 +34,7 @@ simint_primscreen(struct simint_shell const * A,
     switch(screen_method)
     {
         case SIMINT_SCREEN_SCHWARZ:
+        case SIMINT_SCREEN_QQR:  // QQR uses Schwarz values for the pairs
             return simint_primscreen_schwarz(A, B, out);
         case SIMINT_SCREEN_FASTSCHWARZ:
             return simint_primscreen_fastschwarz(A, B, out);
@@ -44,6 +47,45 @@ simint_primscreen(struct simint_shell const * A,
 ///////////////////////////////////////
 // Shell screening implementations
 ///////////////////////////////////////
+// Largest diagonal (ab|ab) integral of the shell pair in P,
+// which holds the shells a and b in that order. The diagonal
+// kernels only exist for am1 >= am2, so the shells are swapped
+// if needed (the diagonal is the same either way). Returns a
+// negative value if there is no kernel for these shells.
+static double
+simint_schwarz_diag_max(struct simint_shell const * A,
+                        struct simint_shell const * B,
+                        struct simint_multi_shellpair * P,
+                        double * restrict work,
+                        double * restrict diag)
+{
+    if(A->am < B->am)
+    {
+        struct simint_shell const * tmp = A;
+        A = B;
+        B = tmp;
+    }
+
+    const int ncart1 = ((A->am+1) * (A->am+2))/2;
+    const int ncart2 = ((B->am+1) * (B->am+2))/2;
+    const int ncart12 = ncart1*ncart2;
+
+    // Note - we aren't screening this. That would be a infinite loop.
+    simint_create_multi_shellpair(1, A, 1, B, P, 0);
+    if(simint_compute_ostei_schwarz(P, work, diag) < 0)
+        return -1.0;
+
+    double max = 0;
+    for(int n = 0; n < ncart12; n++)
+    {
+        double abint = fabs(diag[n]);
+        max = ( abint > max ? abint : max );
+    }
+
+    return max;
+}
+
+
 double
 simint_shellscreen_schwarz(struct simint_shell const * A,
                            struct simint_shell const * B)
@@ -54,26 +96,14 @@ simint_shellscreen_schwarz(struct simint_shell const * A,
 
     const int ncart1 = ((A->am+1) * (A->am+2))/2;
     const int ncart2 = ((B->am+1) * (B->am+2))/2;
-    const int ncart12 = ncart1*ncart2;
-    const int ncart1234 = ncart12*ncart12;
 
-    // holds the calculated integrals
-    double integrals[ncart1234] SIMINT_ALIGN_ARRAY_DBL;
+    // holds the calculated (ab|ab) integrals
+    double diag[ncart1*ncart2] SIMINT_ALIGN_ARRAY_DBL;
 
     struct simint_multi_shellpair P;
     simint_initialize_multi_shellpair(&P);
-    simint_create_multi_shellpair(1, A, 1, B, &P, 0);
 
-    // calculate (ab|ab)
-    simint_compute_eri(&P, &P, 0.0, work, integrals);
-
-    // find the max value
-    double max = 0;
-    for(int n = 0; n < ncart1234; n++)
-    {
-        double abint = fabs(integrals[n]);
-        max = ( abint > max ? abint : max );
-    }
+    const double max = simint_schwarz_diag_max(A, B, &P, work, diag);
 
     simint_free_multi_shellpair(&P);
     SIMINT_FREE(work);
@@ -81,6 +111,67 @@ simint_shellscreen_schwarz(struct simint_shell const * A,
 }
 
 
+int
+simint_schwarz_matrix(int nshell,
+                      struct simint_shell const * shells,
+                      double * out)
+{
+    int maxam = 0;
+    for(int i = 0; i < nshell; i++)
+        maxam = (shells[i].am > maxam ? shells[i].am : maxam);
+
+    const int maxncart = ((maxam+1) * (maxam+2))/2;
+    const size_t workmem = simint_ostei_workmem(0, maxam);
+
+    // pairs i >= j, in the order (0,0) (1,0) (1,1) (2,0) ...
+    const long npair = ((long)nshell * (nshell+1))/2;
+
+    int ret = 0;
+
+    #pragma omp parallel if(npair >= 64) reduction(min:ret)
+    {
+        // each thread keeps its own workspace and shell pair
+        double * work = (double *)SIMINT_ALLOC(workmem);
+        double * diag = (double *)SIMINT_ALLOC(maxncart*maxncart*sizeof(double));
+        if(work == NULL || diag == NULL)
+            ret = -1;
+
+        struct simint_multi_shellpair P;
+        simint_initialize_multi_shellpair(&P);
+
+        #pragma omp for schedule(dynamic, 16)
+        for(long ij = 0; ij < npair; ij++)
+        {
+            // (every thread must still get to the end of the loop)
+            if(ret == -1)
+                continue;
+
+            // recover i and j from the pair index
+            int i = (int)((sqrt(8.0*ij + 1.0) - 1.0) / 2.0);
+            while((long)i*(i+1)/2 > ij)
+                i--;
+            while((long)(i+1)*(i+2)/2 <= ij)
+                i++;
+            const int j = (int)(ij - (long)i*(i+1)/2);
+
+            const double max = simint_schwarz_diag_max(&shells[i], &shells[j],
+                                                       &P, work, diag);
+            if(max < 0.0)
+                ret = -2;
+
+            out[(size_t)i*nshell + j] = max;
+            out[(size_t)j*nshell + i] = max;
+        }
+
+        simint_free_multi_shellpair(&P);
+        SIMINT_FREE(diag);
+        SIMINT_FREE(work);
+    }
+
+    return ret;
+}
+
+
 double
 simint_shellscreen_fastschwarz(struct simint_shell const * A,
                                struct simint_shell const * B)
@@ -128,11 +219,9 @@ simint_primscreen_schwarz(struct simint_shell const * A,
 {
     const int ncart1 = ((A->am+1) * (A->am+2))/2;
     const int ncart2 = ((B->am+1) * (B->am+2))/2;
-    const int ncart12 = ncart1*ncart2;
-    const int ncart1234 = ncart12*ncart12;
 
-    // holds the calculated integrals
-    double integrals[ncart1234] SIMINT_ALIGN_ARRAY_DBL;
+    // holds the calculated (ab|ab) integrals
+    double diag[ncart1*ncart2] SIMINT_ALIGN_ARRAY_DBL;
 
     // here, we basically uncontract the shells
     struct simint_shell new_A, new_B;
@@ -150,9 +239,9 @@ simint_primscreen_schwarz(struct simint_shell const * A,
 
     double total_max = 0.0;
 
+    // (stops with a negative total_max if there is no kernel)
     int idx = 0;
-    int ij = 0;
-    for(int i = 0; i < A->nprim; i++)
+    for(int i = 0; i < A->nprim && total_max >= 0.0; i++)
     {
         simint_create_shell(1, A->am, A->x, A->y, A->z,
                             A->alpha + i, A->coef + i,
@@ -167,29 +256,12 @@ simint_primscreen_schwarz(struct simint_shell const * A,
                                 B->alpha + j, B->coef + j,
                                 &new_B);
 
-            // create a shell pair
-            // Note - we aren't screening this. That would be a infinite loop.
-            simint_create_multi_shellpair(1, &new_A, 1, &new_B, &P, 0);
-
-            // calculate (ab|ab)
-            simint_compute_eri(&P, &P, 0.0, work, integrals);
-
-            // find the maximum value and store in the output array
-            double max = 0;
-            for(int m = 0; m < ncart1; m++)
+            // calculate (ab|ab) and find the maximum value
+            const double max = simint_schwarz_diag_max(&new_A, &new_B, &P, work, diag);
+            if(max < 0.0)
             {
-                const int idx_m = m*ncart2*ncart1*ncart2 +
-                                  m*ncart2;
-
-                for(int n = 0; n < ncart2; n++)
-                {
-                    const int idx_mn = idx_m +
-                                    n*ncart1*ncart2 +
-                                    n;
-
-                    double abint = fabs(integrals[idx_mn]);
-                    max = ( abint > max ? abint : max );
-                }
+                total_max = max;
+                break;
             }
 
             // we avoid doing the sqrt by squaring the tolerance later
@@ -198,15 +270,6 @@ simint_primscreen_schwarz(struct simint_shell const * A,
 
             if(max > total_max)
                 total_max = max;
-
-            ij++;
-
-            // pad out, if needed
-            if( (ij % SIMINT_NSHELL_SIMD) == 0 || ij >= A->nprim*B->nprim)
-            {
-                while(idx < SIMINT_SIMD_ROUND(idx))
-                    out[idx++] = 0.0;
-            }
         }
     }
 
@@ -24,12 +24,34 @@ simint_primscreen(struct simint_shell const * A,
                   int screen_method);
 
 
-/*! \brief Calculate the screening value for a shell pair */
+/*! \brief Calculate the screening value for a shell pair
+ *
+ * Negative if there is no kernel for the shells.
+ */
 double
 simint_shellscreen_schwarz(struct simint_shell const * A,
                            struct simint_shell const * B);
 
 
+/*! \brief Calculate the Schwarz screening values of all pairs of shells
+ *
+ * For each pair of shells i and j, computes the largest diagonal integral
+ * |(ij|ij)| (the same value as simint_shellscreen_schwarz, without the
+ * square root), using kernels that only compute the diagonal. The pairs are
+ * spread over OpenMP threads (if enabled), each with its own workspace.
+ *
+ * \param [in] nshell Number of shells
+ * \param [in] shells The shells
+ * \param [out] out Screening values (nshell x nshell, row major, symmetric)
+ * \return 0 on success, -1 if memory could not be allocated, or -2 if there
+ *         is no kernel for some of the shells (their values in \p out are negative)
+ */
+int
+simint_schwarz_matrix(int nshell,
+                      struct simint_shell const * shells,
+                      double * out);
+
+
 /*! \brief Calculate the screening value for a shell pair */
 double
 simint_shellscreen_fastschwarz(struct simint_shell const * A,
@@ -38,7 +60,8 @@ simint_shellscreen_fastschwarz(struct simint_shell const * A,
 
 /*! \brief Calculate primitive screening information for a shell pair
  *
- * Calculates screening info via Schwarz screening
+ * Calculates screening info via Schwarz screening. Returns a negative
+ * value if there is no kernel for the shells.
  */
 double
 simint_primscreen_schwarz(struct simint_shell const * A,
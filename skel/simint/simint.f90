@@ -42,12 +42,35 @@ module SimintFortran
 #endif
 
       type(C_PTR) :: prefac
+      type(C_PTR) :: beta
+      type(C_PTR) :: alpha1
       type(C_PTR) :: screen
       real(C_DOUBLE) :: screen_max
+      type(C_PTR) :: primidx
+      type(C_PTR) :: density_max
+      type(C_PTR) :: extent
+      type(C_PTR) :: C_x
+      type(C_PTR) :: C_y
+      type(C_PTR) :: C_z
+      type(C_PTR) :: extent12
+      real(C_DOUBLE) :: C_all_x
+      real(C_DOUBLE) :: C_all_y
+      real(C_DOUBLE) :: C_all_z
+      real(C_DOUBLE) :: extent_all
       integer(C_SIZE_T) :: memsize
       type(C_PTR) :: ptr
     end type
 
+    type, bind(C) :: c_simint_screen_stats
+      integer(C_LONG_LONG) :: shell_calc
+      integer(C_LONG_LONG) :: shell_skip
+      integer(C_LONG_LONG) :: prim_calc
+      integer(C_LONG_LONG) :: prim_skip
+      integer(C_LONG_LONG) :: vec_calc
+      integer(C_LONG_LONG) :: vec_skip
+      integer(C_LONG_LONG) :: boys_mixed
+    end type
+
   interface
 
     subroutine simint_init() bind(C, name="simint_init")
@@ -174,6 +197,25 @@ module SimintFortran
       integer(C_INT) :: res
     end function
 
+    function c_simint_compute_eri_density(P, Q, screen_tol, P_density_max, Q_density_max, &
+                                          work, integrals) &
+             result(res) bind(C, name="simint_compute_eri_density")
+      use iso_c_binding
+      implicit none
+      type(C_PTR), intent(in), value :: P, Q, P_density_max, Q_density_max, work, integrals
+      real(C_DOUBLE), intent(in), value :: screen_tol
+      integer(C_INT) :: res
+    end function
+
+    function c_simint_compute_eri_mixed(P, Q, screen_tol, single_tol, work, integrals) &
+             result(res) bind(C, name="simint_compute_eri_mixed")
+      use iso_c_binding
+      implicit none
+      type(C_PTR), intent(in), value :: P, Q, work, integrals
+      real(C_DOUBLE), intent(in), value :: screen_tol, single_tol
+      integer(C_INT) :: res
+    end function
+
     function c_simint_compute_eri_deriv(deriv, P, Q, screen_tol, work, integrals) &
              result(res) bind(C, name="simint_compute_eri_deriv")
       use iso_c_binding
@@ -200,6 +242,15 @@ module SimintFortran
       integer(C_SIZE_T) :: res
     end function
 
+    subroutine simint_stats_reset() bind(C, name="simint_stats_reset")
+    end subroutine
+
+    subroutine simint_stats_get(stats) bind(C, name="simint_stats_get")
+      import :: c_simint_screen_stats
+      implicit none
+      type(c_simint_screen_stats), intent(out) :: stats
+    end subroutine
+
   end interface
 
   contains
@@ -359,6 +410,42 @@ module SimintFortran
       res = INT(res2)
     end function
 
+    function simint_compute_eri_density(P, Q, screen_tol, P_density_max, Q_density_max, &
+                                        work, integrals) &
+             result(res)
+      implicit none
+
+      type(c_simint_multi_shellpair), intent(in), target :: P, Q
+      double precision, intent(in), target :: P_density_max(*), Q_density_max(*)
+      double precision, intent(inout), target :: work(*), integrals(*)
+      real(C_DOUBLE), intent(in) :: screen_tol
+      integer :: res
+      integer(C_INT) :: res2
+
+      res2 = c_simint_compute_eri_density(C_LOC(P), C_LOC(Q), &
+                                          REAL(screen_tol, C_DOUBLE), &
+                                          C_LOC(P_density_max), C_LOC(Q_density_max), &
+                                          C_LOC(work), C_LOC(integrals))
+      res = INT(res2)
+    end function
+
+    function simint_compute_eri_mixed(P, Q, screen_tol, single_tol, work, integrals) &
+             result(res)
+      implicit none
+
+      type(c_simint_multi_shellpair), intent(in), target :: P, Q
+      double precision, intent(inout), target :: work(*), integrals(*)
+      real(C_DOUBLE), intent(in) :: screen_tol, single_tol
+      integer :: res
+      integer(C_INT) :: res2
+
+      res2 = c_simint_compute_eri_mixed(C_LOC(P), C_LOC(Q), &
+                                        REAL(screen_tol, C_DOUBLE), &
+                                        REAL(single_tol, C_DOUBLE), &
+                                        C_LOC(work), C_LOC(integrals))
+      res = INT(res2)
+    end function
+
     function simint_compute_eri_deriv(deriv, P, Q, screen_tol, work, integrals) &
              result(res)
       implicit none
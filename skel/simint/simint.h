@@ -4,4 +4,6 @@
 #include "simint/ostei/ostei_config.h"
 #include "simint/simint_init.h"
 #include "simint/simint_eri.h"
+#include "simint/simint_engine.h"
+#include "simint/simint_stats.h"
 #include "simint/simint_oneelectron.h"
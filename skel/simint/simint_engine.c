@@ -0,0 +1,480 @@
+#include <stdlib.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "simint/simint_engine.h"
+#include "simint/simint_eri.h"
+#include "simint/shell/shell_screen.h"
+#include "simint/vectorization/vectorization.h"
+
+
+#define NCART(am) ((((am)+2)*((am)+1))>>1)
+
+// Number of ket shell pairs combined into one multi shellpair
+#define SIMINT_ENGINE_NKET (4*SIMINT_NSHELL_SIMD)
+
+// Spacing of the queue counters of the threads
+// (so that they are on different cache lines)
+#define SIMINT_ENGINE_PAD 16
+
+
+// Arrays used by simint_eri_engine. All pointers
+// are NULL until allocated
+struct simint_engine_data
+{
+    int * class_start;      // first shell pair of each class
+    int * pair_shells;      // shells (a, b) of each shell pair
+    int * block_first;      // first shell pair of each ket block
+    int * block_class;      // class of each ket block
+    int * class_block;      // first ket block of each class
+    int * class_order;      // classes, most expensive bras first
+    int * order_start;      // first task of each class in class_order
+    double * class_cost;    // estimated cost of one bra of each class
+    long * queue_next;      // queue counter of each thread
+    int nket;               // number of ket blocks (multi shellpairs)
+    struct simint_multi_shellpair * kets;
+};
+
+
+static void simint_engine_free(struct simint_engine_data * E)
+{
+    if(E->kets != NULL)
+    {
+        simint_free_multi_shellpairs(E->nket, E->kets);
+        free(E->kets);
+    }
+
+    free(E->queue_next);
+    free(E->class_cost);
+    free(E->order_start);
+    free(E->class_order);
+    free(E->class_block);
+    free(E->block_class);
+    free(E->block_first);
+    free(E->pair_shells);
+    free(E->class_start);
+}
+
+
+// Creates a multi shellpair, reusing the memory of P if
+// it is large enough. Returns nonzero if it cannot be allocated
+static int simint_engine_shellpair(int npair, struct simint_shell const * AB,
+                                   struct simint_multi_shellpair * P,
+                                   int screen_method)
+{
+    simint_allocate_multi_shellpair2(npair, AB, P, screen_method);
+    if(P->ptr == NULL)
+    {
+        simint_initialize_multi_shellpair(P);
+        return 1;
+    }
+
+    simint_fill_multi_shellpair2(npair, AB, P, screen_method);
+    return 0;
+}
+
+
+long simint_eri_engine(int nshell, struct simint_shell const * shells,
+                       double screen_tol, int screen_method,
+                       simint_eri_block_func func, void * data)
+{
+    if(nshell < 0 || func == NULL)
+        return -1;
+    if(nshell == 0)
+        return 0;
+
+    // nothing can be screened without screening information
+    if(screen_method == SIMINT_SCREEN_NONE)
+        screen_tol = 0.0;
+    if(screen_tol <= 0.0)
+        screen_method = SIMINT_SCREEN_NONE;
+
+    const double screen_tol2 = screen_tol * screen_tol;
+
+    int maxam = 0;
+    for(int i = 0; i < nshell; i++)
+        maxam = (shells[i].am > maxam ? shells[i].am : maxam);
+
+    // there are no kernels for these
+    if(maxam > SIMINT_OSTEI_MAXAM)
+        return -1;
+
+    const int nam = maxam+1;
+    const int nclass = nam*nam;
+
+    struct simint_engine_data E = { NULL, NULL, NULL, NULL, NULL, NULL,
+                                    NULL, NULL, NULL, 0, NULL };
+
+
+    ////////////////////////////////////////////
+    // Significant shell pairs, sorted by the
+    // angular momentum of their shells
+    ////////////////////////////////////////////
+    double * schwarz = NULL;
+    double schwarz_max = 0.0;
+    if(screen_tol > 0.0)
+    {
+        schwarz = (double *)malloc((size_t)nshell * nshell * sizeof(double));
+        if(schwarz == NULL)
+            return -1;
+
+        if(simint_schwarz_matrix(nshell, shells, schwarz) < 0)
+        {
+            free(schwarz);
+            return -1;
+        }
+
+        for(size_t i = 0; i < (size_t)nshell * nshell; i++)
+            schwarz_max = (schwarz[i] > schwarz_max ? schwarz[i] : schwarz_max);
+    }
+
+    #define SIMINT_ENGINE_KEEP(i, j) (schwarz == NULL || \
+                                      schwarz[(size_t)(i)*nshell + (j)] * schwarz_max >= screen_tol2)
+    #define SIMINT_ENGINE_CLASS(i, j) (shells[i].am * nam + shells[j].am)
+
+    // number of primitive pairs in each class (for the cost estimates)
+    double * class_nprim = (double *)calloc(nclass, sizeof(double));
+    E.class_start = (int *)calloc(nclass+1, sizeof(int));
+    if(class_nprim == NULL || E.class_start == NULL)
+    {
+        free(class_nprim);
+        free(schwarz);
+        simint_engine_free(&E);
+        return -1;
+    }
+
+    for(int i = 0; i < nshell; i++)
+    for(int j = 0; j <= i; j++)
+    {
+        if(SIMINT_ENGINE_KEEP(i, j))
+        {
+            E.class_start[SIMINT_ENGINE_CLASS(i, j)+1]++;
+            class_nprim[SIMINT_ENGINE_CLASS(i, j)] += (double)shells[i].nprim * shells[j].nprim;
+        }
+    }
+
+    for(int c = 0; c < nclass; c++)
+        E.class_start[c+1] += E.class_start[c];
+
+    const int npair = E.class_start[nclass];
+
+    // shells of each pair, (a, b) with a >= b
+    E.pair_shells = (int *)malloc(2 * (size_t)(npair > 0 ? npair : 1) * sizeof(int));
+    int * class_fill = (int *)malloc(nclass * sizeof(int));
+    if(E.pair_shells == NULL || class_fill == NULL)
+    {
+        free(class_fill);
+        free(class_nprim);
+        free(schwarz);
+        simint_engine_free(&E);
+        return -1;
+    }
+
+    for(int c = 0; c < nclass; c++)
+        class_fill[c] = E.class_start[c];
+
+    for(int i = 0; i < nshell; i++)
+    for(int j = 0; j <= i; j++)
+    {
+        if(SIMINT_ENGINE_KEEP(i, j))
+        {
+            const int p = class_fill[SIMINT_ENGINE_CLASS(i, j)]++;
+            E.pair_shells[2*p] = i;
+            E.pair_shells[2*p+1] = j;
+        }
+    }
+
+    #undef SIMINT_ENGINE_KEEP
+    #undef SIMINT_ENGINE_CLASS
+
+    free(class_fill);
+    free(schwarz);
+
+
+    ////////////////////////////////////////////
+    // Blocks of ket shell pairs (within a class)
+    ////////////////////////////////////////////
+    int nblock = 0;
+    for(int c = 0; c < nclass; c++)
+    {
+        const int n = E.class_start[c+1] - E.class_start[c];
+        nblock += (n + SIMINT_ENGINE_NKET - 1) / SIMINT_ENGINE_NKET;
+    }
+
+    E.block_first = (int *)malloc((nblock > 0 ? nblock : 1) * sizeof(int));
+    E.block_class = (int *)malloc((nblock > 0 ? nblock : 1) * sizeof(int));
+    E.class_block = (int *)malloc((nclass+1) * sizeof(int));
+    if(E.block_first == NULL || E.block_class == NULL || E.class_block == NULL)
+    {
+        free(class_nprim);
+        simint_engine_free(&E);
+        return -1;
+    }
+
+    nblock = 0;
+    for(int c = 0; c < nclass; c++)
+    {
+        E.class_block[c] = nblock;
+        for(int p = E.class_start[c]; p < E.class_start[c+1]; p += SIMINT_ENGINE_NKET)
+        {
+            E.block_first[nblock] = p;
+            E.block_class[nblock] = c;
+            nblock++;
+        }
+    }
+    E.class_block[nclass] = nblock;
+
+
+    ////////////////////////////////////////////
+    // Order of the tasks. Each task is one bra shell
+    // pair, with all kets of the classes before that
+    // of the bra, and the kets up to the bra itself
+    // within its own class (so each quartet is computed
+    // once). The classes are ordered by the estimated
+    // cost of their bras (from simint_ostei_cost), and
+    // the bras of a class from last to first, so the
+    // most expensive tasks are started first. The task
+    // list itself is never stored; task k is found from
+    // order_start.
+    ////////////////////////////////////////////
+    E.class_cost = (double *)calloc(nclass, sizeof(double));
+    E.class_order = (int *)malloc(nclass * sizeof(int));
+    E.order_start = (int *)malloc((nclass+1) * sizeof(int));
+    if(E.class_cost == NULL || E.class_order == NULL || E.order_start == NULL)
+    {
+        free(class_nprim);
+        simint_engine_free(&E);
+        return -1;
+    }
+
+    for(int c = 0; c < nclass; c++)
+    {
+        const int n = E.class_start[c+1] - E.class_start[c];
+        if(n == 0)
+            continue;
+
+        // simint_ostei_cost is linear in the number of primitives
+        const double bra_nprim = class_nprim[c] / n;
+
+        for(int d = 0; d <= c; d++)
+        {
+            const int nd = E.class_start[d+1] - E.class_start[d];
+            if(nd == 0)
+                continue;
+
+            const struct simint_ostei_cost_info cost = simint_ostei_cost(c / nam, c % nam, d / nam, d % nam, 1, 1);
+            double ket_cost = cost.prim_flops * bra_nprim * class_nprim[d] + cost.cont_flops * nd;
+
+            // on average, half of the kets of its own class
+            if(d == c)
+                ket_cost *= 0.5;
+
+            E.class_cost[c] += ket_cost;
+        }
+    }
+
+    free(class_nprim);
+
+    // there are few classes, so a simple insertion sort is enough
+    for(int c = 0; c < nclass; c++)
+    {
+        int i = c;
+        for(; i > 0 && E.class_cost[E.class_order[i-1]] < E.class_cost[c]; i--)
+            E.class_order[i] = E.class_order[i-1];
+        E.class_order[i] = c;
+    }
+
+    E.order_start[0] = 0;
+    for(int i = 0; i < nclass; i++)
+    {
+        const int c = E.class_order[i];
+        E.order_start[i+1] = E.order_start[i] + E.class_start[c+1] - E.class_start[c];
+    }
+
+
+    ////////////////////////////////////////////
+    // Create the ket shell pairs (one for each block).
+    // The bras are created by each task as needed
+    ////////////////////////////////////////////
+    E.nket = nblock;
+    E.kets = (struct simint_multi_shellpair *)
+             malloc((nblock > 0 ? nblock : 1) * sizeof(struct simint_multi_shellpair));
+    if(E.kets == NULL)
+    {
+        simint_engine_free(&E);
+        return -1;
+    }
+
+    simint_initialize_multi_shellpairs(nblock, E.kets);
+
+    int failed = 0;
+
+    #pragma omp parallel reduction(+:failed)
+    {
+        struct simint_shell AB[2*SIMINT_ENGINE_NKET];
+
+        #pragma omp for schedule(dynamic)
+        for(int b = 0; b < nblock; b++)
+        {
+            const int first = E.block_first[b];
+            const int end = E.class_start[E.block_class[b]+1];
+            const int n = (end - first < SIMINT_ENGINE_NKET ? end - first : SIMINT_ENGINE_NKET);
+
+            for(int p = 0; p < n; p++)
+            {
+                AB[2*p]   = shells[E.pair_shells[2*(first+p)]];
+                AB[2*p+1] = shells[E.pair_shells[2*(first+p)+1]];
+            }
+
+            failed += simint_engine_shellpair(n, AB, E.kets + b, screen_method);
+        }
+    }
+
+    if(failed)
+    {
+        simint_engine_free(&E);
+        return -1;
+    }
+
+
+    ////////////////////////////////////////////
+    // Compute
+    ////////////////////////////////////////////
+    int maxthread = 1;
+    #ifdef _OPENMP
+    maxthread = omp_get_max_threads();
+    #endif
+
+    E.queue_next = (long *)calloc((size_t)maxthread * SIMINT_ENGINE_PAD, sizeof(long));
+    if(E.queue_next == NULL)
+    {
+        simint_engine_free(&E);
+        return -1;
+    }
+
+    const int maxncart = NCART(maxam);
+    const size_t workmem = simint_eri_workmem(0, maxam);
+    const size_t intmem = (size_t)SIMINT_ENGINE_NKET * maxncart * maxncart * maxncart * maxncart * sizeof(double);
+
+    long nblock_done = 0;
+
+    #pragma omp parallel reduction(+:nblock_done)
+    {
+        int nthread = 1;
+        int ithread = 0;
+        #ifdef _OPENMP
+        nthread = omp_get_num_threads();
+        ithread = omp_get_thread_num();
+        #endif
+
+        double * work = (double *)SIMINT_ALLOC(workmem);
+        double * integrals = (double *)SIMINT_ALLOC(intmem);
+
+        // the bra of the current task
+        struct simint_multi_shellpair P;
+        simint_initialize_multi_shellpair(&P);
+
+        // no thread starts unless all workspaces are allocated
+        if(work == NULL || integrals == NULL)
+        {
+            #pragma omp atomic write
+            failed = 1;
+        }
+
+        #pragma omp barrier
+
+        int stop;
+        #pragma omp atomic read
+        stop = failed;
+
+        // Thread t owns tasks t, t + nthread, t + 2*nthread, ... Since the tasks
+        // are ordered by cost, all threads start with a similar mix of them.
+        // Once its own queue is empty, a thread takes tasks from the other
+        // queues (each task is claimed by incrementing the counter of its queue)
+        for(int v = 0; v < nthread && !stop; v++)
+        {
+            const int queue = (ithread + v) % nthread;
+            long * next = E.queue_next + (size_t)queue * SIMINT_ENGINE_PAD;
+
+            while(!stop)
+            {
+                long k;
+                #pragma omp atomic capture
+                k = (*next)++;
+
+                const long t = queue + k * nthread;
+                if(t >= npair)
+                    break;
+
+                // find the bra of this task
+                int o = 0;
+                while(E.order_start[o+1] <= t)
+                    o++;
+
+                const int c = E.class_order[o];
+                const int p = E.class_start[c+1] - 1 - (int)(t - E.order_start[o]);
+                int const * bra_shells = E.pair_shells + 2*p;
+
+                struct simint_shell AB[2] = { shells[bra_shells[0]], shells[bra_shells[1]] };
+                if(simint_engine_shellpair(1, AB, &P, screen_method))
+                {
+                    #pragma omp atomic write
+                    failed = 1;
+                    stop = 1;
+                    break;
+                }
+
+                for(int b = 0; b < E.class_block[c+1]; b++)
+                {
+                    if(E.block_first[b] > p)
+                        break;
+
+                    // only the first nket shell pairs of the block are computed
+                    struct simint_multi_shellpair Q = E.kets[b];
+                    if(screen_tol > 0.0 && (P.screen_max * Q.screen_max) < screen_tol2)
+                        continue;
+
+                    const int nket = (E.block_class[b] == c && (p - E.block_first[b] + 1) < Q.nshell12 ?
+                                      p - E.block_first[b] + 1 : Q.nshell12);
+                    Q.nshell12_clip = nket;
+
+                    // -1 only means that the block was screened out,
+                    // anything else negative is an error
+                    const int ret = simint_compute_eri(&P, &Q, screen_tol, work, integrals);
+                    if(ret == -1)
+                        continue;
+                    else if(ret < 0)
+                    {
+                        #pragma omp atomic write
+                        failed = 1;
+                        stop = 1;
+                        break;
+                    }
+
+                    struct simint_eri_block block;
+                    block.nbra = 1;
+                    block.nket = nket;
+                    block.bra_shells = bra_shells;
+                    block.ket_shells = E.pair_shells + 2*E.block_first[b];
+                    block.integrals = integrals;
+                    block.thread = ithread;
+
+                    func(&block, data);
+                    nblock_done++;
+                }
+            }
+        }
+
+        simint_free_multi_shellpair(&P);
+        if(integrals != NULL)
+            SIMINT_FREE(integrals);
+        if(work != NULL)
+            SIMINT_FREE(work);
+    }
+
+    simint_engine_free(&E);
+
+    return failed ? -1 : nblock_done;
+}
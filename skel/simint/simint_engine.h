@@ -0,0 +1,73 @@
+#pragma once
+
+#include "simint/shell/shell.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*! \brief A block of integrals computed by simint_eri_engine
+ *
+ * The block holds the integrals (ab|cd) for one shell pair ab in
+ * the bra and several shell pairs cd in the ket, in the same order
+ * as simint_compute_eri. The shell pairs are given as indices into
+ * the shells passed to simint_eri_engine.
+ */
+struct simint_eri_block
+{
+    int nbra;                  //!< Number of shell pairs in the bra
+    int nket;                  //!< Number of shell pairs in the ket
+    int const * bra_shells;    //!< Shells (a, b) of each bra shell pair (length 2*nbra)
+    int const * ket_shells;    //!< Shells (c, d) of each ket shell pair (length 2*nket)
+    double const * integrals;  //!< The integrals (nbra * nket * ncart(a)ncart(b)ncart(c)ncart(d))
+    int thread;                //!< Thread that computed this block (0 without OpenMP)
+};
+
+
+/*! \brief Function that is given each block computed by simint_eri_engine
+ *
+ * This is called from several threads at the same time, so any shared data
+ * it modifies must be protected. The block is only valid during the call.
+ */
+typedef void (*simint_eri_block_func)(struct simint_eri_block const * block, void * data);
+
+
+/*! \brief Compute all unique shell quartets of a basis
+ *
+ * Computes (ab|cd) for all a >= b, c >= d, and ab >= cd (as pairs), except
+ * those that are screened out, and passes them to \p func in blocks.
+ *
+ * The shell pairs are grouped by the angular momentum of their shells, and the
+ * kets of each group are combined into multi shellpairs that fill the vectors of
+ * the kernels. Each bra shell pair (with all of its kets) is one task, and the
+ * tasks are spread over the OpenMP threads (if enabled), most expensive first
+ * (as predicted by simint_ostei_cost). The tasks are not stored, but generated
+ * as the threads take them, and the bra shell pair is created by the thread
+ * that computes it. Each thread has its own queue of tasks (and its own
+ * workspace), and takes tasks from the queues of other threads once its own
+ * is empty, so that expensive tasks of high angular momentum don't leave the
+ * other threads idle.
+ *
+ * With screening, shell pairs whose Schwarz value is insignificant with every
+ * other pair are dropped entirely, and blocks that are screened out by
+ * simint_compute_eri are not passed to \p func.
+ *
+ * \param [in] nshell Number of shells
+ * \param [in] shells The shells (normalized)
+ * \param [in] screen_tol Tolerance for screening (set to zero to disable)
+ * \param [in] screen_method Screening method for the shell pairs (ignored if \p screen_tol is zero)
+ * \param [in] func Function that is given each block of integrals
+ * \param [in] data Passed to \p func unchanged
+ * \return The number of blocks passed to \p func, or -1 on error (if memory
+ *         cannot be allocated, there are no kernels for a shell, or
+ *         simint_compute_eri fails for a block)
+ */
+long simint_eri_engine(int nshell, struct simint_shell const * shells,
+                       double screen_tol, int screen_method,
+                       simint_eri_block_func func, void * data);
+
+
+#ifdef __cplusplus
+}
+#endif
@@ -10,6 +10,43 @@ int simint_compute_eri(struct simint_multi_shellpair const * P,
     return simint_compute_ostei(P, Q, screen_tol, work, integrals);
 }
 
+int simint_compute_eri_density(struct simint_multi_shellpair const * P,
+                               struct simint_multi_shellpair const * Q,
+                               double screen_tol,
+                               double const * P_density_max,
+                               double const * Q_density_max,
+                               double * restrict work,
+                               double * restrict integrals)
+{
+    return simint_compute_ostei_density(P, Q, screen_tol, P_density_max, Q_density_max,
+                                        work, integrals);
+}
+
+int simint_compute_eri_mixed(struct simint_multi_shellpair const * P,
+                             struct simint_multi_shellpair const * Q,
+                             double screen_tol,
+                             double single_tol,
+                             double * restrict work,
+                             double * restrict integrals)
+{
+    return simint_compute_ostei_mixed(P, Q, screen_tol, single_tol, work, integrals);
+}
+
+int simint_compute_eri_jk(struct simint_multi_shellpair const * P,
+                          struct simint_multi_shellpair const * Q,
+                          double screen_tol,
+                          int nbf,
+                          int const * P_bf,
+                          int const * Q_bf,
+                          double const * D,
+                          double * J,
+                          double * K,
+                          double * restrict work)
+{
+    struct simint_jk jk = { nbf, P_bf, Q_bf, D, J, K };
+    return simint_compute_ostei_jk(P, Q, screen_tol, &jk, work);
+}
+
 int simint_compute_eri_deriv(int deriv,
                              struct simint_multi_shellpair const * P,
                              struct simint_multi_shellpair const * Q,
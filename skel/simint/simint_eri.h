@@ -25,6 +25,76 @@ int simint_compute_eri(struct simint_multi_shellpair const * P,
                        double * restrict work,
                        double * restrict integrals);
 
+/*! \brief Compute an ostei, screening with bounds on the density
+ *
+ * See simint_compute_ostei_density
+ *
+ * \param [in] P The shell pairs for the bra side of the integral
+ * \param [in] Q The shell pairs for the ket side of the integral
+ * \param [in] screen_tol Tolerance for screening (set to zero to disable)
+ * \param [in] P_density_max Bound on the density for each shell pair in \p P
+ * \param [in] Q_density_max Bound on the density for each shell pair in \p Q
+ * \param [in] work Workspace to use in calculating the integrals
+ * \param [inout] integrals Storage for the final integrals. Since size information
+ *                          is not passed, you are expected to ensure that this buffer
+ *                          is large enough
+ */
+int simint_compute_eri_density(struct simint_multi_shellpair const * P,
+                               struct simint_multi_shellpair const * Q,
+                               double screen_tol,
+                               double const * P_density_max,
+                               double const * Q_density_max,
+                               double * restrict work,
+                               double * restrict integrals);
+
+/*! \brief Compute an ostei, using single precision kernels for small integrals
+ *
+ * See simint_compute_ostei_mixed
+ *
+ * \param [in] P The shell pairs for the bra side of the integral 
+ * \param [in] Q The shell pairs for the ket side of the integral
+ * \param [in] screen_tol Tolerance for screening (set to zero to disable)
+ * \param [in] single_tol Magnitude below which single precision is used
+ *                        (set to zero to disable)
+ * \param [in] work Workspace to use in calculating the integrals
+ * \param [inout] integrals Storage for the final integrals. Since size information
+ *                          is not passed, you are expected to ensure that this buffer
+ *                          is large enough
+ */
+int simint_compute_eri_mixed(struct simint_multi_shellpair const * P,
+                             struct simint_multi_shellpair const * Q,
+                             double screen_tol,
+                             double single_tol,
+                             double * restrict work,
+                             double * restrict integrals);
+
+/*! \brief Compute an ostei and contract it with a density into J and K
+ *
+ * See simint_compute_ostei_jk. The matrices are square (nbf x nbf), row major,
+ * and indexed by cartesian basis function.
+ *
+ * \param [in] P The shell pairs for the bra side of the integral 
+ * \param [in] Q The shell pairs for the ket side of the integral
+ * \param [in] screen_tol Tolerance for screening (set to zero to disable)
+ * \param [in] nbf Number of basis functions
+ * \param [in] P_bf First basis function of both shells of each shell pair in \p P
+ * \param [in] Q_bf First basis function of both shells of each shell pair in \p Q
+ * \param [in] D Density matrix
+ * \param [inout] J Coulomb matrix to add to (may be NULL)
+ * \param [inout] K Exchange matrix to add to (may be NULL)
+ * \param [in] work Workspace to use in calculating the integrals
+ */
+int simint_compute_eri_jk(struct simint_multi_shellpair const * P,
+                          struct simint_multi_shellpair const * Q,
+                          double screen_tol,
+                          int nbf,
+                          int const * P_bf,
+                          int const * Q_bf,
+                          double const * D,
+                          double * J,
+                          double * K,
+                          double * restrict work);
+
 /*! \brief Compute an ostei given shell pair information
  *
  * \param [in] deriv Order of the derivative to compute
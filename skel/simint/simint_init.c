@@ -1,16 +1,30 @@
 #include "simint/simint_init.h"
 #include "simint/ostei/ostei_init.h"
+#include "simint/vectorization/vectorization.h"
 
 void simint_init(void)
 {
+#ifdef SIMINT_MULTI_ISA
+    simint_ostei_isa_init();
+#else
     simint_ostei_init();
     simint_ostei_deriv1_init();
+    simint_ostei_f32_init();
+    simint_ostei_jk_init();
+    simint_ostei_schwarz_init();
+#endif
 }
 
 
 void simint_finalize(void)
 {
+#ifdef SIMINT_MULTI_ISA
+    simint_ostei_isa_finalize();
+#else
     simint_ostei_finalize();
     simint_ostei_deriv1_finalize();
+    simint_ostei_f32_finalize();
+    simint_ostei_jk_finalize();
+    simint_ostei_schwarz_finalize();
+#endif
 }
-
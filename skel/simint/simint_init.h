@@ -37,6 +37,15 @@ void simint_init(void);
 void simint_finalize(void);
 
 
+/*! \brief Returns the vectorization type of the integral kernels in use
+ *
+ * For a library built with several vectorization types (SIMINT_VECTOR=multi),
+ * this is the one chosen by simint_init() ("none" before that). Otherwise,
+ * it is the one the library was built for.
+ */
+char const * simint_vector_isa(void);
+
+
 #ifdef __cplusplus
 }
 #endif
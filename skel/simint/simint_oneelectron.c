@@ -25,3 +25,43 @@ int simint_compute_potential(int ncenter,
 {
     return simint_compute_osoei_potential(ncenter, Z, x, y, z, sh1, sh2, integrals);
 }
+
+
+int simint_compute_potential_centers(int ncenter,
+                                     double const * Z, double const * x,
+                                     double const * y, double const * z,
+                                     double cutoff, int nthread,
+                                     struct simint_shell const * sh1,
+                                     struct simint_shell const * sh2,
+                                     double * restrict integrals)
+{
+    return simint_compute_osoei_potential_centers(ncenter, Z, x, y, z, cutoff, nthread,
+                                                  sh1, sh2, integrals);
+}
+
+
+int simint_compute_overlap_multi(struct simint_multi_shellpair const * P,
+                                 double * restrict work,
+                                 double * restrict integrals)
+{
+    return simint_compute_osoei_overlap_multi(P, work, integrals);
+}
+
+
+int simint_compute_ke_multi(struct simint_multi_shellpair const * P,
+                            double * restrict work,
+                            double * restrict integrals)
+{
+    return simint_compute_osoei_ke_multi(P, work, integrals);
+}
+
+
+int simint_compute_potential_multi(int ncenter,
+                                   double const * Z, double const * x,
+                                   double const * y, double const * z,
+                                   struct simint_multi_shellpair const * P,
+                                   double * restrict work,
+                                   double * restrict integrals)
+{
+    return simint_compute_osoei_potential_multi(ncenter, Z, x, y, z, P, work, integrals);
+}
@@ -2,6 +2,7 @@
 
 #include "simint/shell/shell.h"
 #include "simint/ostei/ostei_config.h"
+#include "simint/osoei/osoei.h"
 
 #ifdef __cplusplus
 #include "simint/cpp_restrict.hpp"
@@ -24,6 +25,69 @@ int simint_compute_potential(int ncenter,
                              struct simint_shell const * sh2,
                              double * restrict integrals);
 
+
+/*! \brief Nuclear attraction integrals of a shell pair for many point charges
+ *
+ * Gives the same integrals as simint_compute_potential, but the charges
+ * are handled in vectors (including the Boys function), which is much
+ * faster when there are many of them (for example, in QM/MM).
+ *
+ * \param [in] cutoff Charges further than this from the line segment
+ *                    between the two shells are left out. Zero (or less)
+ *                    to include all of them.
+ * \param [in] nthread Number of threads to split the charges over. The
+ *                     integrals are only computed in parallel if this
+ *                     is more than one.
+ * \return The number of shell pairs computed (one), or -1 if memory
+ *         could not be allocated
+ */
+int simint_compute_potential_centers(int ncenter,
+                                     double const * Z, double const * x,
+                                     double const * y, double const * z,
+                                     double cutoff, int nthread,
+                                     struct simint_shell const * sh1,
+                                     struct simint_shell const * sh2,
+                                     double * restrict integrals);
+
+
+/*! \brief Overlap integrals of all the shell pairs in a multi shell pair
+ *
+ * Faster than calling simint_compute_overlap for each pair of shells,
+ * since the primitive pairs are handled in vectors.
+ *
+ * \param [in] P The shell pairs
+ * \param [in] work Workspace (aligned, with at least simint_osoei_worksize(maxam)
+ *                  elements, where maxam is the largest AM of the shells)
+ * \param [out] integrals The integrals of each shell pair (ncart1*ncart2 each),
+ *                        one shell pair after the other
+ * \return The number of shell pairs computed
+ */
+int simint_compute_overlap_multi(struct simint_multi_shellpair const * P,
+                                 double * restrict work,
+                                 double * restrict integrals);
+
+
+/*! \brief Kinetic energy integrals of all the shell pairs in a multi shell pair
+ *
+ * See simint_compute_overlap_multi
+ */
+int simint_compute_ke_multi(struct simint_multi_shellpair const * P,
+                            double * restrict work,
+                            double * restrict integrals);
+
+
+/*! \brief Nuclear attraction integrals of all the shell pairs in a multi shell pair
+ *
+ * See simint_compute_overlap_multi. The point charges are given as for
+ * simint_compute_potential.
+ */
+int simint_compute_potential_multi(int ncenter,
+                                   double const * Z, double const * x,
+                                   double const * y, double const * z,
+                                   struct simint_multi_shellpair const * P,
+                                   double * restrict work,
+                                   double * restrict integrals);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,45 @@
+#include <string.h>
+
+#include "simint/simint_stats.h"
+
+#ifdef _MSC_VER
+  #define SIMINT_THREAD_LOCAL __declspec(thread)
+#else
+  #define SIMINT_THREAD_LOCAL __thread
+#endif
+
+
+// Statistics of each thread. The kernels count in local variables
+// and only add them here once per call
+static SIMINT_THREAD_LOCAL struct simint_screen_stats simint_stats_thread;
+
+
+void simint_stats_reset(void)
+{
+    memset(&simint_stats_thread, 0, sizeof(struct simint_screen_stats));
+}
+
+
+void simint_stats_get(struct simint_screen_stats * stats)
+{
+    *stats = simint_stats_thread;
+}
+
+
+void simint_stats_add_skipped(long nshell1234)
+{
+    simint_stats_thread.shell_skip += nshell1234;
+}
+
+
+void simint_stats_add_kernel(long nshell1234, long calc_nprim, long skip_nprim,
+                             long calc_nvec, long skip_nvec, long boys_mixed)
+{
+    struct simint_screen_stats * s = &simint_stats_thread;
+    s->shell_calc += nshell1234;
+    s->prim_calc += calc_nprim;
+    s->prim_skip += skip_nprim;
+    s->vec_calc += calc_nvec;
+    s->vec_skip += skip_nvec;
+    s->boys_mixed += boys_mixed;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*! \brief Counts of what was computed and screened out by the integral kernels
+ *
+ * These are counted by each thread separately (see simint_stats_get).
+ * The primitive quartets are counted by the lanes of the vectors in the
+ * kernels, so they include the padding of vectors that are not full.
+ */
+struct simint_screen_stats
+{
+    unsigned long long shell_calc;  //!< Shell quartets computed
+    unsigned long long shell_skip;  //!< Shell quartets screened out before calling a kernel
+    unsigned long long prim_calc;   //!< Primitive quartets computed
+    unsigned long long prim_skip;   //!< Primitive quartets screened out
+    unsigned long long vec_calc;    //!< Vectors of primitive quartets computed
+    unsigned long long vec_skip;    //!< Vectors of primitive quartets screened out entirely
+    unsigned long long boys_mixed;  //!< Boys function vectors with lanes in both the short and long range
+};
+
+
+/*! \brief Zero the screening statistics of the calling thread
+ */
+void simint_stats_reset(void);
+
+
+/*! \brief Get the screening statistics of the calling thread
+ *
+ * These are the counts since the last call to simint_stats_reset from
+ * this thread. To get the totals of a parallel region, call this in each
+ * thread and add them up.
+ *
+ * \param [out] stats The counts
+ */
+void simint_stats_get(struct simint_screen_stats * stats);
+
+
+/*! \brief Count shell quartets that were screened out (used by simint)
+ */
+void simint_stats_add_skipped(long nshell1234);
+
+
+/*! \brief Count what was done by a call to a kernel (used by the kernels)
+ */
+void simint_stats_add_kernel(long nshell1234, long calc_nprim, long skip_nprim,
+                             long calc_nvec, long skip_nvec, long boys_mixed);
+
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -38,6 +38,33 @@ static inline __m256d simint_pow_vec4(__m256d a, __m256d p)
     return res.v;
 }
 
+union simint_float8
+{
+    __m256 v;
+    float f[8];
+};
+
+
+// Single precision versions
+static inline __m256 simint_expf_vec8(__m256 x)
+{
+    union simint_float8 u = { x };
+    union simint_float8 res;
+    for(int i = 0; i < 8; i++)
+        res.f[i] = expf(u.f[i]);
+    return res.v;
+}
+
+static inline __m256 simint_powf_vec8(__m256 a, __m256 p)
+{
+    union simint_float8 ua = { a };
+    union simint_float8 up = { p };
+    union simint_float8 res;
+    for(int i = 0; i < 8; i++)
+        res.f[i] = powf(ua.f[i], up.f[i]);
+    return res.v;
+}
+
 #if defined SIMINT_AVX || defined SIMINT_AVX2
 
     #define SIMINT_SIMD_LEN 4
@@ -51,6 +78,7 @@ static inline __m256d simint_pow_vec4(__m256d a, __m256d p)
     #define SIMINT_MUL(a,b)        _mm256_mul_pd((a), (b))
     #define SIMINT_DIV(a,b)        _mm256_div_pd((a), (b))
     #define SIMINT_SQRT(a)         _mm256_sqrt_pd((a))
+    #define SIMINT_MAX(a,b)        _mm256_max_pd((a), (b))
 
     #ifdef SIMINT_AVX2
       #define SIMINT_FMADD(a,b,c)  _mm256_fmadd_pd((a), (b), (c))
@@ -69,6 +97,36 @@ static inline __m256d simint_pow_vec4(__m256d a, __m256d p)
     #endif
 
 
+    ////////////////////////////////////////
+    // Single precision (twice the lanes)
+    ////////////////////////////////////////
+    #define SIMINT_FLT_LEN 8
+
+    #define SIMINT_FLTTYPE             __m256
+    // (SIMINT_FLT_LEN doubles, converted)
+    #define SIMINT_FLTLOAD(p,i)        _mm256_set_m128(_mm256_cvtpd_ps(_mm256_load_pd((p) + (i) + 4)), \
+                                                       _mm256_cvtpd_ps(_mm256_load_pd((p) + (i))))
+    #define SIMINT_FLTSET1(a)          _mm256_set1_ps((a))
+    #define SIMINT_FLT_NEG(a)          (-(a))
+    #define SIMINT_FLT_ADD(a,b)        _mm256_add_ps((a), (b))
+    #define SIMINT_FLT_SUB(a,b)        _mm256_sub_ps((a), (b))
+    #define SIMINT_FLT_MUL(a,b)        _mm256_mul_ps((a), (b))
+    #define SIMINT_FLT_DIV(a,b)        _mm256_div_ps((a), (b))
+    #define SIMINT_FLT_SQRT(a)         _mm256_sqrt_ps((a))
+    #define SIMINT_FLT_MAX(a,b)        _mm256_max_ps((a), (b))
+
+    #ifdef SIMINT_AVX2
+      #define SIMINT_FLT_FMADD(a,b,c)  _mm256_fmadd_ps((a), (b), (c))
+      #define SIMINT_FLT_FMSUB(a,b,c)  _mm256_fmsub_ps((a), (b), (c))
+    #else
+      #define SIMINT_FLT_FMADD(a,b,c)  SIMINT_FLT_ADD(SIMINT_FLT_MUL((a),(b)),(c))
+      #define SIMINT_FLT_FMSUB(a,b,c)  SIMINT_FLT_SUB(SIMINT_FLT_MUL((a),(b)),(c))
+    #endif
+
+    #define SIMINT_FLT_EXP(a)          simint_expf_vec8((a))
+    #define SIMINT_FLT_POW(a,p)        simint_powf_vec8((a), (p))
+
+
     ////////////////////////////////////////
     // Special functions
     ////////////////////////////////////////
@@ -216,15 +274,66 @@ static inline __m256d simint_pow_vec4(__m256d a, __m256d p)
         return u.v;
     }
     
-    #define SIMINT_PRIM_SCREEN_STAT
+    // 1.0 where a >= b, 0.0 elsewhere
+    static inline
+    __m256d vector_ge(__m256d a, __m256d b)
+    {
+        return _mm256_and_pd(_mm256_cmp_pd(a, b, _CMP_GE_OQ), _mm256_set1_pd(1.0));
+    }
+
+    static inline
+    __m256d vector_floor(__m256d a)
+    {
+        return _mm256_floor_pd(a);
+    }
+
+    // Elements of base at the given indices (whole numbers, stored as doubles)
+    static inline
+    __m256d vector_gather(double const * base, __m256d idx)
+    {
+        #ifdef SIMINT_AVX2
+        // (the masked form, since the unmasked one leaves its
+        // source operand undefined, which GCC warns about)
+        return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), base, _mm256_cvttpd_epi32(idx),
+                                        _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), 8);
+        #else
+        union simint_double4 u = { idx };
+        return _mm256_set_pd(base[(int)u.d[3]], base[(int)u.d[2]], base[(int)u.d[1]], base[(int)u.d[0]]);
+        #endif
+    }
+
+    // Single precision versions of the above
+    static inline
+    __m256 vector_ge_f32(__m256 a, __m256 b)
+    {
+        return _mm256_and_ps(_mm256_cmp_ps(a, b, _CMP_GE_OQ), _mm256_set1_ps(1.0f));
+    }
+
+    static inline
+    __m256 vector_floor_f32(__m256 a)
+    {
+        return _mm256_floor_ps(a);
+    }
+
+    static inline
+    __m256 vector_gather_f32(float const * base, __m256 idx)
+    {
+        #ifdef SIMINT_AVX2
+        return _mm256_mask_i32gather_ps(_mm256_setzero_ps(), base, _mm256_cvttps_epi32(idx),
+                                        _mm256_castsi256_ps(_mm256_set1_epi32(-1)), 4);
+        #else
+        union simint_float8 u = { idx };
+        return _mm256_set_ps(base[(int)u.f[7]], base[(int)u.f[6]], base[(int)u.f[5]], base[(int)u.f[4]],
+                             base[(int)u.f[3]], base[(int)u.f[2]], base[(int)u.f[1]], base[(int)u.f[0]]);
+        #endif
+    }
+
+    // Number of elements that are at least screen_tol
     static inline
     int count_prim_screen_survival(__m256d screen_val, const double screen_tol)
     {
-        union simint_double4 u = {screen_val};
-        int res = 0;
-        for (int i = 0; i < SIMINT_SIMD_LEN; i++)
-            if (u.d[i] >= screen_tol) res++;
-        return res;
+        const __m256d keep = _mm256_cmp_pd(screen_val, _mm256_set1_pd(screen_tol), _CMP_GE_OQ);
+        return __builtin_popcount(_mm256_movemask_pd(keep));
     }
 
 #endif // defined SIMINT_AVX
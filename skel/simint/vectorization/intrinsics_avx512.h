@@ -38,6 +38,42 @@ static inline __m512d simint_pow_vec8(__m512d a, __m512d p)
     return res.v;
 }
 
+union simint_float16
+{
+    __m512 v;
+    float f[16];
+};
+
+
+// Single precision versions
+static inline __m512 simint_expf_vec16(__m512 x)
+{
+    union simint_float16 u = { x };
+    union simint_float16 res;
+    for(int i = 0; i < 16; i++)
+        res.f[i] = expf(u.f[i]);
+    return res.v;
+}
+
+static inline __m512 simint_powf_vec16(__m512 a, __m512 p)
+{
+    union simint_float16 ua = { a };
+    union simint_float16 up = { p };
+    union simint_float16 res;
+    for(int i = 0; i < 16; i++)
+        res.f[i] = powf(ua.f[i], up.f[i]);
+    return res.v;
+}
+
+// 16 doubles, converted to single precision
+static inline __m512 simint_load_cvt_ps16(double const * p)
+{
+    const __m256 lo = _mm512_cvtpd_ps(_mm512_load_pd(p));
+    const __m256 hi = _mm512_cvtpd_ps(_mm512_load_pd(p + 8));
+    return _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(lo)),
+                                               _mm256_castps_pd(hi), 1));
+}
+
 #if defined SIMINT_AVX512 || defined SIMINT_MICAVX512
 
     #define SIMINT_SIMD_LEN 8
@@ -51,6 +87,7 @@ static inline __m512d simint_pow_vec8(__m512d a, __m512d p)
     #define SIMINT_MUL(a,b)        _mm512_mul_pd((a), (b))
     #define SIMINT_DIV(a,b)        _mm512_div_pd((a), (b))
     #define SIMINT_SQRT(a)         _mm512_sqrt_pd((a))
+    #define SIMINT_MAX(a,b)        _mm512_max_pd((a), (b))
     #define SIMINT_FMADD(a,b,c)    _mm512_fmadd_pd((a), (b), (c))
     #define SIMINT_FMSUB(a,b,c)    _mm512_fmsub_pd((a), (b), (c))
 
@@ -63,6 +100,28 @@ static inline __m512d simint_pow_vec8(__m512d a, __m512d p)
     #endif
 
 
+    ////////////////////////////////////////
+    // Single precision (twice the lanes)
+    ////////////////////////////////////////
+    #define SIMINT_FLT_LEN 16
+
+    #define SIMINT_FLTTYPE             __m512
+    // (SIMINT_FLT_LEN doubles, converted)
+    #define SIMINT_FLTLOAD(p,i)        simint_load_cvt_ps16((p) + (i))
+    #define SIMINT_FLTSET1(a)          _mm512_set1_ps((a))
+    #define SIMINT_FLT_NEG(a)          (SIMINT_FLT_MUL((a), (SIMINT_FLTSET1(-1.0f))))
+    #define SIMINT_FLT_ADD(a,b)        _mm512_add_ps((a), (b))
+    #define SIMINT_FLT_SUB(a,b)        _mm512_sub_ps((a), (b))
+    #define SIMINT_FLT_MUL(a,b)        _mm512_mul_ps((a), (b))
+    #define SIMINT_FLT_DIV(a,b)        _mm512_div_ps((a), (b))
+    #define SIMINT_FLT_SQRT(a)         _mm512_sqrt_ps((a))
+    #define SIMINT_FLT_MAX(a,b)        _mm512_max_ps((a), (b))
+    #define SIMINT_FLT_FMADD(a,b,c)    _mm512_fmadd_ps((a), (b), (c))
+    #define SIMINT_FLT_FMSUB(a,b,c)    _mm512_fmsub_ps((a), (b), (c))
+    #define SIMINT_FLT_EXP(a)          simint_expf_vec16((a))
+    #define SIMINT_FLT_POW(a,p)        simint_powf_vec16((a), (p))
+
+
 
     ////////////////////////////////////////
     // Special functions
@@ -163,7 +222,7 @@ static inline __m512d simint_pow_vec8(__m512d a, __m512d p)
         #else
 
         int offsets[8] = {0, 0, 0, 0, 0, 0, 0, 0};
-        contract_fac(ncart, offsets, factor, src, dest);
+        contract_fac(ncart, factor, offsets, src, dest);
 
         #endif
     }
@@ -207,15 +266,51 @@ static inline __m512d simint_pow_vec8(__m512d a, __m512d p)
         return u.v;
     }
     
-    #define SIMINT_PRIM_SCREEN_STAT
+    // 1.0 where a >= b, 0.0 elsewhere
+    static inline
+    __m512d vector_ge(__m512d a, __m512d b)
+    {
+        return _mm512_maskz_mov_pd(_mm512_cmp_pd_mask(a, b, _CMP_GE_OQ), _mm512_set1_pd(1.0));
+    }
+
+    static inline
+    __m512d vector_floor(__m512d a)
+    {
+        return _mm512_roundscale_pd(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    }
+
+    // Elements of base at the given indices (whole numbers, stored as doubles)
+    static inline
+    __m512d vector_gather(double const * base, __m512d idx)
+    {
+        return _mm512_i32gather_pd(_mm512_cvttpd_epi32(idx), base, 8);
+    }
+
+    // Single precision versions of the above
+    static inline
+    __m512 vector_ge_f32(__m512 a, __m512 b)
+    {
+        return _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(a, b, _CMP_GE_OQ), _mm512_set1_ps(1.0f));
+    }
+
+    static inline
+    __m512 vector_floor_f32(__m512 a)
+    {
+        return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    }
+
+    static inline
+    __m512 vector_gather_f32(float const * base, __m512 idx)
+    {
+        return _mm512_i32gather_ps(_mm512_cvttps_epi32(idx), base, 4);
+    }
+
+    // Number of elements that are at least screen_tol
     static inline
     int count_prim_screen_survival(__m512d screen_val, const double screen_tol)
     {
-        union simint_double8 u = {screen_val};
-        int res = 0;
-        for (int i = 0; i < SIMINT_SIMD_LEN; i++)
-            if (u.d[i] >= screen_tol) res++;
-        return res;
+        const __mmask8 keep = _mm512_cmp_pd_mask(screen_val, _mm512_set1_pd(screen_tol), _CMP_GE_OQ);
+        return __builtin_popcount(keep);
     }
 
 #endif // defined SIMINT_AVX512 || defined SIMINT_MICAVX512
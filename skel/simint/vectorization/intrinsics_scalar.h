@@ -1,5 +1,7 @@
 #pragma once
 
+#include <math.h>
+
 #ifdef __cplusplus
 #include "simint/cpp_restrict.hpp"
 extern "C" {
@@ -18,12 +20,34 @@ extern "C" {
     #define SIMINT_MUL(a,b)        ((a)*(b))
     #define SIMINT_DIV(a,b)        ((a)/(b))
     #define SIMINT_SQRT(a)         sqrt((a))
+    #define SIMINT_MAX(a,b)        ((a) > (b) ? (a) : (b))
     #define SIMINT_FMADD(a,b,c)    SIMINT_ADD(SIMINT_MUL((a),(b)),(c))
     #define SIMINT_FMSUB(a,b,c)    SIMINT_SUB(SIMINT_MUL((a),(b)),(c))
     #define SIMINT_EXP(a)          exp((a))
     #define SIMINT_POW(a, p)       pow((a), (p))
 
 
+    ////////////////////////////////////////
+    // Single precision (no vectors here, so also one lane)
+    ////////////////////////////////////////
+    #define SIMINT_FLT_LEN 1
+
+    #define SIMINT_FLTTYPE             float
+    #define SIMINT_FLTLOAD(p,i)        ((float)((p)[(i)]))
+    #define SIMINT_FLTSET1(a)          ((float)(a))
+    #define SIMINT_FLT_NEG(a)          (-(a))
+    #define SIMINT_FLT_ADD(a,b)        ((a)+(b))
+    #define SIMINT_FLT_SUB(a,b)        ((a)-(b))
+    #define SIMINT_FLT_MUL(a,b)        ((a)*(b))
+    #define SIMINT_FLT_DIV(a,b)        ((a)/(b))
+    #define SIMINT_FLT_SQRT(a)         sqrtf((a))
+    #define SIMINT_FLT_MAX(a,b)        ((a) > (b) ? (a) : (b))
+    #define SIMINT_FLT_FMADD(a,b,c)    SIMINT_FLT_ADD(SIMINT_FLT_MUL((a),(b)),(c))
+    #define SIMINT_FLT_FMSUB(a,b,c)    SIMINT_FLT_SUB(SIMINT_FLT_MUL((a),(b)),(c))
+    #define SIMINT_FLT_EXP(a)          expf((a))
+    #define SIMINT_FLT_POW(a, p)       powf((a), (p))
+
+
     ////////////////////////////////////////
     // Special functions
     ////////////////////////////////////////
@@ -110,6 +134,54 @@ extern "C" {
     }
 
 
+    // 1.0 where a >= b, 0.0 elsewhere
+    static inline
+    double vector_ge(double a, double b)
+    {
+        return (a >= b) ? 1.0 : 0.0;
+    }
+
+    static inline
+    double vector_floor(double a)
+    {
+        return floor(a);
+    }
+
+    // Elements of base at the given indices (whole numbers, stored as doubles)
+    static inline
+    double vector_gather(double const * base, double idx)
+    {
+        return base[(int)idx];
+    }
+
+    // Single precision versions of the above
+    static inline
+    float vector_ge_f32(float a, float b)
+    {
+        return (a >= b) ? 1.0f : 0.0f;
+    }
+
+    static inline
+    float vector_floor_f32(float a)
+    {
+        return floorf(a);
+    }
+
+    static inline
+    float vector_gather_f32(float const * base, float idx)
+    {
+        return base[(int)idx];
+    }
+
+
+    // Number of elements that are at least screen_tol
+    static inline
+    int count_prim_screen_survival(double screen_val, const double screen_tol)
+    {
+        return (screen_val >= screen_tol);
+    }
+
+
 
 #endif // defined SIMINT_SCALAR
 
@@ -35,6 +35,33 @@ static inline __m128d simint_pow_vec2(__m128d a, __m128d p)
     return res.v;
 }
 
+union simint_float4
+{
+    __m128 v;
+    float f[4];
+};
+
+
+// Single precision versions
+static inline __m128 simint_expf_vec4(__m128 x)
+{
+    union simint_float4 u = { x };
+    union simint_float4 res;
+    for(int i = 0; i < 4; i++)
+        res.f[i] = expf(u.f[i]);
+    return res.v;
+}
+
+static inline __m128 simint_powf_vec4(__m128 a, __m128 p)
+{
+    union simint_float4 ua = { a };
+    union simint_float4 up = { p };
+    union simint_float4 res;
+    for(int i = 0; i < 4; i++)
+        res.f[i] = powf(ua.f[i], up.f[i]);
+    return res.v;
+}
+
 #if defined SIMINT_SSE
 
     #define SIMINT_SIMD_LEN 2
@@ -48,6 +75,7 @@ static inline __m128d simint_pow_vec2(__m128d a, __m128d p)
     #define SIMINT_MUL(a,b)        _mm_mul_pd((a), (b))
     #define SIMINT_DIV(a,b)        _mm_div_pd((a), (b))
     #define SIMINT_SQRT(a)         _mm_sqrt_pd((a))
+    #define SIMINT_MAX(a,b)        _mm_max_pd((a), (b))
 
     #ifdef SIMINT_FMA
       #define SIMINT_FMADD(a,b,c)  _mm_fmadd_pd((a), (b), (c))
@@ -66,6 +94,36 @@ static inline __m128d simint_pow_vec2(__m128d a, __m128d p)
     #endif
 
 
+    ////////////////////////////////////////
+    // Single precision (twice the lanes)
+    ////////////////////////////////////////
+    #define SIMINT_FLT_LEN 4
+
+    #define SIMINT_FLTTYPE             __m128
+    // (SIMINT_FLT_LEN doubles, converted)
+    #define SIMINT_FLTLOAD(p,i)        _mm_movelh_ps(_mm_cvtpd_ps(_mm_load_pd((p) + (i))), \
+                                                     _mm_cvtpd_ps(_mm_load_pd((p) + (i) + 2)))
+    #define SIMINT_FLTSET1(a)          _mm_set1_ps((a))
+    #define SIMINT_FLT_NEG(a)          (-(a))
+    #define SIMINT_FLT_ADD(a,b)        _mm_add_ps((a), (b))
+    #define SIMINT_FLT_SUB(a,b)        _mm_sub_ps((a), (b))
+    #define SIMINT_FLT_MUL(a,b)        _mm_mul_ps((a), (b))
+    #define SIMINT_FLT_DIV(a,b)        _mm_div_ps((a), (b))
+    #define SIMINT_FLT_SQRT(a)         _mm_sqrt_ps((a))
+    #define SIMINT_FLT_MAX(a,b)        _mm_max_ps((a), (b))
+
+    #ifdef SIMINT_FMA
+      #define SIMINT_FLT_FMADD(a,b,c)  _mm_fmadd_ps((a), (b), (c))
+      #define SIMINT_FLT_FMSUB(a,b,c)  _mm_fmsub_ps((a), (b), (c))
+    #else
+      #define SIMINT_FLT_FMADD(a,b,c)  SIMINT_FLT_ADD(SIMINT_FLT_MUL((a),(b)),(c))
+      #define SIMINT_FLT_FMSUB(a,b,c)  SIMINT_FLT_SUB(SIMINT_FLT_MUL((a),(b)),(c))
+    #endif
+
+    #define SIMINT_FLT_EXP(a)          simint_expf_vec4((a))
+    #define SIMINT_FLT_POW(a,p)        simint_powf_vec4((a), (p))
+
+
 
     ////////////////////////////////////////
     // Special functions
@@ -160,6 +218,60 @@ static inline __m128d simint_pow_vec2(__m128d a, __m128d p)
         return u.v;
     }
 
+
+    // 1.0 where a >= b, 0.0 elsewhere
+    static inline
+    __m128d vector_ge(__m128d a, __m128d b)
+    {
+        return _mm_and_pd(_mm_cmpge_pd(a, b), _mm_set1_pd(1.0));
+    }
+
+    // (_mm_floor_pd needs SSE4.1)
+    static inline
+    __m128d vector_floor(__m128d a)
+    {
+        union simint_double2 u = { a };
+        return _mm_set_pd(floor(u.d[1]), floor(u.d[0]));
+    }
+
+    // Elements of base at the given indices (whole numbers, stored as doubles)
+    static inline
+    __m128d vector_gather(double const * base, __m128d idx)
+    {
+        union simint_double2 u = { idx };
+        return _mm_set_pd(base[(int)u.d[1]], base[(int)u.d[0]]);
+    }
+
+    // Single precision versions of the above
+    static inline
+    __m128 vector_ge_f32(__m128 a, __m128 b)
+    {
+        return _mm_and_ps(_mm_cmpge_ps(a, b), _mm_set1_ps(1.0f));
+    }
+
+    static inline
+    __m128 vector_floor_f32(__m128 a)
+    {
+        union simint_float4 u = { a };
+        return _mm_set_ps(floorf(u.f[3]), floorf(u.f[2]), floorf(u.f[1]), floorf(u.f[0]));
+    }
+
+    static inline
+    __m128 vector_gather_f32(float const * base, __m128 idx)
+    {
+        union simint_float4 u = { idx };
+        return _mm_set_ps(base[(int)u.f[3]], base[(int)u.f[2]], base[(int)u.f[1]], base[(int)u.f[0]]);
+    }
+
+
+    // Number of elements that are at least screen_tol
+    static inline
+    int count_prim_screen_survival(__m128d screen_val, const double screen_tol)
+    {
+        const __m128d keep = _mm_cmpge_pd(screen_val, _mm_set1_pd(screen_tol));
+        return __builtin_popcount(_mm_movemask_pd(keep));
+    }
+
 #endif // defined SIMINT_SSE
 
 #ifdef __cplusplus
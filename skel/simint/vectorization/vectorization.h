@@ -5,6 +5,15 @@
 // Defines SIMINT_AVX, etc
 #include "simint/vectorization/vector_config.h"
 
+// In a library containing kernels for several instruction sets
+// (SIMINT_MULTI_ISA), each kernel is compiled with its own SIMINT_AVX, etc.
+// Everything else (including code using the library) is scalar.
+#if defined SIMINT_MULTI_ISA && !( defined SIMINT_SCALAR || defined SIMINT_SSE || \
+                                   defined SIMINT_AVX || defined SIMINT_AVX2 || \
+                                   defined SIMINT_AVX512 || defined SIMINT_MICAVX512 )
+  #define SIMINT_SCALAR
+#endif
+
 #if defined SIMINT_AVX512 || defined SIMINT_MICAVX512
   #include "simint/vectorization/intrinsics_avx512.h"
 #elif defined SIMINT_AVX || defined SIMINT_AVX2
@@ -17,8 +26,15 @@
   #error Vector type is not set
 #endif
 
-#define SIMINT_SIMD_ALIGN_DBL (SIMINT_SIMD_LEN*8)
-#define SIMINT_SIMD_ALIGN_INT (SIMINT_SIMD_LEN*sizeof(int))
+// Shell pairs are laid out (padded and batched) for vectors of this
+// length. For a library with several instruction sets, this is the
+// longest of them, so that the same shell pairs work with all kernels
+#ifndef SIMINT_LAYOUT_LEN
+  #define SIMINT_LAYOUT_LEN SIMINT_SIMD_LEN
+#endif
+
+#define SIMINT_SIMD_ALIGN_DBL (SIMINT_LAYOUT_LEN*8)
+#define SIMINT_SIMD_ALIGN_INT (SIMINT_LAYOUT_LEN*sizeof(int))
 
 // "Max" alignment. Can be used to allocate memory of mixed types
 // (ie ints and doubles can be allocated this way)
@@ -44,17 +60,18 @@
 
 
 // Aligned memory allocation
-#ifdef SIMINT_SCALAR
+#if defined SIMINT_SCALAR && !defined SIMINT_MULTI_ISA
   #define SIMINT_ALLOC(x) malloc((x))
   #define SIMINT_FREE(x) free((x))
 #else
+  #include <mm_malloc.h>
   #define SIMINT_ALLOC(x) _mm_malloc((x), SIMINT_SIMD_ALIGN)
   #define SIMINT_FREE(x) _mm_free((x))
 #endif
 
 
 // round up the number of elements to the nearest boundary
-#define SIMINT_SIMD_ROUND(x) ((x + ((SIMINT_SIMD_LEN-1))) & (~(SIMINT_SIMD_LEN-1)))
+#define SIMINT_SIMD_ROUND(x) ((x + ((SIMINT_LAYOUT_LEN-1))) & (~(SIMINT_LAYOUT_LEN-1)))
 
 
 // align an array
@@ -64,5 +81,5 @@
 
 
 // Number of shells to use in a batch
-#define SIMINT_NSHELL_SIMD (2*SIMINT_SIMD_LEN)
+#define SIMINT_NSHELL_SIMD (2*SIMINT_LAYOUT_LEN)
 
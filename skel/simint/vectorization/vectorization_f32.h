@@ -0,0 +1,74 @@
+#pragma once
+
+#include "simint/vectorization/vectorization.h"
+
+#ifdef __cplusplus
+#include "simint/cpp_restrict.hpp"
+extern "C" {
+#endif
+
+// The single precision vector type has SIMINT_FLT_LEN lanes, twice as
+// many as the double precision type (except for scalar). The single
+// precision kernels gather the ket primitives into these lanes, so
+// that they don't depend on the padding of the shell pairs.
+
+
+////////////////////////////////////////
+// Special functions
+////////////////////////////////////////
+
+// Accumulation is always done in double precision. The offsets never
+// decrease, so the lanes of each shell are summed before adding them
+// to dest
+static inline
+void contract_f32(int ncart,
+                  int const * restrict offsets,
+                  SIMINT_FLTTYPE const * restrict src,
+                  double * restrict dest)
+{
+    for(int np = 0; np < ncart; ++np)
+    {
+        float const * restrict src_tmp = (float const *)(src + np);
+
+        int offset = offsets[0];
+        double sum = src_tmp[0];
+
+        for(int n = 1; n < SIMINT_FLT_LEN; ++n)
+        {
+            if(offsets[n] != offset)
+            {
+                dest[offset*ncart+np] += sum;
+                offset = offsets[n];
+                sum = 0.0;
+            }
+            sum += src_tmp[n];
+        }
+
+        dest[offset*ncart+np] += sum;
+    }
+}
+
+
+static inline
+void contract_all_f32(int ncart,
+                      SIMINT_FLTTYPE const * restrict src,
+                      double * restrict dest)
+{
+    for(int np = 0; np < ncart; ++np)
+    {
+        float const * restrict src_tmp = (float const *)(src + np);
+
+        double sum = 0.0;
+        #pragma omp simd reduction(+:sum)
+        for(int n = 0; n < SIMINT_FLT_LEN; ++n)
+            sum += src_tmp[n];
+
+        dest[np] += sum;
+    }
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -2,13 +2,16 @@
 #include <cstdlib>
 #include <stdexcept>
 #include <fstream>
+#include <cstdio>
 #include <cmath>
 #include <array>
+#include <algorithm>
 
 #ifdef _OPENMP
 #include <omp.h>
 #endif
 
+#include "simint/simint.h"
 #include "test/Common.hpp"
 
 bool ValidGaussian(const std::array<int, 3> & g)
@@ -274,4 +277,119 @@ bool UniqueQuartet(int i, int j, int k, int l)
 }
 
 
+int CompareScreenedERI(ShellMap & shellmap, int screen_method, bool ket_per_shell,
+                       const ScreenedERIFunc & compute, const ScreenTolFunc & tol)
+{
+    std::pair<int, int> maxparams = FindMaxParams(shellmap);
+    const int maxam = (maxparams.first > SIMINT_OSTEI_MAXAM ? SIMINT_OSTEI_MAXAM : maxparams.first);
+    const int max_ncart = ( (maxam+1)*(maxam+2) )/2;
+    const int maxsize = maxparams.second * maxparams.second * max_ncart * max_ncart;
+
+    double * work = (double *)SIMINT_ALLOC(simint_ostei_workmem(0, maxam));
+    double * res_screen = (double *)SIMINT_ALLOC(maxsize * sizeof(double));
+    double * res_full = (double *)SIMINT_ALLOC(maxsize * sizeof(double));
+
+    // largest change in an integral, compared to what is allowed for
+    // that quartet, and how many shell quartets were dropped entirely
+    double maxratio = 0.0;
+    long ndropped = 0, nquartet = 0, nwrong = 0;
+    TimerType time_screen = 0, time_full = 0;
+
+    printf("%17s   %12s   %12s\n", "Quartet", "MaxRatio", "Dropped");
+
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    for(int k = 0; k <= maxam; k++)
+    for(int l = 0; l <= maxam; l++)
+    {
+        if(!UniqueQuartet(i, j, k, l))
+            continue;
+
+        const int nshell3 = shellmap[k].size();
+        const int nshell4 = shellmap[l].size();
+        const int ncart1234 = NCART(i) * NCART(j) * NCART(k) * NCART(l);
+
+        // | k l ) at once, or one shell of k at a time
+        const int nket = ket_per_shell ? nshell3 : 1;
+        const int nket3 = ket_per_shell ? 1 : nshell3;
+
+        double amratio = 0.0;
+        long amdropped = 0;
+
+        for(int c = 0; c < nket; c++)
+        {
+            struct simint_multi_shellpair Q;
+            simint_initialize_multi_shellpair(&Q);
+            simint_create_multi_shellpair(nket3, shellmap[k].data() + c, nshell4, shellmap[l].data(), &Q,
+                                          screen_method);
+
+            for(size_t a = 0; a < shellmap[i].size(); a++)
+            for(size_t b = 0; b < shellmap[j].size(); b++)
+            {
+                struct simint_multi_shellpair P;
+                simint_initialize_multi_shellpair(&P);
+                simint_create_multi_shellpair(1, &shellmap[i][a], 1, &shellmap[j][b], &P,
+                                              screen_method);
+
+                const int nint = P.nshell12 * Q.nshell12 * ncart1234;
+
+                TimerType ticks0, ticks1, time0, time1;
+
+                CLOCK(ticks0, time0);
+                if(compute(&P, &Q, work, res_screen) < 0)
+                    std::fill(res_screen, res_screen + nint, 0.0);
+                CLOCK(ticks1, time1);
+                time_screen += time1 - time0;
+
+                CLOCK(ticks0, time0);
+                simint_compute_eri(&P, &Q, 0.0, work, res_full);
+                CLOCK(ticks1, time1);
+                time_full += time1 - time0;
+                (void)ticks0; (void)ticks1;
 
+                // each ket shell pair has its own number of primitive quartets
+                for(int cd = 0; cd < Q.nshell12; cd++)
+                {
+                    const double allowed = tol(P, Q, cd) * P.nprim12[0] * Q.nprim12[cd];
+
+                    double refmax = 0.0;
+                    int dropped = 1;
+
+                    for(int m = cd*ncart1234; m < (cd+1)*ncart1234; m++)
+                    {
+                        const double diff = fabs(res_screen[m] - res_full[m]);
+                        amratio = std::max(amratio, diff / allowed);
+                        refmax = std::max(refmax, fabs(res_full[m]));
+                        dropped = dropped && (res_screen[m] == 0.0);
+                    }
+
+                    if(dropped && refmax > 0.0)
+                    {
+                        amdropped++;
+                        if(refmax > allowed)
+                            nwrong++;
+                    }
+                }
+
+                nquartet += Q.nshell12;
+                simint_free_multi_shellpair(&P);
+            }
+
+            simint_free_multi_shellpair(&Q);
+        }
+
+        maxratio = std::max(maxratio, amratio);
+        ndropped += amdropped;
+        printf("( %2d %2d | %2d %2d )   %12.4e   %12ld\n", i, j, k, l, amratio, amdropped);
+    }
+
+    printf("\nDropped %ld of %ld shell quartets (%ld larger than allowed)\n", ndropped, nquartet, nwrong);
+    printf("Largest fraction of the allowed difference: %.4e\n", maxratio);
+    printf("Time with screening: %.3f ms, without: %.3f ms\n", time_screen * 1.0e-6, time_full * 1.0e-6);
+
+    SIMINT_FREE(res_full);
+    SIMINT_FREE(res_screen);
+    SIMINT_FREE(work);
+
+    return (maxratio > 1.0 || nwrong > 0) ? 1 : 0;
+}
@@ -7,6 +7,7 @@
 #include <fstream>
 #include <atomic>
 #include <utility>
+#include <functional>
 
 #include "test/Timer.h" 
 #include "simint/shell/shell.h"
@@ -164,3 +165,38 @@ void PrintTimingHeader(void);
 /*! \brief Print a line with the timings for a particular AM quartet */
 void PrintAMTimingInfo(int i, int j, int k, int l, size_t nshell1234, size_t nprim1234, const TimeContrib & info);
 
+
+
+//! Computes the screened integrals of a bra and ket shell pair into the
+//! last argument (with the given workspace). Returns what
+//! simint_compute_eri would
+typedef std::function<int(struct simint_multi_shellpair const *,
+                          struct simint_multi_shellpair const *,
+                          double *, double *)> ScreenedERIFunc;
+
+//! Tolerance for each primitive quartet of the bra and the given ket shell pair
+typedef std::function<double(struct simint_multi_shellpair const &,
+                             struct simint_multi_shellpair const &,
+                             int)> ScreenTolFunc;
+
+/*! \brief Compares integrals computed with screening to those computed without
+ *
+ * For each unique AM quartet, the bra holds one shell pair at a time.
+ * The ket holds all the shell pairs of the quartet, or (if \p ket_per_shell)
+ * those of one shell of the third center, so that whole calls can be
+ * screened out. Each primitive quartet of the bra and ket shell pair cd
+ * may change an integral by at most \p tol(P, Q, cd).
+ *
+ * Prints the largest fraction of the allowed difference and the number of
+ * shell quartets that were dropped entirely for each AM quartet, and
+ * the totals.
+ *
+ * \param [in] shellmap Normalized shells of the basis
+ * \param [in] screen_method How the shell pairs are created (SIMINT_SCREEN_*)
+ * \param [in] ket_per_shell Whether the ket holds one shell of the third center at a time
+ * \param [in] compute Computes the screened integrals (all are zero if it returns < 0)
+ * \param [in] tol Tolerance for each primitive quartet
+ * \return 0 if all integrals are within what is allowed, 1 otherwise
+ */
+int CompareScreenedERI(ShellMap & shellmap, int screen_method, bool ket_per_shell,
+                       const ScreenedERIFunc & compute, const ScreenTolFunc & tol);
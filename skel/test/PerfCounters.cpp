@@ -0,0 +1,234 @@
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include "test/PerfCounters.hpp"
+
+#ifdef __linux__
+  #include <unistd.h>
+  #include <sys/ioctl.h>
+  #include <sys/syscall.h>
+  #include <linux/perf_event.h>
+#endif
+
+
+const char * const PerfEventNames[PERF_NEVENT] = {
+    "cycles",
+    "instructions",
+    "l1d_misses",
+    "l2_misses",
+    "llc_misses",
+    "fp_vector_ops"
+};
+
+
+namespace {
+
+// Whether the counters are used at all, and which events
+bool enabled_ = false;
+bool available_[PERF_NEVENT];
+
+// Incremented by PerfCounters_Finalize, so that threads
+// know that their counters were closed
+std::atomic<int> generation_(0);
+
+// Counters of each thread. The events are opened as one group (so they are
+// always counted together), and group_event maps the position in the group
+// to the event
+struct ThreadCounters
+{
+    bool opened = false;
+    int generation = -1;
+    int leader = -1;
+    int nopen = 0;
+    int group_event[PERF_NEVENT];
+};
+
+thread_local ThreadCounters counters_;
+
+// All file descriptors (of all threads), so they can be closed
+std::mutex fd_mutex_;
+std::vector<int> all_fds_;
+
+
+#ifdef __linux__
+
+// Raw event code from an environment variable (hex, optionally starting with r or 0x)
+bool RawEvent(const char * var, unsigned long long & config)
+{
+    const char * s = getenv(var);
+    if(s == NULL || *s == '\0')
+        return false;
+    if(*s == 'r' || *s == 'R')
+        s++;
+    config = strtoull(s, NULL, 16);
+    return config != 0;
+}
+
+
+bool EventAttr(int event, struct perf_event_attr & attr)
+{
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    const unsigned long long read_miss = PERF_COUNT_HW_CACHE_OP_READ << 8 |
+                                         PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+
+    switch(event)
+    {
+        case PERF_CYCLES:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            return true;
+        case PERF_INSTRUCTIONS:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            return true;
+        case PERF_L1D_MISSES:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_L1D | read_miss;
+            return true;
+        case PERF_LLC_MISSES:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_LL | read_miss;
+            return true;
+        case PERF_L2_MISSES:
+            attr.type = PERF_TYPE_RAW;
+            return RawEvent("SIMINT_PERF_L2_MISSES", attr.config);
+        case PERF_FP_VECTOR_OPS:
+            attr.type = PERF_TYPE_RAW;
+            return RawEvent("SIMINT_PERF_FP_VECTOR_OPS", attr.config);
+        default:
+            return false;
+    }
+}
+
+
+int OpenEvent(struct perf_event_attr & attr, int group_fd)
+{
+    // the leader starts disabled, and the whole group is enabled at once
+    attr.disabled = (group_fd == -1);
+    attr.read_format = PERF_FORMAT_GROUP;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+
+// Open the counters of the calling thread (only the events in \p use)
+void OpenThreadCounters(const bool * use)
+{
+    ThreadCounters & tc = counters_;
+    tc = ThreadCounters();
+    tc.opened = true;
+    tc.generation = generation_;
+
+    for(int i = 0; i < PERF_NEVENT; i++)
+    {
+        struct perf_event_attr attr;
+        if(!use[i] || !EventAttr(i, attr))
+            continue;
+
+        const int fd = OpenEvent(attr, tc.leader);
+        if(fd < 0)
+            continue;
+
+        if(tc.leader == -1)
+            tc.leader = fd;
+
+        tc.group_event[tc.nopen++] = i;
+
+        std::lock_guard<std::mutex> l(fd_mutex_);
+        all_fds_.push_back(fd);
+    }
+
+    if(tc.leader != -1)
+    {
+        ioctl(tc.leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(tc.leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+}
+
+#endif
+
+} // close anonymous namespace
+
+
+bool PerfCounters_Init(void)
+{
+    enabled_ = false;
+    for(int i = 0; i < PERF_NEVENT; i++)
+        available_[i] = false;
+
+    #ifdef __linux__
+    // the counters of this thread tell which events work
+    bool all[PERF_NEVENT];
+    for(int i = 0; i < PERF_NEVENT; i++)
+        all[i] = true;
+
+    if(!counters_.opened || counters_.generation != generation_)
+        OpenThreadCounters(all);
+
+    for(int i = 0; i < counters_.nopen; i++)
+        available_[counters_.group_event[i]] = true;
+
+    enabled_ = (counters_.nopen > 0);
+    #endif
+
+    return enabled_;
+}
+
+
+void PerfCounters_Finalize(void)
+{
+    #ifdef __linux__
+    std::lock_guard<std::mutex> l(fd_mutex_);
+    for(const int fd : all_fds_)
+        close(fd);
+    all_fds_.clear();
+    #endif
+
+    enabled_ = false;
+    generation_++;
+}
+
+
+bool PerfCounters_Available(int event)
+{
+    return enabled_ && event >= 0 && event < PERF_NEVENT && available_[event];
+}
+
+
+void PerfCounters_Read(PerfSample & sample)
+{
+    for(int i = 0; i < PERF_NEVENT; i++)
+        sample.value[i] = 0;
+
+    if(!enabled_)
+        return;
+
+    #ifdef __linux__
+    if(!counters_.opened || counters_.generation != generation_)
+        OpenThreadCounters(available_);
+
+    if(counters_.leader == -1)
+        return;
+
+    // number of events, then their values
+    unsigned long long buf[PERF_NEVENT+1];
+    if(read(counters_.leader, buf, sizeof(buf)) < static_cast<ssize_t>(sizeof(unsigned long long)))
+        return;
+
+    const int n = static_cast<int>(buf[0]);
+    for(int i = 0; i < n && i < counters_.nopen; i++)
+        sample.value[counters_.group_event[i]] = buf[i+1];
+    #endif
+}
+
+
+void PerfCounters_Add(const PerfSample & start, const PerfSample & end, PerfContrib & contrib)
+{
+    for(int i = 0; i < PERF_NEVENT; i++)
+        contrib.count[i] += end.value[i] - start.value[i];
+}
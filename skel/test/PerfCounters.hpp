@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+
+
+/*! \brief Hardware events counted by the perf counters
+ *
+ * The L2 misses and the floating point vector operations have no generic
+ * (portable) perf event. They are only counted if their raw, CPU-specific
+ * event codes are given in the SIMINT_PERF_L2_MISSES and
+ * SIMINT_PERF_FP_VECTOR_OPS environment variables (as for "perf stat -e rXXXX",
+ * for example r10c7 for 256-bit packed double FP_ARITH_INST_RETIRED on Intel).
+ */
+enum PerfEvent
+{
+    PERF_CYCLES,
+    PERF_INSTRUCTIONS,
+    PERF_L1D_MISSES,
+    PERF_L2_MISSES,
+    PERF_LLC_MISSES,
+    PERF_FP_VECTOR_OPS,
+    PERF_NEVENT
+};
+
+
+//! Names of the events (in the order of PerfEvent)
+extern const char * const PerfEventNames[PERF_NEVENT];
+
+
+//! Contributions to the hardware event counts
+struct PerfContrib
+{
+    std::atomic<unsigned long long> count[PERF_NEVENT];
+
+    PerfContrib(const PerfContrib & rhs) noexcept
+    {
+        for(int i = 0; i < PERF_NEVENT; i++)
+            count[i] = rhs.count[i].load();
+    }
+
+    PerfContrib & operator=(const PerfContrib &) noexcept = delete;
+
+    PerfContrib(void) noexcept
+    {
+        for(int i = 0; i < PERF_NEVENT; i++)
+            count[i] = 0;
+    }
+
+    PerfContrib & operator+=(const PerfContrib & rhs) noexcept
+    {
+        for(int i = 0; i < PERF_NEVENT; i++)
+            count[i] += rhs.count[i];
+        return *this;
+    }
+};
+
+
+/*! \brief Values of the counters of the calling thread at some point */
+struct PerfSample
+{
+    unsigned long long value[PERF_NEVENT];
+};
+
+
+/*! \brief Set up the hardware performance counters (perf_event_open)
+ *
+ * Checks which events can be counted. If none can (not on Linux, no
+ * permission, or no PMU, as in many virtual machines), the counters
+ * are disabled and everything else does nothing.
+ *
+ * \return True if at least one event can be counted
+ */
+bool PerfCounters_Init(void);
+
+
+/*! \brief Close the counters of all threads */
+void PerfCounters_Finalize(void);
+
+
+/*! \brief Whether an event is counted */
+bool PerfCounters_Available(int event);
+
+
+/*! \brief Read the counters of the calling thread
+ *
+ * The counters of a thread are opened the first time it calls this. They
+ * only count that thread (in user mode).
+ */
+void PerfCounters_Read(PerfSample & sample);
+
+
+/*! \brief Add the counts between two samples (of the same thread) to \p contrib */
+void PerfCounters_Add(const PerfSample & start, const PerfSample & end, PerfContrib & contrib);
+
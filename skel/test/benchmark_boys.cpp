@@ -0,0 +1,331 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <vector>
+
+#include "simint/simint.h"
+#include "simint/boys/boys.h"
+#include "test/Timer.h"
+#include "test/PerfCounters.hpp"
+
+
+// Values of x (one vector after the other) for each kind of vector
+enum XKind
+{
+    X_SHORT,   // all lanes below BOYS_SHORTGRID_MAXX
+    X_LONG,    // all lanes above
+    X_MIXED,   // every vector has lanes in both regimes
+    X_RANDOM,  // uniform on [0, 2*BOYS_SHORTGRID_MAXX)
+    X_NKIND
+};
+
+static const char * const XKindNames[X_NKIND] = { "short", "long", "mixed", "random" };
+
+
+static std::vector<double> MakeX(XKind kind, int nvec, std::mt19937 & gen)
+{
+    std::uniform_real_distribution<double> sdist(0.0, BOYS_SHORTGRID_MAXX);
+    std::uniform_real_distribution<double> ldist(BOYS_SHORTGRID_MAXX, 2*BOYS_SHORTGRID_MAXX);
+
+    std::vector<double> x(nvec * SIMINT_SIMD_LEN);
+    for(size_t i = 0; i < x.size(); i++)
+    {
+        if(kind == X_SHORT)
+            x[i] = sdist(gen);
+        else if(kind == X_LONG)
+            x[i] = ldist(gen);
+        else if(kind == X_MIXED)
+            x[i] = (i % 2) ? ldist(gen) : sdist(gen);
+        else
+            x[i] = (gen() % 2) ? ldist(gen) : sdist(gen);
+    }
+
+    // a vector of only one lane can't be mixed
+    if(kind == X_MIXED && SIMINT_SIMD_LEN == 1)
+        fprintf(stderr, "Warning - no mixed vectors with a vector length of one\n");
+
+    return x;
+}
+
+
+// Time one way of computing F[0..n] for all the vectors. Returns the
+// fastest of the repetitions (in nanoseconds), and the values in F.
+// The hardware events of all the repetitions are added to perf (if given)
+template<typename Func>
+static TimerType TimeBoys(Func f, std::vector<double> const & x, int n, int nrep,
+                          std::vector<double> & F, PerfContrib * perf = nullptr)
+{
+    const int nvec = static_cast<int>(x.size()) / SIMINT_SIMD_LEN;
+    SIMINT_DBLTYPE * Fv = (SIMINT_DBLTYPE *)SIMINT_ALLOC((n+1) * sizeof(SIMINT_DBLTYPE));
+
+    // (aligned, for SIMINT_DBLLOAD)
+    double * xa = (double *)SIMINT_ALLOC(x.size() * sizeof(double));
+    std::copy(x.begin(), x.end(), xa);
+
+    F.assign(x.size() * (n+1), 0.0);
+
+    TimerType best = 0;
+
+    for(int r = 0; r < nrep; r++)
+    {
+        TimerType ticks0, ticks1, time0, time1;
+        PerfSample perf0, perf1;
+        PerfCounters_Read(perf0);
+        CLOCK(ticks0, time0);
+
+        for(int v = 0; v < nvec; v++)
+        {
+            f(Fv, SIMINT_DBLLOAD(xa, v*SIMINT_SIMD_LEN), n);
+
+            // keep the values (this also makes sure they are computed)
+            double const * Fd = (double const *)Fv;
+            std::copy(Fd, Fd + (n+1)*SIMINT_SIMD_LEN, F.data() + v*(n+1)*SIMINT_SIMD_LEN);
+        }
+
+        CLOCK(ticks1, time1);
+        PerfCounters_Read(perf1);
+        (void)ticks0; (void)ticks1;
+
+        if(perf != nullptr)
+            PerfCounters_Add(perf0, perf1, *perf);
+
+        if(r == 0 || (time1 - time0) < best)
+            best = time1 - time0;
+    }
+
+    SIMINT_FREE(xa);
+    SIMINT_FREE(Fv);
+    return best;
+}
+
+
+#ifdef SIMINT_BOYS_BLOCKED
+// Events per value of x, or "n/a" if the event is not counted
+static void PrintPerEvent(PerfContrib const & perf, int event, double nx)
+{
+    if(PerfCounters_Available(event))
+        printf(" %10.3f", static_cast<double>(perf.count[event].load()) / nx);
+    else
+        printf(" %10s", "n/a");
+}
+#endif
+
+
+// Compares the vectorized Boys function with evaluating one lane at a time,
+// for vectors whose lanes are all in the same regime or in both. Then
+// compares the two ways of evaluating it for small x, and the two layouts
+// of the grid of Taylor series
+int main(int argc, char ** argv)
+{
+    if(argc > 3)
+    {
+        printf("Usage: benchmark_boys [number of vectors] [repetitions]\n");
+        return 1;
+    }
+
+    const int nvec = (argc > 1) ? atoi(argv[1]) : 1024;
+    const int nrep = (argc > 2) ? atoi(argv[2]) : 100;
+
+    simint_init();
+
+    if(!PerfCounters_Init())
+        fprintf(stderr, "Hardware performance counters are not available\n");
+
+    // small n is evaluated directly, large n only for F[n]
+    // (then recurred down, as in boys_F_split_large_n)
+    auto recur = [](SIMINT_DBLTYPE * F, SIMINT_DBLTYPE x, int n)
+    {
+        const SIMINT_DBLTYPE x2 = SIMINT_MUL(SIMINT_DBLSET1(2.0), x);
+        const SIMINT_DBLTYPE ex = SIMINT_EXP(SIMINT_NEG(x));
+        for(int n2 = n-1; n2 >= 0; n2--)
+            F[n2] = SIMINT_MUL(SIMINT_DBLSET1(1.0 / (2.0 * n2 + 1)), SIMINT_FMADD(x2, F[n2+1], ex));
+    };
+
+    auto lanes = [&](SIMINT_DBLTYPE * F, SIMINT_DBLTYPE x, int n)
+    {
+        if(n < 4)
+            boys_F_lanes(F, x, n);
+        else
+        {
+            F[n] = boys_F_lanes_single(x, n);
+            recur(F, x, n);
+        }
+    };
+
+    auto blend = [&](SIMINT_DBLTYPE * F, SIMINT_DBLTYPE x, int n)
+    {
+        if(n < 4)
+            boys_F_blend_vec(F, x, n);
+        else
+        {
+            F[n] = boys_F_blend_single_vec(x, n);
+            recur(F, x, n);
+        }
+    };
+
+    auto split = [](SIMINT_DBLTYPE * F, SIMINT_DBLTYPE x, int n) { boys_F_split(F, x, n); };
+
+    std::mt19937 gen(5678);
+
+    printf("%d vectors of %d, best of %d repetitions\n", nvec, SIMINT_SIMD_LEN, nrep);
+    printf("Millions of values of x per second, evaluating the lanes one at a time,\n");
+    printf("with both regimes blended, and with boys_F_split (what the kernels use)\n\n");
+    printf("%8s %4s   %10s %10s %10s   %12s\n", "x", "n", "lanes", "blend", "split", "max rel diff");
+
+    double maxdiff = 0.0;
+
+    for(int kind = 0; kind < X_NKIND; kind++)
+    {
+        const std::vector<double> x = MakeX(static_cast<XKind>(kind), nvec, gen);
+        const double nx = static_cast<double>(x.size());
+
+        for(int n : { 0, 1, 2, 4, 8, 16 })
+        {
+            std::vector<double> F_lanes, F_blend, F_split;
+            const TimerType t_lanes = TimeBoys(lanes, x, n, nrep, F_lanes);
+            const TimerType t_blend = TimeBoys(blend, x, n, nrep, F_blend);
+            const TimerType t_split = TimeBoys(split, x, n, nrep, F_split);
+
+            double diff = 0.0;
+            for(size_t i = 0; i < F_lanes.size(); i++)
+            {
+                diff = std::max(diff, fabs(F_blend[i] - F_lanes[i]) / fabs(F_lanes[i]));
+                diff = std::max(diff, fabs(F_split[i] - F_lanes[i]) / fabs(F_lanes[i]));
+            }
+            maxdiff = std::max(maxdiff, diff);
+
+            printf("%8s %4d   %10.2f %10.2f %10.2f   %12.4e\n", XKindNames[kind], n,
+                   nx / (t_lanes * 1.0e-3), nx / (t_blend * 1.0e-3), nx / (t_split * 1.0e-3), diff);
+        }
+    }
+
+
+    // Short range only, for the comparisons below
+    const std::vector<double> xs = MakeX(X_SHORT, nvec, gen);
+    const double nxs = static_cast<double>(xs.size());
+
+
+    // The grid of Taylor series vs. the Chebyshev fits,
+    // for all F[0..n] and only F[n] (as in boys_F_split_small_n and _large_n).
+    // The fits are only built with SIMINT_BOYS=chebyshev
+    #ifdef SIMINT_BOYS_CHEBY
+    auto taylor = [](SIMINT_DBLTYPE * F, SIMINT_DBLTYPE x, int n) { boys_F_taylor_vec(F, x, n); };
+    auto cheby = [](SIMINT_DBLTYPE * F, SIMINT_DBLTYPE x, int n) { boys_F_cheby_vec(F, x, n); };
+    auto taylor_single = [](SIMINT_DBLTYPE * F, SIMINT_DBLTYPE x, int n) { F[n] = boys_F_taylor_single_vec(x, n); };
+    auto cheby_single = [](SIMINT_DBLTYPE * F, SIMINT_DBLTYPE x, int n) { F[n] = boys_F_cheby_single_vec(x, n); };
+
+    printf("\nTaylor series (%d KB, %d per point) vs. Chebyshev fits (%d KB, order %d)\n",
+           (int)(sizeof(boys_shortgrid) / 1024), BOYS_SHORTGRID_MAXN+1,
+           (int)(sizeof(boys_cheby) / 1024), BOYS_CHEBY_ORDER);
+    printf("Millions of values of x per second, for all F[0..n] and only F[n]\n\n");
+    printf("%8s %4s   %10s %10s   %10s %10s   %12s\n", "x", "n", "taylor", "cheby",
+           "taylor F[n]", "cheby F[n]", "max rel diff");
+
+    for(int n : { 0, 1, 2, 4, 8, 16, 24 })
+    {
+        std::vector<double> F_taylor, F_cheby, F_taylor1, F_cheby1;
+        const TimerType t_taylor = TimeBoys(taylor, xs, n, nrep, F_taylor);
+        const TimerType t_cheby = TimeBoys(cheby, xs, n, nrep, F_cheby);
+        const TimerType t_taylor1 = TimeBoys(taylor_single, xs, n, nrep, F_taylor1);
+        const TimerType t_cheby1 = TimeBoys(cheby_single, xs, n, nrep, F_cheby1);
+
+        double diff = 0.0;
+        for(size_t i = 0; i < F_taylor.size(); i++)
+            diff = std::max(diff, fabs(F_cheby[i] - F_taylor[i]) / fabs(F_taylor[i]));
+        maxdiff = std::max(maxdiff, diff);
+
+        printf("%8s %4d   %10.2f %10.2f   %10.2f %10.2f   %12.4e\n", XKindNames[X_SHORT], n,
+               nxs / (t_taylor * 1.0e-3), nxs / (t_cheby * 1.0e-3),
+               nxs / (t_taylor1 * 1.0e-3), nxs / (t_cheby1 * 1.0e-3), diff);
+    }
+    #endif
+
+
+    // Layouts of the Taylor series grid, for only the highest F[n]
+    // and recurring down (as in boys_F_split_large_n).
+    // The blocked table is only built with SIMINT_BOYS=blocked
+    #ifdef SIMINT_BOYS_BLOCKED
+    auto row_all = [](SIMINT_DBLTYPE * F, SIMINT_DBLTYPE x, int n) { boys_F_taylor_vec(F, x, n); };
+    auto row_top = [&](SIMINT_DBLTYPE * F, SIMINT_DBLTYPE x, int n)
+    {
+        F[n] = boys_F_taylor_single_vec(x, n);
+        recur(F, x, n);
+    };
+    auto blocked_top = [&](SIMINT_DBLTYPE * F, SIMINT_DBLTYPE x, int n)
+    {
+        const int m = BOYS_BLOCKED_ORDER(n);
+        SIMINT_DBLTYPE Fm[BOYS_BLOCKED_MAXN+1];
+        Fm[m] = boys_F_taylor_blocked_single_vec(x, m);
+        recur(Fm, x, m);
+        std::copy(Fm, Fm + n + 1, F);
+    };
+
+    printf("\nTaylor series grid by point (%d KB) vs. blocked by n (%d KB, every %d-th n)\n",
+           (int)(sizeof(boys_shortgrid) / 1024), (int)(sizeof(boys_shortgrid_blocked) / 1024),
+           BOYS_BLOCKED_K);
+    printf("Millions of values of x per second and L1d misses per value of x, for all\n");
+    printf("F[0..n] from the grid, and F[n] from the grid or the blocked table (then recurring)\n\n");
+    printf("%8s %4s   %10s %10s %10s   %10s %10s %10s   %12s\n", "x", "n",
+           "all", "top", "blocked", "all L1d", "top L1d", "block L1d", "max rel diff");
+
+    for(int n = 4; n <= BOYS_BLOCKED_MAXN; n += 4)
+    {
+        std::vector<double> F_all, F_top, F_blocked;
+        PerfContrib p_all, p_top, p_blocked;
+        const TimerType t_all = TimeBoys(row_all, xs, n, nrep, F_all, &p_all);
+        const TimerType t_top = TimeBoys(row_top, xs, n, nrep, F_top, &p_top);
+        const TimerType t_blocked = TimeBoys(blocked_top, xs, n, nrep, F_blocked, &p_blocked);
+
+        double diff = 0.0;
+        for(size_t i = 0; i < F_all.size(); i++)
+        {
+            diff = std::max(diff, fabs(F_top[i] - F_all[i]) / fabs(F_all[i]));
+            diff = std::max(diff, fabs(F_blocked[i] - F_all[i]) / fabs(F_all[i]));
+        }
+        maxdiff = std::max(maxdiff, diff);
+
+        printf("%8s %4d   %10.2f %10.2f %10.2f  ", XKindNames[X_SHORT], n,
+               nxs / (t_all * 1.0e-3), nxs / (t_top * 1.0e-3), nxs / (t_blocked * 1.0e-3));
+        PrintPerEvent(p_all, PERF_L1D_MISSES, nxs * nrep);
+        PrintPerEvent(p_top, PERF_L1D_MISSES, nxs * nrep);
+        PrintPerEvent(p_blocked, PERF_L1D_MISSES, nxs * nrep);
+        printf("   %12.4e\n", diff);
+    }
+    #endif
+
+
+    // Fewer terms of the Taylor series (kernels from create.py -rb, for
+    // integrals too small for the error to matter)
+    auto reduced = [](SIMINT_DBLTYPE * F, SIMINT_DBLTYPE x, int n) { boys_F_split_reduced(F, x, n); };
+
+    printf("\nboys_F_split vs. boys_F_split_reduced (relative error up to %.2e)\n", BOYS_REDUCED_RELERR);
+    printf("Millions of values of x per second\n\n");
+    printf("%8s %4s   %10s %10s   %12s\n", "x", "n", "split", "reduced", "max rel diff");
+
+    double maxdiff_reduced = 0.0;
+
+    for(int n : { 0, 1, 2, 4, 8, 16 })
+    {
+        std::vector<double> F_split, F_reduced;
+        const TimerType t_split = TimeBoys(split, xs, n, nrep, F_split);
+        const TimerType t_reduced = TimeBoys(reduced, xs, n, nrep, F_reduced);
+
+        double diff = 0.0;
+        for(size_t i = 0; i < F_split.size(); i++)
+            diff = std::max(diff, fabs(F_reduced[i] - F_split[i]) / fabs(F_split[i]));
+        maxdiff_reduced = std::max(maxdiff_reduced, diff);
+
+        printf("%8s %4d   %10.2f %10.2f   %12.4e\n", XKindNames[X_SHORT], n,
+               nxs / (t_split * 1.0e-3), nxs / (t_reduced * 1.0e-3), diff);
+    }
+
+    printf("\nMaximum relative difference: %.4e\n", maxdiff);
+    printf("Maximum relative difference (reduced): %.4e\n", maxdiff_reduced);
+
+    PerfCounters_Finalize();
+    simint_finalize();
+
+    return (maxdiff > 1.0e-12 || maxdiff_reduced > BOYS_REDUCED_RELERR) ? 1 : 0;
+}
@@ -1,8 +1,12 @@
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
 
 #include "simint/simint.h"
 #include "test/Common.hpp"
 #include "test/Timer.h"
+#include "test/PerfCounters.hpp"
 
 #ifdef _OPENMP
   #include <omp.h>
@@ -15,246 +19,531 @@
 using namespace std::chrono;
 
 
-#define SIMINT_SCREEN 0
-#define SIMINT_SCREEN_TOL 0.0
+// Results for one AM class of one basis with a given number of threads
+struct AMResult
+{
+    int am[4];
+    size_t nshell1234;    // shell quartets
+    size_t nprim1234;     // primitive quartets
+    size_t ncont1234;     // contracted integrals
+    size_t nskipped;      // shell quartets screened out by simint_compute_eri
+    double flops;         // predicted flops of the calls that were not screened out
+    TimeContrib time;
+    PerfContrib perf;     // hardware events during simint_compute_eri
+    simint_screen_stats stats;  // what the kernels computed and screened out
+    #ifdef BENCHMARK_VALIDATE
+    std::pair<double, double> err;
+    #endif
+};
 
-int main(int argc, char ** argv)
+
+static void PrintUsage(const char * prog)
 {
-    // set up the function pointers
-    simint_init();
+    fprintf(stderr, "Usage: %s [options] basis.mol [basis.mol ...]\n", prog);
+    fprintf(stderr, "\n");
+    fprintf(stderr, "  -s method   Screening: none, schwarz, fastschwarz, qqr (default none)\n");
+    fprintf(stderr, "  -t tol      Screening tolerance (default 1e-14, ignored without screening)\n");
+    fprintf(stderr, "  -n n[,n]    Numbers of threads to run with (default: OpenMP maximum)\n");
+    fprintf(stderr, "  -l am       Highest AM to benchmark (default SIMINT_OSTEI_MAXAM)\n");
+    fprintf(stderr, "  -u          Only the unique AM classes (i >= j, k >= l, ij >= kl)\n");
+    fprintf(stderr, "  -o file     Write the results to this file (default stdout)\n");
+    fprintf(stderr, "  -p          Count hardware events (cycles, cache misses, ...) with perf_event_open\n");
+    fprintf(stderr, "  -e          Order the ket primitive pairs by exponent rather than screening value\n");
+    fprintf(stderr, "\n");
+    fprintf(stderr, "For example, to benchmark all the test basis sets:\n");
+    fprintf(stderr, "  %s -s schwarz -n 1,4 test/dat/*.mol\n", prog);
+}
+
 
-    if(argc != 2)
+// Add the screening statistics between two samples (of the same thread)
+static void AddScreenStats(const simint_screen_stats & start, const simint_screen_stats & end,
+                           simint_screen_stats & sum)
+{
+    const unsigned long long d[7] = { end.shell_calc - start.shell_calc,
+                                      end.shell_skip - start.shell_skip,
+                                      end.prim_calc - start.prim_calc,
+                                      end.prim_skip - start.prim_skip,
+                                      end.vec_calc - start.vec_calc,
+                                      end.vec_skip - start.vec_skip,
+                                      end.boys_mixed - start.boys_mixed };
+    unsigned long long * const s[7] = { &sum.shell_calc, &sum.shell_skip,
+                                        &sum.prim_calc, &sum.prim_skip,
+                                        &sum.vec_calc, &sum.vec_skip,
+                                        &sum.boys_mixed };
+
+    for(int n = 0; n < 7; n++)
     {
-        printf("Give me 1 argument! I got %d\n", argc-1);
-        return 1;
+        #ifdef _OPENMP
+        #pragma omp atomic
+        #endif
+        *s[n] += d[n];
     }
+}
 
-    // files to read
-    std::string basfile(argv[1]);
 
-    // number of threads
-    #ifdef _OPENMP
-        const int nthread = omp_get_max_threads();
-    #else
-        const int nthread = 1;
+static int ParseScreenMethod(const char * s)
+{
+    if(strcmp(s, "none") == 0)
+        return SIMINT_SCREEN_NONE;
+    if(strcmp(s, "schwarz") == 0)
+        return SIMINT_SCREEN_SCHWARZ;
+    if(strcmp(s, "fastschwarz") == 0)
+        return SIMINT_SCREEN_FASTSCHWARZ;
+    if(strcmp(s, "qqr") == 0)
+        return SIMINT_SCREEN_QQR;
+    return -1;
+}
+
+
+static AMResult BenchmarkAM(int i, int j, int k, int l,
+                            ShellMap & shellmap, int screen_method, double screen_tol,
+                            int prim_order,
+                            int maxam, int maxsize,
+                            double * all_simint_work, double * all_res_ints
+                            #ifdef BENCHMARK_VALIDATE
+                            , double * all_res_ref
+                            #endif
+                            )
+{
+    AMResult res;
+    res.am[0] = i;
+    res.am[1] = j;
+    res.am[2] = k;
+    res.am[3] = l;
+    res.nskipped = 0;
+    memset(&res.stats, 0, sizeof(res.stats));
+
+    #ifdef BENCHMARK_VALIDATE
+    res.err = std::make_pair(0.0, 0.0);
     #endif
 
-    // read in the shell info
-    ShellMap shellmap = ReadBasis(basfile).first;
+    const size_t ncart1234 = NCART(i) * NCART(j) * NCART(k) * NCART(l);
 
-    // normalize
-    for(auto & it : shellmap)
-        simint_normalize_shells(it.second.size(), it.second.data());
+    const size_t nshell3 = shellmap[k].size();
+    const size_t nshell4 = shellmap[l].size();
 
+    simint_shell const * const C = &shellmap[k][0];
+    simint_shell const * const D = &shellmap[l][0];
 
-    // find the max dimensions
-    std::pair<int, int> maxparams = FindMaxParams(shellmap);
-    const int maxam = (maxparams.first > SIMINT_OSTEI_MAXAM ? SIMINT_OSTEI_MAXAM : maxparams.first);
-    const int max_ncart = ( (maxam+1)*(maxam+2) )/2;
-    const int maxsize = maxparams.second * maxparams.second * max_ncart * max_ncart;
+    // time creation of Q
+    TimerType ticks_12_0, ticks_12_1;
+    TimerType time_12_0, time_12_1;
+    CLOCK(ticks_12_0, time_12_0);
+    struct simint_multi_shellpair Q;
+    simint_initialize_multi_shellpair(&Q);
+    simint_create_multi_shellpair(nshell3, C, nshell4, D, &Q, screen_method);
+    if(prim_order != SIMINT_PRIM_ORDER_SCREEN)
+        simint_order_multi_shellpair(&Q, prim_order);
+    CLOCK(ticks_12_1, time_12_1);
+    res.time.ticks_shell_pair += ticks_12_1 - ticks_12_0;
+    res.time.time_shell_pair += time_12_1 - time_12_0;
 
-    /* Storage of integrals */
-    double * all_res_ints = (double *)SIMINT_ALLOC(nthread * maxsize * sizeof(double));
 
-    /* contracted workspace */
-    double * all_simint_work = (double *)SIMINT_ALLOC(nthread * simint_ostei_workmem(0, maxam));
+    // running totals for this am
+    std::atomic<size_t> nprim1234_am(0);
+    std::atomic<size_t> nshell1234_am(0);
+    std::atomic<size_t> ncont1234_am(0);
+    std::atomic<size_t> nskipped_am(0);
+    double flops_am = 0.0;
 
+    const auto & shellmap_i = shellmap[i];
+    const auto & shellmap_j = shellmap[j];
 
-    // initialize stuff
-    // nothing needs initializing!
+    const size_t i_size = shellmap_i.size();
+    const size_t j_size = shellmap_j.size();
+    const size_t brasize = i_size * j_size;
 
-    #ifdef BENCHMARK_VALIDATE
-    ValeevRef_Init();
-    double * all_res_ref = (double *)SIMINT_ALLOC(nthread * maxsize * sizeof(double));
+    // do one shell pair at a time on the bra side
+    TimerType fullticks_0, fullticks_1;
+    TimerType fulltime_0, fulltime_1;
+
+    CLOCK(fullticks_0, fulltime_0);
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic) reduction(+:flops_am)
     #endif
+    for(size_t ab = 0; ab < brasize; ab++)
+    {
+        TimerType ticks_0, ticks_1;
+        TimerType time_0, time_1;
 
-    PrintTimingHeader();
+        size_t a = ab / j_size;
+        size_t b = ab % j_size;
 
-    // running totals
-    size_t ncont1234_total = 0;
-    size_t nprim1234_total = 0;
-    size_t nshell1234_total = 0;
-    size_t skipped_total = 0;
-    TimeContrib time_total;
+        const size_t nshell1 = 1;
+        const size_t nshell2 = 1;
 
-    std::vector<std::array<int, 4>> qam_to_test {{0, 0, 0, 0}, {2,2,2,2}, {3, 1, 3, 0}, {2, 2, 3, 0}};
-    const size_t n_to_test = qam_to_test.size();
+        simint_shell const * const A = &shellmap_i[a];
+        simint_shell const * const B = &shellmap_j[b];
 
-    for(size_t q = 0; q < n_to_test; q++)
-    {
-        const int i = qam_to_test[q][0];
-        const int j = qam_to_test[q][1];
-        const int k = qam_to_test[q][2];
-        const int l = qam_to_test[q][3];
+        // time creation of P
+        CLOCK(ticks_0, time_0);
+        struct simint_multi_shellpair P;
+        simint_initialize_multi_shellpair(&P);
+        simint_create_multi_shellpair(nshell1, A, nshell2, B, &P, screen_method);
+        CLOCK(ticks_1, time_1);
+        res.time.ticks_shell_pair += ticks_1 - ticks_0;
+        res.time.time_shell_pair += time_1 - time_0;
 
-        #ifdef BENCHMARK_VALIDATE
-        std::pair<double, double> err(0.0, 0.0);
+        // acutal number of primitives and shells that
+        // will be calculated
+        const size_t nprim1234 = P.nprim * Q.nprim;
+        const size_t nshell1234 = P.nshell12 * Q.nshell12;
+        const size_t ncont1234 = nshell1234 * ncart1234;
+
+        #ifdef _OPENMP
+            const int ithread = omp_get_thread_num();
+        #else
+            const int ithread = 0;
         #endif
 
-        const size_t ncart1234 = NCART(i) * NCART(j) * NCART(k) * NCART(l);
+        double * res_ints = all_res_ints + ithread * maxsize;
+        double * const simint_work = all_simint_work + ithread * simint_ostei_worksize(0, maxam);
+
+        // actually calculate
+        PerfSample perf_0, perf_1;
+        simint_screen_stats stats_0, stats_1;
+        simint_stats_get(&stats_0);
+        PerfCounters_Read(perf_0);
+        CLOCK(ticks_0, time_0);
+        int simint_ret = simint_compute_eri(&P, &Q, screen_tol, simint_work, res_ints);
+        CLOCK(ticks_1, time_1);
+        PerfCounters_Read(perf_1);
+        simint_stats_get(&stats_1);
+        res.time.ticks_integrals += (ticks_1 - ticks_0);
+        res.time.time_integrals += (time_1 - time_0);
+        PerfCounters_Add(perf_0, perf_1, res.perf);
+        AddScreenStats(stats_0, stats_1, res.stats);
+
+        // if the return is < 0, it didn't calculate anything
+        // (everything was screened)
+        if(simint_ret < 0)
+        {
+            std::fill(res_ints, res_ints + ncont1234, 0.0);
+            nskipped_am += nshell1234;
+        }
+        else
+        {
+            // the primitive part is done for each primitive
+            // quartet, the HRR for each shell quartet
+            const simint_ostei_cost_info cost = simint_ostei_cost(i, j, k, l, P.nprim, Q.nprim);
+            flops_am += cost.prim_flops + nshell1234 * cost.cont_flops;
+        }
 
-        // total amount of time for this AM quartet
-        TimeContrib time_am;
 
-        const size_t nshell3 = shellmap[k].size();
-        const size_t nshell4 = shellmap[l].size();
+        #ifdef BENCHMARK_VALIDATE
+        double * res_ref = all_res_ref + ithread * maxsize;
 
-        simint_shell const * const C = &shellmap[k][0];
-        simint_shell const * const D = &shellmap[l][0];
+        ValeevRef_Integrals(A, nshell1,
+                            B, nshell2,
+                            C, nshell3,
+                            D, nshell4,
+                            res_ref, 0, false);
+        std::pair<double, double> err2 = CalcError(res_ints, res_ref, ncont1234);
 
-        // time creation of Q
-        TimerType ticks_12_0, ticks_12_1;
-        TimerType time_12_0, time_12_1;
-        CLOCK(ticks_12_0, time_12_0);
-        struct simint_multi_shellpair Q;
-        simint_initialize_multi_shellpair(&Q);
-        simint_create_multi_shellpair(nshell3, C, nshell4, D, &Q, SIMINT_SCREEN);
-        CLOCK(ticks_12_1, time_12_1);
-        time_am.ticks_shell_pair += ticks_12_1 - ticks_12_0;
-        time_am.time_shell_pair += time_12_1 - time_12_0;
+        #ifdef _OPENMP
+        #pragma omp critical
+        #endif
+        {
+            res.err.first = std::max(res.err.first, err2.first);
+            res.err.second = std::max(res.err.second, err2.second);
+        }
+        #endif // closes BENCHMARK_VALIDATE
 
+        // free this here, since we are done with it
+        simint_free_multi_shellpair(&P);
 
-        // running totals for this am
-        std::atomic<size_t> nprim1234_am(0);
-        std::atomic<size_t> nshell1234_am(0);
-        std::atomic<size_t> ncont1234_am(0);
+        // add primitive and shell count to running totals for this am
+        ncont1234_am += ncont1234;
+        nprim1234_am += nprim1234;
+        nshell1234_am += nshell1234;
+    }
+    CLOCK(fullticks_1, fulltime_1);
+    res.time.fullticks_integrals += fullticks_1 - fullticks_0;
+    res.time.fulltime_integrals += fulltime_1 - fulltime_0;
+
+    simint_free_multi_shellpair(&Q);
+
+    res.ncont1234 = ncont1234_am;
+    res.nprim1234 = nprim1234_am;
+    res.nshell1234 = nshell1234_am;
+    res.nskipped = nskipped_am;
+    res.flops = flops_am;
+    return res;
+}
 
-	    const auto & shellmap_i = shellmap[i];
-	    const auto & shellmap_j = shellmap[j];
 
-        const size_t i_size = shellmap_i.size();
-        const size_t j_size = shellmap_j.size();
-	    const size_t brasize = i_size * j_size;
+// Rates and times of a result (or a sum of them) as JSON members
+static void PrintJSONResult(FILE * out, const char * indent,
+                            size_t nshell1234, size_t nprim1234, size_t ncont1234,
+                            size_t nskipped, double flops, const TimeContrib & time,
+                            const PerfContrib & perf, const simint_screen_stats & stats)
+{
+    // the time spent computing integrals is the wall time of
+    // the whole (parallel) loop. The shell pair time is summed
+    // over the threads
+    const double t_ints = time.fulltime_integrals.load() * 1.0e-9;
+    const double t_pair = time.time_shell_pair.load() * 1.0e-9;
+    const double rate = (t_ints > 0.0 ? 1.0 / t_ints : 0.0);
+
+    fprintf(out, "%s\"shell_quartets\": %lu,\n", indent, static_cast<unsigned long>(nshell1234));
+    fprintf(out, "%s\"primitive_quartets\": %lu,\n", indent, static_cast<unsigned long>(nprim1234));
+    fprintf(out, "%s\"integrals\": %lu,\n", indent, static_cast<unsigned long>(ncont1234));
+    fprintf(out, "%s\"skipped_shell_quartets\": %lu,\n", indent, static_cast<unsigned long>(nskipped));
+    fprintf(out, "%s\"flops\": %.6e,\n", indent, flops);
+    fprintf(out, "%s\"integral_time\": %.6e,\n", indent, t_ints);
+    fprintf(out, "%s\"integral_ticks\": %llu,\n", indent, time.fullticks_integrals.load());
+    fprintf(out, "%s\"shell_pair_time\": %.6e,\n", indent, t_pair);
+    fprintf(out, "%s\"integrals_per_second\": %.6e,\n", indent, ncont1234 * rate);
+    fprintf(out, "%s\"primitive_quartets_per_second\": %.6e,\n", indent, nprim1234 * rate);
+    fprintf(out, "%s\"gflops\": %.6e", indent, flops * rate * 1.0e-9);
+
+    // events that could not be counted are null
+    fprintf(out, ",\n%s\"counters\": {", indent);
+    for(int e = 0; e < PERF_NEVENT; e++)
+    {
+        fprintf(out, "%s\"%s\": ", (e > 0 ? ", " : ""), PerfEventNames[e]);
+        if(PerfCounters_Available(e))
+            fprintf(out, "%llu", perf.count[e].load());
+        else
+            fprintf(out, "null");
+    }
+    fprintf(out, "}");
 
-        // do one shell pair at a time on the bra side
-        TimerType fullticks_0, fullticks_1;
-        TimerType fulltime_0, fulltime_1;
+    fprintf(out, ",\n%s\"screen_stats\": {\"shell_calc\": %llu, \"shell_skip\": %llu, "
+                 "\"prim_calc\": %llu, \"prim_skip\": %llu, \"vec_calc\": %llu, \"vec_skip\": %llu, "
+                 "\"boys_mixed\": %llu}",
+                 indent, stats.shell_calc, stats.shell_skip, stats.prim_calc, stats.prim_skip,
+                 stats.vec_calc, stats.vec_skip, stats.boys_mixed);
+}
 
-        CLOCK(fullticks_0, fulltime_0);
-        #ifdef _OPENMP
-        #pragma omp parallel for schedule(dynamic)
-        #endif
-        for(size_t ab = 0; ab < brasize; ab++)
+
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // options
+    const char * screen_name = "none";
+    int screen_method = SIMINT_SCREEN_NONE;
+    double screen_tol = 1.0e-14;
+    int maxam_opt = SIMINT_OSTEI_MAXAM;
+    bool unique_only = false;
+    bool use_counters = false;
+    int prim_order = SIMINT_PRIM_ORDER_SCREEN;
+    const char * outfile = NULL;
+    std::vector<int> nthreads;
+    std::vector<std::string> basfiles;
+
+    for(int a = 1; a < argc; a++)
+    {
+        const bool hasval = (a+1 < argc);
+
+        if(strcmp(argv[a], "-s") == 0 && hasval)
+        {
+            screen_name = argv[++a];
+            screen_method = ParseScreenMethod(screen_name);
+            if(screen_method < 0)
+            {
+                fprintf(stderr, "Unknown screening method \"%s\"\n", screen_name);
+                return 1;
+            }
+        }
+        else if(strcmp(argv[a], "-t") == 0 && hasval)
+            screen_tol = atof(argv[++a]);
+        else if(strcmp(argv[a], "-l") == 0 && hasval)
+            maxam_opt = std::min(atoi(argv[++a]), SIMINT_OSTEI_MAXAM);
+        else if(strcmp(argv[a], "-o") == 0 && hasval)
+            outfile = argv[++a];
+        else if(strcmp(argv[a], "-u") == 0)
+            unique_only = true;
+        else if(strcmp(argv[a], "-p") == 0)
+            use_counters = true;
+        else if(strcmp(argv[a], "-e") == 0)
+            prim_order = SIMINT_PRIM_ORDER_EXPONENT;
+        else if(strcmp(argv[a], "-n") == 0 && hasval)
         {
-            TimerType ticks_0, ticks_1;
-            TimerType time_0, time_1;
+            for(char * s = strtok(argv[++a], ","); s != NULL; s = strtok(NULL, ","))
+            {
+                if(atoi(s) > 0)
+                    nthreads.push_back(atoi(s));
+            }
+        }
+        else if(argv[a][0] == '-')
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+        else
+            basfiles.push_back(argv[a]);
+    }
 
-	        size_t a = ab / j_size;
-    	    size_t b = ab % j_size;
+    if(basfiles.size() == 0)
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
 
-            const size_t nshell1 = 1;
-            const size_t nshell2 = 1;
+    if(screen_method == SIMINT_SCREEN_NONE)
+        screen_tol = 0.0;
 
-            simint_shell const * const A = &shellmap_i[a];
-            simint_shell const * const B = &shellmap_j[b];
+    // number of threads
+    #ifdef _OPENMP
+        if(nthreads.size() == 0)
+            nthreads.push_back(omp_get_max_threads());
+    #else
+        nthreads.assign(1, 1);
+    #endif
 
-            // time creation of P
-            CLOCK(ticks_0, time_0);
-            struct simint_multi_shellpair P;
-            simint_initialize_multi_shellpair(&P);
-            simint_create_multi_shellpair(nshell1, A, nshell2, B, &P, SIMINT_SCREEN);
-            CLOCK(ticks_1, time_1);
-            time_am.ticks_shell_pair += ticks_1 - ticks_0;
-            time_am.time_shell_pair += time_1 - time_0;
+    const int maxthread = *std::max_element(nthreads.begin(), nthreads.end());
 
-            // acutal number of primitives and shells that
-            // will be calculated
-            const size_t nprim1234 = P.nprim * Q.nprim;
-            const size_t nshell1234 = P.nshell12 * Q.nshell12;
-            const size_t ncont1234 = nshell1234 * ncart1234;
+    if(use_counters && !PerfCounters_Init())
+        fprintf(stderr, "Hardware performance counters are not available\n");
 
-            #ifdef _OPENMP
-                const int ithread = omp_get_thread_num();
-            #else
-                const int ithread = 0;
-            #endif
+    FILE * out = stdout;
+    if(outfile != NULL && (out = fopen(outfile, "w")) == NULL)
+    {
+        fprintf(stderr, "Error opening file %s\n", outfile);
+        return 1;
+    }
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"vector\": \"%s\",\n", simint_vector_isa());
+    fprintf(out, "  \"simd_len\": %d,\n", SIMINT_SIMD_LEN);
+    fprintf(out, "  \"maxam\": %d,\n", SIMINT_OSTEI_MAXAM);
+    fprintf(out, "  \"screen_method\": \"%s\",\n", screen_name);
+    fprintf(out, "  \"screen_tol\": %.6e,\n", screen_tol);
+    fprintf(out, "  \"prim_order\": \"%s\",\n",
+            (prim_order == SIMINT_PRIM_ORDER_EXPONENT ? "exponent" : "screen"));
+    fprintf(out, "  \"runs\": [");
 
-            double * res_ints = all_res_ints + ithread * maxsize;
-            double * const simint_work = all_simint_work + ithread * simint_ostei_worksize(0, maxam);
+    #ifdef BENCHMARK_VALIDATE
+    ValeevRef_Init();
+    #endif
+
+    bool firstrun = true;
+
+    for(const auto & basfile : basfiles)
+    {
+        // read in the shell info
+        ShellMap shellmap = ReadBasis(basfile).first;
 
-            // actually calculate
-            CLOCK(ticks_0, time_0);
-            int simint_ret = simint_compute_eri(&P, &Q, SIMINT_SCREEN_TOL, simint_work, res_ints);
-            CLOCK(ticks_1, time_1);
-            time_am.ticks_integrals += (ticks_1 - ticks_0);
-            time_am.time_integrals += (time_1 - time_0);
+        // normalize
+        for(auto & it : shellmap)
+            simint_normalize_shells(it.second.size(), it.second.data());
 
-            // if the return is < 0, it didn't calculate anything
-            // (everything was screened)
-            if(simint_ret < 0)
-                std::fill(res_ints, res_ints + ncont1234, 0.0);
+        // find the max dimensions
+        std::pair<int, int> maxparams = FindMaxParams(shellmap);
+        const int maxam = std::min(maxparams.first, maxam_opt);
+        const int max_ncart = ( (maxam+1)*(maxam+2) )/2;
+        const int maxsize = maxparams.second * maxparams.second * max_ncart * max_ncart;
 
+        /* Storage of integrals */
+        double * all_res_ints = (double *)SIMINT_ALLOC(maxthread * maxsize * sizeof(double));
 
-            #ifdef BENCHMARK_VALIDATE
-            double * res_ref = all_res_ref + ithread * maxsize;
+        /* contracted workspace */
+        double * all_simint_work = (double *)SIMINT_ALLOC(maxthread * simint_ostei_workmem(0, maxam));
 
-            ValeevRef_Integrals(A, nshell1,
-                                B, nshell2,
-                                C, nshell3,
-                                D, nshell4,
-                                res_ref, 0, false);
-            std::pair<double, double> err2 = CalcError(res_ints, res_ref, ncont1234);
+        #ifdef BENCHMARK_VALIDATE
+        double * all_res_ref = (double *)SIMINT_ALLOC(maxthread * maxsize * sizeof(double));
+        #endif
 
+        for(const int nthread : nthreads)
+        {
             #ifdef _OPENMP
-            #pragma omp critical
+            omp_set_num_threads(nthread);
             #endif
+
+            fprintf(out, "%s\n    {\n", (firstrun ? "" : ","));
+            fprintf(out, "      \"basis\": \"%s\",\n", basfile.c_str());
+            fprintf(out, "      \"threads\": %d,\n", nthread);
+            fprintf(out, "      \"classes\": [");
+            firstrun = false;
+
+            // running totals
+            size_t ncont1234_total = 0;
+            size_t nprim1234_total = 0;
+            size_t nshell1234_total = 0;
+            size_t skipped_total = 0;
+            double flops_total = 0.0;
+            TimeContrib time_total;
+            PerfContrib perf_total;
+            simint_screen_stats stats_total;
+            memset(&stats_total, 0, sizeof(stats_total));
+
+            bool firstam = true;
+
+            for(int i = 0; i <= maxam; i++)
+            for(int j = 0; j <= maxam; j++)
+            for(int k = 0; k <= maxam; k++)
+            for(int l = 0; l <= maxam; l++)
             {
-                err.first = std::max(err.first, err2.first);
-                err.second = std::max(err.second, err2.second);
-                if(simint_ret < 0)
-                    skipped_total += ncont1234;            
+                if(unique_only && !UniqueQuartet(i, j, k, l))
+                    continue;
+
+                if(shellmap[i].size() == 0 || shellmap[j].size() == 0 ||
+                   shellmap[k].size() == 0 || shellmap[l].size() == 0)
+                    continue;
+
+                AMResult res = BenchmarkAM(i, j, k, l, shellmap, screen_method, screen_tol, prim_order,
+                                           maxam, maxsize, all_simint_work, all_res_ints
+                                           #ifdef BENCHMARK_VALIDATE
+                                           , all_res_ref
+                                           #endif
+                                           );
+
+                ncont1234_total += res.ncont1234;
+                nprim1234_total += res.nprim1234;
+                nshell1234_total += res.nshell1234;
+                skipped_total += res.nskipped;
+                flops_total += res.flops;
+                time_total += res.time;
+                perf_total += res.perf;
+                AddScreenStats(simint_screen_stats(), res.stats, stats_total);
+
+                fprintf(out, "%s\n        {\n", (firstam ? "" : ","));
+                fprintf(out, "          \"am\": [%d, %d, %d, %d],\n", i, j, k, l);
+                #ifdef BENCHMARK_VALIDATE
+                fprintf(out, "          \"max_abs_err\": %.3e,\n", res.err.first);
+                fprintf(out, "          \"max_rel_err\": %.3e,\n", res.err.second);
+                #endif
+                PrintJSONResult(out, "          ", res.nshell1234, res.nprim1234, res.ncont1234,
+                                res.nskipped, res.flops, res.time, res.perf, res.stats);
+                fprintf(out, "\n        }");
+                firstam = false;
             }
-            #endif // closes BENCHMARK_VALIDATE
-
-            // free this here, since we are done with it
-            simint_free_multi_shellpair(&P);
 
-            // add primitive and shell count to running totals for this am
-            ncont1234_am += ncont1234;
-            nprim1234_am += nprim1234;
-            nshell1234_am += nshell1234;
+            fprintf(out, "\n      ],\n");
+            fprintf(out, "      \"total\": {\n");
+            PrintJSONResult(out, "        ", nshell1234_total, nprim1234_total, ncont1234_total,
+                            skipped_total, flops_total, time_total, perf_total, stats_total);
+            fprintf(out, "\n      }\n");
+            fprintf(out, "    }");
+            fflush(out);
         }
-        CLOCK(fullticks_1, fulltime_1);
-        time_am.fullticks_integrals += fullticks_1 - fullticks_0;
-        time_am.fulltime_integrals += fulltime_1 - fulltime_0;
-
-        simint_free_multi_shellpair(&Q);
 
-		// add primitive and shell count to overall running totals
-		// threadsafe since these are std::atomic
-		ncont1234_total += ncont1234_am;
-		nprim1234_total += nprim1234_am;
-		nshell1234_total += nshell1234_am;
-		time_total += time_am;
-
-        PrintAMTimingInfo(i, j, k, l, nshell1234_am, nprim1234_am, time_am);
+        FreeShellMap(shellmap);
 
+        SIMINT_FREE(all_res_ints);
+        SIMINT_FREE(all_simint_work);
 
         #ifdef BENCHMARK_VALIDATE
-        printf("( %d %d | %d %d ) MaxAbsErr: %10.3e   MaxRelErr: %10.3e\n", i, j, k, l, err.first, err.second);
+        SIMINT_FREE(all_res_ref);
         #endif
     }
 
-    printf("\n");
-    printf("Calculated %lu contracted integrals\n", static_cast<unsigned long>(ncont1234_total));
-    printf("Calculated %lu contracted shells\n", static_cast<unsigned long>(nshell1234_total));
-    printf("Calculated %lu primitive integrals\n", static_cast<unsigned long>(nprim1234_total));
-    printf("Skipped %lu top-level contracted shells\n", static_cast<unsigned long>(skipped_total));
-
-    printf("\n");
-
-    FreeShellMap(shellmap);
-
-    SIMINT_FREE(all_res_ints);
-    SIMINT_FREE(all_simint_work);
+    fprintf(out, "\n  ]\n");
+    fprintf(out, "}\n");
 
+    if(out != stdout)
+        fclose(out);
 
     #ifdef BENCHMARK_VALIDATE
-    SIMINT_FREE(all_res_ref);
     ValeevRef_Finalize();
     #endif
-    
-    // Finalize stuff 
+
+    PerfCounters_Finalize();
+
+    // Finalize stuff
     simint_finalize();
 
     return 0;
@@ -0,0 +1,80 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+
+// Bounds on the density for n shell pairs, between 1e-6 and 1
+// (the same for every run)
+static std::vector<double> DensityBounds(int n, unsigned int & seed)
+{
+    std::vector<double> d(n);
+    for(int i = 0; i < n; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        d[i] = pow(10.0, -6.0 * ((seed >> 8) & 0xFFFF) / 65536.0);
+    }
+    return d;
+}
+
+
+// Compares integrals computed with density-weighted screening
+// (simint_compute_eri_density) to those computed without screening.
+// Each primitive quartet that is screened out may change an integral
+// of (ab|cd) by at most the tolerance divided by max(D_ab, D_cd)
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc < 2 || argc > 3)
+    {
+        printf("Usage: test_eri_density <basis> [screening tolerance]\n");
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+    const double screen_tol = (argc > 2) ? atof(argv[2]) : 1.0e-10;
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    // density bounds of the shell pairs of the last call
+    unsigned int seed = 12345;
+    std::vector<double> P_density, Q_density;
+
+    auto compute = [&](struct simint_multi_shellpair const * P,
+                       struct simint_multi_shellpair const * Q,
+                       double * work, double * res)
+    {
+        P_density = DensityBounds(P->nshell12, seed);
+        Q_density = DensityBounds(Q->nshell12, seed);
+        return simint_compute_eri_density(P, Q, screen_tol, P_density.data(), Q_density.data(),
+                                          work, res);
+    };
+
+    auto tol = [&](struct simint_multi_shellpair const &,
+                   struct simint_multi_shellpair const &,
+                   int cd)
+    {
+        return screen_tol / std::max(P_density[0], Q_density[cd]);
+    };
+
+    printf("Screening tolerance: %.4e\n\n", screen_tol);
+
+    const int ret = CompareScreenedERI(shellmap, SIMINT_SCREEN_SCHWARZ, false, compute, tol);
+
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    return ret;
+}
@@ -0,0 +1,206 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
+
+#include "simint/simint.h"
+#include "simint/simint_engine.h"
+#include "test/Common.hpp"
+#include "test/ValeevRef.hpp"
+
+
+typedef std::array<int, 4> Quartet;
+
+// Quartet (shells a, b, c, d) -> integrals
+typedef std::map<Quartet, std::vector<double>> QuartetMap;
+
+// What simint_eri_engine passed to the callback
+struct EngineResult
+{
+    struct simint_shell const * shells;
+    QuartetMap integrals;
+    long nduplicate;
+};
+
+
+static void StoreBlock(struct simint_eri_block const * block, void * data)
+{
+    EngineResult * res = static_cast<EngineResult *>(data);
+
+    const int a = block->bra_shells[0];
+    const int b = block->bra_shells[1];
+
+    for(int cd = 0; cd < block->nket; cd++)
+    {
+        const int c = block->ket_shells[2*cd];
+        const int d = block->ket_shells[2*cd+1];
+        const int ncart1234 = NCART(res->shells[a].am) * NCART(res->shells[b].am)
+                            * NCART(res->shells[c].am) * NCART(res->shells[d].am);
+
+        double const * start = block->integrals + cd*ncart1234;
+
+        #ifdef _OPENMP
+        #pragma omp critical
+        #endif
+        {
+            if(res->integrals.count({{a, b, c, d}}) || res->integrals.count({{c, d, a, b}}))
+                res->nduplicate++;
+            res->integrals[{{a, b, c, d}}].assign(start, start + ncart1234);
+        }
+    }
+}
+
+
+// Runs the engine with the given number of threads
+static long RunEngine(std::vector<struct simint_shell> const & shells, int nthread,
+                      double screen_tol, EngineResult & res)
+{
+    #ifdef _OPENMP
+    omp_set_num_threads(nthread);
+    #else
+    (void)nthread;
+    #endif
+
+    res.shells = shells.data();
+    res.integrals.clear();
+    res.nduplicate = 0;
+
+    return simint_eri_engine(shells.size(), shells.data(), screen_tol,
+                             SIMINT_SCREEN_SCHWARZ, StoreBlock, &res);
+}
+
+
+// Compares the integrals computed by simint_eri_engine to the reference
+// integrals. Every unique shell quartet must be passed to the callback
+// exactly once, and the results must not depend on the number of threads
+// (with or without screening)
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc < 2 || argc > 3)
+    {
+        printf("Usage: test_eri_engine <basis> [screening tolerance]\n");
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+    const double screen_tol = (argc > 2) ? atof(argv[2]) : 1.0e-10;
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    std::pair<int, int> maxparams = FindMaxParams(shellmap);
+    const int maxam = (maxparams.first > SIMINT_OSTEI_MAXAM ? SIMINT_OSTEI_MAXAM : maxparams.first);
+    const int max_ncart = ( (maxam+1)*(maxam+2) )/2;
+
+    // all the shells that there are kernels for
+    std::vector<struct simint_shell> shells;
+    for(int i = 0; i <= maxam; i++)
+        shells.insert(shells.end(), shellmap[i].begin(), shellmap[i].end());
+
+    const int nshell = shells.size();
+
+    #ifdef _OPENMP
+        const int maxthread = omp_get_max_threads();
+    #else
+        const int maxthread = 1;
+    #endif
+
+    int nfail = 0;
+
+    // without screening, on one thread and on all of them
+    EngineResult res1, resN;
+    const long nblock1 = RunEngine(shells, 1, 0.0, res1);
+    const long nblockN = RunEngine(shells, maxthread, 0.0, resN);
+
+    printf("Threads: 1 and %d\n", maxthread);
+    printf("Blocks: %ld and %ld\n", nblock1, nblockN);
+    printf("Duplicate quartets: %ld and %ld\n", res1.nduplicate, resN.nduplicate);
+
+    if(nblock1 < 0 || nblockN != nblock1 || res1.nduplicate > 0 || resN.nduplicate > 0)
+        nfail++;
+
+    if(res1.integrals != resN.integrals)
+    {
+        printf("Integrals depend on the number of threads\n");
+        nfail++;
+    }
+
+
+    // every unique quartet, compared to the reference
+    ValeevRef_Init();
+
+    std::vector<double> res_valeev(max_ncart * max_ncart * max_ncart * max_ncart);
+
+    long nmissing = 0, nquartet = 0;
+    double maxerr = 0.0, maxrelerr = 0.0;
+
+    for(int a = 0; a < nshell; a++)
+    for(int b = 0; b <= a; b++)
+    for(int c = 0; c <= a; c++)
+    for(int d = 0; d <= (c == a ? b : c); d++)
+    {
+        auto it = res1.integrals.find({{a, b, c, d}});
+        if(it == res1.integrals.end())
+            it = res1.integrals.find({{c, d, a, b}});
+
+        if(it == res1.integrals.end())
+        {
+            nmissing++;
+            continue;
+        }
+
+        Quartet const & q = it->first;
+        ValeevRef_Integrals(&shells[q[0]], 1, &shells[q[1]], 1,
+                            &shells[q[2]], 1, &shells[q[3]], 1,
+                            res_valeev.data(), 0, false);
+
+        std::pair<double, double> err = CalcError(it->second.data(), res_valeev.data(), it->second.size());
+        maxerr = std::max(maxerr, err.first);
+        maxrelerr = std::max(maxrelerr, err.second);
+        nquartet++;
+    }
+
+    printf("\nQuartets: %ld (%ld missing, %ld computed)\n", nquartet + nmissing, nmissing,
+                                                            (long)res1.integrals.size());
+    printf("Maximum error: %.4e (relative %.4e)\n", maxerr, maxrelerr);
+
+    if(nmissing > 0 || (long)res1.integrals.size() != nquartet ||
+       (maxerr > 1e-14 && maxrelerr > 1e-8))
+        nfail++;
+
+
+    // with screening
+    const long nscreen1 = RunEngine(shells, 1, screen_tol, res1);
+    const long nscreenN = RunEngine(shells, maxthread, screen_tol, resN);
+
+    printf("\nScreening tolerance: %.4e\n", screen_tol);
+    printf("Blocks: %ld and %ld\n", nscreen1, nscreenN);
+
+    if(nscreen1 < 0 || nscreenN != nscreen1 || res1.nduplicate > 0 || resN.nduplicate > 0)
+        nfail++;
+
+    if(res1.integrals != resN.integrals)
+    {
+        printf("Integrals depend on the number of threads\n");
+        nfail++;
+    }
+
+    ValeevRef_Finalize();
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    return (nfail > 0) ? 1 : 0;
+}
@@ -0,0 +1,192 @@
+#include <cstdio>
+#include <iostream>
+#include <cmath>
+#include <vector>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+
+#define SIMINT_SCREEN 2
+#define SIMINT_SCREEN_TOL 0.0
+
+
+// Fill a (non-symmetric) test density
+static void FillDensity(int nbf, double * D)
+{
+    for(int i = 0; i < nbf; i++)
+    for(int j = 0; j < nbf; j++)
+        D[i*nbf+j] = cos(0.37*i + 0.11*j*j) / (1.0 + fabs(double(i-j)));
+}
+
+
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc != 2)
+    {
+        printf("Give me 1 argument! I got %d\n", argc-1);
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+
+    // normalize the original
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    // find the max dimensions
+    std::pair<int, int> maxparams = FindMaxParams(shellmap);
+    const int maxam = (maxparams.first > SIMINT_OSTEI_MAXAM ? SIMINT_OSTEI_MAXAM : maxparams.first);
+    const int max_ncart = ( (maxam+1)*(maxam+2) )/2;
+
+    // first (cartesian) basis function of each shell
+    std::map<int, std::vector<int>> shell_bf;
+    int nbf = 0;
+    for(int am = 0; am <= maxam; am++)
+    {
+        for(size_t a = 0; a < shellmap[am].size(); a++)
+        {
+            shell_bf[am].push_back(nbf);
+            nbf += NCART(am);
+        }
+    }
+
+    int maxnshell = 0;
+    for(int am = 0; am <= maxam; am++)
+        maxnshell = std::max(maxnshell, static_cast<int>(shellmap[am].size()));
+
+    const size_t maxsize = size_t(maxnshell) * maxnshell * maxnshell * maxnshell
+                         * max_ncart * max_ncart * max_ncart * max_ncart;
+
+    /* contracted workspace */
+    double * simint_work = (double *)SIMINT_ALLOC(simint_ostei_workmem(0, maxam));
+
+    /* Storage of integrals */
+    double * res_simint = (double *)SIMINT_ALLOC(maxsize * sizeof(double));
+
+    std::vector<double> D(nbf*nbf);
+    std::vector<double> J(nbf*nbf), K(nbf*nbf);
+    std::vector<double> J_ref(nbf*nbf), K_ref(nbf*nbf);
+
+    FillDensity(nbf, D.data());
+
+    // Print the header for the final results table
+    printf("\n");
+    printf("%17s  %10s    %10s\n", "Quartet", "MaxErrJ", "MaxErrK");
+
+
+    // loop over all AM quartets (including permutations)
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    for(int k = 0; k <= maxam; k++)
+    for(int l = 0; l <= maxam; l++)
+    {
+        const int nshell1 = shellmap[i].size();
+        const int nshell2 = shellmap[j].size();
+        const int nshell3 = shellmap[k].size();
+        const int nshell4 = shellmap[l].size();
+
+        // create multishell pairs for all ( i j | k l ) quartets
+        struct simint_multi_shellpair P, Q;
+        simint_initialize_multi_shellpair(&P);
+        simint_initialize_multi_shellpair(&Q);
+        simint_create_multi_shellpair(nshell1, shellmap[i].data(),
+                                      nshell2, shellmap[j].data(), &P,
+                                      SIMINT_SCREEN);
+        simint_create_multi_shellpair(nshell3, shellmap[k].data(),
+                                      nshell4, shellmap[l].data(), &Q,
+                                      SIMINT_SCREEN);
+
+        // basis functions of the shell pairs
+        std::vector<int> P_bf, Q_bf;
+        for(int a = 0; a < nshell1; a++)
+        for(int b = 0; b < nshell2; b++)
+        {
+            P_bf.push_back(shell_bf[i][a]);
+            P_bf.push_back(shell_bf[j][b]);
+        }
+
+        for(int c = 0; c < nshell3; c++)
+        for(int d = 0; d < nshell4; d++)
+        {
+            Q_bf.push_back(shell_bf[k][c]);
+            Q_bf.push_back(shell_bf[l][d]);
+        }
+
+        std::fill(J.begin(), J.end(), 0.0);
+        std::fill(K.begin(), K.end(), 0.0);
+        std::fill(J_ref.begin(), J_ref.end(), 0.0);
+        std::fill(K_ref.begin(), K_ref.end(), 0.0);
+
+        ////////////////////////////////////////
+        // Fused digestion
+        ////////////////////////////////////////
+        int ret = simint_compute_eri_jk(&P, &Q, SIMINT_SCREEN_TOL, nbf,
+                                        P_bf.data(), Q_bf.data(),
+                                        D.data(), J.data(), K.data(),
+                                        simint_work);
+
+        if(ret == -2)
+        {
+            printf("\nLibrary was not generated with fused J/K kernels\n\n");
+            simint_free_multi_shellpair(&P);
+            simint_free_multi_shellpair(&Q);
+            break;
+        }
+
+        ////////////////////////////////////////
+        // Reference: store the integrals,
+        // then digest them
+        ////////////////////////////////////////
+        simint_compute_eri(&P, &Q, SIMINT_SCREEN_TOL, simint_work, res_simint);
+
+        double const * ints = res_simint;
+        for(int ab = 0; ab < P.nshell12; ab++)
+        for(int cd = 0; cd < Q.nshell12; cd++)
+        for(int c1 = 0; c1 < NCART(i); c1++)
+        for(int c2 = 0; c2 < NCART(j); c2++)
+        for(int c3 = 0; c3 < NCART(k); c3++)
+        for(int c4 = 0; c4 < NCART(l); c4++)
+        {
+            const int f1 = P_bf[2*ab] + c1;
+            const int f2 = P_bf[2*ab+1] + c2;
+            const int f3 = Q_bf[2*cd] + c3;
+            const int f4 = Q_bf[2*cd+1] + c4;
+            const double val = *ints++;
+            J_ref[f1*nbf+f2] += val * D[f3*nbf+f4];
+            K_ref[f1*nbf+f3] += val * D[f2*nbf+f4];
+        }
+
+        double errj = 0.0, errk = 0.0;
+        for(int m = 0; m < nbf*nbf; m++)
+        {
+            errj = std::max(errj, fabs(J[m] - J_ref[m]));
+            errk = std::max(errk, fabs(K[m] - K_ref[m]));
+        }
+
+        simint_free_multi_shellpair(&P);
+        simint_free_multi_shellpair(&Q);
+
+        bool bad = (errj > 1e-12 || errk > 1e-12);
+        printf("( %2d %2d | %2d %2d )    %10.3e  %10.3e  %s\n", i, j, k, l, errj, errk, bad ? "***" : "");
+    }
+
+    printf("\n");
+
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    SIMINT_FREE(res_simint);
+    SIMINT_FREE(simint_work);
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+#include "test/Timer.h"
+
+
+// Compares integrals computed entirely with the single precision kernels
+// (simint_compute_eri_mixed with a huge single precision tolerance) to
+// those computed in double precision. The difference must be within the
+// accuracy of single precision, relative to the largest integral of
+// each bra shell pair
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc < 2 || argc > 3)
+    {
+        printf("Usage: test_eri_mixed <basis> [relative tolerance]\n");
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+    const double reltol = (argc > 2) ? atof(argv[2]) : 1.0e-5;
+
+    if(!SIMINT_OSTEI_F32)
+        printf("No single precision kernels (create.py -f32). Double precision is used instead\n\n");
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    std::pair<int, int> maxparams = FindMaxParams(shellmap);
+    const int maxam = (maxparams.first > SIMINT_OSTEI_MAXAM ? SIMINT_OSTEI_MAXAM : maxparams.first);
+    const int max_ncart = ( (maxam+1)*(maxam+2) )/2;
+    const int maxsize = maxparams.second * maxparams.second * max_ncart * max_ncart;
+
+    double * work = (double *)SIMINT_ALLOC(simint_ostei_workmem(0, maxam));
+    double * res_single = (double *)SIMINT_ALLOC(maxsize * sizeof(double));
+    double * res_double = (double *)SIMINT_ALLOC(maxsize * sizeof(double));
+
+    // single precision is used for everything with a screening
+    // estimate below this
+    const double single_tol = 1.0e100;
+
+    double maxrel = 0.0;
+    TimerType time_single = 0, time_double = 0;
+
+    printf("%17s   %12s   %12s   %12s\n", "Quartet", "MaxRelDiff", "Single(ms)", "Double(ms)");
+
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    for(int k = 0; k <= maxam; k++)
+    for(int l = 0; l <= maxam; l++)
+    {
+        if(!UniqueQuartet(i, j, k, l))
+            continue;
+
+        const int nshell3 = shellmap[k].size();
+        const int nshell4 = shellmap[l].size();
+        const int ncart1234 = NCART(i) * NCART(j) * NCART(k) * NCART(l);
+
+        // the single precision kernels need the screening information
+        struct simint_multi_shellpair Q;
+        simint_initialize_multi_shellpair(&Q);
+        simint_create_multi_shellpair(nshell3, shellmap[k].data(),
+                                      nshell4, shellmap[l].data(), &Q,
+                                      SIMINT_SCREEN_SCHWARZ);
+
+        double amrel = 0.0;
+        TimerType amtime_single = 0, amtime_double = 0;
+
+        for(size_t a = 0; a < shellmap[i].size(); a++)
+        for(size_t b = 0; b < shellmap[j].size(); b++)
+        {
+            struct simint_multi_shellpair P;
+            simint_initialize_multi_shellpair(&P);
+            simint_create_multi_shellpair(1, &shellmap[i][a], 1, &shellmap[j][b], &P,
+                                          SIMINT_SCREEN_SCHWARZ);
+
+            TimerType ticks0, ticks1, time0, time1;
+
+            CLOCK(ticks0, time0);
+            simint_compute_eri_mixed(&P, &Q, 0.0, single_tol, work, res_single);
+            CLOCK(ticks1, time1);
+            amtime_single += time1 - time0;
+
+            CLOCK(ticks0, time0);
+            simint_compute_eri(&P, &Q, 0.0, work, res_double);
+            CLOCK(ticks1, time1);
+            amtime_double += time1 - time0;
+            (void)ticks0; (void)ticks1;
+
+            // relative to the largest integral of this bra shell pair
+            // (some quartets are zero by symmetry, apart from round off)
+            const int nint = Q.nshell12 * ncart1234;
+
+            double refmax = 0.0;
+            for(int m = 0; m < nint; m++)
+                refmax = std::max(refmax, fabs(res_double[m]));
+
+            if(refmax > 0.0)
+            {
+                for(int m = 0; m < nint; m++)
+                    amrel = std::max(amrel, fabs(res_single[m] - res_double[m]) / refmax);
+            }
+
+            simint_free_multi_shellpair(&P);
+        }
+
+        simint_free_multi_shellpair(&Q);
+
+        maxrel = std::max(maxrel, amrel);
+        time_single += amtime_single;
+        time_double += amtime_double;
+        printf("( %2d %2d | %2d %2d )   %12.4e   %12.3f   %12.3f\n", i, j, k, l, amrel,
+               amtime_single * 1.0e-6, amtime_double * 1.0e-6);
+    }
+
+    printf("\nLargest relative difference: %.4e (tolerance %.4e)\n", maxrel, reltol);
+    printf("Time in single precision: %.3f ms, double: %.3f ms\n", time_single * 1.0e-6, time_double * 1.0e-6);
+
+    SIMINT_FREE(res_double);
+    SIMINT_FREE(res_single);
+    SIMINT_FREE(work);
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    return (maxrel > reltol) ? 1 : 0;
+}
@@ -0,0 +1,69 @@
+#include <cstdio>
+#include <cstdlib>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+
+// Compares integrals computed from shell pairs pruned with
+// simint_prune_multi_shellpair to those from the full shell pairs
+// (both without screening in the kernels). Each primitive quartet
+// that was removed may change an integral by at most the tolerance
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc < 2 || argc > 3)
+    {
+        printf("Usage: test_eri_prune <basis> [screening tolerance]\n");
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+    const double screen_tol = (argc > 2) ? atof(argv[2]) : 1.0e-10;
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    long nremoved = 0, nprim = 0;
+
+    // each side is pruned against the other
+    auto compute = [&](struct simint_multi_shellpair const * P,
+                       struct simint_multi_shellpair const * Q,
+                       double * work, double * res)
+    {
+        struct simint_multi_shellpair P_prune, Q_prune;
+        simint_initialize_multi_shellpair(&P_prune);
+        simint_initialize_multi_shellpair(&Q_prune);
+
+        nremoved += simint_prune_multi_shellpair(P, &P_prune, Q->screen_max, screen_tol);
+        nremoved += simint_prune_multi_shellpair(Q, &Q_prune, P->screen_max, screen_tol);
+        nprim += P->nprim + Q->nprim;
+
+        const int ret = simint_compute_eri(&P_prune, &Q_prune, 0.0, work, res);
+
+        simint_free_multi_shellpair(&P_prune);
+        simint_free_multi_shellpair(&Q_prune);
+        return ret;
+    };
+
+    printf("Screening tolerance: %.4e\n\n", screen_tol);
+
+    const int ret = CompareScreenedERI(shellmap, SIMINT_SCREEN_SCHWARZ, false, compute,
+                                       [=](struct simint_multi_shellpair const &,
+                                           struct simint_multi_shellpair const &,
+                                           int) { return screen_tol; });
+
+    printf("Removed %ld of %ld primitive pairs\n", nremoved, nprim);
+
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    return ret;
+}
@@ -0,0 +1,54 @@
+#include <cstdio>
+#include <cstdlib>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+
+// Compares integrals computed with distance-aware screening
+// (SIMINT_SCREEN_QQR) to those computed without screening. Each
+// primitive quartet that is screened out may change an integral by at
+// most the tolerance, so no shell quartet larger than that may be
+// dropped. The ket holds the shell pairs of one shell at a time, so
+// that whole calls can be screened out
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc < 2 || argc > 3)
+    {
+        printf("Usage: test_eri_qqr <basis> [screening tolerance]\n");
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+    const double screen_tol = (argc > 2) ? atof(argv[2]) : 1.0e-10;
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    auto compute = [=](struct simint_multi_shellpair const * P,
+                       struct simint_multi_shellpair const * Q,
+                       double * work, double * res)
+    {
+        return simint_compute_eri(P, Q, screen_tol, work, res);
+    };
+
+    printf("Screening tolerance: %.4e\n\n", screen_tol);
+
+    const int ret = CompareScreenedERI(shellmap, SIMINT_SCREEN_QQR, true, compute,
+                                       [=](struct simint_multi_shellpair const &,
+                                           struct simint_multi_shellpair const &,
+                                           int) { return screen_tol; });
+
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    return ret;
+}
@@ -0,0 +1,52 @@
+#include <cstdio>
+#include <cstdlib>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+
+// Compares integrals computed with screening to those computed without.
+// Each primitive quartet that is screened out (or whose Boys function is
+// evaluated to lower accuracy, with kernels from create.py -rb) may change
+// an integral by at most the tolerance
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc < 2 || argc > 3)
+    {
+        printf("Usage: test_eri_screen <basis> [screening tolerance]\n");
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+    const double screen_tol = (argc > 2) ? atof(argv[2]) : 1.0e-10;
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    auto compute = [=](struct simint_multi_shellpair const * P,
+                       struct simint_multi_shellpair const * Q,
+                       double * work, double * res)
+    {
+        return simint_compute_eri(P, Q, screen_tol, work, res);
+    };
+
+    printf("Screening tolerance: %.4e\n\n", screen_tol);
+
+    const int ret = CompareScreenedERI(shellmap, SIMINT_SCREEN_SCHWARZ, false, compute,
+                                       [=](struct simint_multi_shellpair const &,
+                                           struct simint_multi_shellpair const &,
+                                           int) { return screen_tol; });
+
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    return ret;
+}
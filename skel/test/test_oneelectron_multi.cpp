@@ -0,0 +1,117 @@
+#include <cstdio>
+#include <algorithm>
+#include <vector>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+
+// Compares the one electron integrals of the multi shell pair functions
+// with those computed one pair of shells at a time
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc != 2)
+    {
+        printf("Give me 1 argument! I got %d\n", argc-1);
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+
+    // read in the shell info
+    std::pair<ShellMap, Molecule> molinfo = ReadBasis(basfile);
+    ShellMap shellmap = molinfo.first;
+    Molecule mol = molinfo.second;
+
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    const int maxam = FindMaxParams(shellmap).first;
+
+    // Form SOA from molecule AOS
+    std::vector<double> mol_Z, mol_x, mol_y, mol_z;
+    for(const auto & atom : mol)
+    {
+        mol_Z.push_back(atom.Z);
+        mol_x.push_back(atom.x);
+        mol_y.push_back(atom.y);
+        mol_z.push_back(atom.z);
+    }
+    const int ncenter = static_cast<int>(mol.size());
+
+    double * work = (double *)SIMINT_ALLOC(simint_osoei_workmem(maxam));
+
+    std::pair<double, double> maxerr(0.0, 0.0);
+
+    printf("%5s %5s   %13s %13s   %13s %13s   %13s %13s\n",
+           "AM1", "AM2", "overlap abs", "rel", "ke abs", "rel", "potential abs", "rel");
+
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    {
+        const size_t nshell1 = shellmap[i].size();
+        const size_t nshell2 = shellmap[j].size();
+        if(nshell1 == 0 || nshell2 == 0)
+            continue;
+
+        const int ncart12 = NCART(i) * NCART(j);
+        const size_t nint = nshell1 * nshell2 * ncart12;
+
+        struct simint_multi_shellpair P;
+        simint_initialize_multi_shellpair(&P);
+        simint_create_multi_shellpair(nshell1, shellmap[i].data(),
+                                      nshell2, shellmap[j].data(), &P, SIMINT_SCREEN_NONE);
+
+        std::vector<double> res_multi(nint), res_ref(nint);
+        std::pair<double, double> err[3];
+
+        for(int type = 0; type < 3; type++)
+        {
+            if(type == 0)
+                simint_compute_overlap_multi(&P, work, res_multi.data());
+            else if(type == 1)
+                simint_compute_ke_multi(&P, work, res_multi.data());
+            else
+                simint_compute_potential_multi(ncenter, mol_Z.data(), mol_x.data(), mol_y.data(),
+                                               mol_z.data(), &P, work, res_multi.data());
+
+            for(size_t a = 0; a < nshell1; a++)
+            for(size_t b = 0; b < nshell2; b++)
+            {
+                double * ref = res_ref.data() + (a*nshell2 + b) * ncart12;
+
+                if(type == 0)
+                    simint_compute_overlap(&shellmap[i][a], &shellmap[j][b], ref);
+                else if(type == 1)
+                    simint_compute_ke(&shellmap[i][a], &shellmap[j][b], ref);
+                else
+                    simint_compute_potential(ncenter, mol_Z.data(), mol_x.data(), mol_y.data(),
+                                             mol_z.data(), &shellmap[i][a], &shellmap[j][b], ref);
+            }
+
+            err[type] = CalcError(res_multi.data(), res_ref.data(), nint);
+            maxerr.first = std::max(maxerr.first, err[type].first);
+            maxerr.second = std::max(maxerr.second, err[type].second);
+        }
+
+        printf("%5d %5d   %13.4e %13.4e   %13.4e %13.4e   %13.4e %13.4e\n", i, j,
+               err[0].first, err[0].second, err[1].first, err[1].second,
+               err[2].first, err[2].second);
+
+        simint_free_multi_shellpair(&P);
+    }
+
+    printf("\nMaximum error: %.4e (absolute) %.4e (relative)\n", maxerr.first, maxerr.second);
+
+    SIMINT_FREE(work);
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    // (the relative error is meaningless for integrals that are zero by symmetry)
+    return (maxerr.first > 1.0e-10) ? 1 : 0;
+}
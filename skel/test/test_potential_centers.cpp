@@ -0,0 +1,156 @@
+#include <cstdio>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <vector>
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+#include "test/Timer.h"
+
+
+// Compares simint_compute_potential_centers with simint_compute_potential,
+// for the atoms of the molecule plus a field of point charges around it
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc != 3)
+    {
+        printf("Give me 2 arguments! I got %d\n", argc-1);
+        printf("Usage: test_potential_centers <basis file> <number of point charges>\n");
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+    const int ncharge = atoi(argv[2]);
+
+    // read in the shell info
+    std::pair<ShellMap, Molecule> molinfo = ReadBasis(basfile);
+    ShellMap shellmap = molinfo.first;
+    Molecule mol = molinfo.second;
+
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    const int maxam = FindMaxParams(shellmap).first;
+
+    #ifdef _OPENMP
+        const int nthread = omp_get_max_threads();
+    #else
+        const int nthread = 1;
+    #endif
+
+    // Form SOA from molecule AOS, then add the point charges
+    // (in a box 20 bohr larger than the molecule)
+    std::vector<double> Z, x, y, z;
+    for(const auto & atom : mol)
+    {
+        Z.push_back(atom.Z);
+        x.push_back(atom.x);
+        y.push_back(atom.y);
+        z.push_back(atom.z);
+    }
+
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> qdist(-1.0, 1.0);
+    std::uniform_real_distribution<double> rdist(-10.0, 10.0);
+    for(int n = 0; n < ncharge; n++)
+    {
+        const auto & atom = mol[n % mol.size()];
+        Z.push_back(qdist(gen));
+        x.push_back(atom.x + rdist(gen));
+        y.push_back(atom.y + rdist(gen));
+        z.push_back(atom.z + rdist(gen));
+    }
+
+    const int ncenter = static_cast<int>(Z.size());
+    const double cutoff = 8.0;
+
+    double maxerr = 0.0, maxerr_cutoff = 0.0;
+    TimerType ticks_ref = 0, ticks_centers = 0;
+    TimerType time_ref = 0, time_centers = 0;
+
+    printf("%5s %5s   %13s %13s\n", "AM1", "AM2", "abs error", "with cutoff");
+
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    {
+        const int ncart12 = NCART(i) * NCART(j);
+        std::vector<double> res(ncart12), ref(ncart12);
+        double err = 0.0, err_cutoff = 0.0;
+
+        for(size_t a = 0; a < shellmap[i].size(); a++)
+        for(size_t b = 0; b < shellmap[j].size(); b++)
+        {
+            simint_shell const * A = &shellmap[i][a];
+            simint_shell const * B = &shellmap[j][b];
+
+            TimerType ticks0, ticks1, time0, time1;
+            CLOCK(ticks0, time0);
+            simint_compute_potential(ncenter, Z.data(), x.data(), y.data(), z.data(), A, B, ref.data());
+            CLOCK(ticks1, time1);
+            ticks_ref += ticks1 - ticks0;
+            time_ref += time1 - time0;
+
+            CLOCK(ticks0, time0);
+            simint_compute_potential_centers(ncenter, Z.data(), x.data(), y.data(), z.data(),
+                                             0.0, nthread, A, B, res.data());
+            CLOCK(ticks1, time1);
+            ticks_centers += ticks1 - ticks0;
+            time_centers += time1 - time0;
+
+            for(int n = 0; n < ncart12; n++)
+                err = std::max(err, fabs(res[n] - ref[n]));
+
+            // with a cutoff, the reference only gets the charges
+            // within the cutoff of the segment between the shells
+            std::vector<double> cZ, cx, cy, cz;
+            const double AB[3] = { B->x - A->x, B->y - A->y, B->z - A->z };
+            const double AB2 = AB[0]*AB[0] + AB[1]*AB[1] + AB[2]*AB[2];
+            for(int c = 0; c < ncenter; c++)
+            {
+                const double AC[3] = { x[c] - A->x, y[c] - A->y, z[c] - A->z };
+                double t = (AB2 > 0.0) ? (AC[0]*AB[0] + AC[1]*AB[1] + AC[2]*AB[2]) / AB2 : 0.0;
+                t = std::min(std::max(t, 0.0), 1.0);
+                const double d[3] = { AC[0] - t*AB[0], AC[1] - t*AB[1], AC[2] - t*AB[2] };
+                if(d[0]*d[0] + d[1]*d[1] + d[2]*d[2] <= cutoff*cutoff)
+                {
+                    cZ.push_back(Z[c]);
+                    cx.push_back(x[c]);
+                    cy.push_back(y[c]);
+                    cz.push_back(z[c]);
+                }
+            }
+
+            simint_compute_potential(static_cast<int>(cZ.size()), cZ.data(), cx.data(), cy.data(), cz.data(),
+                                     A, B, ref.data());
+            simint_compute_potential_centers(ncenter, Z.data(), x.data(), y.data(), z.data(),
+                                             cutoff, nthread, A, B, res.data());
+
+            for(int n = 0; n < ncart12; n++)
+                err_cutoff = std::max(err_cutoff, fabs(res[n] - ref[n]));
+        }
+
+        printf("%5d %5d   %13.4e %13.4e\n", i, j, err, err_cutoff);
+        maxerr = std::max(maxerr, err);
+        maxerr_cutoff = std::max(maxerr_cutoff, err_cutoff);
+    }
+
+    printf("\n%d centers, %d threads\n", ncenter, nthread);
+    printf("%15llu ticks %10.3f ms (simint_compute_potential)\n", ticks_ref, time_ref * 1.0e-6);
+    printf("%15llu ticks %10.3f ms (simint_compute_potential_centers)\n", ticks_centers, time_centers * 1.0e-6);
+    printf("Maximum error: %.4e (all charges) %.4e (with cutoff)\n", maxerr, maxerr_cutoff);
+
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    return (std::max(maxerr, maxerr_cutoff) > 1.0e-10) ? 1 : 0;
+}
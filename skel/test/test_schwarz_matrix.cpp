@@ -0,0 +1,104 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "simint/simint.h"
+#include "simint/shell/shell_screen.h"
+#include "test/Common.hpp"
+
+
+// Compares the screening values from simint_schwarz_matrix to the
+// largest diagonal element of the full (ab|ab) integrals. Also checks
+// that a shell with no kernels is reported as an error
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc != 2)
+    {
+        printf("Usage: test_schwarz_matrix <basis>\n");
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    std::pair<int, int> maxparams = FindMaxParams(shellmap);
+    const int maxam = (maxparams.first > SIMINT_OSTEI_MAXAM ? SIMINT_OSTEI_MAXAM : maxparams.first);
+    const int max_ncart = ( (maxam+1)*(maxam+2) )/2;
+
+    // all the shells that there are kernels for
+    std::vector<struct simint_shell> shells;
+    for(int i = 0; i <= maxam; i++)
+        shells.insert(shells.end(), shellmap[i].begin(), shellmap[i].end());
+
+    const int nshell = shells.size();
+
+    double * work = (double *)SIMINT_ALLOC(simint_ostei_workmem(0, maxam));
+    double * res = (double *)SIMINT_ALLOC(max_ncart * max_ncart * max_ncart * max_ncart * sizeof(double));
+    std::vector<double> schwarz((size_t)nshell * nshell);
+
+    int ret = simint_schwarz_matrix(nshell, shells.data(), schwarz.data());
+    int nfail = (ret != 0);
+    printf("simint_schwarz_matrix returned %d\n", ret);
+
+    double maxrel = 0.0;
+
+    for(int i = 0; i < nshell; i++)
+    for(int j = 0; j < nshell; j++)
+    {
+        struct simint_multi_shellpair P;
+        simint_initialize_multi_shellpair(&P);
+        simint_create_multi_shellpair(1, &shells[i], 1, &shells[j], &P, SIMINT_SCREEN_NONE);
+        simint_compute_eri(&P, &P, 0.0, work, res);
+        simint_free_multi_shellpair(&P);
+
+        // the diagonal of (ab|ab)
+        const int ncart12 = NCART(shells[i].am) * NCART(shells[j].am);
+        double ref = 0.0;
+        for(int m = 0; m < ncart12; m++)
+            ref = std::max(ref, fabs(res[m*ncart12 + m]));
+
+        const double val = schwarz[(size_t)i*nshell + j];
+        if(ref > 0.0)
+            maxrel = std::max(maxrel, fabs(val - ref) / ref);
+        else if(val != 0.0)
+            maxrel = 1.0;
+    }
+
+    printf("Largest relative difference from (ab|ab): %.4e\n", maxrel);
+
+    if(maxrel > 1.0e-10)
+        nfail++;
+
+    // there are no kernels beyond SIMINT_OSTEI_MAXAM
+    const double alpha = 1.0, coef = 1.0;
+    struct simint_shell big;
+    simint_initialize_shell(&big);
+    simint_create_shell(1, SIMINT_OSTEI_MAXAM+1, 0.0, 0.0, 0.0, &alpha, &coef, &big);
+
+    double big_schwarz = 0.0;
+    ret = simint_schwarz_matrix(1, &big, &big_schwarz);
+    printf("With AM %d: simint_schwarz_matrix returned %d\n", SIMINT_OSTEI_MAXAM+1, ret);
+
+    if(ret != -2 || big_schwarz >= 0.0)
+        nfail++;
+
+    simint_free_shell(&big);
+    SIMINT_FREE(res);
+    SIMINT_FREE(work);
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    return (nfail > 0) ? 1 : 0;
+}
@@ -0,0 +1,209 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+
+// Largest relative difference between two values
+static double RelDiff(double a, double b)
+{
+    const double scale = std::max(fabs(a), fabs(b));
+    return (scale > 0.0) ? fabs(a - b) / scale : 0.0;
+}
+
+
+// Compares a shell pair updated with simint_update_multi_shellpair_coords
+// to one created from scratch at the new coordinates. The update keeps
+// the order of the primitive pairs, so they are matched by primidx.
+static double ComparePairs(struct simint_multi_shellpair const & U,
+                           struct simint_multi_shellpair const & F)
+{
+    double maxdiff = RelDiff(U.screen_max, F.screen_max);
+
+    int idx = 0;
+    for(int ab = 0; ab < U.nshell12; ab++)
+    {
+        if(U.nprim12[ab] != F.nprim12[ab])
+            return 1.0;
+
+        maxdiff = std::max(maxdiff, RelDiff(U.AB_x[ab], F.AB_x[ab]));
+        maxdiff = std::max(maxdiff, RelDiff(U.AB_y[ab], F.AB_y[ab]));
+        maxdiff = std::max(maxdiff, RelDiff(U.AB_z[ab], F.AB_z[ab]));
+
+        if(U.extent12 != NULL)
+        {
+            maxdiff = std::max(maxdiff, RelDiff(U.C_x[ab], F.C_x[ab]));
+            maxdiff = std::max(maxdiff, RelDiff(U.C_y[ab], F.C_y[ab]));
+            maxdiff = std::max(maxdiff, RelDiff(U.C_z[ab], F.C_z[ab]));
+            maxdiff = std::max(maxdiff, RelDiff(U.extent12[ab], F.extent12[ab]));
+        }
+
+        for(int i = idx; i < idx + U.nprim12[ab]; i++)
+        {
+            int j = idx;
+            while(j < idx + F.nprim12[ab] && F.primidx[j] != U.primidx[i])
+                j++;
+
+            if(j == idx + F.nprim12[ab])
+                return 1.0;
+
+            double const * u[] = { U.prefac, U.alpha, U.x, U.y, U.z, U.PA_x, U.PA_y, U.PA_z,
+                                   U.PB_x, U.PB_y, U.PB_z, U.beta, U.alpha1, U.screen };
+            double const * f[] = { F.prefac, F.alpha, F.x, F.y, F.z, F.PA_x, F.PA_y, F.PA_z,
+                                   F.PB_x, F.PB_y, F.PB_z, F.beta, F.alpha1, F.screen };
+
+            for(int m = 0; m < 14; m++)
+                maxdiff = std::max(maxdiff, RelDiff(u[m][i], f[m][j]));
+
+            if(U.extent != NULL)
+                maxdiff = std::max(maxdiff, RelDiff(U.extent[i], F.extent[j]));
+        }
+
+        idx += U.nprim12[ab];
+        if((ab+1) % SIMINT_NSHELL_SIMD == 0 || ab+1 == U.nshell12)
+            idx = SIMINT_SIMD_ROUND(idx);
+    }
+
+    return maxdiff;
+}
+
+
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc != 2)
+    {
+        printf("Usage: test_shellpair_update <basis>\n");
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    std::pair<int, int> maxparams = FindMaxParams(shellmap);
+    const int maxam = (maxparams.first > SIMINT_OSTEI_MAXAM ? SIMINT_OSTEI_MAXAM : maxparams.first);
+
+    double * work = (double *)SIMINT_ALLOC(simint_ostei_workmem(0, maxam));
+
+    // The same shells (sharing the exponents and coefficients), moved
+    // by different amounts
+    ShellMap moved;
+    int nmoved = 0;
+    for(auto & it : shellmap)
+    {
+        moved[it.first] = it.second;
+        for(auto & sh : moved[it.first])
+        {
+            nmoved++;
+            sh.x += 0.3 * sin(1.0 * nmoved);
+            sh.y += 0.3 * sin(2.0 * nmoved);
+            sh.z += 0.3 * sin(3.0 * nmoved);
+        }
+    }
+
+    const int methods[] = { SIMINT_SCREEN_SCHWARZ, SIMINT_SCREEN_FASTSCHWARZ, SIMINT_SCREEN_QQR };
+    const char * names[] = { "Schwarz", "FastSchwarz", "QQR" };
+
+    double maxdiff = 0.0;
+
+    printf("%12s   %7s   %12s\n", "Method", "AM", "MaxRelDiff");
+
+    for(int s = 0; s < 3; s++)
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    {
+        struct simint_multi_shellpair U, F;
+        simint_initialize_multi_shellpair(&U);
+        simint_initialize_multi_shellpair(&F);
+
+        simint_create_multi_shellpair(shellmap[i].size(), shellmap[i].data(),
+                                      shellmap[j].size(), shellmap[j].data(), &U, methods[s]);
+        const int ret = simint_update_multi_shellpair_coords(moved[i].size(), moved[i].data(),
+                                                             moved[j].size(), moved[j].data(),
+                                                             &U, methods[s], work);
+
+        simint_create_multi_shellpair(moved[i].size(), moved[i].data(),
+                                      moved[j].size(), moved[j].data(), &F, methods[s]);
+
+        const double diff = (ret == 0 ? ComparePairs(U, F) : 1.0);
+        maxdiff = std::max(maxdiff, diff);
+        printf("%12s   ( %d %d )   %12.4e\n", names[s], i, j, diff);
+
+        simint_free_multi_shellpair(&U);
+        simint_free_multi_shellpair(&F);
+    }
+
+    printf("\nLargest relative difference: %.4e\n", maxdiff);
+
+
+    // Shell pairs that were pruned entirely keep a placeholder primitive,
+    // which must still not contribute after an update
+    long nplaceholder = 0, nbad = 0;
+
+    for(int s = 0; s < 3; s++)
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    {
+        struct simint_multi_shellpair P, U;
+        simint_initialize_multi_shellpair(&P);
+        simint_initialize_multi_shellpair(&U);
+
+        simint_create_multi_shellpair(shellmap[i].size(), shellmap[i].data(),
+                                      shellmap[j].size(), shellmap[j].data(), &P, methods[s]);
+        // (only the largest primitive pair is kept)
+        simint_prune_multi_shellpair(&P, &U, P.screen_max, P.screen_max);
+
+        // the placeholders are the primitive pairs with a prefactor of zero
+        std::vector<int> placeholder;
+        int idx = 0;
+        for(int ab = 0; ab < U.nshell12; ab++)
+        {
+            for(int k = idx; k < idx + U.nprim12[ab]; k++)
+            {
+                if(U.prefac[k] == 0.0)
+                    placeholder.push_back(k);
+            }
+
+            idx += U.nprim12[ab];
+            if((ab+1) % SIMINT_NSHELL_SIMD == 0 || ab+1 == U.nshell12)
+                idx = SIMINT_SIMD_ROUND(idx);
+        }
+
+        if(simint_update_multi_shellpair_coords(moved[i].size(), moved[i].data(),
+                                                moved[j].size(), moved[j].data(),
+                                                &U, methods[s], work) != 0)
+            nbad++;
+
+        for(int k : placeholder)
+        {
+            if(U.prefac[k] != 0.0 || U.screen[k] != 0.0)
+                nbad++;
+        }
+
+        nplaceholder += placeholder.size();
+
+        simint_free_multi_shellpair(&P);
+        simint_free_multi_shellpair(&U);
+    }
+
+    printf("Pruned shell pairs: %ld, nonzero after the update: %ld\n", nplaceholder, nbad);
+
+    SIMINT_FREE(work);
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    return (maxdiff > 1.0e-12 || nbad > 0) ? 1 : 0;
+}
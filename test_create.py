@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+
+# Generates a library with create.py, builds it, and runs some of its
+# tests. A test fails if it returns nonzero or marks an integral as
+# wrong (***). This is how the tests of the generator
+# (SIMINT_GENERATOR_TESTS) check the kernels of create.py options
+# that the generated libraries do not build by default.
+#
+# Example (kernels that compact the unscreened primitives):
+#   ./test_create.py -g build/generator/ostei -v avx2 -b /tmp/compact \
+#                    -t test_eri test_eri_screen -- -l 2 -p 2 -c
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+
+
+# path to this file
+thisfile = os.path.realpath(__file__)
+topdir = os.path.dirname(thisfile)
+
+parser = argparse.ArgumentParser()
+parser.add_argument("-g", type=str, required=True, help="Path to directory with generator programs")
+parser.add_argument("-b", type=str, required=True, help="Directory to generate and build the library in (its simint and build subdirectories are replaced)")
+parser.add_argument("-v", type=str, required=True, help="SIMINT_VECTOR to build the library with")
+parser.add_argument("-t", type=str, nargs='+', required=True, help="Tests to build and run")
+parser.add_argument("-m", type=str, default="water.6-31gss", help="Basis (in test/dat) to run the tests with")
+parser.add_argument("createargs", type=str, nargs=argparse.REMAINDER, help="Options for create.py (after --)")
+
+args = parser.parse_args()
+
+createargs = [ a for a in args.createargs if a != "--" ]
+
+outdir = os.path.join(os.path.abspath(args.b), "simint")
+builddir = os.path.join(os.path.abspath(args.b), "build")
+
+
+def Run(cmd, cwd = None):
+  print(" ".join(cmd))
+  sys.stdout.flush()
+  ret = subprocess.call(cmd, cwd = cwd)
+  if ret != 0:
+    print("Failed with exit code {}: {}".format(ret, " ".join(cmd)))
+    quit(1)
+
+
+# Generate and build the library and tests
+for d in [ outdir, builddir ]:
+  if os.path.isdir(d):
+    shutil.rmtree(d)
+
+Run([ sys.executable, os.path.join(topdir, "create.py"), "-g", os.path.abspath(args.g) ] + createargs + [ outdir ])
+
+os.makedirs(builddir, exist_ok = True)
+Run([ "cmake", outdir, "-DCMAKE_BUILD_TYPE=Release", "-DSIMINT_VECTOR=" + args.v ], cwd = builddir)
+
+for t in args.t:
+  Run([ "cmake", "--build", ".", "--target", t ], cwd = builddir)
+
+
+# Run the tests
+basfile = os.path.join(outdir, "test", "dat", args.m + ".mol")
+
+nfailed = 0
+for t in args.t:
+  cmd = [ os.path.join(builddir, "test", t), basfile ]
+  print(" ".join(cmd))
+  sys.stdout.flush()
+
+  proc = subprocess.Popen(cmd, stdout = subprocess.PIPE, universal_newlines = True)
+  out = proc.communicate()[0]
+  print(out)
+
+  nbad = out.count("***")
+  if proc.returncode != 0 or nbad > 0:
+    print("{} FAILED (exit code {}, {} wrong integrals)".format(t, proc.returncode, nbad))
+    nfailed += 1
+  else:
+    print("{} passed".format(t))
+
+quit(1 if nfailed > 0 else 0)